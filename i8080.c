@@ -1,3 +1,15 @@
+// the jit compiler (i8080_jit.h) is only available on x86-64 linux, and
+// doesn't maintain the performance counters nor the profile
+#if defined(__x86_64__) && defined(__linux__) && !defined(I8080_COUNTERS) && \
+    !defined(I8080_PROFILER)
+#define JIT_SUPPORTED
+#define _DEFAULT_SOURCE // for MAP_ANONYMOUS
+#endif
+
+#include <limits.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
 #include "i8080.h"
 
 // this array defines the number of cycles one opcode takes.
@@ -25,6 +37,29 @@ static const uint8_t OPCODES_CYCLES[256] = {
 };
 // clang-format on
 
+// this array defines the length in bytes of each opcode (with its operands)
+// clang-format off
+static const uint8_t OPCODES_LENGTH[256] = {
+//  0  1  2  3  4  5  6  7  8  9  A  B  C  D  E  F
+    1, 3, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1, // 0
+    1, 3, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1, 1, 1, 2, 1, // 1
+    1, 3, 3, 1, 1, 1, 2, 1, 1, 1, 3, 1, 1, 1, 2, 1, // 2
+    1, 3, 3, 1, 1, 1, 2, 1, 1, 1, 3, 1, 1, 1, 2, 1, // 3
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 4
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 5
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 6
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 7
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 8
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 9
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // A
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // B
+    1, 1, 3, 3, 3, 1, 2, 1, 1, 1, 3, 3, 3, 3, 2, 1, // C
+    1, 1, 3, 2, 3, 1, 2, 1, 1, 1, 3, 2, 3, 3, 2, 1, // D
+    1, 1, 3, 1, 3, 1, 2, 1, 1, 1, 3, 1, 3, 3, 2, 1, // E
+    1, 1, 3, 1, 3, 1, 2, 1, 1, 1, 3, 1, 3, 3, 2, 1  // F
+};
+// clang-format on
+
 static const char* DISASSEMBLE_TABLE[] = {"nop", "lxi b,#", "stax b", "inx b",
     "inr b", "dcr b", "mvi b,#", "rlc", "ill", "dad b", "ldax b", "dcx b",
     "inr c", "dcr c", "mvi c,#", "rrc", "ill", "lxi d,#", "stax d", "inx d",
@@ -59,46 +94,475 @@ static const char* DISASSEMBLE_TABLE[] = {"nop", "lxi b,#", "stax b", "inx b",
     "rst 5", "rp", "pop psw", "jp $", "di", "cp $", "push psw", "ori #",
     "rst 6", "rm", "sphl", "jm $", "ei", "cm $", "ill", "cpi #", "rst 7"};
 
-#define SET_ZSP(c, val) \
-  do { \
-    c->zf = (val) == 0; \
-    c->sf = (val) >> 7; \
-    c->pf = parity(val); \
-  } while (0)
+// bits of i8080.events
+#define EVENT_CHECK 0x01 // interrupt or halt state needs to be checked
+#define EVENT_STOP 0x02 // i8080_stop has been called
+#define EVENT_BREAK 0x04 // a breakpoint has to be checked (i8080_check_break)
+#define EVENT_REQUEST 0x08 // see i8080_request_interrupt
+
+// bits of i8080.page_flags
+#define PAGE_RAM 0x01 // mapped to writable host memory
+#define PAGE_CODE 0x02 // has cached blocks: writes must be checked
+#define PAGE_OWNED 0x04 // i8080_page allocated by i8080_fork
+#define PAGE_COW 0x08 // owned page shared with other contexts
+#define PAGE_CLEAN 0x10 // not written since i8080_clear_dirty
+#define PAGE_WATCH_READ 0x20 // has read watchpoints: not read directly
+#define PAGE_WATCH_WRITE 0x40 // has write watchpoints: not written directly
+
+// block cache: instructions are decoded once into straight-line blocks (up to
+// the next jump, call, return, io or interrupt instruction, and never
+// crossing a page), stored in a direct-mapped cache indexed by start address.
+// Pages with cached code are write-protected: a write to one of their code
+// bytes invalidates the blocks which contain it, and remapping a page
+// invalidates all its blocks by bumping its generation.
+
+// when the compiler supports labels as values (GCC and clang), the interpreter
+// is threaded code: each instruction jumps straight to the next one through
+// a dispatch table
+#if defined(__GNUC__) && !defined(I8080_SWITCH_DISPATCH)
+#define THREADED_DISPATCH
+#endif
+
+#define CACHE_SIZE 4096 // number of blocks
+#define BLOCK_SIZE I8080_BLOCK_SIZE // maximum number of instructions in a block
+
+// i8080_block.nb_insns and cycles hold the instructions of a whole block,
+// of at most 18 cycles each
+typedef char i8080_check_block_size[
+    BLOCK_SIZE <= UINT8_MAX && BLOCK_SIZE * 18 <= UINT16_MAX ? 1 : -1];
+
+typedef struct i8080_insn {
+#ifdef THREADED_DISPATCH
+  const void* handler; // address of the opcode handler (threaded dispatch)
+#endif
+  uint16_t operand; // immediate byte or word
+  uint16_t next_pc; // address of the next instruction
+  uint16_t cycles_left; // cycles of the instructions after it in the block
+  uint8_t opcode;
+} i8080_insn;
+
+typedef struct i8080_block {
+  uint32_t gen; // generation of the page when the block was decoded
+  uint16_t pc; // start address
+  uint16_t cycles; // cycles of all the instructions
+  uint8_t nb_insns; // 0 if unused
+  uint8_t size; // in bytes
+  uint8_t loop; // LOOP_*: kind of loop if the block jumps back to its start
+#ifdef JIT_SUPPORTED
+  uint16_t hits; // executions until compiled
+  const uint8_t* native; // compiled block (see i8080_jit.h), or NULL
+#endif
+#ifdef I8080_PROFILER
+  unsigned long runs; // executions not added to the profile yet
+#endif
+  i8080_insn insns[BLOCK_SIZE];
+} i8080_block;
+
+typedef struct i8080_block_cache {
+  i8080_block blocks[CACHE_SIZE];
+  uint32_t page_gens[I8080_NB_PAGES];
+  uint8_t code[0x10000 / 8]; // bitmap of the bytes decoded in blocks
+  i8080_cache_stats stats;
+#ifdef JIT_SUPPORTED
+  struct i8080_jit* jit; // NULL if the jit is disabled
+#endif
+} i8080_block_cache;
+
+#include "i8080_profile.h"
+
+// guest profiler (see i8080_profile_start), compiled out by default
+#ifdef I8080_PROFILER
+#define PROFILE(c, addr, n) i8080_profile_cycles(c, addr, n)
+#define PROFILE_FIRST(c, opcode) i8080_profile_first(c, opcode)
+#define PROFILE_INTERRUPT(c) i8080_profile_interrupt(c)
+#define PROFILE_CALL(c, addr) i8080_profile_call(c, addr)
+#define PROFILE_RET(c) i8080_profile_ret(c)
+#define PROFILE_BLOCK(c, block, n) i8080_profile_block(c, block, n)
+#define PROFILE_PARTIAL(c, insn, end) i8080_profile_partial(c, insn, end)
+#define PROFILE_FLUSH(c, block) i8080_profile_flush(c, block)
+#else
+#define PROFILE(c, addr, n) ((void) 0)
+#define PROFILE_FIRST(c, opcode) ((void) 0)
+#define PROFILE_INTERRUPT(c) ((void) 0)
+#define PROFILE_CALL(c, addr) ((void) 0)
+#define PROFILE_RET(c) ((void) 0)
+#define PROFILE_BLOCK(c, block, n) ((void) 0)
+#define PROFILE_PARTIAL(c, insn, end) ((void) 0)
+#define PROFILE_FLUSH(c, block) ((void) 0)
+#endif
+
+// pages of memory shared by forked contexts (see i8080_fork), mapped as ram
+// and freed by the last context to unmap them
+typedef struct i8080_page {
+  unsigned long refs; // number of contexts mapping the page
+  uint8_t data[I8080_PAGE_SIZE];
+} i8080_page;
+
+// copies of the host ram of an emulator, shared with the contexts forked
+// from it while the host ram doesn't change (see i8080_fork)
+typedef struct i8080_shared_pages {
+  const uint8_t* pages[I8080_NB_PAGES]; // NULL if not copied
+} i8080_shared_pages;
+
+// breakpoints of an emulator (see i8080_set_breakpoint): a bitmap of the
+// addresses (or ports) of each kind
+typedef struct i8080_breakpoints {
+  uint8_t bits[I8080_NB_BREAK_KINDS][0x10000 / 8];
+  bool exec; // some execution breakpoints are set
+  i8080_break hit; // last breakpoint hit
+  bool pending; // a breakpoint has been hit and not reported yet
+  bool resume; // hit is an execution breakpoint to step over when resuming
+} i8080_breakpoints;
+
+// an event scheduled with i8080_schedule
+typedef struct i8080_scheduled {
+  unsigned long cycle;
+  // increasing: events due at the same cycle fire in the order they were
+  // scheduled
+  unsigned long id;
+  void (*callback)(void*, unsigned long);
+  void* arg;
+} i8080_scheduled;
+
+// a port read from rings (see i8080_bind_in and i8080_bind_status)
+typedef struct i8080_port_binding {
+  i8080_ring* ring; // popped by IN, or checked for input by a status port
+  i8080_ring* out; // checked for room by a status port
+  uint8_t value; // read when `ring` is empty, or bit set if it isn't (status)
+  uint8_t out_ready; // bit set if `out` has room (status)
+  bool status;
+} i8080_port_binding;
+
+// ports of an emulator bound to rings, instead of the io callbacks
+typedef struct i8080_ports {
+  i8080_port_binding in[256]; // bound if `ring` or `out` isn't NULL
+  i8080_ring* out[256];
+} i8080_ports;
+
+// events scheduled on an emulator, as a binary min-heap ordered by cycle
+typedef struct i8080_scheduler {
+  i8080_scheduled* heap;
+  size_t nb_events, capacity;
+  unsigned long last_id;
+} i8080_scheduler;
+
+#define PAGE_OF(mem) \
+  ((i8080_page*) ((uint8_t*) (mem) - offsetof(i8080_page, data)))
+
+// forked contexts can run on different threads
+#ifdef __GNUC__
+#define REFS_ADD(p, n) __atomic_add_fetch(&(p)->refs, n, __ATOMIC_ACQ_REL)
+#define REFS_GET(p) __atomic_load_n(&(p)->refs, __ATOMIC_ACQUIRE)
+#else
+#define REFS_ADD(p, n) ((p)->refs += (n))
+#define REFS_GET(p) ((p)->refs)
+#endif
+
+// i8080.events can be set from other threads (see i8080_request_interrupt):
+// it is only read with relaxed loads (plain loads on most architectures), and
+// modified with atomic operations, which are rare
+#ifdef __GNUC__
+#define EVENTS(c) __atomic_load_n(&(c)->events, __ATOMIC_RELAXED)
+#define EVENTS_SET(c, bits) \
+  __atomic_or_fetch(&(c)->events, bits, __ATOMIC_RELEASE)
+#define EVENTS_CLEAR(c, bits) \
+  __atomic_and_fetch(&(c)->events, (uint8_t) ~(bits), __ATOMIC_RELAXED)
+#define REQUEST_SET(c, val) \
+  __atomic_store_n(&(c)->interrupt_request, val, __ATOMIC_RELEASE)
+#define REQUEST_TAKE(c) \
+  __atomic_exchange_n(&(c)->interrupt_request, 0, __ATOMIC_ACQUIRE)
+#define LOAD_ACQUIRE(p) __atomic_load_n(p, __ATOMIC_ACQUIRE)
+#define STORE_RELEASE(p, val) __atomic_store_n(p, val, __ATOMIC_RELEASE)
+#else
+#define LOAD_ACQUIRE(p) (*(p))
+#define STORE_RELEASE(p, val) (*(p) = (val))
+#define EVENTS(c) ((c)->events)
+#define EVENTS_SET(c, bits) ((c)->events |= (bits))
+#define EVENTS_CLEAR(c, bits) ((c)->events &= (uint8_t) ~(bits))
+#define REQUEST_SET(c, val) ((c)->interrupt_request = (val))
+#define REQUEST_TAKE(c) i8080_request_take(c)
+static inline uint16_t i8080_request_take(i8080* const c) {
+  const uint16_t request = c->interrupt_request;
+  c->interrupt_request = 0;
+  return request;
+}
+#endif
 
-// memory helpers (the only four to use `read_byte` and `write_byte` function
-// pointers)
+// page helpers
 
-// reads a byte from memory
-static inline uint8_t i8080_rb(i8080* const c, uint16_t addr) {
+// returns a new page holding a copy of `mem`, or NULL
+static const uint8_t* i8080_new_page(const uint8_t* mem) {
+  i8080_page* const p = malloc(sizeof(i8080_page));
+  if (p == NULL) {
+    return NULL;
+  }
+  p->refs = 1;
+  memcpy(p->data, mem, I8080_PAGE_SIZE);
+  return p->data;
+}
+
+static void i8080_release_page(const uint8_t* mem) {
+  i8080_page* const p = PAGE_OF(mem);
+  if (REFS_ADD(p, -1) == 0) {
+    free(p);
+  }
+}
+
+// updates the direct pointers of a page: only unprotected ram is written
+// directly, and data is read directly unless the page is watched
+static inline void i8080_update_page(i8080* const c, uint8_t page) {
+  c->data_pages[page] =
+      c->page_flags[page] & PAGE_WATCH_READ ? NULL : c->read_pages[page];
+  if ((c->page_flags[page] & ~(PAGE_OWNED | PAGE_WATCH_READ)) == PAGE_RAM) {
+    c->write_pages[page] = (uint8_t*) c->read_pages[page];
+  } else {
+    c->write_pages[page] = NULL;
+  }
+}
+
+// drops all the cached blocks of a page
+static void i8080_invalidate_page(i8080* const c, uint8_t page) {
+  i8080_block_cache* const cache = c->cache;
+  cache->page_gens[page] += 1;
+  memset(&cache->code[page * I8080_PAGE_SIZE / 8], 0, I8080_PAGE_SIZE / 8);
+  cache->stats.invalidations += 1;
+
+  c->page_flags[page] &= ~PAGE_CODE;
+  i8080_update_page(c, page);
+
+  // the block being executed may be one of them
+  EVENTS_SET(c, EVENT_CHECK);
+}
+
+// drops the cached blocks which contain the byte at `addr`
+static void i8080_invalidate_code(i8080* const c, uint16_t addr) {
+  i8080_block_cache* const cache = c->cache;
+  const uint8_t page = addr >> 8;
+
+  // blocks don't cross pages and are at most BLOCK_SIZE * 3 bytes long
+  int first = addr - (BLOCK_SIZE * 3 - 1);
+  if (first < page * I8080_PAGE_SIZE) {
+    first = page * I8080_PAGE_SIZE;
+  }
+
+  for (int pc = first; pc <= addr; pc++) {
+    i8080_block* const block = &cache->blocks[pc % CACHE_SIZE];
+    if (block->nb_insns != 0 && block->pc == pc &&
+        block->gen == cache->page_gens[page] && addr < pc + block->size) {
+      PROFILE_FLUSH(c, block);
+      block->nb_insns = 0;
+      cache->stats.invalidations += 1;
+    }
+  }
+  cache->code[addr / 8] &= ~(1 << (addr % 8));
+
+  // the block being executed may be one of them
+  EVENTS_SET(c, EVENT_CHECK);
+}
+
+// gives a context its own copy of a shared page (unless the others have
+// released it already). Returns false if out of memory.
+static bool i8080_unshare_page(i8080* const c, uint8_t page) {
+  const uint8_t* const mem = c->read_pages[page];
+  if (REFS_GET(PAGE_OF(mem)) != 1) {
+    const uint8_t* const copy = i8080_new_page(mem);
+    if (copy == NULL) {
+      return false;
+    }
+    c->read_pages[page] = copy;
+    i8080_release_page(mem);
+  }
+
+  c->page_flags[page] &= ~PAGE_COW;
+  i8080_update_page(c, page);
+  return true;
+}
+
+// returns if a breakpoint is set at an address (or port)
+static inline bool i8080_breakpoint(i8080* const c, int kind, uint16_t addr) {
+  return c->breakpoints->bits[kind][addr / 8] & (1 << (addr % 8));
+}
+
+// records that a watchpoint or a port breakpoint has been hit: i8080_run
+// returns before the next instruction
+static void i8080_break_hit(
+    i8080* const c, int kind, uint16_t addr, uint8_t value) {
+  i8080_breakpoints* const b = c->breakpoints;
+  if (!b->pending) {
+    b->hit.kind = kind;
+    b->hit.addr = addr;
+    b->hit.value = value;
+    b->pending = true;
+    b->resume = false;
+  }
+  EVENTS_SET(c, EVENT_BREAK);
+}
+
+// reads a byte of an instruction from a page that isn't mapped
+static uint8_t i8080_fetch_slow(i8080* const c, uint16_t addr) {
   return c->read_byte(c->userdata, addr);
 }
 
+// reads a byte of data from a page that can't be read directly: either
+// watched or handled by the `read_byte` callback
+static uint8_t i8080_rb_slow(i8080* const c, uint16_t addr) {
+  const uint8_t page = addr >> 8;
+  const uint8_t val = c->read_pages[page] != NULL
+                          ? c->read_pages[page][addr & 0xFF]
+                          : c->read_byte(c->userdata, addr);
+
+  if ((c->page_flags[page] & PAGE_WATCH_READ) &&
+      i8080_breakpoint(c, I8080_BREAK_READ, addr)) {
+    i8080_break_hit(c, I8080_BREAK_READ, addr, val);
+  }
+  return val;
+}
+
+// writes a byte to a page that can't be written directly: either protected
+// ram (with cached code, shared or clean) or memory handled by the
+// `write_byte` callback. Watchpoints are checked by i8080_wb_slow.
+static void i8080_store_slow(i8080* const c, uint16_t addr, uint8_t val) {
+  const uint8_t page = addr >> 8;
+
+  if (c->page_flags[page] & PAGE_CLEAN) {
+    c->dirty_pages[page / 8] |= 1 << (page % 8);
+    c->page_flags[page] &= ~PAGE_CLEAN;
+    i8080_update_page(c, page);
+  }
+
+  // the write is lost if the page can't be copied
+  if ((c->page_flags[page] & PAGE_COW) && !i8080_unshare_page(c, page)) {
+    return;
+  }
+
+  if ((c->page_flags[page] & PAGE_CODE) &&
+      (c->cache->code[addr / 8] & (1 << (addr % 8)))) {
+    i8080_invalidate_code(c, addr);
+  }
+
+  if (c->page_flags[page] & PAGE_RAM) {
+    ((uint8_t*) c->read_pages[page])[addr & 0xFF] = val;
+  } else {
+    c->write_byte(c->userdata, addr, val);
+  }
+}
+
+// writes a byte to a page that can't be written directly: either watched or
+// handled by i8080_store_slow
+static void i8080_wb_slow(i8080* const c, uint16_t addr, uint8_t val) {
+  if ((c->page_flags[addr >> 8] & PAGE_WATCH_WRITE) &&
+      i8080_breakpoint(c, I8080_BREAK_WRITE, addr)) {
+    i8080_break_hit(c, I8080_BREAK_WRITE, addr, val);
+  }
+  i8080_store_slow(c, addr, val);
+}
+
+// flags lookup tables, indexed by the result of an operation
+#define PARITY(v) \
+  ((~((v) ^ (v) >> 1 ^ (v) >> 2 ^ (v) >> 3 ^ (v) >> 4 ^ (v) >> 5 ^ (v) >> 6 ^ \
+      (v) >> 7) & 1) << 2)
+#define ZSP(v) (((v) & I8080_SF) | ((v) == 0) << 6 | PARITY(v) | 0x02)
+#define INR(v) (ZSP(v) | (((v) & 0xF) == 0) << 4)
+#define DCR(v) (ZSP(v) | (((v) & 0xF) != 0xF) << 4)
+#define ROW(f, v) \
+  f(v + 0x0), f(v + 0x1), f(v + 0x2), f(v + 0x3), f(v + 0x4), f(v + 0x5), \
+  f(v + 0x6), f(v + 0x7), f(v + 0x8), f(v + 0x9), f(v + 0xA), f(v + 0xB), \
+  f(v + 0xC), f(v + 0xD), f(v + 0xE), f(v + 0xF)
+#define TABLE(f) \
+  ROW(f, 0x00), ROW(f, 0x10), ROW(f, 0x20), ROW(f, 0x30), ROW(f, 0x40), \
+  ROW(f, 0x50), ROW(f, 0x60), ROW(f, 0x70), ROW(f, 0x80), ROW(f, 0x90), \
+  ROW(f, 0xA0), ROW(f, 0xB0), ROW(f, 0xC0), ROW(f, 0xD0), ROW(f, 0xE0), \
+  ROW(f, 0xF0)
+
+// sign, zero and parity flags of a result (bit 1 is set too)
+static const uint8_t ZSP_TABLE[256] = {TABLE(ZSP)};
+#ifndef I8080_LAZY_FLAGS
+// flags set by INR and DCR (all but carry)
+static const uint8_t INR_TABLE[256] = {TABLE(INR)};
+static const uint8_t DCR_TABLE[256] = {TABLE(DCR)};
+#endif
+
+#undef PARITY
+#undef ZSP
+#undef INR
+#undef DCR
+#undef ROW
+#undef TABLE
+
+// the memory and fetch helpers are used by almost every instruction, in both
+// execution loops: the compiler must not give up inlining them
+#ifdef __GNUC__
+#define ALWAYS_INLINE inline __attribute__((always_inline))
+#else
+#define ALWAYS_INLINE inline
+#endif
+
+// performance counters (see i8080_counters), compiled out by default
+#ifdef I8080_COUNTERS
+#define COUNT(c, counter, n) ((c)->counters.counter += (n))
+#else
+#define COUNT(c, counter, n) ((void) 0)
+#endif
+
+// memory helpers (the only ones to use the memory map and, with
+// i8080_fetch_slow, i8080_rb_slow and i8080_store_slow, the `read_byte` and
+// `write_byte` function pointers)
+
+// reads a byte of an instruction from memory
+static ALWAYS_INLINE uint8_t i8080_fetch(i8080* const c, uint16_t addr) {
+  const uint8_t* page = c->read_pages[addr >> 8];
+  if (page != NULL) {
+    return page[addr & 0xFF];
+  }
+  return i8080_fetch_slow(c, addr);
+}
+
+// reads a word of an instruction from memory
+static ALWAYS_INLINE uint16_t i8080_fetch_word(i8080* const c, uint16_t addr) {
+  return i8080_fetch(c, addr + 1) << 8 | i8080_fetch(c, addr);
+}
+
+// reads a byte from memory
+static ALWAYS_INLINE uint8_t i8080_rb(i8080* const c, uint16_t addr) {
+  COUNT(c, reads, 1);
+  const uint8_t* page = c->data_pages[addr >> 8];
+  if (page != NULL) {
+    return page[addr & 0xFF];
+  }
+  return i8080_rb_slow(c, addr);
+}
+
 // writes a byte to memory
-static inline void i8080_wb(i8080* const c, uint16_t addr, uint8_t val) {
-  c->write_byte(c->userdata, addr, val);
+static ALWAYS_INLINE void i8080_wb(i8080* const c, uint16_t addr, uint8_t val) {
+  COUNT(c, writes, 1);
+  uint8_t* page = c->write_pages[addr >> 8];
+  if (page != NULL) {
+    page[addr & 0xFF] = val;
+  } else {
+    i8080_wb_slow(c, addr, val);
+  }
 }
 
 // reads a word from memory
-static inline uint16_t i8080_rw(i8080* const c, uint16_t addr) {
-  return c->read_byte(c->userdata, addr + 1) << 8 |
-         c->read_byte(c->userdata, addr);
+static ALWAYS_INLINE uint16_t i8080_rw(i8080* const c, uint16_t addr) {
+  return i8080_rb(c, addr + 1) << 8 | i8080_rb(c, addr);
 }
 
 // writes a word to memory
-static inline void i8080_ww(i8080* const c, uint16_t addr, uint16_t val) {
-  c->write_byte(c->userdata, addr, val & 0xFF);
-  c->write_byte(c->userdata, addr + 1, val >> 8);
+static ALWAYS_INLINE void i8080_ww(
+    i8080* const c, uint16_t addr, uint16_t val) {
+  i8080_wb(c, addr, val & 0xFF);
+  i8080_wb(c, addr + 1, val >> 8);
 }
 
 // returns the next byte in memory (and updates the program counter)
-static inline uint8_t i8080_next_byte(i8080* const c) {
-  return i8080_rb(c, c->pc++);
+static ALWAYS_INLINE uint8_t i8080_next_byte(i8080* const c) {
+  return i8080_fetch(c, c->pc++);
 }
 
 // returns the next word in memory (and updates the program counter)
-static inline uint16_t i8080_next_word(i8080* const c) {
-  uint16_t result = i8080_rw(c, c->pc);
+static ALWAYS_INLINE uint16_t i8080_next_word(i8080* const c) {
+  uint16_t result = i8080_fetch_word(c, c->pc);
   c->pc += 2;
   return result;
 }
@@ -148,61 +612,111 @@ static inline uint16_t i8080_pop_stack(i8080* const c) {
 
 // opcodes
 
-// returns the parity of byte: 0 if number of 1 bits in `val` is odd, else 1
-static inline bool parity(uint8_t val) {
-  uint8_t nb_one_bits = 0;
-  for (int i = 0; i < 8; i++) {
-    nb_one_bits += ((val >> i) & 1);
+// flags helpers: with I8080_LAZY_FLAGS, ALU operations only record their
+// result and sign, zero, half-carry and parity are computed when read. The
+// carry flag is always kept up to date in `f`.
+
+#ifdef I8080_LAZY_FLAGS
+// records the result of an ALU operation, and `aux` which has the half-carry
+// in bit 4
+static inline void i8080_defer_flags(
+    i8080* const c, uint8_t result, uint8_t aux) {
+  c->lazy_flags = 1;
+  c->lazy_result = result;
+  c->lazy_aux = aux;
+}
+#endif
+
+// computes the pending lazy flags (if any) into `f`
+static inline void i8080_sync_flags(i8080* const c) {
+#ifdef I8080_LAZY_FLAGS
+  if (c->lazy_flags) {
+    c->f = (c->f & I8080_CF) | ZSP_TABLE[c->lazy_result] |
+           (c->lazy_aux & I8080_HF);
+    c->lazy_flags = 0;
+  }
+#else
+  (void) c;
+#endif
+}
+
+// returns if a flag is set
+static inline bool i8080_flag(i8080* const c, uint8_t flag) {
+#ifdef I8080_LAZY_FLAGS
+  if (c->lazy_flags && flag != I8080_CF) {
+    if (flag == I8080_ZF) {
+      return c->lazy_result == 0;
+    }
+    if (flag == I8080_SF) {
+      return c->lazy_result & 0x80;
+    }
+    i8080_sync_flags(c);
   }
+#endif
+  return c->f & flag;
+}
 
-  return (nb_one_bits & 1) == 0;
+// sets sign, zero and parity from `result`, half-carry from bit 4 of `aux`
+// and carry from bit 0 of `cy`
+static inline void i8080_set_flags(
+    i8080* const c, uint8_t result, uint8_t aux, uint8_t cy) {
+#ifdef I8080_LAZY_FLAGS
+  i8080_defer_flags(c, result, aux);
+  c->f = 0x02 | cy;
+#else
+  c->f = ZSP_TABLE[result] | (aux & I8080_HF) | cy;
+#endif
 }
 
-// returns if there was a carry between bit "bit_no" and "bit_no - 1" when
-// executing "a + b + cy"
-static inline bool carry(int bit_no, uint8_t a, uint8_t b, bool cy) {
-  int16_t result = a + b + cy;
-  int16_t carry = result ^ a ^ b;
-  return carry & (1 << bit_no);
+// sets the carry flag (leaving the other flags as they are)
+static inline void i8080_set_cf(i8080* const c, bool cy) {
+  c->f = (c->f & ~I8080_CF) | cy;
 }
 
 // adds a value (+ an optional carry flag) to a register
 static inline void i8080_add(
     i8080* const c, uint8_t* const reg, uint8_t val, bool cy) {
-  uint8_t result = *reg + val + cy;
-  c->cf = carry(8, *reg, val, cy);
-  c->hf = carry(4, *reg, val, cy);
-  SET_ZSP(c, result);
+  uint16_t result = *reg + val + cy;
+  // bit 4 of `a ^ b ^ (a + b)` is the carry from bit 3 into bit 4
+  i8080_set_flags(c, result, *reg ^ val ^ result, result >> 8);
   *reg = result;
 }
 
-// substracts a byte (+ an optional carry flag) from a register
-// see https://stackoverflow.com/a/8037485
+// substracts a byte (+ an optional carry flag) from a register. The 8080
+// computes `reg + ~val + !cy`, so the half-carry is the inverse of a borrow.
 static inline void i8080_sub(
     i8080* const c, uint8_t* const reg, uint8_t val, bool cy) {
-  i8080_add(c, reg, ~val, !cy);
-  c->cf = !c->cf;
+  uint16_t result = *reg - val - cy;
+  i8080_set_flags(c, result, ~(*reg ^ val ^ result), (result >> 8) & 1);
+  *reg = result;
 }
 
 // adds a word to HL
 static inline void i8080_dad(i8080* const c, uint16_t val) {
-  c->cf = ((i8080_get_hl(c) + val) >> 16) & 1;
-  i8080_set_hl(c, i8080_get_hl(c) + val);
+  uint32_t result = i8080_get_hl(c) + val;
+  i8080_set_cf(c, result >> 16);
+  i8080_set_hl(c, result);
 }
 
 // increments a byte
 static inline uint8_t i8080_inr(i8080* const c, uint8_t val) {
   uint8_t result = val + 1;
-  c->hf = (result & 0xF) == 0;
-  SET_ZSP(c, result);
+#ifdef I8080_LAZY_FLAGS
+  i8080_defer_flags(c, result, val ^ result);
+#else
+  c->f = (c->f & I8080_CF) | INR_TABLE[result];
+#endif
   return result;
 }
 
 // decrements a byte
 static inline uint8_t i8080_dcr(i8080* const c, uint8_t val) {
   uint8_t result = val - 1;
-  c->hf = !((result & 0xF) == 0xF);
-  SET_ZSP(c, result);
+#ifdef I8080_LAZY_FLAGS
+  i8080_defer_flags(c, result, ~(val ^ result));
+#else
+  c->f = (c->f & I8080_CF) | DCR_TABLE[result];
+#endif
   return result;
 }
 
@@ -210,9 +724,7 @@ static inline uint8_t i8080_dcr(i8080* const c, uint8_t val) {
 // result in register A
 static inline void i8080_ana(i8080* const c, uint8_t val) {
   uint8_t result = c->a & val;
-  c->cf = 0;
-  c->hf = ((c->a | val) & 0x08) != 0;
-  SET_ZSP(c, result);
+  i8080_set_flags(c, result, (c->a | val) << 1, 0);
   c->a = result;
 }
 
@@ -220,26 +732,20 @@ static inline void i8080_ana(i8080* const c, uint8_t val) {
 // result in register A
 static inline void i8080_xra(i8080* const c, uint8_t val) {
   c->a ^= val;
-  c->cf = 0;
-  c->hf = 0;
-  SET_ZSP(c, c->a);
+  i8080_set_flags(c, c->a, 0, 0);
 }
 
 // executes a logic "or" between register A and a byte, then stores the
 // result in register A
 static inline void i8080_ora(i8080* const c, uint8_t val) {
   c->a |= val;
-  c->cf = 0;
-  c->hf = 0;
-  SET_ZSP(c, c->a);
+  i8080_set_flags(c, c->a, 0, 0);
 }
 
 // compares the register A to another byte
 static inline void i8080_cmp(i8080* const c, uint8_t val) {
-  int16_t result = c->a - val;
-  c->cf = result >> 8;
-  c->hf = ~(c->a ^ result ^ val) & 0x10;
-  SET_ZSP(c, result & 0xFF);
+  uint16_t result = c->a - val;
+  i8080_set_flags(c, result, ~(c->a ^ val ^ result), (result >> 8) & 1);
 }
 
 // sets the program counter to a given address
@@ -247,10 +753,10 @@ static inline void i8080_jmp(i8080* const c, uint16_t addr) {
   c->pc = addr;
 }
 
-// jumps to next address pointed by the next word in memory if a condition
-// is met
-static inline void i8080_cond_jmp(i8080* const c, bool condition) {
-  uint16_t addr = i8080_next_word(c);
+// jumps to an address if a condition is met
+static inline void i8080_cond_jmp(
+    i8080* const c, uint16_t addr, bool condition) {
+  COUNT(c, jumps[condition], 1);
   if (condition) {
     c->pc = addr;
   }
@@ -258,81 +764,78 @@ static inline void i8080_cond_jmp(i8080* const c, bool condition) {
 
 // pushes the current pc to the stack, then jumps to an address
 static inline void i8080_call(i8080* const c, uint16_t addr) {
+  PROFILE_CALL(c, addr);
   i8080_push_stack(c, c->pc);
   i8080_jmp(c, addr);
 }
 
-// calls to next word in memory if a condition is met
-static inline void i8080_cond_call(i8080* const c, bool condition) {
-  uint16_t addr = i8080_next_word(c);
+// calls an address if a condition is met
+static inline void i8080_cond_call(
+    i8080* const c, uint16_t addr, bool condition) {
+  COUNT(c, calls[condition], 1);
   if (condition) {
-    i8080_call(c, addr);
     c->cyc += 6;
+    PROFILE(c, c->pc - 3, 6);
+    i8080_call(c, addr);
   }
 }
 
 // returns from subroutine
 static inline void i8080_ret(i8080* const c) {
   c->pc = i8080_pop_stack(c);
+  PROFILE_RET(c);
 }
 
 // returns from subroutine if a condition is met
 static inline void i8080_cond_ret(i8080* const c, bool condition) {
+  COUNT(c, returns[condition], 1);
   if (condition) {
-    i8080_ret(c);
     c->cyc += 6;
+    PROFILE(c, c->pc - 1, 6);
+    i8080_ret(c);
   }
 }
 
 // pushes register A and the flags into the stack
 static inline void i8080_push_psw(i8080* const c) {
-  // note: bit 3 and 5 are always 0
-  uint8_t psw = 0;
-  psw |= c->sf << 7;
-  psw |= c->zf << 6;
-  psw |= c->hf << 4;
-  psw |= c->pf << 2;
-  psw |= 1 << 1; // bit 1 is always 1
-  psw |= c->cf << 0;
-  i8080_push_stack(c, c->a << 8 | psw);
+  i8080_sync_flags(c);
+  i8080_push_stack(c, c->a << 8 | c->f);
 }
 
 // pops register A and the flags from the stack
 static inline void i8080_pop_psw(i8080* const c) {
   uint16_t af = i8080_pop_stack(c);
   c->a = af >> 8;
-  uint8_t psw = af & 0xFF;
-
-  c->sf = (psw >> 7) & 1;
-  c->zf = (psw >> 6) & 1;
-  c->hf = (psw >> 4) & 1;
-  c->pf = (psw >> 2) & 1;
-  c->cf = (psw >> 0) & 1;
+  // bit 1 is always 1, bits 3 and 5 are always 0
+  c->f = (af & 0xD5) | 0x02;
+#ifdef I8080_LAZY_FLAGS
+  c->lazy_flags = 0;
+#endif
 }
 
 // rotate register A left
 static inline void i8080_rlc(i8080* const c) {
-  c->cf = c->a >> 7;
-  c->a = (c->a << 1) | c->cf;
+  i8080_set_cf(c, c->a >> 7);
+  c->a = (c->a << 1) | (c->a >> 7);
 }
 
 // rotate register A right
 static inline void i8080_rrc(i8080* const c) {
-  c->cf = c->a & 1;
-  c->a = (c->a >> 1) | (c->cf << 7);
+  i8080_set_cf(c, c->a & 1);
+  c->a = (c->a >> 1) | (c->a << 7);
 }
 
 // rotate register A left with the carry flag
 static inline void i8080_ral(i8080* const c) {
-  bool cy = c->cf;
-  c->cf = c->a >> 7;
+  bool cy = c->f & I8080_CF;
+  i8080_set_cf(c, c->a >> 7);
   c->a = (c->a << 1) | cy;
 }
 
 // rotate register A right with the carry flag
 static inline void i8080_rar(i8080* const c) {
-  bool cy = c->cf;
-  c->cf = c->a & 1;
+  bool cy = c->f & I8080_CF;
+  i8080_set_cf(c, c->a & 1);
   c->a = (c->a >> 1) | (cy << 7);
 }
 
@@ -340,23 +843,24 @@ static inline void i8080_rar(i8080* const c) {
 // to form two four-bit binary-coded-decimal digits.
 // For example, if A=$2B and DAA is executed, A becomes $31.
 static inline void i8080_daa(i8080* const c) {
-  bool cy = c->cf;
+  i8080_sync_flags(c);
+  bool cy = c->f & I8080_CF;
   uint8_t correction = 0;
 
   uint8_t lsb = c->a & 0x0F;
   uint8_t msb = c->a >> 4;
 
-  if (c->hf || lsb > 9) {
+  if ((c->f & I8080_HF) || lsb > 9) {
     correction += 0x06;
   }
 
-  if (c->cf || msb > 9 || (msb >= 9 && lsb > 9)) {
+  if ((c->f & I8080_CF) || msb > 9 || (msb >= 9 && lsb > 9)) {
     correction += 0x60;
     cy = 1;
   }
 
   i8080_add(c, &c->a, correction, 0);
-  c->cf = cy;
+  i8080_set_cf(c, cy);
 }
 
 // switches the value of registers DE and HL
@@ -373,332 +877,660 @@ static inline void i8080_xthl(i8080* const c) {
   i8080_set_hl(c, val);
 }
 
-// executes one opcode
-static inline void i8080_execute(i8080* const c, uint8_t opcode) {
-  c->cyc += OPCODES_CYCLES[opcode];
+// initialises an empty ring
+void i8080_ring_init(i8080_ring* const r) {
+  memset(r, 0, sizeof(i8080_ring));
+}
 
-  // when DI is executed, interrupts won't be serviced
-  // until the end of next instruction:
-  if (c->interrupt_delay > 0) {
-    c->interrupt_delay -= 1;
+// writes up to `size` bytes to a ring, from the thread producing its data.
+// Returns the number of bytes written, less than `size` if it is full.
+size_t i8080_ring_write(i8080_ring* const r, const uint8_t* buf, size_t size) {
+  const size_t head = r->head;
+  const size_t room = I8080_RING_SIZE - (head - LOAD_ACQUIRE(&r->tail));
+  size = size < room ? size : room;
+  for (size_t i = 0; i < size; i++) {
+    r->data[(head + i) % I8080_RING_SIZE] = buf[i];
+  }
+  STORE_RELEASE(&r->head, head + size);
+  return size;
+}
+
+// reads up to `size` bytes from a ring, from the thread consuming its data.
+// Returns the number of bytes read, less than `size` if it is empty.
+size_t i8080_ring_read(i8080_ring* const r, uint8_t* buf, size_t size) {
+  const size_t tail = r->tail;
+  const size_t count = LOAD_ACQUIRE(&r->head) - tail;
+  size = size < count ? size : count;
+  for (size_t i = 0; i < size; i++) {
+    buf[i] = r->data[(tail + i) % I8080_RING_SIZE];
+  }
+  STORE_RELEASE(&r->tail, tail + size);
+  return size;
+}
+
+// reads a port, from its rings if it is bound to some
+static uint8_t i8080_bound_in(i8080* const c, uint8_t port) {
+  const i8080_port_binding* const b = &c->ports->in[port];
+  if (b->ring == NULL && b->out == NULL) {
+    return c->port_in(c->userdata, port);
+  }
+
+  if (!b->status) {
+    uint8_t val = b->value;
+    i8080_ring_read(b->ring, &val, 1);
+    return val;
+  }
+
+  uint8_t status = 0;
+  if (b->ring != NULL && LOAD_ACQUIRE(&b->ring->head) != b->ring->tail) {
+    status |= b->value;
+  }
+  if (b->out != NULL &&
+      b->out->head - LOAD_ACQUIRE(&b->out->tail) < I8080_RING_SIZE) {
+    status |= b->out_ready;
   }
+  return status;
+}
 
+// reads a byte from a port
+static inline uint8_t i8080_in(i8080* const c, uint8_t port) {
+  COUNT(c, port_in, 1);
+  const uint8_t val = c->ports != NULL ? i8080_bound_in(c, port)
+                                       : c->port_in(c->userdata, port);
+  if (c->breakpoints != NULL && i8080_breakpoint(c, I8080_BREAK_IN, port)) {
+    i8080_break_hit(c, I8080_BREAK_IN, port, val);
+  }
+  return val;
+}
+
+// writes a byte to a port
+static inline void i8080_out(i8080* const c, uint8_t port, uint8_t val) {
+  COUNT(c, port_out, 1);
+  if (c->breakpoints != NULL && i8080_breakpoint(c, I8080_BREAK_OUT, port)) {
+    i8080_break_hit(c, I8080_BREAK_OUT, port, val);
+  }
+  if (c->ports != NULL && c->ports->out[port] != NULL) {
+    i8080_ring* const ring = c->ports->out[port];
+    if (i8080_ring_write(ring, &val, 1) == 0) {
+      ring->dropped += 1;
+    }
+    return;
+  }
+  c->port_out(c->userdata, port, val);
+}
+
+// returns if an instruction ends a block: it changes the control flow or
+// the interrupt state, or calls the io callbacks
+static inline bool i8080_ends_block(uint8_t opcode) {
   switch (opcode) {
-  case 0x7F: c->a = c->a; break; // MOV A,A
-  case 0x78: c->a = c->b; break; // MOV A,B
-  case 0x79: c->a = c->c; break; // MOV A,C
-  case 0x7A: c->a = c->d; break; // MOV A,D
-  case 0x7B: c->a = c->e; break; // MOV A,E
-  case 0x7C: c->a = c->h; break; // MOV A,H
-  case 0x7D: c->a = c->l; break; // MOV A,L
-  case 0x7E: c->a = i8080_rb(c, i8080_get_hl(c)); break; // MOV A,M
-
-  case 0x0A: c->a = i8080_rb(c, i8080_get_bc(c)); break; // LDAX B
-  case 0x1A: c->a = i8080_rb(c, i8080_get_de(c)); break; // LDAX D
-  case 0x3A: c->a = i8080_rb(c, i8080_next_word(c)); break; // LDA word
-
-  case 0x47: c->b = c->a; break; // MOV B,A
-  case 0x40: c->b = c->b; break; // MOV B,B
-  case 0x41: c->b = c->c; break; // MOV B,C
-  case 0x42: c->b = c->d; break; // MOV B,D
-  case 0x43: c->b = c->e; break; // MOV B,E
-  case 0x44: c->b = c->h; break; // MOV B,H
-  case 0x45: c->b = c->l; break; // MOV B,L
-  case 0x46: c->b = i8080_rb(c, i8080_get_hl(c)); break; // MOV B,M
-
-  case 0x4F: c->c = c->a; break; // MOV C,A
-  case 0x48: c->c = c->b; break; // MOV C,B
-  case 0x49: c->c = c->c; break; // MOV C,C
-  case 0x4A: c->c = c->d; break; // MOV C,D
-  case 0x4B: c->c = c->e; break; // MOV C,E
-  case 0x4C: c->c = c->h; break; // MOV C,H
-  case 0x4D: c->c = c->l; break; // MOV C,L
-  case 0x4E: c->c = i8080_rb(c, i8080_get_hl(c)); break; // MOV C,M
-
-  case 0x57: c->d = c->a; break; // MOV D,A
-  case 0x50: c->d = c->b; break; // MOV D,B
-  case 0x51: c->d = c->c; break; // MOV D,C
-  case 0x52: c->d = c->d; break; // MOV D,D
-  case 0x53: c->d = c->e; break; // MOV D,E
-  case 0x54: c->d = c->h; break; // MOV D,H
-  case 0x55: c->d = c->l; break; // MOV D,L
-  case 0x56: c->d = i8080_rb(c, i8080_get_hl(c)); break; // MOV D,M
-
-  case 0x5F: c->e = c->a; break; // MOV E,A
-  case 0x58: c->e = c->b; break; // MOV E,B
-  case 0x59: c->e = c->c; break; // MOV E,C
-  case 0x5A: c->e = c->d; break; // MOV E,D
-  case 0x5B: c->e = c->e; break; // MOV E,E
-  case 0x5C: c->e = c->h; break; // MOV E,H
-  case 0x5D: c->e = c->l; break; // MOV E,L
-  case 0x5E: c->e = i8080_rb(c, i8080_get_hl(c)); break; // MOV E,M
-
-  case 0x67: c->h = c->a; break; // MOV H,A
-  case 0x60: c->h = c->b; break; // MOV H,B
-  case 0x61: c->h = c->c; break; // MOV H,C
-  case 0x62: c->h = c->d; break; // MOV H,D
-  case 0x63: c->h = c->e; break; // MOV H,E
-  case 0x64: c->h = c->h; break; // MOV H,H
-  case 0x65: c->h = c->l; break; // MOV H,L
-  case 0x66: c->h = i8080_rb(c, i8080_get_hl(c)); break; // MOV H,M
-
-  case 0x6F: c->l = c->a; break; // MOV L,A
-  case 0x68: c->l = c->b; break; // MOV L,B
-  case 0x69: c->l = c->c; break; // MOV L,C
-  case 0x6A: c->l = c->d; break; // MOV L,D
-  case 0x6B: c->l = c->e; break; // MOV L,E
-  case 0x6C: c->l = c->h; break; // MOV L,H
-  case 0x6D: c->l = c->l; break; // MOV L,L
-  case 0x6E: c->l = i8080_rb(c, i8080_get_hl(c)); break; // MOV L,M
-
-  case 0x77: i8080_wb(c, i8080_get_hl(c), c->a); break; // MOV M,A
-  case 0x70: i8080_wb(c, i8080_get_hl(c), c->b); break; // MOV M,B
-  case 0x71: i8080_wb(c, i8080_get_hl(c), c->c); break; // MOV M,C
-  case 0x72: i8080_wb(c, i8080_get_hl(c), c->d); break; // MOV M,D
-  case 0x73: i8080_wb(c, i8080_get_hl(c), c->e); break; // MOV M,E
-  case 0x74: i8080_wb(c, i8080_get_hl(c), c->h); break; // MOV M,H
-  case 0x75: i8080_wb(c, i8080_get_hl(c), c->l); break; // MOV M,L
-
-  case 0x3E: c->a = i8080_next_byte(c); break; // MVI A,byte
-  case 0x06: c->b = i8080_next_byte(c); break; // MVI B,byte
-  case 0x0E: c->c = i8080_next_byte(c); break; // MVI C,byte
-  case 0x16: c->d = i8080_next_byte(c); break; // MVI D,byte
-  case 0x1E: c->e = i8080_next_byte(c); break; // MVI E,byte
-  case 0x26: c->h = i8080_next_byte(c); break; // MVI H,byte
-  case 0x2E: c->l = i8080_next_byte(c); break; // MVI L,byte
-  case 0x36:
-    i8080_wb(c, i8080_get_hl(c), i8080_next_byte(c));
-    break; // MVI M,byte
-
-  case 0x02: i8080_wb(c, i8080_get_bc(c), c->a); break; // STAX B
-  case 0x12: i8080_wb(c, i8080_get_de(c), c->a); break; // STAX D
-  case 0x32: i8080_wb(c, i8080_next_word(c), c->a); break; // STA word
-
-  case 0x01: i8080_set_bc(c, i8080_next_word(c)); break; // LXI B,word
-  case 0x11: i8080_set_de(c, i8080_next_word(c)); break; // LXI D,word
-  case 0x21: i8080_set_hl(c, i8080_next_word(c)); break; // LXI H,word
-  case 0x31: c->sp = i8080_next_word(c); break; // LXI SP,word
-  case 0x2A: i8080_set_hl(c, i8080_rw(c, i8080_next_word(c))); break; // LHLD
-  case 0x22: i8080_ww(c, i8080_next_word(c), i8080_get_hl(c)); break; // SHLD
-  case 0xF9: c->sp = i8080_get_hl(c); break; // SPHL
-
-  case 0xEB: i8080_xchg(c); break; // XCHG
-  case 0xE3: i8080_xthl(c); break; // XTHL
-
-  case 0x87: i8080_add(c, &c->a, c->a, 0); break; // ADD A
-  case 0x80: i8080_add(c, &c->a, c->b, 0); break; // ADD B
-  case 0x81: i8080_add(c, &c->a, c->c, 0); break; // ADD C
-  case 0x82: i8080_add(c, &c->a, c->d, 0); break; // ADD D
-  case 0x83: i8080_add(c, &c->a, c->e, 0); break; // ADD E
-  case 0x84: i8080_add(c, &c->a, c->h, 0); break; // ADD H
-  case 0x85: i8080_add(c, &c->a, c->l, 0); break; // ADD L
-  case 0x86:
-    i8080_add(c, &c->a, i8080_rb(c, i8080_get_hl(c)), 0);
-    break; // ADD M
-  case 0xC6: i8080_add(c, &c->a, i8080_next_byte(c), 0); break; // ADI byte
-
-  case 0x8F: i8080_add(c, &c->a, c->a, c->cf); break; // ADC A
-  case 0x88: i8080_add(c, &c->a, c->b, c->cf); break; // ADC B
-  case 0x89: i8080_add(c, &c->a, c->c, c->cf); break; // ADC C
-  case 0x8A: i8080_add(c, &c->a, c->d, c->cf); break; // ADC D
-  case 0x8B: i8080_add(c, &c->a, c->e, c->cf); break; // ADC E
-  case 0x8C: i8080_add(c, &c->a, c->h, c->cf); break; // ADC H
-  case 0x8D: i8080_add(c, &c->a, c->l, c->cf); break; // ADC L
-  case 0x8E:
-    i8080_add(c, &c->a, i8080_rb(c, i8080_get_hl(c)), c->cf);
-    break; // ADC M
-  case 0xCE: i8080_add(c, &c->a, i8080_next_byte(c), c->cf); break; // ACI byte
-
-  case 0x97: i8080_sub(c, &c->a, c->a, 0); break; // SUB A
-  case 0x90: i8080_sub(c, &c->a, c->b, 0); break; // SUB B
-  case 0x91: i8080_sub(c, &c->a, c->c, 0); break; // SUB C
-  case 0x92: i8080_sub(c, &c->a, c->d, 0); break; // SUB D
-  case 0x93: i8080_sub(c, &c->a, c->e, 0); break; // SUB E
-  case 0x94: i8080_sub(c, &c->a, c->h, 0); break; // SUB H
-  case 0x95: i8080_sub(c, &c->a, c->l, 0); break; // SUB L
-  case 0x96:
-    i8080_sub(c, &c->a, i8080_rb(c, i8080_get_hl(c)), 0);
-    break; // SUB M
-  case 0xD6: i8080_sub(c, &c->a, i8080_next_byte(c), 0); break; // SUI byte
-
-  case 0x9F: i8080_sub(c, &c->a, c->a, c->cf); break; // SBB A
-  case 0x98: i8080_sub(c, &c->a, c->b, c->cf); break; // SBB B
-  case 0x99: i8080_sub(c, &c->a, c->c, c->cf); break; // SBB C
-  case 0x9A: i8080_sub(c, &c->a, c->d, c->cf); break; // SBB D
-  case 0x9B: i8080_sub(c, &c->a, c->e, c->cf); break; // SBB E
-  case 0x9C: i8080_sub(c, &c->a, c->h, c->cf); break; // SBB H
-  case 0x9D: i8080_sub(c, &c->a, c->l, c->cf); break; // SBB L
-  case 0x9E:
-    i8080_sub(c, &c->a, i8080_rb(c, i8080_get_hl(c)), c->cf);
-    break; // SBB M
-  case 0xDE: i8080_sub(c, &c->a, i8080_next_byte(c), c->cf); break; // SBI byte
-
-  case 0x09: i8080_dad(c, i8080_get_bc(c)); break; // DAD B
-  case 0x19: i8080_dad(c, i8080_get_de(c)); break; // DAD D
-  case 0x29: i8080_dad(c, i8080_get_hl(c)); break; // DAD H
-  case 0x39: i8080_dad(c, c->sp); break; // DAD SP
-
-  case 0xF3: c->iff = 0; break; // DI
-  case 0xFB:
-    c->iff = 1;
-    c->interrupt_delay = 1;
-    break; // EI
-  case 0x00: break; // NOP
-  case 0x76: c->halted = 1; break; // HLT
-
-  case 0x3C: c->a = i8080_inr(c, c->a); break; // INR A
-  case 0x04: c->b = i8080_inr(c, c->b); break; // INR B
-  case 0x0C: c->c = i8080_inr(c, c->c); break; // INR C
-  case 0x14: c->d = i8080_inr(c, c->d); break; // INR D
-  case 0x1C: c->e = i8080_inr(c, c->e); break; // INR E
-  case 0x24: c->h = i8080_inr(c, c->h); break; // INR H
-  case 0x2C: c->l = i8080_inr(c, c->l); break; // INR L
-  case 0x34:
-    i8080_wb(c, i8080_get_hl(c), i8080_inr(c, i8080_rb(c, i8080_get_hl(c))));
-    break; // INR M
-
-  case 0x3D: c->a = i8080_dcr(c, c->a); break; // DCR A
-  case 0x05: c->b = i8080_dcr(c, c->b); break; // DCR B
-  case 0x0D: c->c = i8080_dcr(c, c->c); break; // DCR C
-  case 0x15: c->d = i8080_dcr(c, c->d); break; // DCR D
-  case 0x1D: c->e = i8080_dcr(c, c->e); break; // DCR E
-  case 0x25: c->h = i8080_dcr(c, c->h); break; // DCR H
-  case 0x2D: c->l = i8080_dcr(c, c->l); break; // DCR L
-  case 0x35:
-    i8080_wb(c, i8080_get_hl(c), i8080_dcr(c, i8080_rb(c, i8080_get_hl(c))));
-    break; // DCR M
-
-  case 0x03: i8080_set_bc(c, i8080_get_bc(c) + 1); break; // INX B
-  case 0x13: i8080_set_de(c, i8080_get_de(c) + 1); break; // INX D
-  case 0x23: i8080_set_hl(c, i8080_get_hl(c) + 1); break; // INX H
-  case 0x33: c->sp += 1; break; // INX SP
-
-  case 0x0B: i8080_set_bc(c, i8080_get_bc(c) - 1); break; // DCX B
-  case 0x1B: i8080_set_de(c, i8080_get_de(c) - 1); break; // DCX D
-  case 0x2B: i8080_set_hl(c, i8080_get_hl(c) - 1); break; // DCX H
-  case 0x3B: c->sp -= 1; break; // DCX SP
-
-  case 0x27: i8080_daa(c); break; // DAA
-  case 0x2F: c->a = ~c->a; break; // CMA
-  case 0x37: c->cf = 1; break; // STC
-  case 0x3F: c->cf = !c->cf; break; // CMC
-
-  case 0x07: i8080_rlc(c); break; // RLC (rotate left)
-  case 0x0F: i8080_rrc(c); break; // RRC (rotate right)
-  case 0x17: i8080_ral(c); break; // RAL
-  case 0x1F: i8080_rar(c); break; // RAR
-
-  case 0xA7: i8080_ana(c, c->a); break; // ANA A
-  case 0xA0: i8080_ana(c, c->b); break; // ANA B
-  case 0xA1: i8080_ana(c, c->c); break; // ANA C
-  case 0xA2: i8080_ana(c, c->d); break; // ANA D
-  case 0xA3: i8080_ana(c, c->e); break; // ANA E
-  case 0xA4: i8080_ana(c, c->h); break; // ANA H
-  case 0xA5: i8080_ana(c, c->l); break; // ANA L
-  case 0xA6: i8080_ana(c, i8080_rb(c, i8080_get_hl(c))); break; // ANA M
-  case 0xE6: i8080_ana(c, i8080_next_byte(c)); break; // ANI byte
-
-  case 0xAF: i8080_xra(c, c->a); break; // XRA A
-  case 0xA8: i8080_xra(c, c->b); break; // XRA B
-  case 0xA9: i8080_xra(c, c->c); break; // XRA C
-  case 0xAA: i8080_xra(c, c->d); break; // XRA D
-  case 0xAB: i8080_xra(c, c->e); break; // XRA E
-  case 0xAC: i8080_xra(c, c->h); break; // XRA H
-  case 0xAD: i8080_xra(c, c->l); break; // XRA L
-  case 0xAE: i8080_xra(c, i8080_rb(c, i8080_get_hl(c))); break; // XRA M
-  case 0xEE: i8080_xra(c, i8080_next_byte(c)); break; // XRI byte
-
-  case 0xB7: i8080_ora(c, c->a); break; // ORA A
-  case 0xB0: i8080_ora(c, c->b); break; // ORA B
-  case 0xB1: i8080_ora(c, c->c); break; // ORA C
-  case 0xB2: i8080_ora(c, c->d); break; // ORA D
-  case 0xB3: i8080_ora(c, c->e); break; // ORA E
-  case 0xB4: i8080_ora(c, c->h); break; // ORA H
-  case 0xB5: i8080_ora(c, c->l); break; // ORA L
-  case 0xB6: i8080_ora(c, i8080_rb(c, i8080_get_hl(c))); break; // ORA M
-  case 0xF6: i8080_ora(c, i8080_next_byte(c)); break; // ORI byte
-
-  case 0xBF: i8080_cmp(c, c->a); break; // CMP A
-  case 0xB8: i8080_cmp(c, c->b); break; // CMP B
-  case 0xB9: i8080_cmp(c, c->c); break; // CMP C
-  case 0xBA: i8080_cmp(c, c->d); break; // CMP D
-  case 0xBB: i8080_cmp(c, c->e); break; // CMP E
-  case 0xBC: i8080_cmp(c, c->h); break; // CMP H
-  case 0xBD: i8080_cmp(c, c->l); break; // CMP L
-  case 0xBE: i8080_cmp(c, i8080_rb(c, i8080_get_hl(c))); break; // CMP M
-  case 0xFE: i8080_cmp(c, i8080_next_byte(c)); break; // CPI byte
-
-  case 0xC3: i8080_jmp(c, i8080_next_word(c)); break; // JMP
-  case 0xC2: i8080_cond_jmp(c, c->zf == 0); break; // JNZ
-  case 0xCA: i8080_cond_jmp(c, c->zf == 1); break; // JZ
-  case 0xD2: i8080_cond_jmp(c, c->cf == 0); break; // JNC
-  case 0xDA: i8080_cond_jmp(c, c->cf == 1); break; // JC
-  case 0xE2: i8080_cond_jmp(c, c->pf == 0); break; // JPO
-  case 0xEA: i8080_cond_jmp(c, c->pf == 1); break; // JPE
-  case 0xF2: i8080_cond_jmp(c, c->sf == 0); break; // JP
-  case 0xFA: i8080_cond_jmp(c, c->sf == 1); break; // JM
-
-  case 0xE9: c->pc = i8080_get_hl(c); break; // PCHL
-  case 0xCD: i8080_call(c, i8080_next_word(c)); break; // CALL
-
-  case 0xC4: i8080_cond_call(c, c->zf == 0); break; // CNZ
-  case 0xCC: i8080_cond_call(c, c->zf == 1); break; // CZ
-  case 0xD4: i8080_cond_call(c, c->cf == 0); break; // CNC
-  case 0xDC: i8080_cond_call(c, c->cf == 1); break; // CC
-  case 0xE4: i8080_cond_call(c, c->pf == 0); break; // CPO
-  case 0xEC: i8080_cond_call(c, c->pf == 1); break; // CPE
-  case 0xF4: i8080_cond_call(c, c->sf == 0); break; // CP
-  case 0xFC: i8080_cond_call(c, c->sf == 1); break; // CM
-
-  case 0xC9: i8080_ret(c); break; // RET
-  case 0xC0: i8080_cond_ret(c, c->zf == 0); break; // RNZ
-  case 0xC8: i8080_cond_ret(c, c->zf == 1); break; // RZ
-  case 0xD0: i8080_cond_ret(c, c->cf == 0); break; // RNC
-  case 0xD8: i8080_cond_ret(c, c->cf == 1); break; // RC
-  case 0xE0: i8080_cond_ret(c, c->pf == 0); break; // RPO
-  case 0xE8: i8080_cond_ret(c, c->pf == 1); break; // RPE
-  case 0xF0: i8080_cond_ret(c, c->sf == 0); break; // RP
-  case 0xF8: i8080_cond_ret(c, c->sf == 1); break; // RM
-
-  case 0xC7: i8080_call(c, 0x00); break; // RST 0
-  case 0xCF: i8080_call(c, 0x08); break; // RST 1
-  case 0xD7: i8080_call(c, 0x10); break; // RST 2
-  case 0xDF: i8080_call(c, 0x18); break; // RST 3
-  case 0xE7: i8080_call(c, 0x20); break; // RST 4
-  case 0xEF: i8080_call(c, 0x28); break; // RST 5
-  case 0xF7: i8080_call(c, 0x30); break; // RST 6
-  case 0xFF: i8080_call(c, 0x38); break; // RST 7
-
-  case 0xC5: i8080_push_stack(c, i8080_get_bc(c)); break; // PUSH B
-  case 0xD5: i8080_push_stack(c, i8080_get_de(c)); break; // PUSH D
-  case 0xE5: i8080_push_stack(c, i8080_get_hl(c)); break; // PUSH H
-  case 0xF5: i8080_push_psw(c); break; // PUSH PSW
-  case 0xC1: i8080_set_bc(c, i8080_pop_stack(c)); break; // POP B
-  case 0xD1: i8080_set_de(c, i8080_pop_stack(c)); break; // POP D
-  case 0xE1: i8080_set_hl(c, i8080_pop_stack(c)); break; // POP H
-  case 0xF1: i8080_pop_psw(c); break; // POP PSW
-
-  case 0xDB: c->a = c->port_in(c->userdata, i8080_next_byte(c)); break; // IN
-  case 0xD3: c->port_out(c->userdata, i8080_next_byte(c), c->a); break; // OUT
-
-  case 0x08:
-  case 0x10:
-  case 0x18:
-  case 0x20:
-  case 0x28:
-  case 0x30:
-  case 0x38: break; // undocumented NOPs
-
-  case 0xD9: i8080_ret(c); break; // undocumented RET
-
-  case 0xDD:
-  case 0xED:
-  case 0xFD: i8080_call(c, i8080_next_word(c)); break; // undocumented CALLs
-
-  case 0xCB: i8080_jmp(c, i8080_next_word(c)); break; // undocumented JMP
+  case 0x76: // HLT
+  case 0xD3: // OUT
+  case 0xDB: // IN
+  case 0xE9: // PCHL
+  case 0xF3: // DI
+  case 0xFB: // EI
+  case 0xC3: case 0xCB: // JMP
+  case 0xC9: case 0xD9: // RET
+  case 0xCD: case 0xDD: case 0xED: case 0xFD: return true; // CALL
   }
+
+  // conditional returns, jumps and calls, RSTs
+  const uint8_t op = opcode & 7;
+  return opcode >= 0xC0 && (op == 0 || op == 2 || op == 4 || op == 7);
 }
 
+// kinds of loops recognised in blocks (see i8080_loop_kind)
+#define LOOP_NONE 0
+#define LOOP_POLL 1 // only reads registers and memory
+#define LOOP_DCR 2 // DCR r; JNZ
+#define LOOP_DCX 3 // DCX rp; MOV A,hi; ORA lo; JNZ (or MOV A,lo; ORA hi)
+
+// register pairs BC, DE and HL as bits, from the index of a register in
+// opcodes (B, C, D, E, H, L, M, A) or of a pair (BC, DE, HL, SP)
+#define REG_PAIR(r) ((r) < 6 ? 1 << ((r) / 2) : 0)
+#define PAIR(rp) ((rp) < 3 ? 1 << (rp) : 0)
+
+// returns the kind of loop of a block whose last instruction jumps back to
+// its start: a delay loop counting a register down, or a polling loop which
+// only reads registers and memory (through register pairs it doesn't
+// modify), and writes registers. LOOP_NONE for other blocks.
+static int i8080_loop_kind(const i8080_block* const block) {
+  const i8080_insn* const last = &block->insns[block->nb_insns - 1];
+  const bool jmp = last->opcode == 0xC3 || last->opcode == 0xCB;
+  if ((!jmp && (last->opcode & 0xC7) != 0xC2) || last->operand != block->pc) {
+    return LOOP_NONE;
+  }
+
+  const uint8_t first = block->insns[0].opcode;
+  if (block->nb_insns == 2 && last->opcode == 0xC2 &&
+      (first & 0xC7) == 0x05 && first != 0x35) {
+    return LOOP_DCR;
+  }
+  if (block->nb_insns == 4 && last->opcode == 0xC2 &&
+      (first & 0xCF) == 0x0B && first != 0x3B) {
+    const int hi = (first >> 4) * 2;
+    const uint8_t mov = block->insns[1].opcode;
+    const uint8_t ora = block->insns[2].opcode;
+    if ((mov == 0x78 + hi && ora == 0xB0 + hi + 1) ||
+        (mov == 0x78 + hi + 1 && ora == 0xB0 + hi)) {
+      return LOOP_DCX;
+    }
+  }
+
+  unsigned reads = 0; // pairs used as addresses
+  unsigned writes = 0; // pairs modified
+  for (int i = 0; i < block->nb_insns - 1; i++) {
+    const uint8_t opcode = block->insns[i].opcode;
+    const int dst = (opcode >> 3) & 7;
+    const int src = opcode & 7;
+    const int rp = (opcode >> 4) & 3;
+
+    if (opcode >= 0x40 && opcode < 0xC0) {
+      // MOV, ALU (not MOV M,r nor HLT)
+      if (opcode < 0x80 && dst == 6) {
+        return LOOP_NONE;
+      }
+      reads |= src == 6 ? PAIR(2) : 0;
+      writes |= opcode < 0x80 ? REG_PAIR(dst) : 0;
+    } else if (opcode >= 0xC0) {
+      // ALU immediate, XCHG, SPHL
+      if (opcode == 0xEB) {
+        writes |= PAIR(1) | PAIR(2);
+      } else if (src != 6 && opcode != 0xF9) {
+        return LOOP_NONE;
+      }
+    } else if (src == 0 || src == 7) {
+      // NOP, rotations, DAA, CMA, STC, CMC
+    } else if (src == 1 || src == 3) {
+      // LXI, DAD, INX, DCX
+      writes |= (opcode & 0x0F) == 0x09 ? PAIR(2) : PAIR(rp);
+    } else if (src == 4 || src == 5 || src == 6) {
+      // INR, DCR, MVI (not on M)
+      if (dst == 6) {
+        return LOOP_NONE;
+      }
+      writes |= REG_PAIR(dst);
+    } else if (opcode == 0x0A || opcode == 0x1A) {
+      reads |= PAIR(rp); // LDAX
+    } else if (opcode == 0x2A) {
+      writes |= PAIR(2); // LHLD
+    } else if (opcode != 0x3A) {
+      return LOOP_NONE; // STAX, SHLD, STA
+    }
+  }
+  return (reads & writes) == 0 ? LOOP_POLL : LOOP_NONE;
+}
+
+#undef REG_PAIR
+#undef PAIR
+
+// returns a register from its index in opcodes (not M)
+static inline uint8_t* i8080_reg(i8080* const c, int index) {
+  uint8_t* const regs[8] = {
+      &c->b, &c->c, &c->d, &c->e, &c->h, &c->l, NULL, &c->a};
+  return regs[index];
+}
+
+// consecutive iterations of a polling loop changing the registers before it
+// is no longer taken for one
+#define LOOP_MISSES 4
+
+// most cycles a polling loop is skipped by at once: a budget of ULONG_MAX
+// cycles is skipped a slice at a time, each followed by a check of the
+// events (and of the budget), instead of making the cycle count wrap
+#define LOOP_POLL_SLICE (1UL << 24)
+
+// registers at the start of the last iteration of a polling loop (see
+// i8080_skip_loop)
+typedef struct i8080_loop_state {
+  const i8080_block* block; // NULL if none
+  unsigned long cyc;
+  uint8_t regs[8];
+  uint16_t sp;
+  int misses; // consecutive iterations which changed the registers
+} i8080_loop_state;
+
+static inline void i8080_loop_regs(i8080* const c, uint8_t* regs) {
+  i8080_sync_flags(c);
+  const uint8_t r[8] = {c->a, c->b, c->c, c->d, c->e, c->h, c->l, c->f};
+  memcpy(regs, r, 8);
+}
+
+// returns if the memory read by an iteration of a polling loop is mapped
+// directly (neither callbacks nor watchpoints), and counts the reads
+static bool i8080_loop_reads(
+    i8080* const c, const i8080_block* const block, unsigned* nb_reads) {
+  *nb_reads = 0;
+  for (int i = 0; i < block->nb_insns - 1; i++) {
+    const i8080_insn* const insn = &block->insns[i];
+    const uint8_t opcode = insn->opcode;
+    uint16_t addr;
+    if (opcode == 0x0A) {
+      addr = i8080_get_bc(c);
+    } else if (opcode == 0x1A) {
+      addr = i8080_get_de(c);
+    } else if (opcode == 0x2A || opcode == 0x3A) {
+      addr = insn->operand;
+      if (opcode == 0x2A && c->data_pages[(uint16_t) (addr + 1) >> 8] == NULL) {
+        return false;
+      }
+      *nb_reads += opcode == 0x2A;
+    } else if (opcode >= 0x40 && opcode < 0xC0 && (opcode & 7) == 6) {
+      addr = i8080_get_hl(c);
+    } else {
+      continue;
+    }
+    if (c->data_pages[addr >> 8] == NULL) {
+      return false;
+    }
+    *nb_reads += 1;
+  }
+  return true;
+}
+
+// fast-forwards a loop block at its start, without executing the iterations
+// which would start before the cycle `deadline` but the last one, which is
+// left to execute. Delay loops are skipped up to their last iteration.
+// Polling loops are skipped once an iteration left the registers as they
+// were (kept in `state`): the memory they read can't change until an
+// interrupt, which only a callback (or the host, after the deadline) can
+// request, or another thread (seen after each slice of LOOP_POLL_SLICE
+// cycles). Returns the number of instructions skipped.
+static unsigned long i8080_skip_loop(i8080* const c, i8080_block* const block,
+    i8080_loop_state* const state, unsigned long deadline) {
+  const unsigned long max = (deadline - c->cyc - 1) / block->cycles;
+  unsigned long iterations = 0;
+  unsigned nb_reads = 0;
+
+  if (block->loop == LOOP_DCR) {
+    uint8_t* const r = i8080_reg(c, (block->insns[0].opcode >> 3) & 7);
+    iterations = (*r != 0 ? *r : 0x100) - 1;
+    iterations = iterations < max ? iterations : max;
+    if (iterations > 0) {
+      // the flags are the ones of the last DCR skipped
+      *r = i8080_dcr(c, *r - iterations + 1);
+    }
+  } else if (block->loop == LOOP_DCX) {
+    const int rp = block->insns[0].opcode >> 4;
+    uint16_t val = rp == 0 ? i8080_get_bc(c)
+                 : rp == 1 ? i8080_get_de(c)
+                           : i8080_get_hl(c);
+    iterations = (val != 0 ? val : 0x10000) - 1;
+    iterations = iterations < max ? iterations : max;
+    if (iterations > 0) {
+      val -= iterations;
+      if (rp == 0) {
+        i8080_set_bc(c, val);
+      } else if (rp == 1) {
+        i8080_set_de(c, val);
+      } else {
+        i8080_set_hl(c, val);
+      }
+      // MOV A,r; ORA r
+      c->a = *i8080_reg(c, block->insns[1].opcode & 7);
+      i8080_ora(c, *i8080_reg(c, block->insns[2].opcode & 7));
+    }
+  } else {
+    uint8_t regs[8];
+    i8080_loop_regs(c, regs);
+    if (state->block != block || state->cyc + block->cycles != c->cyc) {
+      state->misses = 0;
+    } else if (state->sp == c->sp && memcmp(state->regs, regs, 8) == 0 &&
+               i8080_loop_reads(c, block, &nb_reads)) {
+      const unsigned long slice = LOOP_POLL_SLICE / block->cycles;
+      iterations = max < slice ? max : slice;
+    } else if (++state->misses == LOOP_MISSES) {
+      // counts something: executed (or compiled) as any other block
+      block->loop = LOOP_NONE;
+      state->block = NULL;
+      return 0;
+    }
+    state->block = block;
+    state->cyc = c->cyc + iterations * block->cycles;
+    memcpy(state->regs, regs, 8);
+    state->sp = c->sp;
+  }
+
+  if (iterations == 0) {
+    return 0;
+  }
+
+  c->cyc += iterations * block->cycles;
+  c->cache->stats.loops_skipped += 1;
+  c->cache->stats.iterations_skipped += iterations;
+  c->cache->stats.cycles_skipped += iterations * block->cycles;
+  PROFILE_BLOCK(c, block, iterations);
+#ifdef I8080_COUNTERS
+  for (int i = 0; i < block->nb_insns; i++) {
+    COUNT(c, opcodes[block->insns[i].opcode], iterations);
+  }
+  if (block->insns[block->nb_insns - 1].opcode != 0xC3 &&
+      block->insns[block->nb_insns - 1].opcode != 0xCB) {
+    COUNT(c, jumps[1], iterations);
+  }
+  COUNT(c, reads, iterations * nb_reads);
+#endif
+  return iterations * block->nb_insns;
+}
+
+// returns the block starting at pc, decoding it if it is not in the cache,
+// or NULL if the code can't be cached (not in mapped memory)
+static i8080_block* i8080_cache_lookup(
+    i8080* const c, const void* const* handlers) {
+  i8080_block_cache* const cache = c->cache;
+  const uint8_t page = c->pc >> 8;
+  i8080_block* const block = &cache->blocks[c->pc % CACHE_SIZE];
+
+  if (block->nb_insns != 0 && block->pc == c->pc &&
+      block->gen == cache->page_gens[page]) {
+    cache->stats.hits += 1;
+    return block;
+  }
+
+  const uint8_t* const mem = c->read_pages[page];
+  if (mem == NULL) {
+    return NULL;
+  }
+
+  // blocks never start at an execution breakpoint, it is checked by
+  // i8080_run_with instead
+  if (c->breakpoints != NULL &&
+      i8080_breakpoint(c, I8080_BREAK_EXEC, c->pc)) {
+    EVENTS_SET(c, EVENT_BREAK);
+    return NULL;
+  }
+
+  cache->stats.misses += 1;
+  PROFILE_FLUSH(c, block);
+
+  unsigned offset = c->pc & 0xFF;
+  int nb_insns = 0;
+  unsigned cycles = 0;
+
+  while (nb_insns < BLOCK_SIZE && offset < I8080_PAGE_SIZE) {
+    // nor contain one after their first instruction
+    if (c->breakpoints != NULL &&
+        i8080_breakpoint(c, I8080_BREAK_EXEC, (page << 8) + offset)) {
+      break;
+    }
+
+    const uint8_t opcode = mem[offset];
+    const unsigned length = OPCODES_LENGTH[opcode];
+    if (offset + length > I8080_PAGE_SIZE) {
+      break;
+    }
+
+    i8080_insn* const insn = &block->insns[nb_insns];
+    insn->opcode = opcode;
+#ifdef THREADED_DISPATCH
+    insn->handler = handlers[opcode];
+#else
+    (void) handlers;
+#endif
+    insn->operand = 0;
+    if (length > 1) {
+      insn->operand = mem[offset + 1];
+    }
+    if (length > 2) {
+      insn->operand |= mem[offset + 2] << 8;
+    }
+
+    for (unsigned i = 0; i < length; i++) {
+      const uint16_t addr = (page << 8) + offset + i;
+      cache->code[addr / 8] |= 1 << (addr % 8);
+    }
+
+    offset += length;
+    insn->next_pc = (page << 8) + offset;
+    cycles += OPCODES_CYCLES[opcode];
+    nb_insns += 1;
+
+    if (i8080_ends_block(opcode)) {
+      break;
+    }
+  }
+
+  // first instruction across two pages
+  if (nb_insns == 0) {
+    return NULL;
+  }
+
+  unsigned cycles_left = 0;
+  for (int i = nb_insns - 1; i >= 0; i--) {
+    block->insns[i].cycles_left = cycles_left;
+    cycles_left += OPCODES_CYCLES[block->insns[i].opcode];
+  }
+
+  block->gen = cache->page_gens[page];
+  block->pc = c->pc;
+  block->cycles = cycles;
+  block->nb_insns = nb_insns;
+  block->size = offset - (c->pc & 0xFF);
+  block->loop = i8080_loop_kind(block);
+#ifdef JIT_SUPPORTED
+  block->hits = 0;
+  block->native = NULL;
+#endif
+
+  if (!(c->page_flags[page] & PAGE_CODE)) {
+    c->page_flags[page] |= PAGE_CODE;
+    i8080_update_page(c, page);
+  }
+
+  return block;
+}
+
+#ifdef JIT_SUPPORTED
+#include "i8080_jit.h"
+#endif
+
+// the interpreter core is written once in i8080_opcodes.h and expanded in two
+// execution loops: i8080_execute, which fetches instructions from memory, and
+// i8080_execute_blocks, which runs predecoded blocks from the block cache.
+// Each loop is either a portable switch, or threaded code (see above).
+#ifdef THREADED_DISPATCH
+#define OPCODE(op) op_##op:
+#define LABEL(hi, lo) &&op_0x##hi##lo
+#define LABELS(hi) \
+  LABEL(hi, 0), LABEL(hi, 1), LABEL(hi, 2), LABEL(hi, 3), LABEL(hi, 4), \
+  LABEL(hi, 5), LABEL(hi, 6), LABEL(hi, 7), LABEL(hi, 8), LABEL(hi, 9), \
+  LABEL(hi, A), LABEL(hi, B), LABEL(hi, C), LABEL(hi, D), LABEL(hi, E), \
+  LABEL(hi, F)
+#define DISPATCH_TABLE_INIT \
+  {LABELS(0), LABELS(1), LABELS(2), LABELS(3), LABELS(4), LABELS(5), \
+      LABELS(6), LABELS(7), LABELS(8), LABELS(9), LABELS(A), LABELS(B), \
+      LABELS(C), LABELS(D), LABELS(E), LABELS(F)}
+// labels as values are an extension to ISO C
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+#else
+#define OPCODE(op) case op:
+#endif
+
+#ifdef THREADED_DISPATCH
+#define NEXT \
+  do { \
+    if (EVENTS(c) != 0 || c->cyc - start >= cycles) { \
+      return nb_instructions; \
+    } \
+    opcode = i8080_next_byte(c); \
+    c->cyc += OPCODES_CYCLES[opcode]; \
+    COUNT(c, opcodes[opcode], 1); \
+    PROFILE(c, c->pc - 1, OPCODES_CYCLES[opcode]); \
+    nb_instructions += 1; \
+    goto *DISPATCH_TABLE[opcode]; \
+  } while (0)
+#else
+#define NEXT break
+#endif
+#define IMM8 i8080_next_byte(c)
+#define IMM16 i8080_next_word(c)
+
+// executes `opcode`, then the next instructions in memory until at least
+// `cycles` cycles have been spent or an event is raised (see i8080_run).
+// Returns the number of instructions executed.
+static unsigned long i8080_execute(
+    i8080* const c, uint8_t opcode, unsigned long cycles) {
+  const unsigned long start = c->cyc;
+  unsigned long nb_instructions = 1;
+
+  c->cyc += OPCODES_CYCLES[opcode];
+  COUNT(c, opcodes[opcode], 1);
+  PROFILE_FIRST(c, opcode);
+
+#ifdef THREADED_DISPATCH
+  static const void* const DISPATCH_TABLE[256] = DISPATCH_TABLE_INIT;
+
+  goto *DISPATCH_TABLE[opcode];
+#else
+dispatch:
+  switch (opcode) {
+#endif
+#include "i8080_opcodes.h"
+#ifndef THREADED_DISPATCH
+  }
+
+  if (EVENTS(c) != 0 || c->cyc - start >= cycles) {
+    return nb_instructions;
+  }
+  opcode = i8080_next_byte(c);
+  c->cyc += OPCODES_CYCLES[opcode];
+  COUNT(c, opcodes[opcode], 1);
+  PROFILE(c, c->pc - 1, OPCODES_CYCLES[opcode]);
+  nb_instructions += 1;
+  goto dispatch;
+#endif
+}
+
+#undef NEXT
+#undef IMM8
+#undef IMM16
+
+#ifdef THREADED_DISPATCH
+#define NEXT \
+  do { \
+    insn += 1; \
+    if (insn == end) { \
+      goto next_block; \
+    } \
+    if (EVENTS(c) != 0) { \
+      goto interrupted; \
+    } \
+    c->pc = insn->next_pc; \
+    COUNT(c, opcodes[insn->opcode], 1); \
+    goto *insn->handler; \
+  } while (0)
+#else
+#define NEXT break
+#endif
+#define IMM8 ((uint8_t) insn->operand)
+#define IMM16 (insn->operand)
+
+// executes predecoded blocks from the block cache until at least `cycles`
+// cycles have been spent or an event is raised. Returns the number of
+// instructions executed.
+static unsigned long i8080_execute_blocks(
+    i8080* const c, unsigned long cycles) {
+  const unsigned long start = c->cyc;
+  unsigned long nb_instructions = 0;
+  i8080_block* block;
+  const i8080_insn* insn;
+  const i8080_insn* end;
+  i8080_loop_state loop = {NULL, 0, {0}, 0, 0};
+
+#ifdef THREADED_DISPATCH
+  static const void* const DISPATCH_TABLE[256] = DISPATCH_TABLE_INIT;
+#else
+  static const void* const* const DISPATCH_TABLE = NULL;
+#endif
+
+next_block:
+  if (EVENTS(c) != 0 || c->cyc - start >= cycles) {
+    return nb_instructions;
+  }
+
+  block = i8080_cache_lookup(c, DISPATCH_TABLE);
+  if (block == NULL) {
+    if (EVENTS(c) != 0) {
+      return nb_instructions;
+    }
+    nb_instructions += i8080_execute(c, i8080_next_byte(c), 1);
+    goto next_block;
+  }
+
+  // loops are never compiled by the jit, to be skipped here
+  if (block->loop != LOOP_NONE) {
+    nb_instructions += i8080_skip_loop(c, block, &loop, start + cycles);
+  }
+
+#ifdef JIT_SUPPORTED
+  if (c->cache->jit != NULL && block->loop == LOOP_NONE) {
+    if (block->native == NULL && block->hits < JIT_THRESHOLD &&
+        ++block->hits == JIT_THRESHOLD) {
+      i8080_jit_hot_block(c->cache, block);
+    }
+
+    if (block->native != NULL) {
+      nb_instructions += i8080_jit_run(c, block, start + cycles);
+      goto next_block;
+    }
+  }
+#endif
+
+  // the cycles of the whole block are spent upfront: `read_byte` and
+  // `write_byte` see them all (IN and OUT end blocks, so port callbacks see
+  // the same cycles as with the interpreter)
+  c->cyc += block->cycles;
+  PROFILE_BLOCK(c, block, 1);
+  nb_instructions += block->nb_insns;
+  insn = block->insns;
+  end = insn + block->nb_insns;
+
+#ifdef THREADED_DISPATCH
+  c->pc = insn->next_pc;
+  COUNT(c, opcodes[insn->opcode], 1);
+  goto *insn->handler;
+#else
+dispatch:
+  c->pc = insn->next_pc;
+  COUNT(c, opcodes[insn->opcode], 1);
+  switch (insn->opcode) {
+#endif
+#include "i8080_opcodes.h"
+#ifndef THREADED_DISPATCH
+  }
+
+  insn += 1;
+  if (insn == end) {
+    goto next_block;
+  }
+  if (EVENTS(c) != 0) {
+    goto interrupted;
+  }
+  goto dispatch;
+#endif
+
+interrupted:
+  // an event has been raised in the middle of the block: gives back the
+  // cycles of the instructions that have not been executed
+  c->cyc -= insn[-1].cycles_left;
+  nb_instructions -= end - insn;
+  PROFILE_PARTIAL(c, insn, end);
+  return nb_instructions;
+}
+
+#undef NEXT
+#undef IMM8
+#undef IMM16
+#undef OPCODE
+
+#ifdef THREADED_DISPATCH
+#pragma GCC diagnostic pop
+#undef LABEL
+#undef LABELS
+#undef DISPATCH_TABLE_INIT
+#endif
+
 // initialises the emulator with default values
 void i8080_init(i8080* const c) {
   c->read_byte = NULL;
@@ -707,6 +1539,14 @@ void i8080_init(i8080* const c) {
   c->port_out = NULL;
   c->userdata = NULL;
 
+  for (int i = 0; i < I8080_NB_PAGES; i++) {
+    c->read_pages[i] = NULL;
+    c->write_pages[i] = NULL;
+    c->data_pages[i] = NULL;
+    c->page_flags[i] = 0;
+  }
+  memset(c->dirty_pages, 0, sizeof(c->dirty_pages));
+
   c->cyc = 0;
 
   c->pc = 0;
@@ -720,63 +1560,1134 @@ void i8080_init(i8080* const c) {
   c->h = 0;
   c->l = 0;
 
-  c->sf = 0;
-  c->zf = 0;
-  c->hf = 0;
-  c->pf = 0;
-  c->cf = 0;
+  c->f = 0x02;
+#ifdef I8080_LAZY_FLAGS
+  c->lazy_flags = 0;
+  c->lazy_result = 0;
+  c->lazy_aux = 0;
+#endif
   c->iff = 0;
 
   c->halted = 0;
   c->interrupt_pending = 0;
   c->interrupt_vector = 0;
   c->interrupt_delay = 0;
+  c->interrupt_request = 0;
+
+  c->events = 0;
+  c->cache = NULL;
+  c->breakpoints = NULL;
+  c->scheduler = NULL;
+  c->ports = NULL;
+  c->shared = NULL;
+#ifdef I8080_PROFILER
+  c->profile = NULL;
+#endif
+  i8080_reset_counters(c);
 }
 
-// executes one instruction
-void i8080_step(i8080* const c) {
+// frees what the emulator owns: the pages allocated by i8080_fork (those
+// shared with other contexts are freed by the last one), the block cache,
+// the breakpoints, the scheduled events and the ports bindings. Profiling
+// is stopped, the profile being freed with i8080_profile_free. i8080_init
+// doesn't free anything: it has to be called on a new emulator, or after
+// this function.
+void i8080_destroy(i8080* const c) {
+  i8080_profile_stop(c);
+  i8080_disable_cache(c);
+  i8080_clear_breakpoints(c);
+  i8080_clear_schedule(c);
+  i8080_unbind_ports(c);
+  i8080_unmap(c, 0x0000, 0x10000);
+  free(c->shared);
+  c->shared = NULL;
+}
+
+// returns if an interrupt can be serviced before the next instruction
+static inline bool i8080_interrupt_ready(i8080* const c) {
+  return c->interrupt_pending && c->iff && c->interrupt_delay == 0;
+}
+
+// returns the opcode to execute next and updates the interrupt state
+static inline uint8_t i8080_next_opcode(i8080* const c) {
   // interrupt processing: if an interrupt is pending and IFF is set,
   // we execute the interrupt vector passed by the user.
-  if (c->interrupt_pending && c->iff && c->interrupt_delay == 0) {
+  if (i8080_interrupt_ready(c)) {
+    COUNT(c, interrupts, 1);
+    PROFILE_INTERRUPT(c);
     c->interrupt_pending = 0;
     c->iff = 0;
     c->halted = 0;
+    return c->interrupt_vector;
+  }
 
-    i8080_execute(c, c->interrupt_vector);
-  } else if (!c->halted) {
-    i8080_execute(c, i8080_next_byte(c));
+  // when EI is executed, interrupts won't be serviced
+  // until the end of next instruction:
+  if (c->interrupt_delay > 0) {
+    c->interrupt_delay -= 1;
   }
+  return i8080_next_byte(c);
+}
+
+// returns if the scheduled event `i` is due before `j`
+static inline bool i8080_event_before(
+    const i8080_scheduled* const heap, size_t i, size_t j) {
+  return heap[i].cycle < heap[j].cycle ||
+         (heap[i].cycle == heap[j].cycle && heap[i].id < heap[j].id);
 }
 
-// asks for an interrupt to be serviced
+static inline void i8080_event_swap(
+    i8080_scheduled* const heap, size_t i, size_t j) {
+  const i8080_scheduled tmp = heap[i];
+  heap[i] = heap[j];
+  heap[j] = tmp;
+}
+
+// moves the scheduled event `i` up or down the heap to its place
+static void i8080_event_sift(i8080_scheduler* const s, size_t i) {
+  while (i > 0 && i8080_event_before(s->heap, i, (i - 1) / 2)) {
+    i8080_event_swap(s->heap, i, (i - 1) / 2);
+    i = (i - 1) / 2;
+  }
+  for (;;) {
+    size_t first = i;
+    for (size_t child = 2 * i + 1; child <= 2 * i + 2; child++) {
+      if (child < s->nb_events && i8080_event_before(s->heap, child, first)) {
+        first = child;
+      }
+    }
+    if (first == i) {
+      return;
+    }
+    i8080_event_swap(s->heap, i, first);
+    i = first;
+  }
+}
+
+// removes the scheduled event `i` from the heap
+static void i8080_event_remove(i8080_scheduler* const s, size_t i) {
+  s->nb_events -= 1;
+  if (i < s->nb_events) {
+    s->heap[i] = s->heap[s->nb_events];
+    i8080_event_sift(s, i);
+  }
+}
+
+// calls the callbacks of the events due, and returns the number of cycles
+// until the next one (ULONG_MAX if none). Callbacks can schedule or cancel
+// events, events scheduled in the past fire right away.
+static unsigned long i8080_fire_events(i8080* const c) {
+  i8080_scheduler* const s = c->scheduler;
+  while (s->nb_events > 0 && s->heap[0].cycle <= c->cyc) {
+    const i8080_scheduled event = s->heap[0];
+    i8080_event_remove(s, 0);
+    event.callback(event.arg, event.cycle);
+  }
+  return s->nb_events > 0 ? s->heap[0].cycle - c->cyc : ULONG_MAX;
+}
+
+// makes the interrupt requested by another thread pending, as i8080_interrupt
+static void i8080_take_request(i8080* const c) {
+  EVENTS_CLEAR(c, EVENT_REQUEST);
+  const uint16_t request = REQUEST_TAKE(c);
+  if (request != 0) {
+    c->interrupt_pending = 1;
+    c->interrupt_vector = request & 0xFF;
+    EVENTS_SET(c, EVENT_CHECK);
+  }
+}
+
+// spends `cycles` cycles halted, without executing anything
+static inline void i8080_skip_halted(i8080* const c, unsigned long cycles) {
+  COUNT(c, halted_cycles, cycles);
+  PROFILE(c, (uint16_t) (c->pc - 1), cycles);
+  c->cyc += cycles;
+}
+
+// executes one instruction. When halted, skips to the next scheduled event
+// (if any) instead, and fires the events due.
+void i8080_step(i8080* const c) {
+  if (EVENTS(c) & EVENT_REQUEST) {
+    i8080_take_request(c);
+  }
+  if (i8080_interrupt_ready(c) || !c->halted) {
+    i8080_execute(c, i8080_next_opcode(c), 1);
+  } else if (c->scheduler != NULL && c->scheduler->nb_events > 0 &&
+             c->scheduler->heap[0].cycle > c->cyc) {
+    i8080_skip_halted(c, c->scheduler->heap[0].cycle - c->cyc);
+  }
+
+  if (c->scheduler != NULL) {
+    i8080_fire_events(c);
+  }
+  i8080_sync_flags(c);
+}
+
+// returns if i8080_run has to stop on a breakpoint before the next
+// instruction: a watchpoint or port breakpoint hit by the last one, or an
+// execution breakpoint at pc (unless resuming from it). Without the block
+// cache, execution breakpoints are checked here before each instruction;
+// with it, when a block starting at one is looked up.
+static bool i8080_check_break(i8080* const c) {
+  i8080_breakpoints* const b = c->breakpoints;
+  if (b == NULL) {
+    EVENTS_CLEAR(c, EVENT_BREAK);
+    return false;
+  }
+
+  if (b->pending) {
+    b->pending = false;
+    return true;
+  }
+
+  if (b->exec && !c->halted && !i8080_interrupt_ready(c) &&
+      i8080_breakpoint(c, I8080_BREAK_EXEC, c->pc)) {
+    if (!b->resume || b->hit.addr != c->pc) {
+      b->hit.kind = I8080_BREAK_EXEC;
+      b->hit.addr = c->pc;
+      b->hit.value = i8080_fetch(c, c->pc);
+      b->resume = true;
+      return true;
+    }
+    // executes the instruction with the interpreter (EVENT_BREAK still set)
+    b->resume = false;
+    return false;
+  }
+
+  b->resume = false;
+  if (!b->exec || c->cache != NULL) {
+    EVENTS_CLEAR(c, EVENT_BREAK);
+  }
+  return false;
+}
+
+// same as i8080_run, with `execute` running the instructions while no event
+// has to be handled (NULL to always use the interpreter). `execute` runs
+// until at least `cycles` cycles have been spent or an event is raised, and
+// returns the number of instructions executed.
+static i8080_run_result i8080_run_with(i8080* const c, unsigned long cycles,
+    unsigned long (*execute)(i8080* const, unsigned long)) {
+  i8080_run_result result = {0, 0, I8080_RUN_BUDGET};
+  const unsigned long start = c->cyc;
+
+  while (c->cyc - start < cycles) {
+    unsigned long cycles_left = cycles - (c->cyc - start);
+    unsigned long next_event = ULONG_MAX;
+    if (c->scheduler != NULL) {
+      next_event = i8080_fire_events(c);
+    }
+
+    if (EVENTS(c) != 0) {
+      if (EVENTS(c) & EVENT_STOP) {
+        break;
+      }
+
+      if (EVENTS(c) & EVENT_REQUEST) {
+        i8080_take_request(c);
+      }
+
+      if ((EVENTS(c) & EVENT_BREAK) && i8080_check_break(c)) {
+        result.reason = I8080_RUN_BREAKPOINT;
+        break;
+      }
+
+      if (!i8080_interrupt_ready(c)) {
+        if (c->halted) {
+          if (next_event == ULONG_MAX) {
+            result.reason = I8080_RUN_HALTED;
+            break;
+          }
+          // nothing happens until the next event
+          i8080_skip_halted(
+              c, next_event < cycles_left ? next_event : cycles_left);
+          continue;
+        }
+
+        // nothing left to check once the EI delay is over
+        if (c->interrupt_delay == 0) {
+          EVENTS_CLEAR(c, EVENT_CHECK);
+        }
+      }
+    }
+
+    // returns when the next event is due
+    if (next_event < cycles_left) {
+      cycles_left = next_event;
+    }
+    if (execute != NULL && EVENTS(c) == 0) {
+      result.instructions += execute(c, cycles_left);
+    } else {
+      result.instructions +=
+          i8080_execute(c, i8080_next_opcode(c), cycles_left);
+    }
+  }
+
+  // a watchpoint hit by the last instruction of the budget
+  if (result.reason == I8080_RUN_BUDGET && c->breakpoints != NULL &&
+      c->breakpoints->pending) {
+    c->breakpoints->pending = false;
+    result.reason = I8080_RUN_BREAKPOINT;
+  }
+
+  if (EVENTS(c) & EVENT_STOP) {
+    EVENTS_CLEAR(c, EVENT_STOP);
+    result.reason = I8080_RUN_STOPPED;
+  }
+
+  i8080_sync_flags(c);
+  result.cycles = c->cyc - start;
+  return result;
+}
+
+// executes instructions until at least `cycles` cycles have been spent, HLT
+// is executed (with no event scheduled) or i8080_stop is called. Interrupts
+// are only checked after something changed the interrupt state (EI, HLT or
+// i8080_interrupt).
+i8080_run_result i8080_run(i8080* const c, unsigned long cycles) {
+  return i8080_run_with(
+      c, cycles, c->cache != NULL ? i8080_execute_blocks : NULL);
+}
+
+// makes i8080_run return before the next instruction (can be called from
+// the memory or io callbacks, or from another thread)
+void i8080_stop(i8080* const c) {
+  EVENTS_SET(c, EVENT_STOP);
+}
+
+// asks for an interrupt to be serviced (from the thread running the
+// emulator, e.g. in a callback)
 void i8080_interrupt(i8080* const c, uint8_t opcode) {
   c->interrupt_pending = 1;
   c->interrupt_vector = opcode;
+  EVENTS_SET(c, EVENT_CHECK);
+}
+
+// same as i8080_interrupt, but can be called from any thread while the
+// emulator runs: the request is taken by i8080_run or i8080_step before the
+// next instruction (or block, with the block cache), without locks. As with
+// i8080_interrupt, a request replaces the previous one if it hasn't been
+// taken yet.
+void i8080_request_interrupt(i8080* const c, uint8_t opcode) {
+  REQUEST_SET(c, 0x100 | opcode);
+  EVENTS_SET(c, EVENT_REQUEST);
+}
+
+// schedules a call to `callback(arg, cycle)` when the cycle count reaches
+// `cycle`, e.g. for timers or video interrupts: i8080_run and i8080_step
+// call it at the end of the instruction (or block, with the block cache)
+// during which it is reached, and skip the cycles spent halted up to it.
+// Events due at the same cycle fire in the order they were scheduled, and
+// an event can schedule the next one from `cycle` without drifting. Returns
+// an id for i8080_cancel, or 0 if out of memory.
+unsigned long i8080_schedule(i8080* const c, unsigned long cycle,
+    void (*callback)(void*, unsigned long), void* arg) {
+  if (c->scheduler == NULL) {
+    c->scheduler = calloc(1, sizeof(i8080_scheduler));
+    if (c->scheduler == NULL) {
+      return 0;
+    }
+  }
+
+  i8080_scheduler* const s = c->scheduler;
+  if (s->nb_events == s->capacity) {
+    const size_t capacity = s->capacity > 0 ? s->capacity * 2 : 16;
+    i8080_scheduled* const heap =
+        realloc(s->heap, capacity * sizeof(i8080_scheduled));
+    if (heap == NULL) {
+      return 0;
+    }
+    s->heap = heap;
+    s->capacity = capacity;
+  }
+
+  i8080_scheduled* const event = &s->heap[s->nb_events];
+  event->cycle = cycle;
+  event->id = ++s->last_id;
+  event->callback = callback;
+  event->arg = arg;
+  s->nb_events += 1;
+  i8080_event_sift(s, s->nb_events - 1);
+
+  // i8080_run has to shorten the run in progress if it's due earlier
+  EVENTS_SET(c, EVENT_CHECK);
+  return event->id;
+}
+
+// cancels an event scheduled with i8080_schedule. Returns false if it has
+// already fired or been cancelled.
+bool i8080_cancel(i8080* const c, unsigned long id) {
+  i8080_scheduler* const s = c->scheduler;
+  if (s == NULL) {
+    return false;
+  }
+  for (size_t i = 0; i < s->nb_events; i++) {
+    if (s->heap[i].id == id) {
+      i8080_event_remove(s, i);
+      return true;
+    }
+  }
+  return false;
+}
+
+// cancels all the scheduled events, and frees the scheduler
+void i8080_clear_schedule(i8080* const c) {
+  if (c->scheduler != NULL) {
+    free(c->scheduler->heap);
+    free(c->scheduler);
+    c->scheduler = NULL;
+  }
+}
+
+// returns the port bindings of an emulator, allocated on first use
+static i8080_ports* i8080_get_ports(i8080* const c) {
+  if (c->ports == NULL) {
+    c->ports = calloc(1, sizeof(i8080_ports));
+  }
+  return c->ports;
+}
+
+// binds a port to a ring, instead of the port_in callback: IN pops a byte
+// from the ring, or returns `empty` if there is none. The emulator reads the
+// ring, and a host thread writes to it (in batches with i8080_ring_write,
+// while the emulator runs). A NULL ring unbinds the port. Returns false if
+// out of memory.
+bool i8080_bind_in(
+    i8080* const c, uint8_t port, i8080_ring* const ring, uint8_t empty) {
+  i8080_ports* const ports = i8080_get_ports(c);
+  if (ports == NULL) {
+    return false;
+  }
+  const i8080_port_binding b = {ring, NULL, empty, 0, false};
+  ports->in[port] = b;
+  return true;
+}
+
+// binds a port to a ring, instead of the port_out callback: OUT pushes a
+// byte to the ring (dropped and counted in `dropped` if it is full), to be
+// read by a host thread. A NULL ring unbinds the port.
+bool i8080_bind_out(i8080* const c, uint8_t port, i8080_ring* const ring) {
+  i8080_ports* const ports = i8080_get_ports(c);
+  if (ports == NULL) {
+    return false;
+  }
+  ports->out[port] = ring;
+  return true;
+}
+
+// binds a port to the status of rings, as the status register of a serial
+// interface: IN returns `in_ready` if the ring `in` (bound with
+// i8080_bind_in) has a byte to read, ored with `out_ready` if the ring
+// `out` (bound with i8080_bind_out) has room for one. Either can be NULL.
+bool i8080_bind_status(i8080* const c, uint8_t port, i8080_ring* const in,
+    uint8_t in_ready, i8080_ring* const out, uint8_t out_ready) {
+  i8080_ports* const ports = i8080_get_ports(c);
+  if (ports == NULL) {
+    return false;
+  }
+  const i8080_port_binding b = {in, out, in_ready, out_ready, true};
+  ports->in[port] = b;
+  return true;
+}
+
+// unbinds all the ports bound to rings
+void i8080_unbind_ports(i8080* const c) {
+  free(c->ports);
+  c->ports = NULL;
+}
+
+// changes the host memory mapped to a page
+static void i8080_map_page(
+    i8080* const c, uint8_t page, const uint8_t* mem, uint8_t flags) {
+  if (c->page_flags[page] & PAGE_CODE) {
+    i8080_invalidate_page(c, page);
+  }
+  if (c->page_flags[page] & PAGE_OWNED) {
+    i8080_release_page(c->read_pages[page]);
+  }
+  if (c->shared != NULL && c->shared->pages[page] != NULL) {
+    i8080_release_page(c->shared->pages[page]);
+    c->shared->pages[page] = NULL;
+  }
+
+  c->read_pages[page] = mem;
+  c->page_flags[page] =
+      flags | (c->page_flags[page] & (PAGE_WATCH_READ | PAGE_WATCH_WRITE));
+  c->dirty_pages[page / 8] |= 1 << (page % 8);
+  i8080_update_page(c, page);
+}
+
+// returns whether a range can be mapped: whole pages, within the 64K
+static inline bool i8080_valid_range(uint16_t addr, size_t size) {
+  return addr % I8080_PAGE_SIZE == 0 && size % I8080_PAGE_SIZE == 0 &&
+         size <= (size_t) 0x10000 - addr;
+}
+
+// maps `size` bytes of host memory at address `addr`: reads and writes in
+// that range won't go through the callbacks anymore. `addr` and `size` must
+// be multiples of I8080_PAGE_SIZE, and the range can't go past 0xFFFF;
+// returns false (and maps nothing) otherwise. The mapping can be changed at
+// any time, even from a callback.
+bool i8080_map_ram(i8080* const c, uint16_t addr, size_t size, uint8_t* mem) {
+  if (!i8080_valid_range(addr, size)) {
+    return false;
+  }
+  for (size_t i = 0; i < size / I8080_PAGE_SIZE; i++) {
+    const int page = addr / I8080_PAGE_SIZE + i;
+    i8080_map_page(c, page, &mem[i * I8080_PAGE_SIZE], PAGE_RAM);
+  }
+  return true;
+}
+
+// same as i8080_map_ram for read-only memory: reads are direct, writes still
+// go through `write_byte`
+bool i8080_map_rom(
+    i8080* const c, uint16_t addr, size_t size, const uint8_t* mem) {
+  if (!i8080_valid_range(addr, size)) {
+    return false;
+  }
+  for (size_t i = 0; i < size / I8080_PAGE_SIZE; i++) {
+    const int page = addr / I8080_PAGE_SIZE + i;
+    i8080_map_page(c, page, &mem[i * I8080_PAGE_SIZE], 0);
+  }
+  return true;
+}
+
+// gives a memory range back to the `read_byte` and `write_byte` callbacks
+// (for memory-mapped io for example). Pages allocated by i8080_fork are
+// released. Same constraints as i8080_map_ram.
+bool i8080_unmap(i8080* const c, uint16_t addr, size_t size) {
+  if (!i8080_valid_range(addr, size)) {
+    return false;
+  }
+  for (size_t i = 0; i < size / I8080_PAGE_SIZE; i++) {
+    const int page = addr / I8080_PAGE_SIZE + i;
+    i8080_map_page(c, page, NULL, 0);
+  }
+  return true;
+}
+
+// makes `child` a copy of the emulator (registers, callbacks, memory map),
+// sharing its ram: a page is only copied when one of them first writes to
+// it. Ram mapped with i8080_map_ram stays in the host buffer for `c`: the
+// child gets a copy of it, shared with the other children as long as the
+// buffer isn't changed. The child shares the callbacks and `userdata`, the
+// rom mapped with i8080_map_rom and the ram (copy-on-write). It has no block
+// cache, scheduled events, ports bound to rings nor profile, and its own
+// copy of the breakpoints. Pages allocated by i8080_fork (copies kept by `c`
+// included) are freed with i8080_unmap or i8080_destroy by each context.
+// Returns false if out of memory.
+bool i8080_fork(i8080* const c, i8080* const child) {
+  if (c->shared == NULL) {
+    c->shared = calloc(1, sizeof(i8080_shared_pages));
+    if (c->shared == NULL) {
+      return false;
+    }
+  }
+  const uint8_t** const shared_pages = c->shared->pages;
+
+  i8080_breakpoints* breakpoints = NULL;
+  if (c->breakpoints != NULL) {
+    breakpoints = malloc(sizeof(i8080_breakpoints));
+    if (breakpoints == NULL) {
+      return false;
+    }
+    *breakpoints = *c->breakpoints;
+  }
+
+  // copies the host ram, unless the copy made for a previous child is still
+  // the same
+  for (int page = 0; page < I8080_NB_PAGES; page++) {
+    const uint8_t flags = c->page_flags[page];
+    const uint8_t* const shared = shared_pages[page];
+    if (!(flags & PAGE_RAM) || (flags & PAGE_OWNED) ||
+        (shared != NULL &&
+            memcmp(shared, c->read_pages[page], I8080_PAGE_SIZE) == 0)) {
+      continue;
+    }
+    const uint8_t* const mem = i8080_new_page(c->read_pages[page]);
+    if (mem == NULL) {
+      free(breakpoints);
+      return false;
+    }
+    if (shared != NULL) {
+      i8080_release_page(shared);
+    }
+    shared_pages[page] = mem;
+  }
+
+  i8080_sync_flags(c);
+  *child = *c;
+  child->cache = NULL;
+  child->breakpoints = breakpoints;
+  child->scheduler = NULL;
+  child->ports = NULL;
+  child->shared = NULL;
+#ifdef I8080_PROFILER
+  child->profile = NULL;
+#endif
+  child->events = EVENT_CHECK;
+  child->interrupt_request = 0;
+
+  for (int page = 0; page < I8080_NB_PAGES; page++) {
+    child->page_flags[page] = c->page_flags[page] & ~PAGE_CODE;
+    if (c->page_flags[page] & PAGE_OWNED) {
+      REFS_ADD(PAGE_OF(c->read_pages[page]), 1);
+      c->page_flags[page] |= PAGE_COW;
+      i8080_update_page(c, page);
+      child->page_flags[page] |= PAGE_COW;
+    } else if (c->page_flags[page] & PAGE_RAM) {
+      REFS_ADD(PAGE_OF(shared_pages[page]), 1);
+      child->read_pages[page] = shared_pages[page];
+      child->page_flags[page] |= PAGE_OWNED | PAGE_COW;
+    }
+    i8080_update_page(child, page);
+  }
+  return true;
+}
+
+// returns the number of bytes of memory allocated for the emulator alone
+// (pages of i8080_fork not shared with other contexts)
+size_t i8080_resident_memory(i8080* const c) {
+  size_t size = 0;
+  for (int page = 0; page < I8080_NB_PAGES; page++) {
+    if ((c->page_flags[page] & PAGE_OWNED) &&
+        REFS_GET(PAGE_OF(c->read_pages[page])) == 1) {
+      size += I8080_PAGE_SIZE;
+    }
+  }
+  return size;
+}
+
+// reads a byte of memory for the host (e.g. to emulate a system call), as
+// the program would but without triggering watchpoints
+uint8_t i8080_peek(i8080* const c, uint16_t addr) {
+  return i8080_fetch(c, addr);
+}
+
+// writes a byte of memory for the host: copy-on-write pages are copied,
+// cached code is invalidated and dirty pages are tracked as for the writes
+// of the program, but watchpoints aren't triggered
+void i8080_poke(i8080* const c, uint16_t addr, uint8_t val) {
+  uint8_t* page = c->write_pages[addr >> 8];
+  if (page != NULL) {
+    page[addr & 0xFF] = val;
+  } else {
+    i8080_store_slow(c, addr, val);
+  }
+}
+
+// enables the block cache: instructions in mapped memory are decoded once
+// and then executed from the cache by i8080_run. Returns false if the cache
+// can't be allocated.
+bool i8080_enable_cache(i8080* const c) {
+  if (c->cache == NULL) {
+    c->cache = calloc(1, sizeof(i8080_block_cache));
+  }
+  return c->cache != NULL;
+}
+
+// enables the block cache and the jit compiler, which translates the blocks
+// executed often to native code. Returns false if the jit isn't supported
+// (only on x86-64 linux) or can't be allocated.
+bool i8080_enable_jit(i8080* const c) {
+#ifdef JIT_SUPPORTED
+  if (!i8080_enable_cache(c)) {
+    return false;
+  }
+  if (c->cache->jit == NULL) {
+    c->cache->jit = i8080_jit_create();
+  }
+  return c->cache->jit != NULL;
+#else
+  (void) c;
+  return false;
+#endif
+}
+
+// disables the block cache (and the jit) and frees it
+void i8080_disable_cache(i8080* const c) {
+  if (c->cache == NULL) {
+    return;
+  }
+
+#ifdef I8080_PROFILER
+  i8080_profile_flush_cache(c);
+#endif
+  for (int page = 0; page < I8080_NB_PAGES; page++) {
+    c->page_flags[page] &= ~PAGE_CODE;
+    i8080_update_page(c, page);
+  }
+
+#ifdef JIT_SUPPORTED
+  if (c->cache->jit != NULL) {
+    i8080_jit_destroy(c->cache->jit);
+  }
+#endif
+  free(c->cache);
+  c->cache = NULL;
+
+  // execution breakpoints are now checked before each instruction
+  if (c->breakpoints != NULL) {
+    EVENTS_SET(c, EVENT_BREAK);
+  }
+}
+
+// drops all the cached blocks. To be called after the host modified mapped
+// memory itself (loading a program for example).
+void i8080_flush_cache(i8080* const c) {
+  if (c->cache == NULL) {
+    return;
+  }
+
+  for (int page = 0; page < I8080_NB_PAGES; page++) {
+    if (c->page_flags[page] & PAGE_CODE) {
+      i8080_invalidate_page(c, page);
+    }
+  }
+}
+
+// returns the block cache hit/miss/invalidation counters
+i8080_cache_stats i8080_get_cache_stats(i8080* const c) {
+  i8080_cache_stats stats = {0, 0, 0, 0, 0, 0, 0};
+  if (c->cache != NULL) {
+    stats = c->cache->stats;
+  }
+  return stats;
+}
+
+// returns the performance counters (all zero unless built with
+// I8080_COUNTERS)
+i8080_counters i8080_get_counters(i8080* const c) {
+  i8080_counters counters;
+#ifdef I8080_COUNTERS
+  counters = c->counters;
+  counters.instructions = 0;
+  for (int i = 0; i < 256; i++) {
+    counters.instructions += counters.opcodes[i];
+  }
+#else
+  (void) c;
+  memset(&counters, 0, sizeof(counters));
+#endif
+  return counters;
+}
+
+void i8080_reset_counters(i8080* const c) {
+#ifdef I8080_COUNTERS
+  memset(&c->counters, 0, sizeof(c->counters));
+#else
+  (void) c;
+#endif
+}
+
+// save states: "8080", the version, the flags (STATE_MEMORY if the memory
+// image follows, STATE_DELTA if the bitmap of the dirty pages and these
+// pages follow), then the registers and the interrupt state. Words are
+// little-endian.
+
+#define STATE_MEMORY 0x01
+#define STATE_DELTA 0x02
+
+static inline uint8_t* i8080_put(uint8_t* p, uint64_t val, int size) {
+  for (int i = 0; i < size; i++) {
+    *p++ = val >> (i * 8);
+  }
+  return p;
+}
+
+static inline const uint8_t* i8080_get(
+    const uint8_t* p, uint64_t* val, int size) {
+  *val = 0;
+  for (int i = 0; i < size; i++) {
+    *val |= (uint64_t) *p++ << (i * 8);
+  }
+  return p;
+}
+
+static inline bool i8080_page_dirty(const uint8_t* dirty, int page) {
+  return dirty[page / 8] & (1 << (page % 8));
+}
+
+// writes the header and the registers, returns the end of the state
+static uint8_t* i8080_save_registers(i8080* const c, uint8_t* p, int flags) {
+  i8080_sync_flags(c);
+  memcpy(p, "8080", 4);
+  p += 4;
+  p = i8080_put(p, I8080_STATE_VERSION, 1);
+  p = i8080_put(p, flags, 1);
+  p = i8080_put(p, c->pc, 2);
+  p = i8080_put(p, c->sp, 2);
+  p = i8080_put(p, c->a, 1);
+  p = i8080_put(p, c->b, 1);
+  p = i8080_put(p, c->c, 1);
+  p = i8080_put(p, c->d, 1);
+  p = i8080_put(p, c->e, 1);
+  p = i8080_put(p, c->h, 1);
+  p = i8080_put(p, c->l, 1);
+  p = i8080_put(p, c->f, 1);
+  p = i8080_put(p, c->iff | c->halted << 1 | c->interrupt_pending << 2, 1);
+  p = i8080_put(p, c->interrupt_vector, 1);
+  p = i8080_put(p, c->interrupt_delay, 1);
+  return i8080_put(p, c->cyc, 8);
+}
+
+// copies the content of a page to `p`
+static void i8080_save_page(i8080* const c, int page, uint8_t* p) {
+  const uint16_t addr = page * I8080_PAGE_SIZE;
+  if (c->read_pages[page] != NULL) {
+    memcpy(p, c->read_pages[page], I8080_PAGE_SIZE);
+  } else {
+    for (int i = 0; i < I8080_PAGE_SIZE; i++) {
+      p[i] = c->read_byte(c->userdata, addr + i);
+    }
+  }
+}
+
+// returns if loading `p` to a page changes it
+static inline bool i8080_page_changes(
+    i8080* const c, int page, const uint8_t* p) {
+  return c->read_pages[page] == NULL ||
+         memcmp(c->read_pages[page], p, I8080_PAGE_SIZE) != 0;
+}
+
+// writes `p` to a page (rom pages aren't written to). The page must not be
+// shared anymore if it changes (see i8080_load_state). The block cache keeps
+// the code of the bytes left unchanged.
+static void i8080_load_page(i8080* const c, int page, const uint8_t* p) {
+  const uint16_t addr = page * I8080_PAGE_SIZE;
+  if (!i8080_page_changes(c, page, p)) {
+    return;
+  }
+
+  // as writes, drops the cached blocks containing the bytes which change
+  if (c->page_flags[page] & PAGE_CODE) {
+    for (int i = 0; i < I8080_PAGE_SIZE; i++) {
+      const uint16_t byte = addr + i;
+      if (c->read_pages[page][i] != p[i] &&
+          (c->cache->code[byte / 8] & (1 << (byte % 8)))) {
+        i8080_invalidate_code(c, byte);
+      }
+    }
+  }
+
+  if (c->page_flags[page] & PAGE_RAM) {
+    memcpy((uint8_t*) c->read_pages[page], p, I8080_PAGE_SIZE);
+  } else if (c->read_pages[page] == NULL) {
+    for (int i = 0; i < I8080_PAGE_SIZE; i++) {
+      c->write_byte(c->userdata, addr + i, p[i]);
+    }
+  }
+
+  // the page differs from the last keyframe
+  c->dirty_pages[page / 8] |= 1 << (page % 8);
+  c->page_flags[page] &= ~PAGE_CLEAN;
+  i8080_update_page(c, page);
 }
 
+// writes the state of the emulator to `buf` (of `size` bytes), with the
+// content of the memory if `with_memory` is set. Returns the number of
+// bytes written (I8080_STATE_SIZE or I8080_STATE_MEMORY_SIZE), 0 if `buf`
+// is too small.
+size_t i8080_save_state(
+    i8080* const c, uint8_t* buf, size_t size, bool with_memory) {
+  const size_t state_size =
+      with_memory ? I8080_STATE_MEMORY_SIZE : I8080_STATE_SIZE;
+  if (size < state_size) {
+    return 0;
+  }
+
+  uint8_t* p = i8080_save_registers(c, buf, with_memory ? STATE_MEMORY : 0);
+  if (with_memory) {
+    for (int page = 0; page < I8080_NB_PAGES; page++) {
+      i8080_save_page(c, page, p);
+      p += I8080_PAGE_SIZE;
+    }
+  }
+  return state_size;
+}
+
+// returns the size of a delta state of the emulator (see i8080_save_delta)
+size_t i8080_delta_size(i8080* const c) {
+  size_t size = I8080_STATE_SIZE + sizeof(c->dirty_pages);
+  for (int page = 0; page < I8080_NB_PAGES; page++) {
+    if (i8080_page_dirty(c->dirty_pages, page)) {
+      size += I8080_PAGE_SIZE;
+    }
+  }
+  return size;
+}
+
+// same as i8080_save_state, with only the pages written since the last call
+// to i8080_clear_dirty (the keyframe): loading the keyframe then the delta
+// restores the whole machine. Returns the number of bytes written, 0 if
+// `buf` is too small.
+size_t i8080_save_delta(i8080* const c, uint8_t* buf, size_t size) {
+  const size_t state_size = i8080_delta_size(c);
+  if (size < state_size) {
+    return 0;
+  }
+
+  uint8_t* p = i8080_save_registers(c, buf, STATE_DELTA);
+  memcpy(p, c->dirty_pages, sizeof(c->dirty_pages));
+  p += sizeof(c->dirty_pages);
+  for (int page = 0; page < I8080_NB_PAGES; page++) {
+    if (i8080_page_dirty(c->dirty_pages, page)) {
+      i8080_save_page(c, page, p);
+      p += I8080_PAGE_SIZE;
+    }
+  }
+  return state_size;
+}
+
+// restores a state written by i8080_save_state or i8080_save_delta (the
+// memory map and callbacks are kept, as well as the cached code of the pages
+// left unchanged; rom pages aren't written to). Returns the number of bytes
+// read, 0 if `buf` doesn't hold a valid state.
+size_t i8080_load_state(i8080* const c, const uint8_t* buf, size_t size) {
+  if (size < I8080_STATE_SIZE || memcmp(buf, "8080", 4) != 0 ||
+      buf[4] != I8080_STATE_VERSION ||
+      (buf[5] & ~(STATE_MEMORY | STATE_DELTA)) != 0) {
+    return 0;
+  }
+
+  // size of the state, and pages it holds
+  const int flags = buf[5];
+  uint8_t pages[I8080_NB_PAGES / 8];
+  size_t state_size = I8080_STATE_SIZE;
+  memset(pages, flags & STATE_MEMORY ? 0xFF : 0, sizeof(pages));
+  if (flags & STATE_DELTA) {
+    if (size < I8080_STATE_SIZE + sizeof(pages)) {
+      return 0;
+    }
+    memcpy(pages, buf + I8080_STATE_SIZE, sizeof(pages));
+    state_size += sizeof(pages);
+  }
+  for (int page = 0; page < I8080_NB_PAGES; page++) {
+    if (i8080_page_dirty(pages, page)) {
+      state_size += I8080_PAGE_SIZE;
+    }
+  }
+  if (size < state_size) {
+    return 0;
+  }
+
+  // copies the shared pages which change first: the emulator is left as it
+  // was if one can't be copied (out of memory)
+  const uint8_t* const memory =
+      buf + I8080_STATE_SIZE + (flags & STATE_DELTA ? sizeof(pages) : 0);
+  const uint8_t* p = memory;
+  for (int page = 0; page < I8080_NB_PAGES; page++) {
+    if (i8080_page_dirty(pages, page)) {
+      if ((c->page_flags[page] & PAGE_COW) && i8080_page_changes(c, page, p) &&
+          !i8080_unshare_page(c, page)) {
+        return 0;
+      }
+      p += I8080_PAGE_SIZE;
+    }
+  }
+
+  p = buf + 6;
+  uint64_t val;
+  p = i8080_get(p, &val, 2);
+  c->pc = val;
+  p = i8080_get(p, &val, 2);
+  c->sp = val;
+  c->a = *p++;
+  c->b = *p++;
+  c->c = *p++;
+  c->d = *p++;
+  c->e = *p++;
+  c->h = *p++;
+  c->l = *p++;
+  c->f = (*p++ & 0xD5) | 0x02;
+#ifdef I8080_LAZY_FLAGS
+  c->lazy_flags = 0;
+#endif
+  c->iff = *p & 0x01;
+  c->halted = (*p & 0x02) != 0;
+  c->interrupt_pending = (*p++ & 0x04) != 0;
+  c->interrupt_vector = *p++;
+  c->interrupt_delay = *p++;
+  p = i8080_get(p, &val, 8);
+  c->cyc = val;
+
+  // the interrupt state has to be checked again by i8080_run
+  EVENTS_SET(c, EVENT_CHECK);
+
+  p = memory;
+  for (int page = 0; page < I8080_NB_PAGES; page++) {
+    if (i8080_page_dirty(pages, page)) {
+      i8080_load_page(c, page, p);
+      p += I8080_PAGE_SIZE;
+    }
+  }
+
+  return state_size;
+}
+
+// clears the bitmap of the pages written to (i8080.dirty_pages) and starts
+// tracking the writes, with no cost for the pages not written since
+void i8080_clear_dirty(i8080* const c) {
+  memset(c->dirty_pages, 0, sizeof(c->dirty_pages));
+  for (int page = 0; page < I8080_NB_PAGES; page++) {
+    c->page_flags[page] |= PAGE_CLEAN;
+    i8080_update_page(c, page);
+  }
+}
+
+// sets (or clears) the breakpoints of a kind on a range of addresses or
+// ports, and updates what depends on them
+static void i8080_update_breakpoints(
+    i8080* const c, int kind, uint16_t addr, size_t size, bool set) {
+  i8080_breakpoints* const b = c->breakpoints;
+  const size_t end = kind >= I8080_BREAK_IN ? 0x100 : 0x10000;
+  for (size_t i = addr; i < addr + size && i < end; i++) {
+    if (set) {
+      b->bits[kind][i / 8] |= 1 << (i % 8);
+    } else {
+      b->bits[kind][i / 8] &= ~(1 << (i % 8));
+    }
+
+    // blocks containing a new execution breakpoint are decoded again, to end
+    // before it
+    if (set && kind == I8080_BREAK_EXEC && c->cache != NULL &&
+        (c->cache->code[i / 8] & (1 << (i % 8)))) {
+      i8080_invalidate_code(c, i);
+    }
+  }
+
+  // watched pages aren't accessed directly
+  if (kind == I8080_BREAK_READ || kind == I8080_BREAK_WRITE) {
+    const uint8_t flag =
+        kind == I8080_BREAK_READ ? PAGE_WATCH_READ : PAGE_WATCH_WRITE;
+    for (size_t page = addr / I8080_PAGE_SIZE;
+         page <= (addr + size - 1) / I8080_PAGE_SIZE && page < I8080_NB_PAGES;
+         page++) {
+      c->page_flags[page] &= ~flag;
+      for (int i = 0; i < I8080_PAGE_SIZE / 8; i++) {
+        if (b->bits[kind][page * I8080_PAGE_SIZE / 8 + i] != 0) {
+          c->page_flags[page] |= flag;
+          break;
+        }
+      }
+      i8080_update_page(c, page);
+    }
+  }
+
+  if (kind == I8080_BREAK_EXEC) {
+    b->exec = false;
+    for (size_t i = 0; i < sizeof(b->bits[kind]) && !b->exec; i++) {
+      b->exec = b->bits[kind][i] != 0;
+    }
+    EVENTS_SET(c, EVENT_BREAK);
+  }
+}
+
+// sets breakpoints on `size` addresses (or ports) from `addr`: i8080_run
+// returns I8080_RUN_BREAKPOINT before executing an instruction at one of them
+// (I8080_BREAK_EXEC), or after the instruction which read or wrote one of
+// them in memory (I8080_BREAK_READ/WRITE) or in the io space
+// (I8080_BREAK_IN/OUT). Breakpoints are checked through bitmaps, and cost
+// nothing until set: watched pages and the ports are checked when accessed,
+// and execution breakpoints before each instruction without the block cache,
+// but only at the start of blocks with it. Returns false if out of memory.
+bool i8080_set_breakpoint(
+    i8080* const c, int kind, uint16_t addr, size_t size) {
+  if (c->breakpoints == NULL) {
+    c->breakpoints = calloc(1, sizeof(i8080_breakpoints));
+    if (c->breakpoints == NULL) {
+      return false;
+    }
+  }
+  if (size > 0) {
+    i8080_update_breakpoints(c, kind, addr, size, true);
+  }
+  return true;
+}
+
+// clears the breakpoints on `size` addresses (or ports) from `addr`
+void i8080_clear_breakpoint(
+    i8080* const c, int kind, uint16_t addr, size_t size) {
+  if (c->breakpoints != NULL && size > 0) {
+    i8080_update_breakpoints(c, kind, addr, size, false);
+  }
+}
+
+// clears all the breakpoints and frees their bitmaps
+void i8080_clear_breakpoints(i8080* const c) {
+  if (c->breakpoints == NULL) {
+    return;
+  }
+  for (int page = 0; page < I8080_NB_PAGES; page++) {
+    c->page_flags[page] &= ~(PAGE_WATCH_READ | PAGE_WATCH_WRITE);
+    i8080_update_page(c, page);
+  }
+  free(c->breakpoints);
+  c->breakpoints = NULL;
+}
+
+// returns the breakpoint which made i8080_run return I8080_RUN_BREAKPOINT
+i8080_break i8080_get_break(i8080* const c) {
+  i8080_break hit = {I8080_BREAK_EXEC, 0, 0};
+  if (c->breakpoints != NULL) {
+    hit = c->breakpoints->hit;
+  }
+  return hit;
+}
+
+#include "i8080_wide.h"
+
 // outputs a debug trace of the emulator state to the standard output,
 // including registers and flags
 void i8080_debug_output(i8080* const c, bool print_disassembly) {
-  uint8_t f = 0;
-  f |= c->sf << 7;
-  f |= c->zf << 6;
-  f |= c->hf << 4;
-  f |= c->pf << 2;
-  f |= 1 << 1; // bit 1 is always 1
-  f |= c->cf << 0;
-
+  i8080_sync_flags(c);
   printf("PC: %04X, AF: %04X, BC: %04X, DE: %04X, HL: %04X, SP: %04X, CYC: %lu",
-      c->pc, c->a << 8 | f, i8080_get_bc(c), i8080_get_de(c), i8080_get_hl(c),
+      c->pc, c->a << 8 | c->f, i8080_get_bc(c), i8080_get_de(c), i8080_get_hl(c),
       c->sp, c->cyc);
 
-  printf("\t(%02X %02X %02X %02X)", i8080_rb(c, c->pc), i8080_rb(c, c->pc + 1),
-      i8080_rb(c, c->pc + 2), i8080_rb(c, c->pc + 3));
+  printf("\t(%02X %02X %02X %02X)", i8080_fetch(c, c->pc),
+      i8080_fetch(c, c->pc + 1), i8080_fetch(c, c->pc + 2),
+      i8080_fetch(c, c->pc + 3));
 
   if (print_disassembly) {
-    printf(" - %s", DISASSEMBLE_TABLE[i8080_rb(c, c->pc)]);
+    printf(" - %s", DISASSEMBLE_TABLE[i8080_fetch(c, c->pc)]);
   }
 
   printf("\n");
 }
 
-#undef SET_ZSP
+// returns the mnemonic of an opcode, as printed by i8080_debug_output
+const char* i8080_disassemble(uint8_t opcode) {
+  return DISASSEMBLE_TABLE[opcode];
+}
+
+// returns the length in bytes of an instruction (with its operands)
+int i8080_opcode_length(uint8_t opcode) {
+  return OPCODES_LENGTH[opcode];
+}
+
+// returns the cycles an instruction takes, without the 6 cycles conditional
+// calls and returns add when their condition is met
+int i8080_opcode_cycles(uint8_t opcode) {
+  return OPCODES_CYCLES[opcode];
+}
+
+// returns if an instruction ends the blocks of the block cache (see
+// i8080_ends_block)
+bool i8080_opcode_ends_block(uint8_t opcode) {
+  return i8080_ends_block(opcode);
+}
+
+// returns if a flag (I8080_SF, I8080_ZF, I8080_HF, I8080_PF or I8080_CF) is
+// set, as the `sf`...`cf` fields of i8080 used to
+bool i8080_get_flag(i8080* const c, uint8_t flag) {
+  i8080_sync_flags(c);
+  return c->f & flag;
+}
+
+// sets or clears a flag
+void i8080_set_flag(i8080* const c, uint8_t flag, bool val) {
+  i8080_sync_flags(c);
+  c->f = val ? c->f | flag : c->f & ~flag;
+}
+
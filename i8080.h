@@ -5,6 +5,92 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+#define I8080_PAGE_SIZE 0x100
+#define I8080_NB_PAGES 0x100
+
+// flags bits in i8080.f: sign, zero, half-carry, parity, carry. Bit 1 is
+// always set, bits 3 and 5 are always clear.
+#define I8080_SF 0x80
+#define I8080_ZF 0x40
+#define I8080_HF 0x10
+#define I8080_PF 0x04
+#define I8080_CF 0x01
+
+// performance counters of an emulator, only maintained when built with
+// I8080_COUNTERS (see i8080_get_counters)
+typedef struct i8080_counters {
+  unsigned long instructions; // instructions retired
+  unsigned long opcodes[256]; // instructions retired per opcode
+  unsigned long reads, writes; // memory accesses (instruction fetches aside)
+  unsigned long port_in, port_out;
+  unsigned long interrupts; // interrupts accepted
+  unsigned long halted_cycles;
+  // conditional instructions: [0] condition not met, [1] condition met
+  unsigned long jumps[2], calls[2], returns[2];
+} i8080_counters;
+
+#define I8080_RING_SIZE 1024 // a power of two
+
+// ring of bytes which ports can be bound to (see i8080_bind_in), written by
+// one thread (with i8080_ring_write) and read by another (i8080_ring_read)
+// without locks. The indices are on their own cache lines.
+typedef struct i8080_ring {
+  size_t head; // bytes written so far
+  uint8_t pad1[64 - sizeof(size_t)];
+  size_t tail; // bytes read so far
+  uint8_t pad2[64 - sizeof(size_t)];
+  unsigned long dropped; // bytes written by OUT while the ring was full
+  uint8_t data[I8080_RING_SIZE];
+} i8080_ring;
+
+#define I8080_PROFILE_DEPTH 256
+
+// a calling context of a profiled program: a subroutine, called from the
+// subroutine of its parent node
+typedef struct i8080_profile_node {
+  uint16_t addr; // address of the subroutine
+  uint32_t parent, child, sibling; // indices in i8080_profile.nodes, 0: none
+  unsigned long calls;
+  unsigned long cycles; // exclusive cycles (spent outside of its callees)
+} i8080_profile_node;
+
+// profile of the program run by an emulator, only available when built with
+// I8080_PROFILER (see i8080_profile_start)
+typedef struct i8080_profile {
+  unsigned long cycles[0x10000]; // cycles spent at each address
+
+  // call graph: tree of the calling contexts, nodes[0] being the code that
+  // was running when profiling started
+  i8080_profile_node* nodes;
+  uint32_t nb_nodes, capacity;
+  unsigned long untracked; // calls not in the tree (stack too deep, no memory)
+
+  // shadow call stack: nodes being executed and their return addresses
+  uint32_t stack[I8080_PROFILE_DEPTH];
+  uint16_t returns[I8080_PROFILE_DEPTH];
+  int depth;
+  unsigned long pending; // untracked calls that haven't returned yet
+  unsigned long last_cyc; // last call or return
+  bool interrupt; // the next instruction is an interrupt vector
+} i8080_profile;
+
+// kinds of breakpoints (see i8080_set_breakpoint)
+enum {
+  I8080_BREAK_EXEC, // an instruction is about to be executed
+  I8080_BREAK_READ, // memory read (instruction fetches aside)
+  I8080_BREAK_WRITE, // memory write
+  I8080_BREAK_IN, // port read
+  I8080_BREAK_OUT, // port write
+  I8080_NB_BREAK_KINDS
+};
+
+// breakpoint which made i8080_run return I8080_RUN_BREAKPOINT
+typedef struct i8080_break {
+  int kind; // I8080_BREAK_*
+  uint16_t addr; // address, or port
+  uint8_t value; // byte read or written, opcode for I8080_BREAK_EXEC
+} i8080_break;
+
 typedef struct i8080 {
   // memory + io interface
   uint8_t (*read_byte)(void*, uint16_t); // user function to read from memory
@@ -13,22 +99,165 @@ typedef struct i8080 {
   void (*port_out)(void*, uint8_t, uint8_t); // same for writing to port
   void* userdata; // user custom pointer
 
+  // memory map: pages pointing to host memory are accessed directly, NULL
+  // pages go through read_byte/write_byte (see i8080_map_ram/rom)
+  const uint8_t* read_pages[I8080_NB_PAGES];
+  uint8_t* write_pages[I8080_NB_PAGES];
+  const uint8_t* data_pages[I8080_NB_PAGES]; // read_pages, unless watched
+  uint8_t page_flags[I8080_NB_PAGES]; // internal state of each page
+  uint8_t dirty_pages[I8080_NB_PAGES / 8]; // see i8080_clear_dirty
+
   unsigned long cyc; // cycle count
 
   uint16_t pc, sp; // program counter, stack pointer
   uint8_t a, b, c, d, e, h, l; // registers
-  // flags: sign, zero, half-carry, parity, carry, interrupt flip-flop
-  bool sf : 1, zf : 1, hf : 1, pf : 1, cf : 1, iff : 1;
+  uint8_t f; // flags, packed as in PSW (see I8080_SF...I8080_CF)
+#ifdef I8080_LAZY_FLAGS
+  // sign, zero, half-carry and parity of the last ALU operation, only
+  // computed when read. `f` is up to date when i8080_step/i8080_run return.
+  bool lazy_flags;
+  uint8_t lazy_result, lazy_aux;
+#endif
+  bool iff : 1; // interrupt flip-flop
   bool halted : 1;
 
   bool interrupt_pending : 1;
   uint8_t interrupt_vector;
   uint8_t interrupt_delay;
+  // interrupt requested from another thread (0x100 | opcode), see
+  // i8080_request_interrupt
+  uint16_t interrupt_request;
+
+  // set when something needs i8080_run to leave its fast path (interrupt
+  // requested, EI or HLT executed, i8080_stop called, event scheduled), can
+  // be set from other threads
+  uint8_t events;
+
+  struct i8080_block_cache* cache; // predecoded blocks (i8080_enable_cache)
+  struct i8080_breakpoints* breakpoints; // see i8080_set_breakpoint
+  struct i8080_scheduler* scheduler; // see i8080_schedule
+  struct i8080_ports* ports; // ports bound to rings (see i8080_bind_in)
+  struct i8080_shared_pages* shared; // ram shared with forks (i8080_fork)
+#ifdef I8080_PROFILER
+  i8080_profile* profile; // see i8080_profile_start
+#endif
+#ifdef I8080_COUNTERS
+  i8080_counters counters; // `instructions` is computed by i8080_get_counters
+#endif
 } i8080;
 
+// reasons for i8080_run to return
+enum {
+  I8080_RUN_BUDGET, // the cycle budget has been used up
+  I8080_RUN_STOPPED, // i8080_stop has been called
+  I8080_RUN_HALTED, // HLT has been executed, with no event scheduled
+  I8080_RUN_BREAKPOINT, // a breakpoint has been hit (see i8080_get_break)
+};
+
+typedef struct i8080_run_result {
+  unsigned long cycles; // number of cycles executed
+  unsigned long instructions; // number of instructions executed
+  int reason; // why i8080_run returned (I8080_RUN_*)
+} i8080_run_result;
+
+// maximum number of instructions in a block of the block cache: with the
+// cache, i8080_run returns at the end of a block, up to I8080_BLOCK_SIZE
+// instructions (of at most 18 cycles) past the end of its budget
+#define I8080_BLOCK_SIZE 16
+
+typedef struct i8080_cache_stats {
+  unsigned long hits; // blocks found in the cache
+  unsigned long misses; // blocks decoded
+  unsigned long invalidations; // blocks invalidated by writes to their code
+  unsigned long compilations; // blocks compiled by the jit
+  unsigned long loops_skipped; // loops fast-forwarded (see i8080_skip_loop)
+  unsigned long iterations_skipped; // iterations of loops not executed
+  unsigned long cycles_skipped; // cycles of these iterations
+} i8080_cache_stats;
+
+// save states (see i8080_save_state), with and without the memory image
+#define I8080_STATE_VERSION 1
+#define I8080_STATE_SIZE 29
+#define I8080_STATE_MEMORY_SIZE (I8080_STATE_SIZE + 0x10000)
+
+#define I8080_WIDE_LANES 16
+
+// emulators running the same program, stepped in lockstep (see
+// i8080_wide_init). Registers are stored as one array per register, with
+// one element per lane.
+typedef struct i8080_wide {
+  i8080* lanes[I8080_WIDE_LANES]; // memory map, callbacks, interrupt state
+  int nb_lanes;
+
+  uint8_t a[I8080_WIDE_LANES], b[I8080_WIDE_LANES], c[I8080_WIDE_LANES];
+  uint8_t d[I8080_WIDE_LANES], e[I8080_WIDE_LANES], h[I8080_WIDE_LANES];
+  uint8_t l[I8080_WIDE_LANES], f[I8080_WIDE_LANES];
+  uint16_t pc[I8080_WIDE_LANES], sp[I8080_WIDE_LANES];
+  unsigned long cyc[I8080_WIDE_LANES];
+
+  unsigned long groups; // groups of lanes executed together so far
+} i8080_wide;
+
 void i8080_init(i8080* const c);
+void i8080_destroy(i8080* const c);
 void i8080_step(i8080* const c);
+i8080_run_result i8080_run(i8080* const c, unsigned long cycles);
+void i8080_stop(i8080* const c);
 void i8080_interrupt(i8080* const c, uint8_t opcode);
+void i8080_request_interrupt(i8080* const c, uint8_t opcode);
+unsigned long i8080_schedule(i8080* const c, unsigned long cycle,
+    void (*callback)(void*, unsigned long), void* arg);
+bool i8080_cancel(i8080* const c, unsigned long id);
+void i8080_clear_schedule(i8080* const c);
+void i8080_ring_init(i8080_ring* const r);
+size_t i8080_ring_write(i8080_ring* const r, const uint8_t* buf, size_t size);
+size_t i8080_ring_read(i8080_ring* const r, uint8_t* buf, size_t size);
+bool i8080_bind_in(
+    i8080* const c, uint8_t port, i8080_ring* const ring, uint8_t empty);
+bool i8080_bind_out(i8080* const c, uint8_t port, i8080_ring* const ring);
+bool i8080_bind_status(i8080* const c, uint8_t port, i8080_ring* const in,
+    uint8_t in_ready, i8080_ring* const out, uint8_t out_ready);
+void i8080_unbind_ports(i8080* const c);
+bool i8080_map_ram(i8080* const c, uint16_t addr, size_t size, uint8_t* mem);
+bool i8080_map_rom(
+    i8080* const c, uint16_t addr, size_t size, const uint8_t* mem);
+bool i8080_unmap(i8080* const c, uint16_t addr, size_t size);
+bool i8080_fork(i8080* const c, i8080* const child);
+size_t i8080_resident_memory(i8080* const c);
+uint8_t i8080_peek(i8080* const c, uint16_t addr);
+void i8080_poke(i8080* const c, uint16_t addr, uint8_t val);
+bool i8080_enable_cache(i8080* const c);
+bool i8080_enable_jit(i8080* const c);
+void i8080_disable_cache(i8080* const c);
+void i8080_flush_cache(i8080* const c);
+i8080_cache_stats i8080_get_cache_stats(i8080* const c);
+i8080_counters i8080_get_counters(i8080* const c);
+void i8080_reset_counters(i8080* const c);
+i8080_profile* i8080_profile_start(i8080* const c);
+void i8080_profile_stop(i8080* const c);
+bool i8080_profile_write_folded(const i8080_profile* const p, FILE* f);
+bool i8080_profile_write_routines(const i8080_profile* const p, FILE* f);
+void i8080_profile_free(i8080_profile* const p);
+size_t i8080_save_state(
+    i8080* const c, uint8_t* buf, size_t size, bool with_memory);
+size_t i8080_delta_size(i8080* const c);
+size_t i8080_save_delta(i8080* const c, uint8_t* buf, size_t size);
+size_t i8080_load_state(i8080* const c, const uint8_t* buf, size_t size);
+void i8080_clear_dirty(i8080* const c);
+bool i8080_set_breakpoint(i8080* const c, int kind, uint16_t addr, size_t size);
+void i8080_clear_breakpoint(
+    i8080* const c, int kind, uint16_t addr, size_t size);
+void i8080_clear_breakpoints(i8080* const c);
+i8080_break i8080_get_break(i8080* const c);
+void i8080_wide_init(i8080_wide* const w, i8080* const* lanes, int nb_lanes);
+void i8080_wide_step(i8080_wide* const w);
+void i8080_wide_sync(i8080_wide* const w);
 void i8080_debug_output(i8080* const c, bool print_disassembly);
+const char* i8080_disassemble(uint8_t opcode);
+int i8080_opcode_length(uint8_t opcode);
+int i8080_opcode_cycles(uint8_t opcode);
+bool i8080_opcode_ends_block(uint8_t opcode);
+bool i8080_get_flag(i8080* const c, uint8_t flag);
+void i8080_set_flag(i8080* const c, uint8_t flag, bool val);
 
 #endif // I8080_I8080_H_
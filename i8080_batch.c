@@ -0,0 +1,260 @@
+// batch runner: runs many independent emulators on a pool of threads. Jobs
+// are run in slices of a few cycles, so that long jobs don't hold a thread
+// while short ones wait. Each thread has a queue of jobs: it runs a slice of
+// the job at the head of its queue then puts the job back at the tail, and
+// steals jobs from the tail of the other queues once its own is empty. A
+// thread with nothing to run or steal sleeps until a job is queued again or
+// the batch is done.
+
+#define _POSIX_C_SOURCE 200112L // for clock_gettime and sysconf
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include "i8080_batch.h"
+
+#define DEFAULT_SLICE_CYCLES 1000000
+
+// jobs of a thread, as a ring buffer of job indices (with room for all the
+// jobs of the batch, as they can all end up in the same queue)
+typedef struct i8080_queue {
+  pthread_mutex_t lock;
+  size_t* jobs;
+  size_t head, size;
+} i8080_queue;
+
+typedef struct i8080_batch {
+  i8080_job* jobs;
+  size_t nb_jobs;
+  unsigned long slice_cycles;
+
+  i8080_queue* queues;
+  int nb_workers;
+
+  // protected by `lock`
+  pthread_mutex_t lock;
+  pthread_cond_t work; // signalled when a job is queued or all are done
+  size_t nb_jobs_left; // jobs not finished yet
+  size_t nb_queued; // jobs in the queues (changed under their lock too)
+} i8080_batch;
+
+typedef struct i8080_worker {
+  i8080_batch* batch;
+  int id;
+  uint32_t seed; // to pick the queues to steal from
+} i8080_worker;
+
+// queue helpers: `nb_queued` is updated with the queue, so that threads
+// only sleep while all the queues are empty
+
+static void i8080_count_queued(i8080_batch* const b, int delta) {
+  pthread_mutex_lock(&b->lock);
+  b->nb_queued += delta;
+  if (delta > 0) {
+    pthread_cond_signal(&b->work);
+  }
+  pthread_mutex_unlock(&b->lock);
+}
+
+static void i8080_queue_push(i8080_batch* const b, int id, size_t job) {
+  i8080_queue* const q = &b->queues[id];
+  pthread_mutex_lock(&q->lock);
+  q->jobs[(q->head + q->size) % b->nb_jobs] = job;
+  q->size += 1;
+  i8080_count_queued(b, 1);
+  pthread_mutex_unlock(&q->lock);
+}
+
+// takes the job at the head of a queue, returns false if it is empty
+static bool i8080_queue_pop(i8080_batch* const b, int id, size_t* job) {
+  i8080_queue* const q = &b->queues[id];
+  bool found = false;
+  pthread_mutex_lock(&q->lock);
+  if (q->size > 0) {
+    *job = q->jobs[q->head];
+    q->head = (q->head + 1) % b->nb_jobs;
+    q->size -= 1;
+    i8080_count_queued(b, -1);
+    found = true;
+  }
+  pthread_mutex_unlock(&q->lock);
+  return found;
+}
+
+// takes the job at the tail of a queue, returns false if it is empty
+static bool i8080_queue_steal(i8080_batch* const b, int id, size_t* job) {
+  i8080_queue* const q = &b->queues[id];
+  bool found = false;
+  pthread_mutex_lock(&q->lock);
+  if (q->size > 0) {
+    q->size -= 1;
+    *job = q->jobs[(q->head + q->size) % b->nb_jobs];
+    i8080_count_queued(b, -1);
+    found = true;
+  }
+  pthread_mutex_unlock(&q->lock);
+  return found;
+}
+
+// returns the number of seconds since an arbitrary point in time
+static double i8080_now(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec / 1e9;
+}
+
+// runs a slice of a job, returns if the job is finished
+static bool i8080_run_slice(i8080_batch* const b, i8080_job* const job) {
+  unsigned long cycles = b->slice_cycles;
+  if (job->max_cycles != 0 && job->max_cycles - job->cycles < cycles) {
+    cycles = job->max_cycles - job->cycles;
+  }
+
+  const double start = i8080_now();
+  const i8080_run_result result = i8080_run(job->cpu, cycles);
+  job->wall_time += i8080_now() - start;
+
+  job->cycles += result.cycles;
+  job->instructions += result.instructions;
+  job->reason = result.reason;
+
+  return result.reason != I8080_RUN_BUDGET ||
+         (job->max_cycles != 0 && job->cycles >= job->max_cycles);
+}
+
+static void* i8080_worker_run(void* arg) {
+  i8080_worker* const w = arg;
+  i8080_batch* const b = w->batch;
+
+  while (true) {
+    size_t job;
+    bool found = i8080_queue_pop(b, w->id, &job);
+
+    // steals from the other queues, starting from a random one
+    w->seed = w->seed * 1103515245 + 12345;
+    const int first = (w->seed >> 16) % b->nb_workers;
+    for (int i = 0; i < b->nb_workers && !found; i++) {
+      const int victim = (first + i) % b->nb_workers;
+      found = victim != w->id && i8080_queue_steal(b, victim, &job);
+    }
+
+    if (!found) {
+      // the last jobs are being run by other threads: waits for one of them
+      // to be queued again, or for all of them to be done
+      pthread_mutex_lock(&b->lock);
+      while (b->nb_queued == 0 && b->nb_jobs_left > 0) {
+        pthread_cond_wait(&b->work, &b->lock);
+      }
+      const bool done = b->nb_jobs_left == 0;
+      pthread_mutex_unlock(&b->lock);
+      if (done) {
+        return NULL;
+      }
+      continue;
+    }
+
+    if (i8080_run_slice(b, &b->jobs[job])) {
+      pthread_mutex_lock(&b->lock);
+      b->nb_jobs_left -= 1;
+      if (b->nb_jobs_left == 0) {
+        pthread_cond_broadcast(&b->work);
+      }
+      pthread_mutex_unlock(&b->lock);
+    } else {
+      i8080_queue_push(b, w->id, job);
+    }
+  }
+}
+
+// runs all the jobs on `nb_threads` threads (0 for one per core, the calling
+// thread being one of them), in slices of `slice_cycles` cycles (0 for the
+// default). Jobs run until i8080_stop is called, HLT is executed (no
+// interrupts are sent) or `max_cycles` is reached. Callbacks of different
+// jobs can be called concurrently. Returns false if the batch can't be
+// allocated.
+bool i8080_run_batch(i8080_job* const jobs, size_t nb_jobs, int nb_threads,
+    unsigned long slice_cycles) {
+  if (nb_jobs == 0) {
+    return true;
+  }
+
+  if (nb_threads <= 0) {
+    nb_threads = sysconf(_SC_NPROCESSORS_ONLN);
+  }
+  if (nb_threads <= 0) {
+    nb_threads = 1;
+  }
+  if ((size_t) nb_threads > nb_jobs) {
+    nb_threads = nb_jobs;
+  }
+
+  i8080_batch b;
+  b.jobs = jobs;
+  b.nb_jobs = nb_jobs;
+  b.slice_cycles = slice_cycles != 0 ? slice_cycles : DEFAULT_SLICE_CYCLES;
+  b.nb_workers = nb_threads;
+  b.nb_jobs_left = nb_jobs;
+  b.nb_queued = 0;
+
+  b.queues = calloc(nb_threads, sizeof(i8080_queue));
+  size_t* const slots = malloc(nb_threads * nb_jobs * sizeof(size_t));
+  i8080_worker* const workers = malloc(nb_threads * sizeof(i8080_worker));
+  pthread_t* const threads = malloc(nb_threads * sizeof(pthread_t));
+  bool* const started = calloc(nb_threads, sizeof(bool));
+  if (b.queues == NULL || slots == NULL || workers == NULL ||
+      threads == NULL || started == NULL) {
+    free(b.queues);
+    free(slots);
+    free(workers);
+    free(threads);
+    free(started);
+    return false;
+  }
+
+  pthread_mutex_init(&b.lock, NULL);
+  pthread_cond_init(&b.work, NULL);
+  for (int i = 0; i < nb_threads; i++) {
+    pthread_mutex_init(&b.queues[i].lock, NULL);
+    b.queues[i].jobs = &slots[i * nb_jobs];
+    workers[i].batch = &b;
+    workers[i].id = i;
+    workers[i].seed = i;
+  }
+
+  for (size_t i = 0; i < nb_jobs; i++) {
+    i8080_job* const job = &jobs[i];
+    if (job->memory != NULL) {
+      i8080_map_ram(job->cpu, 0x0000, job->memory_size, job->memory);
+    }
+    job->cycles = 0;
+    job->instructions = 0;
+    job->wall_time = 0;
+    job->reason = I8080_RUN_BUDGET;
+    i8080_queue_push(&b, i % nb_threads, i);
+  }
+
+  // the jobs of a thread that can't be created are stolen by the others
+  for (int i = 1; i < nb_threads; i++) {
+    started[i] =
+        pthread_create(&threads[i], NULL, i8080_worker_run, &workers[i]) == 0;
+  }
+  i8080_worker_run(&workers[0]);
+  for (int i = 1; i < nb_threads; i++) {
+    if (started[i]) {
+      pthread_join(threads[i], NULL);
+    }
+  }
+
+  for (int i = 0; i < nb_threads; i++) {
+    pthread_mutex_destroy(&b.queues[i].lock);
+  }
+  pthread_cond_destroy(&b.work);
+  pthread_mutex_destroy(&b.lock);
+  free(b.queues);
+  free(slots);
+  free(workers);
+  free(threads);
+  free(started);
+  return true;
+}
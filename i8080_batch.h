@@ -0,0 +1,23 @@
+#ifndef I8080_I8080_BATCH_H_
+#define I8080_I8080_BATCH_H_
+
+#include "i8080.h"
+
+// a job of i8080_run_batch: an emulator run until it is stopped or halted
+typedef struct i8080_job {
+  i8080* cpu; // initialised by the caller (callbacks, pc...)
+  uint8_t* memory; // if not NULL, mapped as ram from address 0 before running
+  size_t memory_size;
+  unsigned long max_cycles; // cycles after which the job ends (0: no limit)
+
+  // results
+  unsigned long cycles; // number of cycles executed
+  unsigned long instructions; // number of instructions executed
+  double wall_time; // time spent running the job, in seconds
+  int reason; // why the job ended (I8080_RUN_*, BUDGET when max_cycles is hit)
+} i8080_job;
+
+bool i8080_run_batch(i8080_job* const jobs, size_t nb_jobs, int nb_threads,
+    unsigned long slice_cycles);
+
+#endif // I8080_I8080_BATCH_H_
@@ -0,0 +1,326 @@
+// differential execution: two emulators are run with i8080_run up to the
+// same cycle, and their registers and the memory written since the last
+// checkpoint are compared every `interval` cycles. Once they differ, both
+// are restored to the checkpoint and the span is bisected, down to two
+// points they can both stop at: one instruction apart with the interpreter,
+// one block apart with the block cache or the jit (which only stop at the
+// end of blocks). An emulator can also be compared to a trace, which holds
+// the state before each instruction, at every point it stops at.
+// Bisecting executes the instructions of a span again: the callbacks must
+// return the same values when called again.
+
+#include <stdlib.h>
+#include <string.h>
+#include "i8080_diff.h"
+
+#define DEFAULT_INTERVAL 1000000
+#define MAX_ALIGN 64 // runs to bring the emulators to the same cycle
+
+static inline uint8_t i8080_diff_peek(i8080* const c, uint16_t addr) {
+  const uint8_t* const page = c->read_pages[addr >> 8];
+  return page != NULL ? page[addr & 0xFF] : c->read_byte(c->userdata, addr);
+}
+
+// compares the values of both sides, writing the first difference found
+static bool i8080_diff_values(i8080_diff* const d, const char* const* names,
+    const unsigned long* a, const unsigned long* b, int n) {
+  for (int i = 0; i < n; i++) {
+    if (a[i] != b[i]) {
+      snprintf(d->difference, sizeof(d->difference), "%s: %lX != %lX",
+          names[i], a[i], b[i]);
+      return false;
+    }
+  }
+  return true;
+}
+
+// emulators
+
+static const char* const CPU_NAMES[] = {"cyc", "pc", "sp", "a", "f", "b",
+    "c", "d", "e", "h", "l", "iff", "halted", "interrupt_pending"};
+
+static void i8080_diff_cpu_values(i8080* const c, unsigned long* v) {
+  const unsigned long values[] = {c->cyc, c->pc, c->sp, c->a, c->f, c->b,
+      c->c, c->d, c->e, c->h, c->l, c->iff, c->halted, c->interrupt_pending};
+  memcpy(v, values, sizeof(values));
+}
+
+// compares the emulators, including the pages written by either of them
+// since the last checkpoint
+static bool i8080_diff_equal(i8080_diff* const d) {
+  i8080* const a = d->cpus[0];
+  i8080* const b = d->cpus[1];
+  const int n = sizeof(CPU_NAMES) / sizeof(CPU_NAMES[0]);
+  unsigned long values[2][sizeof(CPU_NAMES) / sizeof(CPU_NAMES[0])];
+  i8080_diff_cpu_values(a, values[0]);
+  i8080_diff_cpu_values(b, values[1]);
+  if (!i8080_diff_values(d, CPU_NAMES, values[0], values[1], n)) {
+    return false;
+  }
+
+  for (int page = 0; page < I8080_NB_PAGES; page++) {
+    if (((a->dirty_pages[page / 8] | b->dirty_pages[page / 8]) &
+            1 << (page % 8)) == 0) {
+      continue;
+    }
+    for (int i = 0; i < I8080_PAGE_SIZE; i++) {
+      const uint16_t addr = page * I8080_PAGE_SIZE + i;
+      const uint8_t val_a = i8080_diff_peek(a, addr);
+      const uint8_t val_b = i8080_diff_peek(b, addr);
+      if (val_a != val_b) {
+        snprintf(d->difference, sizeof(d->difference),
+            "memory %04X: %02X != %02X", addr, val_a, val_b);
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+static void i8080_diff_checkpoint(i8080_diff* const d) {
+  for (int i = 0; i < 2; i++) {
+    i8080_save_state(d->cpus[i], d->states[i], I8080_STATE_MEMORY_SIZE, true);
+    i8080_clear_dirty(d->cpus[i]);
+    d->instructions[i] = 0;
+  }
+}
+
+static void i8080_diff_restore(i8080_diff* const d) {
+  for (int i = 0; i < 2; i++) {
+    i8080_load_state(d->cpus[i], d->states[i], I8080_STATE_MEMORY_SIZE);
+    i8080_clear_dirty(d->cpus[i]);
+    d->instructions[i] = 0;
+  }
+}
+
+// runs an emulator up to cycle `target` (or a bit more), returns why it
+// stopped
+static int i8080_diff_advance(
+    i8080_diff* const d, int side, unsigned long target) {
+  i8080* const c = d->cpus[side];
+  while (c->cyc < target) {
+    const i8080_run_result result = i8080_run(c, target - c->cyc);
+    d->instructions[side] += result.instructions;
+    if (result.reason != I8080_RUN_BUDGET) {
+      return result.reason;
+    }
+  }
+  return I8080_RUN_BUDGET;
+}
+
+// brings both emulators to the first cycle from `target` they can both stop
+// at. Returns false if they don't get to the same cycle.
+static bool i8080_diff_sync(
+    i8080_diff* const d, unsigned long target, int* reason) {
+  i8080* const* const cpus = d->cpus;
+  int reasons[2] = {
+      i8080_diff_advance(d, 0, target), i8080_diff_advance(d, 1, target)};
+
+  for (int i = 0; i < MAX_ALIGN && cpus[0]->cyc != cpus[1]->cyc; i++) {
+    const int late = cpus[0]->cyc < cpus[1]->cyc ? 0 : 1;
+    if (reasons[late] != I8080_RUN_BUDGET) {
+      break;
+    }
+    reasons[late] = i8080_diff_advance(d, late, cpus[!late]->cyc);
+  }
+
+  *reason = reasons[0] != I8080_RUN_BUDGET ? reasons[0] : reasons[1];
+  return cpus[0]->cyc == cpus[1]->cyc;
+}
+
+// the emulators differ at cycle `hi` (or before) but agreed at the
+// checkpoint: finds the last point they agree on, and leaves them at the
+// next one. `done` counts the instructions of the first emulator.
+static void i8080_diff_bisect(
+    i8080_diff* const d, unsigned long hi, unsigned long* done) {
+  i8080* const a = d->cpus[0];
+  i8080* const b = d->cpus[1];
+  bool next = false; // goes to the next point both emulators can stop at
+  int reason;
+  i8080_diff_restore(d);
+  d->diverged = true;
+
+  while (true) {
+    d->cyc = a->cyc;
+    d->pc = a->pc;
+    d->opcode = i8080_diff_peek(a, a->pc);
+    if (hi - a->cyc <= 1) {
+      next = true;
+    }
+
+    const unsigned long target = a->cyc + (next ? 1 : (hi - a->cyc) / 2);
+    const bool synced = i8080_diff_sync(d, target, &reason);
+    const unsigned long cyc = a->cyc > b->cyc ? a->cyc : b->cyc;
+    if (synced && i8080_diff_equal(d)) {
+      if (cyc >= hi) {
+        // only happens if the emulators don't run the same way twice
+        snprintf(d->difference, sizeof(d->difference), "not reproducible");
+        return;
+      }
+      *done += d->instructions[0];
+      i8080_diff_checkpoint(d);
+      next = false;
+    } else if (next) {
+      return;
+    } else {
+      // there may be points they agree on before `target`
+      next = cyc >= hi;
+      hi = cyc < hi ? cyc : hi;
+      i8080_diff_restore(d);
+    }
+  }
+}
+
+static i8080_run_result i8080_diff_run_cpus(
+    i8080_diff* const d, unsigned long cycles) {
+  i8080* const a = d->cpus[0];
+  i8080_run_result result = {0, 0, I8080_RUN_BUDGET};
+  const unsigned long start = a->cyc;
+  unsigned long done = 0;
+
+  i8080_diff_checkpoint(d);
+  if (!i8080_diff_equal(d)) {
+    d->diverged = true;
+    d->cyc = a->cyc;
+    d->pc = a->pc;
+    d->opcode = i8080_diff_peek(a, a->pc);
+    return result;
+  }
+
+  while (a->cyc - start < cycles) {
+    const unsigned long left = cycles - (a->cyc - start);
+    const unsigned long target =
+        a->cyc + (left < d->interval ? left : d->interval);
+
+    if (!i8080_diff_sync(d, target, &result.reason) || !i8080_diff_equal(d)) {
+      const unsigned long cyc_b = d->cpus[1]->cyc;
+      i8080_diff_bisect(d, a->cyc > cyc_b ? a->cyc : cyc_b, &done);
+      break;
+    }
+
+    done += d->instructions[0];
+    i8080_diff_checkpoint(d);
+    if (result.reason != I8080_RUN_BUDGET) {
+      break;
+    }
+  }
+
+  result.cycles = a->cyc - start;
+  result.instructions = done + d->instructions[0];
+  return result;
+}
+
+// traces
+
+static const char* const RECORD_NAMES[] = {"cyc", "pc", "af", "bc", "de",
+    "hl", "sp", "memory pc", "memory pc+1", "memory pc+2", "memory pc+3"};
+
+// compares the emulator to the next record of the trace
+static bool i8080_diff_equal_record(i8080_diff* const d) {
+  i8080* const c = d->cpus[0];
+  const i8080_trace_record* const rec = &d->record;
+  const unsigned long a[] = {c->cyc, c->pc, c->a << 8 | c->f,
+      c->b << 8 | c->c, c->d << 8 | c->e, c->h << 8 | c->l, c->sp,
+      i8080_diff_peek(c, c->pc), i8080_diff_peek(c, c->pc + 1),
+      i8080_diff_peek(c, c->pc + 2), i8080_diff_peek(c, c->pc + 3)};
+  const unsigned long b[] = {rec->cyc, rec->pc, rec->af, rec->bc, rec->de,
+      rec->hl, rec->sp, rec->mem[0], rec->mem[1], rec->mem[2], rec->mem[3]};
+  return i8080_diff_values(
+      d, RECORD_NAMES, a, b, sizeof(a) / sizeof(a[0]));
+}
+
+// reads the records up to the cycle of the emulator, returns false at the
+// end of the trace
+static bool i8080_diff_skip_records(i8080_diff* const d) {
+  d->instructions[1] = 0;
+  while (!d->record_read || d->record.cyc < d->cpus[0]->cyc) {
+    if (!i8080_trace_read(d->trace, &d->record)) {
+      return false;
+    }
+    d->record_read = true;
+    d->instructions[1] += 1;
+  }
+  return true;
+}
+
+static i8080_run_result i8080_diff_run_trace(
+    i8080_diff* const d, unsigned long cycles) {
+  i8080* const c = d->cpus[0];
+  i8080_run_result result = {0, 0, I8080_RUN_BUDGET};
+  const unsigned long start = c->cyc;
+
+  bool ok = i8080_diff_skip_records(d);
+  d->instructions[0] = d->instructions[1] = 0;
+  d->cyc = c->cyc;
+  d->pc = c->pc;
+  d->opcode = i8080_diff_peek(c, c->pc);
+  while (ok && i8080_diff_equal_record(d) && c->cyc - start < cycles) {
+    d->cyc = c->cyc;
+    d->pc = c->pc;
+    d->opcode = i8080_diff_peek(c, c->pc);
+
+    // up to the next point the emulator can stop at
+    const i8080_run_result run = i8080_run(c, 1);
+    result.instructions += run.instructions;
+    d->instructions[0] = run.instructions;
+    ok = i8080_diff_skip_records(d);
+    if (run.reason != I8080_RUN_BUDGET) {
+      result.reason = run.reason;
+      ok = ok && i8080_diff_equal_record(d);
+      break;
+    }
+  }
+
+  if (!ok) {
+    // the end of the trace
+    result.reason = I8080_RUN_STOPPED;
+  } else if (!i8080_diff_equal_record(d)) {
+    d->diverged = true;
+  }
+  result.cycles = c->cyc - start;
+  return result;
+}
+
+// prepares to compare two emulators, which must have the same state.
+// Returns false if out of memory.
+bool i8080_diff_init(i8080_diff* const d, i8080* const a, i8080* const b) {
+  memset(d, 0, sizeof(i8080_diff));
+  d->cpus[0] = a;
+  d->cpus[1] = b;
+  d->interval = DEFAULT_INTERVAL;
+  for (int i = 0; i < 2; i++) {
+    d->states[i] = malloc(I8080_STATE_MEMORY_SIZE);
+  }
+  if (d->states[0] == NULL || d->states[1] == NULL) {
+    i8080_diff_free(d);
+    return false;
+  }
+  return true;
+}
+
+// prepares to compare an emulator to a trace (the emulator must be in the
+// state of a record of the trace)
+void i8080_diff_init_trace(
+    i8080_diff* const d, i8080* const c, i8080_trace_reader* const r) {
+  memset(d, 0, sizeof(i8080_diff));
+  d->cpus[0] = c;
+  d->trace = r;
+}
+
+// runs both sides for at least `cycles` cycles of the first emulator,
+// until they differ (setting `diverged` and where), one of them stops (HLT,
+// i8080_stop, or the end of the trace which returns I8080_RUN_STOPPED).
+// Emulators are left in the first state that differs. Comparing two
+// emulators uses their dirty pages (see i8080_clear_dirty).
+i8080_run_result i8080_diff_run(i8080_diff* const d, unsigned long cycles) {
+  d->diverged = false;
+  d->difference[0] = '\0';
+  return d->trace != NULL ? i8080_diff_run_trace(d, cycles)
+                          : i8080_diff_run_cpus(d, cycles);
+}
+
+void i8080_diff_free(i8080_diff* const d) {
+  free(d->states[0]);
+  free(d->states[1]);
+  d->states[0] = d->states[1] = NULL;
+}
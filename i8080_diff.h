@@ -0,0 +1,34 @@
+#ifndef I8080_I8080_DIFF_H_
+#define I8080_I8080_DIFF_H_
+
+#include "i8080.h"
+#include "i8080_trace.h"
+
+// runs two emulators (or an emulator and a trace recorded with
+// i8080_trace_step) in lockstep and finds where they start to disagree
+typedef struct i8080_diff {
+  i8080* cpus[2];
+  i8080_trace_reader* trace; // replaces cpus[1] if not NULL
+  unsigned long interval; // cycles between two comparisons of the emulators
+
+  // where the two sides disagreed (see i8080_diff_run)
+  bool diverged;
+  unsigned long cyc; // cycle of the last state both sides agreed on
+  uint16_t pc; // instruction executed from that state
+  uint8_t opcode;
+  unsigned long instructions[2]; // executed by each side from that state
+  char difference[64]; // first difference found, e.g. "a: 12 != 13"
+
+  // checkpoints of the emulators (save states with memory)
+  uint8_t* states[2];
+  i8080_trace_record record; // next record of the trace
+  bool record_read;
+} i8080_diff;
+
+bool i8080_diff_init(i8080_diff* const d, i8080* const a, i8080* const b);
+void i8080_diff_init_trace(
+    i8080_diff* const d, i8080* const c, i8080_trace_reader* const r);
+i8080_run_result i8080_diff_run(i8080_diff* const d, unsigned long cycles);
+void i8080_diff_free(i8080_diff* const d);
+
+#endif // I8080_I8080_DIFF_H_
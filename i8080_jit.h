@@ -0,0 +1,1309 @@
+// x86-64 jit compiler: translates hot blocks of the block cache into native
+// code. This file is included by i8080.c when JIT_SUPPORTED is defined.
+//
+// While a block runs, the 8080 registers live in host registers: rbx points
+// to the i8080 struct, r8 = A, r9 = B, r10 = C, r11 = D, r12 = E, r13 = H,
+// r14 = L, r15 = flags and rbp = SP (all zero-extended). eax, ecx, edx, esi
+// and edi are scratch registers.
+// The 8080 flags have the same layout as the low byte of the x86 flags (sign,
+// zero, half-carry, parity and carry), so they are read back with `lahf`.
+//
+// Compiled blocks are entered from i8080_execute_blocks, and jump from one to
+// the next after looking up the block cache (see jit_dispatch), until an
+// event is raised (by a memory callback or a write to cached code), the
+// cycle budget is spent, or the next block isn't compiled.
+// Blocks with io or interrupt instructions are left to the interpreter.
+//
+// The buffer is never writable and executable at once: it is executable,
+// and the pages a block is compiled to are only made writable (and no longer
+// executable) while it is being compiled (see jit_protect).
+
+#include <stddef.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#define JIT_BUFFER_SIZE (16 << 20) // memory for compiled blocks
+#define JIT_MAX_CODE 8192 // maximum size of a compiled block
+#define JIT_MAX_LABELS 256
+#define JIT_MAX_FIXUPS 256
+
+// executions of a block before it is compiled (I8080_JIT_THRESHOLD=1
+// compiles all the code that runs, to test the jit)
+#ifdef I8080_JIT_THRESHOLD
+#define JIT_THRESHOLD I8080_JIT_THRESHOLD
+#else
+#define JIT_THRESHOLD 16
+#endif
+
+// host registers
+enum {
+  RAX, RCX, RDX, RBX, RSP, RBP, RSI, RDI,
+  R8, R9, R10, R11, R12, R13, R14, R15
+};
+
+#define JIT_A R8
+#define JIT_F R15
+#define JIT_SP RBP
+
+// host registers of the 8080 registers, in the order of the opcodes register
+// fields (B, C, D, E, H, L, M, A). M is not a register.
+static const int JIT_REGS[8] = {R9, R10, R11, R12, R13, R14, -1, R8};
+
+// x86 condition codes
+#define CC_C 0x2
+#define CC_AE 0x3
+#define CC_Z 0x4
+#define CC_NZ 0x5
+
+typedef struct jit_section {
+  uint8_t* buf;
+  size_t len;
+  size_t cap;
+} jit_section;
+
+// the code of a block is emitted in two sections: the main one, then the cold
+// one with the slow paths and exits, which is appended after it. Jumps are
+// resolved when the block is finalized.
+typedef struct jit_asm {
+  jit_section sections[2];
+  int section; // current section
+
+  int nb_labels;
+  uint8_t label_sections[JIT_MAX_LABELS];
+  uint16_t label_offsets[JIT_MAX_LABELS];
+
+  int nb_fixups;
+  struct {
+    uint8_t section;
+    uint16_t offset; // of the rel32 to patch
+    int label; // -1 if the target is `target`
+    const uint8_t* target;
+  } fixups[JIT_MAX_FIXUPS];
+
+  bool overflow;
+} jit_asm;
+
+typedef struct i8080_jit {
+  uint8_t* buffer;
+  size_t used;
+  size_t shared_size; // of the code shared by the blocks
+
+  // shared code (see i8080_jit_shared_code)
+  unsigned long (*enter)(i8080* c, const uint8_t* block, unsigned long end);
+  const uint8_t* leave;
+  const uint8_t* read_byte;
+  const uint8_t* write_byte;
+  const uint8_t* call;
+
+  jit_asm asm_; // state of the assembler while compiling a block
+  uint8_t cold[JIT_MAX_CODE / 2]; // cold section of the block being compiled
+} i8080_jit;
+
+// assembler helpers
+
+#define MAIN 0
+#define COLD 1
+
+static void jit_init_asm(jit_asm* a, uint8_t* main, size_t main_cap,
+    uint8_t* cold, size_t cold_cap) {
+  a->sections[MAIN].buf = main;
+  a->sections[MAIN].len = 0;
+  a->sections[MAIN].cap = main_cap;
+  a->sections[COLD].buf = cold;
+  a->sections[COLD].len = 0;
+  a->sections[COLD].cap = cold_cap;
+  a->section = MAIN;
+  a->nb_labels = 0;
+  a->nb_fixups = 0;
+  a->overflow = false;
+}
+
+static void jit_emit(jit_asm* a, uint8_t byte) {
+  jit_section* s = &a->sections[a->section];
+  if (s->len == s->cap) {
+    a->overflow = true;
+    return;
+  }
+  s->buf[s->len++] = byte;
+}
+
+static void jit_emit32(jit_asm* a, uint32_t val) {
+  for (int i = 0; i < 4; i++) {
+    jit_emit(a, val >> (i * 8));
+  }
+}
+
+static int jit_new_label(jit_asm* a) {
+  if (a->nb_labels == JIT_MAX_LABELS) {
+    a->overflow = true;
+    return 0;
+  }
+  return a->nb_labels++;
+}
+
+static void jit_bind(jit_asm* a, int label) {
+  a->label_sections[label] = a->section;
+  a->label_offsets[label] = a->sections[a->section].len;
+}
+
+// emits a rel32 to a label or to an absolute address
+static void jit_rel32(jit_asm* a, int label, const uint8_t* target) {
+  if (a->nb_fixups == JIT_MAX_FIXUPS) {
+    a->overflow = true;
+    return;
+  }
+  a->fixups[a->nb_fixups].section = a->section;
+  a->fixups[a->nb_fixups].offset = a->sections[a->section].len;
+  a->fixups[a->nb_fixups].label = label;
+  a->fixups[a->nb_fixups].target = target;
+  a->nb_fixups += 1;
+  jit_emit32(a, 0);
+}
+
+static void jit_jmp(jit_asm* a, int label) {
+  jit_emit(a, 0xE9);
+  jit_rel32(a, label, NULL);
+}
+
+static void jit_jcc(jit_asm* a, uint8_t cc, int label) {
+  jit_emit(a, 0x0F);
+  jit_emit(a, 0x80 | cc);
+  jit_rel32(a, label, NULL);
+}
+
+static void jit_call(jit_asm* a, const uint8_t* target) {
+  jit_emit(a, 0xE8);
+  jit_rel32(a, -1, target);
+}
+
+// emits a REX prefix if needed. `byte` forces it for byte registers, so that
+// 4 to 7 are spl, bpl, sil and dil instead of ah, ch, dh and bh.
+static void jit_rex(jit_asm* a, bool w, int reg, int rm, bool byte) {
+  uint8_t rex = 0x40 | w << 3 | (reg >> 3) << 2 | (rm >> 3);
+  if (rex != 0x40 || byte) {
+    jit_emit(a, rex);
+  }
+}
+
+static void jit_modrm(jit_asm* a, int mod, int reg, int rm) {
+  jit_emit(a, mod << 6 | (reg & 7) << 3 | (rm & 7));
+}
+
+// op reg, [rbx + disp] (disp is an offset in the i8080 struct)
+static void jit_mem(jit_asm* a, int reg, size_t disp) {
+  jit_modrm(a, 2, reg, RBX);
+  jit_emit32(a, disp);
+}
+
+// mov dst, src (32 bits)
+static void jit_mov(jit_asm* a, int dst, int src) {
+  jit_rex(a, false, src, dst, false);
+  jit_emit(a, 0x89);
+  jit_modrm(a, 3, src, dst);
+}
+
+// mov reg, imm (64 bits)
+static void jit_mov_imm64(jit_asm* a, int reg, uint64_t imm) {
+  jit_rex(a, true, 0, reg, false);
+  jit_emit(a, 0xB8 | (reg & 7));
+  jit_emit32(a, imm);
+  jit_emit32(a, imm >> 32);
+}
+
+// mov reg, imm (32 bits)
+static void jit_mov_imm(jit_asm* a, int reg, uint32_t imm) {
+  jit_rex(a, false, 0, reg, false);
+  jit_emit(a, 0xB8 | (reg & 7));
+  jit_emit32(a, imm);
+}
+
+// 32 bits alu operation with an immediate, `ext` being 0 (add), 1 (or),
+// 4 (and), 5 (sub), 6 (xor) or 7 (cmp)
+static void jit_alu_imm(jit_asm* a, int ext, int reg, int32_t imm) {
+  jit_rex(a, false, 0, reg, false);
+  if (imm >= -128 && imm <= 127) {
+    jit_emit(a, 0x83);
+    jit_modrm(a, 3, ext, reg);
+    jit_emit(a, imm);
+  } else {
+    jit_emit(a, 0x81);
+    jit_modrm(a, 3, ext, reg);
+    jit_emit32(a, imm);
+  }
+}
+
+#define ADD 0
+#define OR 1
+#define AND 4
+#define SUB 5
+#define XOR 6
+#define CMP 7
+
+// 32 bits alu operation between two registers (same `ext` as jit_alu_imm)
+static void jit_alu(jit_asm* a, int ext, int dst, int src) {
+  jit_rex(a, false, src, dst, false);
+  jit_emit(a, ext << 3 | 0x01);
+  jit_modrm(a, 3, src, dst);
+}
+
+// 8 bits alu operation between two registers, `op` being the index of the
+// 8080 operation (ADD, ADC, SUB, SBB, ANA, XRA, ORA, CMP)
+static void jit_alu8(jit_asm* a, int op, int dst, int src) {
+  static const uint8_t OPS[8] = {
+      0x00, 0x10, 0x28, 0x18, 0x20, 0x30, 0x08, 0x38};
+  jit_rex(a, false, src, dst, true);
+  jit_emit(a, OPS[op]);
+  jit_modrm(a, 3, src, dst);
+}
+
+// shl (ext = 4) or shr (ext = 5) by an immediate
+static void jit_shift(jit_asm* a, int ext, int reg, int count) {
+  jit_rex(a, false, 0, reg, false);
+  jit_emit(a, 0xC1);
+  jit_modrm(a, 3, ext, reg);
+  jit_emit(a, count);
+}
+
+#define SHL 4
+#define SHR 5
+
+// inc (ext = 0) or dec (ext = 1) of a byte register
+static void jit_incdec8(jit_asm* a, int ext, int reg) {
+  jit_rex(a, false, 0, reg, true);
+  jit_emit(a, 0xFE);
+  jit_modrm(a, 3, ext, reg);
+}
+
+// movzx dst, src (byte)
+static void jit_movzx8(jit_asm* a, int dst, int src) {
+  jit_rex(a, false, dst, src, true);
+  jit_emit(a, 0x0F);
+  jit_emit(a, 0xB6);
+  jit_modrm(a, 3, dst, src);
+}
+
+// movzx dst, src (word)
+static void jit_movzx16(jit_asm* a, int dst, int src) {
+  jit_rex(a, false, dst, src, false);
+  jit_emit(a, 0x0F);
+  jit_emit(a, 0xB7);
+  jit_modrm(a, 3, dst, src);
+}
+
+// loads a byte field of the i8080 struct
+static void jit_load8(jit_asm* a, int reg, size_t field) {
+  jit_rex(a, false, reg, RBX, false);
+  jit_emit(a, 0x0F);
+  jit_emit(a, 0xB6);
+  jit_mem(a, reg, field);
+}
+
+// stores a byte field of the i8080 struct
+static void jit_store8(jit_asm* a, size_t field, int reg) {
+  jit_rex(a, false, reg, RBX, true);
+  jit_emit(a, 0x88);
+  jit_mem(a, reg, field);
+}
+
+// loads a word field of the i8080 struct
+static void jit_load16(jit_asm* a, int reg, size_t field) {
+  jit_rex(a, false, reg, RBX, false);
+  jit_emit(a, 0x0F);
+  jit_emit(a, 0xB7);
+  jit_mem(a, reg, field);
+}
+
+// stores a word field of the i8080 struct
+static void jit_store16(jit_asm* a, size_t field, int reg) {
+  jit_emit(a, 0x66);
+  jit_rex(a, false, reg, RBX, false);
+  jit_emit(a, 0x89);
+  jit_mem(a, reg, field);
+}
+
+// stores an immediate in a word field of the i8080 struct
+static void jit_store16_imm(jit_asm* a, size_t field, uint16_t imm) {
+  jit_emit(a, 0x66);
+  jit_emit(a, 0xC7);
+  jit_mem(a, 0, field);
+  jit_emit(a, imm);
+  jit_emit(a, imm >> 8);
+}
+
+// test reg8, imm
+static void jit_test8(jit_asm* a, int reg, uint8_t imm) {
+  jit_rex(a, false, 0, reg, true);
+  jit_emit(a, 0xF6);
+  jit_modrm(a, 3, 0, reg);
+  jit_emit(a, imm);
+}
+
+// copies the x86 flags to eax, with `mask`, and inverts the half-carry for
+// subtractions (the 8080 sets it when there is no borrow)
+static void jit_lahf(jit_asm* a, uint8_t mask, bool sub) {
+  jit_emit(a, 0x9F); // lahf
+  jit_emit(a, 0x0F); // movzx eax, ah
+  jit_emit(a, 0xB6);
+  jit_emit(a, 0xC4);
+  if (mask != 0xFF) {
+    jit_alu_imm(a, AND, RAX, mask);
+  }
+  if (sub) {
+    jit_alu_imm(a, XOR, RAX, I8080_HF);
+  }
+}
+
+// saves (store = true) or loads the registers of the 8080
+static void jit_sync_regs(jit_asm* a, bool store) {
+  static const struct {
+    int reg;
+    size_t field;
+  } REGS[8] = {{R8, offsetof(i8080, a)}, {R9, offsetof(i8080, b)},
+      {R10, offsetof(i8080, c)}, {R11, offsetof(i8080, d)},
+      {R12, offsetof(i8080, e)}, {R13, offsetof(i8080, h)},
+      {R14, offsetof(i8080, l)}, {R15, offsetof(i8080, f)}};
+
+  for (int i = 0; i < 8; i++) {
+    if (store) {
+      jit_store8(a, REGS[i].field, REGS[i].reg);
+    } else {
+      jit_load8(a, REGS[i].reg, REGS[i].field);
+    }
+  }
+  if (store) {
+    jit_store16(a, offsetof(i8080, sp), JIT_SP);
+  } else {
+    jit_load16(a, JIT_SP, offsetof(i8080, sp));
+  }
+}
+
+// memory accesses: the page tables are read like in i8080_rb and i8080_wb,
+// and other pages go through a trampoline to i8080_rb_slow or i8080_wb_slow.
+// `next_pc` is stored beforehand, as the callbacks may read it.
+
+// reads the byte at edx into eax (clobbers ecx)
+static void jit_read8(jit_asm* a, i8080_jit* jit, uint16_t next_pc) {
+  const int slow = jit_new_label(a);
+  const int done = jit_new_label(a);
+
+  jit_mov(a, RCX, RDX);
+  jit_shift(a, SHR, RCX, 8);
+  // mov rax, [rbx + rcx * 8 + data_pages]
+  jit_emit(a, 0x48);
+  jit_emit(a, 0x8B);
+  jit_emit(a, 0x84);
+  jit_emit(a, 0xCB);
+  jit_emit32(a, offsetof(i8080, data_pages));
+  jit_emit(a, 0x48); // test rax, rax
+  jit_emit(a, 0x85);
+  jit_emit(a, 0xC0);
+  jit_jcc(a, CC_Z, slow);
+  jit_movzx8(a, RCX, RDX);
+  jit_emit(a, 0x0F); // movzx eax, byte [rax + rcx]
+  jit_emit(a, 0xB6);
+  jit_emit(a, 0x04);
+  jit_emit(a, 0x08);
+  jit_bind(a, done);
+
+  a->section = COLD;
+  jit_bind(a, slow);
+  jit_store16_imm(a, offsetof(i8080, pc), next_pc);
+  jit_call(a, jit->read_byte);
+  jit_jmp(a, done);
+  a->section = MAIN;
+}
+
+// writes al at edx (clobbers eax, ecx and esi)
+static void jit_write8(jit_asm* a, i8080_jit* jit, uint16_t next_pc) {
+  const int slow = jit_new_label(a);
+  const int call = jit_new_label(a);
+  const int done = jit_new_label(a);
+
+  jit_mov(a, RCX, RDX);
+  jit_shift(a, SHR, RCX, 8);
+  // mov rsi, [rbx + rcx * 8 + write_pages]
+  jit_emit(a, 0x48);
+  jit_emit(a, 0x8B);
+  jit_emit(a, 0xB4);
+  jit_emit(a, 0xCB);
+  jit_emit32(a, offsetof(i8080, write_pages));
+  jit_emit(a, 0x48); // test rsi, rsi
+  jit_emit(a, 0x85);
+  jit_emit(a, 0xF6);
+  jit_jcc(a, CC_Z, slow);
+  jit_movzx8(a, RCX, RDX);
+  jit_emit(a, 0x88); // mov [rsi + rcx], al
+  jit_emit(a, 0x04);
+  jit_emit(a, 0x0E);
+  jit_bind(a, done);
+
+  a->section = COLD;
+  jit_bind(a, slow);
+  // pages with code and data are write-protected: writes to their data are
+  // done here, as in i8080_wb_slow. Ram protected for another reason (shared,
+  // clean or watched) goes through i8080_wb_slow.
+  // movzx esi, byte [rbx + rcx + page_flags]
+  jit_emit(a, 0x0F);
+  jit_emit(a, 0xB6);
+  jit_emit(a, 0xB4);
+  jit_emit(a, 0x0B);
+  jit_emit32(a, offsetof(i8080, page_flags));
+  jit_alu_imm(a, AND, RSI, ~(PAGE_CODE | PAGE_OWNED | PAGE_WATCH_READ));
+  jit_alu_imm(a, CMP, RSI, PAGE_RAM);
+  jit_jcc(a, CC_NZ, call);
+  jit_emit(a, 0x48); // mov rsi, [rbx + cache]
+  jit_emit(a, 0x8B);
+  jit_mem(a, RSI, offsetof(i8080, cache));
+  jit_emit(a, 0x0F); // bt [rsi + code], edx
+  jit_emit(a, 0xA3);
+  jit_emit(a, 0x96);
+  jit_emit32(a, offsetof(i8080_block_cache, code));
+  jit_jcc(a, CC_C, call);
+  // mov rsi, [rbx + rcx * 8 + read_pages]
+  jit_emit(a, 0x48);
+  jit_emit(a, 0x8B);
+  jit_emit(a, 0xB4);
+  jit_emit(a, 0xCB);
+  jit_emit32(a, offsetof(i8080, read_pages));
+  jit_movzx8(a, RCX, RDX);
+  jit_emit(a, 0x88); // mov [rsi + rcx], al
+  jit_emit(a, 0x04);
+  jit_emit(a, 0x0E);
+  jit_jmp(a, done);
+
+  jit_bind(a, call);
+  jit_store16_imm(a, offsetof(i8080, pc), next_pc);
+  jit_call(a, jit->write_byte);
+  jit_jmp(a, done);
+  a->section = MAIN;
+}
+
+// edx = (edx + 1) & 0xFFFF
+static void jit_next_addr(jit_asm* a) {
+  jit_alu_imm(a, ADD, RDX, 1);
+  jit_movzx16(a, RDX, RDX);
+}
+
+// reads the word at edx into eax (clobbers ecx, edx and edi)
+static void jit_read16(jit_asm* a, i8080_jit* jit, uint16_t next_pc) {
+  jit_read8(a, jit, next_pc);
+  jit_mov(a, RDI, RAX);
+  jit_next_addr(a);
+  jit_read8(a, jit, next_pc);
+  jit_shift(a, SHL, RAX, 8);
+  jit_alu(a, OR, RAX, RDI);
+}
+
+// writes edi at edx (clobbers eax, ecx, edx and esi)
+static void jit_write16(jit_asm* a, i8080_jit* jit, uint16_t next_pc) {
+  jit_mov(a, RAX, RDI);
+  jit_write8(a, jit, next_pc);
+  jit_next_addr(a);
+  jit_mov(a, RAX, RDI);
+  jit_shift(a, SHR, RAX, 8);
+  jit_write8(a, jit, next_pc);
+}
+
+// register pairs: 0 = BC, 1 = DE, 2 = HL, 3 = SP
+
+static void jit_get_pair(jit_asm* a, int dst, int pair) {
+  if (pair == 3) {
+    jit_mov(a, dst, JIT_SP);
+    return;
+  }
+  jit_mov(a, dst, JIT_REGS[pair * 2]);
+  jit_shift(a, SHL, dst, 8);
+  jit_alu(a, OR, dst, JIT_REGS[pair * 2 + 1]);
+}
+
+// sets a register pair from the low word of `src` (which is clobbered)
+static void jit_set_pair(jit_asm* a, int pair, int src) {
+  if (pair == 3) {
+    jit_movzx16(a, JIT_SP, src);
+    return;
+  }
+  jit_movzx8(a, JIT_REGS[pair * 2 + 1], src);
+  jit_shift(a, SHR, src, 8);
+  jit_movzx8(a, JIT_REGS[pair * 2], src);
+}
+
+// pushes edi (clobbers eax, ecx, edx and esi)
+static void jit_push(jit_asm* a, i8080_jit* jit, uint16_t next_pc) {
+  jit_alu_imm(a, SUB, JIT_SP, 2);
+  jit_movzx16(a, JIT_SP, JIT_SP);
+  jit_mov(a, RDX, JIT_SP);
+  jit_write16(a, jit, next_pc);
+}
+
+// pops a word into eax (clobbers ecx, edx and edi)
+static void jit_pop(jit_asm* a, i8080_jit* jit, uint16_t next_pc) {
+  jit_mov(a, RDX, JIT_SP);
+  jit_read16(a, jit, next_pc);
+  jit_alu_imm(a, ADD, JIT_SP, 2);
+  jit_movzx16(a, JIT_SP, JIT_SP);
+}
+
+// sets the carry flag from bit 0 of eax
+static void jit_set_cf(jit_asm* a) {
+  jit_alu_imm(a, AND, JIT_F, ~I8080_CF);
+  jit_alu(a, OR, JIT_F, RAX);
+}
+
+// emits a jump to `label` if the condition of a conditional instruction
+// (bits 3-5 of its opcode) is NOT met
+static void jit_skip_unless(jit_asm* a, uint8_t opcode, int label) {
+  static const uint8_t FLAGS[4] = {I8080_ZF, I8080_CF, I8080_PF, I8080_SF};
+  const int cond = (opcode >> 3) & 7;
+  jit_test8(a, JIT_F, FLAGS[cond >> 1]);
+  // odd conditions are met when the flag is set
+  jit_jcc(a, (cond & 1) ? CC_Z : CC_NZ, label);
+}
+
+// 8080 alu operation on A with ecx
+static void jit_alu_a(jit_asm* a, int op) {
+  switch (op) {
+  case 0: // ADD
+  case 1: // ADC
+  case 2: // SUB
+  case 3: // SBB
+  case 7: // CMP
+    if (op == 1 || op == 3) {
+      // bt r15d, 0: loads the carry flag
+      jit_emit(a, 0x41);
+      jit_emit(a, 0x0F);
+      jit_emit(a, 0xBA);
+      jit_modrm(a, 3, 4, JIT_F);
+      jit_emit(a, 0);
+    }
+    jit_alu8(a, op, JIT_A, RCX);
+    jit_lahf(a, 0xFF, op >= 2);
+    jit_mov(a, JIT_F, RAX);
+    break;
+  case 4: // ANA: the half-carry is the bit 3 of the or of the operands
+    jit_mov(a, RDX, JIT_A);
+    jit_alu(a, OR, RDX, RCX);
+    jit_alu_imm(a, AND, RDX, 0x08);
+    jit_shift(a, SHL, RDX, 1);
+    jit_alu8(a, op, JIT_A, RCX);
+    jit_lahf(a, I8080_SF | I8080_ZF | I8080_PF | 0x02, false);
+    jit_alu(a, OR, RAX, RDX);
+    jit_mov(a, JIT_F, RAX);
+    break;
+  case 5: // XRA
+  case 6: // ORA
+    jit_alu8(a, op, JIT_A, RCX);
+    jit_lahf(a, I8080_SF | I8080_ZF | I8080_PF | 0x02, false);
+    jit_mov(a, JIT_F, RAX);
+    break;
+  }
+}
+
+// INR (ext = 0) or DCR (ext = 1) of `reg`, the carry flag being kept
+static void jit_inr_dcr(jit_asm* a, int ext, int reg) {
+  jit_incdec8(a, ext, reg);
+  jit_lahf(a, I8080_SF | I8080_ZF | I8080_HF | I8080_PF | 0x02, ext == 1);
+  jit_alu_imm(a, AND, JIT_F, I8080_CF);
+  jit_alu(a, OR, JIT_F, RAX);
+}
+
+// DAA is rare enough to be left to C
+static void i8080_jit_daa(i8080* const c) {
+  i8080_daa(c);
+  i8080_sync_flags(c);
+}
+
+// returns if a block can be compiled
+static bool i8080_jit_supported(const i8080_block* block) {
+  for (int i = 0; i < block->nb_insns; i++) {
+    switch (block->insns[i].opcode) {
+    case 0x76: // HLT
+    case 0xD3: // OUT
+    case 0xDB: // IN
+    case 0xF3: // DI
+    case 0xFB: return false; // EI
+    }
+  }
+  return true;
+}
+
+// translates an instruction which doesn't change the control flow
+static void i8080_jit_insn(
+    jit_asm* a, i8080_jit* jit, const i8080_insn* insn) {
+  const uint8_t opcode = insn->opcode;
+  const uint16_t imm = insn->operand;
+  const uint16_t next_pc = insn->next_pc;
+  const int dst = JIT_REGS[(opcode >> 3) & 7];
+  const int src = JIT_REGS[opcode & 7];
+  const int pair = (opcode >> 4) & 3;
+
+  if (opcode >= 0x40 && opcode < 0x80) { // MOV
+    if ((opcode & 7) == 6) {
+      jit_get_pair(a, RDX, 2);
+      jit_read8(a, jit, next_pc);
+      jit_mov(a, dst, RAX);
+    } else if (((opcode >> 3) & 7) == 6) {
+      jit_get_pair(a, RDX, 2);
+      jit_mov(a, RAX, src);
+      jit_write8(a, jit, next_pc);
+    } else if (dst != src) {
+      jit_mov(a, dst, src);
+    }
+    return;
+  }
+
+  if (opcode >= 0x80 && opcode < 0xC0) { // ADD ... CMP
+    if ((opcode & 7) == 6) {
+      jit_get_pair(a, RDX, 2);
+      jit_read8(a, jit, next_pc);
+      jit_mov(a, RCX, RAX);
+    } else {
+      jit_mov(a, RCX, src);
+    }
+    jit_alu_a(a, (opcode >> 3) & 7);
+    return;
+  }
+
+  if ((opcode & 0xC7) == 0xC6) { // ADI ... CPI
+    jit_mov_imm(a, RCX, imm & 0xFF);
+    jit_alu_a(a, (opcode >> 3) & 7);
+    return;
+  }
+
+  if (opcode < 0x40 && (opcode & 6) == 4) { // INR, DCR
+    if (dst >= 0) {
+      jit_inr_dcr(a, opcode & 1, dst);
+    } else {
+      jit_get_pair(a, RDX, 2);
+      jit_read8(a, jit, next_pc);
+      jit_mov(a, RCX, RAX);
+      jit_inr_dcr(a, opcode & 1, RCX);
+      jit_mov(a, RAX, RCX);
+      jit_write8(a, jit, next_pc);
+    }
+    return;
+  }
+
+  switch (opcode) {
+  case 0x06: case 0x0E: case 0x16: case 0x1E:
+  case 0x26: case 0x2E: case 0x3E: // MVI
+    jit_mov_imm(a, dst, imm & 0xFF);
+    break;
+  case 0x36: // MVI M
+    jit_get_pair(a, RDX, 2);
+    jit_mov_imm(a, RAX, imm & 0xFF);
+    jit_write8(a, jit, next_pc);
+    break;
+
+  case 0x01: case 0x11: case 0x21: case 0x31: // LXI
+    jit_mov_imm(a, RAX, imm);
+    jit_set_pair(a, pair, RAX);
+    break;
+  case 0x03: case 0x13: case 0x23: case 0x33: // INX
+  case 0x0B: case 0x1B: case 0x2B: case 0x3B: // DCX
+    jit_get_pair(a, RAX, pair);
+    jit_alu_imm(a, (opcode & 8) ? SUB : ADD, RAX, 1);
+    jit_set_pair(a, pair, RAX);
+    break;
+  case 0x09: case 0x19: case 0x29: case 0x39: // DAD
+    jit_get_pair(a, RAX, 2);
+    jit_get_pair(a, RCX, pair);
+    jit_alu(a, ADD, RAX, RCX);
+    jit_mov(a, RCX, RAX);
+    jit_set_pair(a, 2, RCX);
+    jit_shift(a, SHR, RAX, 16);
+    jit_set_cf(a);
+    break;
+
+  case 0x0A: case 0x1A: // LDAX
+    jit_get_pair(a, RDX, pair);
+    jit_read8(a, jit, next_pc);
+    jit_mov(a, JIT_A, RAX);
+    break;
+  case 0x02: case 0x12: // STAX
+    jit_get_pair(a, RDX, pair);
+    jit_mov(a, RAX, JIT_A);
+    jit_write8(a, jit, next_pc);
+    break;
+  case 0x3A: // LDA
+    jit_mov_imm(a, RDX, imm);
+    jit_read8(a, jit, next_pc);
+    jit_mov(a, JIT_A, RAX);
+    break;
+  case 0x32: // STA
+    jit_mov_imm(a, RDX, imm);
+    jit_mov(a, RAX, JIT_A);
+    jit_write8(a, jit, next_pc);
+    break;
+  case 0x2A: // LHLD
+    jit_mov_imm(a, RDX, imm);
+    jit_read16(a, jit, next_pc);
+    jit_set_pair(a, 2, RAX);
+    break;
+  case 0x22: // SHLD
+    jit_mov_imm(a, RDX, imm);
+    jit_get_pair(a, RDI, 2);
+    jit_write16(a, jit, next_pc);
+    break;
+
+  case 0x07: // RLC
+    jit_mov(a, RAX, JIT_A);
+    jit_shift(a, SHR, RAX, 7);
+    jit_set_cf(a);
+    jit_shift(a, SHL, JIT_A, 1);
+    jit_alu(a, OR, JIT_A, RAX);
+    jit_movzx8(a, JIT_A, JIT_A);
+    break;
+  case 0x0F: // RRC
+    jit_mov(a, RAX, JIT_A);
+    jit_alu_imm(a, AND, RAX, 1);
+    jit_set_cf(a);
+    jit_shift(a, SHR, JIT_A, 1);
+    jit_shift(a, SHL, RAX, 7);
+    jit_alu(a, OR, JIT_A, RAX);
+    break;
+  case 0x17: // RAL
+    jit_mov(a, RCX, JIT_F);
+    jit_alu_imm(a, AND, RCX, I8080_CF);
+    jit_mov(a, RAX, JIT_A);
+    jit_shift(a, SHR, RAX, 7);
+    jit_set_cf(a);
+    jit_shift(a, SHL, JIT_A, 1);
+    jit_alu(a, OR, JIT_A, RCX);
+    jit_movzx8(a, JIT_A, JIT_A);
+    break;
+  case 0x1F: // RAR
+    jit_mov(a, RCX, JIT_F);
+    jit_alu_imm(a, AND, RCX, I8080_CF);
+    jit_shift(a, SHL, RCX, 7);
+    jit_mov(a, RAX, JIT_A);
+    jit_alu_imm(a, AND, RAX, 1);
+    jit_set_cf(a);
+    jit_shift(a, SHR, JIT_A, 1);
+    jit_alu(a, OR, JIT_A, RCX);
+    break;
+  case 0x27: // DAA
+    jit_emit(a, 0x48); // mov rax, i8080_jit_daa
+    jit_emit(a, 0xB8);
+    for (int i = 0; i < 8; i++) {
+      jit_emit(a, (uintptr_t) i8080_jit_daa >> (i * 8));
+    }
+    jit_call(a, jit->call);
+    break;
+  case 0x2F: // CMA
+    jit_alu_imm(a, XOR, JIT_A, 0xFF);
+    break;
+  case 0x37: // STC
+    jit_alu_imm(a, OR, JIT_F, I8080_CF);
+    break;
+  case 0x3F: // CMC
+    jit_alu_imm(a, XOR, JIT_F, I8080_CF);
+    break;
+
+  case 0x00: case 0x08: case 0x10: case 0x18:
+  case 0x20: case 0x28: case 0x30: case 0x38: // NOP
+    break;
+
+  case 0xC5: case 0xD5: case 0xE5: // PUSH
+    jit_get_pair(a, RDI, pair);
+    jit_push(a, jit, next_pc);
+    break;
+  case 0xF5: // PUSH PSW
+    jit_mov(a, RDI, JIT_A);
+    jit_shift(a, SHL, RDI, 8);
+    jit_alu(a, OR, RDI, JIT_F);
+    jit_push(a, jit, next_pc);
+    break;
+  case 0xC1: case 0xD1: case 0xE1: // POP
+    jit_pop(a, jit, next_pc);
+    jit_set_pair(a, pair, RAX);
+    break;
+  case 0xF1: // POP PSW
+    jit_pop(a, jit, next_pc);
+    jit_mov(a, JIT_F, RAX);
+    jit_alu_imm(a, AND, JIT_F, 0xD5);
+    jit_alu_imm(a, OR, JIT_F, 0x02);
+    jit_shift(a, SHR, RAX, 8);
+    jit_movzx8(a, JIT_A, RAX);
+    break;
+  case 0xE3: // XTHL
+    jit_mov(a, RDX, JIT_SP);
+    jit_read16(a, jit, next_pc);
+    jit_mov(a, RSI, RAX);
+    jit_get_pair(a, RDI, 2);
+    jit_set_pair(a, 2, RSI);
+    jit_mov(a, RDX, JIT_SP);
+    jit_write16(a, jit, next_pc);
+    break;
+  case 0xEB: // XCHG
+    jit_mov(a, RAX, R11);
+    jit_mov(a, R11, R13);
+    jit_mov(a, R13, RAX);
+    jit_mov(a, RAX, R12);
+    jit_mov(a, R12, R14);
+    jit_mov(a, R14, RAX);
+    break;
+  case 0xF9: // SPHL
+    jit_get_pair(a, JIT_SP, 2);
+    break;
+  }
+}
+
+// jumps to the compiled block at c->pc (`pc`, or if -1 the value stored in
+// c->pc) if it is valid, no event has been raised and the deadline isn't
+// reached. Otherwise leaves to i8080_execute_blocks. `cache` is only needed if
+// `pc` is known.
+static void jit_dispatch(
+    jit_asm* a, i8080_jit* jit, i8080_block_cache* cache, int pc) {
+  const int leave = jit_new_label(a);
+
+  jit_emit(a, 0xF6); // test byte [rbx + events], 0xFF
+  jit_mem(a, 0, offsetof(i8080, events));
+  jit_emit(a, 0xFF);
+  jit_jcc(a, CC_NZ, leave);
+  jit_emit(a, 0x48); // mov rax, [rbx + cyc]
+  jit_emit(a, 0x8B);
+  jit_mem(a, RAX, offsetof(i8080, cyc));
+  jit_emit(a, 0x48); // cmp rax, [rsp + 8]
+  jit_emit(a, 0x3B);
+  jit_emit(a, 0x44);
+  jit_emit(a, 0x24);
+  jit_emit(a, 0x08);
+  jit_jcc(a, CC_AE, leave);
+
+  // rsi = &cache->blocks[pc % CACHE_SIZE], rdi = cache
+  if (pc >= 0) {
+    jit_mov_imm64(a, RSI, (uintptr_t) &cache->blocks[pc % CACHE_SIZE]);
+    jit_mov_imm64(a, RDI, (uintptr_t) cache);
+    jit_mov_imm(a, RAX, pc);
+  } else {
+    jit_load16(a, RAX, offsetof(i8080, pc));
+    jit_mov(a, RCX, RAX);
+    jit_alu_imm(a, AND, RCX, CACHE_SIZE - 1);
+    jit_emit(a, 0x69); // imul ecx, ecx, sizeof(i8080_block)
+    jit_emit(a, 0xC9);
+    jit_emit32(a, sizeof(i8080_block));
+    jit_emit(a, 0x48); // mov rdi, [rbx + cache]
+    jit_emit(a, 0x8B);
+    jit_mem(a, RDI, offsetof(i8080, cache));
+    jit_emit(a, 0x48); // lea rsi, [rdi + rcx + blocks]
+    jit_emit(a, 0x8D);
+    jit_emit(a, 0xB4);
+    jit_emit(a, 0x0F);
+    jit_emit32(a, offsetof(i8080_block_cache, blocks));
+  }
+
+  // the block must be valid, which is checked as in i8080_cache_lookup
+  jit_emit(a, 0x66); // cmp [rsi + pc], ax
+  jit_emit(a, 0x39);
+  jit_emit(a, 0x86);
+  jit_emit32(a, offsetof(i8080_block, pc));
+  jit_jcc(a, CC_NZ, leave);
+  jit_emit(a, 0x80); // cmp byte [rsi + nb_insns], 0
+  jit_emit(a, 0xBE);
+  jit_emit32(a, offsetof(i8080_block, nb_insns));
+  jit_emit(a, 0x00);
+  jit_jcc(a, CC_Z, leave);
+  jit_shift(a, SHR, RAX, 8);
+  jit_emit(a, 0x8B); // mov eax, [rdi + rax * 4 + page_gens]
+  jit_emit(a, 0x84);
+  jit_emit(a, 0x87);
+  jit_emit32(a, offsetof(i8080_block_cache, page_gens));
+  jit_emit(a, 0x39); // cmp [rsi + gen], eax
+  jit_emit(a, 0x86);
+  jit_emit32(a, offsetof(i8080_block, gen));
+  jit_jcc(a, CC_NZ, leave);
+  jit_emit(a, 0x48); // mov rax, [rsi + native]
+  jit_emit(a, 0x8B);
+  jit_emit(a, 0x86);
+  jit_emit32(a, offsetof(i8080_block, native));
+  jit_emit(a, 0x48); // test rax, rax
+  jit_emit(a, 0x85);
+  jit_emit(a, 0xC0);
+  jit_jcc(a, CC_Z, leave);
+  jit_emit(a, 0x48); // add qword [rdi + hits], 1
+  jit_emit(a, 0x83);
+  jit_emit(a, 0x87);
+  jit_emit32(a, offsetof(i8080_block_cache, stats.hits));
+  jit_emit(a, 0x01);
+  jit_emit(a, 0xFF); // jmp rax
+  jit_emit(a, 0xE0);
+
+  jit_bind(a, leave);
+  jit_emit(a, 0xE9); // jmp leave
+  jit_rel32(a, -1, jit->leave);
+}
+
+// translates the last instruction of a block, which sets c->pc, then jumps to
+// the next block
+static void i8080_jit_last_insn(jit_asm* a, i8080_jit* jit,
+    i8080_block_cache* cache, const i8080_insn* insn) {
+  const uint8_t opcode = insn->opcode;
+  const uint16_t next_pc = insn->next_pc;
+  int target = -1; // if known
+  bool conditional = false;
+
+  switch (opcode) {
+  case 0xC3: case 0xCB: // JMP
+  case 0xC2: case 0xCA: case 0xD2: case 0xDA:
+  case 0xE2: case 0xEA: case 0xF2: case 0xFA: // Jcc
+    target = insn->operand;
+    conditional = (opcode & 1) == 0;
+    break;
+  case 0xCD: case 0xDD: case 0xED: case 0xFD: // CALL
+  case 0xC4: case 0xCC: case 0xD4: case 0xDC:
+  case 0xE4: case 0xEC: case 0xF4: case 0xFC: // Ccc
+    target = insn->operand;
+    conditional = (opcode & 1) == 0;
+    break;
+  case 0xC7: case 0xCF: case 0xD7: case 0xDF:
+  case 0xE7: case 0xEF: case 0xF7: case 0xFF: // RST
+    target = opcode & 0x38;
+    break;
+  case 0xC9: case 0xD9: // RET
+  case 0xE9: // PCHL
+    break;
+  case 0xC0: case 0xC8: case 0xD0: case 0xD8:
+  case 0xE0: case 0xE8: case 0xF0: case 0xF8: // Rcc
+    conditional = true;
+    break;
+  default: // the block ends because it is full or at the end of a page
+    i8080_jit_insn(a, jit, insn);
+    jit_store16_imm(a, offsetof(i8080, pc), next_pc);
+    jit_dispatch(a, jit, cache, next_pc);
+    return;
+  }
+
+  const int not_taken = jit_new_label(a);
+  if (conditional) {
+    jit_skip_unless(a, opcode, not_taken);
+  }
+
+  switch (opcode & 7) {
+  case 2: // JMP, Jcc
+  case 3:
+    break;
+  case 4: // CALL, Ccc, RST
+  case 5:
+  case 7:
+    jit_mov_imm(a, RDI, next_pc);
+    jit_push(a, jit, next_pc);
+    break;
+  case 0: // RET, Rcc
+  case 1:
+    if (opcode == 0xE9) { // PCHL
+      jit_get_pair(a, RAX, 2);
+    } else {
+      jit_pop(a, jit, next_pc);
+    }
+    jit_store16(a, offsetof(i8080, pc), RAX);
+    break;
+  }
+  if (target >= 0) {
+    jit_store16_imm(a, offsetof(i8080, pc), target);
+  }
+  // conditional calls and returns take 6 more cycles when taken
+  if ((opcode & 0xC7) == 0xC0 || (opcode & 0xC7) == 0xC4) {
+    jit_emit(a, 0x48); // add qword [rbx + cyc], 6
+    jit_emit(a, 0x83);
+    jit_mem(a, 0, offsetof(i8080, cyc));
+    jit_emit(a, 6);
+  }
+  jit_dispatch(a, jit, cache, target);
+
+  if (conditional) {
+    jit_bind(a, not_taken);
+    jit_store16_imm(a, offsetof(i8080, pc), next_pc);
+    jit_dispatch(a, jit, cache, next_pc);
+  }
+}
+
+// returns if an instruction reads or writes memory (and could call a
+// callback, or write to cached code)
+static bool i8080_jit_accesses_memory(uint8_t opcode) {
+  if ((opcode & 0xC0) == 0x40 || (opcode & 0xC0) == 0x80) {
+    return (opcode & 7) == 6 || (opcode & 0x38) == 0x30;
+  }
+  switch (opcode) {
+  case 0x34: case 0x35: case 0x36: // INR M, DCR M, MVI M
+  case 0x02: case 0x12: case 0x0A: case 0x1A: // STAX, LDAX
+  case 0x22: case 0x2A: case 0x32: case 0x3A: // SHLD, LHLD, STA, LDA
+  case 0xC1: case 0xD1: case 0xE1: case 0xF1: // POP
+  case 0xC5: case 0xD5: case 0xE5: case 0xF5: // PUSH
+  case 0xE3: case 0x27: return true; // XTHL, DAA
+  }
+  return false;
+}
+
+// appends the cold section to the main one and resolves the jumps. Returns
+// the size of the code.
+static size_t jit_link(jit_asm* a) {
+  uint8_t* const code = a->sections[MAIN].buf;
+  const size_t main_len = a->sections[MAIN].len;
+  memcpy(code + main_len, a->sections[COLD].buf, a->sections[COLD].len);
+
+  for (int i = 0; i < a->nb_fixups; i++) {
+    uint8_t* const pos = code + a->fixups[i].offset +
+                         (a->fixups[i].section == COLD ? main_len : 0);
+    const uint8_t* target = a->fixups[i].target;
+    if (a->fixups[i].label >= 0) {
+      const int label = a->fixups[i].label;
+      target = code + a->label_offsets[label] +
+               (a->label_sections[label] == COLD ? main_len : 0);
+    }
+    const int32_t rel = target - (pos + 4);
+    memcpy(pos, &rel, 4);
+  }
+
+  return main_len + a->sections[COLD].len;
+}
+
+// compiles a block, or returns NULL if it can't be
+static const uint8_t* i8080_jit_compile(
+    i8080_jit* jit, i8080_block_cache* cache, const i8080_block* block) {
+  if (!i8080_jit_supported(block)) {
+    return NULL;
+  }
+  jit_asm* const a = &jit->asm_;
+  uint8_t* const code = jit->buffer + jit->used;
+  jit_init_asm(a, code, JIT_MAX_CODE / 2, jit->cold, JIT_MAX_CODE / 2);
+
+  // the cycles and instructions of the whole block are counted upfront:
+  // add qword [rbx + cyc], cycles and add qword [rsp], nb_insns
+  jit_emit(a, 0x48);
+  jit_emit(a, 0x81);
+  jit_mem(a, 0, offsetof(i8080, cyc));
+  jit_emit32(a, block->cycles);
+  jit_emit(a, 0x48);
+  jit_emit(a, 0x83);
+  jit_emit(a, 0x04);
+  jit_emit(a, 0x24);
+  jit_emit(a, block->nb_insns);
+
+  for (int i = 0; i < block->nb_insns - 1; i++) {
+    const i8080_insn* insn = &block->insns[i];
+    i8080_jit_insn(a, jit, insn);
+
+    if (i8080_jit_accesses_memory(insn->opcode)) {
+      // test byte [rbx + events], 0xFF
+      const int event = jit_new_label(a);
+      jit_emit(a, 0xF6);
+      jit_mem(a, 0, offsetof(i8080, events));
+      jit_emit(a, 0xFF);
+      jit_jcc(a, CC_NZ, event);
+
+      // an event has been raised: gives back the cycles and the count of the
+      // instructions not executed, and leaves
+      a->section = COLD;
+      jit_bind(a, event);
+      jit_store16_imm(a, offsetof(i8080, pc), insn->next_pc);
+      jit_emit(a, 0x48); // sub qword [rbx + cyc], cycles_left
+      jit_emit(a, 0x81);
+      jit_mem(a, 5, offsetof(i8080, cyc));
+      jit_emit32(a, insn->cycles_left);
+      jit_emit(a, 0x48); // sub qword [rsp], nb_insns - (i + 1)
+      jit_emit(a, 0x83);
+      jit_emit(a, 0x2C);
+      jit_emit(a, 0x24);
+      jit_emit(a, block->nb_insns - (i + 1));
+      jit_emit(a, 0xE9); // jmp leave
+      jit_rel32(a, -1, jit->leave);
+      a->section = MAIN;
+    }
+  }
+  i8080_jit_last_insn(a, jit, cache, &block->insns[block->nb_insns - 1]);
+
+  if (a->overflow) {
+    return NULL;
+  }
+
+  jit->used += jit_link(a);
+  // keeps blocks aligned on 16 bytes
+  jit->used = (jit->used + 15) & ~(size_t) 15;
+  return code;
+}
+
+// emits the code shared by all the blocks, at the start of the buffer:
+// - `enter(c, block, deadline)`, called from C, loads the 8080 registers and
+//   jumps to a compiled block. It returns the number of instructions
+//   executed, counted in [rsp] (the deadline is in [rsp + 8]).
+// - `leave`, where blocks jump to return to C, saves the 8080 registers and
+//   returns the count.
+// - the trampolines to the memory helpers and to C functions, which preserve
+//   all the scratch registers but eax, and save and reload the 8080 registers
+//   around the call.
+static void i8080_jit_shared_code(i8080_jit* jit) {
+  jit_asm* const a = &jit->asm_;
+  jit_init_asm(a, jit->buffer, JIT_MAX_CODE, jit->cold, 0);
+
+  // enter: push rbx, rbp, r12-r15, reserves 24 bytes (which realigns the
+  // stack on 16 bytes), mov rbx, rdi, mov qword [rsp], 0 and
+  // mov [rsp + 8], rdx
+  static const uint8_t ENTER[] = {0x53, 0x55, 0x41, 0x54, 0x41, 0x55, 0x41,
+      0x56, 0x41, 0x57, 0x48, 0x83, 0xEC, 0x18, 0x48, 0x89, 0xFB, 0x48, 0xC7,
+      0x04, 0x24, 0x00, 0x00, 0x00, 0x00, 0x48, 0x89, 0x54, 0x24, 0x08};
+  void* const enter = jit->buffer;
+  memcpy(&jit->enter, &enter, sizeof(jit->enter));
+  for (size_t i = 0; i < sizeof(ENTER); i++) {
+    jit_emit(a, ENTER[i]);
+  }
+  jit_sync_regs(a, false);
+  jit_emit(a, 0xFF); // jmp rsi
+  jit_emit(a, 0xE6);
+
+  // leave: mov rax, [rsp], add rsp 24, pop r15-r12, rbp, rbx, ret
+  static const uint8_t LEAVE[] = {0x48, 0x8B, 0x04, 0x24, 0x48, 0x83, 0xC4,
+      0x18, 0x41, 0x5F, 0x41, 0x5E, 0x41, 0x5D, 0x41, 0x5C, 0x5D, 0x5B, 0xC3};
+  jit->leave = jit->buffer + a->sections[MAIN].len;
+  jit_sync_regs(a, true);
+  for (size_t i = 0; i < sizeof(LEAVE); i++) {
+    jit_emit(a, LEAVE[i]);
+  }
+
+  // trampolines
+  static const uintptr_t FUNCTIONS[3] = {
+      (uintptr_t) i8080_rb_slow, (uintptr_t) i8080_wb_slow, 0};
+  const uint8_t** const ENTRIES[3] = {
+      &jit->read_byte, &jit->write_byte, &jit->call};
+
+  for (int i = 0; i < 3; i++) {
+    *ENTRIES[i] = jit->buffer + a->sections[MAIN].len;
+
+    // push rcx, rdx, rsi, rdi
+    jit_emit(a, 0x51);
+    jit_emit(a, 0x52);
+    jit_emit(a, 0x56);
+    jit_emit(a, 0x57);
+    jit_sync_regs(a, true);
+    jit_emit(a, 0x48); // sub rsp, 8
+    jit_emit(a, 0x83);
+    jit_emit(a, 0xEC);
+    jit_emit(a, 0x08);
+    jit_emit(a, 0x48); // mov rdi, rbx
+    jit_emit(a, 0x89);
+    jit_emit(a, 0xDF);
+    if (i == 0 || i == 1) {
+      jit_movzx16(a, RSI, RDX);
+    }
+    if (i == 1) {
+      jit_movzx8(a, RDX, RAX);
+    }
+    if (FUNCTIONS[i] != 0) {
+      jit_emit(a, 0x48); // mov rax, function
+      jit_emit(a, 0xB8);
+      for (int j = 0; j < 8; j++) {
+        jit_emit(a, FUNCTIONS[i] >> (j * 8));
+      }
+    }
+    jit_emit(a, 0xFF); // call rax
+    jit_emit(a, 0xD0);
+    jit_movzx8(a, RAX, RAX);
+    jit_emit(a, 0x48); // add rsp, 8
+    jit_emit(a, 0x83);
+    jit_emit(a, 0xC4);
+    jit_emit(a, 0x08);
+    jit_sync_regs(a, false);
+    // pop rdi, rsi, rdx, rcx
+    jit_emit(a, 0x5F);
+    jit_emit(a, 0x5E);
+    jit_emit(a, 0x5A);
+    jit_emit(a, 0x59);
+    jit_emit(a, 0xC3);
+  }
+
+  jit->shared_size = (jit_link(a) + 15) & ~(size_t) 15;
+  jit->used = jit->shared_size;
+}
+
+// makes the pages of the buffer from `offset` to `offset + size` writable, or
+// executable. Returns false if it fails.
+static bool jit_protect(
+    i8080_jit* jit, size_t offset, size_t size, bool writable) {
+  const size_t page_size = sysconf(_SC_PAGESIZE);
+  const size_t start = offset & ~(page_size - 1);
+  size_t end = (offset + size + page_size - 1) & ~(page_size - 1);
+  if (end > JIT_BUFFER_SIZE) {
+    end = JIT_BUFFER_SIZE;
+  }
+  const int prot = writable ? PROT_READ | PROT_WRITE : PROT_READ | PROT_EXEC;
+  return mprotect(jit->buffer + start, end - start, prot) == 0;
+}
+
+// allocates the buffer, and emits the shared code
+static i8080_jit* i8080_jit_create(void) {
+  i8080_jit* jit = calloc(1, sizeof(i8080_jit));
+  if (jit == NULL) {
+    return NULL;
+  }
+
+  jit->buffer = mmap(NULL, JIT_BUFFER_SIZE, PROT_READ | PROT_WRITE,
+      MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (jit->buffer == MAP_FAILED) {
+    free(jit);
+    return NULL;
+  }
+
+  i8080_jit_shared_code(jit);
+  if (!jit_protect(jit, 0, JIT_BUFFER_SIZE, false)) {
+    munmap(jit->buffer, JIT_BUFFER_SIZE);
+    free(jit);
+    return NULL;
+  }
+  return jit;
+}
+
+static void i8080_jit_destroy(i8080_jit* jit) {
+  munmap(jit->buffer, JIT_BUFFER_SIZE);
+  free(jit);
+}
+
+// compiles a block which has been executed JIT_THRESHOLD times
+static void i8080_jit_hot_block(
+    i8080_block_cache* const cache, i8080_block* const block) {
+  i8080_jit* const jit = cache->jit;
+
+  if (JIT_BUFFER_SIZE - jit->used < JIT_MAX_CODE) {
+    // the buffer is full: starts again from scratch
+    for (int i = 0; i < CACHE_SIZE; i++) {
+      cache->blocks[i].native = NULL;
+      cache->blocks[i].hits = 0;
+    }
+    jit->used = jit->shared_size;
+  }
+
+  // the block is compiled to the JIT_MAX_CODE bytes after `used`
+  const size_t offset = jit->used;
+  if (!jit_protect(jit, offset, JIT_MAX_CODE, true)) {
+    return;
+  }
+  const uint8_t* const native = i8080_jit_compile(jit, cache, block);
+  if (!jit_protect(jit, offset, JIT_MAX_CODE, false)) {
+    // the compiled blocks can't be run anymore
+    for (int i = 0; i < CACHE_SIZE; i++) {
+      cache->blocks[i].native = NULL;
+    }
+    return;
+  }
+  block->native = native;
+  if (block->native != NULL) {
+    cache->stats.compilations += 1;
+  }
+}
+
+// runs a compiled block, and the compiled blocks which follow it until the
+// cycle `deadline` or an event. Returns the number of instructions executed.
+static unsigned long i8080_jit_run(i8080* const c, const i8080_block* block,
+    unsigned long deadline) {
+  i8080_sync_flags(c);
+  return c->cache->jit->enter(c, block->native, deadline);
+}
+
+#undef MAIN
+#undef COLD
+#undef ADD
+#undef OR
+#undef AND
+#undef SUB
+#undef XOR
+#undef CMP
+#undef SHL
+#undef SHR
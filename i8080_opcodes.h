@@ -0,0 +1,329 @@
+// opcode handlers of the interpreter, included by i8080.c in each of its
+// execution loops. The includer defines:
+// - OPCODE(op): start of the handler of `op`
+// - NEXT: end of a handler (goes on with the next instruction)
+// - IMM8 and IMM16: immediate byte and word operands of the instruction
+// and `c`, the i8080 being executed. The handlers are executed with the
+// opcode cycles already added to `c->cyc`.
+
+  OPCODE(0x7F) c->a = c->a; NEXT; // MOV A,A
+  OPCODE(0x78) c->a = c->b; NEXT; // MOV A,B
+  OPCODE(0x79) c->a = c->c; NEXT; // MOV A,C
+  OPCODE(0x7A) c->a = c->d; NEXT; // MOV A,D
+  OPCODE(0x7B) c->a = c->e; NEXT; // MOV A,E
+  OPCODE(0x7C) c->a = c->h; NEXT; // MOV A,H
+  OPCODE(0x7D) c->a = c->l; NEXT; // MOV A,L
+  OPCODE(0x7E) c->a = i8080_rb(c, i8080_get_hl(c)); NEXT; // MOV A,M
+
+  OPCODE(0x0A) c->a = i8080_rb(c, i8080_get_bc(c)); NEXT; // LDAX B
+  OPCODE(0x1A) c->a = i8080_rb(c, i8080_get_de(c)); NEXT; // LDAX D
+  OPCODE(0x3A) c->a = i8080_rb(c, IMM16); NEXT; // LDA word
+
+  OPCODE(0x47) c->b = c->a; NEXT; // MOV B,A
+  OPCODE(0x40) c->b = c->b; NEXT; // MOV B,B
+  OPCODE(0x41) c->b = c->c; NEXT; // MOV B,C
+  OPCODE(0x42) c->b = c->d; NEXT; // MOV B,D
+  OPCODE(0x43) c->b = c->e; NEXT; // MOV B,E
+  OPCODE(0x44) c->b = c->h; NEXT; // MOV B,H
+  OPCODE(0x45) c->b = c->l; NEXT; // MOV B,L
+  OPCODE(0x46) c->b = i8080_rb(c, i8080_get_hl(c)); NEXT; // MOV B,M
+
+  OPCODE(0x4F) c->c = c->a; NEXT; // MOV C,A
+  OPCODE(0x48) c->c = c->b; NEXT; // MOV C,B
+  OPCODE(0x49) c->c = c->c; NEXT; // MOV C,C
+  OPCODE(0x4A) c->c = c->d; NEXT; // MOV C,D
+  OPCODE(0x4B) c->c = c->e; NEXT; // MOV C,E
+  OPCODE(0x4C) c->c = c->h; NEXT; // MOV C,H
+  OPCODE(0x4D) c->c = c->l; NEXT; // MOV C,L
+  OPCODE(0x4E) c->c = i8080_rb(c, i8080_get_hl(c)); NEXT; // MOV C,M
+
+  OPCODE(0x57) c->d = c->a; NEXT; // MOV D,A
+  OPCODE(0x50) c->d = c->b; NEXT; // MOV D,B
+  OPCODE(0x51) c->d = c->c; NEXT; // MOV D,C
+  OPCODE(0x52) c->d = c->d; NEXT; // MOV D,D
+  OPCODE(0x53) c->d = c->e; NEXT; // MOV D,E
+  OPCODE(0x54) c->d = c->h; NEXT; // MOV D,H
+  OPCODE(0x55) c->d = c->l; NEXT; // MOV D,L
+  OPCODE(0x56) c->d = i8080_rb(c, i8080_get_hl(c)); NEXT; // MOV D,M
+
+  OPCODE(0x5F) c->e = c->a; NEXT; // MOV E,A
+  OPCODE(0x58) c->e = c->b; NEXT; // MOV E,B
+  OPCODE(0x59) c->e = c->c; NEXT; // MOV E,C
+  OPCODE(0x5A) c->e = c->d; NEXT; // MOV E,D
+  OPCODE(0x5B) c->e = c->e; NEXT; // MOV E,E
+  OPCODE(0x5C) c->e = c->h; NEXT; // MOV E,H
+  OPCODE(0x5D) c->e = c->l; NEXT; // MOV E,L
+  OPCODE(0x5E) c->e = i8080_rb(c, i8080_get_hl(c)); NEXT; // MOV E,M
+
+  OPCODE(0x67) c->h = c->a; NEXT; // MOV H,A
+  OPCODE(0x60) c->h = c->b; NEXT; // MOV H,B
+  OPCODE(0x61) c->h = c->c; NEXT; // MOV H,C
+  OPCODE(0x62) c->h = c->d; NEXT; // MOV H,D
+  OPCODE(0x63) c->h = c->e; NEXT; // MOV H,E
+  OPCODE(0x64) c->h = c->h; NEXT; // MOV H,H
+  OPCODE(0x65) c->h = c->l; NEXT; // MOV H,L
+  OPCODE(0x66) c->h = i8080_rb(c, i8080_get_hl(c)); NEXT; // MOV H,M
+
+  OPCODE(0x6F) c->l = c->a; NEXT; // MOV L,A
+  OPCODE(0x68) c->l = c->b; NEXT; // MOV L,B
+  OPCODE(0x69) c->l = c->c; NEXT; // MOV L,C
+  OPCODE(0x6A) c->l = c->d; NEXT; // MOV L,D
+  OPCODE(0x6B) c->l = c->e; NEXT; // MOV L,E
+  OPCODE(0x6C) c->l = c->h; NEXT; // MOV L,H
+  OPCODE(0x6D) c->l = c->l; NEXT; // MOV L,L
+  OPCODE(0x6E) c->l = i8080_rb(c, i8080_get_hl(c)); NEXT; // MOV L,M
+
+  OPCODE(0x77) i8080_wb(c, i8080_get_hl(c), c->a); NEXT; // MOV M,A
+  OPCODE(0x70) i8080_wb(c, i8080_get_hl(c), c->b); NEXT; // MOV M,B
+  OPCODE(0x71) i8080_wb(c, i8080_get_hl(c), c->c); NEXT; // MOV M,C
+  OPCODE(0x72) i8080_wb(c, i8080_get_hl(c), c->d); NEXT; // MOV M,D
+  OPCODE(0x73) i8080_wb(c, i8080_get_hl(c), c->e); NEXT; // MOV M,E
+  OPCODE(0x74) i8080_wb(c, i8080_get_hl(c), c->h); NEXT; // MOV M,H
+  OPCODE(0x75) i8080_wb(c, i8080_get_hl(c), c->l); NEXT; // MOV M,L
+
+  OPCODE(0x3E) c->a = IMM8; NEXT; // MVI A,byte
+  OPCODE(0x06) c->b = IMM8; NEXT; // MVI B,byte
+  OPCODE(0x0E) c->c = IMM8; NEXT; // MVI C,byte
+  OPCODE(0x16) c->d = IMM8; NEXT; // MVI D,byte
+  OPCODE(0x1E) c->e = IMM8; NEXT; // MVI E,byte
+  OPCODE(0x26) c->h = IMM8; NEXT; // MVI H,byte
+  OPCODE(0x2E) c->l = IMM8; NEXT; // MVI L,byte
+  OPCODE(0x36)
+    i8080_wb(c, i8080_get_hl(c), IMM8);
+    NEXT; // MVI M,byte
+
+  OPCODE(0x02) i8080_wb(c, i8080_get_bc(c), c->a); NEXT; // STAX B
+  OPCODE(0x12) i8080_wb(c, i8080_get_de(c), c->a); NEXT; // STAX D
+  OPCODE(0x32) i8080_wb(c, IMM16, c->a); NEXT; // STA word
+
+  OPCODE(0x01) i8080_set_bc(c, IMM16); NEXT; // LXI B,word
+  OPCODE(0x11) i8080_set_de(c, IMM16); NEXT; // LXI D,word
+  OPCODE(0x21) i8080_set_hl(c, IMM16); NEXT; // LXI H,word
+  OPCODE(0x31) c->sp = IMM16; NEXT; // LXI SP,word
+  OPCODE(0x2A) i8080_set_hl(c, i8080_rw(c, IMM16)); NEXT; // LHLD
+  OPCODE(0x22) i8080_ww(c, IMM16, i8080_get_hl(c)); NEXT; // SHLD
+  OPCODE(0xF9) c->sp = i8080_get_hl(c); NEXT; // SPHL
+
+  OPCODE(0xEB) i8080_xchg(c); NEXT; // XCHG
+  OPCODE(0xE3) i8080_xthl(c); NEXT; // XTHL
+
+  OPCODE(0x87) i8080_add(c, &c->a, c->a, 0); NEXT; // ADD A
+  OPCODE(0x80) i8080_add(c, &c->a, c->b, 0); NEXT; // ADD B
+  OPCODE(0x81) i8080_add(c, &c->a, c->c, 0); NEXT; // ADD C
+  OPCODE(0x82) i8080_add(c, &c->a, c->d, 0); NEXT; // ADD D
+  OPCODE(0x83) i8080_add(c, &c->a, c->e, 0); NEXT; // ADD E
+  OPCODE(0x84) i8080_add(c, &c->a, c->h, 0); NEXT; // ADD H
+  OPCODE(0x85) i8080_add(c, &c->a, c->l, 0); NEXT; // ADD L
+  OPCODE(0x86)
+    i8080_add(c, &c->a, i8080_rb(c, i8080_get_hl(c)), 0);
+    NEXT; // ADD M
+  OPCODE(0xC6) i8080_add(c, &c->a, IMM8, 0); NEXT; // ADI byte
+
+  OPCODE(0x8F) i8080_add(c, &c->a, c->a, c->f & I8080_CF); NEXT; // ADC A
+  OPCODE(0x88) i8080_add(c, &c->a, c->b, c->f & I8080_CF); NEXT; // ADC B
+  OPCODE(0x89) i8080_add(c, &c->a, c->c, c->f & I8080_CF); NEXT; // ADC C
+  OPCODE(0x8A) i8080_add(c, &c->a, c->d, c->f & I8080_CF); NEXT; // ADC D
+  OPCODE(0x8B) i8080_add(c, &c->a, c->e, c->f & I8080_CF); NEXT; // ADC E
+  OPCODE(0x8C) i8080_add(c, &c->a, c->h, c->f & I8080_CF); NEXT; // ADC H
+  OPCODE(0x8D) i8080_add(c, &c->a, c->l, c->f & I8080_CF); NEXT; // ADC L
+  OPCODE(0x8E)
+    i8080_add(c, &c->a, i8080_rb(c, i8080_get_hl(c)), c->f & I8080_CF);
+    NEXT; // ADC M
+  OPCODE(0xCE)
+    i8080_add(c, &c->a, IMM8, c->f & I8080_CF);
+    NEXT; // ACI byte
+
+  OPCODE(0x97) i8080_sub(c, &c->a, c->a, 0); NEXT; // SUB A
+  OPCODE(0x90) i8080_sub(c, &c->a, c->b, 0); NEXT; // SUB B
+  OPCODE(0x91) i8080_sub(c, &c->a, c->c, 0); NEXT; // SUB C
+  OPCODE(0x92) i8080_sub(c, &c->a, c->d, 0); NEXT; // SUB D
+  OPCODE(0x93) i8080_sub(c, &c->a, c->e, 0); NEXT; // SUB E
+  OPCODE(0x94) i8080_sub(c, &c->a, c->h, 0); NEXT; // SUB H
+  OPCODE(0x95) i8080_sub(c, &c->a, c->l, 0); NEXT; // SUB L
+  OPCODE(0x96)
+    i8080_sub(c, &c->a, i8080_rb(c, i8080_get_hl(c)), 0);
+    NEXT; // SUB M
+  OPCODE(0xD6) i8080_sub(c, &c->a, IMM8, 0); NEXT; // SUI byte
+
+  OPCODE(0x9F) i8080_sub(c, &c->a, c->a, c->f & I8080_CF); NEXT; // SBB A
+  OPCODE(0x98) i8080_sub(c, &c->a, c->b, c->f & I8080_CF); NEXT; // SBB B
+  OPCODE(0x99) i8080_sub(c, &c->a, c->c, c->f & I8080_CF); NEXT; // SBB C
+  OPCODE(0x9A) i8080_sub(c, &c->a, c->d, c->f & I8080_CF); NEXT; // SBB D
+  OPCODE(0x9B) i8080_sub(c, &c->a, c->e, c->f & I8080_CF); NEXT; // SBB E
+  OPCODE(0x9C) i8080_sub(c, &c->a, c->h, c->f & I8080_CF); NEXT; // SBB H
+  OPCODE(0x9D) i8080_sub(c, &c->a, c->l, c->f & I8080_CF); NEXT; // SBB L
+  OPCODE(0x9E)
+    i8080_sub(c, &c->a, i8080_rb(c, i8080_get_hl(c)), c->f & I8080_CF);
+    NEXT; // SBB M
+  OPCODE(0xDE)
+    i8080_sub(c, &c->a, IMM8, c->f & I8080_CF);
+    NEXT; // SBI byte
+
+  OPCODE(0x09) i8080_dad(c, i8080_get_bc(c)); NEXT; // DAD B
+  OPCODE(0x19) i8080_dad(c, i8080_get_de(c)); NEXT; // DAD D
+  OPCODE(0x29) i8080_dad(c, i8080_get_hl(c)); NEXT; // DAD H
+  OPCODE(0x39) i8080_dad(c, c->sp); NEXT; // DAD SP
+
+  OPCODE(0xF3) c->iff = 0; NEXT; // DI
+  OPCODE(0xFB)
+    c->iff = 1;
+    c->interrupt_delay = 1;
+    EVENTS_SET(c, EVENT_CHECK);
+    NEXT; // EI
+  OPCODE(0x00) NEXT; // NOP
+  OPCODE(0x76)
+    COUNT(c, halted_cycles, OPCODES_CYCLES[0x76]);
+    c->halted = 1;
+    EVENTS_SET(c, EVENT_CHECK);
+    NEXT; // HLT
+
+  OPCODE(0x3C) c->a = i8080_inr(c, c->a); NEXT; // INR A
+  OPCODE(0x04) c->b = i8080_inr(c, c->b); NEXT; // INR B
+  OPCODE(0x0C) c->c = i8080_inr(c, c->c); NEXT; // INR C
+  OPCODE(0x14) c->d = i8080_inr(c, c->d); NEXT; // INR D
+  OPCODE(0x1C) c->e = i8080_inr(c, c->e); NEXT; // INR E
+  OPCODE(0x24) c->h = i8080_inr(c, c->h); NEXT; // INR H
+  OPCODE(0x2C) c->l = i8080_inr(c, c->l); NEXT; // INR L
+  OPCODE(0x34)
+    i8080_wb(c, i8080_get_hl(c), i8080_inr(c, i8080_rb(c, i8080_get_hl(c))));
+    NEXT; // INR M
+
+  OPCODE(0x3D) c->a = i8080_dcr(c, c->a); NEXT; // DCR A
+  OPCODE(0x05) c->b = i8080_dcr(c, c->b); NEXT; // DCR B
+  OPCODE(0x0D) c->c = i8080_dcr(c, c->c); NEXT; // DCR C
+  OPCODE(0x15) c->d = i8080_dcr(c, c->d); NEXT; // DCR D
+  OPCODE(0x1D) c->e = i8080_dcr(c, c->e); NEXT; // DCR E
+  OPCODE(0x25) c->h = i8080_dcr(c, c->h); NEXT; // DCR H
+  OPCODE(0x2D) c->l = i8080_dcr(c, c->l); NEXT; // DCR L
+  OPCODE(0x35)
+    i8080_wb(c, i8080_get_hl(c), i8080_dcr(c, i8080_rb(c, i8080_get_hl(c))));
+    NEXT; // DCR M
+
+  OPCODE(0x03) i8080_set_bc(c, i8080_get_bc(c) + 1); NEXT; // INX B
+  OPCODE(0x13) i8080_set_de(c, i8080_get_de(c) + 1); NEXT; // INX D
+  OPCODE(0x23) i8080_set_hl(c, i8080_get_hl(c) + 1); NEXT; // INX H
+  OPCODE(0x33) c->sp += 1; NEXT; // INX SP
+
+  OPCODE(0x0B) i8080_set_bc(c, i8080_get_bc(c) - 1); NEXT; // DCX B
+  OPCODE(0x1B) i8080_set_de(c, i8080_get_de(c) - 1); NEXT; // DCX D
+  OPCODE(0x2B) i8080_set_hl(c, i8080_get_hl(c) - 1); NEXT; // DCX H
+  OPCODE(0x3B) c->sp -= 1; NEXT; // DCX SP
+
+  OPCODE(0x27) i8080_daa(c); NEXT; // DAA
+  OPCODE(0x2F) c->a = ~c->a; NEXT; // CMA
+  OPCODE(0x37) c->f |= I8080_CF; NEXT; // STC
+  OPCODE(0x3F) c->f ^= I8080_CF; NEXT; // CMC
+
+  OPCODE(0x07) i8080_rlc(c); NEXT; // RLC (rotate left)
+  OPCODE(0x0F) i8080_rrc(c); NEXT; // RRC (rotate right)
+  OPCODE(0x17) i8080_ral(c); NEXT; // RAL
+  OPCODE(0x1F) i8080_rar(c); NEXT; // RAR
+
+  OPCODE(0xA7) i8080_ana(c, c->a); NEXT; // ANA A
+  OPCODE(0xA0) i8080_ana(c, c->b); NEXT; // ANA B
+  OPCODE(0xA1) i8080_ana(c, c->c); NEXT; // ANA C
+  OPCODE(0xA2) i8080_ana(c, c->d); NEXT; // ANA D
+  OPCODE(0xA3) i8080_ana(c, c->e); NEXT; // ANA E
+  OPCODE(0xA4) i8080_ana(c, c->h); NEXT; // ANA H
+  OPCODE(0xA5) i8080_ana(c, c->l); NEXT; // ANA L
+  OPCODE(0xA6) i8080_ana(c, i8080_rb(c, i8080_get_hl(c))); NEXT; // ANA M
+  OPCODE(0xE6) i8080_ana(c, IMM8); NEXT; // ANI byte
+
+  OPCODE(0xAF) i8080_xra(c, c->a); NEXT; // XRA A
+  OPCODE(0xA8) i8080_xra(c, c->b); NEXT; // XRA B
+  OPCODE(0xA9) i8080_xra(c, c->c); NEXT; // XRA C
+  OPCODE(0xAA) i8080_xra(c, c->d); NEXT; // XRA D
+  OPCODE(0xAB) i8080_xra(c, c->e); NEXT; // XRA E
+  OPCODE(0xAC) i8080_xra(c, c->h); NEXT; // XRA H
+  OPCODE(0xAD) i8080_xra(c, c->l); NEXT; // XRA L
+  OPCODE(0xAE) i8080_xra(c, i8080_rb(c, i8080_get_hl(c))); NEXT; // XRA M
+  OPCODE(0xEE) i8080_xra(c, IMM8); NEXT; // XRI byte
+
+  OPCODE(0xB7) i8080_ora(c, c->a); NEXT; // ORA A
+  OPCODE(0xB0) i8080_ora(c, c->b); NEXT; // ORA B
+  OPCODE(0xB1) i8080_ora(c, c->c); NEXT; // ORA C
+  OPCODE(0xB2) i8080_ora(c, c->d); NEXT; // ORA D
+  OPCODE(0xB3) i8080_ora(c, c->e); NEXT; // ORA E
+  OPCODE(0xB4) i8080_ora(c, c->h); NEXT; // ORA H
+  OPCODE(0xB5) i8080_ora(c, c->l); NEXT; // ORA L
+  OPCODE(0xB6) i8080_ora(c, i8080_rb(c, i8080_get_hl(c))); NEXT; // ORA M
+  OPCODE(0xF6) i8080_ora(c, IMM8); NEXT; // ORI byte
+
+  OPCODE(0xBF) i8080_cmp(c, c->a); NEXT; // CMP A
+  OPCODE(0xB8) i8080_cmp(c, c->b); NEXT; // CMP B
+  OPCODE(0xB9) i8080_cmp(c, c->c); NEXT; // CMP C
+  OPCODE(0xBA) i8080_cmp(c, c->d); NEXT; // CMP D
+  OPCODE(0xBB) i8080_cmp(c, c->e); NEXT; // CMP E
+  OPCODE(0xBC) i8080_cmp(c, c->h); NEXT; // CMP H
+  OPCODE(0xBD) i8080_cmp(c, c->l); NEXT; // CMP L
+  OPCODE(0xBE) i8080_cmp(c, i8080_rb(c, i8080_get_hl(c))); NEXT; // CMP M
+  OPCODE(0xFE) i8080_cmp(c, IMM8); NEXT; // CPI byte
+
+  OPCODE(0xC3) i8080_jmp(c, IMM16); NEXT; // JMP
+  OPCODE(0xC2) i8080_cond_jmp(c, IMM16, !i8080_flag(c, I8080_ZF)); NEXT; // JNZ
+  OPCODE(0xCA) i8080_cond_jmp(c, IMM16, i8080_flag(c, I8080_ZF)); NEXT; // JZ
+  OPCODE(0xD2) i8080_cond_jmp(c, IMM16, !i8080_flag(c, I8080_CF)); NEXT; // JNC
+  OPCODE(0xDA) i8080_cond_jmp(c, IMM16, i8080_flag(c, I8080_CF)); NEXT; // JC
+  OPCODE(0xE2) i8080_cond_jmp(c, IMM16, !i8080_flag(c, I8080_PF)); NEXT; // JPO
+  OPCODE(0xEA) i8080_cond_jmp(c, IMM16, i8080_flag(c, I8080_PF)); NEXT; // JPE
+  OPCODE(0xF2) i8080_cond_jmp(c, IMM16, !i8080_flag(c, I8080_SF)); NEXT; // JP
+  OPCODE(0xFA) i8080_cond_jmp(c, IMM16, i8080_flag(c, I8080_SF)); NEXT; // JM
+
+  OPCODE(0xE9) c->pc = i8080_get_hl(c); NEXT; // PCHL
+  OPCODE(0xCD) i8080_call(c, IMM16); NEXT; // CALL
+
+  OPCODE(0xC4) i8080_cond_call(c, IMM16, !i8080_flag(c, I8080_ZF)); NEXT; // CNZ
+  OPCODE(0xCC) i8080_cond_call(c, IMM16, i8080_flag(c, I8080_ZF)); NEXT; // CZ
+  OPCODE(0xD4) i8080_cond_call(c, IMM16, !i8080_flag(c, I8080_CF)); NEXT; // CNC
+  OPCODE(0xDC) i8080_cond_call(c, IMM16, i8080_flag(c, I8080_CF)); NEXT; // CC
+  OPCODE(0xE4) i8080_cond_call(c, IMM16, !i8080_flag(c, I8080_PF)); NEXT; // CPO
+  OPCODE(0xEC) i8080_cond_call(c, IMM16, i8080_flag(c, I8080_PF)); NEXT; // CPE
+  OPCODE(0xF4) i8080_cond_call(c, IMM16, !i8080_flag(c, I8080_SF)); NEXT; // CP
+  OPCODE(0xFC) i8080_cond_call(c, IMM16, i8080_flag(c, I8080_SF)); NEXT; // CM
+
+  OPCODE(0xC9) i8080_ret(c); NEXT; // RET
+  OPCODE(0xC0) i8080_cond_ret(c, !i8080_flag(c, I8080_ZF)); NEXT; // RNZ
+  OPCODE(0xC8) i8080_cond_ret(c, i8080_flag(c, I8080_ZF)); NEXT; // RZ
+  OPCODE(0xD0) i8080_cond_ret(c, !i8080_flag(c, I8080_CF)); NEXT; // RNC
+  OPCODE(0xD8) i8080_cond_ret(c, i8080_flag(c, I8080_CF)); NEXT; // RC
+  OPCODE(0xE0) i8080_cond_ret(c, !i8080_flag(c, I8080_PF)); NEXT; // RPO
+  OPCODE(0xE8) i8080_cond_ret(c, i8080_flag(c, I8080_PF)); NEXT; // RPE
+  OPCODE(0xF0) i8080_cond_ret(c, !i8080_flag(c, I8080_SF)); NEXT; // RP
+  OPCODE(0xF8) i8080_cond_ret(c, i8080_flag(c, I8080_SF)); NEXT; // RM
+
+  OPCODE(0xC7) i8080_call(c, 0x00); NEXT; // RST 0
+  OPCODE(0xCF) i8080_call(c, 0x08); NEXT; // RST 1
+  OPCODE(0xD7) i8080_call(c, 0x10); NEXT; // RST 2
+  OPCODE(0xDF) i8080_call(c, 0x18); NEXT; // RST 3
+  OPCODE(0xE7) i8080_call(c, 0x20); NEXT; // RST 4
+  OPCODE(0xEF) i8080_call(c, 0x28); NEXT; // RST 5
+  OPCODE(0xF7) i8080_call(c, 0x30); NEXT; // RST 6
+  OPCODE(0xFF) i8080_call(c, 0x38); NEXT; // RST 7
+
+  OPCODE(0xC5) i8080_push_stack(c, i8080_get_bc(c)); NEXT; // PUSH B
+  OPCODE(0xD5) i8080_push_stack(c, i8080_get_de(c)); NEXT; // PUSH D
+  OPCODE(0xE5) i8080_push_stack(c, i8080_get_hl(c)); NEXT; // PUSH H
+  OPCODE(0xF5) i8080_push_psw(c); NEXT; // PUSH PSW
+  OPCODE(0xC1) i8080_set_bc(c, i8080_pop_stack(c)); NEXT; // POP B
+  OPCODE(0xD1) i8080_set_de(c, i8080_pop_stack(c)); NEXT; // POP D
+  OPCODE(0xE1) i8080_set_hl(c, i8080_pop_stack(c)); NEXT; // POP H
+  OPCODE(0xF1) i8080_pop_psw(c); NEXT; // POP PSW
+
+  OPCODE(0xDB) c->a = i8080_in(c, IMM8); NEXT; // IN
+  OPCODE(0xD3) i8080_out(c, IMM8, c->a); NEXT; // OUT
+
+  OPCODE(0x08)
+  OPCODE(0x10)
+  OPCODE(0x18)
+  OPCODE(0x20)
+  OPCODE(0x28)
+  OPCODE(0x30)
+  OPCODE(0x38) NEXT; // undocumented NOPs
+
+  OPCODE(0xD9) i8080_ret(c); NEXT; // undocumented RET
+
+  OPCODE(0xDD)
+  OPCODE(0xED)
+  OPCODE(0xFD) i8080_call(c, IMM16); NEXT; // undocumented CALLs
+
+  OPCODE(0xCB) i8080_jmp(c, IMM16); NEXT; // undocumented JMP
@@ -0,0 +1,323 @@
+// guest profiler, included by i8080.c: the interpreter adds the cycles of
+// each instruction to a histogram indexed by its address, the block cache
+// counts the executions of each block and adds them up when the block is
+// dropped or profiling stops. CALL, RST and RET (with their conditional
+// variants and interrupts) maintain a shadow call stack. Cycles are charged
+// to the subroutine running when they are spent, in a tree of calling
+// contexts: a subroutine gets one node per chain of callers it has been
+// called from.
+
+#ifdef I8080_PROFILER
+// charges the cycles spent since the last call or return to the subroutine
+// running
+static inline void i8080_profile_charge(
+    i8080_profile* const p, unsigned long cyc) {
+  p->nodes[p->stack[p->depth - 1]].cycles += cyc - p->last_cyc;
+  p->last_cyc = cyc;
+}
+
+// returns the node of `addr` called from `parent`, added to the tree on the
+// first call. Returns 0 if out of memory.
+static uint32_t i8080_profile_child(
+    i8080_profile* const p, uint32_t parent, uint16_t addr) {
+  for (uint32_t i = p->nodes[parent].child; i != 0; i = p->nodes[i].sibling) {
+    if (p->nodes[i].addr == addr) {
+      return i;
+    }
+  }
+
+  if (p->nb_nodes == p->capacity) {
+    const uint32_t capacity = p->capacity * 2;
+    i8080_profile_node* const nodes =
+        realloc(p->nodes, capacity * sizeof(i8080_profile_node));
+    if (nodes == NULL) {
+      return 0;
+    }
+    p->nodes = nodes;
+    p->capacity = capacity;
+  }
+
+  const uint32_t i = p->nb_nodes++;
+  i8080_profile_node* const node = &p->nodes[i];
+  node->addr = addr;
+  node->parent = parent;
+  node->child = 0;
+  node->sibling = p->nodes[parent].child;
+  node->calls = 0;
+  node->cycles = 0;
+  p->nodes[parent].child = i;
+  return i;
+}
+
+// adds the cycles of an instruction to the histogram
+static inline void i8080_profile_cycles(
+    i8080* const c, uint16_t addr, unsigned cycles) {
+  if (c->profile != NULL) {
+    c->profile->cycles[addr] += cycles;
+  }
+}
+
+// same for the first instruction run by i8080_execute, which is an
+// interrupt vector (not read at pc - 1) after i8080_next_opcode accepted an
+// interrupt: its cycles are charged to the instruction interrupted
+static inline void i8080_profile_first(i8080* const c, uint8_t opcode) {
+  i8080_profile* const p = c->profile;
+  if (p != NULL) {
+    p->cycles[(uint16_t) (c->pc - !p->interrupt)] += OPCODES_CYCLES[opcode];
+    p->interrupt = false;
+  }
+}
+
+static inline void i8080_profile_interrupt(i8080* const c) {
+  if (c->profile != NULL) {
+    c->profile->interrupt = true;
+  }
+}
+
+// counts executions of a block of the cache
+static inline void i8080_profile_block(
+    i8080* const c, i8080_block* const block, unsigned long runs) {
+  if (c->profile != NULL) {
+    block->runs += runs;
+  }
+}
+
+// takes back the cycles of the instructions of a block which haven't been
+// executed (from `insn` to `end`), the block being counted as a whole. The
+// histogram is only complete once the runs of the block are added to it.
+static void i8080_profile_partial(i8080* const c, const i8080_insn* insn,
+    const i8080_insn* const end) {
+  if (c->profile == NULL) {
+    return;
+  }
+  uint16_t addr = insn[-1].next_pc;
+  for (; insn < end; insn++) {
+    c->profile->cycles[addr] -= OPCODES_CYCLES[insn->opcode];
+    addr = insn->next_pc;
+  }
+}
+
+// adds the executions counted for a block to the histogram, before the
+// block is dropped
+static void i8080_profile_flush(i8080* const c, i8080_block* const block) {
+  if (block->runs == 0) {
+    return;
+  }
+  uint16_t addr = block->pc;
+  for (int i = 0; i < block->nb_insns; i++) {
+    const uint8_t opcode = block->insns[i].opcode;
+    c->profile->cycles[addr] += block->runs * OPCODES_CYCLES[opcode];
+    addr = block->insns[i].next_pc;
+  }
+  block->runs = 0;
+}
+
+static void i8080_profile_flush_cache(i8080* const c) {
+  if (c->profile != NULL && c->cache != NULL) {
+    for (int i = 0; i < CACHE_SIZE; i++) {
+      i8080_profile_flush(c, &c->cache->blocks[i]);
+    }
+  }
+}
+
+// pushes a call to `addr` (returning to pc) to the shadow call stack
+static void i8080_profile_call(i8080* const c, uint16_t addr) {
+  i8080_profile* const p = c->profile;
+  if (p == NULL) {
+    return;
+  }
+  i8080_profile_charge(p, c->cyc);
+
+  // calls made from an untracked call aren't tracked either
+  uint32_t node = 0;
+  if (p->pending == 0 && p->depth < I8080_PROFILE_DEPTH) {
+    node = i8080_profile_child(p, p->stack[p->depth - 1], addr);
+  }
+  if (node == 0) {
+    p->untracked += 1;
+    p->pending += 1;
+    return;
+  }
+
+  p->nodes[node].calls += 1;
+  p->stack[p->depth] = node;
+  p->returns[p->depth] = c->pc;
+  p->depth += 1;
+}
+
+// pops the shadow call stack down to the call returning to pc. Returns to
+// an address not on the stack (RET used as a jump) leave it as is, and
+// subroutines which drop their return address are popped when one of their
+// callers returns.
+static void i8080_profile_ret(i8080* const c) {
+  i8080_profile* const p = c->profile;
+  if (p == NULL) {
+    return;
+  }
+  i8080_profile_charge(p, c->cyc);
+
+  if (p->pending > 0) {
+    p->pending -= 1;
+    return;
+  }
+  for (int i = p->depth - 1; i > 0; i--) {
+    if (p->returns[i] == c->pc) {
+      p->depth = i;
+      return;
+    }
+  }
+}
+#endif
+
+// starts profiling the program run by an emulator, until i8080_profile_stop.
+// Returns NULL if out of memory, or if not built with I8080_PROFILER.
+i8080_profile* i8080_profile_start(i8080* const c) {
+#ifdef I8080_PROFILER
+  i8080_profile_stop(c);
+  i8080_profile* const p = calloc(1, sizeof(i8080_profile));
+  if (p == NULL) {
+    return NULL;
+  }
+  p->capacity = 256;
+  p->nodes = calloc(p->capacity, sizeof(i8080_profile_node));
+  if (p->nodes == NULL) {
+    free(p);
+    return NULL;
+  }
+
+  // the root node: the code running now, called from nowhere
+  p->nodes[0].addr = c->pc;
+  p->nb_nodes = 1;
+  p->stack[0] = 0;
+  p->depth = 1;
+  p->last_cyc = c->cyc;
+  c->profile = p;
+  return p;
+#else
+  (void) c;
+  return NULL;
+#endif
+}
+
+// stops profiling, and completes the histogram. The profile is still valid
+// until i8080_profile_free.
+void i8080_profile_stop(i8080* const c) {
+#ifdef I8080_PROFILER
+  if (c->profile != NULL) {
+    i8080_profile_flush_cache(c);
+    i8080_profile_charge(c->profile, c->cyc);
+    c->profile = NULL;
+  }
+#else
+  (void) c;
+#endif
+}
+
+// writes the cycles spent in each calling context as folded stacks, the
+// input of flame graph tools: one line per context, with the address of
+// each subroutine from the root separated by semicolons, then the exclusive
+// cycles (e.g. "0100;0B50;0005 1234"). Returns false on error.
+bool i8080_profile_write_folded(const i8080_profile* const p, FILE* f) {
+  uint16_t path[I8080_PROFILE_DEPTH];
+
+  for (uint32_t i = 0; i < p->nb_nodes; i++) {
+    if (p->nodes[i].cycles == 0) {
+      continue;
+    }
+
+    int depth = 0;
+    for (uint32_t node = i; node != 0; node = p->nodes[node].parent) {
+      path[depth++] = p->nodes[node].addr;
+    }
+    fprintf(f, "%04X", p->nodes[0].addr);
+    while (depth > 0) {
+      fprintf(f, ";%04X", path[--depth]);
+    }
+    fprintf(f, " %lu\n", p->nodes[i].cycles);
+  }
+  return !ferror(f);
+}
+
+typedef struct i8080_profile_routine {
+  uint16_t addr;
+  bool seen;
+  unsigned long calls, inclusive, exclusive;
+} i8080_profile_routine;
+
+// sorts routines by decreasing inclusive cycles
+static int i8080_profile_compare(const void* a, const void* b) {
+  const i8080_profile_routine* const x = a;
+  const i8080_profile_routine* const y = b;
+  if (x->inclusive != y->inclusive) {
+    return x->inclusive < y->inclusive ? 1 : -1;
+  }
+  return x->addr - y->addr;
+}
+
+// writes a table of the subroutines called, with their number of calls and
+// cycles spent, including and excluding their callees, sorted by inclusive
+// cycles. Returns false on error.
+bool i8080_profile_write_routines(const i8080_profile* const p, FILE* f) {
+  unsigned long* const totals = malloc(p->nb_nodes * sizeof(unsigned long));
+  i8080_profile_routine* const routines =
+      calloc(0x10000, sizeof(i8080_profile_routine));
+  if (totals == NULL || routines == NULL) {
+    free(totals);
+    free(routines);
+    return false;
+  }
+
+  // the inclusive cycles of a node are its own plus the ones of its
+  // subtree, and children are always after their parent in the array
+  for (uint32_t i = 0; i < p->nb_nodes; i++) {
+    totals[i] = p->nodes[i].cycles;
+  }
+  for (uint32_t i = p->nb_nodes - 1; i > 0; i--) {
+    totals[p->nodes[i].parent] += totals[i];
+  }
+
+  for (uint32_t i = 0; i < p->nb_nodes; i++) {
+    const i8080_profile_node* const node = &p->nodes[i];
+    i8080_profile_routine* const r = &routines[node->addr];
+    r->addr = node->addr;
+    r->seen = true;
+    r->calls += node->calls;
+    r->exclusive += node->cycles;
+
+    // recursive calls are already included in the outermost one
+    bool recursive = false;
+    for (uint32_t n = i; n != 0 && !recursive; n = p->nodes[n].parent) {
+      recursive = p->nodes[p->nodes[n].parent].addr == node->addr;
+    }
+    if (!recursive) {
+      r->inclusive += totals[i];
+    }
+  }
+
+  size_t nb_routines = 0;
+  for (size_t addr = 0; addr < 0x10000; addr++) {
+    if (routines[addr].seen) {
+      routines[nb_routines++] = routines[addr];
+    }
+  }
+  qsort(routines, nb_routines, sizeof(i8080_profile_routine),
+      i8080_profile_compare);
+
+  fprintf(f, "address        calls        inclusive        exclusive\n");
+  for (size_t i = 0; i < nb_routines; i++) {
+    const i8080_profile_routine* const r = &routines[i];
+    fprintf(f, "%04X    %12lu %16lu %16lu\n", r->addr, r->calls,
+        r->inclusive, r->exclusive);
+  }
+
+  free(totals);
+  free(routines);
+  return !ferror(f);
+}
+
+void i8080_profile_free(i8080_profile* const p) {
+  if (p != NULL) {
+    free(p->nodes);
+    free(p);
+  }
+}
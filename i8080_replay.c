@@ -0,0 +1,406 @@
+// record and replay: everything an emulator gets from outside (values read
+// from ports, interrupts) is logged with the cycle it happened at, so that
+// the run can be reproduced exactly by feeding the log back. The log is a
+// header followed by entries: a tag, the number of cycles since the previous
+// entry, then the data of the entry. Keyframes (save states with memory) are
+// written every few cycles, so that seeking only replays from the nearest
+// one. Memory-mapped io (read_byte) isn't recorded.
+
+#include <stdlib.h>
+#include <string.h>
+#include "i8080_replay.h"
+
+#define LOG_VERSION 1
+#define DEFAULT_KEYFRAME_CYCLES 10000000
+// cycles executed instruction by instruction before an entry: the block
+// cache can run past the end of a budget by a block, of I8080_BLOCK_SIZE
+// instructions of at most 18 cycles (XTHL)
+#define STEP_CYCLES (I8080_BLOCK_SIZE * 18)
+// the log is replayed with the cache between keyframes
+typedef char i8080_check_step_cycles[
+    STEP_CYCLES < DEFAULT_KEYFRAME_CYCLES ? 1 : -1];
+
+// entry tags
+#define TAG_END 0 // end of the log
+#define TAG_INPUT 1 // port, value returned by port_in
+#define TAG_INTERRUPT 2 // opcode passed to i8080_interrupt
+#define TAG_KEYFRAME 3 // size, save state
+
+// callbacks forwarded to the ones of the emulator (the recorder or replayer
+// is the userdata of the emulator, and starts with its callbacks)
+
+static uint8_t forward_read_byte(void* userdata, uint16_t addr) {
+  const i8080_callbacks* const cb = userdata;
+  return cb->read_byte(cb->userdata, addr);
+}
+
+static void forward_write_byte(void* userdata, uint16_t addr, uint8_t val) {
+  const i8080_callbacks* const cb = userdata;
+  cb->write_byte(cb->userdata, addr, val);
+}
+
+static void forward_port_out(void* userdata, uint8_t port, uint8_t value) {
+  const i8080_callbacks* const cb = userdata;
+  cb->port_out(cb->userdata, port, value);
+}
+
+// replaces the callbacks of the emulator, saving them in `cb`
+static void i8080_hook_callbacks(i8080* const c, i8080_callbacks* const cb,
+    uint8_t (*port_in)(void*, uint8_t)) {
+  cb->read_byte = c->read_byte;
+  cb->write_byte = c->write_byte;
+  cb->port_in = c->port_in;
+  cb->port_out = c->port_out;
+  cb->userdata = c->userdata;
+
+  c->read_byte = cb->read_byte != NULL ? forward_read_byte : NULL;
+  c->write_byte = cb->write_byte != NULL ? forward_write_byte : NULL;
+  c->port_in = port_in;
+  c->port_out = cb->port_out != NULL ? forward_port_out : NULL;
+  c->userdata = cb;
+}
+
+static void i8080_unhook_callbacks(i8080* const c, const i8080_callbacks* cb) {
+  c->read_byte = cb->read_byte;
+  c->write_byte = cb->write_byte;
+  c->port_in = cb->port_in;
+  c->port_out = cb->port_out;
+  c->userdata = cb->userdata;
+}
+
+// recorder
+
+// numbers are written 7 bits at a time, low bits first
+static void i8080_write_number(FILE* f, unsigned long n) {
+  while (n >= 0x80) {
+    fputc((n & 0x7F) | 0x80, f);
+    n >>= 7;
+  }
+  fputc(n, f);
+}
+
+static void i8080_write_entry(i8080_recorder* const r, int tag) {
+  fputc(tag, r->file);
+  i8080_write_number(r->file, r->cpu->cyc - r->last_cyc);
+  r->last_cyc = r->cpu->cyc;
+}
+
+static void i8080_write_keyframe(i8080_recorder* const r) {
+  const size_t size = i8080_save_state(
+      r->cpu, r->state, I8080_STATE_MEMORY_SIZE, true);
+  i8080_write_entry(r, TAG_KEYFRAME);
+  i8080_write_number(r->file, size);
+  fwrite(r->state, 1, size, r->file);
+}
+
+static uint8_t record_port_in(void* userdata, uint8_t port) {
+  i8080_recorder* const r = userdata;
+  const uint8_t value = r->callbacks.port_in(r->callbacks.userdata, port);
+  i8080_write_entry(r, TAG_INPUT);
+  fputc(port, r->file);
+  fputc(value, r->file);
+  return value;
+}
+
+// starts recording the inputs of an emulator to `f` (the callbacks of the
+// emulator keep being called), with a keyframe every `cycles` cycles (0 for
+// the default). Returns false if out of memory.
+bool i8080_record_start(
+    i8080_recorder* const r, i8080* const c, FILE* f, unsigned long cycles) {
+  r->state = malloc(I8080_STATE_MEMORY_SIZE);
+  if (r->state == NULL) {
+    return false;
+  }
+
+  r->cpu = c;
+  r->file = f;
+  r->keyframe_cycles = cycles != 0 ? cycles : DEFAULT_KEYFRAME_CYCLES;
+  r->next_keyframe = c->cyc + r->keyframe_cycles;
+  r->last_cyc = 0;
+  i8080_hook_callbacks(c, &r->callbacks, record_port_in);
+
+  fwrite("8080LOG", 1, 7, f);
+  fputc(LOG_VERSION, f);
+  i8080_write_keyframe(r);
+  return true;
+}
+
+// same as i8080_run, recording the inputs and the keyframes
+i8080_run_result i8080_record_run(
+    i8080_recorder* const r, unsigned long cycles) {
+  i8080* const c = r->cpu;
+  i8080_run_result result = {0, 0, I8080_RUN_BUDGET};
+  const unsigned long start = c->cyc;
+
+  while (c->cyc - start < cycles) {
+    if (c->cyc >= r->next_keyframe) {
+      i8080_write_keyframe(r);
+      r->next_keyframe = c->cyc + r->keyframe_cycles;
+    }
+
+    unsigned long budget = cycles - (c->cyc - start);
+    if (r->next_keyframe - c->cyc < budget) {
+      budget = r->next_keyframe - c->cyc;
+    }
+
+    const i8080_run_result run = i8080_run(c, budget);
+    result.instructions += run.instructions;
+    if (run.reason != I8080_RUN_BUDGET) {
+      result.reason = run.reason;
+      break;
+    }
+  }
+
+  result.cycles = c->cyc - start;
+  return result;
+}
+
+// same as i8080_interrupt, recording the interrupt
+void i8080_record_interrupt(i8080_recorder* const r, uint8_t opcode) {
+  i8080_write_entry(r, TAG_INTERRUPT);
+  fputc(opcode, r->file);
+  i8080_interrupt(r->cpu, opcode);
+}
+
+// stops recording: the emulator gets its callbacks back
+void i8080_record_stop(i8080_recorder* const r) {
+  i8080_unhook_callbacks(r->cpu, &r->callbacks);
+  fflush(r->file);
+  free(r->state);
+  r->state = NULL;
+}
+
+// replayer
+
+// reads a number at `*pos`, returns false past the end of the log
+static bool i8080_read_number(
+    const i8080_replayer* const r, size_t* pos, unsigned long* n) {
+  *n = 0;
+  for (int shift = 0; *pos < r->log_size; shift += 7) {
+    const uint8_t byte = r->log[(*pos)++];
+    *n |= (unsigned long) (byte & 0x7F) << shift;
+    if (!(byte & 0x80)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// moves to the entry after the current one
+static void i8080_next_entry(i8080_replayer* const r) {
+  size_t pos = r->pos;
+  unsigned long n;
+
+  if (r->tag == TAG_INPUT) {
+    pos += 2;
+  } else if (r->tag == TAG_INTERRUPT) {
+    pos += 1;
+  } else if (r->tag == TAG_KEYFRAME && i8080_read_number(r, &pos, &n)) {
+    pos += n;
+  }
+
+  r->tag = TAG_END;
+  if (pos < r->log_size) {
+    const int tag = r->log[pos];
+    size_t data = pos + 1;
+    // the data of the entry must be in the log
+    const size_t size = tag == TAG_INPUT ? 2 : 1;
+    if (i8080_read_number(r, &data, &n) && data + size <= r->log_size) {
+      r->tag = tag;
+      r->cyc += n;
+      pos = data;
+    }
+  }
+  r->pos = pos;
+}
+
+// restores a keyframe, returns false if the log is corrupted
+static bool i8080_load_keyframe(
+    i8080_replayer* const r, const i8080_keyframe* const k) {
+  size_t pos = k->pos;
+  unsigned long size;
+  if (!i8080_read_number(r, &pos, &size) || size > r->log_size - pos ||
+      i8080_load_state(r->cpu, &r->log[pos], size) == 0) {
+    return false;
+  }
+
+  r->tag = TAG_KEYFRAME;
+  r->cyc = k->cyc;
+  r->pos = k->pos;
+  i8080_next_entry(r);
+  return true;
+}
+
+static uint8_t replay_port_in(void* userdata, uint8_t port) {
+  i8080_replayer* const r = userdata;
+  if (r->tag != TAG_INPUT || r->log[r->pos] != port ||
+      r->cyc != r->cpu->cyc) {
+    r->diverged = true;
+    return 0x00;
+  }
+
+  const uint8_t value = r->log[r->pos + 1];
+  i8080_next_entry(r);
+  r->input_read = true;
+
+  // i8080_replay_run has to send the interrupt or reach the keyframe on time
+  if (!r->stepping && (r->tag == TAG_INTERRUPT || r->tag == TAG_KEYFRAME)) {
+    i8080_stop(r->cpu);
+  }
+  return value;
+}
+
+// reads a log written by the recorder from `f`, and restores the emulator
+// to the start of the recording (the callbacks of the emulator are still
+// called, but port_in). Returns false if out of memory or if `f` doesn't
+// hold a log.
+bool i8080_replay_start(i8080_replayer* const r, i8080* const c, FILE* f) {
+  memset(r, 0, sizeof(i8080_replayer));
+  r->cpu = c;
+
+  size_t capacity = 0;
+  do {
+    if (r->log_size == capacity) {
+      capacity = capacity * 2 + 0x10000;
+      uint8_t* const log = realloc(r->log, capacity);
+      if (log == NULL) {
+        free(r->log);
+        return false;
+      }
+      r->log = log;
+    }
+    r->log_size += fread(&r->log[r->log_size], 1, capacity - r->log_size, f);
+  } while (r->log_size == capacity);
+
+  if (r->log_size < 8 || memcmp(r->log, "8080LOG", 7) != 0 ||
+      r->log[7] != LOG_VERSION) {
+    free(r->log);
+    return false;
+  }
+
+  // finds the keyframes (the first entry is always one)
+  r->tag = TAG_END;
+  r->pos = 8;
+  r->cyc = 0;
+  for (i8080_next_entry(r); r->tag != TAG_END; i8080_next_entry(r)) {
+    if (r->tag != TAG_KEYFRAME) {
+      continue;
+    }
+    if ((r->nb_keyframes & (r->nb_keyframes + 1)) == 0) {
+      i8080_keyframe* const keyframes = realloc(r->keyframes,
+          (r->nb_keyframes * 2 + 1) * sizeof(i8080_keyframe));
+      if (keyframes == NULL) {
+        i8080_replay_stop(r);
+        return false;
+      }
+      r->keyframes = keyframes;
+    }
+    r->keyframes[r->nb_keyframes].pos = r->pos;
+    r->keyframes[r->nb_keyframes].cyc = r->cyc;
+    r->nb_keyframes += 1;
+  }
+
+  if (r->nb_keyframes == 0 || !i8080_load_keyframe(r, &r->keyframes[0])) {
+    i8080_replay_stop(r);
+    return false;
+  }
+
+  i8080_hook_callbacks(c, &r->callbacks, replay_port_in);
+  return true;
+}
+
+// same as i8080_run, with the inputs of the log. Runs until `cycles` cycles
+// have been spent (stopping at the same instruction whether the block cache
+// is enabled or not), the emulator is stopped (by a callback) or halted with
+// no interrupt left in the log.
+i8080_run_result i8080_replay_run(
+    i8080_replayer* const r, unsigned long cycles) {
+  i8080* const c = r->cpu;
+  i8080_run_result result = {0, 0, I8080_RUN_BUDGET};
+  const unsigned long start = c->cyc;
+
+  while (c->cyc - start < cycles) {
+    const bool timed = r->tag == TAG_INTERRUPT || r->tag == TAG_KEYFRAME;
+    if (timed && r->cyc <= c->cyc) {
+      if (r->tag == TAG_INTERRUPT) {
+        i8080_interrupt(c, r->log[r->pos]);
+      }
+      i8080_next_entry(r);
+      continue;
+    }
+
+    unsigned long budget = cycles - (c->cyc - start);
+    if (timed && r->cyc - c->cyc < budget) {
+      budget = r->cyc - c->cyc;
+    }
+
+    // the block cache only stops at the end of a block: the last cycles
+    // before an entry (or the end of the run) are executed instruction by
+    // instruction, to stop at the same instruction as when recording
+    if (budget <= STEP_CYCLES) {
+      const unsigned long cyc = c->cyc;
+      r->stepping = true;
+      i8080_step(c);
+      r->stepping = false;
+      if (c->cyc == cyc) {
+        result.reason = I8080_RUN_HALTED;
+        break;
+      }
+      result.instructions += 1;
+      continue;
+    }
+
+    r->input_read = false;
+    const i8080_run_result run = i8080_run(c, budget - STEP_CYCLES);
+    result.instructions += run.instructions;
+    if (run.reason == I8080_RUN_STOPPED && r->input_read) {
+      continue; // stopped by replay_port_in
+    }
+    if (run.reason != I8080_RUN_BUDGET) {
+      result.reason = run.reason;
+      break;
+    }
+  }
+
+  result.cycles = c->cyc - start;
+  return result;
+}
+
+// restores the emulator to the nearest keyframe before cycle `cyc` then
+// replays the log from there until `cyc`. Returns false if it can't be
+// reached.
+bool i8080_replay_seek(i8080_replayer* const r, unsigned long cyc) {
+  size_t first = 0, last = r->nb_keyframes;
+  while (last - first > 1) {
+    const size_t middle = (first + last) / 2;
+    if (r->keyframes[middle].cyc <= cyc) {
+      first = middle;
+    } else {
+      last = middle;
+    }
+  }
+
+  if (!i8080_load_keyframe(r, &r->keyframes[first])) {
+    return false;
+  }
+
+  while (r->cpu->cyc < cyc) {
+    const i8080_run_result result =
+        i8080_replay_run(r, cyc - r->cpu->cyc);
+    if (result.reason != I8080_RUN_BUDGET) {
+      return r->cpu->cyc >= cyc;
+    }
+  }
+  return true;
+}
+
+// stops replaying: the emulator gets its callbacks back
+void i8080_replay_stop(i8080_replayer* const r) {
+  if (r->cpu->userdata == &r->callbacks) {
+    i8080_unhook_callbacks(r->cpu, &r->callbacks);
+  }
+  free(r->log);
+  free(r->keyframes);
+  r->log = NULL;
+  r->keyframes = NULL;
+}
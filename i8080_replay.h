@@ -0,0 +1,64 @@
+#ifndef I8080_I8080_REPLAY_H_
+#define I8080_I8080_REPLAY_H_
+
+#include "i8080.h"
+
+// callbacks and userdata of the emulator, called by the recorder/replayer
+typedef struct i8080_callbacks {
+  uint8_t (*read_byte)(void*, uint16_t);
+  void (*write_byte)(void*, uint16_t, uint8_t);
+  uint8_t (*port_in)(void*, uint8_t);
+  void (*port_out)(void*, uint8_t, uint8_t);
+  void* userdata;
+} i8080_callbacks;
+
+// records the inputs of an emulator (values read from ports, interrupts) to
+// a log, with keyframes (save states) every `keyframe_cycles` cycles
+typedef struct i8080_recorder {
+  i8080_callbacks callbacks; // first, to be found from the userdata
+  i8080* cpu;
+  FILE* file;
+  unsigned long keyframe_cycles;
+  unsigned long next_keyframe; // cycle of the next keyframe
+  unsigned long last_cyc; // cycle of the last entry written
+  uint8_t* state; // buffer of the keyframes
+} i8080_recorder;
+
+// position of a keyframe in a log
+typedef struct i8080_keyframe {
+  size_t pos;
+  unsigned long cyc;
+} i8080_keyframe;
+
+// feeds a log back to an emulator
+typedef struct i8080_replayer {
+  i8080_callbacks callbacks; // first, to be found from the userdata
+  i8080* cpu;
+  uint8_t* log;
+  size_t log_size;
+  i8080_keyframe* keyframes;
+  size_t nb_keyframes;
+
+  // next entry of the log
+  int tag;
+  unsigned long cyc;
+  size_t pos; // of its data
+  bool input_read; // an entry has been consumed by port_in
+  bool stepping; // instructions are executed one by one
+  bool diverged; // ports were read differently than when recording
+} i8080_replayer;
+
+bool i8080_record_start(
+    i8080_recorder* const r, i8080* const c, FILE* f, unsigned long cycles);
+i8080_run_result i8080_record_run(
+    i8080_recorder* const r, unsigned long cycles);
+void i8080_record_interrupt(i8080_recorder* const r, uint8_t opcode);
+void i8080_record_stop(i8080_recorder* const r);
+
+bool i8080_replay_start(i8080_replayer* const r, i8080* const c, FILE* f);
+i8080_run_result i8080_replay_run(
+    i8080_replayer* const r, unsigned long cycles);
+bool i8080_replay_seek(i8080_replayer* const r, unsigned long cyc);
+void i8080_replay_stop(i8080_replayer* const r);
+
+#endif // I8080_I8080_REPLAY_H_
@@ -1,23 +1,74 @@
 // This file uses the 8080 emulator to run the test suite (roms in cpu_tests
-// directory). It uses a simple array as memory.
+// directory). Each test has a simple array as memory, and the tests are run
+// in parallel (see i8080_batch.h). The cases of the exerciser are independent
+// of each other, so they are run in parallel too, one per instance (see
+// shard_test). The wide mode is then checked against the interpreter (see
+// check_wide), and the rest of the api (see CHECKS).
 
+#include <limits.h>
+#include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
 #include "i8080.h"
+#include "i8080_batch.h"
+#ifdef I8080_AOT
+#include "i8080_aot.h"
+#else
+#include "i8080_replay.h"
+#endif
 
-// memory callbacks
 #define MEMORY_SIZE 0x10000
-static uint8_t* memory = NULL;
-static bool test_finished = 0;
+#define NB_TESTS 4
+#define EXIT_SKIPPED 77 // the engine isn't available in this build
+
+// engine the tests run on (-e): "interpreter", "cache", "jit", or NULL for
+// the jit where it is supported and the block cache otherwise
+static const char* engine = NULL;
+
+typedef struct test {
+  const char* filename;
+  unsigned long cyc_expected;
+  bool sharded; // test cases run by different instances (see shard_test)
+  i8080 cpu;
+  uint8_t* memory;
+  bool loaded;
+  unsigned long instructions;
 
+  // what the test printed, output once all the tests are done
+  char* output;
+  size_t output_size, output_capacity;
+  size_t banner_size; // output of the first BDOS call
+
+  // instances of a sharded test: shards[0] runs none of its cases, and
+  // shards[n] only the case n
+  struct test* shards;
+  int nb_shards;
+} test;
+
+// memory callbacks
 static uint8_t rb(void* userdata, uint16_t addr) {
-  return memory[addr];
+  test* const t = (test*) userdata;
+  return t->memory[addr];
 }
 
 static void wb(void* userdata, uint16_t addr, uint8_t val) {
-  memory[addr] = val;
+  test* const t = (test*) userdata;
+  t->memory[addr] = val;
+}
+
+static void print_char(test* const t, char ch) {
+  if (t->output_size == t->output_capacity) {
+    const size_t capacity = t->output_capacity * 2 + 256;
+    char* const output = realloc(t->output, capacity);
+    if (output == NULL) {
+      return;
+    }
+    t->output = output;
+    t->output_capacity = capacity;
+  }
+  t->output[t->output_size++] = ch;
 }
 
 static uint8_t port_in(void* userdata, uint8_t port) {
@@ -25,28 +76,32 @@ static uint8_t port_in(void* userdata, uint8_t port) {
 }
 
 static void port_out(void* userdata, uint8_t port, uint8_t value) {
-  i8080* const c = (i8080*) userdata;
+  test* const t = (test*) userdata;
+  i8080* const c = &t->cpu;
 
   if (port == 0) {
-    test_finished = 1;
+    i8080_stop(c);
   } else if (port == 1) {
     uint8_t operation = c->c;
 
     if (operation == 2) { // print a character stored in E
-      printf("%c", c->e);
+      print_char(t, c->e);
     } else if (operation == 9) { // print from memory at (DE) until '$' char
       uint16_t addr = (c->d << 8) | c->e;
       do {
-        printf("%c", rb(c, addr++));
-      } while (rb(c, addr) != '$');
+        print_char(t, rb(t, addr++));
+      } while (rb(t, addr) != '$');
+    }
+    if (t->banner_size == 0) {
+      t->banner_size = t->output_size;
     }
   }
 }
 
-static inline int load_file(const char* filename, uint16_t addr) {
-  FILE* f = fopen(filename, "rb");
+static inline int load_file(test* const t, uint16_t addr) {
+  FILE* f = fopen(t->filename, "rb");
   if (f == NULL) {
-    fprintf(stderr, "error: can't open file '%s'.\n", filename);
+    fprintf(stderr, "error: can't open file '%s'.\n", t->filename);
     return 1;
   }
 
@@ -56,14 +111,14 @@ static inline int load_file(const char* filename, uint16_t addr) {
   rewind(f);
 
   if (file_size + addr >= MEMORY_SIZE) {
-    fprintf(stderr, "error: file %s can't fit in memory.\n", filename);
+    fprintf(stderr, "error: file %s can't fit in memory.\n", t->filename);
     return 1;
   }
 
   // copying the bytes in memory:
-  size_t result = fread(&memory[addr], sizeof(uint8_t), file_size, f);
+  size_t result = fread(&t->memory[addr], sizeof(uint8_t), file_size, f);
   if (result != file_size) {
-    fprintf(stderr, "error: while reading file '%s'\n", filename);
+    fprintf(stderr, "error: while reading file '%s'\n", t->filename);
     return 1;
   }
 
@@ -71,64 +126,1281 @@ static inline int load_file(const char* filename, uint16_t addr) {
   return 0;
 }
 
-static inline void run_test(
-    i8080* const c, const char* filename, unsigned long cyc_expected) {
+// enables an engine ("interpreter", "cache", "jit", or NULL for the default
+// one: see `engine`), returns false if it isn't available
+static bool enable_engine(i8080* const c, const char* name) {
+  if (name == NULL) {
+    // instructions are decoded once in the block cache, and hot blocks are
+    // compiled to native code where the jit is supported
+    return i8080_enable_jit(c) || i8080_enable_cache(c);
+  } else if (strcmp(name, "cache") == 0) {
+    return i8080_enable_cache(c);
+  } else if (strcmp(name, "jit") == 0) {
+    return i8080_enable_jit(c);
+  }
+  return strcmp(name, "interpreter") == 0;
+}
+
+// prepares a test to be run, returns false on error
+static inline bool load_test(test* const t) {
+  i8080* const c = &t->cpu;
   i8080_init(c);
-  c->userdata = c;
+  c->userdata = t;
   c->read_byte = rb;
   c->write_byte = wb;
   c->port_in = port_in;
   c->port_out = port_out;
-  memset(memory, 0, MEMORY_SIZE);
+  memset(t->memory, 0, MEMORY_SIZE);
 
-  if (load_file(filename, 0x100) != 0) {
-    return;
+  // the memory is a flat array: the cpu can access it directly, without
+  // going through rb/wb
+  i8080_map_ram(c, 0x0000, MEMORY_SIZE, t->memory);
+
+  if (load_file(t, 0x100) != 0) {
+    return false;
+  }
+
+#ifndef I8080_AOT
+  if (!enable_engine(c, engine)) {
+    fprintf(stderr, "error: can't allocate the block cache.\n");
+    return false;
   }
-  printf("*** TEST: %s\n", filename);
+#endif
 
   c->pc = 0x100;
 
   // inject "out 0,a" at 0x0000 (signal to stop the test)
-  memory[0x0000] = 0xD3;
-  memory[0x0001] = 0x00;
+  t->memory[0x0000] = 0xD3;
+  t->memory[0x0001] = 0x00;
 
   // inject "out 1,a" at 0x0005 (signal to output some characters)
-  memory[0x0005] = 0xD3;
-  memory[0x0006] = 0x01;
-  memory[0x0007] = 0xC9;
+  t->memory[0x0005] = 0xD3;
+  t->memory[0x0006] = 0x01;
+  t->memory[0x0007] = 0xC9;
+
+  return true;
+}
+
+// returns the address of the table of test cases of the exerciser, or 0: the
+// main loop starts with "lxi h,table; mov a,m; inx h; ora m; jz done", and
+// the table is a list of addresses ending with 0
+static uint16_t find_cases(const test* const t) {
+  static const uint8_t loop[] = {0x7E, 0x23, 0xB6, 0xCA};
+  for (uint32_t addr = 0x103; addr + sizeof(loop) < MEMORY_SIZE; addr++) {
+    if (t->memory[addr - 3] == 0x21 &&
+        memcmp(&t->memory[addr], loop, sizeof(loop)) == 0) {
+      return t->memory[addr - 2] | t->memory[addr - 1] << 8;
+    }
+  }
+  return 0;
+}
+
+// makes an instance of a test for each of its cases, which only has this
+// case in its table, and one with an empty table. Each case costs as much
+// as it would in the whole test, so its cycles and instructions add up once
+// those of the empty instance (banner, main loop and exit) are subtracted.
+// Returns false if the test can't be sharded.
+static bool shard_test(test* const t) {
+  const uint16_t table = find_cases(t);
+  if (table == 0) {
+    return false;
+  }
+  int nb_cases = 0;
+  while (table + nb_cases * 2 + 1 < MEMORY_SIZE &&
+         (t->memory[table + nb_cases * 2] != 0 ||
+             t->memory[table + nb_cases * 2 + 1] != 0)) {
+    nb_cases += 1;
+  }
+  if (nb_cases == 0) {
+    return false;
+  }
 
-  long nb_instructions = 0;
+  t->shards = calloc(nb_cases + 1, sizeof(test));
+  if (t->shards == NULL) {
+    return false;
+  }
+  for (int i = 0; i <= nb_cases; i++) {
+    test* const shard = &t->shards[i];
+    shard->filename = t->filename;
+    shard->memory = malloc(MEMORY_SIZE);
+    t->nb_shards += 1;
+    if (shard->memory == NULL || !load_test(shard)) {
+      return false;
+    }
+    const uint16_t entry = table + (i - 1) * 2;
+    shard->memory[table] = i == 0 ? 0 : t->memory[entry];
+    shard->memory[table + 1] = i == 0 ? 0 : t->memory[entry + 1];
+    shard->memory[table + 2] = 0;
+    shard->memory[table + 3] = 0;
+  }
+  return true;
+}
 
-  test_finished = 0;
-  while (!test_finished) {
-    nb_instructions += 1;
+// adds the cycles, instructions and output of the cases of a sharded test
+// as if it had run them all
+static void merge_shards(test* const t) {
+  const test* const base = &t->shards[0];
+  const size_t end_size = base->output_size - base->banner_size;
+  t->cpu.cyc = base->cpu.cyc;
+  t->instructions = base->instructions;
+  t->output_size = 0;
+  for (size_t i = 0; i < base->banner_size; i++) {
+    print_char(t, base->output[i]);
+  }
+
+  for (int i = 1; i < t->nb_shards; i++) {
+    const test* const shard = &t->shards[i];
+    t->cpu.cyc += shard->cpu.cyc - base->cpu.cyc;
+    t->instructions += shard->instructions - base->instructions;
+    for (size_t k = shard->banner_size; k < shard->output_size - end_size;
+         k++) {
+      print_char(t, shard->output[k]);
+    }
+  }
 
-    // uncomment following line to have a debug output of machine state
-    // warning: will output multiple GB of data for the whole test suite
-    // i8080_debug_output(c, false);
+  for (size_t i = base->banner_size; i < base->output_size; i++) {
+    print_char(t, base->output[i]);
+  }
+}
 
-    i8080_step(c);
+#ifdef I8080_AOT
+// runs a test from its recompiled rom (see `make aot`) instead of the batch
+static void run_aot_test(i8080_job* const job) {
+  const test* const t = (test*) job->cpu->userdata;
+  const i8080_aot_program* const program = i8080_aot_find(t->filename);
+  if (program == NULL) {
+    fprintf(stderr, "error: %s hasn't been recompiled.\n", t->filename);
+    return;
   }
 
-  long long diff = cyc_expected - c->cyc;
-  printf("\n*** %lu instructions executed on %lu cycles"
-         " (expected=%lu, diff=%lld)\n\n",
-      nb_instructions, c->cyc, cyc_expected, diff);
+  i8080_run_result result;
+  do {
+    result = i8080_aot_run(job->cpu, program, 1000000);
+    job->instructions += result.instructions;
+  } while (result.reason == I8080_RUN_BUDGET);
+}
+#endif
+
+// adds a job running a test (or one of its shards)
+static void add_job(i8080_job* const jobs, int* const nb_jobs, test* const t) {
+  // to have a debug output of machine state, run the test with a loop
+  // calling i8080_debug_output(c, false) then i8080_step(c) instead
+  // warning: will output multiple GB of data for the whole test suite;
+  // i8080_trace_step writes it compressed (see tools/i8080_trace)
+  i8080_job* const job = &jobs[(*nb_jobs)++];
+  job->cpu = &t->cpu;
+  job->memory = NULL; // mapped by load_test
+  job->max_cycles = 0;
+  job->instructions = 0;
+}
+
+// wide mode check (see check_wide)
+#define WIDE_ROUNDS 64
+#define WIDE_STEPS 256
+#define WIDE_CODE_SIZE 0x1000 // program shared by the lanes, at 0x0000
+
+static void ignore_out(void* userdata, uint8_t port, uint8_t value) {
+  (void) userdata;
+  (void) port;
+  (void) value;
 }
 
-int main(void) {
-  memory = malloc(MEMORY_SIZE);
+// xorshift, so that every run checks the same states
+static uint32_t next_random(uint32_t* const state) {
+  uint32_t x = *state;
+  x ^= x << 13;
+  x ^= x >> 17;
+  x ^= x << 5;
+  return *state = x;
+}
+
+// checks the wide mode against the interpreter. In each round, the lanes
+// run the same random program (mostly moves and ALU operations, which are
+// executed together) from random registers and data, and copies of them are
+// stepped with i8080_step: every lane must end with the same registers,
+// flags, cycles and memory as its copy. Returns the number of lanes which
+// differed, -1 if out of memory.
+static int check_wide(void) {
+  uint8_t* const memory = malloc(2 * I8080_WIDE_LANES * MEMORY_SIZE);
   if (memory == NULL) {
-    return 1;
+    return -1;
   }
 
-  i8080 cpu;
-  run_test(&cpu, "cpu_tests/TST8080.COM", 4924LU);
-  run_test(&cpu, "cpu_tests/CPUTEST.COM", 255653383LU);
-  run_test(&cpu, "cpu_tests/8080PRE.COM", 7817LU);
-  run_test(&cpu, "cpu_tests/8080EXM.COM", 23803381171LU);
+  uint32_t state = 0x8080;
+  int nb_errors = 0;
+  for (int round = 0; round < WIDE_ROUNDS; round++) {
+    uint8_t* const code = memory; // lane 0's memory
+    for (int i = 0; i < WIDE_CODE_SIZE; i++) {
+      const uint32_t r = next_random(&state);
+      code[i] = (r >> 8) & 3 ? 0x40 + (r >> 10) % 0x80 : r & 0xFF;
+    }
+
+    i8080 cpus[2][I8080_WIDE_LANES];
+    i8080* lanes[I8080_WIDE_LANES];
+    for (int i = 0; i < I8080_WIDE_LANES; i++) {
+      uint8_t* const mem = &memory[2 * i * MEMORY_SIZE];
+      memcpy(mem, code, WIDE_CODE_SIZE);
+      for (int addr = WIDE_CODE_SIZE; addr < MEMORY_SIZE; addr += 4) {
+        const uint32_t r = next_random(&state);
+        memcpy(&mem[addr], &r, 4);
+      }
+      memcpy(mem + MEMORY_SIZE, mem, MEMORY_SIZE);
+
+      const uint32_t r1 = next_random(&state);
+      const uint32_t r2 = next_random(&state);
+      const uint16_t sp = next_random(&state);
+      for (int k = 0; k < 2; k++) {
+        i8080* const c = &cpus[k][i];
+        i8080_init(c);
+        c->port_in = port_in;
+        c->port_out = ignore_out;
+        i8080_map_ram(c, 0x0000, MEMORY_SIZE, mem + k * MEMORY_SIZE);
+        c->a = r1;
+        c->b = r1 >> 8;
+        c->c = r1 >> 16;
+        c->d = r1 >> 24;
+        c->e = r2;
+        c->h = r2 >> 8;
+        c->l = r2 >> 16;
+        c->f = (r2 >> 24 & 0xD5) | 0x02;
+        c->sp = sp;
+        c->iff = r2 & 1;
+      }
+      lanes[i] = &cpus[0][i];
+    }
+
+    i8080_wide w;
+    i8080_wide_init(&w, lanes, I8080_WIDE_LANES);
+    for (int n = 0; n < WIDE_STEPS; n++) {
+      i8080_wide_step(&w);
+      for (int i = 0; i < I8080_WIDE_LANES; i++) {
+        i8080_step(&cpus[1][i]);
+      }
+    }
+    i8080_wide_sync(&w);
+
+    for (int i = 0; i < I8080_WIDE_LANES; i++) {
+      const i8080* const c = &cpus[0][i];
+      const i8080* const ref = &cpus[1][i];
+      const uint8_t* const mem = &memory[2 * i * MEMORY_SIZE];
+      if (c->a != ref->a || c->b != ref->b || c->c != ref->c ||
+          c->d != ref->d || c->e != ref->e || c->h != ref->h ||
+          c->l != ref->l || c->f != ref->f || c->pc != ref->pc ||
+          c->sp != ref->sp || c->cyc != ref->cyc ||
+          c->halted != ref->halted || c->iff != ref->iff ||
+          memcmp(mem, mem + MEMORY_SIZE, MEMORY_SIZE) != 0) {
+        fprintf(stderr, "error: wide mode, round %d: lane %d differs.\n",
+            round, i);
+        nb_errors += 1;
+      }
+    }
+  }
 
   free(memory);
+  return nb_errors;
+}
 
-  return 0;
+// checks of the api, run after the roms. Each one returns the number of
+// errors, which it reports on stderr with check.
+
+// reports an error if `ok` is false, returns 1 if it is
+static int check(bool ok, const char* name, const char* what) {
+  if (!ok) {
+    fprintf(stderr, "error: %s: %s.\n", name, what);
+  }
+  return !ok;
+}
+
+// initialises an emulator running `code` at 0x0000 from `memory` (of
+// MEMORY_SIZE bytes), mapped as ram
+static void init_cpu(i8080* const c, uint8_t* memory, const uint8_t* code,
+    size_t size) {
+  memset(memory, 0, MEMORY_SIZE);
+  memcpy(memory, code, size);
+  i8080_init(c);
+  c->port_in = port_in;
+  c->port_out = ignore_out;
+  i8080_map_ram(c, 0x0000, MEMORY_SIZE, memory);
+}
+
+// engines the checks which depend on them are run on
+static const char* const ENGINES[] = {"interpreter", "cache", "jit"};
+
+// returns if two emulators have the same registers, flags and cycles
+static bool same_registers(const i8080* const c, const i8080* const ref) {
+  return c->a == ref->a && c->b == ref->b && c->c == ref->c &&
+         c->d == ref->d && c->e == ref->e && c->h == ref->h &&
+         c->l == ref->l && c->f == ref->f && c->pc == ref->pc &&
+         c->sp == ref->sp && c->cyc == ref->cyc && c->iff == ref->iff &&
+         c->halted == ref->halted;
+}
+
+// fills 0x2000-0x2FFF with the low byte of each address plus one, then halts
+static const uint8_t FILL_CODE[] = {
+    0x21, 0x00, 0x20, // LXI H,2000h
+    0x3C, // loop: INR A
+    0x77, // MOV M,A
+    0x23, // INX H
+    0x7C, // MOV A,H
+    0xFE, 0x30, // CPI 30h
+    0x7D, // MOV A,L
+    0xC2, 0x03, 0x00, // JNZ loop
+    0x76, // HLT
+};
+
+// checks that loading a state and saving it again gives the same state,
+// that a keyframe and a delta restore the state they were saved from, and
+// that a state loaded into a forked emulator leaves its parent unchanged
+static int check_save_states(const char* name) {
+  static uint8_t memory[MEMORY_SIZE], copy[MEMORY_SIZE];
+  static uint8_t buf[4][I8080_STATE_MEMORY_SIZE];
+  const size_t size = I8080_STATE_MEMORY_SIZE;
+  i8080 c;
+  init_cpu(&c, memory, FILL_CODE, sizeof(FILL_CODE));
+  int errors = 0;
+
+  // full states
+  i8080_run(&c, 20000);
+  errors += check(i8080_save_state(&c, buf[0], size, true) == size, name,
+      "full state size");
+  i8080_run(&c, 20000);
+  errors += check(i8080_load_state(&c, buf[0], size) == size, name,
+      "can't load the full state");
+  i8080_save_state(&c, buf[1], size, true);
+  errors += check(memcmp(buf[0], buf[1], size) == 0, name,
+      "full state changed by a save/load/save round trip");
+
+  // keyframe and delta
+  i8080_clear_dirty(&c);
+  i8080_save_state(&c, buf[1], size, true);
+  i8080_run(&c, 20000);
+  const size_t delta_size = i8080_save_delta(&c, buf[2], size);
+  errors += check(delta_size != 0 && delta_size == i8080_delta_size(&c),
+      name, "delta state size");
+  i8080_save_state(&c, buf[3], size, true);
+  i8080_run(&c, 100000);
+  errors += check(i8080_load_state(&c, buf[1], size) == size &&
+                      i8080_load_state(&c, buf[2], delta_size) == delta_size,
+      name, "can't load the keyframe and the delta");
+  i8080_save_state(&c, buf[1], size, true);
+  errors += check(memcmp(buf[1], buf[3], size) == 0, name,
+      "keyframe and delta don't restore the state");
+
+  // a truncated state is rejected, and leaves the emulator as it was
+  const i8080 before = c;
+  errors += check(i8080_load_state(&c, buf[2], delta_size - 1) == 0 &&
+                      same_registers(&c, &before),
+      name, "truncated state loaded");
+
+  // the pages a forked emulator shares with its parent are copied when a
+  // state changes them
+  i8080 child;
+  memcpy(copy, memory, MEMORY_SIZE);
+  if (!i8080_fork(&c, &child)) {
+    return errors + check(false, name, "can't fork");
+  }
+  errors += check(i8080_load_state(&child, buf[0], size) == size, name,
+      "can't load a state into a forked emulator");
+  i8080_save_state(&child, buf[1], size, true);
+  errors += check(memcmp(buf[0], buf[1], size) == 0, name,
+      "forked emulator not restored");
+  errors += check(memcmp(memory, copy, MEMORY_SIZE) == 0, name,
+      "state loaded into the parent of a forked emulator");
+  i8080_destroy(&child);
+  i8080_destroy(&c);
+  return errors;
+}
+
+// checks the copy-on-write memory of forked emulators: the parent keeps
+// writing to its host memory, a child copies a page when it first writes to
+// it, children forked while a page is unchanged share its copy, and the
+// parent releases its copy of a page when the page is mapped again
+static int check_fork(const char* name) {
+  static uint8_t memory[MEMORY_SIZE], other[I8080_PAGE_SIZE];
+  i8080 c, child1, child2;
+  init_cpu(&c, memory, FILL_CODE, sizeof(FILL_CODE));
+  if (!i8080_fork(&c, &child1)) {
+    return check(false, name, "can't fork");
+  }
+  int errors = 0;
+  errors += check(i8080_resident_memory(&child1) == 0, name,
+      "memory allocated for the child alone");
+
+  i8080_run(&c, 1000000);
+  errors += check(c.halted && memory[0x2FFE] != 0 &&
+                      c.read_pages[0x20] == &memory[0x2000],
+      name, "parent doesn't write to its host memory anymore");
+  errors += check(i8080_peek(&child1, 0x2FFE) == 0, name,
+      "write of the parent seen by the child");
+
+  i8080_poke(&child1, 0x2000, 0x55);
+  errors += check(i8080_peek(&child1, 0x2000) == 0x55 &&
+                      memory[0x2000] != 0x55 &&
+                      i8080_resident_memory(&child1) == I8080_PAGE_SIZE,
+      name, "first write of the child doesn't copy one page");
+
+  if (!i8080_fork(&c, &child2)) {
+    i8080_destroy(&child1);
+    i8080_destroy(&c);
+    return errors + check(false, name, "can't fork");
+  }
+  errors += check(child1.read_pages[0x40] == child2.read_pages[0x40] &&
+                      child1.read_pages[0x21] != child2.read_pages[0x21] &&
+                      i8080_peek(&child2, 0x2FFE) == memory[0x2FFE],
+      name, "children don't share the pages unchanged since the first fork");
+
+  // the copy of page 0x40 is now mapped by child1 and the parent
+  const size_t resident = i8080_resident_memory(&child1);
+  i8080_destroy(&child2);
+  errors += check(i8080_resident_memory(&child1) == resident, name,
+      "page released by a child while still shared");
+  i8080_map_ram(&c, 0x4000, I8080_PAGE_SIZE, other);
+  errors += check(
+      i8080_resident_memory(&child1) == resident + I8080_PAGE_SIZE, name,
+      "copy kept by the parent not released when the page is mapped again");
+
+  i8080_destroy(&child1);
+  i8080_destroy(&c);
+  return errors;
+}
+
+// checks that a delta state only holds the pages written since
+// i8080_clear_dirty, by the program (on each engine) or the host, and that
+// the keyframe and the delta rebuild the memory of another emulator
+static int check_dirty_pages(const char* name) {
+  static uint8_t memory[MEMORY_SIZE], restored[MEMORY_SIZE];
+  static uint8_t keyframe[I8080_STATE_MEMORY_SIZE];
+  static uint8_t delta[I8080_STATE_MEMORY_SIZE];
+  int errors = 0;
+
+  for (size_t e = 0; e < sizeof(ENGINES) / sizeof(ENGINES[0]); e++) {
+    i8080 c;
+    init_cpu(&c, memory, FILL_CODE, sizeof(FILL_CODE));
+    memset(&memory[0x8000], 0xAA, 0x8000);
+    if (!enable_engine(&c, ENGINES[e])) {
+      continue;
+    }
+    i8080_save_state(&c, keyframe, sizeof(keyframe), true);
+    i8080_clear_dirty(&c);
+
+    // the program writes to pages 0x20-0x2F, the host to page 0x90
+    i8080_run(&c, 1000000);
+    i8080_poke(&c, 0x9000, 0x55);
+    uint8_t expected[I8080_NB_PAGES / 8] = {0};
+    expected[0x20 / 8] = 0xFF;
+    expected[0x28 / 8] = 0xFF;
+    expected[0x90 / 8] = 0x01;
+    const size_t size = i8080_save_delta(&c, delta, sizeof(delta));
+    errors += check(size == I8080_STATE_SIZE + sizeof(expected) +
+                                17 * I8080_PAGE_SIZE &&
+                        memcmp(delta + I8080_STATE_SIZE, expected,
+                            sizeof(expected)) == 0,
+        name, "delta doesn't hold the pages written");
+
+    i8080 copy;
+    init_cpu(&copy, restored, FILL_CODE, sizeof(FILL_CODE));
+    memset(restored, 0x33, MEMORY_SIZE);
+    errors += check(i8080_load_state(&copy, keyframe, sizeof(keyframe)) != 0 &&
+                        i8080_load_state(&copy, delta, size) == size &&
+                        memcmp(memory, restored, MEMORY_SIZE) == 0 &&
+                        same_registers(&copy, &c),
+        name, "keyframe and delta don't rebuild the emulator");
+    i8080_destroy(&copy);
+    i8080_destroy(&c);
+  }
+  return errors;
+}
+
+#ifndef I8080_AOT
+// reads a port in a loop, writing the sum of the bytes read from 0x4000 on,
+// and counts the interrupts (RST 7) in C
+static const uint8_t INPUT_CODE[] = {
+    0xC3, 0x40, 0x00, // JMP 40h
+    [0x38] = 0x0C, // INR C
+    0xFB, // EI
+    0xC9, // RET
+    [0x40] = 0x31, 0x00, 0xF0, // LXI SP,0F000h
+    0x21, 0x00, 0x40, // LXI H,4000h
+    0xFB, // EI
+    0xDB, 0x10, // loop: IN 10h
+    0x80, // ADD B
+    0x47, // MOV B,A
+    0x77, // MOV M,A
+    0x23, // INX H
+    0xC3, 0x47, 0x00, // JMP loop
+};
+
+static uint8_t random_in(void* userdata, uint8_t port) {
+  (void) userdata;
+  static uint32_t state = 0x8080;
+  return next_random(&state) + port;
+}
+
+// checks that a run recorded with the interpreter is replayed with the same
+// registers, cycles and memory on each engine, that seeking reaches the
+// state recorded at a cycle, and that `diverged` is set when the program
+// reads another port than when recording
+static int check_replay(const char* name) {
+  static uint8_t memory[MEMORY_SIZE], replayed[MEMORY_SIZE];
+  FILE* const f = tmpfile();
+  if (f == NULL) {
+    return check(false, name, "can't create the log");
+  }
+  int errors = 0;
+
+  // 10 runs of about 40000 cycles, each followed by an interrupt (sent in
+  // the middle of blocks of the cache), and keyframes every 50000 cycles
+  i8080 c;
+  i8080_recorder recorder;
+  init_cpu(&c, memory, INPUT_CODE, sizeof(INPUT_CODE));
+  c.port_in = random_in;
+  i8080 middle = c;
+  if (!i8080_record_start(&recorder, &c, f, 50000)) {
+    fclose(f);
+    return check(false, name, "can't record");
+  }
+  for (int i = 0; i < 10; i++) {
+    i8080_record_run(&recorder, 40000 + i * 13);
+    i8080_record_interrupt(&recorder, 0xFF);
+    if (i == 6) {
+      middle = c;
+    }
+  }
+  i8080_record_stop(&recorder);
+  errors += check(c.c >= 9, name, "interrupts not recorded");
+
+  for (size_t e = 0; e < sizeof(ENGINES) / sizeof(ENGINES[0]); e++) {
+    i8080 copy;
+    i8080_replayer replayer;
+    init_cpu(&copy, replayed, INPUT_CODE, sizeof(INPUT_CODE));
+    rewind(f);
+    if (!enable_engine(&copy, ENGINES[e]) ||
+        !i8080_replay_start(&replayer, &copy, f)) {
+      i8080_destroy(&copy);
+      continue;
+    }
+
+    i8080_replay_run(&replayer, c.cyc);
+    errors += check(same_registers(&copy, &c) &&
+                        memcmp(memory, replayed, MEMORY_SIZE) == 0 &&
+                        !replayer.diverged,
+        name, "replay doesn't reproduce the run");
+
+    errors += check(i8080_replay_seek(&replayer, middle.cyc) &&
+                        same_registers(&copy, &middle) && !replayer.diverged,
+        name, "seek doesn't reach the recorded state");
+
+    i8080_poke(&copy, 0x48, 0x11); // IN 11h
+    i8080_replay_run(&replayer, 1000);
+    errors += check(replayer.diverged, name, "divergence not detected");
+
+    i8080_replay_stop(&replayer);
+    i8080_destroy(&copy);
+  }
+
+  i8080_destroy(&c);
+  fclose(f);
+  return errors;
+}
+#endif
+
+// a delay loop of each kind, then polls 0x0100 until an interrupt sets it
+static const uint8_t LOOPS_CODE[] = {
+    0x06, 0x0A, // MVI B,10
+    0x05, // DCR B
+    0xC2, 0x02, 0x00, // JNZ 0002h
+    0x11, 0x2C, 0x01, // LXI D,300
+    0x1B, // DCX D
+    0x7A, // MOV A,D
+    0xB3, // ORA E
+    0xC2, 0x09, 0x00, // JNZ 0009h
+    0xFB, // EI
+    0x3A, 0x00, 0x01, // LDA 0100h
+    0xE6, 0x01, // ANI 1
+    0xCA, 0x10, 0x00, // JZ 0010h
+    0x76, // HLT
+    [0x38] = 0x3E, 0x01, // MVI A,1
+    0x32, 0x00, 0x01, // STA 0100h
+    0xC9, // RET
+};
+#define LOOPS_POLL_CYCLES 7371 // cycles of LOOPS_CODE before polling
+#define LOOPS_POLLS 100 // iterations of the polling loop before the interrupt
+
+// runs LOOPS_CODE on an engine, with an interrupt after LOOPS_POLLS polls.
+// Returns false if the engine isn't available.
+static bool run_loops(i8080* const c, uint8_t* memory, const char* engine) {
+  init_cpu(c, memory, LOOPS_CODE, sizeof(LOOPS_CODE));
+  if (!enable_engine(c, engine)) {
+    return false;
+  }
+  i8080_run(c, LOOPS_POLL_CYCLES + LOOPS_POLLS * 30);
+  i8080_interrupt(c, 0xFF);
+  i8080_run(c, 1000);
+  return true;
+}
+
+// checks that the performance counters of LOOPS_CODE are the same on each
+// engine (the loops being skipped by the block cache), and have the
+// expected opcode counts. Without I8080_COUNTERS, they are all zero.
+static int check_counters(const char* name) {
+  static uint8_t memory[MEMORY_SIZE];
+  i8080 c;
+  run_loops(&c, memory, "interpreter");
+  const i8080_counters ref = i8080_get_counters(&c);
+  i8080_destroy(&c);
+  int errors = 0;
+
+#ifdef I8080_COUNTERS
+  errors += check(ref.opcodes[0x05] == 10 && ref.opcodes[0x1B] == 300 &&
+                      ref.opcodes[0xC2] == 310 &&
+                      ref.opcodes[0x3A] == LOOPS_POLLS + 1 &&
+                      ref.opcodes[0xCA] == LOOPS_POLLS + 1 &&
+                      ref.opcodes[0xFF] == 1 && ref.opcodes[0x76] == 1 &&
+                      ref.instructions == 1231 + 3 * LOOPS_POLLS &&
+                      ref.jumps[0] == 3 && ref.jumps[1] == 308 + LOOPS_POLLS &&
+                      ref.interrupts == 1,
+      name, "unexpected counts");
+#else
+  errors += check(ref.instructions == 0, name, "counters not compiled out");
+#endif
+
+  for (size_t e = 1; e < sizeof(ENGINES) / sizeof(ENGINES[0]); e++) {
+    if (!run_loops(&c, memory, ENGINES[e])) {
+      continue;
+    }
+    const i8080_counters counters = i8080_get_counters(&c);
+    const i8080_cache_stats stats = i8080_get_cache_stats(&c);
+    errors += check(memcmp(&counters, &ref, sizeof(ref)) == 0, name,
+        "counters differ from the interpreter's");
+    errors += check(stats.loops_skipped >= 3, name, "loops not skipped");
+    i8080_destroy(&c);
+  }
+  return errors;
+}
+
+// stops an emulator after about 50ms of cpu time
+static void* stop_later(void* arg) {
+  const clock_t start = clock();
+  while (clock() - start < CLOCKS_PER_SEC / 20) {
+  }
+  i8080_stop(arg);
+  return NULL;
+}
+
+// checks that the block cache leaves the registers, flags and cycles of the
+// loops it skips (LOOPS_CODE) as the interpreter does, whatever the budget,
+// and that an endless polling loop run with a budget of ULONG_MAX cycles
+// can still be stopped, without the cycle count wrapping
+static int check_loops(const char* name) {
+  static uint8_t memory[MEMORY_SIZE], ref_memory[MEMORY_SIZE];
+  static const unsigned long BUDGETS[] = {50, 149, 1000, 2001, 7371, 7400,
+      9013, 100000};
+  int errors = 0;
+
+  for (size_t e = 1; e < sizeof(ENGINES) / sizeof(ENGINES[0]); e++) {
+    for (size_t i = 0; i < sizeof(BUDGETS) / sizeof(BUDGETS[0]); i++) {
+      i8080 c, ref;
+      init_cpu(&c, memory, LOOPS_CODE, sizeof(LOOPS_CODE));
+      if (!enable_engine(&c, ENGINES[e])) {
+        break;
+      }
+      i8080_run(&c, BUDGETS[i]);
+
+      // the cache stops at the end of a block, where the interpreter does
+      init_cpu(&ref, ref_memory, LOOPS_CODE, sizeof(LOOPS_CODE));
+      while (ref.cyc < c.cyc) {
+        i8080_step(&ref);
+      }
+      errors += check(same_registers(&c, &ref), name,
+          "skipped loop differs from the interpreter");
+      errors += check(BUDGETS[i] < 1000 ||
+                          i8080_get_cache_stats(&c).loops_skipped > 0,
+          name, "loops not skipped");
+      i8080_destroy(&c);
+      i8080_destroy(&ref);
+    }
+
+    i8080 c;
+    pthread_t thread;
+    init_cpu(&c, memory, LOOPS_CODE, sizeof(LOOPS_CODE));
+    if (!enable_engine(&c, ENGINES[e]) ||
+        pthread_create(&thread, NULL, stop_later, &c) != 0) {
+      i8080_destroy(&c);
+      continue;
+    }
+    const i8080_run_result result = i8080_run(&c, ULONG_MAX);
+    pthread_join(thread, NULL);
+    errors += check(result.reason == I8080_RUN_STOPPED &&
+                        result.cycles == c.cyc &&
+                        c.cyc > LOOPS_POLL_CYCLES && c.cyc < ULONG_MAX / 2 &&
+                        c.pc >= 0x0010 && c.pc < 0x0018,
+        name, "endless polling loop not stopped");
+    i8080_destroy(&c);
+  }
+  return errors;
+}
+
+// spins in a loop with interrupts enabled, the interrupt handler counting
+// the interrupts in C and writing to port 1
+static const uint8_t SPIN_CODE[] = {
+    0x31, 0x00, 0xF0, // LXI SP,0F000h
+    0xFB, // EI
+    0xC3, 0x04, 0x00, // loop: JMP loop
+    [0x38] = 0x0C, // INR C
+    0xD3, 0x01, // OUT 1
+    0xFB, // EI
+    0xC9, // RET
+};
+#define REQUESTS 200 // counted in C
+#define REQUEST_TIMEOUT (5 * CLOCKS_PER_SEC) // cpu time before giving up
+
+// interrupts requested from another thread by check_requests
+typedef struct requests {
+  i8080* cpu;
+  pthread_mutex_t lock;
+  pthread_cond_t served;
+  int nb_served; // OUT 1 executed by the interrupt handler
+  bool done, timeout;
+} requests;
+
+static void count_served(void* userdata, uint8_t port, uint8_t value) {
+  (void) value;
+  requests* const r = userdata;
+  if (port == 1) {
+    pthread_mutex_lock(&r->lock);
+    r->nb_served += 1;
+    pthread_cond_signal(&r->served);
+    pthread_mutex_unlock(&r->lock);
+  }
+}
+
+// requests an interrupt once the previous one has been served
+static void* request_interrupts(void* arg) {
+  requests* const r = arg;
+  pthread_mutex_lock(&r->lock);
+  for (int i = 0; i < REQUESTS && !r->timeout; i++) {
+    i8080_request_interrupt(r->cpu, 0xFF);
+    while (r->nb_served <= i && !r->timeout) {
+      pthread_cond_wait(&r->served, &r->lock);
+    }
+  }
+  r->done = true;
+  pthread_mutex_unlock(&r->lock);
+  return NULL;
+}
+
+// checks on each engine that interrupts requested from another thread while
+// i8080_run runs are each delivered exactly once
+static int check_requests(const char* name) {
+  static uint8_t memory[MEMORY_SIZE];
+  int errors = 0;
+
+  for (size_t e = 0; e < sizeof(ENGINES) / sizeof(ENGINES[0]); e++) {
+    i8080 c;
+    requests r = {.cpu = &c};
+    init_cpu(&c, memory, SPIN_CODE, sizeof(SPIN_CODE));
+    c.port_out = count_served;
+    c.userdata = &r;
+    if (!enable_engine(&c, ENGINES[e])) {
+      continue;
+    }
+    pthread_t thread;
+    pthread_mutex_init(&r.lock, NULL);
+    pthread_cond_init(&r.served, NULL);
+    if (pthread_create(&thread, NULL, request_interrupts, &r) != 0) {
+      errors += check(false, name, "can't create a thread");
+    } else {
+      const clock_t start = clock();
+      bool done = false;
+      while (!done) {
+        i8080_run(&c, 1000);
+        pthread_mutex_lock(&r.lock);
+        if (clock() - start > REQUEST_TIMEOUT) {
+          r.timeout = true;
+          pthread_cond_signal(&r.served);
+        }
+        done = r.done;
+        pthread_mutex_unlock(&r.lock);
+      }
+      pthread_join(thread, NULL);
+      i8080_run(&c, 100000);
+
+      errors += check(!r.timeout && r.nb_served == REQUESTS &&
+                          c.c == REQUESTS,
+          name, "interrupt requests not delivered exactly once");
+    }
+    pthread_cond_destroy(&r.served);
+    pthread_mutex_destroy(&r.lock);
+    i8080_destroy(&c);
+  }
+  return errors;
+}
+
+// reads 0x2000 on, and writes each byte read plus one to 0x3000
+static const uint8_t COPY_CODE[] = {
+    0x21, 0x00, 0x20, // LXI H,2000h
+    0x7E, // loop: MOV A,M
+    0x3C, // INR A
+    0x32, 0x00, 0x30, // STA 3000h
+    0x23, // INX H
+    0xC3, 0x03, 0x00, // JMP loop
+};
+#define COPY_LOOP_CYCLES 40 // cycles of an iteration of COPY_CODE
+
+// returns if the last run stopped at a breakpoint of `kind` on `addr`
+static bool break_hit(i8080* const c, i8080_run_result result, int kind,
+    uint16_t addr, uint8_t value) {
+  const i8080_break hit = i8080_get_break(c);
+  return result.reason == I8080_RUN_BREAKPOINT && hit.kind == kind &&
+         hit.addr == addr && hit.value == value;
+}
+
+// checks that execution breakpoints and read and write watchpoints stop the
+// program on each engine, and that a watchpoint hit by the last instruction
+// of a budget is reported when it ends
+static int check_breakpoints(const char* name) {
+  static uint8_t memory[MEMORY_SIZE];
+  int errors = 0;
+
+  for (size_t e = 0; e < sizeof(ENGINES) / sizeof(ENGINES[0]); e++) {
+    i8080 c;
+    init_cpu(&c, memory, COPY_CODE, sizeof(COPY_CODE));
+    for (int i = 0; i < 0x1000; i++) {
+      memory[0x2000 + i] = i * 7;
+    }
+    if (!enable_engine(&c, ENGINES[e])) {
+      continue;
+    }
+    i8080_run(&c, 2000); // for the jit to compile the loop
+
+    // in the middle of a block, then stepped over when resuming
+    i8080_set_breakpoint(&c, I8080_BREAK_EXEC, 0x0008, 1);
+    i8080_run_result result = i8080_run(&c, 100000);
+    const unsigned long cyc = c.cyc;
+    errors += check(break_hit(&c, result, I8080_BREAK_EXEC, 0x0008, 0x23) &&
+                        c.pc == 0x0008,
+        name, "execution breakpoint not hit");
+    result = i8080_run(&c, 100000);
+    errors += check(break_hit(&c, result, I8080_BREAK_EXEC, 0x0008, 0x23) &&
+                        c.cyc - cyc == COPY_LOOP_CYCLES,
+        name, "execution breakpoint not hit again");
+    i8080_clear_breakpoint(&c, I8080_BREAK_EXEC, 0x0008, 1);
+
+    const uint16_t addr = (c.h << 8 | c.l) + 5;
+    i8080_set_breakpoint(&c, I8080_BREAK_READ, addr, 1);
+    result = i8080_run(&c, 100000);
+    errors += check(break_hit(&c, result, I8080_BREAK_READ, addr, memory[addr]),
+        name, "read watchpoint not hit");
+    i8080_clear_breakpoint(&c, I8080_BREAK_READ, addr, 1);
+
+    i8080_set_breakpoint(&c, I8080_BREAK_WRITE, 0x3000, 1);
+    result = i8080_run(&c, 100000);
+    errors += check(break_hit(&c, result, I8080_BREAK_WRITE, 0x3000, c.a),
+        name, "write watchpoint not hit");
+
+    // runs of a cycle (an instruction, or a block with the cache) until the
+    // next write: reported once, when the run ends
+    result.reason = I8080_RUN_BUDGET;
+    for (int i = 0; i < 5 && result.reason == I8080_RUN_BUDGET; i++) {
+      result = i8080_run(&c, 1);
+    }
+    errors += check(break_hit(&c, result, I8080_BREAK_WRITE, 0x3000, c.a) &&
+                        i8080_run(&c, 1).reason == I8080_RUN_BUDGET,
+        name, "watchpoint hit at the end of a budget not reported once");
+    i8080_destroy(&c);
+  }
+  return errors;
+}
+
+// waits for interrupts with HLT, counting them in C
+static const uint8_t HALT_CODE[] = {
+    0x31, 0x00, 0xF0, // LXI SP,0F000h
+    0xFB, // loop: EI
+    0x76, // HLT
+    0xC3, 0x03, 0x00, // JMP loop
+    [0x38] = 0x0C, // INR C
+    0xC9, // RET
+};
+#define SCHEDULE_EVENTS 32
+
+// events fired by check_schedule
+typedef struct fired_events {
+  i8080* cpu;
+  unsigned long cycles[SCHEDULE_EVENTS]; // cycle the event was scheduled for
+  unsigned long cyc[SCHEDULE_EVENTS]; // cycle count when it fired
+  int order[SCHEDULE_EVENTS]; // order it was scheduled in
+  int nb_fired;
+} fired_events;
+
+static fired_events fired;
+
+// records an event and interrupts the program
+static void fire_event(void* arg, unsigned long cycle) {
+  if (fired.nb_fired < SCHEDULE_EVENTS) {
+    fired.cycles[fired.nb_fired] = cycle;
+    fired.cyc[fired.nb_fired] = fired.cpu->cyc;
+    fired.order[fired.nb_fired] = (int) (intptr_t) arg;
+    fired.nb_fired += 1;
+  }
+  i8080_interrupt(fired.cpu, 0xFF);
+}
+
+// checks on each engine that events scheduled in any order fire in the
+// order of their cycles (then of scheduling), at the exact cycle when they
+// wake a halted program, and that i8080_run returns once halted with
+// nothing left to wake it
+static int check_schedule(const char* name) {
+  static uint8_t memory[MEMORY_SIZE];
+  int errors = 0;
+
+  for (size_t e = 0; e < sizeof(ENGINES) / sizeof(ENGINES[0]); e++) {
+    i8080 c;
+    init_cpu(&c, memory, HALT_CODE, sizeof(HALT_CODE));
+    if (!enable_engine(&c, ENGINES[e])) {
+      continue;
+    }
+    memset(&fired, 0, sizeof(fired));
+    fired.cpu = &c;
+
+    // at multiples of 1000 cycles (time for the interrupt handler), two by
+    // two at the same cycle
+    uint32_t state = 0x8080;
+    for (int i = 0; i < SCHEDULE_EVENTS; i++) {
+      const unsigned long cycle = 1000 * (1 + next_random(&state) % 64);
+      i8080_schedule(&c, cycle, fire_event, (void*) (intptr_t) i);
+      i8080_schedule(&c, cycle, fire_event, (void*) (intptr_t) ++i);
+    }
+
+    const i8080_run_result result = i8080_run(&c, 1000000);
+    bool in_order = fired.nb_fired == SCHEDULE_EVENTS;
+    bool exact = true;
+    int interrupts = 0;
+    for (int i = 0; i < fired.nb_fired; i++) {
+      exact = exact && fired.cyc[i] == fired.cycles[i];
+      if (i > 0 && fired.cycles[i] == fired.cycles[i - 1]) {
+        in_order = in_order && fired.order[i] > fired.order[i - 1];
+      } else {
+        in_order = in_order &&
+                   (i == 0 || fired.cycles[i] > fired.cycles[i - 1]);
+        interrupts += 1;
+      }
+    }
+    errors += check(in_order, name, "events not fired in order");
+    errors += check(exact, name, "halted program not woken at the event");
+    errors += check(c.c == interrupts, name, "interrupts not serviced");
+    errors += check(result.reason == I8080_RUN_HALTED && c.halted &&
+                        c.cyc < fired.cycles[SCHEDULE_EVENTS - 1] + 1000,
+        name, "run not ended once halted with no event left");
+    i8080_destroy(&c);
+  }
+  return errors;
+}
+
+// echoes each byte read from port 1 plus one to port 1, waiting on the
+// status port 0 for a byte to read (bit 0) and for room to write it (bit 1)
+static const uint8_t ECHO_CODE[] = {
+    0x31, 0x00, 0xF0, // LXI SP,0F000h
+    0xDB, 0x00, // wait_in: IN 0
+    0xE6, 0x01, // ANI 1
+    0xCA, 0x03, 0x00, // JZ wait_in
+    0xDB, 0x01, // IN 1
+    0x3C, // INR A
+    0x47, // MOV B,A
+    0xDB, 0x00, // wait_out: IN 0
+    0xE6, 0x02, // ANI 2
+    0xCA, 0x0E, 0x00, // JZ wait_out
+    0x78, // MOV A,B
+    0xD3, 0x01, // OUT 1
+    0xC3, 0x03, 0x00, // JMP wait_in
+};
+#define ECHO_BYTES (3 * I8080_RING_SIZE + 100) // wraps the rings three times
+
+// copies port 1 to port 1 without waiting
+static const uint8_t FLOOD_CODE[] = {
+    0xDB, 0x01, // loop: IN 1
+    0xD3, 0x01, // OUT 1
+    0xC3, 0x00, 0x00, // JMP loop
+};
+#define FLOOD_LOOP_CYCLES 30 // cycles of an iteration of FLOOD_CODE
+#define FLOOD_EMPTY 0xE5 // read from port 1 while its ring is empty
+
+// returns the byte written at a position of the rings in check_rings
+static uint8_t ring_byte(size_t pos) {
+  return (uint8_t) (pos * 7);
+}
+
+// writes the next bytes of check_rings to a ring, as many as fit
+static void feed_ring(i8080_ring* const ring, size_t* const written) {
+  uint8_t buf[I8080_RING_SIZE];
+  size_t size = 0;
+  while (size < sizeof(buf) && *written + size < ECHO_BYTES) {
+    buf[size] = ring_byte(*written + size);
+    size += 1;
+  }
+  *written += i8080_ring_write(ring, buf, size);
+}
+
+static int last_out; // value written by OUT to the port_out callback
+
+static void record_out(void* userdata, uint8_t port, uint8_t value) {
+  last_out = value;
+}
+
+// checks that rings keep their bytes in order when wrapping around, that
+// writes stop when they are full and reads when they are empty, then on each
+// engine that a program echoes bytes through bound ports waiting on a status
+// port, that OUT drops and counts bytes on a full ring, that IN returns the
+// empty value on an empty one, and that unbound ports use the callbacks again
+static int check_rings(const char* name) {
+  static uint8_t memory[MEMORY_SIZE];
+  static i8080_ring in, out;
+  int errors = 0;
+
+  // in chunks which don't divide the size of the ring, so that they wrap
+  i8080_ring_init(&in);
+  bool in_order = true;
+  for (size_t pos = 0; pos < ECHO_BYTES; pos += 300) {
+    uint8_t buf[300];
+    for (size_t i = 0; i < sizeof(buf); i++) {
+      buf[i] = ring_byte(pos + i);
+    }
+    const size_t written = i8080_ring_write(&in, buf, sizeof(buf));
+    memset(buf, 0, sizeof(buf));
+    const size_t read = i8080_ring_read(&in, buf, sizeof(buf));
+    in_order = in_order && written == sizeof(buf) && read == sizeof(buf);
+    for (size_t i = 0; i < sizeof(buf); i++) {
+      in_order = in_order && buf[i] == ring_byte(pos + i);
+    }
+  }
+  errors += check(in_order, name, "ring not read in order");
+
+  uint8_t buf[I8080_RING_SIZE + 1];
+  memset(buf, 0, sizeof(buf));
+  const size_t written = i8080_ring_write(&in, buf, sizeof(buf));
+  const bool stopped = i8080_ring_write(&in, buf, 1) == 0;
+  const size_t read = i8080_ring_read(&in, buf, sizeof(buf));
+  const bool drained = i8080_ring_read(&in, buf, 1) == 0;
+  errors += check(written == I8080_RING_SIZE && stopped &&
+                      read == I8080_RING_SIZE && drained,
+      name, "full or empty ring not detected");
+
+  for (size_t e = 0; e < sizeof(ENGINES) / sizeof(ENGINES[0]); e++) {
+    i8080 c;
+    init_cpu(&c, memory, ECHO_CODE, sizeof(ECHO_CODE));
+    if (!enable_engine(&c, ENGINES[e])) {
+      continue;
+    }
+    i8080_ring_init(&in);
+    i8080_ring_init(&out);
+    i8080_bind_status(&c, 0, &in, 0x01, &out, 0x02);
+    i8080_bind_in(&c, 1, &in, FLOOD_EMPTY);
+    i8080_bind_out(&c, 1, &out);
+
+    // feeds the input again once the output is full, for the program to
+    // wait for room in it
+    size_t nb_written = 0, nb_read = 0;
+    bool echoed = true, full = false;
+    for (int i = 0; i < 100 && nb_read < ECHO_BYTES; i++) {
+      feed_ring(&in, &nb_written);
+      i8080_run(&c, 200000);
+      feed_ring(&in, &nb_written);
+      i8080_run(&c, 200000);
+      const size_t n = i8080_ring_read(&out, buf, sizeof(buf));
+      for (size_t j = 0; j < n; j++) {
+        echoed = echoed && buf[j] == (uint8_t) (ring_byte(nb_read + j) + 1);
+      }
+      full = full || n == I8080_RING_SIZE;
+      nb_read += n;
+    }
+    errors += check(echoed && nb_read == ECHO_BYTES && out.dropped == 0,
+        name, "bytes not echoed through bound ports");
+    errors += check(full, name, "program not waiting for room in a ring");
+    i8080_destroy(&c);
+
+    init_cpu(&c, memory, FLOOD_CODE, sizeof(FLOOD_CODE));
+    enable_engine(&c, ENGINES[e]);
+    c.port_out = record_out;
+    i8080_ring_init(&in);
+    i8080_ring_init(&out);
+    i8080_bind_in(&c, 1, &in, FLOOD_EMPTY);
+    i8080_bind_out(&c, 1, &out);
+    i8080_run(&c, 100000);
+    const unsigned long outs = (c.cyc + 10) / FLOOD_LOOP_CYCLES;
+    const size_t n = i8080_ring_read(&out, buf, sizeof(buf));
+    bool empty = n == I8080_RING_SIZE;
+    for (size_t j = 0; j < n; j++) {
+      empty = empty && buf[j] == FLOOD_EMPTY;
+    }
+    errors += check(empty, name, "empty value not read from an empty ring");
+    errors += check(out.dropped == outs - I8080_RING_SIZE, name,
+        "bytes written to a full ring not dropped");
+
+    last_out = -1;
+    i8080_unbind_ports(&c);
+    i8080_run(&c, 1000);
+    errors += check(i8080_ring_read(&out, buf, 1) == 0 && last_out == 0x00,
+        name, "unbound ports not using the callbacks");
+    i8080_destroy(&c);
+  }
+  return errors;
+}
+
+// api checks, in the order they are run
+static const struct {
+  const char* name;
+  int (*run)(const char* name);
+} CHECKS[] = {
+    {"save states", check_save_states},
+    {"fork", check_fork},
+    {"dirty pages", check_dirty_pages},
+#ifndef I8080_AOT
+    {"record and replay", check_replay},
+#endif
+    {"counters", check_counters},
+    {"loops", check_loops},
+    {"breakpoints", check_breakpoints},
+    {"scheduled events", check_schedule},
+    {"interrupt requests", check_requests},
+    {"rings", check_rings},
+};
+
+// usage: i8080_tests [-e engine]. Returns 1 if a test couldn't be run or
+// didn't take the expected number of cycles (which it doesn't if it fails),
+// EXIT_SKIPPED if the engine isn't available in this build.
+int main(int argc, char** argv) {
+  if (argc == 3 && strcmp(argv[1], "-e") == 0 &&
+      (strcmp(argv[2], "interpreter") == 0 ||
+          strcmp(argv[2], "cache") == 0 || strcmp(argv[2], "jit") == 0)) {
+    engine = argv[2];
+  } else if (argc != 1) {
+    fprintf(stderr, "usage: %s [-e interpreter|cache|jit]\n", argv[0]);
+    return 1;
+  }
+#ifndef I8080_AOT
+  i8080 probe;
+  i8080_init(&probe);
+  if (!enable_engine(&probe, engine)) {
+    fprintf(stderr, "%s: engine '%s' not available.\n", argv[0], engine);
+    return EXIT_SKIPPED;
+  }
+  i8080_destroy(&probe);
+#endif
+
+  test tests[NB_TESTS] = {
+      {.filename = "cpu_tests/TST8080.COM", .cyc_expected = 4924LU},
+      {.filename = "cpu_tests/CPUTEST.COM", .cyc_expected = 255653383LU},
+      {.filename = "cpu_tests/8080PRE.COM", .cyc_expected = 7817LU},
+      {.filename = "cpu_tests/8080EXM.COM", .cyc_expected = 23803381171LU,
+          .sharded = true},
+  };
+
+  int status = 0;
+  int max_jobs = 0;
+  for (int i = 0; i < NB_TESTS; i++) {
+    test* const t = &tests[i];
+    t->memory = malloc(MEMORY_SIZE);
+    if (t->memory == NULL) {
+      return 1;
+    }
+    t->loaded = load_test(t);
+    if (t->loaded && t->sharded && !shard_test(t)) {
+      fprintf(stderr, "error: can't shard %s.\n", t->filename);
+      t->loaded = false;
+    }
+    if (!t->loaded) {
+      status = 1;
+    }
+    max_jobs += t->nb_shards > 0 ? t->nb_shards : 1;
+  }
+
+  // the shards first, as the longest jobs
+  i8080_job* const jobs = calloc(max_jobs, sizeof(i8080_job));
+  if (jobs == NULL) {
+    return 1;
+  }
+  int nb_jobs = 0;
+  for (int i = 0; i < NB_TESTS; i++) {
+    for (int k = 0; tests[i].loaded && k < tests[i].nb_shards; k++) {
+      add_job(jobs, &nb_jobs, &tests[i].shards[k]);
+    }
+  }
+  for (int i = 0; i < NB_TESTS; i++) {
+    if (tests[i].loaded && tests[i].nb_shards == 0) {
+      add_job(jobs, &nb_jobs, &tests[i]);
+    }
+  }
+
+#ifdef I8080_AOT
+  for (int i = 0; i < nb_jobs; i++) {
+    run_aot_test(&jobs[i]);
+  }
+#else
+  if (!i8080_run_batch(jobs, nb_jobs, 0, 0)) {
+    fprintf(stderr, "error: can't allocate the batch.\n");
+    return 1;
+  }
+#endif
+
+  for (int i = 0; i < nb_jobs; i++) {
+    test* const t = (test*) jobs[i].cpu->userdata;
+    t->instructions = jobs[i].instructions;
+  }
+
+  for (int i = 0; i < NB_TESTS; i++) {
+    test* const t = &tests[i];
+    if (!t->loaded) {
+      continue;
+    }
+    if (t->nb_shards > 0) {
+      merge_shards(t);
+    }
+    const unsigned long nb_instructions = t->instructions;
+
+    printf("*** TEST: %s\n", t->filename);
+    fwrite(t->output, 1, t->output_size, stdout);
+
+    long long diff = t->cyc_expected - t->cpu.cyc;
+    printf("\n*** %lu instructions executed on %lu cycles"
+           " (expected=%lu, diff=%lld)\n\n",
+        nb_instructions, t->cpu.cyc, t->cyc_expected, diff);
+    if (diff != 0) {
+      status = 1;
+    }
+  }
+
+  const int wide_errors = check_wide();
+  printf("*** TEST: wide mode\n");
+  printf("*** %d lanes of %d instructions compared to i8080_step (diff=%d)"
+         "\n\n",
+      WIDE_ROUNDS * I8080_WIDE_LANES, WIDE_STEPS, wide_errors);
+  if (wide_errors != 0) {
+    status = 1;
+  }
+
+  for (size_t i = 0; i < sizeof(CHECKS) / sizeof(CHECKS[0]); i++) {
+    const int errors = CHECKS[i].run(CHECKS[i].name);
+    printf("*** TEST: %s\n*** %d errors\n\n", CHECKS[i].name, errors);
+    if (errors != 0) {
+      status = 1;
+    }
+  }
+
+  for (int i = 0; i < NB_TESTS; i++) {
+    for (int k = 0; k < tests[i].nb_shards; k++) {
+#ifndef I8080_AOT
+      i8080_destroy(&tests[i].shards[k].cpu);
+#endif
+      free(tests[i].shards[k].memory);
+      free(tests[i].shards[k].output);
+    }
+#ifndef I8080_AOT
+    i8080_destroy(&tests[i].cpu);
+#endif
+    free(tests[i].shards);
+    free(tests[i].memory);
+    free(tests[i].output);
+  }
+  free(jobs);
+
+  return status;
 }
@@ -0,0 +1,415 @@
+// binary traces: the state of the emulator before each instruction (see
+// i8080_trace_record) is stored as a fixed-size record. The emulation thread
+// only copies the records to the blocks of a ring buffer, which a writer
+// thread encodes and writes to the file: each record is delta-encoded (every
+// byte minus the same byte of the previous record), the block is stored byte
+// by byte (the first byte of all the records, then the second byte...) so
+// that the bytes which rarely change make long runs, then compressed with a
+// small LZ77 compressor.
+
+#define _POSIX_C_SOURCE 200112L // for nanosleep
+
+#include <pthread.h>
+#include <sched.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "i8080_trace.h"
+
+#define TRACE_VERSION 2
+// records: cyc (8 bytes), pc, sp (2 bytes each), a, b, c, d, e, h, l, f, then
+// the 4 bytes at pc. Words are little-endian.
+#define RECORD_SIZE 24
+#define BLOCK_RECORDS 2048 // the blocks must be less than 64 KB (lz offsets)
+#define BLOCK_SIZE (BLOCK_RECORDS * RECORD_SIZE)
+#define NB_BLOCKS 16 // blocks of the ring buffer
+
+// compression
+#define MIN_MATCH 4
+#define HASH_BITS 12
+#define MAX_COMPRESSED (BLOCK_SIZE + BLOCK_SIZE / 255 + 16)
+
+// the ring buffer is shared by the emulation and the writer threads, without
+// locks: each index is only written by one of them
+#define LOAD(p) __atomic_load_n(p, __ATOMIC_ACQUIRE)
+#define STORE(p, v) __atomic_store_n(p, v, __ATOMIC_RELEASE)
+
+// the first 20 bytes of a record are laid out as cyc and the registers in
+// struct i8080 on little-endian hosts with 64-bit longs: they are copied at
+// once
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define RECORD_COPY \
+  (sizeof(unsigned long) == 8 && \
+      offsetof(i8080, pc) == offsetof(i8080, cyc) + 8 && \
+      offsetof(i8080, f) == offsetof(i8080, cyc) + 19)
+#else
+#define RECORD_COPY false
+#endif
+
+struct i8080_trace {
+  FILE* file;
+  pthread_t writer;
+
+  uint8_t (*blocks)[BLOCK_SIZE];
+  unsigned nb_records[NB_BLOCKS];
+  unsigned long head; // blocks filled by the emulation thread
+  unsigned long tail; // blocks written by the writer thread
+  bool closing;
+  bool error;
+
+  // emulation thread
+  unsigned records; // records in the current block
+
+  // writer thread
+  uint8_t encoded[BLOCK_SIZE];
+  uint8_t compressed[MAX_COMPRESSED];
+  uint32_t hash[1 << HASH_BITS]; // last positions of 4 bytes sequences (+1)
+};
+
+struct i8080_trace_reader {
+  FILE* file;
+  uint8_t block[BLOCK_SIZE];
+  uint8_t compressed[MAX_COMPRESSED];
+  unsigned nb_records, next;
+  uint8_t last[RECORD_SIZE];
+};
+
+// lz77: sequences of a token (number of literals in the high nibble, length
+// of the match minus MIN_MATCH in the low one, 15 meaning that bytes follow
+// until one isn't 255), the literals, then the offset of the match (2
+// bytes). The last sequence has no match.
+
+static uint8_t* i8080_write_length(uint8_t* out, size_t length) {
+  for (; length >= 255; length -= 255) {
+    *out++ = 255;
+  }
+  *out++ = length;
+  return out;
+}
+
+static uint8_t* i8080_write_sequence(uint8_t* out, const uint8_t* literals,
+    size_t nb_literals, size_t offset, size_t length) {
+  const size_t match = offset != 0 ? length - MIN_MATCH : 0;
+  *out++ = (nb_literals < 15 ? nb_literals : 15) << 4 |
+           (match < 15 ? match : 15);
+  if (nb_literals >= 15) {
+    out = i8080_write_length(out, nb_literals - 15);
+  }
+  memcpy(out, literals, nb_literals);
+  out += nb_literals;
+
+  if (offset != 0) {
+    *out++ = offset & 0xFF;
+    *out++ = offset >> 8;
+    if (match >= 15) {
+      out = i8080_write_length(out, match - 15);
+    }
+  }
+  return out;
+}
+
+// compresses `size` bytes, returns the compressed size
+static size_t i8080_compress(
+    const uint8_t* in, size_t size, uint8_t* out, uint32_t* hash) {
+  uint8_t* const start = out;
+  size_t pos = 0, anchor = 0;
+  memset(hash, 0, sizeof(uint32_t) << HASH_BITS);
+
+  while (pos + MIN_MATCH <= size) {
+    uint32_t seq;
+    memcpy(&seq, &in[pos], MIN_MATCH);
+    const uint32_t h = (seq * 2654435761u) >> (32 - HASH_BITS);
+    const size_t candidate = hash[h];
+    hash[h] = pos + 1;
+
+    if (candidate == 0 || memcmp(&in[candidate - 1], &in[pos], MIN_MATCH)) {
+      pos += 1;
+      continue;
+    }
+
+    size_t length = MIN_MATCH;
+    while (pos + length < size &&
+           in[candidate - 1 + length] == in[pos + length]) {
+      length += 1;
+    }
+    out = i8080_write_sequence(
+        out, &in[anchor], pos - anchor, pos - (candidate - 1), length);
+    pos += length;
+    anchor = pos;
+  }
+
+  if (anchor < size) {
+    out = i8080_write_sequence(out, &in[anchor], size - anchor, 0, 0);
+  }
+  return out - start;
+}
+
+static bool i8080_read_length(
+    const uint8_t* in, size_t in_size, size_t* i, size_t* length) {
+  uint8_t byte;
+  do {
+    if (*i >= in_size) {
+      return false;
+    }
+    byte = in[(*i)++];
+    *length += byte;
+  } while (byte == 255);
+  return true;
+}
+
+// decompresses exactly `size` bytes, returns false if `in` is corrupted
+static bool i8080_decompress(
+    const uint8_t* in, size_t in_size, uint8_t* out, size_t size) {
+  size_t i = 0, o = 0;
+  while (o < size) {
+    if (i >= in_size) {
+      return false;
+    }
+    const uint8_t token = in[i++];
+
+    size_t nb_literals = token >> 4;
+    if (nb_literals == 15 &&
+        !i8080_read_length(in, in_size, &i, &nb_literals)) {
+      return false;
+    }
+    if (nb_literals > size - o || nb_literals > in_size - i) {
+      return false;
+    }
+    memcpy(&out[o], &in[i], nb_literals);
+    o += nb_literals;
+    i += nb_literals;
+    if (o == size) {
+      break;
+    }
+
+    if (in_size - i < 2) {
+      return false;
+    }
+    const size_t offset = in[i] | in[i + 1] << 8;
+    i += 2;
+    size_t length = token & 0x0F;
+    if (length == 15 && !i8080_read_length(in, in_size, &i, &length)) {
+      return false;
+    }
+    length += MIN_MATCH;
+    if (offset == 0 || offset > o || length > size - o) {
+      return false;
+    }
+
+    // the match can overlap the bytes it produces (runs)
+    for (size_t k = 0; k < length; k++, o++) {
+      out[o] = out[o - offset];
+    }
+  }
+  return true;
+}
+
+// writer thread
+
+static void i8080_write_u32(uint8_t* p, uint32_t val) {
+  for (int i = 0; i < 4; i++) {
+    p[i] = val >> (i * 8);
+  }
+}
+
+static uint32_t i8080_read_u32(const uint8_t* p) {
+  return p[0] | p[1] << 8 | p[2] << 16 | (uint32_t) p[3] << 24;
+}
+
+// encodes, compresses and writes a block: number of records, compressed
+// size, data
+static void i8080_write_block(
+    i8080_trace* const t, const uint8_t* block, unsigned n) {
+  for (int i = 0; i < RECORD_SIZE; i++) {
+    uint8_t last = 0;
+    for (unsigned rec = 0; rec < n; rec++) {
+      const uint8_t byte = block[rec * RECORD_SIZE + i];
+      t->encoded[i * n + rec] = byte - last;
+      last = byte;
+    }
+  }
+
+  const size_t size =
+      i8080_compress(t->encoded, n * RECORD_SIZE, t->compressed, t->hash);
+  uint8_t header[8];
+  i8080_write_u32(header, n);
+  i8080_write_u32(header + 4, size);
+  if (fwrite(header, 1, 8, t->file) != 8 ||
+      fwrite(t->compressed, 1, size, t->file) != size) {
+    t->error = true;
+  }
+}
+
+static void* i8080_trace_writer(void* arg) {
+  i8080_trace* const t = arg;
+  while (true) {
+    if (t->tail == LOAD(&t->head)) {
+      // the last block is published before `closing` is set
+      if (LOAD(&t->closing) && t->tail == LOAD(&t->head)) {
+        return NULL;
+      }
+      const struct timespec delay = {0, 100000};
+      nanosleep(&delay, NULL);
+      continue;
+    }
+
+    const unsigned i = t->tail % NB_BLOCKS;
+    i8080_write_block(t, t->blocks[i], t->nb_records[i]);
+    STORE(&t->tail, t->tail + 1);
+  }
+}
+
+// emulation thread
+
+// hands the current block to the writer thread
+static void i8080_trace_flush(i8080_trace* const t) {
+  t->nb_records[t->head % NB_BLOCKS] = t->records;
+  STORE(&t->head, t->head + 1);
+  t->records = 0;
+
+  // waits for the writer thread to free a block
+  while (t->head - LOAD(&t->tail) >= NB_BLOCKS) {
+    sched_yield();
+  }
+}
+
+static inline uint8_t i8080_trace_peek(i8080* const c, uint16_t addr) {
+  const uint8_t* const page = c->read_pages[addr >> 8];
+  return page != NULL ? page[addr & 0xFF] : c->read_byte(c->userdata, addr);
+}
+
+// starts writing a trace to `f`. Returns NULL if out of memory.
+i8080_trace* i8080_trace_open(FILE* f) {
+  i8080_trace* const t = calloc(1, sizeof(i8080_trace));
+  if (t == NULL) {
+    return NULL;
+  }
+  t->blocks = malloc(NB_BLOCKS * BLOCK_SIZE);
+  if (t->blocks == NULL) {
+    free(t);
+    return NULL;
+  }
+
+  t->file = f;
+  fwrite("8080TRC", 1, 7, f);
+  fputc(TRACE_VERSION, f);
+  if (pthread_create(&t->writer, NULL, i8080_trace_writer, t) != 0) {
+    free(t->blocks);
+    free(t);
+    return NULL;
+  }
+  return t;
+}
+
+// records the state of the emulator before its next instruction. To be
+// called before each i8080_step, as i8080_debug_output.
+void i8080_trace_step(i8080_trace* const t, i8080* const c) {
+  uint8_t* const rec =
+      &t->blocks[t->head % NB_BLOCKS][t->records * RECORD_SIZE];
+  if (RECORD_COPY) {
+    memcpy(rec, (const uint8_t*) c + offsetof(i8080, cyc), 20);
+  } else {
+    const uint64_t cyc = c->cyc;
+    const uint8_t regs[20] = {cyc, cyc >> 8, cyc >> 16, cyc >> 24, cyc >> 32,
+        cyc >> 40, cyc >> 48, cyc >> 56, c->pc & 0xFF, c->pc >> 8,
+        c->sp & 0xFF, c->sp >> 8, c->a, c->b, c->c, c->d, c->e, c->h, c->l,
+        c->f};
+    memcpy(rec, regs, 20);
+  }
+
+  // the 4 bytes are almost always in the same mapped page
+  const uint16_t pc = c->pc;
+  const uint8_t* const page = c->read_pages[pc >> 8];
+  if (page != NULL && (pc & 0xFF) <= 0xFC) {
+    memcpy(&rec[20], &page[pc & 0xFF], 4);
+  } else {
+    for (int i = 0; i < 4; i++) {
+      rec[20 + i] = i8080_trace_peek(c, pc + i);
+    }
+  }
+
+  t->records += 1;
+  if (t->records == BLOCK_RECORDS) {
+    i8080_trace_flush(t);
+  }
+}
+
+// writes the last records and frees the trace. Returns false if the trace
+// couldn't be written entirely.
+bool i8080_trace_close(i8080_trace* const t) {
+  if (t->records > 0) {
+    i8080_trace_flush(t);
+  }
+  STORE(&t->closing, true);
+  pthread_join(t->writer, NULL);
+
+  const bool ok = !t->error && fflush(t->file) == 0;
+  free(t->blocks);
+  free(t);
+  return ok;
+}
+
+// reader
+
+// starts reading a trace from `f`. Returns NULL if out of memory or if `f`
+// doesn't hold a trace.
+i8080_trace_reader* i8080_trace_read_open(FILE* f) {
+  uint8_t header[8];
+  if (fread(header, 1, 8, f) != 8 || memcmp(header, "8080TRC", 7) != 0 ||
+      header[7] != TRACE_VERSION) {
+    return NULL;
+  }
+
+  i8080_trace_reader* const r = calloc(1, sizeof(i8080_trace_reader));
+  if (r != NULL) {
+    r->file = f;
+  }
+  return r;
+}
+
+// reads the next record, returns false at the end of the trace (or if it is
+// corrupted)
+bool i8080_trace_read(i8080_trace_reader* const r, i8080_trace_record* rec) {
+  if (r->next == r->nb_records) {
+    uint8_t header[8];
+    if (fread(header, 1, 8, r->file) != 8) {
+      return false;
+    }
+    const uint32_t n = i8080_read_u32(header);
+    const uint32_t size = i8080_read_u32(header + 4);
+    if (n == 0 || n > BLOCK_RECORDS || size > MAX_COMPRESSED ||
+        fread(r->compressed, 1, size, r->file) != size ||
+        !i8080_decompress(r->compressed, size, r->block, n * RECORD_SIZE)) {
+      r->nb_records = r->next = 0;
+      return false;
+    }
+    r->nb_records = n;
+    r->next = 0;
+    memset(r->last, 0, RECORD_SIZE);
+  }
+
+  for (int i = 0; i < RECORD_SIZE; i++) {
+    r->last[i] += r->block[i * r->nb_records + r->next];
+  }
+  r->next += 1;
+
+  const uint8_t* const last = r->last;
+  uint64_t cyc = 0;
+  for (int i = 0; i < 8; i++) {
+    cyc |= (uint64_t) last[i] << (i * 8);
+  }
+  rec->cyc = cyc;
+  rec->pc = last[8] | last[9] << 8;
+  rec->sp = last[10] | last[11] << 8;
+  rec->af = last[12] << 8 | last[19];
+  rec->bc = last[13] << 8 | last[14];
+  rec->de = last[15] << 8 | last[16];
+  rec->hl = last[17] << 8 | last[18];
+  memcpy(rec->mem, &last[20], 4);
+  return true;
+}
+
+void i8080_trace_read_close(i8080_trace_reader* const r) {
+  free(r);
+}
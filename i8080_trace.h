@@ -0,0 +1,24 @@
+#ifndef I8080_I8080_TRACE_H_
+#define I8080_I8080_TRACE_H_
+
+#include "i8080.h"
+
+// state of the emulator before an instruction, as in i8080_debug_output
+typedef struct i8080_trace_record {
+  uint16_t pc, af, bc, de, hl, sp;
+  unsigned long cyc;
+  uint8_t mem[4]; // bytes at pc...pc+3
+} i8080_trace_record;
+
+typedef struct i8080_trace i8080_trace;
+typedef struct i8080_trace_reader i8080_trace_reader;
+
+i8080_trace* i8080_trace_open(FILE* f);
+void i8080_trace_step(i8080_trace* const t, i8080* const c);
+bool i8080_trace_close(i8080_trace* const t);
+
+i8080_trace_reader* i8080_trace_read_open(FILE* f);
+bool i8080_trace_read(i8080_trace_reader* const r, i8080_trace_record* rec);
+void i8080_trace_read_close(i8080_trace_reader* const r);
+
+#endif // I8080_I8080_TRACE_H_
@@ -0,0 +1,374 @@
+// wide mode, included by i8080.c: up to I8080_WIDE_LANES emulators (lanes)
+// running the same program are stepped in lockstep. Their registers are
+// stored as arrays (i8080_wide), and the lanes about to execute the same
+// opcode are executed together: moves, ALU operations, increments and
+// decrements are computed for all of them at once with SIMD (SSE2 when
+// available, plain loops otherwise). The other instructions, and the lanes
+// which are halted or have an interrupt to service, are executed one by one
+// by the interpreter, on the i8080 of the lane.
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+// 16 bytes vectors, one byte per lane
+
+#ifdef __SSE2__
+typedef __m128i i8080_vec;
+
+static inline i8080_vec vec_load(const uint8_t* p) {
+  return _mm_loadu_si128((const __m128i*) p);
+}
+static inline void vec_store(uint8_t* p, i8080_vec v) {
+  _mm_storeu_si128((__m128i*) p, v);
+}
+static inline i8080_vec vec_set(uint8_t x) {
+  return _mm_set1_epi8((char) x);
+}
+static inline i8080_vec vec_add(i8080_vec a, i8080_vec b) {
+  return _mm_add_epi8(a, b);
+}
+static inline i8080_vec vec_sub(i8080_vec a, i8080_vec b) {
+  return _mm_sub_epi8(a, b);
+}
+static inline i8080_vec vec_and(i8080_vec a, i8080_vec b) {
+  return _mm_and_si128(a, b);
+}
+static inline i8080_vec vec_or(i8080_vec a, i8080_vec b) {
+  return _mm_or_si128(a, b);
+}
+static inline i8080_vec vec_xor(i8080_vec a, i8080_vec b) {
+  return _mm_xor_si128(a, b);
+}
+// 0xFF where a == b, 0 elsewhere
+static inline i8080_vec vec_eq(i8080_vec a, i8080_vec b) {
+  return _mm_cmpeq_epi8(a, b);
+}
+// unsigned maximum
+static inline i8080_vec vec_max(i8080_vec a, i8080_vec b) {
+  return _mm_max_epu8(a, b);
+}
+// shifts: bits moving across lanes are undefined (SSE2 only shifts words)
+static inline i8080_vec vec_shr(i8080_vec a, int n) {
+  return _mm_srli_epi16(a, n);
+}
+static inline i8080_vec vec_shl(i8080_vec a, int n) {
+  return _mm_slli_epi16(a, n);
+}
+#else
+typedef struct i8080_vec {
+  uint8_t v[I8080_WIDE_LANES];
+} i8080_vec;
+
+#define VEC_OP(name, expr) \
+  static inline i8080_vec vec_##name(i8080_vec a, i8080_vec b) { \
+    i8080_vec r; \
+    for (int i = 0; i < I8080_WIDE_LANES; i++) { \
+      r.v[i] = (expr); \
+    } \
+    return r; \
+  }
+VEC_OP(add, a.v[i] + b.v[i])
+VEC_OP(sub, a.v[i] - b.v[i])
+VEC_OP(and, a.v[i] & b.v[i])
+VEC_OP(or, a.v[i] | b.v[i])
+VEC_OP(xor, a.v[i] ^ b.v[i])
+VEC_OP(eq, a.v[i] == b.v[i] ? 0xFF : 0)
+VEC_OP(max, a.v[i] > b.v[i] ? a.v[i] : b.v[i])
+#undef VEC_OP
+
+static inline i8080_vec vec_load(const uint8_t* p) {
+  i8080_vec r;
+  memcpy(r.v, p, I8080_WIDE_LANES);
+  return r;
+}
+static inline void vec_store(uint8_t* p, i8080_vec v) {
+  memcpy(p, v.v, I8080_WIDE_LANES);
+}
+static inline i8080_vec vec_set(uint8_t x) {
+  i8080_vec r;
+  memset(r.v, x, I8080_WIDE_LANES);
+  return r;
+}
+static inline i8080_vec vec_shr(i8080_vec a, int n) {
+  for (int i = 0; i < I8080_WIDE_LANES; i++) {
+    a.v[i] >>= n;
+  }
+  return a;
+}
+static inline i8080_vec vec_shl(i8080_vec a, int n) {
+  for (int i = 0; i < I8080_WIDE_LANES; i++) {
+    a.v[i] <<= n;
+  }
+  return a;
+}
+#endif
+
+// `b` in the lanes of `mask`, `a` in the others
+static inline i8080_vec vec_blend(i8080_vec a, i8080_vec b, i8080_vec mask) {
+  return vec_or(vec_and(mask, b), vec_and(vec_xor(mask, vec_set(0xFF)), a));
+}
+
+// 1 where a < b (unsigned), 0 elsewhere
+static inline i8080_vec vec_below(i8080_vec a, i8080_vec b) {
+  return vec_and(vec_xor(vec_eq(vec_max(a, b), a), vec_set(0xFF)), vec_set(1));
+}
+
+// sign, zero and parity flags of results (with bit 1 set), as ZSP_TABLE
+static inline i8080_vec i8080_wide_zsp(i8080_vec r) {
+  // folds the bits into bit 0 (only bits 0-3 of the shifted values are used,
+  // which don't cross lanes)
+  i8080_vec p = vec_xor(r, vec_shr(r, 4));
+  p = vec_xor(p, vec_shr(p, 2));
+  p = vec_xor(p, vec_shr(p, 1));
+  p = vec_and(vec_xor(p, vec_set(1)), vec_set(1));
+
+  i8080_vec f = vec_and(r, vec_set(I8080_SF));
+  f = vec_or(f, vec_and(vec_eq(r, vec_set(0)), vec_set(I8080_ZF)));
+  f = vec_or(f, vec_shl(p, 2));
+  return vec_or(f, vec_set(0x02));
+}
+
+// executes an ALU operation (ADD, ADC, SUB, SBB, ANA, XRA, ORA, CMP) between
+// register A and `v` in the lanes of `mask`, as i8080_add...i8080_cmp
+static void i8080_wide_alu(
+    i8080_wide* const w, int op, i8080_vec v, i8080_vec mask) {
+  const i8080_vec a = vec_load(w->a);
+  const i8080_vec f = vec_load(w->f);
+  const i8080_vec cy = op == 1 || op == 3 ? vec_and(f, vec_set(1)) : vec_set(0);
+  i8080_vec r, aux, carry;
+
+  switch (op) {
+  case 0: // ADD
+  case 1: { // ADC
+    const i8080_vec sum = vec_add(a, v);
+    r = vec_add(sum, cy);
+    aux = vec_xor(vec_xor(a, v), r);
+    carry = vec_or(vec_below(sum, a), vec_below(r, sum));
+    break;
+  }
+  case 2: // SUB
+  case 3: // SBB
+  case 7: { // CMP
+    const i8080_vec diff = vec_sub(a, v);
+    r = vec_sub(diff, cy);
+    aux = vec_xor(vec_xor(vec_xor(a, v), r), vec_set(0xFF));
+    carry = vec_or(vec_below(a, v), vec_below(diff, cy));
+    break;
+  }
+  case 4: // ANA
+    r = vec_and(a, v);
+    aux = vec_shl(vec_or(a, v), 1);
+    carry = vec_set(0);
+    break;
+  case 5: // XRA
+    r = vec_xor(a, v);
+    aux = carry = vec_set(0);
+    break;
+  default: // ORA
+    r = vec_or(a, v);
+    aux = carry = vec_set(0);
+    break;
+  }
+
+  const i8080_vec flags = vec_or(i8080_wide_zsp(r),
+      vec_or(vec_and(aux, vec_set(I8080_HF)), carry));
+  vec_store(w->f, vec_blend(f, flags, mask));
+  if (op != 7) {
+    vec_store(w->a, vec_blend(a, r, mask));
+  }
+}
+
+// increments (or decrements) `v` in the lanes of `mask`, as i8080_inr and
+// i8080_dcr. Returns the results.
+static i8080_vec i8080_wide_inr_dcr(
+    i8080_wide* const w, i8080_vec v, bool dcr, i8080_vec mask) {
+  const i8080_vec f = vec_load(w->f);
+  const i8080_vec r = dcr ? vec_sub(v, vec_set(1)) : vec_add(v, vec_set(1));
+  const i8080_vec low = vec_and(r, vec_set(0x0F));
+
+  i8080_vec hf = vec_eq(low, vec_set(dcr ? 0x0F : 0));
+  if (dcr) {
+    hf = vec_xor(hf, vec_set(0xFF));
+  }
+
+  const i8080_vec flags = vec_or(vec_and(f, vec_set(I8080_CF)),
+      vec_or(i8080_wide_zsp(r), vec_and(hf, vec_set(I8080_HF))));
+  vec_store(w->f, vec_blend(f, flags, mask));
+  return r;
+}
+
+// copies the registers of a lane to its i8080, and back
+static void i8080_wide_store_lane(i8080_wide* const w, int i) {
+  i8080* const c = w->lanes[i];
+  c->a = w->a[i];
+  c->b = w->b[i];
+  c->c = w->c[i];
+  c->d = w->d[i];
+  c->e = w->e[i];
+  c->h = w->h[i];
+  c->l = w->l[i];
+  c->f = w->f[i];
+#ifdef I8080_LAZY_FLAGS
+  c->lazy_flags = 0;
+#endif
+  c->pc = w->pc[i];
+  c->sp = w->sp[i];
+  c->cyc = w->cyc[i];
+}
+
+static void i8080_wide_load_lane(i8080_wide* const w, int i) {
+  i8080* const c = w->lanes[i];
+  i8080_sync_flags(c);
+  w->a[i] = c->a;
+  w->b[i] = c->b;
+  w->c[i] = c->c;
+  w->d[i] = c->d;
+  w->e[i] = c->e;
+  w->h[i] = c->h;
+  w->l[i] = c->l;
+  w->f[i] = c->f;
+  w->pc[i] = c->pc;
+  w->sp[i] = c->sp;
+  w->cyc[i] = c->cyc;
+}
+
+// returns if an opcode has a wide implementation: moves, ALU operations,
+// increments and decrements of 8 bits registers (or memory)
+static inline bool i8080_wide_supported(uint8_t opcode) {
+  if (opcode < 0x40) {
+    return (opcode & 7) >= 4 && (opcode & 7) <= 6; // INR, DCR, MVI
+  }
+  if (opcode < 0xC0) {
+    return opcode != 0x76; // MOV, ALU operations (but HLT)
+  }
+  return (opcode & 7) == 6; // ALU operations with an immediate
+}
+
+// executes `opcode` in the lanes of `group`, which are all about to execute
+// it
+static void i8080_wide_execute(
+    i8080_wide* const w, uint8_t opcode, uint32_t group) {
+  if (!i8080_wide_supported(opcode)) {
+    for (int i = 0; i < w->nb_lanes; i++) {
+      if (group & (1u << i)) {
+        i8080_wide_store_lane(w, i);
+        i8080_step(w->lanes[i]);
+        i8080_wide_load_lane(w, i);
+      }
+    }
+    return;
+  }
+
+  uint8_t* const regs[8] = {w->b, w->c, w->d, w->e, w->h, w->l, NULL, w->a};
+  const int dst = (opcode >> 3) & 7;
+  const int src = opcode < 0x40 ? dst : opcode & 7;
+  uint8_t lanes_mask[I8080_WIDE_LANES] = {0};
+  uint8_t operand[I8080_WIDE_LANES] = {0};
+  uint16_t hl[I8080_WIDE_LANES] = {0};
+
+  // fetches the operands (immediate or at HL)
+  for (int i = 0; i < w->nb_lanes; i++) {
+    if (!(group & (1u << i))) {
+      continue;
+    }
+    i8080* const c = w->lanes[i];
+    lanes_mask[i] = 0xFF;
+    w->cyc[i] += OPCODES_CYCLES[opcode];
+    COUNT(c, opcodes[opcode], 1);
+    PROFILE(c, w->pc[i], OPCODES_CYCLES[opcode]);
+    w->pc[i] += OPCODES_LENGTH[opcode];
+    hl[i] = w->h[i] << 8 | w->l[i];
+
+    if (OPCODES_LENGTH[opcode] == 2) {
+      operand[i] = i8080_fetch(c, w->pc[i] - 1);
+    } else if (src == 6) {
+      operand[i] = i8080_rb(c, hl[i]);
+    }
+  }
+
+  const i8080_vec mask = vec_load(lanes_mask);
+  const i8080_vec v = (src == 6 || OPCODES_LENGTH[opcode] == 2)
+                          ? vec_load(operand)
+                          : vec_load(regs[src]);
+  i8080_vec result;
+
+  if (opcode >= 0x80) {
+    i8080_wide_alu(w, (opcode >> 3) & 7, v, mask);
+    return;
+  } else if (opcode >= 0x40 || (opcode & 7) == 6) { // MOV, MVI
+    result = v;
+  } else { // INR, DCR
+    result = i8080_wide_inr_dcr(w, v, opcode & 1, mask);
+  }
+
+  if (dst != 6) {
+    vec_store(regs[dst], vec_blend(vec_load(regs[dst]), result, mask));
+    return;
+  }
+
+  vec_store(operand, result);
+  for (int i = 0; i < w->nb_lanes; i++) {
+    if (group & (1u << i)) {
+      i8080_wb(w->lanes[i], hl[i], operand[i]);
+    }
+  }
+}
+
+// starts the wide execution of `nb_lanes` emulators (up to
+// I8080_WIDE_LANES), which keep their memory map, callbacks and interrupt
+// state. Their registers are copied to `w`: use i8080_wide_sync to update
+// them.
+void i8080_wide_init(i8080_wide* const w, i8080* const* lanes, int nb_lanes) {
+  memset(w, 0, sizeof(i8080_wide));
+  w->nb_lanes = nb_lanes < I8080_WIDE_LANES ? nb_lanes : I8080_WIDE_LANES;
+  for (int i = 0; i < w->nb_lanes; i++) {
+    w->lanes[i] = lanes[i];
+    i8080_wide_load_lane(w, i);
+  }
+}
+
+// executes one instruction in each lane, as i8080_step
+void i8080_wide_step(i8080_wide* const w) {
+  uint8_t opcodes[I8080_WIDE_LANES];
+  uint32_t pending = 0;
+
+  for (int i = 0; i < w->nb_lanes; i++) {
+    i8080* const c = w->lanes[i];
+    if (i8080_interrupt_ready(c) || c->interrupt_delay > 0) {
+      // the interpreter takes care of the interrupt state
+      i8080_wide_store_lane(w, i);
+      i8080_step(c);
+      i8080_wide_load_lane(w, i);
+    } else if (!c->halted) {
+      opcodes[i] = i8080_fetch(c, w->pc[i]);
+      pending |= 1u << i;
+    }
+  }
+
+  // the lanes which diverged are executed in separate groups
+  while (pending != 0) {
+    int first = 0;
+    while (!(pending & (1u << first))) {
+      first += 1;
+    }
+
+    uint32_t group = 0;
+    for (int i = first; i < w->nb_lanes; i++) {
+      if ((pending & (1u << i)) && opcodes[i] == opcodes[first]) {
+        group |= 1u << i;
+      }
+    }
+
+    i8080_wide_execute(w, opcodes[first], group);
+    pending &= ~group;
+    w->groups += 1;
+  }
+}
+
+// copies the registers of the lanes back to their i8080
+void i8080_wide_sync(i8080_wide* const w) {
+  for (int i = 0; i < w->nb_lanes; i++) {
+    i8080_wide_store_lane(w, i);
+  }
+}
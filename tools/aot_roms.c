@@ -0,0 +1,27117 @@
+// generated by i8080_aot: do not edit
+
+#include "i8080_aot_runtime.h"
+
+// goes on with the block at `addr`, unless the cycles have been spent or
+// an event has been raised
+#define JUMP(addr) \
+  do { \
+    if (EVENTS(c) != 0 || c->cyc - start >= cycles) { \
+      return n; \
+    } \
+    goto b_##addr; \
+  } while (0)
+
+// cpu_tests/TST8080.COM: 699 instructions in 216 blocks
+static unsigned long rom_tst8080_com(i8080* const c, unsigned long cycles) {
+  const unsigned long start = c->cyc;
+  unsigned long n = 0;
+
+dispatch:
+  if (EVENTS(c) != 0 || c->cyc - start >= cycles) {
+    return n;
+  }
+
+  switch (c->pc) {
+  case 0x0100: goto b_0x0100;
+  case 0x014B: goto b_0x014B;
+  case 0x014C:
+    if (i8080_aot_code(c, 0x014C, "\xEB\x0E\x09\xCD\x05\x00", 6)) {
+      goto i_0x014C;
+    }
+    break;
+  case 0x0152: goto b_0x0152;
+  case 0x0153:
+    if (i8080_aot_code(c, 0x0153, "\xC9", 1)) {
+      goto i_0x0153;
+    }
+    break;
+  case 0x0154: goto b_0x0154;
+  case 0x0159: goto b_0x0159;
+  case 0x015A: goto b_0x015A;
+  case 0x015B:
+    if (i8080_aot_code(c, 0x015B, "\xCD\x6A\x01", 3)) {
+      goto i_0x015B;
+    }
+    break;
+  case 0x015E: goto b_0x015E;
+  case 0x0162: goto b_0x0162;
+  case 0x0163:
+    if (i8080_aot_code(c, 0x0163, "\xCD\x6E\x01", 3)) {
+      goto i_0x0163;
+    }
+    break;
+  case 0x0166: goto b_0x0166;
+  case 0x016A: goto b_0x016A;
+  case 0x016E: goto b_0x016E;
+  case 0x0175: goto b_0x0175;
+  case 0x0177: goto b_0x0177;
+  case 0x01B2: goto b_0x01B2;
+  case 0x01BB: goto b_0x01BB;
+  case 0x01C0: goto b_0x01C0;
+  case 0x01C3: goto b_0x01C3;
+  case 0x01C6: goto b_0x01C6;
+  case 0x01C9: goto b_0x01C9;
+  case 0x01CC: goto b_0x01CC;
+  case 0x01CF: goto b_0x01CF;
+  case 0x01D2: goto b_0x01D2;
+  case 0x01D5: goto b_0x01D5;
+  case 0x01D8: goto b_0x01D8;
+  case 0x01DB: goto b_0x01DB;
+  case 0x01DE: goto b_0x01DE;
+  case 0x01E1: goto b_0x01E1;
+  case 0x01E4: goto b_0x01E4;
+  case 0x01E7: goto b_0x01E7;
+  case 0x01EC: goto b_0x01EC;
+  case 0x01EF: goto b_0x01EF;
+  case 0x01F2: goto b_0x01F2;
+  case 0x01F5: goto b_0x01F5;
+  case 0x01F8: goto b_0x01F8;
+  case 0x01FB: goto b_0x01FB;
+  case 0x0200: goto b_0x0200;
+  case 0x0203: goto b_0x0203;
+  case 0x0206: goto b_0x0206;
+  case 0x0209: goto b_0x0209;
+  case 0x020C: goto b_0x020C;
+  case 0x020F: goto b_0x020F;
+  case 0x0214: goto b_0x0214;
+  case 0x0217: goto b_0x0217;
+  case 0x021A: goto b_0x021A;
+  case 0x021D: goto b_0x021D;
+  case 0x0220: goto b_0x0220;
+  case 0x0223: goto b_0x0223;
+  case 0x0228: goto b_0x0228;
+  case 0x022B: goto b_0x022B;
+  case 0x022E: goto b_0x022E;
+  case 0x0231: goto b_0x0231;
+  case 0x0234: goto b_0x0234;
+  case 0x0237: goto b_0x0237;
+  case 0x023C: goto b_0x023C;
+  case 0x023F: goto b_0x023F;
+  case 0x0244: goto b_0x0244;
+  case 0x0247: goto b_0x0247;
+  case 0x024C: goto b_0x024C;
+  case 0x024F: goto b_0x024F;
+  case 0x0252: goto b_0x0252;
+  case 0x025B: goto b_0x025B;
+  case 0x025E: goto b_0x025E;
+  case 0x0267: goto b_0x0267;
+  case 0x026A: goto b_0x026A;
+  case 0x0273: goto b_0x0273;
+  case 0x0276: goto b_0x0276;
+  case 0x027D: goto b_0x027D;
+  case 0x0280: goto b_0x0280;
+  case 0x0287: goto b_0x0287;
+  case 0x028A: goto b_0x028A;
+  case 0x0291: goto b_0x0291;
+  case 0x0294: goto b_0x0294;
+  case 0x0299: goto b_0x0299;
+  case 0x029C: goto b_0x029C;
+  case 0x029F: goto b_0x029F;
+  case 0x02A2: goto b_0x02A2;
+  case 0x02A7: goto b_0x02A7;
+  case 0x02AA: goto b_0x02AA;
+  case 0x02AF: goto b_0x02AF;
+  case 0x02B2: goto b_0x02B2;
+  case 0x02B5: goto b_0x02B5;
+  case 0x02B8: goto b_0x02B8;
+  case 0x02BD: goto b_0x02BD;
+  case 0x02C0: goto b_0x02C0;
+  case 0x02C5: goto b_0x02C5;
+  case 0x02CA: goto b_0x02CA;
+  case 0x02CD: goto b_0x02CD;
+  case 0x02CE: goto b_0x02CE;
+  case 0x02D3: goto b_0x02D3;
+  case 0x02D6: goto b_0x02D6;
+  case 0x02D9: goto b_0x02D9;
+  case 0x02DA: goto b_0x02DA;
+  case 0x02DF: goto b_0x02DF;
+  case 0x02E2: goto b_0x02E2;
+  case 0x02E5: goto b_0x02E5;
+  case 0x02E6: goto b_0x02E6;
+  case 0x02EB: goto b_0x02EB;
+  case 0x02EE: goto b_0x02EE;
+  case 0x02F1: goto b_0x02F1;
+  case 0x02F2: goto b_0x02F2;
+  case 0x02F7: goto b_0x02F7;
+  case 0x02FA: goto b_0x02FA;
+  case 0x02FD: goto b_0x02FD;
+  case 0x02FE: goto b_0x02FE;
+  case 0x0303: goto b_0x0303;
+  case 0x0306: goto b_0x0306;
+  case 0x0309: goto b_0x0309;
+  case 0x030A: goto b_0x030A;
+  case 0x030F: goto b_0x030F;
+  case 0x0312: goto b_0x0312;
+  case 0x0315: goto b_0x0315;
+  case 0x0316: goto b_0x0316;
+  case 0x031B: goto b_0x031B;
+  case 0x031E: goto b_0x031E;
+  case 0x0321: goto b_0x0321;
+  case 0x0322: goto b_0x0322;
+  case 0x0327: goto b_0x0327;
+  case 0x032A: goto b_0x032A;
+  case 0x033B: goto b_0x033B;
+  case 0x034B: goto b_0x034B;
+  case 0x035B: goto b_0x035B;
+  case 0x0369: goto b_0x0369;
+  case 0x0382: goto b_0x0382;
+  case 0x038D: goto b_0x038D;
+  case 0x0391: goto b_0x0391;
+  case 0x03A9: goto b_0x03A9;
+  case 0x03BA: goto b_0x03BA;
+  case 0x03CE: goto b_0x03CE;
+  case 0x03D1: goto b_0x03D1;
+  case 0x03DA: goto b_0x03DA;
+  case 0x03F4: goto b_0x03F4;
+  case 0x040D: goto b_0x040D;
+  case 0x041E: goto b_0x041E;
+  case 0x0422: goto b_0x0422;
+  case 0x042F:
+    if (i8080_aot_code(c, 0x042F, "\x06\x00\x46\x3E\x44\xB8\xC4\xA0\x06", 9)) {
+      goto i_0x042F;
+    }
+    break;
+  case 0x0432:
+    if (i8080_aot_code(c, 0x0432, "\x3E\x44\xB8\xC4\xA0\x06", 6)) {
+      goto i_0x0432;
+    }
+    break;
+  case 0x0438: goto b_0x0438;
+  case 0x0439:
+    if (i8080_aot_code(c, 0x0439, "\x0E\x00\x4E\x3E\x45\xB9\xC4\xA0\x06", 9)) {
+      goto i_0x0439;
+    }
+    break;
+  case 0x043C:
+    if (i8080_aot_code(c, 0x043C, "\x3E\x45\xB9\xC4\xA0\x06", 6)) {
+      goto i_0x043C;
+    }
+    break;
+  case 0x0442: goto b_0x0442;
+  case 0x0443:
+    if (i8080_aot_code(c, 0x0443, "\x16\x00\x56\x3E\x46\xBA\xC4\xA0\x06", 9)) {
+      goto i_0x0443;
+    }
+    break;
+  case 0x0446:
+    if (i8080_aot_code(c, 0x0446, "\x3E\x46\xBA\xC4\xA0\x06", 6)) {
+      goto i_0x0446;
+    }
+    break;
+  case 0x044C: goto b_0x044C;
+  case 0x044D:
+    if (i8080_aot_code(c, 0x044D, "\x1E\x00\x5E\x3E\x47\xBB\xC4\xA0\x06", 9)) {
+      goto i_0x044D;
+    }
+    break;
+  case 0x0450:
+    if (i8080_aot_code(c, 0x0450, "\x3E\x47\xBB\xC4\xA0\x06", 6)) {
+      goto i_0x0450;
+    }
+    break;
+  case 0x0456: goto b_0x0456;
+  case 0x0457:
+    if (i8080_aot_code(c, 0x0457, "\x26\x06\x2E\xBF\x66\x3E\x06\xBC\xC4\xA0\x06", 11)) {
+      goto i_0x0457;
+    }
+    break;
+  case 0x045C:
+    if (i8080_aot_code(c, 0x045C, "\x3E\x06\xBC\xC4\xA0\x06", 6)) {
+      goto i_0x045C;
+    }
+    break;
+  case 0x0462: goto b_0x0462;
+  case 0x0463:
+    if (i8080_aot_code(c, 0x0463, "\x26\x06\x2E\xBF\x6E\x3E\xBF\xBD\xC4\xA0\x06", 11)) {
+      goto i_0x0463;
+    }
+    break;
+  case 0x0468:
+    if (i8080_aot_code(c, 0x0468, "\x3E\xBF\xBD\xC4\xA0\x06", 6)) {
+      goto i_0x0468;
+    }
+    break;
+  case 0x046E: goto b_0x046E;
+  case 0x0475:
+    if (i8080_aot_code(c, 0x0475, "\xBE\xC4\xA0\x06", 4)) {
+      goto i_0x0475;
+    }
+    break;
+  case 0x0476:
+    if (i8080_aot_code(c, 0x0476, "\xC4\xA0\x06", 3)) {
+      goto i_0x0476;
+    }
+    break;
+  case 0x0479: goto b_0x0479;
+  case 0x047A:
+    if (i8080_aot_code(c, 0x047A, "\xFE\x64\xC4\xA0\x06", 5)) {
+      goto i_0x047A;
+    }
+    break;
+  case 0x047F: goto b_0x047F;
+  case 0x0481:
+    if (i8080_aot_code(c, 0x0481, "\xFE\x32\xC4\xA0\x06", 5)) {
+      goto i_0x0481;
+    }
+    break;
+  case 0x0486: goto b_0x0486;
+  case 0x048B:
+    if (i8080_aot_code(c, 0x048B, "\x96\xC4\xA0\x06", 4)) {
+      goto i_0x048B;
+    }
+    break;
+  case 0x048C:
+    if (i8080_aot_code(c, 0x048C, "\xC4\xA0\x06", 3)) {
+      goto i_0x048C;
+    }
+    break;
+  case 0x048F: goto b_0x048F;
+  case 0x0493:
+    if (i8080_aot_code(c, 0x0493, "\xFE\x33\xC4\xA0\x06", 5)) {
+      goto i_0x0493;
+    }
+    break;
+  case 0x0498: goto b_0x0498;
+  case 0x049C:
+    if (i8080_aot_code(c, 0x049C, "\xFE\xCD\xC4\xA0\x06", 5)) {
+      goto i_0x049C;
+    }
+    break;
+  case 0x04A1: goto b_0x04A1;
+  case 0x04A2:
+    if (i8080_aot_code(c, 0x04A2, "\xC4\xA0\x06", 3)) {
+      goto i_0x04A2;
+    }
+    break;
+  case 0x04A5: goto b_0x04A5;
+  case 0x04A8:
+    if (i8080_aot_code(c, 0x04A8, "\xFE\x37\xC4\xA0\x06", 5)) {
+      goto i_0x04A8;
+    }
+    break;
+  case 0x04AD: goto b_0x04AD;
+  case 0x04AE:
+    if (i8080_aot_code(c, 0x04AE, "\xFE\x05\xC4\xA0\x06", 5)) {
+      goto i_0x04AE;
+    }
+    break;
+  case 0x04B3: goto b_0x04B3;
+  case 0x04B5:
+    if (i8080_aot_code(c, 0x04B5, "\x34\x35\x86\xFE\x5A\xC4\xA0\x06", 8)) {
+      goto i_0x04B5;
+    }
+    break;
+  case 0x04B6:
+    if (i8080_aot_code(c, 0x04B6, "\x35\x86\xFE\x5A\xC4\xA0\x06", 7)) {
+      goto i_0x04B6;
+    }
+    break;
+  case 0x04B7:
+    if (i8080_aot_code(c, 0x04B7, "\x86\xFE\x5A\xC4\xA0\x06", 6)) {
+      goto i_0x04B7;
+    }
+    break;
+  case 0x04B8:
+    if (i8080_aot_code(c, 0x04B8, "\xFE\x5A\xC4\xA0\x06", 5)) {
+      goto i_0x04B8;
+    }
+    break;
+  case 0x04BD: goto b_0x04BD;
+  case 0x04CF: goto b_0x04CF;
+  case 0x04D3: goto b_0x04D3;
+  case 0x04D7: goto b_0x04D7;
+  case 0x04DD: goto b_0x04DD;
+  case 0x04E1: goto b_0x04E1;
+  case 0x04E5: goto b_0x04E5;
+  case 0x04EE: goto b_0x04EE;
+  case 0x04F2: goto b_0x04F2;
+  case 0x04F6: goto b_0x04F6;
+  case 0x04FC: goto b_0x04FC;
+  case 0x0500: goto b_0x0500;
+  case 0x0504: goto b_0x0504;
+  case 0x0507:
+    if (i8080_aot_code(c, 0x0507, "\xAF\x3A\xBF\x06\xFE\xFF\xC4\xA0\x06", 9)) {
+      goto i_0x0507;
+    }
+    break;
+  case 0x050B:
+    if (i8080_aot_code(c, 0x050B, "\xFE\xFF\xC4\xA0\x06", 5)) {
+      goto i_0x050B;
+    }
+    break;
+  case 0x0510: goto b_0x0510;
+  case 0x0513:
+    if (i8080_aot_code(c, 0x0513, "\x22\xBF\x06\x3A\xBD\x06\x47\x3A\xBF\x06\xB8\xC4\xA0\x06", 14)) {
+      goto i_0x0513;
+    }
+    break;
+  case 0x0516:
+    if (i8080_aot_code(c, 0x0516, "\x3A\xBD\x06\x47\x3A\xBF\x06\xB8\xC4\xA0\x06", 11)) {
+      goto i_0x0516;
+    }
+    break;
+  case 0x0519:
+    if (i8080_aot_code(c, 0x0519, "\x47\x3A\xBF\x06\xB8\xC4\xA0\x06", 8)) {
+      goto i_0x0519;
+    }
+    break;
+  case 0x051D:
+    if (i8080_aot_code(c, 0x051D, "\xB8\xC4\xA0\x06", 4)) {
+      goto i_0x051D;
+    }
+    break;
+  case 0x0521: goto b_0x0521;
+  case 0x0524:
+    if (i8080_aot_code(c, 0x0524, "\x47\x3A\xC0\x06\xB8\xC4\xA0\x06", 8)) {
+      goto i_0x0524;
+    }
+    break;
+  case 0x0528:
+    if (i8080_aot_code(c, 0x0528, "\xB8\xC4\xA0\x06", 4)) {
+      goto i_0x0528;
+    }
+    break;
+  case 0x052C: goto b_0x052C;
+  case 0x0531:
+    if (i8080_aot_code(c, 0x0531, "\x44\x4D\xAF\x0A\xFE\xAA\xC4\xA0\x06", 9)) {
+      goto i_0x0531;
+    }
+    break;
+  case 0x0535:
+    if (i8080_aot_code(c, 0x0535, "\xFE\xAA\xC4\xA0\x06", 5)) {
+      goto i_0x0535;
+    }
+    break;
+  case 0x053A: goto b_0x053A;
+  case 0x053C:
+    if (i8080_aot_code(c, 0x053C, "\x3A\xBF\x06\xFE\xAB\xC4\xA0\x06", 8)) {
+      goto i_0x053C;
+    }
+    break;
+  case 0x053F:
+    if (i8080_aot_code(c, 0x053F, "\xFE\xAB\xC4\xA0\x06", 5)) {
+      goto i_0x053F;
+    }
+    break;
+  case 0x0544: goto b_0x0544;
+  case 0x0549:
+    if (i8080_aot_code(c, 0x0549, "\x2A\xBD\x06\x11\x00\x00\xEB\xAF\x1A\xFE\x77\xC4\xA0\x06", 14)) {
+      goto i_0x0549;
+    }
+    break;
+  case 0x054C:
+    if (i8080_aot_code(c, 0x054C, "\x11\x00\x00\xEB\xAF\x1A\xFE\x77\xC4\xA0\x06", 11)) {
+      goto i_0x054C;
+    }
+    break;
+  case 0x0552:
+    if (i8080_aot_code(c, 0x0552, "\xFE\x77\xC4\xA0\x06", 5)) {
+      goto i_0x0552;
+    }
+    break;
+  case 0x0557: goto b_0x0557;
+  case 0x055D: goto b_0x055D;
+  case 0x0560:
+    if (i8080_aot_code(c, 0x0560, "\x3A\xBF\x06\xFE\xCC\x12\x3A\xBF\x06\xFE\xCC\xC4\xA0\x06", 14)) {
+      goto i_0x0560;
+    }
+    break;
+  case 0x0563:
+    if (i8080_aot_code(c, 0x0563, "\xFE\xCC\x12\x3A\xBF\x06\xFE\xCC\xC4\xA0\x06", 11)) {
+      goto i_0x0563;
+    }
+    break;
+  case 0x0566:
+    if (i8080_aot_code(c, 0x0566, "\x3A\xBF\x06\xFE\xCC\xC4\xA0\x06", 8)) {
+      goto i_0x0566;
+    }
+    break;
+  case 0x0569:
+    if (i8080_aot_code(c, 0x0569, "\xFE\xCC\xC4\xA0\x06", 5)) {
+      goto i_0x0569;
+    }
+    break;
+  case 0x056E: goto b_0x056E;
+  case 0x0578: goto b_0x0578;
+  case 0x057C: goto b_0x057C;
+  case 0x0588: goto b_0x0588;
+  case 0x058C: goto b_0x058C;
+  case 0x0592: goto b_0x0592;
+  case 0x059F: goto b_0x059F;
+  case 0x05A3: goto b_0x05A3;
+  case 0x05A7: goto b_0x05A7;
+  case 0x05AB: goto b_0x05AB;
+  case 0x05B3: goto b_0x05B3;
+  case 0x05BA: goto b_0x05BA;
+  case 0x05C3: goto b_0x05C3;
+  case 0x05CA: goto b_0x05CA;
+  case 0x05CF: goto b_0x05CF;
+  case 0x05D6: goto b_0x05D6;
+  case 0x05D9: goto b_0x05D9;
+  case 0x05E0: goto b_0x05E0;
+  case 0x05E4: goto b_0x05E4;
+  case 0x05E9: goto b_0x05E9;
+  case 0x05ED: goto b_0x05ED;
+  case 0x05F3: goto b_0x05F3;
+  case 0x05F8: goto b_0x05F8;
+  case 0x05FD: goto b_0x05FD;
+  case 0x0602: goto b_0x0602;
+  case 0x0607: goto b_0x0607;
+  case 0x0612:
+    if (i8080_aot_code(c, 0x0612, "\xD5\xE5\xF5\x01\x00\x00\x11\x00\x00\x21\x00\x00\x3E\xC0\xC6\xF0\xF1\xE1\xD1", 19)) {
+      goto i_0x0612;
+    }
+    break;
+  case 0x0613:
+    if (i8080_aot_code(c, 0x0613, "\xE5\xF5\x01\x00\x00\x11\x00\x00\x21\x00\x00\x3E\xC0\xC6\xF0\xF1\xE1\xD1", 18)) {
+      goto i_0x0613;
+    }
+    break;
+  case 0x0614:
+    if (i8080_aot_code(c, 0x0614, "\xF5\x01\x00\x00\x11\x00\x00\x21\x00\x00\x3E\xC0\xC6\xF0\xF1\xE1\xD1", 17)) {
+      goto i_0x0614;
+    }
+    break;
+  case 0x0615:
+    if (i8080_aot_code(c, 0x0615, "\x01\x00\x00\x11\x00\x00\x21\x00\x00\x3E\xC0\xC6\xF0\xF1\xE1\xD1", 16)) {
+      goto i_0x0615;
+    }
+    break;
+  case 0x0623:
+    if (i8080_aot_code(c, 0x0623, "\xE1\xD1", 2)) {
+      goto i_0x0623;
+    }
+    break;
+  case 0x0624:
+    if (i8080_aot_code(c, 0x0624, "\xD1", 1)) {
+      goto i_0x0624;
+    }
+    break;
+  case 0x0625: goto b_0x0625;
+  case 0x0626:
+    if (i8080_aot_code(c, 0x0626, "\xDC\xA0\x06", 3)) {
+      goto i_0x0626;
+    }
+    break;
+  case 0x0629: goto b_0x0629;
+  case 0x062C: goto b_0x062C;
+  case 0x062F: goto b_0x062F;
+  case 0x0632: goto b_0x0632;
+  case 0x0638: goto b_0x0638;
+  case 0x063E: goto b_0x063E;
+  case 0x0644: goto b_0x0644;
+  case 0x0648: goto b_0x0648;
+  case 0x064E: goto b_0x064E;
+  case 0x0652: goto b_0x0652;
+  case 0x0659:
+    if (i8080_aot_code(c, 0x0659, "\x31\xC3\x06\x3B\x3B\x33\x3B\x3E\x55\x32\xC1\x06\x2F\x32\xC2\x06\xC1\xB8\xC4\xA0\x06", 21)) {
+      goto i_0x0659;
+    }
+    break;
+  case 0x0665:
+    if (i8080_aot_code(c, 0x0665, "\x2F\x32\xC2\x06\xC1\xB8\xC4\xA0\x06", 9)) {
+      goto i_0x0665;
+    }
+    break;
+  case 0x0669:
+    if (i8080_aot_code(c, 0x0669, "\xC1\xB8\xC4\xA0\x06", 5)) {
+      goto i_0x0669;
+    }
+    break;
+  case 0x066A:
+    if (i8080_aot_code(c, 0x066A, "\xB8\xC4\xA0\x06", 4)) {
+      goto i_0x066A;
+    }
+    break;
+  case 0x066E: goto b_0x066E;
+  case 0x0673: goto b_0x0673;
+  case 0x067D:
+    if (i8080_aot_code(c, 0x067D, "\x3A\xC2\x06\xFE\x77\xC4\xA0\x06", 8)) {
+      goto i_0x067D;
+    }
+    break;
+  case 0x0680:
+    if (i8080_aot_code(c, 0x0680, "\xFE\x77\xC4\xA0\x06", 5)) {
+      goto i_0x0680;
+    }
+    break;
+  case 0x0685: goto b_0x0685;
+  case 0x0688:
+    if (i8080_aot_code(c, 0x0688, "\xFE\x33\xC4\xA0\x06", 5)) {
+      goto i_0x0688;
+    }
+    break;
+  case 0x068D: goto b_0x068D;
+  case 0x0693: goto b_0x0693;
+  case 0x0698: goto b_0x0698;
+  case 0x069B:
+    if (i8080_aot_code(c, 0x069B, "\xF9\x21\xB4\x06\xE9", 5)) {
+      goto i_0x069B;
+    }
+    break;
+  case 0x06A0: goto b_0x06A0;
+  case 0x06A6: goto b_0x06A6;
+  case 0x06A7:
+    if (i8080_aot_code(c, 0x06A7, "\xE5\x7C\xCD\x5A\x01", 5)) {
+      goto i_0x06A7;
+    }
+    break;
+  case 0x06A8:
+    if (i8080_aot_code(c, 0x06A8, "\x7C\xCD\x5A\x01", 4)) {
+      goto i_0x06A8;
+    }
+    break;
+  case 0x06AC: goto b_0x06AC;
+  case 0x06AD:
+    if (i8080_aot_code(c, 0x06AD, "\x7D\xCD\x5A\x01", 4)) {
+      goto i_0x06AD;
+    }
+    break;
+  case 0x06B1: goto b_0x06B1;
+  }
+
+fallback:
+  // not recompiled, or modified since
+  n += i8080_aot_fallback(c);
+  goto dispatch;
+
+b_0x0100:
+  if (!(i8080_aot_code(c, 0x0100, "\xC3\xB2\x01", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0103;
+  i8080_aot_op_0xC3(c, 0x01B2); // jmp $01B2
+  n += 1;
+  JUMP(0x01B2);
+
+b_0x014B:
+  if (!(i8080_aot_code(c, 0x014B, "\xD5\xEB\x0E\x09\xCD\x05\x00", 7))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x014C;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x014B) < 7) {
+    goto dispatch;
+  }
+i_0x014C:
+  i8080_aot_op_0xEB(c, 0x0000); // xchg
+  n += 1;
+  i8080_aot_op_0x0E(c, 0x0009); // mvi c,$09
+  n += 1;
+  c->cyc += 28;
+  c->pc = 0x0152;
+  i8080_aot_op_0xCD(c, 0x0005); // call $0005
+  n += 1;
+  goto dispatch;
+
+b_0x0152:
+  if (!(i8080_aot_code(c, 0x0152, "\xD1\xC9", 2))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0153;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0153:
+  c->cyc += 10;
+  c->pc = 0x0154;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x0154:
+  if (!(i8080_aot_code(c, 0x0154, "\x0E\x02\xCD\x05\x00", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x0E(c, 0x0002); // mvi c,$02
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x0159;
+  i8080_aot_op_0xCD(c, 0x0005); // call $0005
+  n += 1;
+  goto dispatch;
+
+b_0x0159:
+  if (!(i8080_aot_code(c, 0x0159, "\xC9", 1))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x015A;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x015A:
+  if (!(i8080_aot_code(c, 0x015A, "\xF5\xCD\x6A\x01", 4))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x015B;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x015A) < 4) {
+    goto dispatch;
+  }
+i_0x015B:
+  c->cyc += 17;
+  c->pc = 0x015E;
+  i8080_aot_op_0xCD(c, 0x016A); // call $016A
+  n += 1;
+  JUMP(0x016A);
+
+b_0x015E:
+  if (!(i8080_aot_code(c, 0x015E, "\x5F\xCD\x54\x01", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x5F(c, 0x0000); // mov e,a
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x0162;
+  i8080_aot_op_0xCD(c, 0x0154); // call $0154
+  n += 1;
+  JUMP(0x0154);
+
+b_0x0162:
+  if (!(i8080_aot_code(c, 0x0162, "\xF1\xCD\x6E\x01", 4))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0163;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0163:
+  c->cyc += 17;
+  c->pc = 0x0166;
+  i8080_aot_op_0xCD(c, 0x016E); // call $016E
+  n += 1;
+  JUMP(0x016E);
+
+b_0x0166:
+  if (!(i8080_aot_code(c, 0x0166, "\x5F\xC3\x54\x01", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x5F(c, 0x0000); // mov e,a
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x016A;
+  i8080_aot_op_0xC3(c, 0x0154); // jmp $0154
+  n += 1;
+  JUMP(0x0154);
+
+b_0x016A:
+  if (!(i8080_aot_code(c, 0x016A, "\x0F\x0F\x0F\x0F", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x0F(c, 0x0000); // rrc
+  n += 1;
+  i8080_aot_op_0x0F(c, 0x0000); // rrc
+  n += 1;
+  i8080_aot_op_0x0F(c, 0x0000); // rrc
+  n += 1;
+  c->cyc += 16;
+  c->pc = 0x016E;
+  i8080_aot_op_0x0F(c, 0x0000); // rrc
+  n += 1;
+  JUMP(0x016E);
+
+b_0x016E:
+  if (!(i8080_aot_code(c, 0x016E, "\xE6\x0F\xFE\x0A\xFA\x77\x01", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xE6(c, 0x000F); // ani $0F
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x000A); // cpi $0A
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x0175;
+  i8080_aot_op_0xFA(c, 0x0177); // jm $0177
+  n += 1;
+  if (c->pc == 0x0177) {
+    JUMP(0x0177);
+  }
+  JUMP(0x0175);
+
+b_0x0175:
+  if (!(i8080_aot_code(c, 0x0175, "\xC6\x07", 2))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x0177;
+  i8080_aot_op_0xC6(c, 0x0007); // adi $07
+  n += 1;
+  JUMP(0x0177);
+
+b_0x0177:
+  if (!(i8080_aot_code(c, 0x0177, "\xC6\x30\xC9", 3))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xC6(c, 0x0030); // adi $30
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x017A;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x01B2:
+  if (!(i8080_aot_code(c, 0x01B2, "\x31\xBD\x07\x21\x03\x01\xCD\x4B\x01", 9))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x31(c, 0x07BD); // lxi sp,$07BD
+  n += 1;
+  i8080_aot_op_0x21(c, 0x0103); // lxi h,$0103
+  n += 1;
+  c->cyc += 37;
+  c->pc = 0x01BB;
+  i8080_aot_op_0xCD(c, 0x014B); // call $014B
+  n += 1;
+  JUMP(0x014B);
+
+b_0x01BB:
+  if (!(i8080_aot_code(c, 0x01BB, "\xE6\x00\xCA\xC3\x01", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xE6(c, 0x0000); // ani $00
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x01C0;
+  i8080_aot_op_0xCA(c, 0x01C3); // jz $01C3
+  n += 1;
+  if (c->pc == 0x01C3) {
+    JUMP(0x01C3);
+  }
+  JUMP(0x01C0);
+
+b_0x01C0:
+  if (!(i8080_aot_code(c, 0x01C0, "\xCD\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x01C3;
+  i8080_aot_op_0xCD(c, 0x06A0); // call $06A0
+  n += 1;
+  JUMP(0x06A0);
+
+b_0x01C3:
+  if (!(i8080_aot_code(c, 0x01C3, "\xD2\xC9\x01", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x01C6;
+  i8080_aot_op_0xD2(c, 0x01C9); // jnc $01C9
+  n += 1;
+  if (c->pc == 0x01C9) {
+    JUMP(0x01C9);
+  }
+  JUMP(0x01C6);
+
+b_0x01C6:
+  if (!(i8080_aot_code(c, 0x01C6, "\xCD\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x01C9;
+  i8080_aot_op_0xCD(c, 0x06A0); // call $06A0
+  n += 1;
+  JUMP(0x06A0);
+
+b_0x01C9:
+  if (!(i8080_aot_code(c, 0x01C9, "\xEA\xCF\x01", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x01CC;
+  i8080_aot_op_0xEA(c, 0x01CF); // jpe $01CF
+  n += 1;
+  if (c->pc == 0x01CF) {
+    JUMP(0x01CF);
+  }
+  JUMP(0x01CC);
+
+b_0x01CC:
+  if (!(i8080_aot_code(c, 0x01CC, "\xCD\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x01CF;
+  i8080_aot_op_0xCD(c, 0x06A0); // call $06A0
+  n += 1;
+  JUMP(0x06A0);
+
+b_0x01CF:
+  if (!(i8080_aot_code(c, 0x01CF, "\xF2\xD5\x01", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x01D2;
+  i8080_aot_op_0xF2(c, 0x01D5); // jp $01D5
+  n += 1;
+  if (c->pc == 0x01D5) {
+    JUMP(0x01D5);
+  }
+  JUMP(0x01D2);
+
+b_0x01D2:
+  if (!(i8080_aot_code(c, 0x01D2, "\xCD\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x01D5;
+  i8080_aot_op_0xCD(c, 0x06A0); // call $06A0
+  n += 1;
+  JUMP(0x06A0);
+
+b_0x01D5:
+  if (!(i8080_aot_code(c, 0x01D5, "\xC2\xE4\x01", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x01D8;
+  i8080_aot_op_0xC2(c, 0x01E4); // jnz $01E4
+  n += 1;
+  if (c->pc == 0x01E4) {
+    JUMP(0x01E4);
+  }
+  JUMP(0x01D8);
+
+b_0x01D8:
+  if (!(i8080_aot_code(c, 0x01D8, "\xDA\xE4\x01", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x01DB;
+  i8080_aot_op_0xDA(c, 0x01E4); // jc $01E4
+  n += 1;
+  if (c->pc == 0x01E4) {
+    JUMP(0x01E4);
+  }
+  JUMP(0x01DB);
+
+b_0x01DB:
+  if (!(i8080_aot_code(c, 0x01DB, "\xE2\xE4\x01", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x01DE;
+  i8080_aot_op_0xE2(c, 0x01E4); // jpo $01E4
+  n += 1;
+  if (c->pc == 0x01E4) {
+    JUMP(0x01E4);
+  }
+  JUMP(0x01DE);
+
+b_0x01DE:
+  if (!(i8080_aot_code(c, 0x01DE, "\xFA\xE4\x01", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x01E1;
+  i8080_aot_op_0xFA(c, 0x01E4); // jm $01E4
+  n += 1;
+  if (c->pc == 0x01E4) {
+    JUMP(0x01E4);
+  }
+  JUMP(0x01E1);
+
+b_0x01E1:
+  if (!(i8080_aot_code(c, 0x01E1, "\xC3\xE7\x01", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x01E4;
+  i8080_aot_op_0xC3(c, 0x01E7); // jmp $01E7
+  n += 1;
+  JUMP(0x01E7);
+
+b_0x01E4:
+  if (!(i8080_aot_code(c, 0x01E4, "\xCD\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x01E7;
+  i8080_aot_op_0xCD(c, 0x06A0); // call $06A0
+  n += 1;
+  JUMP(0x06A0);
+
+b_0x01E7:
+  if (!(i8080_aot_code(c, 0x01E7, "\xC6\x06\xC2\xEF\x01", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xC6(c, 0x0006); // adi $06
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x01EC;
+  i8080_aot_op_0xC2(c, 0x01EF); // jnz $01EF
+  n += 1;
+  if (c->pc == 0x01EF) {
+    JUMP(0x01EF);
+  }
+  JUMP(0x01EC);
+
+b_0x01EC:
+  if (!(i8080_aot_code(c, 0x01EC, "\xCD\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x01EF;
+  i8080_aot_op_0xCD(c, 0x06A0); // call $06A0
+  n += 1;
+  JUMP(0x06A0);
+
+b_0x01EF:
+  if (!(i8080_aot_code(c, 0x01EF, "\xDA\xF8\x01", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x01F2;
+  i8080_aot_op_0xDA(c, 0x01F8); // jc $01F8
+  n += 1;
+  if (c->pc == 0x01F8) {
+    JUMP(0x01F8);
+  }
+  JUMP(0x01F2);
+
+b_0x01F2:
+  if (!(i8080_aot_code(c, 0x01F2, "\xE2\xF8\x01", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x01F5;
+  i8080_aot_op_0xE2(c, 0x01F8); // jpo $01F8
+  n += 1;
+  if (c->pc == 0x01F8) {
+    JUMP(0x01F8);
+  }
+  JUMP(0x01F5);
+
+b_0x01F5:
+  if (!(i8080_aot_code(c, 0x01F5, "\xF2\xFB\x01", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x01F8;
+  i8080_aot_op_0xF2(c, 0x01FB); // jp $01FB
+  n += 1;
+  if (c->pc == 0x01FB) {
+    JUMP(0x01FB);
+  }
+  JUMP(0x01F8);
+
+b_0x01F8:
+  if (!(i8080_aot_code(c, 0x01F8, "\xCD\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x01FB;
+  i8080_aot_op_0xCD(c, 0x06A0); // call $06A0
+  n += 1;
+  JUMP(0x06A0);
+
+b_0x01FB:
+  if (!(i8080_aot_code(c, 0x01FB, "\xC6\x70\xE2\x03\x02", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xC6(c, 0x0070); // adi $70
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0200;
+  i8080_aot_op_0xE2(c, 0x0203); // jpo $0203
+  n += 1;
+  if (c->pc == 0x0203) {
+    JUMP(0x0203);
+  }
+  JUMP(0x0200);
+
+b_0x0200:
+  if (!(i8080_aot_code(c, 0x0200, "\xCD\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0203;
+  i8080_aot_op_0xCD(c, 0x06A0); // call $06A0
+  n += 1;
+  JUMP(0x06A0);
+
+b_0x0203:
+  if (!(i8080_aot_code(c, 0x0203, "\xFA\x0C\x02", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0206;
+  i8080_aot_op_0xFA(c, 0x020C); // jm $020C
+  n += 1;
+  if (c->pc == 0x020C) {
+    JUMP(0x020C);
+  }
+  JUMP(0x0206);
+
+b_0x0206:
+  if (!(i8080_aot_code(c, 0x0206, "\xCA\x0C\x02", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0209;
+  i8080_aot_op_0xCA(c, 0x020C); // jz $020C
+  n += 1;
+  if (c->pc == 0x020C) {
+    JUMP(0x020C);
+  }
+  JUMP(0x0209);
+
+b_0x0209:
+  if (!(i8080_aot_code(c, 0x0209, "\xD2\x0F\x02", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x020C;
+  i8080_aot_op_0xD2(c, 0x020F); // jnc $020F
+  n += 1;
+  if (c->pc == 0x020F) {
+    JUMP(0x020F);
+  }
+  JUMP(0x020C);
+
+b_0x020C:
+  if (!(i8080_aot_code(c, 0x020C, "\xCD\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x020F;
+  i8080_aot_op_0xCD(c, 0x06A0); // call $06A0
+  n += 1;
+  JUMP(0x06A0);
+
+b_0x020F:
+  if (!(i8080_aot_code(c, 0x020F, "\xC6\x81\xFA\x17\x02", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xC6(c, 0x0081); // adi $81
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0214;
+  i8080_aot_op_0xFA(c, 0x0217); // jm $0217
+  n += 1;
+  if (c->pc == 0x0217) {
+    JUMP(0x0217);
+  }
+  JUMP(0x0214);
+
+b_0x0214:
+  if (!(i8080_aot_code(c, 0x0214, "\xCD\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0217;
+  i8080_aot_op_0xCD(c, 0x06A0); // call $06A0
+  n += 1;
+  JUMP(0x06A0);
+
+b_0x0217:
+  if (!(i8080_aot_code(c, 0x0217, "\xCA\x20\x02", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x021A;
+  i8080_aot_op_0xCA(c, 0x0220); // jz $0220
+  n += 1;
+  if (c->pc == 0x0220) {
+    JUMP(0x0220);
+  }
+  JUMP(0x021A);
+
+b_0x021A:
+  if (!(i8080_aot_code(c, 0x021A, "\xDA\x20\x02", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x021D;
+  i8080_aot_op_0xDA(c, 0x0220); // jc $0220
+  n += 1;
+  if (c->pc == 0x0220) {
+    JUMP(0x0220);
+  }
+  JUMP(0x021D);
+
+b_0x021D:
+  if (!(i8080_aot_code(c, 0x021D, "\xE2\x23\x02", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0220;
+  i8080_aot_op_0xE2(c, 0x0223); // jpo $0223
+  n += 1;
+  if (c->pc == 0x0223) {
+    JUMP(0x0223);
+  }
+  JUMP(0x0220);
+
+b_0x0220:
+  if (!(i8080_aot_code(c, 0x0220, "\xCD\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0223;
+  i8080_aot_op_0xCD(c, 0x06A0); // call $06A0
+  n += 1;
+  JUMP(0x06A0);
+
+b_0x0223:
+  if (!(i8080_aot_code(c, 0x0223, "\xC6\xFE\xDA\x2B\x02", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xC6(c, 0x00FE); // adi $FE
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0228;
+  i8080_aot_op_0xDA(c, 0x022B); // jc $022B
+  n += 1;
+  if (c->pc == 0x022B) {
+    JUMP(0x022B);
+  }
+  JUMP(0x0228);
+
+b_0x0228:
+  if (!(i8080_aot_code(c, 0x0228, "\xCD\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x022B;
+  i8080_aot_op_0xCD(c, 0x06A0); // call $06A0
+  n += 1;
+  JUMP(0x06A0);
+
+b_0x022B:
+  if (!(i8080_aot_code(c, 0x022B, "\xCA\x34\x02", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x022E;
+  i8080_aot_op_0xCA(c, 0x0234); // jz $0234
+  n += 1;
+  if (c->pc == 0x0234) {
+    JUMP(0x0234);
+  }
+  JUMP(0x022E);
+
+b_0x022E:
+  if (!(i8080_aot_code(c, 0x022E, "\xE2\x34\x02", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0231;
+  i8080_aot_op_0xE2(c, 0x0234); // jpo $0234
+  n += 1;
+  if (c->pc == 0x0234) {
+    JUMP(0x0234);
+  }
+  JUMP(0x0231);
+
+b_0x0231:
+  if (!(i8080_aot_code(c, 0x0231, "\xFA\x37\x02", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0234;
+  i8080_aot_op_0xFA(c, 0x0237); // jm $0237
+  n += 1;
+  if (c->pc == 0x0237) {
+    JUMP(0x0237);
+  }
+  JUMP(0x0234);
+
+b_0x0234:
+  if (!(i8080_aot_code(c, 0x0234, "\xCD\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0237;
+  i8080_aot_op_0xCD(c, 0x06A0); // call $06A0
+  n += 1;
+  JUMP(0x06A0);
+
+b_0x0237:
+  if (!(i8080_aot_code(c, 0x0237, "\xFE\x00\xDA\x4F\x02", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xFE(c, 0x0000); // cpi $00
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x023C;
+  i8080_aot_op_0xDA(c, 0x024F); // jc $024F
+  n += 1;
+  if (c->pc == 0x024F) {
+    JUMP(0x024F);
+  }
+  JUMP(0x023C);
+
+b_0x023C:
+  if (!(i8080_aot_code(c, 0x023C, "\xCA\x4F\x02", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x023F;
+  i8080_aot_op_0xCA(c, 0x024F); // jz $024F
+  n += 1;
+  if (c->pc == 0x024F) {
+    JUMP(0x024F);
+  }
+  JUMP(0x023F);
+
+b_0x023F:
+  if (!(i8080_aot_code(c, 0x023F, "\xFE\xF5\xDA\x4F\x02", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xFE(c, 0x00F5); // cpi $F5
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0244;
+  i8080_aot_op_0xDA(c, 0x024F); // jc $024F
+  n += 1;
+  if (c->pc == 0x024F) {
+    JUMP(0x024F);
+  }
+  JUMP(0x0244);
+
+b_0x0244:
+  if (!(i8080_aot_code(c, 0x0244, "\xC2\x4F\x02", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0247;
+  i8080_aot_op_0xC2(c, 0x024F); // jnz $024F
+  n += 1;
+  if (c->pc == 0x024F) {
+    JUMP(0x024F);
+  }
+  JUMP(0x0247);
+
+b_0x0247:
+  if (!(i8080_aot_code(c, 0x0247, "\xFE\xFF\xCA\x4F\x02", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xFE(c, 0x00FF); // cpi $FF
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x024C;
+  i8080_aot_op_0xCA(c, 0x024F); // jz $024F
+  n += 1;
+  if (c->pc == 0x024F) {
+    JUMP(0x024F);
+  }
+  JUMP(0x024C);
+
+b_0x024C:
+  if (!(i8080_aot_code(c, 0x024C, "\xDA\x52\x02", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x024F;
+  i8080_aot_op_0xDA(c, 0x0252); // jc $0252
+  n += 1;
+  if (c->pc == 0x0252) {
+    JUMP(0x0252);
+  }
+  JUMP(0x024F);
+
+b_0x024F:
+  if (!(i8080_aot_code(c, 0x024F, "\xCD\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0252;
+  i8080_aot_op_0xCD(c, 0x06A0); // call $06A0
+  n += 1;
+  JUMP(0x06A0);
+
+b_0x0252:
+  if (!(i8080_aot_code(c, 0x0252, "\xCE\x0A\xCE\x0A\xFE\x0B\xCA\x5E\x02", 9))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xCE(c, 0x000A); // aci $0A
+  n += 1;
+  i8080_aot_op_0xCE(c, 0x000A); // aci $0A
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x000B); // cpi $0B
+  n += 1;
+  c->cyc += 31;
+  c->pc = 0x025B;
+  i8080_aot_op_0xCA(c, 0x025E); // jz $025E
+  n += 1;
+  if (c->pc == 0x025E) {
+    JUMP(0x025E);
+  }
+  JUMP(0x025B);
+
+b_0x025B:
+  if (!(i8080_aot_code(c, 0x025B, "\xCD\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x025E;
+  i8080_aot_op_0xCD(c, 0x06A0); // call $06A0
+  n += 1;
+  JUMP(0x06A0);
+
+b_0x025E:
+  if (!(i8080_aot_code(c, 0x025E, "\xD6\x0C\xD6\x0F\xFE\xF0\xCA\x6A\x02", 9))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xD6(c, 0x000C); // sui $0C
+  n += 1;
+  i8080_aot_op_0xD6(c, 0x000F); // sui $0F
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x00F0); // cpi $F0
+  n += 1;
+  c->cyc += 31;
+  c->pc = 0x0267;
+  i8080_aot_op_0xCA(c, 0x026A); // jz $026A
+  n += 1;
+  if (c->pc == 0x026A) {
+    JUMP(0x026A);
+  }
+  JUMP(0x0267);
+
+b_0x0267:
+  if (!(i8080_aot_code(c, 0x0267, "\xCD\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x026A;
+  i8080_aot_op_0xCD(c, 0x06A0); // call $06A0
+  n += 1;
+  JUMP(0x06A0);
+
+b_0x026A:
+  if (!(i8080_aot_code(c, 0x026A, "\xDE\xF1\xDE\x0E\xFE\xF0\xCA\x76\x02", 9))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xDE(c, 0x00F1); // sbi $F1
+  n += 1;
+  i8080_aot_op_0xDE(c, 0x000E); // sbi $0E
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x00F0); // cpi $F0
+  n += 1;
+  c->cyc += 31;
+  c->pc = 0x0273;
+  i8080_aot_op_0xCA(c, 0x0276); // jz $0276
+  n += 1;
+  if (c->pc == 0x0276) {
+    JUMP(0x0276);
+  }
+  JUMP(0x0273);
+
+b_0x0273:
+  if (!(i8080_aot_code(c, 0x0273, "\xCD\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0276;
+  i8080_aot_op_0xCD(c, 0x06A0); // call $06A0
+  n += 1;
+  JUMP(0x06A0);
+
+b_0x0276:
+  if (!(i8080_aot_code(c, 0x0276, "\xE6\x55\xFE\x50\xCA\x80\x02", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xE6(c, 0x0055); // ani $55
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x0050); // cpi $50
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x027D;
+  i8080_aot_op_0xCA(c, 0x0280); // jz $0280
+  n += 1;
+  if (c->pc == 0x0280) {
+    JUMP(0x0280);
+  }
+  JUMP(0x027D);
+
+b_0x027D:
+  if (!(i8080_aot_code(c, 0x027D, "\xCD\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0280;
+  i8080_aot_op_0xCD(c, 0x06A0); // call $06A0
+  n += 1;
+  JUMP(0x06A0);
+
+b_0x0280:
+  if (!(i8080_aot_code(c, 0x0280, "\xF6\x3A\xFE\x7A\xCA\x8A\x02", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xF6(c, 0x003A); // ori $3A
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x007A); // cpi $7A
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x0287;
+  i8080_aot_op_0xCA(c, 0x028A); // jz $028A
+  n += 1;
+  if (c->pc == 0x028A) {
+    JUMP(0x028A);
+  }
+  JUMP(0x0287);
+
+b_0x0287:
+  if (!(i8080_aot_code(c, 0x0287, "\xCD\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x028A;
+  i8080_aot_op_0xCD(c, 0x06A0); // call $06A0
+  n += 1;
+  JUMP(0x06A0);
+
+b_0x028A:
+  if (!(i8080_aot_code(c, 0x028A, "\xEE\x0F\xFE\x75\xCA\x94\x02", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xEE(c, 0x000F); // xri $0F
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x0075); // cpi $75
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x0291;
+  i8080_aot_op_0xCA(c, 0x0294); // jz $0294
+  n += 1;
+  if (c->pc == 0x0294) {
+    JUMP(0x0294);
+  }
+  JUMP(0x0291);
+
+b_0x0291:
+  if (!(i8080_aot_code(c, 0x0291, "\xCD\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0294;
+  i8080_aot_op_0xCD(c, 0x06A0); // call $06A0
+  n += 1;
+  JUMP(0x06A0);
+
+b_0x0294:
+  if (!(i8080_aot_code(c, 0x0294, "\xE6\x00\xDC\xA0\x06", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xE6(c, 0x0000); // ani $00
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x0299;
+  i8080_aot_op_0xDC(c, 0x06A0); // cc $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x0299);
+
+b_0x0299:
+  if (!(i8080_aot_code(c, 0x0299, "\xE4\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x029C;
+  i8080_aot_op_0xE4(c, 0x06A0); // cpo $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x029C);
+
+b_0x029C:
+  if (!(i8080_aot_code(c, 0x029C, "\xFC\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x029F;
+  i8080_aot_op_0xFC(c, 0x06A0); // cm $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x029F);
+
+b_0x029F:
+  if (!(i8080_aot_code(c, 0x029F, "\xC4\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x02A2;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x02A2);
+
+b_0x02A2:
+  if (!(i8080_aot_code(c, 0x02A2, "\xFE\x00\xCA\xAA\x02", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xFE(c, 0x0000); // cpi $00
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x02A7;
+  i8080_aot_op_0xCA(c, 0x02AA); // jz $02AA
+  n += 1;
+  if (c->pc == 0x02AA) {
+    JUMP(0x02AA);
+  }
+  JUMP(0x02A7);
+
+b_0x02A7:
+  if (!(i8080_aot_code(c, 0x02A7, "\xCD\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x02AA;
+  i8080_aot_op_0xCD(c, 0x06A0); // call $06A0
+  n += 1;
+  JUMP(0x06A0);
+
+b_0x02AA:
+  if (!(i8080_aot_code(c, 0x02AA, "\xD6\x77\xD4\xA0\x06", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xD6(c, 0x0077); // sui $77
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x02AF;
+  i8080_aot_op_0xD4(c, 0x06A0); // cnc $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x02AF);
+
+b_0x02AF:
+  if (!(i8080_aot_code(c, 0x02AF, "\xEC\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x02B2;
+  i8080_aot_op_0xEC(c, 0x06A0); // cpe $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x02B2);
+
+b_0x02B2:
+  if (!(i8080_aot_code(c, 0x02B2, "\xF4\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x02B5;
+  i8080_aot_op_0xF4(c, 0x06A0); // cp $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x02B5);
+
+b_0x02B5:
+  if (!(i8080_aot_code(c, 0x02B5, "\xCC\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x02B8;
+  i8080_aot_op_0xCC(c, 0x06A0); // cz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x02B8);
+
+b_0x02B8:
+  if (!(i8080_aot_code(c, 0x02B8, "\xFE\x89\xCA\xC0\x02", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xFE(c, 0x0089); // cpi $89
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x02BD;
+  i8080_aot_op_0xCA(c, 0x02C0); // jz $02C0
+  n += 1;
+  if (c->pc == 0x02C0) {
+    JUMP(0x02C0);
+  }
+  JUMP(0x02BD);
+
+b_0x02BD:
+  if (!(i8080_aot_code(c, 0x02BD, "\xCD\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x02C0;
+  i8080_aot_op_0xCD(c, 0x06A0); // call $06A0
+  n += 1;
+  JUMP(0x06A0);
+
+b_0x02C0:
+  if (!(i8080_aot_code(c, 0x02C0, "\xE6\xFF\xE4\xCD\x02", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xE6(c, 0x00FF); // ani $FF
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x02C5;
+  i8080_aot_op_0xE4(c, 0x02CD); // cpo $02CD
+  n += 1;
+  if (c->pc == 0x02CD) {
+    JUMP(0x02CD);
+  }
+  JUMP(0x02C5);
+
+b_0x02C5:
+  if (!(i8080_aot_code(c, 0x02C5, "\xFE\xD9\xCA\x2A\x03", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xFE(c, 0x00D9); // cpi $D9
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x02CA;
+  i8080_aot_op_0xCA(c, 0x032A); // jz $032A
+  n += 1;
+  if (c->pc == 0x032A) {
+    JUMP(0x032A);
+  }
+  JUMP(0x02CA);
+
+b_0x02CA:
+  if (!(i8080_aot_code(c, 0x02CA, "\xCD\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x02CD;
+  i8080_aot_op_0xCD(c, 0x06A0); // call $06A0
+  n += 1;
+  JUMP(0x06A0);
+
+b_0x02CD:
+  if (!(i8080_aot_code(c, 0x02CD, "\xE8", 1))) {
+    goto fallback;
+  }
+  c->cyc += 5;
+  c->pc = 0x02CE;
+  i8080_aot_op_0xE8(c, 0x0000); // rpe
+  n += 1;
+  if (c->pc != 0x02CE) {
+    goto dispatch;
+  }
+  JUMP(0x02CE);
+
+b_0x02CE:
+  if (!(i8080_aot_code(c, 0x02CE, "\xC6\x10\xEC\xD9\x02", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xC6(c, 0x0010); // adi $10
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x02D3;
+  i8080_aot_op_0xEC(c, 0x02D9); // cpe $02D9
+  n += 1;
+  if (c->pc == 0x02D9) {
+    JUMP(0x02D9);
+  }
+  JUMP(0x02D3);
+
+b_0x02D3:
+  if (!(i8080_aot_code(c, 0x02D3, "\xC6\x02\xE0", 3))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xC6(c, 0x0002); // adi $02
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x02D6;
+  i8080_aot_op_0xE0(c, 0x0000); // rpo
+  n += 1;
+  if (c->pc != 0x02D6) {
+    goto dispatch;
+  }
+  JUMP(0x02D6);
+
+b_0x02D6:
+  if (!(i8080_aot_code(c, 0x02D6, "\xCD\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x02D9;
+  i8080_aot_op_0xCD(c, 0x06A0); // call $06A0
+  n += 1;
+  JUMP(0x06A0);
+
+b_0x02D9:
+  if (!(i8080_aot_code(c, 0x02D9, "\xE0", 1))) {
+    goto fallback;
+  }
+  c->cyc += 5;
+  c->pc = 0x02DA;
+  i8080_aot_op_0xE0(c, 0x0000); // rpo
+  n += 1;
+  if (c->pc != 0x02DA) {
+    goto dispatch;
+  }
+  JUMP(0x02DA);
+
+b_0x02DA:
+  if (!(i8080_aot_code(c, 0x02DA, "\xC6\x20\xFC\xE5\x02", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xC6(c, 0x0020); // adi $20
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x02DF;
+  i8080_aot_op_0xFC(c, 0x02E5); // cm $02E5
+  n += 1;
+  if (c->pc == 0x02E5) {
+    JUMP(0x02E5);
+  }
+  JUMP(0x02DF);
+
+b_0x02DF:
+  if (!(i8080_aot_code(c, 0x02DF, "\xC6\x04\xE8", 3))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xC6(c, 0x0004); // adi $04
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x02E2;
+  i8080_aot_op_0xE8(c, 0x0000); // rpe
+  n += 1;
+  if (c->pc != 0x02E2) {
+    goto dispatch;
+  }
+  JUMP(0x02E2);
+
+b_0x02E2:
+  if (!(i8080_aot_code(c, 0x02E2, "\xCD\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x02E5;
+  i8080_aot_op_0xCD(c, 0x06A0); // call $06A0
+  n += 1;
+  JUMP(0x06A0);
+
+b_0x02E5:
+  if (!(i8080_aot_code(c, 0x02E5, "\xF0", 1))) {
+    goto fallback;
+  }
+  c->cyc += 5;
+  c->pc = 0x02E6;
+  i8080_aot_op_0xF0(c, 0x0000); // rp
+  n += 1;
+  if (c->pc != 0x02E6) {
+    goto dispatch;
+  }
+  JUMP(0x02E6);
+
+b_0x02E6:
+  if (!(i8080_aot_code(c, 0x02E6, "\xC6\x80\xF4\xF1\x02", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xC6(c, 0x0080); // adi $80
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x02EB;
+  i8080_aot_op_0xF4(c, 0x02F1); // cp $02F1
+  n += 1;
+  if (c->pc == 0x02F1) {
+    JUMP(0x02F1);
+  }
+  JUMP(0x02EB);
+
+b_0x02EB:
+  if (!(i8080_aot_code(c, 0x02EB, "\xC6\x80\xF8", 3))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xC6(c, 0x0080); // adi $80
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x02EE;
+  i8080_aot_op_0xF8(c, 0x0000); // rm
+  n += 1;
+  if (c->pc != 0x02EE) {
+    goto dispatch;
+  }
+  JUMP(0x02EE);
+
+b_0x02EE:
+  if (!(i8080_aot_code(c, 0x02EE, "\xCD\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x02F1;
+  i8080_aot_op_0xCD(c, 0x06A0); // call $06A0
+  n += 1;
+  JUMP(0x06A0);
+
+b_0x02F1:
+  if (!(i8080_aot_code(c, 0x02F1, "\xF8", 1))) {
+    goto fallback;
+  }
+  c->cyc += 5;
+  c->pc = 0x02F2;
+  i8080_aot_op_0xF8(c, 0x0000); // rm
+  n += 1;
+  if (c->pc != 0x02F2) {
+    goto dispatch;
+  }
+  JUMP(0x02F2);
+
+b_0x02F2:
+  if (!(i8080_aot_code(c, 0x02F2, "\xC6\x40\xD4\xFD\x02", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xC6(c, 0x0040); // adi $40
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x02F7;
+  i8080_aot_op_0xD4(c, 0x02FD); // cnc $02FD
+  n += 1;
+  if (c->pc == 0x02FD) {
+    JUMP(0x02FD);
+  }
+  JUMP(0x02F7);
+
+b_0x02F7:
+  if (!(i8080_aot_code(c, 0x02F7, "\xC6\x40\xF0", 3))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xC6(c, 0x0040); // adi $40
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x02FA;
+  i8080_aot_op_0xF0(c, 0x0000); // rp
+  n += 1;
+  if (c->pc != 0x02FA) {
+    goto dispatch;
+  }
+  JUMP(0x02FA);
+
+b_0x02FA:
+  if (!(i8080_aot_code(c, 0x02FA, "\xCD\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x02FD;
+  i8080_aot_op_0xCD(c, 0x06A0); // call $06A0
+  n += 1;
+  JUMP(0x06A0);
+
+b_0x02FD:
+  if (!(i8080_aot_code(c, 0x02FD, "\xD8", 1))) {
+    goto fallback;
+  }
+  c->cyc += 5;
+  c->pc = 0x02FE;
+  i8080_aot_op_0xD8(c, 0x0000); // rc
+  n += 1;
+  if (c->pc != 0x02FE) {
+    goto dispatch;
+  }
+  JUMP(0x02FE);
+
+b_0x02FE:
+  if (!(i8080_aot_code(c, 0x02FE, "\xC6\x8F", 2) &&
+      i8080_aot_code(c, 0x0300, "\xDC\x09\x03", 3))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xC6(c, 0x008F); // adi $8F
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x0303;
+  i8080_aot_op_0xDC(c, 0x0309); // cc $0309
+  n += 1;
+  if (c->pc == 0x0309) {
+    JUMP(0x0309);
+  }
+  JUMP(0x0303);
+
+b_0x0303:
+  if (!(i8080_aot_code(c, 0x0303, "\xD6\x02\xD0", 3))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xD6(c, 0x0002); // sui $02
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x0306;
+  i8080_aot_op_0xD0(c, 0x0000); // rnc
+  n += 1;
+  if (c->pc != 0x0306) {
+    goto dispatch;
+  }
+  JUMP(0x0306);
+
+b_0x0306:
+  if (!(i8080_aot_code(c, 0x0306, "\xCD\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0309;
+  i8080_aot_op_0xCD(c, 0x06A0); // call $06A0
+  n += 1;
+  JUMP(0x06A0);
+
+b_0x0309:
+  if (!(i8080_aot_code(c, 0x0309, "\xD0", 1))) {
+    goto fallback;
+  }
+  c->cyc += 5;
+  c->pc = 0x030A;
+  i8080_aot_op_0xD0(c, 0x0000); // rnc
+  n += 1;
+  if (c->pc != 0x030A) {
+    goto dispatch;
+  }
+  JUMP(0x030A);
+
+b_0x030A:
+  if (!(i8080_aot_code(c, 0x030A, "\xC6\xF7\xC4\x15\x03", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xC6(c, 0x00F7); // adi $F7
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x030F;
+  i8080_aot_op_0xC4(c, 0x0315); // cnz $0315
+  n += 1;
+  if (c->pc == 0x0315) {
+    JUMP(0x0315);
+  }
+  JUMP(0x030F);
+
+b_0x030F:
+  if (!(i8080_aot_code(c, 0x030F, "\xC6\xFE\xD8", 3))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xC6(c, 0x00FE); // adi $FE
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x0312;
+  i8080_aot_op_0xD8(c, 0x0000); // rc
+  n += 1;
+  if (c->pc != 0x0312) {
+    goto dispatch;
+  }
+  JUMP(0x0312);
+
+b_0x0312:
+  if (!(i8080_aot_code(c, 0x0312, "\xCD\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0315;
+  i8080_aot_op_0xCD(c, 0x06A0); // call $06A0
+  n += 1;
+  JUMP(0x06A0);
+
+b_0x0315:
+  if (!(i8080_aot_code(c, 0x0315, "\xC8", 1))) {
+    goto fallback;
+  }
+  c->cyc += 5;
+  c->pc = 0x0316;
+  i8080_aot_op_0xC8(c, 0x0000); // rz
+  n += 1;
+  if (c->pc != 0x0316) {
+    goto dispatch;
+  }
+  JUMP(0x0316);
+
+b_0x0316:
+  if (!(i8080_aot_code(c, 0x0316, "\xC6\x01\xCC\x21\x03", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xC6(c, 0x0001); // adi $01
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x031B;
+  i8080_aot_op_0xCC(c, 0x0321); // cz $0321
+  n += 1;
+  if (c->pc == 0x0321) {
+    JUMP(0x0321);
+  }
+  JUMP(0x031B);
+
+b_0x031B:
+  if (!(i8080_aot_code(c, 0x031B, "\xC6\xD0\xC0", 3))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xC6(c, 0x00D0); // adi $D0
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x031E;
+  i8080_aot_op_0xC0(c, 0x0000); // rnz
+  n += 1;
+  if (c->pc != 0x031E) {
+    goto dispatch;
+  }
+  JUMP(0x031E);
+
+b_0x031E:
+  if (!(i8080_aot_code(c, 0x031E, "\xCD\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0321;
+  i8080_aot_op_0xCD(c, 0x06A0); // call $06A0
+  n += 1;
+  JUMP(0x06A0);
+
+b_0x0321:
+  if (!(i8080_aot_code(c, 0x0321, "\xC0", 1))) {
+    goto fallback;
+  }
+  c->cyc += 5;
+  c->pc = 0x0322;
+  i8080_aot_op_0xC0(c, 0x0000); // rnz
+  n += 1;
+  if (c->pc != 0x0322) {
+    goto dispatch;
+  }
+  JUMP(0x0322);
+
+b_0x0322:
+  if (!(i8080_aot_code(c, 0x0322, "\xC6\x47\xFE\x47\xC8", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xC6(c, 0x0047); // adi $47
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x0047); // cpi $47
+  n += 1;
+  c->cyc += 19;
+  c->pc = 0x0327;
+  i8080_aot_op_0xC8(c, 0x0000); // rz
+  n += 1;
+  if (c->pc != 0x0327) {
+    goto dispatch;
+  }
+  JUMP(0x0327);
+
+b_0x0327:
+  if (!(i8080_aot_code(c, 0x0327, "\xCD\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x032A;
+  i8080_aot_op_0xCD(c, 0x06A0); // call $06A0
+  n += 1;
+  JUMP(0x06A0);
+
+b_0x032A:
+  if (!(i8080_aot_code(c, 0x032A, "\x3E\x77\x3C\x47\x04\x48\x0D\x51\x5A\x63\x6C\x7D\x3D\x4F\x59\x6B\x45", 17))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x0077); // mvi a,$77
+  n += 1;
+  i8080_aot_op_0x3C(c, 0x0000); // inr a
+  n += 1;
+  i8080_aot_op_0x47(c, 0x0000); // mov b,a
+  n += 1;
+  i8080_aot_op_0x04(c, 0x0000); // inr b
+  n += 1;
+  i8080_aot_op_0x48(c, 0x0000); // mov c,b
+  n += 1;
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  i8080_aot_op_0x51(c, 0x0000); // mov d,c
+  n += 1;
+  i8080_aot_op_0x5A(c, 0x0000); // mov e,d
+  n += 1;
+  i8080_aot_op_0x63(c, 0x0000); // mov h,e
+  n += 1;
+  i8080_aot_op_0x6C(c, 0x0000); // mov l,h
+  n += 1;
+  i8080_aot_op_0x7D(c, 0x0000); // mov a,l
+  n += 1;
+  i8080_aot_op_0x3D(c, 0x0000); // dcr a
+  n += 1;
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  i8080_aot_op_0x59(c, 0x0000); // mov e,c
+  n += 1;
+  i8080_aot_op_0x6B(c, 0x0000); // mov l,e
+  n += 1;
+  c->cyc += 82;
+  c->pc = 0x033B;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  JUMP(0x033B);
+
+b_0x033B:
+  if (!(i8080_aot_code(c, 0x033B, "\x50\x62\x7C\x57\x14\x6A\x4D\x0C\x61\x44\x05\x58\x7B\x5F\x1C\x43", 16))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x50(c, 0x0000); // mov d,b
+  n += 1;
+  i8080_aot_op_0x62(c, 0x0000); // mov h,d
+  n += 1;
+  i8080_aot_op_0x7C(c, 0x0000); // mov a,h
+  n += 1;
+  i8080_aot_op_0x57(c, 0x0000); // mov d,a
+  n += 1;
+  i8080_aot_op_0x14(c, 0x0000); // inr d
+  n += 1;
+  i8080_aot_op_0x6A(c, 0x0000); // mov l,d
+  n += 1;
+  i8080_aot_op_0x4D(c, 0x0000); // mov c,l
+  n += 1;
+  i8080_aot_op_0x0C(c, 0x0000); // inr c
+  n += 1;
+  i8080_aot_op_0x61(c, 0x0000); // mov h,c
+  n += 1;
+  i8080_aot_op_0x44(c, 0x0000); // mov b,h
+  n += 1;
+  i8080_aot_op_0x05(c, 0x0000); // dcr b
+  n += 1;
+  i8080_aot_op_0x58(c, 0x0000); // mov e,b
+  n += 1;
+  i8080_aot_op_0x7B(c, 0x0000); // mov a,e
+  n += 1;
+  i8080_aot_op_0x5F(c, 0x0000); // mov e,a
+  n += 1;
+  i8080_aot_op_0x1C(c, 0x0000); // inr e
+  n += 1;
+  c->cyc += 80;
+  c->pc = 0x034B;
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  JUMP(0x034B);
+
+b_0x034B:
+  if (!(i8080_aot_code(c, 0x034B, "\x60\x24\x4C\x69\x55\x15\x7A\x67\x25\x54\x42\x68\x2C\x5D\x1D\x4B", 16))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x60(c, 0x0000); // mov h,b
+  n += 1;
+  i8080_aot_op_0x24(c, 0x0000); // inr h
+  n += 1;
+  i8080_aot_op_0x4C(c, 0x0000); // mov c,h
+  n += 1;
+  i8080_aot_op_0x69(c, 0x0000); // mov l,c
+  n += 1;
+  i8080_aot_op_0x55(c, 0x0000); // mov d,l
+  n += 1;
+  i8080_aot_op_0x15(c, 0x0000); // dcr d
+  n += 1;
+  i8080_aot_op_0x7A(c, 0x0000); // mov a,d
+  n += 1;
+  i8080_aot_op_0x67(c, 0x0000); // mov h,a
+  n += 1;
+  i8080_aot_op_0x25(c, 0x0000); // dcr h
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x42(c, 0x0000); // mov b,d
+  n += 1;
+  i8080_aot_op_0x68(c, 0x0000); // mov l,b
+  n += 1;
+  i8080_aot_op_0x2C(c, 0x0000); // inr l
+  n += 1;
+  i8080_aot_op_0x5D(c, 0x0000); // mov e,l
+  n += 1;
+  i8080_aot_op_0x1D(c, 0x0000); // dcr e
+  n += 1;
+  c->cyc += 80;
+  c->pc = 0x035B;
+  i8080_aot_op_0x4B(c, 0x0000); // mov c,e
+  n += 1;
+  JUMP(0x035B);
+
+b_0x035B:
+  if (!(i8080_aot_code(c, 0x035B, "\x79\x6F\x2D\x65\x5C\x53\x4A\x41\x78\xFE\x77\xC4\xA0\x06", 14))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x79(c, 0x0000); // mov a,c
+  n += 1;
+  i8080_aot_op_0x6F(c, 0x0000); // mov l,a
+  n += 1;
+  i8080_aot_op_0x2D(c, 0x0000); // dcr l
+  n += 1;
+  i8080_aot_op_0x65(c, 0x0000); // mov h,l
+  n += 1;
+  i8080_aot_op_0x5C(c, 0x0000); // mov e,h
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x4A(c, 0x0000); // mov c,d
+  n += 1;
+  i8080_aot_op_0x41(c, 0x0000); // mov b,c
+  n += 1;
+  i8080_aot_op_0x78(c, 0x0000); // mov a,b
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x0077); // cpi $77
+  n += 1;
+  c->cyc += 63;
+  c->pc = 0x0369;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x0369);
+
+b_0x0369:
+  if (!(i8080_aot_code(c, 0x0369, "\xAF\x06\x01\x0E\x03\x16\x07\x1E\x0F\x26\x1F\x2E\x3F\x80\x81\x82\x83\x84\x85\x87\xFE\xF0\xC4\xA0\x06", 25))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xAF(c, 0x0000); // xra a
+  n += 1;
+  i8080_aot_op_0x06(c, 0x0001); // mvi b,$01
+  n += 1;
+  i8080_aot_op_0x0E(c, 0x0003); // mvi c,$03
+  n += 1;
+  i8080_aot_op_0x16(c, 0x0007); // mvi d,$07
+  n += 1;
+  i8080_aot_op_0x1E(c, 0x000F); // mvi e,$0F
+  n += 1;
+  i8080_aot_op_0x26(c, 0x001F); // mvi h,$1F
+  n += 1;
+  i8080_aot_op_0x2E(c, 0x003F); // mvi l,$3F
+  n += 1;
+  i8080_aot_op_0x80(c, 0x0000); // add b
+  n += 1;
+  i8080_aot_op_0x81(c, 0x0000); // add c
+  n += 1;
+  i8080_aot_op_0x82(c, 0x0000); // add d
+  n += 1;
+  i8080_aot_op_0x83(c, 0x0000); // add e
+  n += 1;
+  i8080_aot_op_0x84(c, 0x0000); // add h
+  n += 1;
+  i8080_aot_op_0x85(c, 0x0000); // add l
+  n += 1;
+  i8080_aot_op_0x87(c, 0x0000); // add a
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x00F0); // cpi $F0
+  n += 1;
+  c->cyc += 92;
+  c->pc = 0x0382;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x0382);
+
+b_0x0382:
+  if (!(i8080_aot_code(c, 0x0382, "\x90\x91\x92\x93\x94\x95\xFE\x78\xC4\xA0\x06", 11))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x90(c, 0x0000); // sub b
+  n += 1;
+  i8080_aot_op_0x91(c, 0x0000); // sub c
+  n += 1;
+  i8080_aot_op_0x92(c, 0x0000); // sub d
+  n += 1;
+  i8080_aot_op_0x93(c, 0x0000); // sub e
+  n += 1;
+  i8080_aot_op_0x94(c, 0x0000); // sub h
+  n += 1;
+  i8080_aot_op_0x95(c, 0x0000); // sub l
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x0078); // cpi $78
+  n += 1;
+  c->cyc += 42;
+  c->pc = 0x038D;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x038D);
+
+b_0x038D:
+  if (!(i8080_aot_code(c, 0x038D, "\x97\xC4\xA0\x06", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x97(c, 0x0000); // sub a
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x0391;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x0391);
+
+b_0x0391:
+  if (!(i8080_aot_code(c, 0x0391, "\x3E\x80\x87\x06\x01\x0E\x02\x16\x03\x1E\x04\x26\x05\x2E\x06\x88\x06\x80\x80\x80\x89\x80\x80\x8A", 24))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x0080); // mvi a,$80
+  n += 1;
+  i8080_aot_op_0x87(c, 0x0000); // add a
+  n += 1;
+  i8080_aot_op_0x06(c, 0x0001); // mvi b,$01
+  n += 1;
+  i8080_aot_op_0x0E(c, 0x0002); // mvi c,$02
+  n += 1;
+  i8080_aot_op_0x16(c, 0x0003); // mvi d,$03
+  n += 1;
+  i8080_aot_op_0x1E(c, 0x0004); // mvi e,$04
+  n += 1;
+  i8080_aot_op_0x26(c, 0x0005); // mvi h,$05
+  n += 1;
+  i8080_aot_op_0x2E(c, 0x0006); // mvi l,$06
+  n += 1;
+  i8080_aot_op_0x88(c, 0x0000); // adc b
+  n += 1;
+  i8080_aot_op_0x06(c, 0x0080); // mvi b,$80
+  n += 1;
+  i8080_aot_op_0x80(c, 0x0000); // add b
+  n += 1;
+  i8080_aot_op_0x80(c, 0x0000); // add b
+  n += 1;
+  i8080_aot_op_0x89(c, 0x0000); // adc c
+  n += 1;
+  i8080_aot_op_0x80(c, 0x0000); // add b
+  n += 1;
+  i8080_aot_op_0x80(c, 0x0000); // add b
+  n += 1;
+  c->cyc += 88;
+  c->pc = 0x03A9;
+  i8080_aot_op_0x8A(c, 0x0000); // adc d
+  n += 1;
+  JUMP(0x03A9);
+
+b_0x03A9:
+  if (!(i8080_aot_code(c, 0x03A9, "\x80\x80\x8B\x80\x80\x8C\x80\x80\x8D\x80\x80\x8F\xFE\x37\xC4\xA0\x06", 17))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x80(c, 0x0000); // add b
+  n += 1;
+  i8080_aot_op_0x80(c, 0x0000); // add b
+  n += 1;
+  i8080_aot_op_0x8B(c, 0x0000); // adc e
+  n += 1;
+  i8080_aot_op_0x80(c, 0x0000); // add b
+  n += 1;
+  i8080_aot_op_0x80(c, 0x0000); // add b
+  n += 1;
+  i8080_aot_op_0x8C(c, 0x0000); // adc h
+  n += 1;
+  i8080_aot_op_0x80(c, 0x0000); // add b
+  n += 1;
+  i8080_aot_op_0x80(c, 0x0000); // add b
+  n += 1;
+  i8080_aot_op_0x8D(c, 0x0000); // adc l
+  n += 1;
+  i8080_aot_op_0x80(c, 0x0000); // add b
+  n += 1;
+  i8080_aot_op_0x80(c, 0x0000); // add b
+  n += 1;
+  i8080_aot_op_0x8F(c, 0x0000); // adc a
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x0037); // cpi $37
+  n += 1;
+  c->cyc += 66;
+  c->pc = 0x03BA;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x03BA);
+
+b_0x03BA:
+  if (!(i8080_aot_code(c, 0x03BA, "\x3E\x80\x87\x06\x01\x98\x06\xFF\x80\x99\x80\x9A\x80\x9B\x80\x9C\x80\x9D\xFE\xE0", 20))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x0080); // mvi a,$80
+  n += 1;
+  i8080_aot_op_0x87(c, 0x0000); // add a
+  n += 1;
+  i8080_aot_op_0x06(c, 0x0001); // mvi b,$01
+  n += 1;
+  i8080_aot_op_0x98(c, 0x0000); // sbb b
+  n += 1;
+  i8080_aot_op_0x06(c, 0x00FF); // mvi b,$FF
+  n += 1;
+  i8080_aot_op_0x80(c, 0x0000); // add b
+  n += 1;
+  i8080_aot_op_0x99(c, 0x0000); // sbb c
+  n += 1;
+  i8080_aot_op_0x80(c, 0x0000); // add b
+  n += 1;
+  i8080_aot_op_0x9A(c, 0x0000); // sbb d
+  n += 1;
+  i8080_aot_op_0x80(c, 0x0000); // add b
+  n += 1;
+  i8080_aot_op_0x9B(c, 0x0000); // sbb e
+  n += 1;
+  i8080_aot_op_0x80(c, 0x0000); // add b
+  n += 1;
+  i8080_aot_op_0x9C(c, 0x0000); // sbb h
+  n += 1;
+  i8080_aot_op_0x80(c, 0x0000); // add b
+  n += 1;
+  i8080_aot_op_0x9D(c, 0x0000); // sbb l
+  n += 1;
+  c->cyc += 76;
+  c->pc = 0x03CE;
+  i8080_aot_op_0xFE(c, 0x00E0); // cpi $E0
+  n += 1;
+  JUMP(0x03CE);
+
+b_0x03CE:
+  if (!(i8080_aot_code(c, 0x03CE, "\xC4\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x03D1;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x03D1);
+
+b_0x03D1:
+  if (!(i8080_aot_code(c, 0x03D1, "\x3E\x80\x87\x9F\xFE\xFF\xC4\xA0\x06", 9))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x0080); // mvi a,$80
+  n += 1;
+  i8080_aot_op_0x87(c, 0x0000); // add a
+  n += 1;
+  i8080_aot_op_0x9F(c, 0x0000); // sbb a
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x00FF); // cpi $FF
+  n += 1;
+  c->cyc += 33;
+  c->pc = 0x03DA;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x03DA);
+
+b_0x03DA:
+  if (!(i8080_aot_code(c, 0x03DA, "\x3E\xFF\x06\xFE\x0E\xFC\x16\xEF\x1E\x7F\x26\xF4\x2E\xBF\xA0\xA1\xA2\xA3\xA4\xA5\xA7\xFE\x24\xC4\xA0\x06", 26))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x00FF); // mvi a,$FF
+  n += 1;
+  i8080_aot_op_0x06(c, 0x00FE); // mvi b,$FE
+  n += 1;
+  i8080_aot_op_0x0E(c, 0x00FC); // mvi c,$FC
+  n += 1;
+  i8080_aot_op_0x16(c, 0x00EF); // mvi d,$EF
+  n += 1;
+  i8080_aot_op_0x1E(c, 0x007F); // mvi e,$7F
+  n += 1;
+  i8080_aot_op_0x26(c, 0x00F4); // mvi h,$F4
+  n += 1;
+  i8080_aot_op_0x2E(c, 0x00BF); // mvi l,$BF
+  n += 1;
+  i8080_aot_op_0xA0(c, 0x0000); // ana b
+  n += 1;
+  i8080_aot_op_0xA1(c, 0x0000); // ana c
+  n += 1;
+  i8080_aot_op_0xA2(c, 0x0000); // ana d
+  n += 1;
+  i8080_aot_op_0xA3(c, 0x0000); // ana e
+  n += 1;
+  i8080_aot_op_0xA4(c, 0x0000); // ana h
+  n += 1;
+  i8080_aot_op_0xA5(c, 0x0000); // ana l
+  n += 1;
+  i8080_aot_op_0xA7(c, 0x0000); // ana a
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x0024); // cpi $24
+  n += 1;
+  c->cyc += 95;
+  c->pc = 0x03F4;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x03F4);
+
+b_0x03F4:
+  if (!(i8080_aot_code(c, 0x03F4, "\xAF\x06\x01\x0E\x02\x16\x04\x1E\x08\x26\x10\x2E", 12) &&
+      i8080_aot_code(c, 0x0400, "\x20\xB0\xB1\xB2\xB3\xB4\xB5\xB7\xFE\x3F\xC4\xA0\x06", 13))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xAF(c, 0x0000); // xra a
+  n += 1;
+  i8080_aot_op_0x06(c, 0x0001); // mvi b,$01
+  n += 1;
+  i8080_aot_op_0x0E(c, 0x0002); // mvi c,$02
+  n += 1;
+  i8080_aot_op_0x16(c, 0x0004); // mvi d,$04
+  n += 1;
+  i8080_aot_op_0x1E(c, 0x0008); // mvi e,$08
+  n += 1;
+  i8080_aot_op_0x26(c, 0x0010); // mvi h,$10
+  n += 1;
+  i8080_aot_op_0x2E(c, 0x0020); // mvi l,$20
+  n += 1;
+  i8080_aot_op_0xB0(c, 0x0000); // ora b
+  n += 1;
+  i8080_aot_op_0xB1(c, 0x0000); // ora c
+  n += 1;
+  i8080_aot_op_0xB2(c, 0x0000); // ora d
+  n += 1;
+  i8080_aot_op_0xB3(c, 0x0000); // ora e
+  n += 1;
+  i8080_aot_op_0xB4(c, 0x0000); // ora h
+  n += 1;
+  i8080_aot_op_0xB5(c, 0x0000); // ora l
+  n += 1;
+  i8080_aot_op_0xB7(c, 0x0000); // ora a
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x003F); // cpi $3F
+  n += 1;
+  c->cyc += 92;
+  c->pc = 0x040D;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x040D);
+
+b_0x040D:
+  if (!(i8080_aot_code(c, 0x040D, "\x3E\x00\x26\x8F\x2E\x4F\xA8\xA9\xAA\xAB\xAC\xAD\xFE\xCF\xC4\xA0\x06", 17))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x0000); // mvi a,$00
+  n += 1;
+  i8080_aot_op_0x26(c, 0x008F); // mvi h,$8F
+  n += 1;
+  i8080_aot_op_0x2E(c, 0x004F); // mvi l,$4F
+  n += 1;
+  i8080_aot_op_0xA8(c, 0x0000); // xra b
+  n += 1;
+  i8080_aot_op_0xA9(c, 0x0000); // xra c
+  n += 1;
+  i8080_aot_op_0xAA(c, 0x0000); // xra d
+  n += 1;
+  i8080_aot_op_0xAB(c, 0x0000); // xra e
+  n += 1;
+  i8080_aot_op_0xAC(c, 0x0000); // xra h
+  n += 1;
+  i8080_aot_op_0xAD(c, 0x0000); // xra l
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x00CF); // cpi $CF
+  n += 1;
+  c->cyc += 63;
+  c->pc = 0x041E;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x041E);
+
+b_0x041E:
+  if (!(i8080_aot_code(c, 0x041E, "\xAF\xC4\xA0\x06", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xAF(c, 0x0000); // xra a
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x0422;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x0422);
+
+b_0x0422:
+  if (!(i8080_aot_code(c, 0x0422, "\x06\x44\x0E\x45\x16\x46\x1E\x47\x26\x06\x2E\xBF\x70\x06\x00\x46\x3E\x44\xB8\xC4\xA0\x06", 22))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x06(c, 0x0044); // mvi b,$44
+  n += 1;
+  i8080_aot_op_0x0E(c, 0x0045); // mvi c,$45
+  n += 1;
+  i8080_aot_op_0x16(c, 0x0046); // mvi d,$46
+  n += 1;
+  i8080_aot_op_0x1E(c, 0x0047); // mvi e,$47
+  n += 1;
+  i8080_aot_op_0x26(c, 0x0006); // mvi h,$06
+  n += 1;
+  i8080_aot_op_0x2E(c, 0x00BF); // mvi l,$BF
+  n += 1;
+  c->cyc += 49;
+  c->pc = 0x042F;
+  i8080_aot_op_0x70(c, 0x0000); // mov M,b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x042F) < 9) {
+    goto dispatch;
+  }
+i_0x042F:
+  i8080_aot_op_0x06(c, 0x0000); // mvi b,$00
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x0432;
+  i8080_aot_op_0x46(c, 0x0000); // mov b,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0432:
+  i8080_aot_op_0x3E(c, 0x0044); // mvi a,$44
+  n += 1;
+  i8080_aot_op_0xB8(c, 0x0000); // cmp b
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x0438;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x0438);
+
+b_0x0438:
+  if (!(i8080_aot_code(c, 0x0438, "\x71\x0E\x00\x4E\x3E\x45\xB9\xC4\xA0\x06", 10))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x0439;
+  i8080_aot_op_0x71(c, 0x0000); // mov M,c
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x0439) < 9) {
+    goto dispatch;
+  }
+i_0x0439:
+  i8080_aot_op_0x0E(c, 0x0000); // mvi c,$00
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x043C;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x043C:
+  i8080_aot_op_0x3E(c, 0x0045); // mvi a,$45
+  n += 1;
+  i8080_aot_op_0xB9(c, 0x0000); // cmp c
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x0442;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x0442);
+
+b_0x0442:
+  if (!(i8080_aot_code(c, 0x0442, "\x72\x16\x00\x56\x3E\x46\xBA\xC4\xA0\x06", 10))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x0443;
+  i8080_aot_op_0x72(c, 0x0000); // mov M,d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x0443) < 9) {
+    goto dispatch;
+  }
+i_0x0443:
+  i8080_aot_op_0x16(c, 0x0000); // mvi d,$00
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x0446;
+  i8080_aot_op_0x56(c, 0x0000); // mov d,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0446:
+  i8080_aot_op_0x3E(c, 0x0046); // mvi a,$46
+  n += 1;
+  i8080_aot_op_0xBA(c, 0x0000); // cmp d
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x044C;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x044C);
+
+b_0x044C:
+  if (!(i8080_aot_code(c, 0x044C, "\x73\x1E\x00\x5E\x3E\x47\xBB\xC4\xA0\x06", 10))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x044D;
+  i8080_aot_op_0x73(c, 0x0000); // mov M,e
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x044D) < 9) {
+    goto dispatch;
+  }
+i_0x044D:
+  i8080_aot_op_0x1E(c, 0x0000); // mvi e,$00
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x0450;
+  i8080_aot_op_0x5E(c, 0x0000); // mov e,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0450:
+  i8080_aot_op_0x3E(c, 0x0047); // mvi a,$47
+  n += 1;
+  i8080_aot_op_0xBB(c, 0x0000); // cmp e
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x0456;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x0456);
+
+b_0x0456:
+  if (!(i8080_aot_code(c, 0x0456, "\x74\x26\x06\x2E\xBF\x66\x3E\x06\xBC\xC4\xA0\x06", 12))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x0457;
+  i8080_aot_op_0x74(c, 0x0000); // mov M,h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x0457) < 11) {
+    goto dispatch;
+  }
+i_0x0457:
+  i8080_aot_op_0x26(c, 0x0006); // mvi h,$06
+  n += 1;
+  i8080_aot_op_0x2E(c, 0x00BF); // mvi l,$BF
+  n += 1;
+  c->cyc += 21;
+  c->pc = 0x045C;
+  i8080_aot_op_0x66(c, 0x0000); // mov h,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x045C:
+  i8080_aot_op_0x3E(c, 0x0006); // mvi a,$06
+  n += 1;
+  i8080_aot_op_0xBC(c, 0x0000); // cmp h
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x0462;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x0462);
+
+b_0x0462:
+  if (!(i8080_aot_code(c, 0x0462, "\x75\x26\x06\x2E\xBF\x6E\x3E\xBF\xBD\xC4\xA0\x06", 12))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x0463;
+  i8080_aot_op_0x75(c, 0x0000); // mov M,l
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x0463) < 11) {
+    goto dispatch;
+  }
+i_0x0463:
+  i8080_aot_op_0x26(c, 0x0006); // mvi h,$06
+  n += 1;
+  i8080_aot_op_0x2E(c, 0x00BF); // mvi l,$BF
+  n += 1;
+  c->cyc += 21;
+  c->pc = 0x0468;
+  i8080_aot_op_0x6E(c, 0x0000); // mov l,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0468:
+  i8080_aot_op_0x3E(c, 0x00BF); // mvi a,$BF
+  n += 1;
+  i8080_aot_op_0xBD(c, 0x0000); // cmp l
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x046E;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x046E);
+
+b_0x046E:
+  if (!(i8080_aot_code(c, 0x046E, "\x26\x06\x2E\xBF\x3E\x32\x77\xBE\xC4\xA0\x06", 11))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x26(c, 0x0006); // mvi h,$06
+  n += 1;
+  i8080_aot_op_0x2E(c, 0x00BF); // mvi l,$BF
+  n += 1;
+  i8080_aot_op_0x3E(c, 0x0032); // mvi a,$32
+  n += 1;
+  c->cyc += 28;
+  c->pc = 0x0475;
+  i8080_aot_op_0x77(c, 0x0000); // mov M,a
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x0475) < 4) {
+    goto dispatch;
+  }
+i_0x0475:
+  c->cyc += 7;
+  c->pc = 0x0476;
+  i8080_aot_op_0xBE(c, 0x0000); // cmp M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0476:
+  c->cyc += 11;
+  c->pc = 0x0479;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x0479);
+
+b_0x0479:
+  if (!(i8080_aot_code(c, 0x0479, "\x86\xFE\x64\xC4\xA0\x06", 6))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x047A;
+  i8080_aot_op_0x86(c, 0x0000); // add M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x047A:
+  i8080_aot_op_0xFE(c, 0x0064); // cpi $64
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x047F;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x047F);
+
+b_0x047F:
+  if (!(i8080_aot_code(c, 0x047F, "\xAF\x7E\xFE\x32\xC4\xA0\x06", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xAF(c, 0x0000); // xra a
+  n += 1;
+  c->cyc += 11;
+  c->pc = 0x0481;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0481:
+  i8080_aot_op_0xFE(c, 0x0032); // cpi $32
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x0486;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x0486);
+
+b_0x0486:
+  if (!(i8080_aot_code(c, 0x0486, "\x26\x06\x2E\xBF\x7E\x96\xC4\xA0\x06", 9))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x26(c, 0x0006); // mvi h,$06
+  n += 1;
+  i8080_aot_op_0x2E(c, 0x00BF); // mvi l,$BF
+  n += 1;
+  c->cyc += 21;
+  c->pc = 0x048B;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x048B:
+  c->cyc += 7;
+  c->pc = 0x048C;
+  i8080_aot_op_0x96(c, 0x0000); // sub M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x048C:
+  c->cyc += 11;
+  c->pc = 0x048F;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x048F);
+
+b_0x048F:
+  if (!(i8080_aot_code(c, 0x048F, "\x3E\x80\x87\x8E\xFE\x33\xC4\xA0\x06", 9))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x0080); // mvi a,$80
+  n += 1;
+  i8080_aot_op_0x87(c, 0x0000); // add a
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x0493;
+  i8080_aot_op_0x8E(c, 0x0000); // adc M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0493:
+  i8080_aot_op_0xFE(c, 0x0033); // cpi $33
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x0498;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x0498);
+
+b_0x0498:
+  if (!(i8080_aot_code(c, 0x0498, "\x3E\x80\x87\x9E\xFE\xCD\xC4\xA0\x06", 9))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x0080); // mvi a,$80
+  n += 1;
+  i8080_aot_op_0x87(c, 0x0000); // add a
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x049C;
+  i8080_aot_op_0x9E(c, 0x0000); // sbb M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x049C:
+  i8080_aot_op_0xFE(c, 0x00CD); // cpi $CD
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x04A1;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x04A1);
+
+b_0x04A1:
+  if (!(i8080_aot_code(c, 0x04A1, "\xA6\xC4\xA0\x06", 4))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x04A2;
+  i8080_aot_op_0xA6(c, 0x0000); // ana M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x04A2:
+  c->cyc += 11;
+  c->pc = 0x04A5;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x04A5);
+
+b_0x04A5:
+  if (!(i8080_aot_code(c, 0x04A5, "\x3E\x25\xB6\xFE\x37\xC4\xA0\x06", 8))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x0025); // mvi a,$25
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x04A8;
+  i8080_aot_op_0xB6(c, 0x0000); // ora M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x04A8:
+  i8080_aot_op_0xFE(c, 0x0037); // cpi $37
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x04AD;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x04AD);
+
+b_0x04AD:
+  if (!(i8080_aot_code(c, 0x04AD, "\xAE\xFE\x05\xC4\xA0\x06", 6))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x04AE;
+  i8080_aot_op_0xAE(c, 0x0000); // xra M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x04AE:
+  i8080_aot_op_0xFE(c, 0x0005); // cpi $05
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x04B3;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x04B3);
+
+b_0x04B3:
+  if (!(i8080_aot_code(c, 0x04B3, "\x36\x55\x34\x35\x86\xFE\x5A\xC4\xA0\x06", 10))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x04B5;
+  i8080_aot_op_0x36(c, 0x0055); // mvi M,$55
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x04B5) < 8) {
+    goto dispatch;
+  }
+i_0x04B5:
+  c->cyc += 10;
+  c->pc = 0x04B6;
+  i8080_aot_op_0x34(c, 0x0000); // inr M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x04B6) < 7) {
+    goto dispatch;
+  }
+i_0x04B6:
+  c->cyc += 10;
+  c->pc = 0x04B7;
+  i8080_aot_op_0x35(c, 0x0000); // dcr M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x04B7) < 6) {
+    goto dispatch;
+  }
+i_0x04B7:
+  c->cyc += 7;
+  c->pc = 0x04B8;
+  i8080_aot_op_0x86(c, 0x0000); // add M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x04B8:
+  i8080_aot_op_0xFE(c, 0x005A); // cpi $5A
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x04BD;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x04BD);
+
+b_0x04BD:
+  if (!(i8080_aot_code(c, 0x04BD, "\x01\xFF\x12\x11\xFF\x12\x21\xFF\x12\x03\x13\x23\x3E\x13\xB8\xC4\xA0\x06", 18))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x01(c, 0x12FF); // lxi b,$12FF
+  n += 1;
+  i8080_aot_op_0x11(c, 0x12FF); // lxi d,$12FF
+  n += 1;
+  i8080_aot_op_0x21(c, 0x12FF); // lxi h,$12FF
+  n += 1;
+  i8080_aot_op_0x03(c, 0x0000); // inx b
+  n += 1;
+  i8080_aot_op_0x13(c, 0x0000); // inx d
+  n += 1;
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  i8080_aot_op_0x3E(c, 0x0013); // mvi a,$13
+  n += 1;
+  i8080_aot_op_0xB8(c, 0x0000); // cmp b
+  n += 1;
+  c->cyc += 67;
+  c->pc = 0x04CF;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x04CF);
+
+b_0x04CF:
+  if (!(i8080_aot_code(c, 0x04CF, "\xBA\xC4\xA0\x06", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xBA(c, 0x0000); // cmp d
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x04D3;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x04D3);
+
+b_0x04D3:
+  if (!(i8080_aot_code(c, 0x04D3, "\xBC\xC4\xA0\x06", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xBC(c, 0x0000); // cmp h
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x04D7;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x04D7);
+
+b_0x04D7:
+  if (!(i8080_aot_code(c, 0x04D7, "\x3E\x00\xB9\xC4\xA0\x06", 6))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x0000); // mvi a,$00
+  n += 1;
+  i8080_aot_op_0xB9(c, 0x0000); // cmp c
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x04DD;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x04DD);
+
+b_0x04DD:
+  if (!(i8080_aot_code(c, 0x04DD, "\xBB\xC4\xA0\x06", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xBB(c, 0x0000); // cmp e
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x04E1;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x04E1);
+
+b_0x04E1:
+  if (!(i8080_aot_code(c, 0x04E1, "\xBD\xC4\xA0\x06", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xBD(c, 0x0000); // cmp l
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x04E5;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x04E5);
+
+b_0x04E5:
+  if (!(i8080_aot_code(c, 0x04E5, "\x0B\x1B\x2B\x3E\x12\xB8\xC4\xA0\x06", 9))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x0B(c, 0x0000); // dcx b
+  n += 1;
+  i8080_aot_op_0x1B(c, 0x0000); // dcx d
+  n += 1;
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  i8080_aot_op_0x3E(c, 0x0012); // mvi a,$12
+  n += 1;
+  i8080_aot_op_0xB8(c, 0x0000); // cmp b
+  n += 1;
+  c->cyc += 37;
+  c->pc = 0x04EE;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x04EE);
+
+b_0x04EE:
+  if (!(i8080_aot_code(c, 0x04EE, "\xBA\xC4\xA0\x06", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xBA(c, 0x0000); // cmp d
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x04F2;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x04F2);
+
+b_0x04F2:
+  if (!(i8080_aot_code(c, 0x04F2, "\xBC\xC4\xA0\x06", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xBC(c, 0x0000); // cmp h
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x04F6;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x04F6);
+
+b_0x04F6:
+  if (!(i8080_aot_code(c, 0x04F6, "\x3E\xFF\xB9\xC4\xA0\x06", 6))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x00FF); // mvi a,$FF
+  n += 1;
+  i8080_aot_op_0xB9(c, 0x0000); // cmp c
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x04FC;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x04FC);
+
+b_0x04FC:
+  if (!(i8080_aot_code(c, 0x04FC, "\xBB\xC4\xA0\x06", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xBB(c, 0x0000); // cmp e
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x0500;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x0500);
+
+b_0x0500:
+  if (!(i8080_aot_code(c, 0x0500, "\xBD\xC4\xA0\x06", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xBD(c, 0x0000); // cmp l
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x0504;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x0504);
+
+b_0x0504:
+  if (!(i8080_aot_code(c, 0x0504, "\x32\xBF\x06\xAF\x3A\xBF\x06\xFE\xFF\xC4\xA0\x06", 12))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x0507;
+  i8080_aot_op_0x32(c, 0x06BF); // sta $06BF
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0507:
+  i8080_aot_op_0xAF(c, 0x0000); // xra a
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x050B;
+  i8080_aot_op_0x3A(c, 0x06BF); // lda $06BF
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x050B:
+  i8080_aot_op_0xFE(c, 0x00FF); // cpi $FF
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x0510;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x0510);
+
+b_0x0510:
+  if (!(i8080_aot_code(c, 0x0510, "\x2A\xBD\x06\x22\xBF\x06\x3A\xBD\x06\x47\x3A\xBF\x06\xB8\xC4\xA0\x06", 17))) {
+    goto fallback;
+  }
+  c->cyc += 16;
+  c->pc = 0x0513;
+  i8080_aot_op_0x2A(c, 0x06BD); // lhld $06BD
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0513:
+  c->cyc += 16;
+  c->pc = 0x0516;
+  i8080_aot_op_0x22(c, 0x06BF); // shld $06BF
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0516:
+  c->cyc += 13;
+  c->pc = 0x0519;
+  i8080_aot_op_0x3A(c, 0x06BD); // lda $06BD
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0519:
+  i8080_aot_op_0x47(c, 0x0000); // mov b,a
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x051D;
+  i8080_aot_op_0x3A(c, 0x06BF); // lda $06BF
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x051D:
+  i8080_aot_op_0xB8(c, 0x0000); // cmp b
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x0521;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x0521);
+
+b_0x0521:
+  if (!(i8080_aot_code(c, 0x0521, "\x3A\xBE\x06\x47\x3A\xC0\x06\xB8\xC4\xA0\x06", 11))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x0524;
+  i8080_aot_op_0x3A(c, 0x06BE); // lda $06BE
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0524:
+  i8080_aot_op_0x47(c, 0x0000); // mov b,a
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x0528;
+  i8080_aot_op_0x3A(c, 0x06C0); // lda $06C0
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0528:
+  i8080_aot_op_0xB8(c, 0x0000); // cmp b
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x052C;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x052C);
+
+b_0x052C:
+  if (!(i8080_aot_code(c, 0x052C, "\x3E\xAA\x32\xBF\x06\x44\x4D\xAF\x0A\xFE\xAA\xC4\xA0\x06", 14))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x00AA); // mvi a,$AA
+  n += 1;
+  c->cyc += 20;
+  c->pc = 0x0531;
+  i8080_aot_op_0x32(c, 0x06BF); // sta $06BF
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0531:
+  i8080_aot_op_0x44(c, 0x0000); // mov b,h
+  n += 1;
+  i8080_aot_op_0x4D(c, 0x0000); // mov c,l
+  n += 1;
+  i8080_aot_op_0xAF(c, 0x0000); // xra a
+  n += 1;
+  c->cyc += 21;
+  c->pc = 0x0535;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0535:
+  i8080_aot_op_0xFE(c, 0x00AA); // cpi $AA
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x053A;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x053A);
+
+b_0x053A:
+  if (!(i8080_aot_code(c, 0x053A, "\x3C\x02\x3A\xBF\x06\xFE\xAB\xC4\xA0\x06", 10))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3C(c, 0x0000); // inr a
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x053C;
+  i8080_aot_op_0x02(c, 0x0000); // stax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_bc(c) - 0x053C) < 8) {
+    goto dispatch;
+  }
+i_0x053C:
+  c->cyc += 13;
+  c->pc = 0x053F;
+  i8080_aot_op_0x3A(c, 0x06BF); // lda $06BF
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x053F:
+  i8080_aot_op_0xFE(c, 0x00AB); // cpi $AB
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x0544;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x0544);
+
+b_0x0544:
+  if (!(i8080_aot_code(c, 0x0544, "\x3E\x77\x32\xBF\x06\x2A\xBD\x06\x11\x00\x00\xEB\xAF\x1A\xFE\x77\xC4\xA0\x06", 19))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x0077); // mvi a,$77
+  n += 1;
+  c->cyc += 20;
+  c->pc = 0x0549;
+  i8080_aot_op_0x32(c, 0x06BF); // sta $06BF
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0549:
+  c->cyc += 16;
+  c->pc = 0x054C;
+  i8080_aot_op_0x2A(c, 0x06BD); // lhld $06BD
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x054C:
+  i8080_aot_op_0x11(c, 0x0000); // lxi d,$0000
+  n += 1;
+  i8080_aot_op_0xEB(c, 0x0000); // xchg
+  n += 1;
+  i8080_aot_op_0xAF(c, 0x0000); // xra a
+  n += 1;
+  c->cyc += 25;
+  c->pc = 0x0552;
+  i8080_aot_op_0x1A(c, 0x0000); // ldax d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0552:
+  i8080_aot_op_0xFE(c, 0x0077); // cpi $77
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x0557;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x0557);
+
+b_0x0557:
+  if (!(i8080_aot_code(c, 0x0557, "\xAF\x84\x85\xC4\xA0\x06", 6))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xAF(c, 0x0000); // xra a
+  n += 1;
+  i8080_aot_op_0x84(c, 0x0000); // add h
+  n += 1;
+  i8080_aot_op_0x85(c, 0x0000); // add l
+  n += 1;
+  c->cyc += 23;
+  c->pc = 0x055D;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x055D);
+
+b_0x055D:
+  if (!(i8080_aot_code(c, 0x055D, "\x3E\xCC\x12\x3A\xBF\x06\xFE\xCC\x12\x3A\xBF\x06\xFE\xCC\xC4\xA0\x06", 17))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x00CC); // mvi a,$CC
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x0560;
+  i8080_aot_op_0x12(c, 0x0000); // stax d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_de(c) - 0x0560) < 14) {
+    goto dispatch;
+  }
+i_0x0560:
+  c->cyc += 13;
+  c->pc = 0x0563;
+  i8080_aot_op_0x3A(c, 0x06BF); // lda $06BF
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0563:
+  i8080_aot_op_0xFE(c, 0x00CC); // cpi $CC
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x0566;
+  i8080_aot_op_0x12(c, 0x0000); // stax d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_de(c) - 0x0566) < 8) {
+    goto dispatch;
+  }
+i_0x0566:
+  c->cyc += 13;
+  c->pc = 0x0569;
+  i8080_aot_op_0x3A(c, 0x06BF); // lda $06BF
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0569:
+  i8080_aot_op_0xFE(c, 0x00CC); // cpi $CC
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x056E;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x056E);
+
+b_0x056E:
+  if (!(i8080_aot_code(c, 0x056E, "\x21\x77\x77\x29\x3E\xEE\xBC\xC4\xA0\x06", 10))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x21(c, 0x7777); // lxi h,$7777
+  n += 1;
+  i8080_aot_op_0x29(c, 0x0000); // dad h
+  n += 1;
+  i8080_aot_op_0x3E(c, 0x00EE); // mvi a,$EE
+  n += 1;
+  i8080_aot_op_0xBC(c, 0x0000); // cmp h
+  n += 1;
+  c->cyc += 42;
+  c->pc = 0x0578;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x0578);
+
+b_0x0578:
+  if (!(i8080_aot_code(c, 0x0578, "\xBD\xC4\xA0\x06", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xBD(c, 0x0000); // cmp l
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x057C;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x057C);
+
+b_0x057C:
+  if (!(i8080_aot_code(c, 0x057C, "\x21\x55\x55\x01\xFF\xFF\x09\x3E\x55\xD4\xA0\x06", 12))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x21(c, 0x5555); // lxi h,$5555
+  n += 1;
+  i8080_aot_op_0x01(c, 0xFFFF); // lxi b,$FFFF
+  n += 1;
+  i8080_aot_op_0x09(c, 0x0000); // dad b
+  n += 1;
+  i8080_aot_op_0x3E(c, 0x0055); // mvi a,$55
+  n += 1;
+  c->cyc += 48;
+  c->pc = 0x0588;
+  i8080_aot_op_0xD4(c, 0x06A0); // cnc $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x0588);
+
+b_0x0588:
+  if (!(i8080_aot_code(c, 0x0588, "\xBC\xC4\xA0\x06", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xBC(c, 0x0000); // cmp h
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x058C;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x058C);
+
+b_0x058C:
+  if (!(i8080_aot_code(c, 0x058C, "\x3E\x54\xBD\xC4\xA0\x06", 6))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x0054); // mvi a,$54
+  n += 1;
+  i8080_aot_op_0xBD(c, 0x0000); // cmp l
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x0592;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x0592);
+
+b_0x0592:
+  if (!(i8080_aot_code(c, 0x0592, "\x21\xAA\xAA\x11\x33\x33\x19\x3E\xDD\xBC\xC4\xA0\x06", 13))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x21(c, 0xAAAA); // lxi h,$AAAA
+  n += 1;
+  i8080_aot_op_0x11(c, 0x3333); // lxi d,$3333
+  n += 1;
+  i8080_aot_op_0x19(c, 0x0000); // dad d
+  n += 1;
+  i8080_aot_op_0x3E(c, 0x00DD); // mvi a,$DD
+  n += 1;
+  i8080_aot_op_0xBC(c, 0x0000); // cmp h
+  n += 1;
+  c->cyc += 52;
+  c->pc = 0x059F;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x059F);
+
+b_0x059F:
+  if (!(i8080_aot_code(c, 0x059F, "\xBD\xC4\xA0\x06", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xBD(c, 0x0000); // cmp l
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x05A3;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x05A3);
+
+b_0x05A3:
+  if (!(i8080_aot_code(c, 0x05A3, "\x37\xD4\xA0\x06", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x37(c, 0x0000); // stc
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x05A7;
+  i8080_aot_op_0xD4(c, 0x06A0); // cnc $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x05A7);
+
+b_0x05A7:
+  if (!(i8080_aot_code(c, 0x05A7, "\x3F\xDC\xA0\x06", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3F(c, 0x0000); // cmc
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x05AB;
+  i8080_aot_op_0xDC(c, 0x06A0); // cc $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x05AB);
+
+b_0x05AB:
+  if (!(i8080_aot_code(c, 0x05AB, "\x3E\xAA\x2F\xFE\x55\xC4\xA0\x06", 8))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x00AA); // mvi a,$AA
+  n += 1;
+  i8080_aot_op_0x2F(c, 0x0000); // cma
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x0055); // cpi $55
+  n += 1;
+  c->cyc += 29;
+  c->pc = 0x05B3;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x05B3);
+
+b_0x05B3:
+  if (!(i8080_aot_code(c, 0x05B3, "\xB7\x27\xFE\x55\xC4\xA0\x06", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xB7(c, 0x0000); // ora a
+  n += 1;
+  i8080_aot_op_0x27(c, 0x0000); // daa
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x0055); // cpi $55
+  n += 1;
+  c->cyc += 26;
+  c->pc = 0x05BA;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x05BA);
+
+b_0x05BA:
+  if (!(i8080_aot_code(c, 0x05BA, "\x3E\x88\x87\x27\xFE\x76\xC4\xA0\x06", 9))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x0088); // mvi a,$88
+  n += 1;
+  i8080_aot_op_0x87(c, 0x0000); // add a
+  n += 1;
+  i8080_aot_op_0x27(c, 0x0000); // daa
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x0076); // cpi $76
+  n += 1;
+  c->cyc += 33;
+  c->pc = 0x05C3;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x05C3);
+
+b_0x05C3:
+  if (!(i8080_aot_code(c, 0x05C3, "\xAF\x3E\xAA\x27\xD4\xA0\x06", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xAF(c, 0x0000); // xra a
+  n += 1;
+  i8080_aot_op_0x3E(c, 0x00AA); // mvi a,$AA
+  n += 1;
+  i8080_aot_op_0x27(c, 0x0000); // daa
+  n += 1;
+  c->cyc += 26;
+  c->pc = 0x05CA;
+  i8080_aot_op_0xD4(c, 0x06A0); // cnc $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x05CA);
+
+b_0x05CA:
+  if (!(i8080_aot_code(c, 0x05CA, "\xFE\x10\xC4\xA0\x06", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xFE(c, 0x0010); // cpi $10
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x05CF;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x05CF);
+
+b_0x05CF:
+  if (!(i8080_aot_code(c, 0x05CF, "\xAF\x3E\x9A\x27\xD4\xA0\x06", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xAF(c, 0x0000); // xra a
+  n += 1;
+  i8080_aot_op_0x3E(c, 0x009A); // mvi a,$9A
+  n += 1;
+  i8080_aot_op_0x27(c, 0x0000); // daa
+  n += 1;
+  c->cyc += 26;
+  c->pc = 0x05D6;
+  i8080_aot_op_0xD4(c, 0x06A0); // cnc $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x05D6);
+
+b_0x05D6:
+  if (!(i8080_aot_code(c, 0x05D6, "\xC4\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x05D9;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x05D9);
+
+b_0x05D9:
+  if (!(i8080_aot_code(c, 0x05D9, "\x37\x3E\x42\x07\xDC\xA0\x06", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x37(c, 0x0000); // stc
+  n += 1;
+  i8080_aot_op_0x3E(c, 0x0042); // mvi a,$42
+  n += 1;
+  i8080_aot_op_0x07(c, 0x0000); // rlc
+  n += 1;
+  c->cyc += 26;
+  c->pc = 0x05E0;
+  i8080_aot_op_0xDC(c, 0x06A0); // cc $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x05E0);
+
+b_0x05E0:
+  if (!(i8080_aot_code(c, 0x05E0, "\x07\xD4\xA0\x06", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x07(c, 0x0000); // rlc
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x05E4;
+  i8080_aot_op_0xD4(c, 0x06A0); // cnc $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x05E4);
+
+b_0x05E4:
+  if (!(i8080_aot_code(c, 0x05E4, "\xFE\x09\xC4\xA0\x06", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xFE(c, 0x0009); // cpi $09
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x05E9;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x05E9);
+
+b_0x05E9:
+  if (!(i8080_aot_code(c, 0x05E9, "\x0F\xD4\xA0\x06", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x0F(c, 0x0000); // rrc
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x05ED;
+  i8080_aot_op_0xD4(c, 0x06A0); // cnc $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x05ED);
+
+b_0x05ED:
+  if (!(i8080_aot_code(c, 0x05ED, "\x0F\xFE\x42\xC4\xA0\x06", 6))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x0F(c, 0x0000); // rrc
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x0042); // cpi $42
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x05F3;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x05F3);
+
+b_0x05F3:
+  if (!(i8080_aot_code(c, 0x05F3, "\x17\x17\xD4\xA0\x06", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x17(c, 0x0000); // ral
+  n += 1;
+  i8080_aot_op_0x17(c, 0x0000); // ral
+  n += 1;
+  c->cyc += 19;
+  c->pc = 0x05F8;
+  i8080_aot_op_0xD4(c, 0x06A0); // cnc $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x05F8);
+
+b_0x05F8:
+  if (!(i8080_aot_code(c, 0x05F8, "\xFE\x08\xC4\xA0\x06", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xFE(c, 0x0008); // cpi $08
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x05FD;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x05FD);
+
+b_0x05FD:
+  if (!(i8080_aot_code(c, 0x05FD, "\x1F\x1F\xDC", 3) &&
+      i8080_aot_code(c, 0x0600, "\xA0\x06", 2))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x1F(c, 0x0000); // rar
+  n += 1;
+  i8080_aot_op_0x1F(c, 0x0000); // rar
+  n += 1;
+  c->cyc += 19;
+  c->pc = 0x0602;
+  i8080_aot_op_0xDC(c, 0x06A0); // cc $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x0602);
+
+b_0x0602:
+  if (!(i8080_aot_code(c, 0x0602, "\xFE\x02\xC4\xA0\x06", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xFE(c, 0x0002); // cpi $02
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x0607;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x0607);
+
+b_0x0607:
+  if (!(i8080_aot_code(c, 0x0607, "\x01\x34\x12\x11\xAA\xAA\x21\x55\x55\xAF\xC5\xD5\xE5\xF5\x01\x00\x00\x11\x00\x00\x21\x00\x00\x3E\xC0\xC6\xF0\xF1\xE1\xD1", 30))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x01(c, 0x1234); // lxi b,$1234
+  n += 1;
+  i8080_aot_op_0x11(c, 0xAAAA); // lxi d,$AAAA
+  n += 1;
+  i8080_aot_op_0x21(c, 0x5555); // lxi h,$5555
+  n += 1;
+  i8080_aot_op_0xAF(c, 0x0000); // xra a
+  n += 1;
+  c->cyc += 45;
+  c->pc = 0x0612;
+  i8080_aot_op_0xC5(c, 0x0000); // push b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0611) < 20) {
+    goto dispatch;
+  }
+i_0x0612:
+  c->cyc += 11;
+  c->pc = 0x0613;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0612) < 19) {
+    goto dispatch;
+  }
+i_0x0613:
+  c->cyc += 11;
+  c->pc = 0x0614;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0613) < 18) {
+    goto dispatch;
+  }
+i_0x0614:
+  c->cyc += 11;
+  c->pc = 0x0615;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0614) < 17) {
+    goto dispatch;
+  }
+i_0x0615:
+  i8080_aot_op_0x01(c, 0x0000); // lxi b,$0000
+  n += 1;
+  i8080_aot_op_0x11(c, 0x0000); // lxi d,$0000
+  n += 1;
+  i8080_aot_op_0x21(c, 0x0000); // lxi h,$0000
+  n += 1;
+  i8080_aot_op_0x3E(c, 0x00C0); // mvi a,$C0
+  n += 1;
+  i8080_aot_op_0xC6(c, 0x00F0); // adi $F0
+  n += 1;
+  c->cyc += 54;
+  c->pc = 0x0623;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0623:
+  c->cyc += 10;
+  c->pc = 0x0624;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0624:
+  c->cyc += 10;
+  c->pc = 0x0625;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  JUMP(0x0625);
+
+b_0x0625:
+  if (!(i8080_aot_code(c, 0x0625, "\xC1\xDC\xA0\x06", 4))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0626;
+  i8080_aot_op_0xC1(c, 0x0000); // pop b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0626:
+  c->cyc += 11;
+  c->pc = 0x0629;
+  i8080_aot_op_0xDC(c, 0x06A0); // cc $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x0629);
+
+b_0x0629:
+  if (!(i8080_aot_code(c, 0x0629, "\xC4\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x062C;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x062C);
+
+b_0x062C:
+  if (!(i8080_aot_code(c, 0x062C, "\xE4\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x062F;
+  i8080_aot_op_0xE4(c, 0x06A0); // cpo $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x062F);
+
+b_0x062F:
+  if (!(i8080_aot_code(c, 0x062F, "\xFC\xA0\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0632;
+  i8080_aot_op_0xFC(c, 0x06A0); // cm $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x0632);
+
+b_0x0632:
+  if (!(i8080_aot_code(c, 0x0632, "\x3E\x12\xB8\xC4\xA0\x06", 6))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x0012); // mvi a,$12
+  n += 1;
+  i8080_aot_op_0xB8(c, 0x0000); // cmp b
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x0638;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x0638);
+
+b_0x0638:
+  if (!(i8080_aot_code(c, 0x0638, "\x3E\x34\xB9\xC4\xA0\x06", 6))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x0034); // mvi a,$34
+  n += 1;
+  i8080_aot_op_0xB9(c, 0x0000); // cmp c
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x063E;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x063E);
+
+b_0x063E:
+  if (!(i8080_aot_code(c, 0x063E, "\x3E\xAA\xBA\xC4\xA0\x06", 6))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x00AA); // mvi a,$AA
+  n += 1;
+  i8080_aot_op_0xBA(c, 0x0000); // cmp d
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x0644;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x0644);
+
+b_0x0644:
+  if (!(i8080_aot_code(c, 0x0644, "\xBB\xC4\xA0\x06", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xBB(c, 0x0000); // cmp e
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x0648;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x0648);
+
+b_0x0648:
+  if (!(i8080_aot_code(c, 0x0648, "\x3E\x55\xBC\xC4\xA0\x06", 6))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x0055); // mvi a,$55
+  n += 1;
+  i8080_aot_op_0xBC(c, 0x0000); // cmp h
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x064E;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x064E);
+
+b_0x064E:
+  if (!(i8080_aot_code(c, 0x064E, "\xBD\xC4\xA0\x06", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xBD(c, 0x0000); // cmp l
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x0652;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x0652);
+
+b_0x0652:
+  if (!(i8080_aot_code(c, 0x0652, "\x21\x00\x00\x39\x22\xC4\x06\x31\xC3\x06\x3B\x3B\x33\x3B\x3E\x55\x32\xC1\x06\x2F\x32\xC2\x06\xC1\xB8\xC4\xA0\x06", 28))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x21(c, 0x0000); // lxi h,$0000
+  n += 1;
+  i8080_aot_op_0x39(c, 0x0000); // dad sp
+  n += 1;
+  c->cyc += 36;
+  c->pc = 0x0659;
+  i8080_aot_op_0x22(c, 0x06C4); // shld $06C4
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0659:
+  i8080_aot_op_0x31(c, 0x06C3); // lxi sp,$06C3
+  n += 1;
+  i8080_aot_op_0x3B(c, 0x0000); // dcx sp
+  n += 1;
+  i8080_aot_op_0x3B(c, 0x0000); // dcx sp
+  n += 1;
+  i8080_aot_op_0x33(c, 0x0000); // inx sp
+  n += 1;
+  i8080_aot_op_0x3B(c, 0x0000); // dcx sp
+  n += 1;
+  i8080_aot_op_0x3E(c, 0x0055); // mvi a,$55
+  n += 1;
+  c->cyc += 50;
+  c->pc = 0x0665;
+  i8080_aot_op_0x32(c, 0x06C1); // sta $06C1
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0665:
+  i8080_aot_op_0x2F(c, 0x0000); // cma
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0669;
+  i8080_aot_op_0x32(c, 0x06C2); // sta $06C2
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0669:
+  c->cyc += 10;
+  c->pc = 0x066A;
+  i8080_aot_op_0xC1(c, 0x0000); // pop b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x066A:
+  i8080_aot_op_0xB8(c, 0x0000); // cmp b
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x066E;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x066E);
+
+b_0x066E:
+  if (!(i8080_aot_code(c, 0x066E, "\x2F\xB9\xC4\xA0\x06", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x2F(c, 0x0000); // cma
+  n += 1;
+  i8080_aot_op_0xB9(c, 0x0000); // cmp c
+  n += 1;
+  c->cyc += 19;
+  c->pc = 0x0673;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x0673);
+
+b_0x0673:
+  if (!(i8080_aot_code(c, 0x0673, "\x21\xC3\x06\xF9\x21\x33\x77\x3B\x3B\xE3\x3A\xC2\x06\xFE\x77\xC4\xA0\x06", 18))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x21(c, 0x06C3); // lxi h,$06C3
+  n += 1;
+  i8080_aot_op_0xF9(c, 0x0000); // sphl
+  n += 1;
+  i8080_aot_op_0x21(c, 0x7733); // lxi h,$7733
+  n += 1;
+  i8080_aot_op_0x3B(c, 0x0000); // dcx sp
+  n += 1;
+  i8080_aot_op_0x3B(c, 0x0000); // dcx sp
+  n += 1;
+  c->cyc += 53;
+  c->pc = 0x067D;
+  i8080_aot_op_0xE3(c, 0x0000); // xthl
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x067C) < 9) {
+    goto dispatch;
+  }
+i_0x067D:
+  c->cyc += 13;
+  c->pc = 0x0680;
+  i8080_aot_op_0x3A(c, 0x06C2); // lda $06C2
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0680:
+  i8080_aot_op_0xFE(c, 0x0077); // cpi $77
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x0685;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x0685);
+
+b_0x0685:
+  if (!(i8080_aot_code(c, 0x0685, "\x3A\xC1\x06\xFE\x33\xC4\xA0\x06", 8))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x0688;
+  i8080_aot_op_0x3A(c, 0x06C1); // lda $06C1
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0688:
+  i8080_aot_op_0xFE(c, 0x0033); // cpi $33
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x068D;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x068D);
+
+b_0x068D:
+  if (!(i8080_aot_code(c, 0x068D, "\x3E\x55\xBD\xC4\xA0\x06", 6))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x0055); // mvi a,$55
+  n += 1;
+  i8080_aot_op_0xBD(c, 0x0000); // cmp l
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x0693;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x0693);
+
+b_0x0693:
+  if (!(i8080_aot_code(c, 0x0693, "\x2F\xBC\xC4\xA0\x06", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x2F(c, 0x0000); // cma
+  n += 1;
+  i8080_aot_op_0xBC(c, 0x0000); // cmp h
+  n += 1;
+  c->cyc += 19;
+  c->pc = 0x0698;
+  i8080_aot_op_0xC4(c, 0x06A0); // cnz $06A0
+  n += 1;
+  if (c->pc == 0x06A0) {
+    JUMP(0x06A0);
+  }
+  JUMP(0x0698);
+
+b_0x0698:
+  if (!(i8080_aot_code(c, 0x0698, "\x2A\xC4\x06\xF9\x21\xB4\x06\xE9", 8))) {
+    goto fallback;
+  }
+  c->cyc += 16;
+  c->pc = 0x069B;
+  i8080_aot_op_0x2A(c, 0x06C4); // lhld $06C4
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x069B:
+  i8080_aot_op_0xF9(c, 0x0000); // sphl
+  n += 1;
+  i8080_aot_op_0x21(c, 0x06B4); // lxi h,$06B4
+  n += 1;
+  c->cyc += 20;
+  c->pc = 0x06A0;
+  i8080_aot_op_0xE9(c, 0x0000); // pchl
+  n += 1;
+  goto dispatch;
+
+b_0x06A0:
+  if (!(i8080_aot_code(c, 0x06A0, "\x21\x90\x01\xCD\x4B\x01", 6))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x21(c, 0x0190); // lxi h,$0190
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x06A6;
+  i8080_aot_op_0xCD(c, 0x014B); // call $014B
+  n += 1;
+  JUMP(0x014B);
+
+b_0x06A6:
+  if (!(i8080_aot_code(c, 0x06A6, "\xE1\xE5\x7C\xCD\x5A\x01", 6))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x06A7;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x06A7:
+  c->cyc += 11;
+  c->pc = 0x06A8;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x06A7) < 5) {
+    goto dispatch;
+  }
+i_0x06A8:
+  i8080_aot_op_0x7C(c, 0x0000); // mov a,h
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x06AC;
+  i8080_aot_op_0xCD(c, 0x015A); // call $015A
+  n += 1;
+  JUMP(0x015A);
+
+b_0x06AC:
+  if (!(i8080_aot_code(c, 0x06AC, "\xE1\x7D\xCD\x5A\x01", 5))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x06AD;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x06AD:
+  i8080_aot_op_0x7D(c, 0x0000); // mov a,l
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x06B1;
+  i8080_aot_op_0xCD(c, 0x015A); // call $015A
+  n += 1;
+  JUMP(0x015A);
+
+b_0x06B1:
+  if (!(i8080_aot_code(c, 0x06B1, "\xC3\x00\x00", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x06B4;
+  i8080_aot_op_0xC3(c, 0x0000); // jmp $0000
+  n += 1;
+  goto dispatch;
+}
+
+// cpu_tests/CPUTEST.COM: 2338 instructions in 596 blocks
+static unsigned long rom_cputest_com(i8080* const c, unsigned long cycles) {
+  const unsigned long start = c->cyc;
+  unsigned long n = 0;
+
+dispatch:
+  if (EVENTS(c) != 0 || c->cyc - start >= cycles) {
+    return n;
+  }
+
+  switch (c->pc) {
+  case 0x0100: goto b_0x0100;
+  case 0x0106: goto b_0x0106;
+  case 0x0109: goto b_0x0109;
+  case 0x010A: goto b_0x010A;
+  case 0x0110: goto b_0x0110;
+  case 0x0113: goto b_0x0113;
+  case 0x0115:
+    if (i8080_aot_code(c, 0x0115, "\x44\x49\x41\x47\x4E\x4F\x53\x54\x49\x43\x53\x20\x49\x49", 14)) {
+      goto i_0x0115;
+    }
+    break;
+  case 0x011A:
+    if (i8080_aot_code(c, 0x011A, "\x4F\x53\x54\x49\x43\x53\x20\x49\x49", 9)) {
+      goto i_0x011A;
+    }
+    break;
+  case 0x0123: goto b_0x0123;
+  case 0x0125:
+    if (i8080_aot_code(c, 0x0125, "\x31\x2E\x32\x20\x2D\x20\x43\x50\x55\x20\x54\x45\x53\x54\x0D\x0A", 16)) {
+      goto i_0x0125;
+    }
+    break;
+  case 0x0135: goto b_0x0135;
+  case 0x0149: goto b_0x0149;
+  case 0x0152:
+    if (i8080_aot_code(c, 0x0152, "\x54\x20\x41\x53\x53\x4F\x43", 7)) {
+      goto i_0x0152;
+    }
+    break;
+  case 0x0159: goto b_0x0159;
+  case 0x0160:
+    if (i8080_aot_code(c, 0x0160, "\x0A\x00\xC3\x6D\x01", 5)) {
+      goto i_0x0160;
+    }
+    break;
+  case 0x0161:
+    if (i8080_aot_code(c, 0x0161, "\x00\xC3\x6D\x01", 4)) {
+      goto i_0x0161;
+    }
+    break;
+  case 0x016D: goto b_0x016D;
+  case 0x0170: goto b_0x0170;
+  case 0x018D: goto b_0x018D;
+  case 0x0194: goto b_0x0194;
+  case 0x0199: goto b_0x0199;
+  case 0x019E: goto b_0x019E;
+  case 0x01A1:
+    if (i8080_aot_code(c, 0x01A1, "\xB7\xC2\xAB\x01", 4)) {
+      goto i_0x01A1;
+    }
+    break;
+  case 0x01A5: goto b_0x01A5;
+  case 0x01A8: goto b_0x01A8;
+  case 0x01AB: goto b_0x01AB;
+  case 0x01AE: goto b_0x01AE;
+  case 0x01B0: goto b_0x01B0;
+  case 0x01B4: goto b_0x01B4;
+  case 0x01B7: goto b_0x01B7;
+  case 0x01BC: goto b_0x01BC;
+  case 0x01CA: goto b_0x01CA;
+  case 0x01D0: goto b_0x01D0;
+  case 0x01D5: goto b_0x01D5;
+  case 0x01D6: goto b_0x01D6;
+  case 0x01D9:
+    if (i8080_aot_code(c, 0x01D9, "\xCD\x0F\x09", 3)) {
+      goto i_0x01D9;
+    }
+    break;
+  case 0x01DC: goto b_0x01DC;
+  case 0x022B: goto b_0x022B;
+  case 0x022E: goto b_0x022E;
+  case 0x0238: goto b_0x0238;
+  case 0x023B: goto b_0x023B;
+  case 0x023D:
+    if (i8080_aot_code(c, 0x023D, "\x43\x50\x55\x20\x49\x53\x20\x00\x3A\x72\x0C\xB7\xCA\x80\x02", 15)) {
+      goto i_0x023D;
+    }
+    break;
+  case 0x0248:
+    if (i8080_aot_code(c, 0x0248, "\xB7\xCA\x80\x02", 4)) {
+      goto i_0x0248;
+    }
+    break;
+  case 0x024C: goto b_0x024C;
+  case 0x024F: goto b_0x024F;
+  case 0x0256:
+    if (i8080_aot_code(c, 0x0256, "\xB7\xC2\x8D\x02", 4)) {
+      goto i_0x0256;
+    }
+    break;
+  case 0x025A: goto b_0x025A;
+  case 0x025D: goto b_0x025D;
+  case 0x0262:
+    if (i8080_aot_code(c, 0x0262, "\x52\x45\x53\x48\x20\x52\x45\x47\x49\x53\x54", 11)) {
+      goto i_0x0262;
+    }
+    break;
+  case 0x026D: goto b_0x026D;
+  case 0x0271:
+    if (i8080_aot_code(c, 0x0271, "\x4F\x54\x20\x43\x48\x45\x43\x4B\x45\x44\x29\x00", 12)) {
+      goto i_0x0271;
+    }
+    break;
+  case 0x027D: goto b_0x027D;
+  case 0x0280: goto b_0x0280;
+  case 0x0283: goto b_0x0283;
+  case 0x028C:
+    if (i8080_aot_code(c, 0x028C, "\x00", 1)) {
+      goto i_0x028C;
+    }
+    break;
+  case 0x028D: goto b_0x028D;
+  case 0x0294: goto b_0x0294;
+  case 0x0296:
+    if (i8080_aot_code(c, 0x0296, "\x42\x45\x47\x49\x4E\x20\x54\x49\x4D\x49\x4E\x47\x20\x54", 14)) {
+      goto i_0x0296;
+    }
+    break;
+  case 0x029B:
+    if (i8080_aot_code(c, 0x029B, "\x20\x54\x49\x4D\x49\x4E\x47\x20\x54", 9)) {
+      goto i_0x029B;
+    }
+    break;
+  case 0x02A1:
+    if (i8080_aot_code(c, 0x02A1, "\x47\x20\x54", 3)) {
+      goto i_0x02A1;
+    }
+    break;
+  case 0x02A4: goto b_0x02A4;
+  case 0x02A9:
+    if (i8080_aot_code(c, 0x02A9, "\x00\xCD\x4E\x0C", 4)) {
+      goto i_0x02A9;
+    }
+    break;
+  case 0x02AD: goto b_0x02AD;
+  case 0x02B0: goto b_0x02B0;
+  case 0x02C5: goto b_0x02C5;
+  case 0x02C8: goto b_0x02C8;
+  case 0x02CB: goto b_0x02CB;
+  case 0x02CD:
+    if (i8080_aot_code(c, 0x02CD, "\x44\x20\x54\x49\x4D\x49\x4E\x47\x20\x54\x45\x53\x54\x0D", 14)) {
+      goto i_0x02CD;
+    }
+    break;
+  case 0x02D4:
+    if (i8080_aot_code(c, 0x02D4, "\x47\x20\x54\x45\x53\x54\x0D", 7)) {
+      goto i_0x02D4;
+    }
+    break;
+  case 0x02DB: goto b_0x02DB;
+  case 0x02DC:
+    if (i8080_aot_code(c, 0x02DC, "\x00\xCD\xF0\x03", 4)) {
+      goto i_0x02DC;
+    }
+    break;
+  case 0x02E0: goto b_0x02E0;
+  case 0x02E3: goto b_0x02E3;
+  case 0x02EC: goto b_0x02EC;
+  case 0x02EF: goto b_0x02EF;
+  case 0x02F7:
+    if (i8080_aot_code(c, 0x02F7, "\x44\x20\x00\x2A\x7E\x0C\xCD\x8B\x0B", 9)) {
+      goto i_0x02F7;
+    }
+    break;
+  case 0x02FD:
+    if (i8080_aot_code(c, 0x02FD, "\xCD\x8B\x0B", 3)) {
+      goto i_0x02FD;
+    }
+    break;
+  case 0x0300: goto b_0x0300;
+  case 0x0303: goto b_0x0303;
+  case 0x0305:
+    if (i8080_aot_code(c, 0x0305, "\x54\x41\x42\x4C\x45\x20\x53\x49\x5A\x45\x20\x00\x11\x84\xF3\x19", 16)) {
+      goto i_0x0305;
+    }
+    break;
+  case 0x0315: goto b_0x0315;
+  case 0x0318: goto b_0x0318;
+  case 0x031B: goto b_0x031B;
+  case 0x032A: goto b_0x032A;
+  case 0x032D: goto b_0x032D;
+  case 0x0330:
+    if (i8080_aot_code(c, 0x0330, "\x21\x75\x0C\x86\x57\x3E\x01\xCD\xFE\x08", 10)) {
+      goto i_0x0330;
+    }
+    break;
+  case 0x0334:
+    if (i8080_aot_code(c, 0x0334, "\x57\x3E\x01\xCD\xFE\x08", 6)) {
+      goto i_0x0334;
+    }
+    break;
+  case 0x033A: goto b_0x033A;
+  case 0x033D:
+    if (i8080_aot_code(c, 0x033D, "\x32\x74\x0C\x3A\x74\x0C\x21\x75\x0C\x86\x92\x57\x3A\x79\x0C\x92\x32\x79\x0C\xCD\x65\x0C", 22)) {
+      goto i_0x033D;
+    }
+    break;
+  case 0x0340:
+    if (i8080_aot_code(c, 0x0340, "\x3A\x74\x0C\x21\x75\x0C\x86\x92\x57\x3A\x79\x0C\x92\x32\x79\x0C\xCD\x65\x0C", 19)) {
+      goto i_0x0340;
+    }
+    break;
+  case 0x0343:
+    if (i8080_aot_code(c, 0x0343, "\x21\x75\x0C\x86\x92\x57\x3A\x79\x0C\x92\x32\x79\x0C\xCD\x65\x0C", 16)) {
+      goto i_0x0343;
+    }
+    break;
+  case 0x0347:
+    if (i8080_aot_code(c, 0x0347, "\x92\x57\x3A\x79\x0C\x92\x32\x79\x0C\xCD\x65\x0C", 12)) {
+      goto i_0x0347;
+    }
+    break;
+  case 0x034C:
+    if (i8080_aot_code(c, 0x034C, "\x92\x32\x79\x0C\xCD\x65\x0C", 7)) {
+      goto i_0x034C;
+    }
+    break;
+  case 0x0350:
+    if (i8080_aot_code(c, 0x0350, "\xCD\x65\x0C", 3)) {
+      goto i_0x0350;
+    }
+    break;
+  case 0x0353: goto b_0x0353;
+  case 0x038A: goto b_0x038A;
+  case 0x038B:
+    if (i8080_aot_code(c, 0x038B, "\xCD\x1D\x09", 3)) {
+      goto i_0x038B;
+    }
+    break;
+  case 0x038E: goto b_0x038E;
+  case 0x0397: goto b_0x0397;
+  case 0x0398:
+    if (i8080_aot_code(c, 0x0398, "\xF5\xD5\x57\x3A\x79\x0C\x92\x32\x79\x0C\xD1\xF1\xF5\xCD\x4E\x0B", 16)) {
+      goto i_0x0398;
+    }
+    break;
+  case 0x0399:
+    if (i8080_aot_code(c, 0x0399, "\xD5\x57\x3A\x79\x0C\x92\x32\x79\x0C\xD1\xF1\xF5\xCD\x4E\x0B", 15)) {
+      goto i_0x0399;
+    }
+    break;
+  case 0x039A:
+    if (i8080_aot_code(c, 0x039A, "\x57\x3A\x79\x0C\x92\x32\x79\x0C\xD1\xF1\xF5\xCD\x4E\x0B", 14)) {
+      goto i_0x039A;
+    }
+    break;
+  case 0x039E:
+    if (i8080_aot_code(c, 0x039E, "\x92\x32\x79\x0C\xD1\xF1\xF5\xCD\x4E\x0B", 10)) {
+      goto i_0x039E;
+    }
+    break;
+  case 0x03A2:
+    if (i8080_aot_code(c, 0x03A2, "\xD1\xF1\xF5\xCD\x4E\x0B", 6)) {
+      goto i_0x03A2;
+    }
+    break;
+  case 0x03A3:
+    if (i8080_aot_code(c, 0x03A3, "\xF1\xF5\xCD\x4E\x0B", 5)) {
+      goto i_0x03A3;
+    }
+    break;
+  case 0x03A4:
+    if (i8080_aot_code(c, 0x03A4, "\xF5\xCD\x4E\x0B", 4)) {
+      goto i_0x03A4;
+    }
+    break;
+  case 0x03A5:
+    if (i8080_aot_code(c, 0x03A5, "\xCD\x4E\x0B", 3)) {
+      goto i_0x03A5;
+    }
+    break;
+  case 0x03A8: goto b_0x03A8;
+  case 0x03AD: goto b_0x03AD;
+  case 0x03B0: goto b_0x03B0;
+  case 0x03B5: goto b_0x03B5;
+  case 0x03B6:
+    if (i8080_aot_code(c, 0x03B6, "\xC9", 1)) {
+      goto i_0x03B6;
+    }
+    break;
+  case 0x03E6: goto b_0x03E6;
+  case 0x03E9: goto b_0x03E9;
+  case 0x03EA: goto b_0x03EA;
+  case 0x03EF: goto b_0x03EF;
+  case 0x03F0: goto b_0x03F0;
+  case 0x03F6: goto b_0x03F6;
+  case 0x03F9: goto b_0x03F9;
+  case 0x03FF:
+    if (i8080_aot_code(c, 0x03FF, "\x3E", 1) &&
+      i8080_aot_code(c, 0x0400, "\x00\x32\x47\x04\x32\x48\x04\x21\x61\x04\x16\x01", 12)) {
+      goto i_0x03FF;
+    }
+    break;
+  case 0x0404:
+    if (i8080_aot_code(c, 0x0404, "\x32\x48\x04\x21\x61\x04\x16\x01", 8)) {
+      goto i_0x0404;
+    }
+    break;
+  case 0x0407:
+    if (i8080_aot_code(c, 0x0407, "\x21\x61\x04\x16\x01", 5)) {
+      goto i_0x0407;
+    }
+    break;
+  case 0x040C: goto b_0x040C;
+  case 0x040D:
+    if (i8080_aot_code(c, 0x040D, "\x23\xFE\x00\xC2\x24\x04", 6)) {
+      goto i_0x040D;
+    }
+    break;
+  case 0x0413: goto b_0x0413;
+  case 0x0416: goto b_0x0416;
+  case 0x0419: goto b_0x0419;
+  case 0x041C: goto b_0x041C;
+  case 0x0423: goto b_0x0423;
+  case 0x0424: goto b_0x0424;
+  case 0x0427:
+    if (i8080_aot_code(c, 0x0427, "\x7A\xFE\x02\xFA\x3D\x04", 6)) {
+      goto i_0x0427;
+    }
+    break;
+  case 0x042D: goto b_0x042D;
+  case 0x042E:
+    if (i8080_aot_code(c, 0x042E, "\x23\x32\x47\x04\x7A\xFE\x03\xFA\x3D\x04", 10)) {
+      goto i_0x042E;
+    }
+    break;
+  case 0x0432:
+    if (i8080_aot_code(c, 0x0432, "\x7A\xFE\x03\xFA\x3D\x04", 6)) {
+      goto i_0x0432;
+    }
+    break;
+  case 0x0438: goto b_0x0438;
+  case 0x0439:
+    if (i8080_aot_code(c, 0x0439, "\x23\x32\x48\x04", 4)) {
+      goto i_0x0439;
+    }
+    break;
+  case 0x043D: goto b_0x043D;
+  case 0x043E:
+    if (i8080_aot_code(c, 0x043E, "\xE5\xF5\x21\xAA\x0A\xCD\xC0\x09", 8)) {
+      goto i_0x043E;
+    }
+    break;
+  case 0x043F:
+    if (i8080_aot_code(c, 0x043F, "\xF5\x21\xAA\x0A\xCD\xC0\x09", 7)) {
+      goto i_0x043F;
+    }
+    break;
+  case 0x0440:
+    if (i8080_aot_code(c, 0x0440, "\x21\xAA\x0A\xCD\xC0\x09", 6)) {
+      goto i_0x0440;
+    }
+    break;
+  case 0x0446: goto b_0x0446;
+  case 0x0449: goto b_0x0449;
+  case 0x044C: goto b_0x044C;
+  case 0x0452: goto b_0x0452;
+  case 0x0455: goto b_0x0455;
+  case 0x0456:
+    if (i8080_aot_code(c, 0x0456, "\xE1\xD1\xC3\x0C\x04", 5)) {
+      goto i_0x0456;
+    }
+    break;
+  case 0x0457:
+    if (i8080_aot_code(c, 0x0457, "\xD1\xC3\x0C\x04", 4)) {
+      goto i_0x0457;
+    }
+    break;
+  case 0x0458:
+    if (i8080_aot_code(c, 0x0458, "\xC3\x0C\x04", 3)) {
+      goto i_0x0458;
+    }
+    break;
+  case 0x045F: goto b_0x045F;
+  case 0x0623: goto b_0x0623;
+  case 0x0624:
+    if (i8080_aot_code(c, 0x0624, "\x21\xAA\x0A\xCD\x3A\x09", 6)) {
+      goto i_0x0624;
+    }
+    break;
+  case 0x062A: goto b_0x062A;
+  case 0x062B: goto b_0x062B;
+  case 0x062C:
+    if (i8080_aot_code(c, 0x062C, "\x21\xDC\x0A\xCD\x3A\x09", 6)) {
+      goto i_0x062C;
+    }
+    break;
+  case 0x0632: goto b_0x0632;
+  case 0x0633:
+    if (i8080_aot_code(c, 0x0633, "\xD5\xF5\x21\xAA\x0A\x11\xDC\x0A\xCD\x16\x09", 11)) {
+      goto i_0x0633;
+    }
+    break;
+  case 0x0634:
+    if (i8080_aot_code(c, 0x0634, "\xF5\x21\xAA\x0A\x11\xDC\x0A\xCD\x16\x09", 10)) {
+      goto i_0x0634;
+    }
+    break;
+  case 0x0635:
+    if (i8080_aot_code(c, 0x0635, "\x21\xAA\x0A\x11\xDC\x0A\xCD\x16\x09", 9)) {
+      goto i_0x0635;
+    }
+    break;
+  case 0x063E: goto b_0x063E;
+  case 0x0641: goto b_0x0641;
+  case 0x0644: goto b_0x0644;
+  case 0x0647: goto b_0x0647;
+  case 0x064A: goto b_0x064A;
+  case 0x064D: goto b_0x064D;
+  case 0x0650: goto b_0x0650;
+  case 0x0651:
+    if (i8080_aot_code(c, 0x0651, "\xD1\xE1\xC9", 3)) {
+      goto i_0x0651;
+    }
+    break;
+  case 0x0652:
+    if (i8080_aot_code(c, 0x0652, "\xE1\xC9", 2)) {
+      goto i_0x0652;
+    }
+    break;
+  case 0x0653:
+    if (i8080_aot_code(c, 0x0653, "\xC9", 1)) {
+      goto i_0x0653;
+    }
+    break;
+  case 0x0675: goto b_0x0675;
+  case 0x0676:
+    if (i8080_aot_code(c, 0x0676, "\x0E\xFF", 2)) {
+      goto i_0x0676;
+    }
+    break;
+  case 0x0678: goto b_0x0678;
+  case 0x0679:
+    if (i8080_aot_code(c, 0x0679, "\x2A\x7E\x0C\x22\x58\x06\xE1\xAF\x32\x7C\x0C\x0C\x79\xFE\x19\xF2\xD4\x06", 18)) {
+      goto i_0x0679;
+    }
+    break;
+  case 0x067C:
+    if (i8080_aot_code(c, 0x067C, "\x22\x58\x06\xE1\xAF\x32\x7C\x0C\x0C\x79\xFE\x19\xF2\xD4\x06", 15)) {
+      goto i_0x067C;
+    }
+    break;
+  case 0x067F:
+    if (i8080_aot_code(c, 0x067F, "\xE1\xAF\x32\x7C\x0C\x0C\x79\xFE\x19\xF2\xD4\x06", 12)) {
+      goto i_0x067F;
+    }
+    break;
+  case 0x0680:
+    if (i8080_aot_code(c, 0x0680, "\xAF\x32\x7C\x0C\x0C\x79\xFE\x19\xF2\xD4\x06", 11)) {
+      goto i_0x0680;
+    }
+    break;
+  case 0x0684:
+    if (i8080_aot_code(c, 0x0684, "\x0C\x79\xFE\x19\xF2\xD4\x06", 7)) {
+      goto i_0x0684;
+    }
+    break;
+  case 0x068B: goto b_0x068B;
+  case 0x068D:
+    if (i8080_aot_code(c, 0x068D, "\x32\x54\x06\xEB\x2B\x46\xF5\x78\x32\x55\x06\xF1\xEB\xB8\xCA\x78\x06", 17)) {
+      goto i_0x068D;
+    }
+    break;
+  case 0x0690:
+    if (i8080_aot_code(c, 0x0690, "\xEB\x2B\x46\xF5\x78\x32\x55\x06\xF1\xEB\xB8\xCA\x78\x06", 14)) {
+      goto i_0x0690;
+    }
+    break;
+  case 0x0693:
+    if (i8080_aot_code(c, 0x0693, "\xF5\x78\x32\x55\x06\xF1\xEB\xB8\xCA\x78\x06", 11)) {
+      goto i_0x0693;
+    }
+    break;
+  case 0x0694:
+    if (i8080_aot_code(c, 0x0694, "\x78\x32\x55\x06\xF1\xEB\xB8\xCA\x78\x06", 10)) {
+      goto i_0x0694;
+    }
+    break;
+  case 0x0698:
+    if (i8080_aot_code(c, 0x0698, "\xF1\xEB\xB8\xCA\x78\x06", 6)) {
+      goto i_0x0698;
+    }
+    break;
+  case 0x0699:
+    if (i8080_aot_code(c, 0x0699, "\xEB\xB8\xCA\x78\x06", 5)) {
+      goto i_0x0699;
+    }
+    break;
+  case 0x069E: goto b_0x069E;
+  case 0x06A1:
+    if (i8080_aot_code(c, 0x06A1, "\xB7\xC2\xAB\x06", 4)) {
+      goto i_0x06A1;
+    }
+    break;
+  case 0x06A5: goto b_0x06A5;
+  case 0x06AB: goto b_0x06AB;
+  case 0x06B1: goto b_0x06B1;
+  case 0x06B5:
+    if (i8080_aot_code(c, 0x06B5, "\xCD\x9D\x07", 3)) {
+      goto i_0x06B5;
+    }
+    break;
+  case 0x06B8: goto b_0x06B8;
+  case 0x06BB: goto b_0x06BB;
+  case 0x06BE: goto b_0x06BE;
+  case 0x06C1: goto b_0x06C1;
+  case 0x06C4:
+    if (i8080_aot_code(c, 0x06C4, "\xCD\x9D\x07", 3)) {
+      goto i_0x06C4;
+    }
+    break;
+  case 0x06C7: goto b_0x06C7;
+  case 0x06CA:
+    if (i8080_aot_code(c, 0x06CA, "\xB7\xCD\x0F\x09", 4)) {
+      goto i_0x06CA;
+    }
+    break;
+  case 0x06CE: goto b_0x06CE;
+  case 0x06D1: goto b_0x06D1;
+  case 0x06D4: goto b_0x06D4;
+  case 0x06D9: goto b_0x06D9;
+  case 0x06DE: goto b_0x06DE;
+  case 0x06DF:
+    if (i8080_aot_code(c, 0x06DF, "\xCD\x16\x09", 3)) {
+      goto i_0x06DF;
+    }
+    break;
+  case 0x06E2: goto b_0x06E2;
+  case 0x06E5: goto b_0x06E5;
+  case 0x06E8: goto b_0x06E8;
+  case 0x06E9: goto b_0x06E9;
+  case 0x06EC: goto b_0x06EC;
+  case 0x0723: goto b_0x0723;
+  case 0x0726:
+    if (i8080_aot_code(c, 0x0726, "\xCD\xA1\x0B", 3)) {
+      goto i_0x0726;
+    }
+    break;
+  case 0x0729: goto b_0x0729;
+  case 0x072C:
+    if (i8080_aot_code(c, 0x072C, "\xCD\xA1\x0B", 3)) {
+      goto i_0x072C;
+    }
+    break;
+  case 0x072F: goto b_0x072F;
+  case 0x0732:
+    if (i8080_aot_code(c, 0x0732, "\xCD\xA1\x0B", 3)) {
+      goto i_0x0732;
+    }
+    break;
+  case 0x0735: goto b_0x0735;
+  case 0x0736: goto b_0x0736;
+  case 0x0737:
+    if (i8080_aot_code(c, 0x0737, "\x21\x5A\x06\xCD\x83\x0B", 6)) {
+      goto i_0x0737;
+    }
+    break;
+  case 0x073D: goto b_0x073D;
+  case 0x0742: goto b_0x0742;
+  case 0x0747: goto b_0x0747;
+  case 0x0748:
+    if (i8080_aot_code(c, 0x0748, "\x3E\x5A\xCD\x0E\x0B", 5)) {
+      goto i_0x0748;
+    }
+    break;
+  case 0x074D: goto b_0x074D;
+  case 0x074E: goto b_0x074E;
+  case 0x0751: goto b_0x0751;
+  case 0x0752:
+    if (i8080_aot_code(c, 0x0752, "\xC9", 1)) {
+      goto i_0x0752;
+    }
+    break;
+  case 0x0753: goto b_0x0753;
+  case 0x0754:
+    if (i8080_aot_code(c, 0x0754, "\xD5\x3A\x56\x06\xCD\xA1\x0B", 7)) {
+      goto i_0x0754;
+    }
+    break;
+  case 0x0755:
+    if (i8080_aot_code(c, 0x0755, "\x3A\x56\x06\xCD\xA1\x0B", 6)) {
+      goto i_0x0755;
+    }
+    break;
+  case 0x0758:
+    if (i8080_aot_code(c, 0x0758, "\xCD\xA1\x0B", 3)) {
+      goto i_0x0758;
+    }
+    break;
+  case 0x075B: goto b_0x075B;
+  case 0x075E: goto b_0x075E;
+  case 0x0763: goto b_0x0763;
+  case 0x0766: goto b_0x0766;
+  case 0x076A:
+    if (i8080_aot_code(c, 0x076A, "\x54\x06\xCD\xA1\x0B\xCD\x4E\x0B", 8)) {
+      goto i_0x076A;
+    }
+    break;
+  case 0x0772: goto b_0x0772;
+  case 0x0778:
+    if (i8080_aot_code(c, 0x0778, "\xCD\xA1\x0B", 3)) {
+      goto i_0x0778;
+    }
+    break;
+  case 0x077B: goto b_0x077B;
+  case 0x077E: goto b_0x077E;
+  case 0x0783:
+    if (i8080_aot_code(c, 0x0783, "\x23\x7E\xCD\xA1\x0B", 5)) {
+      goto i_0x0783;
+    }
+    break;
+  case 0x0785:
+    if (i8080_aot_code(c, 0x0785, "\xCD\xA1\x0B", 3)) {
+      goto i_0x0785;
+    }
+    break;
+  case 0x0788: goto b_0x0788;
+  case 0x078B: goto b_0x078B;
+  case 0x0790:
+    if (i8080_aot_code(c, 0x0790, "\xCD\xA1\x0B", 3)) {
+      goto i_0x0790;
+    }
+    break;
+  case 0x0793: goto b_0x0793;
+  case 0x0796: goto b_0x0796;
+  case 0x079B:
+    if (i8080_aot_code(c, 0x079B, "\xE1\xC9", 2)) {
+      goto i_0x079B;
+    }
+    break;
+  case 0x079C:
+    if (i8080_aot_code(c, 0x079C, "\xC9", 1)) {
+      goto i_0x079C;
+    }
+    break;
+  case 0x079D: goto b_0x079D;
+  case 0x079E:
+    if (i8080_aot_code(c, 0x079E, "\xE5\x2A\x7E\x0C\xF5\x7E\x32\x57\x06\xF1\xBE\xCA\xB7\x07", 14)) {
+      goto i_0x079E;
+    }
+    break;
+  case 0x079F:
+    if (i8080_aot_code(c, 0x079F, "\x2A\x7E\x0C\xF5\x7E\x32\x57\x06\xF1\xBE\xCA\xB7\x07", 13)) {
+      goto i_0x079F;
+    }
+    break;
+  case 0x07A2:
+    if (i8080_aot_code(c, 0x07A2, "\xF5\x7E\x32\x57\x06\xF1\xBE\xCA\xB7\x07", 10)) {
+      goto i_0x07A2;
+    }
+    break;
+  case 0x07A3:
+    if (i8080_aot_code(c, 0x07A3, "\x7E\x32\x57\x06\xF1\xBE\xCA\xB7\x07", 9)) {
+      goto i_0x07A3;
+    }
+    break;
+  case 0x07A4:
+    if (i8080_aot_code(c, 0x07A4, "\x32\x57\x06\xF1\xBE\xCA\xB7\x07", 8)) {
+      goto i_0x07A4;
+    }
+    break;
+  case 0x07A7:
+    if (i8080_aot_code(c, 0x07A7, "\xF1\xBE\xCA\xB7\x07", 5)) {
+      goto i_0x07A7;
+    }
+    break;
+  case 0x07A8:
+    if (i8080_aot_code(c, 0x07A8, "\xBE\xCA\xB7\x07", 4)) {
+      goto i_0x07A8;
+    }
+    break;
+  case 0x07A9:
+    if (i8080_aot_code(c, 0x07A9, "\xCA\xB7\x07", 3)) {
+      goto i_0x07A9;
+    }
+    break;
+  case 0x07AC: goto b_0x07AC;
+  case 0x07AD:
+    if (i8080_aot_code(c, 0x07AD, "\x3A\x74\x0C\x32\x7C\x0C\xF1\xC3\xB7\x07", 10)) {
+      goto i_0x07AD;
+    }
+    break;
+  case 0x07B0:
+    if (i8080_aot_code(c, 0x07B0, "\x32\x7C\x0C\xF1\xC3\xB7\x07", 7)) {
+      goto i_0x07B0;
+    }
+    break;
+  case 0x07B3:
+    if (i8080_aot_code(c, 0x07B3, "\xF1\xC3\xB7\x07", 4)) {
+      goto i_0x07B3;
+    }
+    break;
+  case 0x07B4:
+    if (i8080_aot_code(c, 0x07B4, "\xC3\xB7\x07", 3)) {
+      goto i_0x07B4;
+    }
+    break;
+  case 0x07B7: goto b_0x07B7;
+  case 0x07BA: goto b_0x07BA;
+  case 0x07BD: goto b_0x07BD;
+  case 0x07C1:
+    if (i8080_aot_code(c, 0x07C1, "\xE1\xF1\xC9", 3)) {
+      goto i_0x07C1;
+    }
+    break;
+  case 0x07C2:
+    if (i8080_aot_code(c, 0x07C2, "\xF1\xC9", 2)) {
+      goto i_0x07C2;
+    }
+    break;
+  case 0x07C3:
+    if (i8080_aot_code(c, 0x07C3, "\xC9", 1)) {
+      goto i_0x07C3;
+    }
+    break;
+  case 0x07C4: goto b_0x07C4;
+  case 0x07C5:
+    if (i8080_aot_code(c, 0x07C5, "\xC9", 1)) {
+      goto i_0x07C5;
+    }
+    break;
+  case 0x07C6: goto b_0x07C6;
+  case 0x07C9: goto b_0x07C9;
+  case 0x07CB:
+    if (i8080_aot_code(c, 0x07CB, "\x43\x50\x55\x20\x46\x41\x49\x4C\x45\x44\x3A\x20\x00\xF5\x3E\x01\x32\x7C\x0C", 19)) {
+      goto i_0x07CB;
+    }
+    break;
+  case 0x07D0:
+    if (i8080_aot_code(c, 0x07D0, "\x41\x49\x4C\x45\x44\x3A\x20\x00\xF5\x3E\x01\x32\x7C\x0C", 14)) {
+      goto i_0x07D0;
+    }
+    break;
+  case 0x07D8:
+    if (i8080_aot_code(c, 0x07D8, "\xF5\x3E\x01\x32\x7C\x0C", 6)) {
+      goto i_0x07D8;
+    }
+    break;
+  case 0x07D9:
+    if (i8080_aot_code(c, 0x07D9, "\x3E\x01\x32\x7C\x0C", 5)) {
+      goto i_0x07D9;
+    }
+    break;
+  case 0x07DE: goto b_0x07DE;
+  case 0x07DF:
+    if (i8080_aot_code(c, 0x07DF, "\x2A\x7A\x0C\x23\x22\x7A\x0C\xCD\x4E\x0B", 10)) {
+      goto i_0x07DF;
+    }
+    break;
+  case 0x07E2:
+    if (i8080_aot_code(c, 0x07E2, "\x23\x22\x7A\x0C\xCD\x4E\x0B", 7)) {
+      goto i_0x07E2;
+    }
+    break;
+  case 0x07E6:
+    if (i8080_aot_code(c, 0x07E6, "\xCD\x4E\x0B", 3)) {
+      goto i_0x07E6;
+    }
+    break;
+  case 0x07E9: goto b_0x07E9;
+  case 0x07EB:
+    if (i8080_aot_code(c, 0x07EB, "\x45\x52\x52\x4F\x52\x20\x43\x4F\x55\x4E\x54\x20\x00\xCD\x8B\x0B", 16)) {
+      goto i_0x07EB;
+    }
+    break;
+  case 0x07F5:
+    if (i8080_aot_code(c, 0x07F5, "\x54\x20\x00\xCD\x8B\x0B", 6)) {
+      goto i_0x07F5;
+    }
+    break;
+  case 0x07FB: goto b_0x07FB;
+  case 0x07FE: goto b_0x07FE;
+  case 0x0801:
+    if (i8080_aot_code(c, 0x0801, "\x00\x2A\x7E\x0C\xF5\xCD\x1D\x09", 8)) {
+      goto i_0x0801;
+    }
+    break;
+  case 0x0805:
+    if (i8080_aot_code(c, 0x0805, "\xF5\xCD\x1D\x09", 4)) {
+      goto i_0x0805;
+    }
+    break;
+  case 0x0806:
+    if (i8080_aot_code(c, 0x0806, "\xCD\x1D\x09", 3)) {
+      goto i_0x0806;
+    }
+    break;
+  case 0x0809: goto b_0x0809;
+  case 0x080C: goto b_0x080C;
+  case 0x080F: goto b_0x080F;
+  case 0x0811:
+    if (i8080_aot_code(c, 0x0811, "\x49\x4E\x53\x54\x52\x55\x43\x54\x49\x4F\x4E\x20\x53\x45", 14)) {
+      goto i_0x0811;
+    }
+    break;
+  case 0x0813:
+    if (i8080_aot_code(c, 0x0813, "\x53\x54\x52\x55\x43\x54\x49\x4F\x4E\x20\x53\x45", 12)) {
+      goto i_0x0813;
+    }
+    break;
+  case 0x081C:
+    if (i8080_aot_code(c, 0x081C, "\x20\x53\x45", 3)) {
+      goto i_0x081C;
+    }
+    break;
+  case 0x081F: goto b_0x081F;
+  case 0x0823:
+    if (i8080_aot_code(c, 0x0823, "\x43\x45\x20\x57\x41\x53\x20\x00\xCD\x23\x07", 11)) {
+      goto i_0x0823;
+    }
+    break;
+  case 0x082E: goto b_0x082E;
+  case 0x0831: goto b_0x0831;
+  case 0x0834:
+    if (i8080_aot_code(c, 0x0834, "\x52\x45\x47\x49\x53\x54\x45\x52\x20\x00\x3A\x56\x06\xCD\x36\x07", 16)) {
+      goto i_0x0834;
+    }
+    break;
+  case 0x0841:
+    if (i8080_aot_code(c, 0x0841, "\xCD\x36\x07", 3)) {
+      goto i_0x0841;
+    }
+    break;
+  case 0x0844: goto b_0x0844;
+  case 0x0845:
+    if (i8080_aot_code(c, 0x0845, "\xF5\xCD\x4E\x0B", 4)) {
+      goto i_0x0845;
+    }
+    break;
+  case 0x0846:
+    if (i8080_aot_code(c, 0x0846, "\xCD\x4E\x0B", 3)) {
+      goto i_0x0846;
+    }
+    break;
+  case 0x0849: goto b_0x0849;
+  case 0x084D:
+    if (i8080_aot_code(c, 0x084D, "\x54\x41\x49\x4E\x53\x20\x00\xD5\x3A\x55\x06\xCD\x96\x0B", 14)) {
+      goto i_0x084D;
+    }
+    break;
+  case 0x0851:
+    if (i8080_aot_code(c, 0x0851, "\x53\x20\x00\xD5\x3A\x55\x06\xCD\x96\x0B", 10)) {
+      goto i_0x0851;
+    }
+    break;
+  case 0x0855:
+    if (i8080_aot_code(c, 0x0855, "\x3A\x55\x06\xCD\x96\x0B", 6)) {
+      goto i_0x0855;
+    }
+    break;
+  case 0x0858:
+    if (i8080_aot_code(c, 0x0858, "\xCD\x96\x0B", 3)) {
+      goto i_0x0858;
+    }
+    break;
+  case 0x085B: goto b_0x085B;
+  case 0x085E: goto b_0x085E;
+  case 0x0860:
+    if (i8080_aot_code(c, 0x0860, "\x42\x55\x54\x20\x53\x48\x4F\x55\x4C\x44\x20\x43\x4F\x4E", 14)) {
+      goto i_0x0860;
+    }
+    break;
+  case 0x086E: goto b_0x086E;
+  case 0x0872:
+    if (i8080_aot_code(c, 0x0872, "\x20\x00\x2B\x7E\x23\xCD\x96\x0B", 8)) {
+      goto i_0x0872;
+    }
+    break;
+  case 0x0876:
+    if (i8080_aot_code(c, 0x0876, "\x23\xCD\x96\x0B", 4)) {
+      goto i_0x0876;
+    }
+    break;
+  case 0x087A: goto b_0x087A;
+  case 0x087D: goto b_0x087D;
+  case 0x087F:
+    if (i8080_aot_code(c, 0x087F, "\x52\x45\x47\x49\x53\x54\x45\x52\x20\x56\x41\x4C\x55\x45", 14)) {
+      goto i_0x087F;
+    }
+    break;
+  case 0x0889:
+    if (i8080_aot_code(c, 0x0889, "\x41\x4C\x55\x45", 4)) {
+      goto i_0x0889;
+    }
+    break;
+  case 0x088D: goto b_0x088D;
+  case 0x0891:
+    if (i8080_aot_code(c, 0x0891, "\x4F\x52\x45\x20\x49\x4E\x53\x54\x52\x55\x43\x54", 12)) {
+      goto i_0x0891;
+    }
+    break;
+  case 0x0897:
+    if (i8080_aot_code(c, 0x0897, "\x53\x54\x52\x55\x43\x54", 6)) {
+      goto i_0x0897;
+    }
+    break;
+  case 0x089D: goto b_0x089D;
+  case 0x08A0:
+    if (i8080_aot_code(c, 0x08A0, "\x20\x53\x45\x51\x55\x45\x4E\x43\x45\x20\x57\x41\x53", 13)) {
+      goto i_0x08A0;
+    }
+    break;
+  case 0x08A7:
+    if (i8080_aot_code(c, 0x08A7, "\x43\x45\x20\x57\x41\x53", 6)) {
+      goto i_0x08A7;
+    }
+    break;
+  case 0x08AD: goto b_0x08AD;
+  case 0x08B2:
+    if (i8080_aot_code(c, 0x08B2, "\xCD\x96\x0B", 3)) {
+      goto i_0x08B2;
+    }
+    break;
+  case 0x08B5: goto b_0x08B5;
+  case 0x08B6:
+    if (i8080_aot_code(c, 0x08B6, "\xCD\x4E\x0B", 3)) {
+      goto i_0x08B6;
+    }
+    break;
+  case 0x08B9: goto b_0x08B9;
+  case 0x08BB:
+    if (i8080_aot_code(c, 0x08BB, "\x54\x45\x53\x54\x20\x4E\x55\x4D\x42\x45\x52\x20\x00\xD5", 14)) {
+      goto i_0x08BB;
+    }
+    break;
+  case 0x08C1:
+    if (i8080_aot_code(c, 0x08C1, "\x55\x4D\x42\x45\x52\x20\x00\xD5", 8)) {
+      goto i_0x08C1;
+    }
+    break;
+  case 0x08C9: goto b_0x08C9;
+  case 0x08CE:
+    if (i8080_aot_code(c, 0x08CE, "\xCD\x6C\x0C", 3)) {
+      goto i_0x08CE;
+    }
+    break;
+  case 0x08D1: goto b_0x08D1;
+  case 0x08D4: goto b_0x08D4;
+  case 0x08D7: goto b_0x08D7;
+  case 0x08DA:
+    if (i8080_aot_code(c, 0x08DA, "\x0A\x00\xCD\x2B\x0C", 5)) {
+      goto i_0x08DA;
+    }
+    break;
+  case 0x08DB:
+    if (i8080_aot_code(c, 0x08DB, "\x00\xCD\x2B\x0C", 4)) {
+      goto i_0x08DB;
+    }
+    break;
+  case 0x08DF: goto b_0x08DF;
+  case 0x08E0:
+    if (i8080_aot_code(c, 0x08E0, "\xC9", 1)) {
+      goto i_0x08E0;
+    }
+    break;
+  case 0x08FE: goto b_0x08FE;
+  case 0x08FF:
+    if (i8080_aot_code(c, 0x08FF, "\x3A", 1) &&
+      i8080_aot_code(c, 0x0900, "\x74\x0C\xB7\xCA\x0D\x09", 6)) {
+      goto i_0x08FF;
+    }
+    break;
+  case 0x0902:
+    if (i8080_aot_code(c, 0x0902, "\xB7\xCA\x0D\x09", 4)) {
+      goto i_0x0902;
+    }
+    break;
+  case 0x0906: goto b_0x0906;
+  case 0x0907: goto b_0x0907;
+  case 0x0908:
+    if (i8080_aot_code(c, 0x0908, "\x23\x23\x23\xE3\xC9", 5)) {
+      goto i_0x0908;
+    }
+    break;
+  case 0x090C:
+    if (i8080_aot_code(c, 0x090C, "\xC9", 1)) {
+      goto i_0x090C;
+    }
+    break;
+  case 0x090D: goto b_0x090D;
+  case 0x090E:
+    if (i8080_aot_code(c, 0x090E, "\xC9", 1)) {
+      goto i_0x090E;
+    }
+    break;
+  case 0x090F: goto b_0x090F;
+  case 0x0912: goto b_0x0912;
+  case 0x0916: goto b_0x0916;
+  case 0x0919: goto b_0x0919;
+  case 0x091D: goto b_0x091D;
+  case 0x091E:
+    if (i8080_aot_code(c, 0x091E, "\x3A\x78\x0C\xFE\x01\xCA\x0D\x09", 8)) {
+      goto i_0x091E;
+    }
+    break;
+  case 0x0921:
+    if (i8080_aot_code(c, 0x0921, "\xFE\x01\xCA\x0D\x09", 5)) {
+      goto i_0x0921;
+    }
+    break;
+  case 0x0926: goto b_0x0926;
+  case 0x0927:
+    if (i8080_aot_code(c, 0x0927, "\xC3\x07\x09", 3)) {
+      goto i_0x0927;
+    }
+    break;
+  case 0x093A: goto b_0x093A;
+  case 0x093D:
+    if (i8080_aot_code(c, 0x093D, "\xE1\xE3\xE5\xF5\x2A\xBC\x09\x2B\x70\x2B\x71\x2B\x72\x2B\x73\xD1\x2B", 17)) {
+      goto i_0x093D;
+    }
+    break;
+  case 0x093E:
+    if (i8080_aot_code(c, 0x093E, "\xE3\xE5\xF5\x2A\xBC\x09\x2B\x70\x2B\x71\x2B\x72\x2B\x73\xD1\x2B", 16)) {
+      goto i_0x093E;
+    }
+    break;
+  case 0x093F:
+    if (i8080_aot_code(c, 0x093F, "\xE5\xF5\x2A\xBC\x09\x2B\x70\x2B\x71\x2B\x72\x2B\x73\xD1\x2B", 15)) {
+      goto i_0x093F;
+    }
+    break;
+  case 0x0940:
+    if (i8080_aot_code(c, 0x0940, "\xF5\x2A\xBC\x09\x2B\x70\x2B\x71\x2B\x72\x2B\x73\xD1\x2B", 14)) {
+      goto i_0x0940;
+    }
+    break;
+  case 0x0941:
+    if (i8080_aot_code(c, 0x0941, "\x2A\xBC\x09\x2B\x70\x2B\x71\x2B\x72\x2B\x73\xD1\x2B", 13)) {
+      goto i_0x0941;
+    }
+    break;
+  case 0x0944:
+    if (i8080_aot_code(c, 0x0944, "\x2B\x70\x2B\x71\x2B\x72\x2B\x73\xD1\x2B", 10)) {
+      goto i_0x0944;
+    }
+    break;
+  case 0x0946:
+    if (i8080_aot_code(c, 0x0946, "\x2B\x71\x2B\x72\x2B\x73\xD1\x2B", 8)) {
+      goto i_0x0946;
+    }
+    break;
+  case 0x0948:
+    if (i8080_aot_code(c, 0x0948, "\x2B\x72\x2B\x73\xD1\x2B", 6)) {
+      goto i_0x0948;
+    }
+    break;
+  case 0x094A:
+    if (i8080_aot_code(c, 0x094A, "\x2B\x73\xD1\x2B", 4)) {
+      goto i_0x094A;
+    }
+    break;
+  case 0x094C:
+    if (i8080_aot_code(c, 0x094C, "\xD1\x2B", 2)) {
+      goto i_0x094C;
+    }
+    break;
+  case 0x094D:
+    if (i8080_aot_code(c, 0x094D, "\x2B", 1)) {
+      goto i_0x094D;
+    }
+    break;
+  case 0x094E: goto b_0x094E;
+  case 0x094F:
+    if (i8080_aot_code(c, 0x094F, "\x2B\x73\xEB\xE3\xEB\x2B\x72\x2B\x73\xEB\xE3\xEB\xE3\xCD\x3C\x0A", 16)) {
+      goto i_0x094F;
+    }
+    break;
+  case 0x0951:
+    if (i8080_aot_code(c, 0x0951, "\xEB\xE3\xEB\x2B\x72\x2B\x73\xEB\xE3\xEB\xE3\xCD\x3C\x0A", 14)) {
+      goto i_0x0951;
+    }
+    break;
+  case 0x0953:
+    if (i8080_aot_code(c, 0x0953, "\xEB\x2B\x72\x2B\x73\xEB\xE3\xEB\xE3\xCD\x3C\x0A", 12)) {
+      goto i_0x0953;
+    }
+    break;
+  case 0x0956:
+    if (i8080_aot_code(c, 0x0956, "\x2B\x73\xEB\xE3\xEB\xE3\xCD\x3C\x0A", 9)) {
+      goto i_0x0956;
+    }
+    break;
+  case 0x0958:
+    if (i8080_aot_code(c, 0x0958, "\xEB\xE3\xEB\xE3\xCD\x3C\x0A", 7)) {
+      goto i_0x0958;
+    }
+    break;
+  case 0x095A:
+    if (i8080_aot_code(c, 0x095A, "\xEB\xE3\xCD\x3C\x0A", 5)) {
+      goto i_0x095A;
+    }
+    break;
+  case 0x095C:
+    if (i8080_aot_code(c, 0x095C, "\xCD\x3C\x0A", 3)) {
+      goto i_0x095C;
+    }
+    break;
+  case 0x095F: goto b_0x095F;
+  case 0x09C0: goto b_0x09C0;
+  case 0x09C2:
+    if (i8080_aot_code(c, 0x09C2, "\x2B\x4E\x2B\x56\x2B\x5E\xD5\x2B\x56\x2B\x5E\xD5\xF1\x2B", 14)) {
+      goto i_0x09C2;
+    }
+    break;
+  case 0x09C4:
+    if (i8080_aot_code(c, 0x09C4, "\x2B\x56\x2B\x5E\xD5\x2B\x56\x2B\x5E\xD5\xF1\x2B", 12)) {
+      goto i_0x09C4;
+    }
+    break;
+  case 0x09C6:
+    if (i8080_aot_code(c, 0x09C6, "\x2B\x5E\xD5\x2B\x56\x2B\x5E\xD5\xF1\x2B", 10)) {
+      goto i_0x09C6;
+    }
+    break;
+  case 0x09C8:
+    if (i8080_aot_code(c, 0x09C8, "\xD5\x2B\x56\x2B\x5E\xD5\xF1\x2B", 8)) {
+      goto i_0x09C8;
+    }
+    break;
+  case 0x09C9:
+    if (i8080_aot_code(c, 0x09C9, "\x2B\x56\x2B\x5E\xD5\xF1\x2B", 7)) {
+      goto i_0x09C9;
+    }
+    break;
+  case 0x09CB:
+    if (i8080_aot_code(c, 0x09CB, "\x2B\x5E\xD5\xF1\x2B", 5)) {
+      goto i_0x09CB;
+    }
+    break;
+  case 0x09CD:
+    if (i8080_aot_code(c, 0x09CD, "\xD5\xF1\x2B", 3)) {
+      goto i_0x09CD;
+    }
+    break;
+  case 0x09CE:
+    if (i8080_aot_code(c, 0x09CE, "\xF1\x2B", 2)) {
+      goto i_0x09CE;
+    }
+    break;
+  case 0x09CF:
+    if (i8080_aot_code(c, 0x09CF, "\x2B", 1)) {
+      goto i_0x09CF;
+    }
+    break;
+  case 0x09D0: goto b_0x09D0;
+  case 0x09D1:
+    if (i8080_aot_code(c, 0x09D1, "\x2B\x5E\xE3\xEB\xCD\x31\x0A", 7)) {
+      goto i_0x09D1;
+    }
+    break;
+  case 0x09D3:
+    if (i8080_aot_code(c, 0x09D3, "\xE3\xEB\xCD\x31\x0A", 5)) {
+      goto i_0x09D3;
+    }
+    break;
+  case 0x09D4:
+    if (i8080_aot_code(c, 0x09D4, "\xEB\xCD\x31\x0A", 4)) {
+      goto i_0x09D4;
+    }
+    break;
+  case 0x09D8: goto b_0x09D8;
+  case 0x09DD: goto b_0x09DD;
+  case 0x0A31: goto b_0x0A31;
+  case 0x0A32:
+    if (i8080_aot_code(c, 0x0A32, "\x3A\x72\x0C\xB7\xCA\x0D\x09", 7)) {
+      goto i_0x0A32;
+    }
+    break;
+  case 0x0A35:
+    if (i8080_aot_code(c, 0x0A35, "\xB7\xCA\x0D\x09", 4)) {
+      goto i_0x0A35;
+    }
+    break;
+  case 0x0A39: goto b_0x0A39;
+  case 0x0A3C: goto b_0x0A3C;
+  case 0x0A3D:
+    if (i8080_aot_code(c, 0x0A3D, "\x3A\x72\x0C\xB7\xC2\x0D\x09", 7)) {
+      goto i_0x0A3D;
+    }
+    break;
+  case 0x0A40:
+    if (i8080_aot_code(c, 0x0A40, "\xB7\xC2\x0D\x09", 4)) {
+      goto i_0x0A40;
+    }
+    break;
+  case 0x0A44: goto b_0x0A44;
+  case 0x0A45:
+    if (i8080_aot_code(c, 0x0A45, "\xE3\x23\x23\xE3\xC9", 5)) {
+      goto i_0x0A45;
+    }
+    break;
+  case 0x0A46:
+    if (i8080_aot_code(c, 0x0A46, "\x23\x23\xE3\xC9", 4)) {
+      goto i_0x0A46;
+    }
+    break;
+  case 0x0A49:
+    if (i8080_aot_code(c, 0x0A49, "\xC9", 1)) {
+      goto i_0x0A49;
+    }
+    break;
+  case 0x0A4A: goto b_0x0A4A;
+  case 0x0A50:
+    if (i8080_aot_code(c, 0x0A50, "\xCD\x54\x0A", 3)) {
+      goto i_0x0A50;
+    }
+    break;
+  case 0x0A53: goto b_0x0A53;
+  case 0x0A54: goto b_0x0A54;
+  case 0x0A55:
+    if (i8080_aot_code(c, 0x0A55, "\x7C\x2F\x47\x7D\x2F\x4F\x03\xAF", 8)) {
+      goto i_0x0A55;
+    }
+    break;
+  case 0x0A5D: goto b_0x0A5D;
+  case 0x0A60:
+    if (i8080_aot_code(c, 0x0A60, "\x09\x13\xD2\x5D\x0A", 5)) {
+      goto i_0x0A60;
+    }
+    break;
+  case 0x0A65: goto b_0x0A65;
+  case 0x0A66:
+    if (i8080_aot_code(c, 0x0A66, "\xC9", 1)) {
+      goto i_0x0A66;
+    }
+    break;
+  case 0x0A67: goto b_0x0A67;
+  case 0x0A6A: goto b_0x0A6A;
+  case 0x0A6E: goto b_0x0A6E;
+  case 0x0A73: goto b_0x0A73;
+  case 0x0B0E: goto b_0x0B0E;
+  case 0x0B0F:
+    if (i8080_aot_code(c, 0x0B0F, "\xD5\xE5\xF5\x5F\xCD\xEA\x03", 7)) {
+      goto i_0x0B0F;
+    }
+    break;
+  case 0x0B10:
+    if (i8080_aot_code(c, 0x0B10, "\xE5\xF5\x5F\xCD\xEA\x03", 6)) {
+      goto i_0x0B10;
+    }
+    break;
+  case 0x0B11:
+    if (i8080_aot_code(c, 0x0B11, "\xF5\x5F\xCD\xEA\x03", 5)) {
+      goto i_0x0B11;
+    }
+    break;
+  case 0x0B12:
+    if (i8080_aot_code(c, 0x0B12, "\x5F\xCD\xEA\x03", 4)) {
+      goto i_0x0B12;
+    }
+    break;
+  case 0x0B16: goto b_0x0B16;
+  case 0x0B17:
+    if (i8080_aot_code(c, 0x0B17, "\xE1\xD1\xC1\xC9", 4)) {
+      goto i_0x0B17;
+    }
+    break;
+  case 0x0B18:
+    if (i8080_aot_code(c, 0x0B18, "\xD1\xC1\xC9", 3)) {
+      goto i_0x0B18;
+    }
+    break;
+  case 0x0B19:
+    if (i8080_aot_code(c, 0x0B19, "\xC1\xC9", 2)) {
+      goto i_0x0B19;
+    }
+    break;
+  case 0x0B1A:
+    if (i8080_aot_code(c, 0x0B1A, "\xC9", 1)) {
+      goto i_0x0B1A;
+    }
+    break;
+  case 0x0B1B: goto b_0x0B1B;
+  case 0x0B1C:
+    if (i8080_aot_code(c, 0x0B1C, "\xD5\xE5\x0E\x01\xCD\x05\x00", 7)) {
+      goto i_0x0B1C;
+    }
+    break;
+  case 0x0B1D:
+    if (i8080_aot_code(c, 0x0B1D, "\xE5\x0E\x01\xCD\x05\x00", 6)) {
+      goto i_0x0B1D;
+    }
+    break;
+  case 0x0B1E:
+    if (i8080_aot_code(c, 0x0B1E, "\x0E\x01\xCD\x05\x00", 5)) {
+      goto i_0x0B1E;
+    }
+    break;
+  case 0x0B23: goto b_0x0B23;
+  case 0x0B24:
+    if (i8080_aot_code(c, 0x0B24, "\xD1\xC1\xC9", 3)) {
+      goto i_0x0B24;
+    }
+    break;
+  case 0x0B25:
+    if (i8080_aot_code(c, 0x0B25, "\xC1\xC9", 2)) {
+      goto i_0x0B25;
+    }
+    break;
+  case 0x0B26:
+    if (i8080_aot_code(c, 0x0B26, "\xC9", 1)) {
+      goto i_0x0B26;
+    }
+    break;
+  case 0x0B4E: goto b_0x0B4E;
+  case 0x0B4F:
+    if (i8080_aot_code(c, 0x0B4F, "\xF5", 1)) {
+      goto i_0x0B4F;
+    }
+    break;
+  case 0x0B50: goto b_0x0B50;
+  case 0x0B51:
+    if (i8080_aot_code(c, 0x0B51, "\x23\xB7\xC2\x59\x0B", 5)) {
+      goto i_0x0B51;
+    }
+    break;
+  case 0x0B56: goto b_0x0B56;
+  case 0x0B57:
+    if (i8080_aot_code(c, 0x0B57, "\xE3\xC9", 2)) {
+      goto i_0x0B57;
+    }
+    break;
+  case 0x0B58:
+    if (i8080_aot_code(c, 0x0B58, "\xC9", 1)) {
+      goto i_0x0B58;
+    }
+    break;
+  case 0x0B59: goto b_0x0B59;
+  case 0x0B5C: goto b_0x0B5C;
+  case 0x0B5F: goto b_0x0B5F;
+  case 0x0B60:
+    if (i8080_aot_code(c, 0x0B60, "\xE5\xD5\xE6\x0F\x21\x73\x0B\x16\x00\x5F\x19\x7E\xCD\x0E\x0B", 15)) {
+      goto i_0x0B60;
+    }
+    break;
+  case 0x0B61:
+    if (i8080_aot_code(c, 0x0B61, "\xD5\xE6\x0F\x21\x73\x0B\x16\x00\x5F\x19\x7E\xCD\x0E\x0B", 14)) {
+      goto i_0x0B61;
+    }
+    break;
+  case 0x0B62:
+    if (i8080_aot_code(c, 0x0B62, "\xE6\x0F\x21\x73\x0B\x16\x00\x5F\x19\x7E\xCD\x0E\x0B", 13)) {
+      goto i_0x0B62;
+    }
+    break;
+  case 0x0B6C:
+    if (i8080_aot_code(c, 0x0B6C, "\xCD\x0E\x0B", 3)) {
+      goto i_0x0B6C;
+    }
+    break;
+  case 0x0B6F: goto b_0x0B6F;
+  case 0x0B70:
+    if (i8080_aot_code(c, 0x0B70, "\xE1\xF1\xC9", 3)) {
+      goto i_0x0B70;
+    }
+    break;
+  case 0x0B71:
+    if (i8080_aot_code(c, 0x0B71, "\xF1\xC9", 2)) {
+      goto i_0x0B71;
+    }
+    break;
+  case 0x0B72:
+    if (i8080_aot_code(c, 0x0B72, "\xC9", 1)) {
+      goto i_0x0B72;
+    }
+    break;
+  case 0x0B83: goto b_0x0B83;
+  case 0x0B84:
+    if (i8080_aot_code(c, 0x0B84, "\x16\x00\x5F\x19\x7E\xD1\xC9", 7)) {
+      goto i_0x0B84;
+    }
+    break;
+  case 0x0B89:
+    if (i8080_aot_code(c, 0x0B89, "\xD1\xC9", 2)) {
+      goto i_0x0B89;
+    }
+    break;
+  case 0x0B8A:
+    if (i8080_aot_code(c, 0x0B8A, "\xC9", 1)) {
+      goto i_0x0B8A;
+    }
+    break;
+  case 0x0B8B: goto b_0x0B8B;
+  case 0x0B8C:
+    if (i8080_aot_code(c, 0x0B8C, "\x7C\xCD\xA1\x0B", 4)) {
+      goto i_0x0B8C;
+    }
+    break;
+  case 0x0B90: goto b_0x0B90;
+  case 0x0B94: goto b_0x0B94;
+  case 0x0B95:
+    if (i8080_aot_code(c, 0x0B95, "\xC9", 1)) {
+      goto i_0x0B95;
+    }
+    break;
+  case 0x0B96: goto b_0x0B96;
+  case 0x0B97:
+    if (i8080_aot_code(c, 0x0B97, "\xCD\xA1\x0B", 3)) {
+      goto i_0x0B97;
+    }
+    break;
+  case 0x0B9A: goto b_0x0B9A;
+  case 0x0B9F: goto b_0x0B9F;
+  case 0x0BA0:
+    if (i8080_aot_code(c, 0x0BA0, "\xC9", 1)) {
+      goto i_0x0BA0;
+    }
+    break;
+  case 0x0BA1: goto b_0x0BA1;
+  case 0x0BA2:
+    if (i8080_aot_code(c, 0x0BA2, "\x0F\x0F\x0F\x0F\xCD\x5F\x0B", 7)) {
+      goto i_0x0BA2;
+    }
+    break;
+  case 0x0BA9: goto b_0x0BA9;
+  case 0x0BB0: goto b_0x0BB0;
+  case 0x0BB1:
+    if (i8080_aot_code(c, 0x0BB1, "\xC9", 1)) {
+      goto i_0x0BB1;
+    }
+    break;
+  case 0x0C2B: goto b_0x0C2B;
+  case 0x0C2E: goto b_0x0C2E;
+  case 0x0C2F: goto b_0x0C2F;
+  case 0x0C34: goto b_0x0C34;
+  case 0x0C39: goto b_0x0C39;
+  case 0x0C3C: goto b_0x0C3C;
+  case 0x0C3F:
+    if (i8080_aot_code(c, 0x0C3F, "\xF5\x2F\x3C\x32\x4D\x0C\xF1\xFE\x03\xC2\x0D\x09", 12)) {
+      goto i_0x0C3F;
+    }
+    break;
+  case 0x0C40:
+    if (i8080_aot_code(c, 0x0C40, "\x2F\x3C\x32\x4D\x0C\xF1\xFE\x03\xC2\x0D\x09", 11)) {
+      goto i_0x0C40;
+    }
+    break;
+  case 0x0C45:
+    if (i8080_aot_code(c, 0x0C45, "\xF1\xFE\x03\xC2\x0D\x09", 6)) {
+      goto i_0x0C45;
+    }
+    break;
+  case 0x0C46:
+    if (i8080_aot_code(c, 0x0C46, "\xFE\x03\xC2\x0D\x09", 5)) {
+      goto i_0x0C46;
+    }
+    break;
+  case 0x0C4B: goto b_0x0C4B;
+  case 0x0C4C: goto b_0x0C4C;
+  case 0x0C4E: goto b_0x0C4E;
+  case 0x0C4F:
+    if (i8080_aot_code(c, 0x0C4F, "\x3A\x4C\x0C\xFE\x53\xCA\x0D\x09", 8)) {
+      goto i_0x0C4F;
+    }
+    break;
+  case 0x0C52:
+    if (i8080_aot_code(c, 0x0C52, "\xFE\x53\xCA\x0D\x09", 5)) {
+      goto i_0x0C52;
+    }
+    break;
+  case 0x0C50: goto b_0x0C50;
+  case 0x0C57: goto b_0x0C57;
+  case 0x0C5A: goto b_0x0C5A;
+  case 0x0C5D:
+    if (i8080_aot_code(c, 0x0C5D, "\xC9", 1)) {
+      goto i_0x0C5D;
+    }
+    break;
+  case 0x0C65: goto b_0x0C65;
+  case 0x0C68: goto b_0x0C68;
+  case 0x0C6A:
+    if (i8080_aot_code(c, 0x0C6A, "\x00\xC9", 2)) {
+      goto i_0x0C6A;
+    }
+    break;
+  case 0x0C6C: goto b_0x0C6C;
+  case 0x0C6F: goto b_0x0C6F;
+  case 0x2025: goto b_0x2025;
+  case 0x2026:
+    if (i8080_aot_code(c, 0x2026, "\xE5\xD5\xC5\x0E\x0D\xCD\x05\x00", 8)) {
+      goto i_0x2026;
+    }
+    break;
+  case 0x2027:
+    if (i8080_aot_code(c, 0x2027, "\xD5\xC5\x0E\x0D\xCD\x05\x00", 7)) {
+      goto i_0x2027;
+    }
+    break;
+  case 0x2028:
+    if (i8080_aot_code(c, 0x2028, "\xC5\x0E\x0D\xCD\x05\x00", 6)) {
+      goto i_0x2028;
+    }
+    break;
+  case 0x2029:
+    if (i8080_aot_code(c, 0x2029, "\x0E\x0D\xCD\x05\x00", 5)) {
+      goto i_0x2029;
+    }
+    break;
+  case 0x202E: goto b_0x202E;
+  case 0x2034:
+    if (i8080_aot_code(c, 0x2034, "\x3E\x80\x32\x03\x20\xC1\xD1\xE1\xF1\xC9", 10)) {
+      goto i_0x2034;
+    }
+    break;
+  case 0x2039:
+    if (i8080_aot_code(c, 0x2039, "\xC1\xD1\xE1\xF1\xC9", 5)) {
+      goto i_0x2039;
+    }
+    break;
+  case 0x203A:
+    if (i8080_aot_code(c, 0x203A, "\xD1\xE1\xF1\xC9", 4)) {
+      goto i_0x203A;
+    }
+    break;
+  case 0x203B:
+    if (i8080_aot_code(c, 0x203B, "\xE1\xF1\xC9", 3)) {
+      goto i_0x203B;
+    }
+    break;
+  case 0x203C:
+    if (i8080_aot_code(c, 0x203C, "\xF1\xC9", 2)) {
+      goto i_0x203C;
+    }
+    break;
+  case 0x203D:
+    if (i8080_aot_code(c, 0x203D, "\xC9", 1)) {
+      goto i_0x203D;
+    }
+    break;
+  case 0x203E: goto b_0x203E;
+  case 0x203F:
+    if (i8080_aot_code(c, 0x203F, "\xD5\xC5\x11\x04\x20\x0E\x0F\xCD\x05\x00", 10)) {
+      goto i_0x203F;
+    }
+    break;
+  case 0x2040:
+    if (i8080_aot_code(c, 0x2040, "\xC5\x11\x04\x20\x0E\x0F\xCD\x05\x00", 9)) {
+      goto i_0x2040;
+    }
+    break;
+  case 0x2041:
+    if (i8080_aot_code(c, 0x2041, "\x11\x04\x20\x0E\x0F\xCD\x05\x00", 8)) {
+      goto i_0x2041;
+    }
+    break;
+  case 0x2049: goto b_0x2049;
+  case 0x204E: goto b_0x204E;
+  case 0x2052: goto b_0x2052;
+  case 0x2053: goto b_0x2053;
+  case 0x2054:
+    if (i8080_aot_code(c, 0x2054, "\xD1\xE1\xC9", 3)) {
+      goto i_0x2054;
+    }
+    break;
+  case 0x2055:
+    if (i8080_aot_code(c, 0x2055, "\xE1\xC9", 2)) {
+      goto i_0x2055;
+    }
+    break;
+  case 0x2056:
+    if (i8080_aot_code(c, 0x2056, "\xC9", 1)) {
+      goto i_0x2056;
+    }
+    break;
+  case 0x2057: goto b_0x2057;
+  case 0x2058:
+    if (i8080_aot_code(c, 0x2058, "\xD5\xC5\x0E\x16\xCD\x05\x00", 7)) {
+      goto i_0x2058;
+    }
+    break;
+  case 0x2059:
+    if (i8080_aot_code(c, 0x2059, "\xC5\x0E\x16\xCD\x05\x00", 6)) {
+      goto i_0x2059;
+    }
+    break;
+  case 0x205A:
+    if (i8080_aot_code(c, 0x205A, "\x0E\x16\xCD\x05\x00", 5)) {
+      goto i_0x205A;
+    }
+    break;
+  case 0x205F: goto b_0x205F;
+  case 0x2064: goto b_0x2064;
+  case 0x2068: goto b_0x2068;
+  case 0x2069: goto b_0x2069;
+  case 0x206A:
+    if (i8080_aot_code(c, 0x206A, "\xD1\xE1\xC9", 3)) {
+      goto i_0x206A;
+    }
+    break;
+  case 0x206B:
+    if (i8080_aot_code(c, 0x206B, "\xE1\xC9", 2)) {
+      goto i_0x206B;
+    }
+    break;
+  case 0x206C:
+    if (i8080_aot_code(c, 0x206C, "\xC9", 1)) {
+      goto i_0x206C;
+    }
+    break;
+  case 0x206D: goto b_0x206D;
+  case 0x206E:
+    if (i8080_aot_code(c, 0x206E, "\xD5\xC5\x0E\x14\xCD\x05\x00", 7)) {
+      goto i_0x206E;
+    }
+    break;
+  case 0x206F:
+    if (i8080_aot_code(c, 0x206F, "\xC5\x0E\x14\xCD\x05\x00", 6)) {
+      goto i_0x206F;
+    }
+    break;
+  case 0x2070:
+    if (i8080_aot_code(c, 0x2070, "\x0E\x14\xCD\x05\x00", 5)) {
+      goto i_0x2070;
+    }
+    break;
+  case 0x2075: goto b_0x2075;
+  case 0x2079: goto b_0x2079;
+  case 0x207A: goto b_0x207A;
+  case 0x207B:
+    if (i8080_aot_code(c, 0x207B, "\xD1\xE1\xC9", 3)) {
+      goto i_0x207B;
+    }
+    break;
+  case 0x207C:
+    if (i8080_aot_code(c, 0x207C, "\xE1\xC9", 2)) {
+      goto i_0x207C;
+    }
+    break;
+  case 0x207D:
+    if (i8080_aot_code(c, 0x207D, "\xC9", 1)) {
+      goto i_0x207D;
+    }
+    break;
+  case 0x207E: goto b_0x207E;
+  case 0x207F:
+    if (i8080_aot_code(c, 0x207F, "\xC5", 1)) {
+      goto i_0x207F;
+    }
+    break;
+  case 0x2080: goto b_0x2080;
+  case 0x2083: goto b_0x2083;
+  case 0x2086: goto b_0x2086;
+  case 0x208B: goto b_0x208B;
+  case 0x208F: goto b_0x208F;
+  case 0x2092:
+    if (i8080_aot_code(c, 0x2092, "\x3D\x32\x24\x20\x21\x80\x00\x06\x80\x3E\x1A", 11)) {
+      goto i_0x2092;
+    }
+    break;
+  case 0x2096:
+    if (i8080_aot_code(c, 0x2096, "\x21\x80\x00\x06\x80\x3E\x1A", 7)) {
+      goto i_0x2096;
+    }
+    break;
+  case 0x209D: goto b_0x209D;
+  case 0x209E:
+    if (i8080_aot_code(c, 0x209E, "\xCA\xA9\x20", 3)) {
+      goto i_0x209E;
+    }
+    break;
+  case 0x20A1: goto b_0x20A1;
+  case 0x20A6: goto b_0x20A6;
+  case 0x20A9: goto b_0x20A9;
+  case 0x20AA:
+    if (i8080_aot_code(c, 0x20AA, "\xD1\xC9", 2)) {
+      goto i_0x20AA;
+    }
+    break;
+  case 0x20AB:
+    if (i8080_aot_code(c, 0x20AB, "\xC9", 1)) {
+      goto i_0x20AB;
+    }
+    break;
+  case 0x20AC: goto b_0x20AC;
+  case 0x20AD:
+    if (i8080_aot_code(c, 0x20AD, "\xD5\xC5\x0E\x15\xCD\x05\x00", 7)) {
+      goto i_0x20AD;
+    }
+    break;
+  case 0x20AE:
+    if (i8080_aot_code(c, 0x20AE, "\xC5\x0E\x15\xCD\x05\x00", 6)) {
+      goto i_0x20AE;
+    }
+    break;
+  case 0x20AF:
+    if (i8080_aot_code(c, 0x20AF, "\x0E\x15\xCD\x05\x00", 5)) {
+      goto i_0x20AF;
+    }
+    break;
+  case 0x20B4: goto b_0x20B4;
+  case 0x20B8: goto b_0x20B8;
+  case 0x20B9: goto b_0x20B9;
+  case 0x20BA:
+    if (i8080_aot_code(c, 0x20BA, "\xD1\xE1\xC9", 3)) {
+      goto i_0x20BA;
+    }
+    break;
+  case 0x20BB:
+    if (i8080_aot_code(c, 0x20BB, "\xE1\xC9", 2)) {
+      goto i_0x20BB;
+    }
+    break;
+  case 0x20BC:
+    if (i8080_aot_code(c, 0x20BC, "\xC9", 1)) {
+      goto i_0x20BC;
+    }
+    break;
+  case 0x20BD: goto b_0x20BD;
+  case 0x20BE:
+    if (i8080_aot_code(c, 0x20BE, "\x0E\x02\xCD\x05\x00", 5)) {
+      goto i_0x20BE;
+    }
+    break;
+  case 0x20C3: goto b_0x20C3;
+  case 0x20C6:
+    if (i8080_aot_code(c, 0x20C6, "\xB7\xC2\xCC\x20", 4)) {
+      goto i_0x20C6;
+    }
+    break;
+  case 0x20CA: goto b_0x20CA;
+  case 0x20CB:
+    if (i8080_aot_code(c, 0x20CB, "\xC9", 1)) {
+      goto i_0x20CB;
+    }
+    break;
+  case 0x20CC: goto b_0x20CC;
+  case 0x20CD:
+    if (i8080_aot_code(c, 0x20CD, "\xE5\xD5\xC5\x4F\x2A\x01\x20\x77\x23\x3A\x03\x20\x3D\xC2\xEB\x20", 16)) {
+      goto i_0x20CD;
+    }
+    break;
+  case 0x20CE:
+    if (i8080_aot_code(c, 0x20CE, "\xD5\xC5\x4F\x2A\x01\x20\x77\x23\x3A\x03\x20\x3D\xC2\xEB\x20", 15)) {
+      goto i_0x20CE;
+    }
+    break;
+  case 0x20CF:
+    if (i8080_aot_code(c, 0x20CF, "\xC5\x4F\x2A\x01\x20\x77\x23\x3A\x03\x20\x3D\xC2\xEB\x20", 14)) {
+      goto i_0x20CF;
+    }
+    break;
+  case 0x20D0:
+    if (i8080_aot_code(c, 0x20D0, "\x4F\x2A\x01\x20\x77\x23\x3A\x03\x20\x3D\xC2\xEB\x20", 13)) {
+      goto i_0x20D0;
+    }
+    break;
+  case 0x20D4:
+    if (i8080_aot_code(c, 0x20D4, "\x77\x23\x3A\x03\x20\x3D\xC2\xEB\x20", 9)) {
+      goto i_0x20D4;
+    }
+    break;
+  case 0x20D5:
+    if (i8080_aot_code(c, 0x20D5, "\x23\x3A\x03\x20\x3D\xC2\xEB\x20", 8)) {
+      goto i_0x20D5;
+    }
+    break;
+  case 0x20D9:
+    if (i8080_aot_code(c, 0x20D9, "\x3D\xC2\xEB\x20", 4)) {
+      goto i_0x20D9;
+    }
+    break;
+  case 0x20DD: goto b_0x20DD;
+  case 0x20E3: goto b_0x20E3;
+  case 0x20E6: goto b_0x20E6;
+  case 0x20EB: goto b_0x20EB;
+  case 0x20EE:
+    if (i8080_aot_code(c, 0x20EE, "\x32\x03\x20\x79\xC1\xD1\xE1\xC9", 8)) {
+      goto i_0x20EE;
+    }
+    break;
+  case 0x20F1:
+    if (i8080_aot_code(c, 0x20F1, "\x79\xC1\xD1\xE1\xC9", 5)) {
+      goto i_0x20F1;
+    }
+    break;
+  case 0x20F3:
+    if (i8080_aot_code(c, 0x20F3, "\xD1\xE1\xC9", 3)) {
+      goto i_0x20F3;
+    }
+    break;
+  case 0x20F4:
+    if (i8080_aot_code(c, 0x20F4, "\xE1\xC9", 2)) {
+      goto i_0x20F4;
+    }
+    break;
+  case 0x20F5:
+    if (i8080_aot_code(c, 0x20F5, "\xC9", 1)) {
+      goto i_0x20F5;
+    }
+    break;
+  case 0x20F6: goto b_0x20F6;
+  case 0x20F7:
+    if (i8080_aot_code(c, 0x20F7, "\x3A\x00\x20\xB7\xC2\x00\x21", 7)) {
+      goto i_0x20F7;
+    }
+    break;
+  case 0x20FA:
+    if (i8080_aot_code(c, 0x20FA, "\xB7\xC2\x00\x21", 4)) {
+      goto i_0x20FA;
+    }
+    break;
+  case 0x20FE: goto b_0x20FE;
+  case 0x20FF:
+    if (i8080_aot_code(c, 0x20FF, "\xC9", 1)) {
+      goto i_0x20FF;
+    }
+    break;
+  case 0x2100: goto b_0x2100;
+  case 0x2101:
+    if (i8080_aot_code(c, 0x2101, "\xD5\xC5\x2A\x01\x20\x36\x1A\x11\x04\x20\xCD\xAC\x20", 13)) {
+      goto i_0x2101;
+    }
+    break;
+  case 0x2102:
+    if (i8080_aot_code(c, 0x2102, "\xC5\x2A\x01\x20\x36\x1A\x11\x04\x20\xCD\xAC\x20", 12)) {
+      goto i_0x2102;
+    }
+    break;
+  case 0x2103:
+    if (i8080_aot_code(c, 0x2103, "\x2A\x01\x20\x36\x1A\x11\x04\x20\xCD\xAC\x20", 11)) {
+      goto i_0x2103;
+    }
+    break;
+  case 0x2106:
+    if (i8080_aot_code(c, 0x2106, "\x36\x1A\x11\x04\x20\xCD\xAC\x20", 8)) {
+      goto i_0x2106;
+    }
+    break;
+  case 0x2108:
+    if (i8080_aot_code(c, 0x2108, "\x11\x04\x20\xCD\xAC\x20", 6)) {
+      goto i_0x2108;
+    }
+    break;
+  case 0x210E: goto b_0x210E;
+  case 0x2111: goto b_0x2111;
+  case 0x2114: goto b_0x2114;
+  case 0x2117:
+    if (i8080_aot_code(c, 0x2117, "\x4E\x4F\x54\x20\x46\x4C\x55\x53\x48\x20\x46\x49\x4C", 13)) {
+      goto i_0x2117;
+    }
+    break;
+  case 0x2118:
+    if (i8080_aot_code(c, 0x2118, "\x4F\x54\x20\x46\x4C\x55\x53\x48\x20\x46\x49\x4C", 12)) {
+      goto i_0x2118;
+    }
+    break;
+  case 0x211C:
+    if (i8080_aot_code(c, 0x211C, "\x4C\x55\x53\x48\x20\x46\x49\x4C", 8)) {
+      goto i_0x211C;
+    }
+    break;
+  case 0x2122:
+    if (i8080_aot_code(c, 0x2122, "\x49\x4C", 2)) {
+      goto i_0x2122;
+    }
+    break;
+  case 0x2124: goto b_0x2124;
+  case 0x2126: goto b_0x2126;
+  case 0x212B: goto b_0x212B;
+  case 0x2130: goto b_0x2130;
+  case 0x2133: goto b_0x2133;
+  case 0x2136:
+    if (i8080_aot_code(c, 0x2136, "\x4E\x4F\x54\x20\x43\x4C\x4F\x53\x45\x20\x54\x48\x45", 13)) {
+      goto i_0x2136;
+    }
+    break;
+  case 0x2137:
+    if (i8080_aot_code(c, 0x2137, "\x4F\x54\x20\x43\x4C\x4F\x53\x45\x20\x54\x48\x45", 12)) {
+      goto i_0x2137;
+    }
+    break;
+  case 0x2143: goto b_0x2143;
+  case 0x2145:
+    if (i8080_aot_code(c, 0x2145, "\x49\x4C\x45\x00\xC7", 5)) {
+      goto i_0x2145;
+    }
+    break;
+  case 0x214A: goto b_0x214A;
+  case 0x214B:
+    if (i8080_aot_code(c, 0x214B, "\xD1\xE1\xF1\xC9", 4)) {
+      goto i_0x214B;
+    }
+    break;
+  case 0x214C:
+    if (i8080_aot_code(c, 0x214C, "\xE1\xF1\xC9", 3)) {
+      goto i_0x214C;
+    }
+    break;
+  case 0x214D:
+    if (i8080_aot_code(c, 0x214D, "\xF1\xC9", 2)) {
+      goto i_0x214D;
+    }
+    break;
+  case 0x214E:
+    if (i8080_aot_code(c, 0x214E, "\xC9", 1)) {
+      goto i_0x214E;
+    }
+    break;
+  case 0x214F: goto b_0x214F;
+  case 0x2150:
+    if (i8080_aot_code(c, 0x2150, "\xE5\xD5\xC5\xAF\x32\x00\x20\x21\x80\x00\x7E\xFE\x04\xC2\x0A\x22", 16)) {
+      goto i_0x2150;
+    }
+    break;
+  case 0x2151:
+    if (i8080_aot_code(c, 0x2151, "\xD5\xC5\xAF\x32\x00\x20\x21\x80\x00\x7E\xFE\x04\xC2\x0A\x22", 15)) {
+      goto i_0x2151;
+    }
+    break;
+  case 0x2152:
+    if (i8080_aot_code(c, 0x2152, "\xC5\xAF\x32\x00\x20\x21\x80\x00\x7E\xFE\x04\xC2\x0A\x22", 14)) {
+      goto i_0x2152;
+    }
+    break;
+  case 0x2153:
+    if (i8080_aot_code(c, 0x2153, "\xAF\x32\x00\x20\x21\x80\x00\x7E\xFE\x04\xC2\x0A\x22", 13)) {
+      goto i_0x2153;
+    }
+    break;
+  case 0x2157:
+    if (i8080_aot_code(c, 0x2157, "\x21\x80\x00\x7E\xFE\x04\xC2\x0A\x22", 9)) {
+      goto i_0x2157;
+    }
+    break;
+  case 0x215B:
+    if (i8080_aot_code(c, 0x215B, "\xFE\x04\xC2\x0A\x22", 5)) {
+      goto i_0x215B;
+    }
+    break;
+  case 0x2160: goto b_0x2160;
+  case 0x2162:
+    if (i8080_aot_code(c, 0x2162, "\xFE\x20\xC2\x0A\x22", 5)) {
+      goto i_0x2162;
+    }
+    break;
+  case 0x2167: goto b_0x2167;
+  case 0x2169:
+    if (i8080_aot_code(c, 0x2169, "\xFE\x4C\xC2\x0A\x22", 5)) {
+      goto i_0x2169;
+    }
+    break;
+  case 0x216E: goto b_0x216E;
+  case 0x2170:
+    if (i8080_aot_code(c, 0x2170, "\xFE\x4F\xC2\x0A\x22", 5)) {
+      goto i_0x2170;
+    }
+    break;
+  case 0x2175: goto b_0x2175;
+  case 0x2177:
+    if (i8080_aot_code(c, 0x2177, "\xFE\x47\xC2\x0A\x22", 5)) {
+      goto i_0x2177;
+    }
+    break;
+  case 0x217C: goto b_0x217C;
+  case 0x2181:
+    if (i8080_aot_code(c, 0x2181, "\xCD\x25\x20", 3)) {
+      goto i_0x2181;
+    }
+    break;
+  case 0x2184: goto b_0x2184;
+  case 0x218A: goto b_0x218A;
+  case 0x218D: goto b_0x218D;
+  case 0x2190: goto b_0x2190;
+  case 0x2193: goto b_0x2193;
+  case 0x2196: goto b_0x2196;
+  case 0x21A6: goto b_0x21A6;
+  case 0x21A9:
+    if (i8080_aot_code(c, 0x21A9, "\x55\x4C\x4C\x00\xC7", 5)) {
+      goto i_0x21A9;
+    }
+    break;
+  case 0x21AE: goto b_0x21AE;
+  case 0x21B1: goto b_0x21B1;
+  case 0x21B4: goto b_0x21B4;
+  case 0x21B7: goto b_0x21B7;
+  case 0x21BA:
+    if (i8080_aot_code(c, 0x21BA, "\x4E\x4F\x54\x20\x4F\x50\x45\x4E\x20\x46\x49\x4C\x45", 13)) {
+      goto i_0x21BA;
+    }
+    break;
+  case 0x21BB:
+    if (i8080_aot_code(c, 0x21BB, "\x4F\x54\x20\x4F\x50\x45\x4E\x20\x46\x49\x4C\x45", 12)) {
+      goto i_0x21BB;
+    }
+    break;
+  case 0x21C2:
+    if (i8080_aot_code(c, 0x21C2, "\x20\x46\x49\x4C\x45", 5)) {
+      goto i_0x21C2;
+    }
+    break;
+  case 0x21C4:
+    if (i8080_aot_code(c, 0x21C4, "\x49\x4C\x45", 3)) {
+      goto i_0x21C4;
+    }
+    break;
+  case 0x21C7: goto b_0x21C7;
+  case 0x21C9: goto b_0x21C9;
+  case 0x21CC: goto b_0x21CC;
+  case 0x21CF: goto b_0x21CF;
+  case 0x21D2: goto b_0x21D2;
+  case 0x21D5:
+    if (i8080_aot_code(c, 0x21D5, "\x4E\x4F\x54\x20\x52\x45\x41\x44\x20\x46\x49\x4C\x45", 13)) {
+      goto i_0x21D5;
+    }
+    break;
+  case 0x21D6:
+    if (i8080_aot_code(c, 0x21D6, "\x4F\x54\x20\x52\x45\x41\x44\x20\x46\x49\x4C\x45", 12)) {
+      goto i_0x21D6;
+    }
+    break;
+  case 0x21DF:
+    if (i8080_aot_code(c, 0x21DF, "\x49\x4C\x45", 3)) {
+      goto i_0x21DF;
+    }
+    break;
+  case 0x21E2: goto b_0x21E2;
+  case 0x21E4: goto b_0x21E4;
+  case 0x21E7:
+    if (i8080_aot_code(c, 0x21E7, "\x11\x00\x01\x7B\x95\x32\x03\x20\x7A\x9C\xD2\x0A\x22", 13)) {
+      goto i_0x21E7;
+    }
+    break;
+  case 0x21EF:
+    if (i8080_aot_code(c, 0x21EF, "\x7A\x9C\xD2\x0A\x22", 5)) {
+      goto i_0x21EF;
+    }
+    break;
+  case 0x21F4: goto b_0x21F4;
+  case 0x21F7: goto b_0x21F7;
+  case 0x21FA:
+    if (i8080_aot_code(c, 0x21FA, "\x46\x45\x52\x20\x4D\x41", 6) &&
+      i8080_aot_code(c, 0x2200, "\x54\x48\x20\x45\x52\x52\x4F", 7)) {
+      goto i_0x21FA;
+    }
+    break;
+  case 0x21FB:
+    if (i8080_aot_code(c, 0x21FB, "\x45\x52\x20\x4D\x41", 5) &&
+      i8080_aot_code(c, 0x2200, "\x54\x48\x20\x45\x52\x52\x4F", 7)) {
+      goto i_0x21FB;
+    }
+    break;
+  case 0x2207: goto b_0x2207;
+  case 0x220A: goto b_0x220A;
+  case 0x2211: goto b_0x2211;
+  case 0x2216: goto b_0x2216;
+  case 0x221B: goto b_0x221B;
+  case 0x2220: goto b_0x2220;
+  case 0x2225: goto b_0x2225;
+  case 0x2228: goto b_0x2228;
+  case 0x2229:
+    if (i8080_aot_code(c, 0x2229, "\xD1\xE1\xF1\xC9", 4)) {
+      goto i_0x2229;
+    }
+    break;
+  case 0x222A:
+    if (i8080_aot_code(c, 0x222A, "\xE1\xF1\xC9", 3)) {
+      goto i_0x222A;
+    }
+    break;
+  case 0x222B:
+    if (i8080_aot_code(c, 0x222B, "\xF1\xC9", 2)) {
+      goto i_0x222B;
+    }
+    break;
+  case 0x222C:
+    if (i8080_aot_code(c, 0x222C, "\xC9", 1)) {
+      goto i_0x222C;
+    }
+    break;
+  case 0x3000: goto b_0x3000;
+  case 0x3001: goto b_0x3001;
+  case 0x3007: goto b_0x3007;
+  case 0x300A: goto b_0x300A;
+  case 0x300C:
+    if (i8080_aot_code(c, 0x300C, "\x44\x49\x41\x47\x4E\x4F\x53\x54\x49\x43\x53\x20\x49\x49", 14)) {
+      goto i_0x300C;
+    }
+    break;
+  case 0x3011:
+    if (i8080_aot_code(c, 0x3011, "\x4F\x53\x54\x49\x43\x53\x20\x49\x49", 9)) {
+      goto i_0x3011;
+    }
+    break;
+  case 0x301A: goto b_0x301A;
+  case 0x301C:
+    if (i8080_aot_code(c, 0x301C, "\x31\x2E\x32\x20\x2D\x20\x43\x50\x55\x20\x54\x45\x53\x54\x0D\x0A", 16)) {
+      goto i_0x301C;
+    }
+    break;
+  case 0x302C: goto b_0x302C;
+  case 0x3040: goto b_0x3040;
+  case 0x3049:
+    if (i8080_aot_code(c, 0x3049, "\x54\x20\x41\x53\x53\x4F\x43", 7)) {
+      goto i_0x3049;
+    }
+    break;
+  case 0x3050: goto b_0x3050;
+  case 0x3057:
+    if (i8080_aot_code(c, 0x3057, "\x0A\x00\xC3\x64\x30", 5)) {
+      goto i_0x3057;
+    }
+    break;
+  case 0x3058:
+    if (i8080_aot_code(c, 0x3058, "\x00\xC3\x64\x30", 4)) {
+      goto i_0x3058;
+    }
+    break;
+  case 0x3064: goto b_0x3064;
+  case 0x3067: goto b_0x3067;
+  case 0x3084: goto b_0x3084;
+  case 0x308B: goto b_0x308B;
+  case 0x3090: goto b_0x3090;
+  case 0x3095: goto b_0x3095;
+  case 0x3098:
+    if (i8080_aot_code(c, 0x3098, "\xB7\xC2\xA2\x30", 4)) {
+      goto i_0x3098;
+    }
+    break;
+  case 0x309C: goto b_0x309C;
+  case 0x309F: goto b_0x309F;
+  case 0x30A2: goto b_0x30A2;
+  case 0x30A5: goto b_0x30A5;
+  case 0x30A7: goto b_0x30A7;
+  case 0x30AB: goto b_0x30AB;
+  case 0x30AE: goto b_0x30AE;
+  case 0x30B3: goto b_0x30B3;
+  case 0x30C1: goto b_0x30C1;
+  case 0x30C7: goto b_0x30C7;
+  case 0x30CC: goto b_0x30CC;
+  case 0x30CD: goto b_0x30CD;
+  case 0x30D0:
+    if (i8080_aot_code(c, 0x30D0, "\xCD\x06\x38", 3)) {
+      goto i_0x30D0;
+    }
+    break;
+  case 0x30D3: goto b_0x30D3;
+  case 0x3122: goto b_0x3122;
+  case 0x3125: goto b_0x3125;
+  case 0x312F: goto b_0x312F;
+  case 0x3132: goto b_0x3132;
+  case 0x3134:
+    if (i8080_aot_code(c, 0x3134, "\x43\x50\x55\x20\x49\x53\x20\x00\x3A\x69\x3B\xB7\xCA\x77\x31", 15)) {
+      goto i_0x3134;
+    }
+    break;
+  case 0x313F:
+    if (i8080_aot_code(c, 0x313F, "\xB7\xCA\x77\x31", 4)) {
+      goto i_0x313F;
+    }
+    break;
+  case 0x3143: goto b_0x3143;
+  case 0x3146: goto b_0x3146;
+  case 0x314D:
+    if (i8080_aot_code(c, 0x314D, "\xB7\xC2\x84\x31", 4)) {
+      goto i_0x314D;
+    }
+    break;
+  case 0x3151: goto b_0x3151;
+  case 0x3154: goto b_0x3154;
+  case 0x3159:
+    if (i8080_aot_code(c, 0x3159, "\x52\x45\x53\x48\x20\x52\x45\x47\x49\x53\x54", 11)) {
+      goto i_0x3159;
+    }
+    break;
+  case 0x3164: goto b_0x3164;
+  case 0x3168:
+    if (i8080_aot_code(c, 0x3168, "\x4F\x54\x20\x43\x48\x45\x43\x4B\x45\x44\x29\x00", 12)) {
+      goto i_0x3168;
+    }
+    break;
+  case 0x3174: goto b_0x3174;
+  case 0x3177: goto b_0x3177;
+  case 0x317A: goto b_0x317A;
+  case 0x3183:
+    if (i8080_aot_code(c, 0x3183, "\x00", 1)) {
+      goto i_0x3183;
+    }
+    break;
+  case 0x3184: goto b_0x3184;
+  case 0x318B: goto b_0x318B;
+  case 0x318D:
+    if (i8080_aot_code(c, 0x318D, "\x42\x45\x47\x49\x4E\x20\x54\x49\x4D\x49\x4E\x47\x20\x54", 14)) {
+      goto i_0x318D;
+    }
+    break;
+  case 0x3192:
+    if (i8080_aot_code(c, 0x3192, "\x20\x54\x49\x4D\x49\x4E\x47\x20\x54", 9)) {
+      goto i_0x3192;
+    }
+    break;
+  case 0x3198:
+    if (i8080_aot_code(c, 0x3198, "\x47\x20\x54", 3)) {
+      goto i_0x3198;
+    }
+    break;
+  case 0x319B: goto b_0x319B;
+  case 0x31A0:
+    if (i8080_aot_code(c, 0x31A0, "\x00\xCD\x45\x3B", 4)) {
+      goto i_0x31A0;
+    }
+    break;
+  case 0x31A4: goto b_0x31A4;
+  case 0x31A7: goto b_0x31A7;
+  case 0x31BC: goto b_0x31BC;
+  case 0x31BF: goto b_0x31BF;
+  case 0x31C2: goto b_0x31C2;
+  case 0x31C4:
+    if (i8080_aot_code(c, 0x31C4, "\x44\x20\x54\x49\x4D\x49\x4E\x47\x20\x54\x45\x53\x54\x0D", 14)) {
+      goto i_0x31C4;
+    }
+    break;
+  case 0x31CB:
+    if (i8080_aot_code(c, 0x31CB, "\x47\x20\x54\x45\x53\x54\x0D", 7)) {
+      goto i_0x31CB;
+    }
+    break;
+  case 0x31D2: goto b_0x31D2;
+  case 0x31D3:
+    if (i8080_aot_code(c, 0x31D3, "\x00\xCD\xE7\x32", 4)) {
+      goto i_0x31D3;
+    }
+    break;
+  case 0x31D7: goto b_0x31D7;
+  case 0x31DA: goto b_0x31DA;
+  case 0x31E3: goto b_0x31E3;
+  case 0x31E6: goto b_0x31E6;
+  case 0x31EE:
+    if (i8080_aot_code(c, 0x31EE, "\x44\x20\x00\x2A\x75\x3B\xCD\x82\x3A", 9)) {
+      goto i_0x31EE;
+    }
+    break;
+  case 0x31F4:
+    if (i8080_aot_code(c, 0x31F4, "\xCD\x82\x3A", 3)) {
+      goto i_0x31F4;
+    }
+    break;
+  case 0x31F7: goto b_0x31F7;
+  case 0x31FA: goto b_0x31FA;
+  case 0x31FC:
+    if (i8080_aot_code(c, 0x31FC, "\x54\x41\x42\x4C", 4) &&
+      i8080_aot_code(c, 0x3200, "\x45\x20\x53\x49\x5A\x45\x20\x00\x11\x8D\xC4\x19", 12)) {
+      goto i_0x31FC;
+    }
+    break;
+  case 0x320C: goto b_0x320C;
+  case 0x320F: goto b_0x320F;
+  case 0x3212: goto b_0x3212;
+  case 0x3221: goto b_0x3221;
+  case 0x3224: goto b_0x3224;
+  case 0x3227:
+    if (i8080_aot_code(c, 0x3227, "\x21\x6C\x3B\x86\x57\x3E\x01\xCD\xF5\x37", 10)) {
+      goto i_0x3227;
+    }
+    break;
+  case 0x322B:
+    if (i8080_aot_code(c, 0x322B, "\x57\x3E\x01\xCD\xF5\x37", 6)) {
+      goto i_0x322B;
+    }
+    break;
+  case 0x3231: goto b_0x3231;
+  case 0x3234:
+    if (i8080_aot_code(c, 0x3234, "\x32\x6B\x3B\x3A\x6B\x3B\x21\x6C\x3B\x86\x92\x57\x3A\x70\x3B\x92\x32\x70\x3B\xCD\x5C\x3B", 22)) {
+      goto i_0x3234;
+    }
+    break;
+  case 0x3237:
+    if (i8080_aot_code(c, 0x3237, "\x3A\x6B\x3B\x21\x6C\x3B\x86\x92\x57\x3A\x70\x3B\x92\x32\x70\x3B\xCD\x5C\x3B", 19)) {
+      goto i_0x3237;
+    }
+    break;
+  case 0x323A:
+    if (i8080_aot_code(c, 0x323A, "\x21\x6C\x3B\x86\x92\x57\x3A\x70\x3B\x92\x32\x70\x3B\xCD\x5C\x3B", 16)) {
+      goto i_0x323A;
+    }
+    break;
+  case 0x323E:
+    if (i8080_aot_code(c, 0x323E, "\x92\x57\x3A\x70\x3B\x92\x32\x70\x3B\xCD\x5C\x3B", 12)) {
+      goto i_0x323E;
+    }
+    break;
+  case 0x3243:
+    if (i8080_aot_code(c, 0x3243, "\x92\x32\x70\x3B\xCD\x5C\x3B", 7)) {
+      goto i_0x3243;
+    }
+    break;
+  case 0x3247:
+    if (i8080_aot_code(c, 0x3247, "\xCD\x5C\x3B", 3)) {
+      goto i_0x3247;
+    }
+    break;
+  case 0x324A: goto b_0x324A;
+  case 0x3281: goto b_0x3281;
+  case 0x3282:
+    if (i8080_aot_code(c, 0x3282, "\xCD\x14\x38", 3)) {
+      goto i_0x3282;
+    }
+    break;
+  case 0x3285: goto b_0x3285;
+  case 0x328E: goto b_0x328E;
+  case 0x328F:
+    if (i8080_aot_code(c, 0x328F, "\xF5\xD5\x57\x3A\x70\x3B\x92\x32\x70\x3B\xD1\xF1\xF5\xCD\x45\x3A", 16)) {
+      goto i_0x328F;
+    }
+    break;
+  case 0x3290:
+    if (i8080_aot_code(c, 0x3290, "\xD5\x57\x3A\x70\x3B\x92\x32\x70\x3B\xD1\xF1\xF5\xCD\x45\x3A", 15)) {
+      goto i_0x3290;
+    }
+    break;
+  case 0x3291:
+    if (i8080_aot_code(c, 0x3291, "\x57\x3A\x70\x3B\x92\x32\x70\x3B\xD1\xF1\xF5\xCD\x45\x3A", 14)) {
+      goto i_0x3291;
+    }
+    break;
+  case 0x3295:
+    if (i8080_aot_code(c, 0x3295, "\x92\x32\x70\x3B\xD1\xF1\xF5\xCD\x45\x3A", 10)) {
+      goto i_0x3295;
+    }
+    break;
+  case 0x3299:
+    if (i8080_aot_code(c, 0x3299, "\xD1\xF1\xF5\xCD\x45\x3A", 6)) {
+      goto i_0x3299;
+    }
+    break;
+  case 0x329A:
+    if (i8080_aot_code(c, 0x329A, "\xF1\xF5\xCD\x45\x3A", 5)) {
+      goto i_0x329A;
+    }
+    break;
+  case 0x329B:
+    if (i8080_aot_code(c, 0x329B, "\xF5\xCD\x45\x3A", 4)) {
+      goto i_0x329B;
+    }
+    break;
+  case 0x329C:
+    if (i8080_aot_code(c, 0x329C, "\xCD\x45\x3A", 3)) {
+      goto i_0x329C;
+    }
+    break;
+  case 0x329F: goto b_0x329F;
+  case 0x32A4: goto b_0x32A4;
+  case 0x32A7: goto b_0x32A7;
+  case 0x32AC: goto b_0x32AC;
+  case 0x32AD:
+    if (i8080_aot_code(c, 0x32AD, "\xC9", 1)) {
+      goto i_0x32AD;
+    }
+    break;
+  case 0x32DD: goto b_0x32DD;
+  case 0x32E0: goto b_0x32E0;
+  case 0x32E1: goto b_0x32E1;
+  case 0x32E6: goto b_0x32E6;
+  case 0x32E7: goto b_0x32E7;
+  case 0x32ED: goto b_0x32ED;
+  case 0x32F0: goto b_0x32F0;
+  case 0x32F6:
+    if (i8080_aot_code(c, 0x32F6, "\x3E\x00\x32\x3E\x33\x32\x3F\x33\x21\x58", 10) &&
+      i8080_aot_code(c, 0x3300, "\x33\x16\x01", 3)) {
+      goto i_0x32F6;
+    }
+    break;
+  case 0x32FB:
+    if (i8080_aot_code(c, 0x32FB, "\x32\x3F\x33\x21\x58", 5) &&
+      i8080_aot_code(c, 0x3300, "\x33\x16\x01", 3)) {
+      goto i_0x32FB;
+    }
+    break;
+  case 0x32FE:
+    if (i8080_aot_code(c, 0x32FE, "\x21\x58", 2) &&
+      i8080_aot_code(c, 0x3300, "\x33\x16\x01", 3)) {
+      goto i_0x32FE;
+    }
+    break;
+  case 0x3303: goto b_0x3303;
+  case 0x3304:
+    if (i8080_aot_code(c, 0x3304, "\x23\xFE\x00\xC2\x1B\x33", 6)) {
+      goto i_0x3304;
+    }
+    break;
+  case 0x330A: goto b_0x330A;
+  case 0x330D: goto b_0x330D;
+  case 0x3310: goto b_0x3310;
+  case 0x3313: goto b_0x3313;
+  case 0x331A: goto b_0x331A;
+  case 0x331B: goto b_0x331B;
+  case 0x331E:
+    if (i8080_aot_code(c, 0x331E, "\x7A\xFE\x02\xFA\x34\x33", 6)) {
+      goto i_0x331E;
+    }
+    break;
+  case 0x3324: goto b_0x3324;
+  case 0x3325:
+    if (i8080_aot_code(c, 0x3325, "\x23\x32\x3E\x33\x7A\xFE\x03\xFA\x34\x33", 10)) {
+      goto i_0x3325;
+    }
+    break;
+  case 0x3329:
+    if (i8080_aot_code(c, 0x3329, "\x7A\xFE\x03\xFA\x34\x33", 6)) {
+      goto i_0x3329;
+    }
+    break;
+  case 0x332F: goto b_0x332F;
+  case 0x3330:
+    if (i8080_aot_code(c, 0x3330, "\x23\x32\x3F\x33", 4)) {
+      goto i_0x3330;
+    }
+    break;
+  case 0x3334: goto b_0x3334;
+  case 0x3335:
+    if (i8080_aot_code(c, 0x3335, "\xE5\xF5\x21\xA1\x39\xCD\xB7\x38", 8)) {
+      goto i_0x3335;
+    }
+    break;
+  case 0x3336:
+    if (i8080_aot_code(c, 0x3336, "\xF5\x21\xA1\x39\xCD\xB7\x38", 7)) {
+      goto i_0x3336;
+    }
+    break;
+  case 0x3337:
+    if (i8080_aot_code(c, 0x3337, "\x21\xA1\x39\xCD\xB7\x38", 6)) {
+      goto i_0x3337;
+    }
+    break;
+  case 0x333D: goto b_0x333D;
+  case 0x3340: goto b_0x3340;
+  case 0x3343: goto b_0x3343;
+  case 0x3349: goto b_0x3349;
+  case 0x334C: goto b_0x334C;
+  case 0x334D:
+    if (i8080_aot_code(c, 0x334D, "\xE1\xD1\xC3\x03\x33", 5)) {
+      goto i_0x334D;
+    }
+    break;
+  case 0x334E:
+    if (i8080_aot_code(c, 0x334E, "\xD1\xC3\x03\x33", 4)) {
+      goto i_0x334E;
+    }
+    break;
+  case 0x334F:
+    if (i8080_aot_code(c, 0x334F, "\xC3\x03\x33", 3)) {
+      goto i_0x334F;
+    }
+    break;
+  case 0x3356: goto b_0x3356;
+  case 0x351A: goto b_0x351A;
+  case 0x351B:
+    if (i8080_aot_code(c, 0x351B, "\x21\xA1\x39\xCD\x31\x38", 6)) {
+      goto i_0x351B;
+    }
+    break;
+  case 0x3521: goto b_0x3521;
+  case 0x3522: goto b_0x3522;
+  case 0x3523:
+    if (i8080_aot_code(c, 0x3523, "\x21\xD3\x39\xCD\x31\x38", 6)) {
+      goto i_0x3523;
+    }
+    break;
+  case 0x3529: goto b_0x3529;
+  case 0x352A:
+    if (i8080_aot_code(c, 0x352A, "\xD5\xF5\x21\xA1\x39\x11\xD3\x39\xCD\x0D\x38", 11)) {
+      goto i_0x352A;
+    }
+    break;
+  case 0x352B:
+    if (i8080_aot_code(c, 0x352B, "\xF5\x21\xA1\x39\x11\xD3\x39\xCD\x0D\x38", 10)) {
+      goto i_0x352B;
+    }
+    break;
+  case 0x352C:
+    if (i8080_aot_code(c, 0x352C, "\x21\xA1\x39\x11\xD3\x39\xCD\x0D\x38", 9)) {
+      goto i_0x352C;
+    }
+    break;
+  case 0x3535: goto b_0x3535;
+  case 0x3538: goto b_0x3538;
+  case 0x353B: goto b_0x353B;
+  case 0x353E: goto b_0x353E;
+  case 0x3541: goto b_0x3541;
+  case 0x3544: goto b_0x3544;
+  case 0x3547: goto b_0x3547;
+  case 0x3548:
+    if (i8080_aot_code(c, 0x3548, "\xD1\xE1\xC9", 3)) {
+      goto i_0x3548;
+    }
+    break;
+  case 0x3549:
+    if (i8080_aot_code(c, 0x3549, "\xE1\xC9", 2)) {
+      goto i_0x3549;
+    }
+    break;
+  case 0x354A:
+    if (i8080_aot_code(c, 0x354A, "\xC9", 1)) {
+      goto i_0x354A;
+    }
+    break;
+  case 0x356C: goto b_0x356C;
+  case 0x356D:
+    if (i8080_aot_code(c, 0x356D, "\x0E\xFF", 2)) {
+      goto i_0x356D;
+    }
+    break;
+  case 0x356F: goto b_0x356F;
+  case 0x3570:
+    if (i8080_aot_code(c, 0x3570, "\x2A\x75\x3B\x22\x4F\x35\xE1\xAF\x32\x73\x3B\x0C\x79\xFE\x19\xF2\xCB\x35", 18)) {
+      goto i_0x3570;
+    }
+    break;
+  case 0x3573:
+    if (i8080_aot_code(c, 0x3573, "\x22\x4F\x35\xE1\xAF\x32\x73\x3B\x0C\x79\xFE\x19\xF2\xCB\x35", 15)) {
+      goto i_0x3573;
+    }
+    break;
+  case 0x3576:
+    if (i8080_aot_code(c, 0x3576, "\xE1\xAF\x32\x73\x3B\x0C\x79\xFE\x19\xF2\xCB\x35", 12)) {
+      goto i_0x3576;
+    }
+    break;
+  case 0x3577:
+    if (i8080_aot_code(c, 0x3577, "\xAF\x32\x73\x3B\x0C\x79\xFE\x19\xF2\xCB\x35", 11)) {
+      goto i_0x3577;
+    }
+    break;
+  case 0x357B:
+    if (i8080_aot_code(c, 0x357B, "\x0C\x79\xFE\x19\xF2\xCB\x35", 7)) {
+      goto i_0x357B;
+    }
+    break;
+  case 0x3582: goto b_0x3582;
+  case 0x3584:
+    if (i8080_aot_code(c, 0x3584, "\x32\x4B\x35\xEB\x2B\x46\xF5\x78\x32\x4C\x35\xF1\xEB\xB8\xCA\x6F\x35", 17)) {
+      goto i_0x3584;
+    }
+    break;
+  case 0x3587:
+    if (i8080_aot_code(c, 0x3587, "\xEB\x2B\x46\xF5\x78\x32\x4C\x35\xF1\xEB\xB8\xCA\x6F\x35", 14)) {
+      goto i_0x3587;
+    }
+    break;
+  case 0x358A:
+    if (i8080_aot_code(c, 0x358A, "\xF5\x78\x32\x4C\x35\xF1\xEB\xB8\xCA\x6F\x35", 11)) {
+      goto i_0x358A;
+    }
+    break;
+  case 0x358B:
+    if (i8080_aot_code(c, 0x358B, "\x78\x32\x4C\x35\xF1\xEB\xB8\xCA\x6F\x35", 10)) {
+      goto i_0x358B;
+    }
+    break;
+  case 0x358F:
+    if (i8080_aot_code(c, 0x358F, "\xF1\xEB\xB8\xCA\x6F\x35", 6)) {
+      goto i_0x358F;
+    }
+    break;
+  case 0x3590:
+    if (i8080_aot_code(c, 0x3590, "\xEB\xB8\xCA\x6F\x35", 5)) {
+      goto i_0x3590;
+    }
+    break;
+  case 0x3595: goto b_0x3595;
+  case 0x3598:
+    if (i8080_aot_code(c, 0x3598, "\xB7\xC2\xA2\x35", 4)) {
+      goto i_0x3598;
+    }
+    break;
+  case 0x359C: goto b_0x359C;
+  case 0x35A2: goto b_0x35A2;
+  case 0x35A8: goto b_0x35A8;
+  case 0x35AC:
+    if (i8080_aot_code(c, 0x35AC, "\xCD\x94\x36", 3)) {
+      goto i_0x35AC;
+    }
+    break;
+  case 0x35AF: goto b_0x35AF;
+  case 0x35B2: goto b_0x35B2;
+  case 0x35B5: goto b_0x35B5;
+  case 0x35B8: goto b_0x35B8;
+  case 0x35BB:
+    if (i8080_aot_code(c, 0x35BB, "\xCD\x94\x36", 3)) {
+      goto i_0x35BB;
+    }
+    break;
+  case 0x35BE: goto b_0x35BE;
+  case 0x35C1:
+    if (i8080_aot_code(c, 0x35C1, "\xB7\xCD\x06\x38", 4)) {
+      goto i_0x35C1;
+    }
+    break;
+  case 0x35C5: goto b_0x35C5;
+  case 0x35C8: goto b_0x35C8;
+  case 0x35CB: goto b_0x35CB;
+  case 0x35D0: goto b_0x35D0;
+  case 0x35D5: goto b_0x35D5;
+  case 0x35D6:
+    if (i8080_aot_code(c, 0x35D6, "\xCD\x0D\x38", 3)) {
+      goto i_0x35D6;
+    }
+    break;
+  case 0x35D9: goto b_0x35D9;
+  case 0x35DC: goto b_0x35DC;
+  case 0x35DF: goto b_0x35DF;
+  case 0x35E0: goto b_0x35E0;
+  case 0x35E3: goto b_0x35E3;
+  case 0x361A: goto b_0x361A;
+  case 0x361D:
+    if (i8080_aot_code(c, 0x361D, "\xCD\x98\x3A", 3)) {
+      goto i_0x361D;
+    }
+    break;
+  case 0x3620: goto b_0x3620;
+  case 0x3623:
+    if (i8080_aot_code(c, 0x3623, "\xCD\x98\x3A", 3)) {
+      goto i_0x3623;
+    }
+    break;
+  case 0x3626: goto b_0x3626;
+  case 0x3629:
+    if (i8080_aot_code(c, 0x3629, "\xCD\x98\x3A", 3)) {
+      goto i_0x3629;
+    }
+    break;
+  case 0x362C: goto b_0x362C;
+  case 0x362D: goto b_0x362D;
+  case 0x362E:
+    if (i8080_aot_code(c, 0x362E, "\x21\x51\x35\xCD\x7A\x3A", 6)) {
+      goto i_0x362E;
+    }
+    break;
+  case 0x3634: goto b_0x3634;
+  case 0x3639: goto b_0x3639;
+  case 0x363E: goto b_0x363E;
+  case 0x363F:
+    if (i8080_aot_code(c, 0x363F, "\x3E\x5A\xCD\x05\x3A", 5)) {
+      goto i_0x363F;
+    }
+    break;
+  case 0x3644: goto b_0x3644;
+  case 0x3645: goto b_0x3645;
+  case 0x3648: goto b_0x3648;
+  case 0x3649:
+    if (i8080_aot_code(c, 0x3649, "\xC9", 1)) {
+      goto i_0x3649;
+    }
+    break;
+  case 0x364A: goto b_0x364A;
+  case 0x364B:
+    if (i8080_aot_code(c, 0x364B, "\xD5\x3A\x4D\x35\xCD\x98\x3A", 7)) {
+      goto i_0x364B;
+    }
+    break;
+  case 0x364C:
+    if (i8080_aot_code(c, 0x364C, "\x3A\x4D\x35\xCD\x98\x3A", 6)) {
+      goto i_0x364C;
+    }
+    break;
+  case 0x364F:
+    if (i8080_aot_code(c, 0x364F, "\xCD\x98\x3A", 3)) {
+      goto i_0x364F;
+    }
+    break;
+  case 0x3652: goto b_0x3652;
+  case 0x3655: goto b_0x3655;
+  case 0x365A: goto b_0x365A;
+  case 0x365D: goto b_0x365D;
+  case 0x3661:
+    if (i8080_aot_code(c, 0x3661, "\x4B\x35\xCD\x98\x3A", 5)) {
+      goto i_0x3661;
+    }
+    break;
+  case 0x3663:
+    if (i8080_aot_code(c, 0x3663, "\xCD\x98\x3A", 3)) {
+      goto i_0x3663;
+    }
+    break;
+  case 0x3666: goto b_0x3666;
+  case 0x3669: goto b_0x3669;
+  case 0x366F:
+    if (i8080_aot_code(c, 0x366F, "\xCD\x98\x3A", 3)) {
+      goto i_0x366F;
+    }
+    break;
+  case 0x3672: goto b_0x3672;
+  case 0x3675: goto b_0x3675;
+  case 0x367A:
+    if (i8080_aot_code(c, 0x367A, "\x23\x7E\xCD\x98\x3A", 5)) {
+      goto i_0x367A;
+    }
+    break;
+  case 0x367C:
+    if (i8080_aot_code(c, 0x367C, "\xCD\x98\x3A", 3)) {
+      goto i_0x367C;
+    }
+    break;
+  case 0x367F: goto b_0x367F;
+  case 0x3682: goto b_0x3682;
+  case 0x3687:
+    if (i8080_aot_code(c, 0x3687, "\xCD\x98\x3A", 3)) {
+      goto i_0x3687;
+    }
+    break;
+  case 0x368A: goto b_0x368A;
+  case 0x368D: goto b_0x368D;
+  case 0x3692:
+    if (i8080_aot_code(c, 0x3692, "\xE1\xC9", 2)) {
+      goto i_0x3692;
+    }
+    break;
+  case 0x3693:
+    if (i8080_aot_code(c, 0x3693, "\xC9", 1)) {
+      goto i_0x3693;
+    }
+    break;
+  case 0x3694: goto b_0x3694;
+  case 0x3695:
+    if (i8080_aot_code(c, 0x3695, "\xE5\x2A\x75\x3B\xF5\x7E\x32\x4E\x35\xF1\xBE\xCA\xAE\x36", 14)) {
+      goto i_0x3695;
+    }
+    break;
+  case 0x3696:
+    if (i8080_aot_code(c, 0x3696, "\x2A\x75\x3B\xF5\x7E\x32\x4E\x35\xF1\xBE\xCA\xAE\x36", 13)) {
+      goto i_0x3696;
+    }
+    break;
+  case 0x3699:
+    if (i8080_aot_code(c, 0x3699, "\xF5\x7E\x32\x4E\x35\xF1\xBE\xCA\xAE\x36", 10)) {
+      goto i_0x3699;
+    }
+    break;
+  case 0x369A:
+    if (i8080_aot_code(c, 0x369A, "\x7E\x32\x4E\x35\xF1\xBE\xCA\xAE\x36", 9)) {
+      goto i_0x369A;
+    }
+    break;
+  case 0x369B:
+    if (i8080_aot_code(c, 0x369B, "\x32\x4E\x35\xF1\xBE\xCA\xAE\x36", 8)) {
+      goto i_0x369B;
+    }
+    break;
+  case 0x369E:
+    if (i8080_aot_code(c, 0x369E, "\xF1\xBE\xCA\xAE\x36", 5)) {
+      goto i_0x369E;
+    }
+    break;
+  case 0x369F:
+    if (i8080_aot_code(c, 0x369F, "\xBE\xCA\xAE\x36", 4)) {
+      goto i_0x369F;
+    }
+    break;
+  case 0x36A0:
+    if (i8080_aot_code(c, 0x36A0, "\xCA\xAE\x36", 3)) {
+      goto i_0x36A0;
+    }
+    break;
+  case 0x36A3: goto b_0x36A3;
+  case 0x36A4:
+    if (i8080_aot_code(c, 0x36A4, "\x3A\x6B\x3B\x32\x73\x3B\xF1\xC3\xAE\x36", 10)) {
+      goto i_0x36A4;
+    }
+    break;
+  case 0x36A7:
+    if (i8080_aot_code(c, 0x36A7, "\x32\x73\x3B\xF1\xC3\xAE\x36", 7)) {
+      goto i_0x36A7;
+    }
+    break;
+  case 0x36AA:
+    if (i8080_aot_code(c, 0x36AA, "\xF1\xC3\xAE\x36", 4)) {
+      goto i_0x36AA;
+    }
+    break;
+  case 0x36AB:
+    if (i8080_aot_code(c, 0x36AB, "\xC3\xAE\x36", 3)) {
+      goto i_0x36AB;
+    }
+    break;
+  case 0x36AE: goto b_0x36AE;
+  case 0x36B1: goto b_0x36B1;
+  case 0x36B4: goto b_0x36B4;
+  case 0x36B8:
+    if (i8080_aot_code(c, 0x36B8, "\xE1\xF1\xC9", 3)) {
+      goto i_0x36B8;
+    }
+    break;
+  case 0x36B9:
+    if (i8080_aot_code(c, 0x36B9, "\xF1\xC9", 2)) {
+      goto i_0x36B9;
+    }
+    break;
+  case 0x36BA:
+    if (i8080_aot_code(c, 0x36BA, "\xC9", 1)) {
+      goto i_0x36BA;
+    }
+    break;
+  case 0x36BB: goto b_0x36BB;
+  case 0x36BC:
+    if (i8080_aot_code(c, 0x36BC, "\xC9", 1)) {
+      goto i_0x36BC;
+    }
+    break;
+  case 0x36BD: goto b_0x36BD;
+  case 0x36C0: goto b_0x36C0;
+  case 0x36C2:
+    if (i8080_aot_code(c, 0x36C2, "\x43\x50\x55\x20\x46\x41\x49\x4C\x45\x44\x3A\x20\x00\xF5\x3E\x01\x32\x73\x3B", 19)) {
+      goto i_0x36C2;
+    }
+    break;
+  case 0x36C7:
+    if (i8080_aot_code(c, 0x36C7, "\x41\x49\x4C\x45\x44\x3A\x20\x00\xF5\x3E\x01\x32\x73\x3B", 14)) {
+      goto i_0x36C7;
+    }
+    break;
+  case 0x36CF:
+    if (i8080_aot_code(c, 0x36CF, "\xF5\x3E\x01\x32\x73\x3B", 6)) {
+      goto i_0x36CF;
+    }
+    break;
+  case 0x36D0:
+    if (i8080_aot_code(c, 0x36D0, "\x3E\x01\x32\x73\x3B", 5)) {
+      goto i_0x36D0;
+    }
+    break;
+  case 0x36D5: goto b_0x36D5;
+  case 0x36D6:
+    if (i8080_aot_code(c, 0x36D6, "\x2A\x71\x3B\x23\x22\x71\x3B\xCD\x45\x3A", 10)) {
+      goto i_0x36D6;
+    }
+    break;
+  case 0x36D9:
+    if (i8080_aot_code(c, 0x36D9, "\x23\x22\x71\x3B\xCD\x45\x3A", 7)) {
+      goto i_0x36D9;
+    }
+    break;
+  case 0x36DD:
+    if (i8080_aot_code(c, 0x36DD, "\xCD\x45\x3A", 3)) {
+      goto i_0x36DD;
+    }
+    break;
+  case 0x36E0: goto b_0x36E0;
+  case 0x36E2:
+    if (i8080_aot_code(c, 0x36E2, "\x45\x52\x52\x4F\x52\x20\x43\x4F\x55\x4E\x54\x20\x00\xCD\x82\x3A", 16)) {
+      goto i_0x36E2;
+    }
+    break;
+  case 0x36EC:
+    if (i8080_aot_code(c, 0x36EC, "\x54\x20\x00\xCD\x82\x3A", 6)) {
+      goto i_0x36EC;
+    }
+    break;
+  case 0x36F2: goto b_0x36F2;
+  case 0x36F5: goto b_0x36F5;
+  case 0x36F8:
+    if (i8080_aot_code(c, 0x36F8, "\x00\x2A\x75\x3B\xF5\xCD\x14\x38", 8)) {
+      goto i_0x36F8;
+    }
+    break;
+  case 0x36FC:
+    if (i8080_aot_code(c, 0x36FC, "\xF5\xCD\x14\x38", 4)) {
+      goto i_0x36FC;
+    }
+    break;
+  case 0x36FD:
+    if (i8080_aot_code(c, 0x36FD, "\xCD\x14\x38", 3)) {
+      goto i_0x36FD;
+    }
+    break;
+  case 0x3700: goto b_0x3700;
+  case 0x3703: goto b_0x3703;
+  case 0x3706: goto b_0x3706;
+  case 0x3708:
+    if (i8080_aot_code(c, 0x3708, "\x49\x4E\x53\x54\x52\x55\x43\x54\x49\x4F\x4E\x20\x53\x45", 14)) {
+      goto i_0x3708;
+    }
+    break;
+  case 0x370A:
+    if (i8080_aot_code(c, 0x370A, "\x53\x54\x52\x55\x43\x54\x49\x4F\x4E\x20\x53\x45", 12)) {
+      goto i_0x370A;
+    }
+    break;
+  case 0x3713:
+    if (i8080_aot_code(c, 0x3713, "\x20\x53\x45", 3)) {
+      goto i_0x3713;
+    }
+    break;
+  case 0x3716: goto b_0x3716;
+  case 0x371A:
+    if (i8080_aot_code(c, 0x371A, "\x43\x45\x20\x57\x41\x53\x20\x00\xCD\x1A\x36", 11)) {
+      goto i_0x371A;
+    }
+    break;
+  case 0x3725: goto b_0x3725;
+  case 0x3728: goto b_0x3728;
+  case 0x372B:
+    if (i8080_aot_code(c, 0x372B, "\x52\x45\x47\x49\x53\x54\x45\x52\x20\x00\x3A\x4D\x35\xCD\x2D\x36", 16)) {
+      goto i_0x372B;
+    }
+    break;
+  case 0x3738:
+    if (i8080_aot_code(c, 0x3738, "\xCD\x2D\x36", 3)) {
+      goto i_0x3738;
+    }
+    break;
+  case 0x373B: goto b_0x373B;
+  case 0x373C:
+    if (i8080_aot_code(c, 0x373C, "\xF5\xCD\x45\x3A", 4)) {
+      goto i_0x373C;
+    }
+    break;
+  case 0x373D:
+    if (i8080_aot_code(c, 0x373D, "\xCD\x45\x3A", 3)) {
+      goto i_0x373D;
+    }
+    break;
+  case 0x3740: goto b_0x3740;
+  case 0x3744:
+    if (i8080_aot_code(c, 0x3744, "\x54\x41\x49\x4E\x53\x20\x00\xD5\x3A\x4C\x35\xCD\x8D\x3A", 14)) {
+      goto i_0x3744;
+    }
+    break;
+  case 0x3748:
+    if (i8080_aot_code(c, 0x3748, "\x53\x20\x00\xD5\x3A\x4C\x35\xCD\x8D\x3A", 10)) {
+      goto i_0x3748;
+    }
+    break;
+  case 0x374C:
+    if (i8080_aot_code(c, 0x374C, "\x3A\x4C\x35\xCD\x8D\x3A", 6)) {
+      goto i_0x374C;
+    }
+    break;
+  case 0x374F:
+    if (i8080_aot_code(c, 0x374F, "\xCD\x8D\x3A", 3)) {
+      goto i_0x374F;
+    }
+    break;
+  case 0x3752: goto b_0x3752;
+  case 0x3755: goto b_0x3755;
+  case 0x3757:
+    if (i8080_aot_code(c, 0x3757, "\x42\x55\x54\x20\x53\x48\x4F\x55\x4C\x44\x20\x43\x4F\x4E", 14)) {
+      goto i_0x3757;
+    }
+    break;
+  case 0x3765: goto b_0x3765;
+  case 0x3769:
+    if (i8080_aot_code(c, 0x3769, "\x20\x00\x2B\x7E\x23\xCD\x8D\x3A", 8)) {
+      goto i_0x3769;
+    }
+    break;
+  case 0x376D:
+    if (i8080_aot_code(c, 0x376D, "\x23\xCD\x8D\x3A", 4)) {
+      goto i_0x376D;
+    }
+    break;
+  case 0x3771: goto b_0x3771;
+  case 0x3774: goto b_0x3774;
+  case 0x3776:
+    if (i8080_aot_code(c, 0x3776, "\x52\x45\x47\x49\x53\x54\x45\x52\x20\x56\x41\x4C\x55\x45", 14)) {
+      goto i_0x3776;
+    }
+    break;
+  case 0x3780:
+    if (i8080_aot_code(c, 0x3780, "\x41\x4C\x55\x45", 4)) {
+      goto i_0x3780;
+    }
+    break;
+  case 0x3784: goto b_0x3784;
+  case 0x3788:
+    if (i8080_aot_code(c, 0x3788, "\x4F\x52\x45\x20\x49\x4E\x53\x54\x52\x55\x43\x54", 12)) {
+      goto i_0x3788;
+    }
+    break;
+  case 0x378E:
+    if (i8080_aot_code(c, 0x378E, "\x53\x54\x52\x55\x43\x54", 6)) {
+      goto i_0x378E;
+    }
+    break;
+  case 0x3794: goto b_0x3794;
+  case 0x3797:
+    if (i8080_aot_code(c, 0x3797, "\x20\x53\x45\x51\x55\x45\x4E\x43\x45\x20\x57\x41\x53", 13)) {
+      goto i_0x3797;
+    }
+    break;
+  case 0x379E:
+    if (i8080_aot_code(c, 0x379E, "\x43\x45\x20\x57\x41\x53", 6)) {
+      goto i_0x379E;
+    }
+    break;
+  case 0x37A4: goto b_0x37A4;
+  case 0x37A9:
+    if (i8080_aot_code(c, 0x37A9, "\xCD\x8D\x3A", 3)) {
+      goto i_0x37A9;
+    }
+    break;
+  case 0x37AC: goto b_0x37AC;
+  case 0x37AD:
+    if (i8080_aot_code(c, 0x37AD, "\xCD\x45\x3A", 3)) {
+      goto i_0x37AD;
+    }
+    break;
+  case 0x37B0: goto b_0x37B0;
+  case 0x37B2:
+    if (i8080_aot_code(c, 0x37B2, "\x54\x45\x53\x54\x20\x4E\x55\x4D\x42\x45\x52\x20\x00\xD5", 14)) {
+      goto i_0x37B2;
+    }
+    break;
+  case 0x37B8:
+    if (i8080_aot_code(c, 0x37B8, "\x55\x4D\x42\x45\x52\x20\x00\xD5", 8)) {
+      goto i_0x37B8;
+    }
+    break;
+  case 0x37C0: goto b_0x37C0;
+  case 0x37C5:
+    if (i8080_aot_code(c, 0x37C5, "\xCD\x63\x3B", 3)) {
+      goto i_0x37C5;
+    }
+    break;
+  case 0x37C8: goto b_0x37C8;
+  case 0x37CB: goto b_0x37CB;
+  case 0x37CE: goto b_0x37CE;
+  case 0x37D1:
+    if (i8080_aot_code(c, 0x37D1, "\x0A\x00\xCD\x22\x3B", 5)) {
+      goto i_0x37D1;
+    }
+    break;
+  case 0x37D2:
+    if (i8080_aot_code(c, 0x37D2, "\x00\xCD\x22\x3B", 4)) {
+      goto i_0x37D2;
+    }
+    break;
+  case 0x37D6: goto b_0x37D6;
+  case 0x37D7:
+    if (i8080_aot_code(c, 0x37D7, "\xC9", 1)) {
+      goto i_0x37D7;
+    }
+    break;
+  case 0x37F5: goto b_0x37F5;
+  case 0x37F6:
+    if (i8080_aot_code(c, 0x37F6, "\x3A\x6B\x3B\xB7\xCA\x04\x38", 7)) {
+      goto i_0x37F6;
+    }
+    break;
+  case 0x37F9:
+    if (i8080_aot_code(c, 0x37F9, "\xB7\xCA\x04\x38", 4)) {
+      goto i_0x37F9;
+    }
+    break;
+  case 0x37FD: goto b_0x37FD;
+  case 0x37FE: goto b_0x37FE;
+  case 0x37FF:
+    if (i8080_aot_code(c, 0x37FF, "\x23", 1) &&
+      i8080_aot_code(c, 0x3800, "\x23\x23\xE3\xC9", 4)) {
+      goto i_0x37FF;
+    }
+    break;
+  case 0x3803:
+    if (i8080_aot_code(c, 0x3803, "\xC9", 1)) {
+      goto i_0x3803;
+    }
+    break;
+  case 0x3804: goto b_0x3804;
+  case 0x3805:
+    if (i8080_aot_code(c, 0x3805, "\xC9", 1)) {
+      goto i_0x3805;
+    }
+    break;
+  case 0x3806: goto b_0x3806;
+  case 0x3809: goto b_0x3809;
+  case 0x380D: goto b_0x380D;
+  case 0x3810: goto b_0x3810;
+  case 0x3814: goto b_0x3814;
+  case 0x3815:
+    if (i8080_aot_code(c, 0x3815, "\x3A\x6F\x3B\xFE\x01\xCA\x04\x38", 8)) {
+      goto i_0x3815;
+    }
+    break;
+  case 0x3818:
+    if (i8080_aot_code(c, 0x3818, "\xFE\x01\xCA\x04\x38", 5)) {
+      goto i_0x3818;
+    }
+    break;
+  case 0x381D: goto b_0x381D;
+  case 0x381E:
+    if (i8080_aot_code(c, 0x381E, "\xC3\xFE\x37", 3)) {
+      goto i_0x381E;
+    }
+    break;
+  case 0x3831: goto b_0x3831;
+  case 0x3834:
+    if (i8080_aot_code(c, 0x3834, "\xE1\xE3\xE5\xF5\x2A\xB3\x38\x2B\x70\x2B\x71\x2B\x72\x2B\x73\xD1\x2B", 17)) {
+      goto i_0x3834;
+    }
+    break;
+  case 0x3835:
+    if (i8080_aot_code(c, 0x3835, "\xE3\xE5\xF5\x2A\xB3\x38\x2B\x70\x2B\x71\x2B\x72\x2B\x73\xD1\x2B", 16)) {
+      goto i_0x3835;
+    }
+    break;
+  case 0x3836:
+    if (i8080_aot_code(c, 0x3836, "\xE5\xF5\x2A\xB3\x38\x2B\x70\x2B\x71\x2B\x72\x2B\x73\xD1\x2B", 15)) {
+      goto i_0x3836;
+    }
+    break;
+  case 0x3837:
+    if (i8080_aot_code(c, 0x3837, "\xF5\x2A\xB3\x38\x2B\x70\x2B\x71\x2B\x72\x2B\x73\xD1\x2B", 14)) {
+      goto i_0x3837;
+    }
+    break;
+  case 0x3838:
+    if (i8080_aot_code(c, 0x3838, "\x2A\xB3\x38\x2B\x70\x2B\x71\x2B\x72\x2B\x73\xD1\x2B", 13)) {
+      goto i_0x3838;
+    }
+    break;
+  case 0x383B:
+    if (i8080_aot_code(c, 0x383B, "\x2B\x70\x2B\x71\x2B\x72\x2B\x73\xD1\x2B", 10)) {
+      goto i_0x383B;
+    }
+    break;
+  case 0x383D:
+    if (i8080_aot_code(c, 0x383D, "\x2B\x71\x2B\x72\x2B\x73\xD1\x2B", 8)) {
+      goto i_0x383D;
+    }
+    break;
+  case 0x383F:
+    if (i8080_aot_code(c, 0x383F, "\x2B\x72\x2B\x73\xD1\x2B", 6)) {
+      goto i_0x383F;
+    }
+    break;
+  case 0x3841:
+    if (i8080_aot_code(c, 0x3841, "\x2B\x73\xD1\x2B", 4)) {
+      goto i_0x3841;
+    }
+    break;
+  case 0x3843:
+    if (i8080_aot_code(c, 0x3843, "\xD1\x2B", 2)) {
+      goto i_0x3843;
+    }
+    break;
+  case 0x3844:
+    if (i8080_aot_code(c, 0x3844, "\x2B", 1)) {
+      goto i_0x3844;
+    }
+    break;
+  case 0x3845: goto b_0x3845;
+  case 0x3846:
+    if (i8080_aot_code(c, 0x3846, "\x2B\x73\xEB\xE3\xEB\x2B\x72\x2B\x73\xEB\xE3\xEB\xE3\xCD\x33\x39", 16)) {
+      goto i_0x3846;
+    }
+    break;
+  case 0x3848:
+    if (i8080_aot_code(c, 0x3848, "\xEB\xE3\xEB\x2B\x72\x2B\x73\xEB\xE3\xEB\xE3\xCD\x33\x39", 14)) {
+      goto i_0x3848;
+    }
+    break;
+  case 0x384A:
+    if (i8080_aot_code(c, 0x384A, "\xEB\x2B\x72\x2B\x73\xEB\xE3\xEB\xE3\xCD\x33\x39", 12)) {
+      goto i_0x384A;
+    }
+    break;
+  case 0x384D:
+    if (i8080_aot_code(c, 0x384D, "\x2B\x73\xEB\xE3\xEB\xE3\xCD\x33\x39", 9)) {
+      goto i_0x384D;
+    }
+    break;
+  case 0x384F:
+    if (i8080_aot_code(c, 0x384F, "\xEB\xE3\xEB\xE3\xCD\x33\x39", 7)) {
+      goto i_0x384F;
+    }
+    break;
+  case 0x3851:
+    if (i8080_aot_code(c, 0x3851, "\xEB\xE3\xCD\x33\x39", 5)) {
+      goto i_0x3851;
+    }
+    break;
+  case 0x3853:
+    if (i8080_aot_code(c, 0x3853, "\xCD\x33\x39", 3)) {
+      goto i_0x3853;
+    }
+    break;
+  case 0x3856: goto b_0x3856;
+  case 0x38B7: goto b_0x38B7;
+  case 0x38B9:
+    if (i8080_aot_code(c, 0x38B9, "\x2B\x4E\x2B\x56\x2B\x5E\xD5\x2B\x56\x2B\x5E\xD5\xF1\x2B", 14)) {
+      goto i_0x38B9;
+    }
+    break;
+  case 0x38BB:
+    if (i8080_aot_code(c, 0x38BB, "\x2B\x56\x2B\x5E\xD5\x2B\x56\x2B\x5E\xD5\xF1\x2B", 12)) {
+      goto i_0x38BB;
+    }
+    break;
+  case 0x38BD:
+    if (i8080_aot_code(c, 0x38BD, "\x2B\x5E\xD5\x2B\x56\x2B\x5E\xD5\xF1\x2B", 10)) {
+      goto i_0x38BD;
+    }
+    break;
+  case 0x38BF:
+    if (i8080_aot_code(c, 0x38BF, "\xD5\x2B\x56\x2B\x5E\xD5\xF1\x2B", 8)) {
+      goto i_0x38BF;
+    }
+    break;
+  case 0x38C0:
+    if (i8080_aot_code(c, 0x38C0, "\x2B\x56\x2B\x5E\xD5\xF1\x2B", 7)) {
+      goto i_0x38C0;
+    }
+    break;
+  case 0x38C2:
+    if (i8080_aot_code(c, 0x38C2, "\x2B\x5E\xD5\xF1\x2B", 5)) {
+      goto i_0x38C2;
+    }
+    break;
+  case 0x38C4:
+    if (i8080_aot_code(c, 0x38C4, "\xD5\xF1\x2B", 3)) {
+      goto i_0x38C4;
+    }
+    break;
+  case 0x38C5:
+    if (i8080_aot_code(c, 0x38C5, "\xF1\x2B", 2)) {
+      goto i_0x38C5;
+    }
+    break;
+  case 0x38C6:
+    if (i8080_aot_code(c, 0x38C6, "\x2B", 1)) {
+      goto i_0x38C6;
+    }
+    break;
+  case 0x38C7: goto b_0x38C7;
+  case 0x38C8:
+    if (i8080_aot_code(c, 0x38C8, "\x2B\x5E\xE3\xEB\xCD\x28\x39", 7)) {
+      goto i_0x38C8;
+    }
+    break;
+  case 0x38CA:
+    if (i8080_aot_code(c, 0x38CA, "\xE3\xEB\xCD\x28\x39", 5)) {
+      goto i_0x38CA;
+    }
+    break;
+  case 0x38CB:
+    if (i8080_aot_code(c, 0x38CB, "\xEB\xCD\x28\x39", 4)) {
+      goto i_0x38CB;
+    }
+    break;
+  case 0x38CF: goto b_0x38CF;
+  case 0x38D4: goto b_0x38D4;
+  case 0x3928: goto b_0x3928;
+  case 0x3929:
+    if (i8080_aot_code(c, 0x3929, "\x3A\x69\x3B\xB7\xCA\x04\x38", 7)) {
+      goto i_0x3929;
+    }
+    break;
+  case 0x392C:
+    if (i8080_aot_code(c, 0x392C, "\xB7\xCA\x04\x38", 4)) {
+      goto i_0x392C;
+    }
+    break;
+  case 0x3930: goto b_0x3930;
+  case 0x3933: goto b_0x3933;
+  case 0x3934:
+    if (i8080_aot_code(c, 0x3934, "\x3A\x69\x3B\xB7\xC2\x04\x38", 7)) {
+      goto i_0x3934;
+    }
+    break;
+  case 0x3937:
+    if (i8080_aot_code(c, 0x3937, "\xB7\xC2\x04\x38", 4)) {
+      goto i_0x3937;
+    }
+    break;
+  case 0x393B: goto b_0x393B;
+  case 0x393C:
+    if (i8080_aot_code(c, 0x393C, "\xE3\x23\x23\xE3\xC9", 5)) {
+      goto i_0x393C;
+    }
+    break;
+  case 0x393D:
+    if (i8080_aot_code(c, 0x393D, "\x23\x23\xE3\xC9", 4)) {
+      goto i_0x393D;
+    }
+    break;
+  case 0x3940:
+    if (i8080_aot_code(c, 0x3940, "\xC9", 1)) {
+      goto i_0x3940;
+    }
+    break;
+  case 0x3941: goto b_0x3941;
+  case 0x3947:
+    if (i8080_aot_code(c, 0x3947, "\xCD\x4B\x39", 3)) {
+      goto i_0x3947;
+    }
+    break;
+  case 0x394A: goto b_0x394A;
+  case 0x394B: goto b_0x394B;
+  case 0x394C:
+    if (i8080_aot_code(c, 0x394C, "\x7C\x2F\x47\x7D\x2F\x4F\x03\xAF", 8)) {
+      goto i_0x394C;
+    }
+    break;
+  case 0x3954: goto b_0x3954;
+  case 0x3957:
+    if (i8080_aot_code(c, 0x3957, "\x09\x13\xD2\x54\x39", 5)) {
+      goto i_0x3957;
+    }
+    break;
+  case 0x395C: goto b_0x395C;
+  case 0x395D:
+    if (i8080_aot_code(c, 0x395D, "\xC9", 1)) {
+      goto i_0x395D;
+    }
+    break;
+  case 0x395E: goto b_0x395E;
+  case 0x3961: goto b_0x3961;
+  case 0x3965: goto b_0x3965;
+  case 0x396A: goto b_0x396A;
+  case 0x3A05: goto b_0x3A05;
+  case 0x3A06:
+    if (i8080_aot_code(c, 0x3A06, "\xD5\xE5\xF5\x5F\xCD\xE1\x32", 7)) {
+      goto i_0x3A06;
+    }
+    break;
+  case 0x3A07:
+    if (i8080_aot_code(c, 0x3A07, "\xE5\xF5\x5F\xCD\xE1\x32", 6)) {
+      goto i_0x3A07;
+    }
+    break;
+  case 0x3A08:
+    if (i8080_aot_code(c, 0x3A08, "\xF5\x5F\xCD\xE1\x32", 5)) {
+      goto i_0x3A08;
+    }
+    break;
+  case 0x3A09:
+    if (i8080_aot_code(c, 0x3A09, "\x5F\xCD\xE1\x32", 4)) {
+      goto i_0x3A09;
+    }
+    break;
+  case 0x3A0D: goto b_0x3A0D;
+  case 0x3A0E:
+    if (i8080_aot_code(c, 0x3A0E, "\xE1\xD1\xC1\xC9", 4)) {
+      goto i_0x3A0E;
+    }
+    break;
+  case 0x3A0F:
+    if (i8080_aot_code(c, 0x3A0F, "\xD1\xC1\xC9", 3)) {
+      goto i_0x3A0F;
+    }
+    break;
+  case 0x3A10:
+    if (i8080_aot_code(c, 0x3A10, "\xC1\xC9", 2)) {
+      goto i_0x3A10;
+    }
+    break;
+  case 0x3A11:
+    if (i8080_aot_code(c, 0x3A11, "\xC9", 1)) {
+      goto i_0x3A11;
+    }
+    break;
+  case 0x3A12: goto b_0x3A12;
+  case 0x3A13:
+    if (i8080_aot_code(c, 0x3A13, "\xD5\xE5\x0E\x01\xCD\x05\x00", 7)) {
+      goto i_0x3A13;
+    }
+    break;
+  case 0x3A14:
+    if (i8080_aot_code(c, 0x3A14, "\xE5\x0E\x01\xCD\x05\x00", 6)) {
+      goto i_0x3A14;
+    }
+    break;
+  case 0x3A15:
+    if (i8080_aot_code(c, 0x3A15, "\x0E\x01\xCD\x05\x00", 5)) {
+      goto i_0x3A15;
+    }
+    break;
+  case 0x3A1A: goto b_0x3A1A;
+  case 0x3A1B:
+    if (i8080_aot_code(c, 0x3A1B, "\xD1\xC1\xC9", 3)) {
+      goto i_0x3A1B;
+    }
+    break;
+  case 0x3A1C:
+    if (i8080_aot_code(c, 0x3A1C, "\xC1\xC9", 2)) {
+      goto i_0x3A1C;
+    }
+    break;
+  case 0x3A1D:
+    if (i8080_aot_code(c, 0x3A1D, "\xC9", 1)) {
+      goto i_0x3A1D;
+    }
+    break;
+  case 0x3A45: goto b_0x3A45;
+  case 0x3A46:
+    if (i8080_aot_code(c, 0x3A46, "\xF5", 1)) {
+      goto i_0x3A46;
+    }
+    break;
+  case 0x3A47: goto b_0x3A47;
+  case 0x3A48:
+    if (i8080_aot_code(c, 0x3A48, "\x23\xB7\xC2\x50\x3A", 5)) {
+      goto i_0x3A48;
+    }
+    break;
+  case 0x3A4D: goto b_0x3A4D;
+  case 0x3A4E:
+    if (i8080_aot_code(c, 0x3A4E, "\xE3\xC9", 2)) {
+      goto i_0x3A4E;
+    }
+    break;
+  case 0x3A4F:
+    if (i8080_aot_code(c, 0x3A4F, "\xC9", 1)) {
+      goto i_0x3A4F;
+    }
+    break;
+  case 0x3A50: goto b_0x3A50;
+  case 0x3A53: goto b_0x3A53;
+  case 0x3A56: goto b_0x3A56;
+  case 0x3A57:
+    if (i8080_aot_code(c, 0x3A57, "\xE5\xD5\xE6\x0F\x21\x6A\x3A\x16\x00\x5F\x19\x7E\xCD\x05\x3A", 15)) {
+      goto i_0x3A57;
+    }
+    break;
+  case 0x3A58:
+    if (i8080_aot_code(c, 0x3A58, "\xD5\xE6\x0F\x21\x6A\x3A\x16\x00\x5F\x19\x7E\xCD\x05\x3A", 14)) {
+      goto i_0x3A58;
+    }
+    break;
+  case 0x3A59:
+    if (i8080_aot_code(c, 0x3A59, "\xE6\x0F\x21\x6A\x3A\x16\x00\x5F\x19\x7E\xCD\x05\x3A", 13)) {
+      goto i_0x3A59;
+    }
+    break;
+  case 0x3A63:
+    if (i8080_aot_code(c, 0x3A63, "\xCD\x05\x3A", 3)) {
+      goto i_0x3A63;
+    }
+    break;
+  case 0x3A66: goto b_0x3A66;
+  case 0x3A67:
+    if (i8080_aot_code(c, 0x3A67, "\xE1\xF1\xC9", 3)) {
+      goto i_0x3A67;
+    }
+    break;
+  case 0x3A68:
+    if (i8080_aot_code(c, 0x3A68, "\xF1\xC9", 2)) {
+      goto i_0x3A68;
+    }
+    break;
+  case 0x3A69:
+    if (i8080_aot_code(c, 0x3A69, "\xC9", 1)) {
+      goto i_0x3A69;
+    }
+    break;
+  case 0x3A7A: goto b_0x3A7A;
+  case 0x3A7B:
+    if (i8080_aot_code(c, 0x3A7B, "\x16\x00\x5F\x19\x7E\xD1\xC9", 7)) {
+      goto i_0x3A7B;
+    }
+    break;
+  case 0x3A80:
+    if (i8080_aot_code(c, 0x3A80, "\xD1\xC9", 2)) {
+      goto i_0x3A80;
+    }
+    break;
+  case 0x3A81:
+    if (i8080_aot_code(c, 0x3A81, "\xC9", 1)) {
+      goto i_0x3A81;
+    }
+    break;
+  case 0x3A82: goto b_0x3A82;
+  case 0x3A83:
+    if (i8080_aot_code(c, 0x3A83, "\x7C\xCD\x98\x3A", 4)) {
+      goto i_0x3A83;
+    }
+    break;
+  case 0x3A87: goto b_0x3A87;
+  case 0x3A8B: goto b_0x3A8B;
+  case 0x3A8C:
+    if (i8080_aot_code(c, 0x3A8C, "\xC9", 1)) {
+      goto i_0x3A8C;
+    }
+    break;
+  case 0x3A8D: goto b_0x3A8D;
+  case 0x3A8E:
+    if (i8080_aot_code(c, 0x3A8E, "\xCD\x98\x3A", 3)) {
+      goto i_0x3A8E;
+    }
+    break;
+  case 0x3A91: goto b_0x3A91;
+  case 0x3A96: goto b_0x3A96;
+  case 0x3A97:
+    if (i8080_aot_code(c, 0x3A97, "\xC9", 1)) {
+      goto i_0x3A97;
+    }
+    break;
+  case 0x3A98: goto b_0x3A98;
+  case 0x3A99:
+    if (i8080_aot_code(c, 0x3A99, "\x0F\x0F\x0F\x0F\xCD\x56\x3A", 7)) {
+      goto i_0x3A99;
+    }
+    break;
+  case 0x3AA0: goto b_0x3AA0;
+  case 0x3AA7: goto b_0x3AA7;
+  case 0x3AA8:
+    if (i8080_aot_code(c, 0x3AA8, "\xC9", 1)) {
+      goto i_0x3AA8;
+    }
+    break;
+  case 0x3AF5: goto b_0x3AF5;
+  case 0x3AF8:
+    if (i8080_aot_code(c, 0x3AF8, "\x3B\x60\x69\xCD\x82\x3A", 6)) {
+      goto i_0x3AF8;
+    }
+    break;
+  case 0x3AFE: goto b_0x3AFE;
+  case 0x3B01: goto b_0x3B01;
+  case 0x3B06: goto b_0x3B06;
+  case 0x3B09: goto b_0x3B09;
+  case 0x3B0C:
+    if (i8080_aot_code(c, 0x3B0C, "\xCD\x82\x3A", 3)) {
+      goto i_0x3B0C;
+    }
+    break;
+  case 0x3B0F: goto b_0x3B0F;
+  case 0x3B12: goto b_0x3B12;
+  case 0x3B19: goto b_0x3B19;
+  case 0x3B1A:
+    if (i8080_aot_code(c, 0x3B1A, "\x2A\x21\x3B\xCD\x5C\x3B", 6)) {
+      goto i_0x3B1A;
+    }
+    break;
+  case 0x3B1D:
+    if (i8080_aot_code(c, 0x3B1D, "\xCD\x5C\x3B", 3)) {
+      goto i_0x3B1D;
+    }
+    break;
+  case 0x3B20: goto b_0x3B20;
+  case 0x3B22: goto b_0x3B22;
+  case 0x3B25: goto b_0x3B25;
+  case 0x3B26: goto b_0x3B26;
+  case 0x3B28: goto b_0x3B28;
+  case 0x3B2B: goto b_0x3B2B;
+  case 0x3B30: goto b_0x3B30;
+  case 0x3B33: goto b_0x3B33;
+  case 0x3B36:
+    if (i8080_aot_code(c, 0x3B36, "\xF5\x2F\x3C\x32\x44\x3B\xF1\xFE\x03\xC2\x04\x38", 12)) {
+      goto i_0x3B36;
+    }
+    break;
+  case 0x3B37:
+    if (i8080_aot_code(c, 0x3B37, "\x2F\x3C\x32\x44\x3B\xF1\xFE\x03\xC2\x04\x38", 11)) {
+      goto i_0x3B37;
+    }
+    break;
+  case 0x3B3C:
+    if (i8080_aot_code(c, 0x3B3C, "\xF1\xFE\x03\xC2\x04\x38", 6)) {
+      goto i_0x3B3C;
+    }
+    break;
+  case 0x3B3D:
+    if (i8080_aot_code(c, 0x3B3D, "\xFE\x03\xC2\x04\x38", 5)) {
+      goto i_0x3B3D;
+    }
+    break;
+  case 0x3B42: goto b_0x3B42;
+  case 0x3B43: goto b_0x3B43;
+  case 0x3B45: goto b_0x3B45;
+  case 0x3B46:
+    if (i8080_aot_code(c, 0x3B46, "\x3A\x43\x3B\xFE\x53\xCA\x04\x38", 8)) {
+      goto i_0x3B46;
+    }
+    break;
+  case 0x3B49:
+    if (i8080_aot_code(c, 0x3B49, "\xFE\x53\xCA\x04\x38", 5)) {
+      goto i_0x3B49;
+    }
+    break;
+  case 0x3B47: goto b_0x3B47;
+  case 0x3B4E: goto b_0x3B4E;
+  case 0x3B51: goto b_0x3B51;
+  case 0x3B54:
+    if (i8080_aot_code(c, 0x3B54, "\xC9", 1)) {
+      goto i_0x3B54;
+    }
+    break;
+  case 0x3B5C: goto b_0x3B5C;
+  case 0x3B5F: goto b_0x3B5F;
+  case 0x3B61:
+    if (i8080_aot_code(c, 0x3B61, "\x00\xC9", 2)) {
+      goto i_0x3B61;
+    }
+    break;
+  case 0x3B63: goto b_0x3B63;
+  case 0x3B66: goto b_0x3B66;
+  }
+
+fallback:
+  // not recompiled, or modified since
+  n += i8080_aot_fallback(c);
+  goto dispatch;
+
+b_0x0100:
+  if (!(i8080_aot_code(c, 0x0100, "\x3E\x02\x3C\xEA\x00\x30", 6))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x0002); // mvi a,$02
+  n += 1;
+  i8080_aot_op_0x3C(c, 0x0000); // inr a
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x0106;
+  i8080_aot_op_0xEA(c, 0x3000); // jpe $3000
+  n += 1;
+  if (c->pc == 0x3000) {
+    JUMP(0x3000);
+  }
+  JUMP(0x0106);
+
+b_0x0106:
+  if (!(i8080_aot_code(c, 0x0106, "\xC3\x09\x01", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0109;
+  i8080_aot_op_0xC3(c, 0x0109); // jmp $0109
+  n += 1;
+  JUMP(0x0109);
+
+b_0x0109:
+  if (!(i8080_aot_code(c, 0x0109, "\xF3", 1))) {
+    goto fallback;
+  }
+  c->cyc += 4;
+  c->pc = 0x010A;
+  i8080_aot_op_0xF3(c, 0x0000); // di
+  n += 1;
+  JUMP(0x010A);
+
+b_0x010A:
+  if (!(i8080_aot_code(c, 0x010A, "\x31\xFF\x2F\xCD\x4F\x21", 6))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x31(c, 0x2FFF); // lxi sp,$2FFF
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x0110;
+  i8080_aot_op_0xCD(c, 0x214F); // call $214F
+  n += 1;
+  JUMP(0x214F);
+
+b_0x0110:
+  if (!(i8080_aot_code(c, 0x0110, "\xCD\x4E\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0113;
+  i8080_aot_op_0xCD(c, 0x0B4E); // call $0B4E
+  n += 1;
+  JUMP(0x0B4E);
+
+b_0x0113:
+  if (!(i8080_aot_code(c, 0x0113, "\x0D\x0A\x44\x49\x41\x47\x4E\x4F\x53\x54\x49\x43\x53\x20\x49\x49", 16))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x0115;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0115:
+  i8080_aot_op_0x44(c, 0x0000); // mov b,h
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  i8080_aot_op_0x41(c, 0x0000); // mov b,c
+  n += 1;
+  i8080_aot_op_0x47(c, 0x0000); // mov b,a
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x011A;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x011A:
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  c->cyc += 44;
+  c->pc = 0x0123;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  JUMP(0x0123);
+
+b_0x0123:
+  if (!(i8080_aot_code(c, 0x0123, "\x20\x56\x31\x2E\x32\x20\x2D\x20\x43\x50\x55\x20\x54\x45\x53\x54\x0D\x0A", 18))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  c->cyc += 11;
+  c->pc = 0x0125;
+  i8080_aot_op_0x56(c, 0x0000); // mov d,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0125:
+  i8080_aot_op_0x31(c, 0x322E); // lxi sp,$322E
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x2D(c, 0x0000); // dcr l
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  i8080_aot_op_0x50(c, 0x0000); // mov d,b
+  n += 1;
+  i8080_aot_op_0x55(c, 0x0000); // mov d,l
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  c->cyc += 74;
+  c->pc = 0x0135;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  JUMP(0x0135);
+
+b_0x0135:
+  if (!(i8080_aot_code(c, 0x0135, "\x43\x4F\x50\x59\x52\x49\x47\x48\x54\x20\x28\x43\x29\x20\x31\x39\x38\x31\x20\x2D", 20))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  i8080_aot_op_0x50(c, 0x0000); // mov d,b
+  n += 1;
+  i8080_aot_op_0x59(c, 0x0000); // mov e,c
+  n += 1;
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  i8080_aot_op_0x47(c, 0x0000); // mov b,a
+  n += 1;
+  i8080_aot_op_0x48(c, 0x0000); // mov c,b
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x28(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  i8080_aot_op_0x29(c, 0x0000); // dad h
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x31(c, 0x3839); // lxi sp,$3839
+  n += 1;
+  c->cyc += 92;
+  c->pc = 0x0149;
+  i8080_aot_op_0x31(c, 0x2D20); // lxi sp,$2D20
+  n += 1;
+  JUMP(0x0149);
+
+b_0x0149:
+  if (!(i8080_aot_code(c, 0x0149, "\x20\x53\x55\x50\x45\x52\x53\x4F\x46\x54\x20\x41\x53\x53\x4F\x43", 16))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x55(c, 0x0000); // mov d,l
+  n += 1;
+  i8080_aot_op_0x50(c, 0x0000); // mov d,b
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  c->cyc += 46;
+  c->pc = 0x0152;
+  i8080_aot_op_0x46(c, 0x0000); // mov b,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0152:
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x41(c, 0x0000); // mov b,c
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  c->cyc += 34;
+  c->pc = 0x0159;
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  JUMP(0x0159);
+
+b_0x0159:
+  if (!(i8080_aot_code(c, 0x0159, "\x49\x41\x54\x45\x53\x0D\x0A\x0A\x00\xC3\x6D\x01", 12))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  i8080_aot_op_0x41(c, 0x0000); // mov b,c
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  c->cyc += 37;
+  c->pc = 0x0160;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0160:
+  c->cyc += 7;
+  c->pc = 0x0161;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0161:
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x0165;
+  i8080_aot_op_0xC3(c, 0x016D); // jmp $016D
+  n += 1;
+  JUMP(0x016D);
+
+b_0x016D:
+  if (!(i8080_aot_code(c, 0x016D, "\xCD\x0F\x09", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0170;
+  i8080_aot_op_0xCD(c, 0x090F); // call $090F
+  n += 1;
+  JUMP(0x090F);
+
+b_0x0170:
+  if (!(i8080_aot_code(c, 0x0170, "\xC3\x8D\x01", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0173;
+  i8080_aot_op_0xC3(c, 0x018D); // jmp $018D
+  n += 1;
+  JUMP(0x018D);
+
+b_0x018D:
+  if (!(i8080_aot_code(c, 0x018D, "\x1E\x41\x0E\x02\xCD\x05\x00", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x1E(c, 0x0041); // mvi e,$41
+  n += 1;
+  i8080_aot_op_0x0E(c, 0x0002); // mvi c,$02
+  n += 1;
+  c->cyc += 31;
+  c->pc = 0x0194;
+  i8080_aot_op_0xCD(c, 0x0005); // call $0005
+  n += 1;
+  goto dispatch;
+
+b_0x0194:
+  if (!(i8080_aot_code(c, 0x0194, "\x1E\x42\xCD\xE6\x03", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x1E(c, 0x0042); // mvi e,$42
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x0199;
+  i8080_aot_op_0xCD(c, 0x03E6); // call $03E6
+  n += 1;
+  JUMP(0x03E6);
+
+b_0x0199:
+  if (!(i8080_aot_code(c, 0x0199, "\x1E\x43\xCD\xEA\x03", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x1E(c, 0x0043); // mvi e,$43
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x019E;
+  i8080_aot_op_0xCD(c, 0x03EA); // call $03EA
+  n += 1;
+  JUMP(0x03EA);
+
+b_0x019E:
+  if (!(i8080_aot_code(c, 0x019E, "\x3A\x75\x0C\xB7\xC2\xAB\x01", 7))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x01A1;
+  i8080_aot_op_0x3A(c, 0x0C75); // lda $0C75
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x01A1:
+  i8080_aot_op_0xB7(c, 0x0000); // ora a
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x01A5;
+  i8080_aot_op_0xC2(c, 0x01AB); // jnz $01AB
+  n += 1;
+  if (c->pc == 0x01AB) {
+    JUMP(0x01AB);
+  }
+  JUMP(0x01A5);
+
+b_0x01A5:
+  if (!(i8080_aot_code(c, 0x01A5, "\xCD\x67\x0A", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x01A8;
+  i8080_aot_op_0xCD(c, 0x0A67); // call $0A67
+  n += 1;
+  JUMP(0x0A67);
+
+b_0x01A8:
+  if (!(i8080_aot_code(c, 0x01A8, "\xC3\xB0\x01", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x01AB;
+  i8080_aot_op_0xC3(c, 0x01B0); // jmp $01B0
+  n += 1;
+  JUMP(0x01B0);
+
+b_0x01AB:
+  if (!(i8080_aot_code(c, 0x01AB, "\xCD\x4E\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x01AE;
+  i8080_aot_op_0xCD(c, 0x0B4E); // call $0B4E
+  n += 1;
+  JUMP(0x0B4E);
+
+b_0x01AE:
+  if (!(i8080_aot_code(c, 0x01AE, "\x44\x00", 2))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x44(c, 0x0000); // mov b,h
+  n += 1;
+  c->cyc += 9;
+  c->pc = 0x01B0;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  JUMP(0x01B0);
+
+b_0x01B0:
+  if (!(i8080_aot_code(c, 0x01B0, "\x3E\x45\x0E\x16", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x0045); // mvi a,$45
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x01B4;
+  i8080_aot_op_0x0E(c, 0x0016); // mvi c,$16
+  n += 1;
+  JUMP(0x01B4);
+
+b_0x01B4:
+  if (!(i8080_aot_code(c, 0x01B4, "\xCD\x0E\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x01B7;
+  i8080_aot_op_0xCD(c, 0x0B0E); // call $0B0E
+  n += 1;
+  JUMP(0x0B0E);
+
+b_0x01B7:
+  if (!(i8080_aot_code(c, 0x01B7, "\x3C\x0D\xC2\xB4\x01", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3C(c, 0x0000); // inr a
+  n += 1;
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  c->cyc += 20;
+  c->pc = 0x01BC;
+  i8080_aot_op_0xC2(c, 0x01B4); // jnz $01B4
+  n += 1;
+  if (c->pc == 0x01B4) {
+    JUMP(0x01B4);
+  }
+  JUMP(0x01BC);
+
+b_0x01BC:
+  if (!(i8080_aot_code(c, 0x01BC, "\xC3\xCA\x01", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x01BF;
+  i8080_aot_op_0xC3(c, 0x01CA); // jmp $01CA
+  n += 1;
+  JUMP(0x01CA);
+
+b_0x01CA:
+  if (!(i8080_aot_code(c, 0x01CA, "\x3E\x02\x3C\xEA\xD5\x01", 6))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x0002); // mvi a,$02
+  n += 1;
+  i8080_aot_op_0x3C(c, 0x0000); // inr a
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x01D0;
+  i8080_aot_op_0xEA(c, 0x01D5); // jpe $01D5
+  n += 1;
+  if (c->pc == 0x01D5) {
+    JUMP(0x01D5);
+  }
+  JUMP(0x01D0);
+
+b_0x01D0:
+  if (!(i8080_aot_code(c, 0x01D0, "\x3E\x01\xC3\xD6\x01", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x0001); // mvi a,$01
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x01D5;
+  i8080_aot_op_0xC3(c, 0x01D6); // jmp $01D6
+  n += 1;
+  JUMP(0x01D6);
+
+b_0x01D5:
+  if (!(i8080_aot_code(c, 0x01D5, "\xAF", 1))) {
+    goto fallback;
+  }
+  c->cyc += 4;
+  c->pc = 0x01D6;
+  i8080_aot_op_0xAF(c, 0x0000); // xra a
+  n += 1;
+  JUMP(0x01D6);
+
+b_0x01D6:
+  if (!(i8080_aot_code(c, 0x01D6, "\x32\x72\x0C\xCD\x0F\x09", 6))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x01D9;
+  i8080_aot_op_0x32(c, 0x0C72); // sta $0C72
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x01D9:
+  c->cyc += 17;
+  c->pc = 0x01DC;
+  i8080_aot_op_0xCD(c, 0x090F); // call $090F
+  n += 1;
+  JUMP(0x090F);
+
+b_0x01DC:
+  if (!(i8080_aot_code(c, 0x01DC, "\xC3\x2B\x02", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x01DF;
+  i8080_aot_op_0xC3(c, 0x022B); // jmp $022B
+  n += 1;
+  JUMP(0x022B);
+
+b_0x022B:
+  if (!(i8080_aot_code(c, 0x022B, "\xCD\xFE\x08", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x022E;
+  i8080_aot_op_0xCD(c, 0x08FE); // call $08FE
+  n += 1;
+  JUMP(0x08FE);
+
+b_0x022E:
+  if (!(i8080_aot_code(c, 0x022E, "\xC3\x38\x02", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0231;
+  i8080_aot_op_0xC3(c, 0x0238); // jmp $0238
+  n += 1;
+  JUMP(0x0238);
+
+b_0x0238:
+  if (!(i8080_aot_code(c, 0x0238, "\xCD\x4E\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x023B;
+  i8080_aot_op_0xCD(c, 0x0B4E); // call $0B4E
+  n += 1;
+  JUMP(0x0B4E);
+
+b_0x023B:
+  if (!(i8080_aot_code(c, 0x023B, "\x0D\x0A\x43\x50\x55\x20\x49\x53\x20\x00\x3A\x72\x0C\xB7\xCA\x80\x02", 17))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x023D;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x023D:
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  i8080_aot_op_0x50(c, 0x0000); // mov d,b
+  n += 1;
+  i8080_aot_op_0x55(c, 0x0000); // mov d,l
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 50;
+  c->pc = 0x0248;
+  i8080_aot_op_0x3A(c, 0x0C72); // lda $0C72
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0248:
+  i8080_aot_op_0xB7(c, 0x0000); // ora a
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x024C;
+  i8080_aot_op_0xCA(c, 0x0280); // jz $0280
+  n += 1;
+  if (c->pc == 0x0280) {
+    JUMP(0x0280);
+  }
+  JUMP(0x024C);
+
+b_0x024C:
+  if (!(i8080_aot_code(c, 0x024C, "\xCD\x4E\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x024F;
+  i8080_aot_op_0xCD(c, 0x0B4E); // call $0B4E
+  n += 1;
+  JUMP(0x0B4E);
+
+b_0x024F:
+  if (!(i8080_aot_code(c, 0x024F, "\x5A\x38\x30\x00\x3A\x73\x0C\xB7\xC2\x8D\x02", 11))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x5A(c, 0x0000); // mov e,d
+  n += 1;
+  i8080_aot_op_0x38(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x30(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 30;
+  c->pc = 0x0256;
+  i8080_aot_op_0x3A(c, 0x0C73); // lda $0C73
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0256:
+  i8080_aot_op_0xB7(c, 0x0000); // ora a
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x025A;
+  i8080_aot_op_0xC2(c, 0x028D); // jnz $028D
+  n += 1;
+  if (c->pc == 0x028D) {
+    JUMP(0x028D);
+  }
+  JUMP(0x025A);
+
+b_0x025A:
+  if (!(i8080_aot_code(c, 0x025A, "\xCD\x4E\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x025D;
+  i8080_aot_op_0xCD(c, 0x0B4E); // call $0B4E
+  n += 1;
+  JUMP(0x0B4E);
+
+b_0x025D:
+  if (!(i8080_aot_code(c, 0x025D, "\x20\x28\x52\x45\x46\x52\x45\x53\x48\x20\x52\x45\x47\x49\x53\x54", 16))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x28(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  c->cyc += 25;
+  c->pc = 0x0262;
+  i8080_aot_op_0x46(c, 0x0000); // mov b,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0262:
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x48(c, 0x0000); // mov c,b
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x47(c, 0x0000); // mov b,a
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  c->cyc += 54;
+  c->pc = 0x026D;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  JUMP(0x026D);
+
+b_0x026D:
+  if (!(i8080_aot_code(c, 0x026D, "\x45\x52\x20\x4E\x4F\x54\x20\x43\x48\x45\x43\x4B\x45\x44\x29\x00", 16))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  c->cyc += 21;
+  c->pc = 0x0271;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0271:
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  i8080_aot_op_0x48(c, 0x0000); // mov c,b
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  i8080_aot_op_0x4B(c, 0x0000); // mov c,e
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x44(c, 0x0000); // mov b,h
+  n += 1;
+  i8080_aot_op_0x29(c, 0x0000); // dad h
+  n += 1;
+  c->cyc += 63;
+  c->pc = 0x027D;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  JUMP(0x027D);
+
+b_0x027D:
+  if (!(i8080_aot_code(c, 0x027D, "\xC3\x8D\x02", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0280;
+  i8080_aot_op_0xC3(c, 0x028D); // jmp $028D
+  n += 1;
+  JUMP(0x028D);
+
+b_0x0280:
+  if (!(i8080_aot_code(c, 0x0280, "\xCD\x4E\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0283;
+  i8080_aot_op_0xCD(c, 0x0B4E); // call $0B4E
+  n += 1;
+  JUMP(0x0B4E);
+
+b_0x0283:
+  if (!(i8080_aot_code(c, 0x0283, "\x38\x30\x38\x30\x2F\x38\x30\x38\x35\x00", 10))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x38(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x30(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x38(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x30(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x2F(c, 0x0000); // cma
+  n += 1;
+  i8080_aot_op_0x38(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x30(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x38(c, 0x0000); // ill
+  n += 1;
+  c->cyc += 42;
+  c->pc = 0x028C;
+  i8080_aot_op_0x35(c, 0x0000); // dcr M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x028C) < 1) {
+    goto dispatch;
+  }
+i_0x028C:
+  c->cyc += 4;
+  c->pc = 0x028D;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  JUMP(0x028D);
+
+b_0x028D:
+  if (!(i8080_aot_code(c, 0x028D, "\xAF\x01\x01\x00\xCD\x4E\x0B", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xAF(c, 0x0000); // xra a
+  n += 1;
+  i8080_aot_op_0x01(c, 0x0001); // lxi b,$0001
+  n += 1;
+  c->cyc += 31;
+  c->pc = 0x0294;
+  i8080_aot_op_0xCD(c, 0x0B4E); // call $0B4E
+  n += 1;
+  JUMP(0x0B4E);
+
+b_0x0294:
+  if (!(i8080_aot_code(c, 0x0294, "\x0D\x0A\x42\x45\x47\x49\x4E\x20\x54\x49\x4D\x49\x4E\x47\x20\x54", 16))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x0296;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0296:
+  i8080_aot_op_0x42(c, 0x0000); // mov b,d
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x47(c, 0x0000); // mov b,a
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x029B;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x029B:
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  i8080_aot_op_0x4D(c, 0x0000); // mov c,l
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  c->cyc += 31;
+  c->pc = 0x02A1;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x02A1:
+  i8080_aot_op_0x47(c, 0x0000); // mov b,a
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x02A4;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  JUMP(0x02A4);
+
+b_0x02A4:
+  if (!(i8080_aot_code(c, 0x02A4, "\x45\x53\x54\x0D\x0A\x00\xCD\x4E\x0C", 9))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x02A9;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x02A9:
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 21;
+  c->pc = 0x02AD;
+  i8080_aot_op_0xCD(c, 0x0C4E); // call $0C4E
+  n += 1;
+  JUMP(0x0C4E);
+
+b_0x02AD:
+  if (!(i8080_aot_code(c, 0x02AD, "\xCD\xFE\x08", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x02B0;
+  i8080_aot_op_0xCD(c, 0x08FE); // call $08FE
+  n += 1;
+  JUMP(0x08FE);
+
+b_0x02B0:
+  if (!(i8080_aot_code(c, 0x02B0, "\xC3\xC5\x02", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x02B3;
+  i8080_aot_op_0xC3(c, 0x02C5); // jmp $02C5
+  n += 1;
+  JUMP(0x02C5);
+
+b_0x02C5:
+  if (!(i8080_aot_code(c, 0x02C5, "\xCD\x4E\x0C", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x02C8;
+  i8080_aot_op_0xCD(c, 0x0C4E); // call $0C4E
+  n += 1;
+  JUMP(0x0C4E);
+
+b_0x02C8:
+  if (!(i8080_aot_code(c, 0x02C8, "\xCD\x4E\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x02CB;
+  i8080_aot_op_0xCD(c, 0x0B4E); // call $0B4E
+  n += 1;
+  JUMP(0x0B4E);
+
+b_0x02CB:
+  if (!(i8080_aot_code(c, 0x02CB, "\x45\x4E\x44\x20\x54\x49\x4D\x49\x4E\x47\x20\x54\x45\x53\x54\x0D", 16))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x02CD;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x02CD:
+  i8080_aot_op_0x44(c, 0x0000); // mov b,h
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  i8080_aot_op_0x4D(c, 0x0000); // mov c,l
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  c->cyc += 36;
+  c->pc = 0x02D4;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x02D4:
+  i8080_aot_op_0x47(c, 0x0000); // mov b,a
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  c->cyc += 34;
+  c->pc = 0x02DB;
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  JUMP(0x02DB);
+
+b_0x02DB:
+  if (!(i8080_aot_code(c, 0x02DB, "\x0A\x00\xCD\xF0\x03", 5))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x02DC;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x02DC:
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 21;
+  c->pc = 0x02E0;
+  i8080_aot_op_0xCD(c, 0x03F0); // call $03F0
+  n += 1;
+  JUMP(0x03F0);
+
+b_0x02E0:
+  if (!(i8080_aot_code(c, 0x02E0, "\xCD\x1D\x09", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x02E3;
+  i8080_aot_op_0xCD(c, 0x091D); // call $091D
+  n += 1;
+  JUMP(0x091D);
+
+b_0x02E3:
+  if (!(i8080_aot_code(c, 0x02E3, "\xC3\xEC\x02", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x02E6;
+  i8080_aot_op_0xC3(c, 0x02EC); // jmp $02EC
+  n += 1;
+  JUMP(0x02EC);
+
+b_0x02EC:
+  if (!(i8080_aot_code(c, 0x02EC, "\xCD\x4E\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x02EF;
+  i8080_aot_op_0xCD(c, 0x0B4E); // call $0B4E
+  n += 1;
+  JUMP(0x0B4E);
+
+b_0x02EF:
+  if (!(i8080_aot_code(c, 0x02EF, "\x54\x41\x42\x4C\x45\x20\x45\x4E\x44\x20\x00\x2A\x7E\x0C\xCD\x8B\x0B", 17))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x41(c, 0x0000); // mov b,c
+  n += 1;
+  i8080_aot_op_0x42(c, 0x0000); // mov b,d
+  n += 1;
+  i8080_aot_op_0x4C(c, 0x0000); // mov c,h
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  c->cyc += 41;
+  c->pc = 0x02F7;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x02F7:
+  i8080_aot_op_0x44(c, 0x0000); // mov b,h
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 29;
+  c->pc = 0x02FD;
+  i8080_aot_op_0x2A(c, 0x0C7E); // lhld $0C7E
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x02FD:
+  c->cyc += 17;
+  c->pc = 0x0300;
+  i8080_aot_op_0xCD(c, 0x0B8B); // call $0B8B
+  n += 1;
+  JUMP(0x0B8B);
+
+b_0x0300:
+  if (!(i8080_aot_code(c, 0x0300, "\xCD\x4E\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0303;
+  i8080_aot_op_0xCD(c, 0x0B4E); // call $0B4E
+  n += 1;
+  JUMP(0x0B4E);
+
+b_0x0303:
+  if (!(i8080_aot_code(c, 0x0303, "\x0D\x0A\x54\x41\x42\x4C\x45\x20\x53\x49\x5A\x45\x20\x00\x11\x84\xF3\x19", 18))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x0305;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0305:
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x41(c, 0x0000); // mov b,c
+  n += 1;
+  i8080_aot_op_0x42(c, 0x0000); // mov b,d
+  n += 1;
+  i8080_aot_op_0x4C(c, 0x0000); // mov c,h
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  i8080_aot_op_0x5A(c, 0x0000); // mov e,d
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  i8080_aot_op_0x11(c, 0xF384); // lxi d,$F384
+  n += 1;
+  c->cyc += 77;
+  c->pc = 0x0315;
+  i8080_aot_op_0x19(c, 0x0000); // dad d
+  n += 1;
+  JUMP(0x0315);
+
+b_0x0315:
+  if (!(i8080_aot_code(c, 0x0315, "\xCD\x8B\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0318;
+  i8080_aot_op_0xCD(c, 0x0B8B); // call $0B8B
+  n += 1;
+  JUMP(0x0B8B);
+
+b_0x0318:
+  if (!(i8080_aot_code(c, 0x0318, "\xCD\x65\x0C", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x031B;
+  i8080_aot_op_0xCD(c, 0x0C65); // call $0C65
+  n += 1;
+  JUMP(0x0C65);
+
+b_0x031B:
+  if (!(i8080_aot_code(c, 0x031B, "\xC3\x2A\x03", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x031E;
+  i8080_aot_op_0xC3(c, 0x032A); // jmp $032A
+  n += 1;
+  JUMP(0x032A);
+
+b_0x032A:
+  if (!(i8080_aot_code(c, 0x032A, "\xCD\x67\x0A", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x032D;
+  i8080_aot_op_0xCD(c, 0x0A67); // call $0A67
+  n += 1;
+  JUMP(0x0A67);
+
+b_0x032D:
+  if (!(i8080_aot_code(c, 0x032D, "\x3A\x74\x0C\x21\x75\x0C\x86\x57\x3E\x01\xCD\xFE\x08", 13))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x0330;
+  i8080_aot_op_0x3A(c, 0x0C74); // lda $0C74
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0330:
+  i8080_aot_op_0x21(c, 0x0C75); // lxi h,$0C75
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0334;
+  i8080_aot_op_0x86(c, 0x0000); // add M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0334:
+  i8080_aot_op_0x57(c, 0x0000); // mov d,a
+  n += 1;
+  i8080_aot_op_0x3E(c, 0x0001); // mvi a,$01
+  n += 1;
+  c->cyc += 29;
+  c->pc = 0x033A;
+  i8080_aot_op_0xCD(c, 0x08FE); // call $08FE
+  n += 1;
+  JUMP(0x08FE);
+
+b_0x033A:
+  if (!(i8080_aot_code(c, 0x033A, "\x32\x75\x0C\x32\x74\x0C\x3A\x74\x0C\x21\x75\x0C\x86\x92\x57\x3A\x79\x0C\x92\x32\x79\x0C\xCD\x65\x0C", 25))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x033D;
+  i8080_aot_op_0x32(c, 0x0C75); // sta $0C75
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x033D:
+  c->cyc += 13;
+  c->pc = 0x0340;
+  i8080_aot_op_0x32(c, 0x0C74); // sta $0C74
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0340:
+  c->cyc += 13;
+  c->pc = 0x0343;
+  i8080_aot_op_0x3A(c, 0x0C74); // lda $0C74
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0343:
+  i8080_aot_op_0x21(c, 0x0C75); // lxi h,$0C75
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0347;
+  i8080_aot_op_0x86(c, 0x0000); // add M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0347:
+  i8080_aot_op_0x92(c, 0x0000); // sub d
+  n += 1;
+  i8080_aot_op_0x57(c, 0x0000); // mov d,a
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x034C;
+  i8080_aot_op_0x3A(c, 0x0C79); // lda $0C79
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x034C:
+  i8080_aot_op_0x92(c, 0x0000); // sub d
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0350;
+  i8080_aot_op_0x32(c, 0x0C79); // sta $0C79
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0350:
+  c->cyc += 17;
+  c->pc = 0x0353;
+  i8080_aot_op_0xCD(c, 0x0C65); // call $0C65
+  n += 1;
+  JUMP(0x0C65);
+
+b_0x0353:
+  if (!(i8080_aot_code(c, 0x0353, "\xC3\x09\x01", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0356;
+  i8080_aot_op_0xC3(c, 0x0109); // jmp $0109
+  n += 1;
+  JUMP(0x0109);
+
+b_0x038A:
+  if (!(i8080_aot_code(c, 0x038A, "\xF5\xCD\x1D\x09", 4))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x038B;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x038A) < 4) {
+    goto dispatch;
+  }
+i_0x038B:
+  c->cyc += 17;
+  c->pc = 0x038E;
+  i8080_aot_op_0xCD(c, 0x091D); // call $091D
+  n += 1;
+  JUMP(0x091D);
+
+b_0x038E:
+  if (!(i8080_aot_code(c, 0x038E, "\xC3\x97\x03", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0391;
+  i8080_aot_op_0xC3(c, 0x0397); // jmp $0397
+  n += 1;
+  JUMP(0x0397);
+
+b_0x0397:
+  if (!(i8080_aot_code(c, 0x0397, "\xF1\xF5\xD5\x57\x3A\x79\x0C\x92\x32\x79\x0C\xD1\xF1\xF5\xCD\x4E\x0B", 17))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0398;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0398:
+  c->cyc += 11;
+  c->pc = 0x0399;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0398) < 16) {
+    goto dispatch;
+  }
+i_0x0399:
+  c->cyc += 11;
+  c->pc = 0x039A;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0399) < 15) {
+    goto dispatch;
+  }
+i_0x039A:
+  i8080_aot_op_0x57(c, 0x0000); // mov d,a
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x039E;
+  i8080_aot_op_0x3A(c, 0x0C79); // lda $0C79
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x039E:
+  i8080_aot_op_0x92(c, 0x0000); // sub d
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x03A2;
+  i8080_aot_op_0x32(c, 0x0C79); // sta $0C79
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x03A2:
+  c->cyc += 10;
+  c->pc = 0x03A3;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x03A3:
+  c->cyc += 10;
+  c->pc = 0x03A4;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x03A4:
+  c->cyc += 11;
+  c->pc = 0x03A5;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x03A4) < 4) {
+    goto dispatch;
+  }
+i_0x03A5:
+  c->cyc += 17;
+  c->pc = 0x03A8;
+  i8080_aot_op_0xCD(c, 0x0B4E); // call $0B4E
+  n += 1;
+  JUMP(0x0B4E);
+
+b_0x03A8:
+  if (!(i8080_aot_code(c, 0x03A8, "\x3C\x00\xCD\xA1\x0B", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3C(c, 0x0000); // inr a
+  n += 1;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 26;
+  c->pc = 0x03AD;
+  i8080_aot_op_0xCD(c, 0x0BA1); // call $0BA1
+  n += 1;
+  JUMP(0x0BA1);
+
+b_0x03AD:
+  if (!(i8080_aot_code(c, 0x03AD, "\xCD\x4E\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x03B0;
+  i8080_aot_op_0xCD(c, 0x0B4E); // call $0B4E
+  n += 1;
+  JUMP(0x0B4E);
+
+b_0x03B0:
+  if (!(i8080_aot_code(c, 0x03B0, "\x3E\x00\xCD\x2B\x0C", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x0000); // mvi a,$00
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x03B5;
+  i8080_aot_op_0xCD(c, 0x0C2B); // call $0C2B
+  n += 1;
+  JUMP(0x0C2B);
+
+b_0x03B5:
+  if (!(i8080_aot_code(c, 0x03B5, "\xF1\xC9", 2))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x03B6;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x03B6:
+  c->cyc += 10;
+  c->pc = 0x03B7;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x03E6:
+  if (!(i8080_aot_code(c, 0x03E6, "\xCD\xEA\x03", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x03E9;
+  i8080_aot_op_0xCD(c, 0x03EA); // call $03EA
+  n += 1;
+  JUMP(0x03EA);
+
+b_0x03E9:
+  if (!(i8080_aot_code(c, 0x03E9, "\xC9", 1))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x03EA;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x03EA:
+  if (!(i8080_aot_code(c, 0x03EA, "\x0E\x02\xCD\xBD\x20", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x0E(c, 0x0002); // mvi c,$02
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x03EF;
+  i8080_aot_op_0xCD(c, 0x20BD); // call $20BD
+  n += 1;
+  JUMP(0x20BD);
+
+b_0x03EF:
+  if (!(i8080_aot_code(c, 0x03EF, "\xC9", 1))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x03F0;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x03F0:
+  if (!(i8080_aot_code(c, 0x03F0, "\x21\x0E\x0B\xCD\xC0\x09", 6))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x21(c, 0x0B0E); // lxi h,$0B0E
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x03F6;
+  i8080_aot_op_0xCD(c, 0x09C0); // call $09C0
+  n += 1;
+  JUMP(0x09C0);
+
+b_0x03F6:
+  if (!(i8080_aot_code(c, 0x03F6, "\xCD\x23\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x03F9;
+  i8080_aot_op_0xCD(c, 0x0623); // call $0623
+  n += 1;
+  JUMP(0x0623);
+
+b_0x03F9:
+  if (!(i8080_aot_code(c, 0x03F9, "\x21\x80\x0C\x22\x7E\x0C\x3E", 7) &&
+      i8080_aot_code(c, 0x0400, "\x00\x32\x47\x04\x32\x48\x04\x21\x61\x04\x16\x01", 12))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x21(c, 0x0C80); // lxi h,$0C80
+  n += 1;
+  c->cyc += 26;
+  c->pc = 0x03FF;
+  i8080_aot_op_0x22(c, 0x0C7E); // shld $0C7E
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x03FF:
+  i8080_aot_op_0x3E(c, 0x0000); // mvi a,$00
+  n += 1;
+  c->cyc += 20;
+  c->pc = 0x0404;
+  i8080_aot_op_0x32(c, 0x0447); // sta $0447
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0404:
+  c->cyc += 13;
+  c->pc = 0x0407;
+  i8080_aot_op_0x32(c, 0x0448); // sta $0448
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0407:
+  i8080_aot_op_0x21(c, 0x0461); // lxi h,$0461
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x040C;
+  i8080_aot_op_0x16(c, 0x0001); // mvi d,$01
+  n += 1;
+  JUMP(0x040C);
+
+b_0x040C:
+  if (!(i8080_aot_code(c, 0x040C, "\x7E\x23\xFE\x00\xC2\x24\x04", 7))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x040D;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x040D:
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x0000); // cpi $00
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x0413;
+  i8080_aot_op_0xC2(c, 0x0424); // jnz $0424
+  n += 1;
+  if (c->pc == 0x0424) {
+    JUMP(0x0424);
+  }
+  JUMP(0x0413);
+
+b_0x0413:
+  if (!(i8080_aot_code(c, 0x0413, "\xCD\x16\x09", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0416;
+  i8080_aot_op_0xCD(c, 0x0916); // call $0916
+  n += 1;
+  JUMP(0x0916);
+
+b_0x0416:
+  if (!(i8080_aot_code(c, 0x0416, "\xCD\xFE\x08", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0419;
+  i8080_aot_op_0xCD(c, 0x08FE); // call $08FE
+  n += 1;
+  JUMP(0x08FE);
+
+b_0x0419:
+  if (!(i8080_aot_code(c, 0x0419, "\xCD\x65\x0C", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x041C;
+  i8080_aot_op_0xCD(c, 0x0C65); // call $0C65
+  n += 1;
+  JUMP(0x0C65);
+
+b_0x041C:
+  if (!(i8080_aot_code(c, 0x041C, "\x14\x7A\xFE\x04\xFA\x0C\x04", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x14(c, 0x0000); // inr d
+  n += 1;
+  i8080_aot_op_0x7A(c, 0x0000); // mov a,d
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x0004); // cpi $04
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x0423;
+  i8080_aot_op_0xFA(c, 0x040C); // jm $040C
+  n += 1;
+  if (c->pc == 0x040C) {
+    JUMP(0x040C);
+  }
+  JUMP(0x0423);
+
+b_0x0423:
+  if (!(i8080_aot_code(c, 0x0423, "\xC9", 1))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0424;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x0424:
+  if (!(i8080_aot_code(c, 0x0424, "\x32\x46\x04\x7A\xFE\x02\xFA\x3D\x04", 9))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x0427;
+  i8080_aot_op_0x32(c, 0x0446); // sta $0446
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0427:
+  i8080_aot_op_0x7A(c, 0x0000); // mov a,d
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x0002); // cpi $02
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x042D;
+  i8080_aot_op_0xFA(c, 0x043D); // jm $043D
+  n += 1;
+  if (c->pc == 0x043D) {
+    JUMP(0x043D);
+  }
+  JUMP(0x042D);
+
+b_0x042D:
+  if (!(i8080_aot_code(c, 0x042D, "\x7E\x23\x32\x47\x04\x7A\xFE\x03\xFA\x3D\x04", 11))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x042E;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x042E:
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x0432;
+  i8080_aot_op_0x32(c, 0x0447); // sta $0447
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0432:
+  i8080_aot_op_0x7A(c, 0x0000); // mov a,d
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x0003); // cpi $03
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x0438;
+  i8080_aot_op_0xFA(c, 0x043D); // jm $043D
+  n += 1;
+  if (c->pc == 0x043D) {
+    JUMP(0x043D);
+  }
+  JUMP(0x0438);
+
+b_0x0438:
+  if (!(i8080_aot_code(c, 0x0438, "\x7E\x23\x32\x48\x04", 5))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x0439;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0439:
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x043D;
+  i8080_aot_op_0x32(c, 0x0448); // sta $0448
+  n += 1;
+  JUMP(0x043D);
+
+b_0x043D:
+  if (!(i8080_aot_code(c, 0x043D, "\xD5\xE5\xF5\x21\xAA\x0A\xCD\xC0\x09", 9))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x043E;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x043D) < 9) {
+    goto dispatch;
+  }
+i_0x043E:
+  c->cyc += 11;
+  c->pc = 0x043F;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x043E) < 8) {
+    goto dispatch;
+  }
+i_0x043F:
+  c->cyc += 11;
+  c->pc = 0x0440;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x043F) < 7) {
+    goto dispatch;
+  }
+i_0x0440:
+  i8080_aot_op_0x21(c, 0x0AAA); // lxi h,$0AAA
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x0446;
+  i8080_aot_op_0xCD(c, 0x09C0); // call $09C0
+  n += 1;
+  JUMP(0x09C0);
+
+b_0x0446:
+  if (!(i8080_aot_code(c, 0x0446, "\xE4\x5F\x04", 3))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0449;
+  i8080_aot_op_0xE4(c, 0x045F); // cpo $045F
+  n += 1;
+  if (c->pc == 0x045F) {
+    JUMP(0x045F);
+  }
+  JUMP(0x0449);
+
+b_0x0449:
+  if (!(i8080_aot_code(c, 0x0449, "\xCD\x2B\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x044C;
+  i8080_aot_op_0xCD(c, 0x062B); // call $062B
+  n += 1;
+  JUMP(0x062B);
+
+b_0x044C:
+  if (!(i8080_aot_code(c, 0x044C, "\x21\xDC\x0A\xCD\xC0\x09", 6))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x21(c, 0x0ADC); // lxi h,$0ADC
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x0452;
+  i8080_aot_op_0xCD(c, 0x09C0); // call $09C0
+  n += 1;
+  JUMP(0x09C0);
+
+b_0x0452:
+  if (!(i8080_aot_code(c, 0x0452, "\xCD\x23\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0455;
+  i8080_aot_op_0xCD(c, 0x0623); // call $0623
+  n += 1;
+  JUMP(0x0623);
+
+b_0x0455:
+  if (!(i8080_aot_code(c, 0x0455, "\xF1\xE1\xD1\xC3\x0C\x04", 6))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0456;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0456:
+  c->cyc += 10;
+  c->pc = 0x0457;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0457:
+  c->cyc += 10;
+  c->pc = 0x0458;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0458:
+  c->cyc += 10;
+  c->pc = 0x045B;
+  i8080_aot_op_0xC3(c, 0x040C); // jmp $040C
+  n += 1;
+  JUMP(0x040C);
+
+b_0x045F:
+  if (!(i8080_aot_code(c, 0x045F, "\x03\xC9", 2))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x03(c, 0x0000); // inx b
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x0461;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x0623:
+  if (!(i8080_aot_code(c, 0x0623, "\xE5\x21\xAA\x0A\xCD\x3A\x09", 7))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0624;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0623) < 7) {
+    goto dispatch;
+  }
+i_0x0624:
+  i8080_aot_op_0x21(c, 0x0AAA); // lxi h,$0AAA
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x062A;
+  i8080_aot_op_0xCD(c, 0x093A); // call $093A
+  n += 1;
+  JUMP(0x093A);
+
+b_0x062A:
+  if (!(i8080_aot_code(c, 0x062A, "\xC9", 1))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x062B;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x062B:
+  if (!(i8080_aot_code(c, 0x062B, "\xE5\x21\xDC\x0A\xCD\x3A\x09", 7))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x062C;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x062B) < 7) {
+    goto dispatch;
+  }
+i_0x062C:
+  i8080_aot_op_0x21(c, 0x0ADC); // lxi h,$0ADC
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x0632;
+  i8080_aot_op_0xCD(c, 0x093A); // call $093A
+  n += 1;
+  JUMP(0x093A);
+
+b_0x0632:
+  if (!(i8080_aot_code(c, 0x0632, "\xE5\xD5\xF5\x21\xAA\x0A\x11\xDC\x0A\xCD\x16\x09", 12))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0633;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0632) < 12) {
+    goto dispatch;
+  }
+i_0x0633:
+  c->cyc += 11;
+  c->pc = 0x0634;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0633) < 11) {
+    goto dispatch;
+  }
+i_0x0634:
+  c->cyc += 11;
+  c->pc = 0x0635;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0634) < 10) {
+    goto dispatch;
+  }
+i_0x0635:
+  i8080_aot_op_0x21(c, 0x0AAA); // lxi h,$0AAA
+  n += 1;
+  i8080_aot_op_0x11(c, 0x0ADC); // lxi d,$0ADC
+  n += 1;
+  c->cyc += 37;
+  c->pc = 0x063E;
+  i8080_aot_op_0xCD(c, 0x0916); // call $0916
+  n += 1;
+  JUMP(0x0916);
+
+b_0x063E:
+  if (!(i8080_aot_code(c, 0x063E, "\xCD\xFE\x08", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0641;
+  i8080_aot_op_0xCD(c, 0x08FE); // call $08FE
+  n += 1;
+  JUMP(0x08FE);
+
+b_0x0641:
+  if (!(i8080_aot_code(c, 0x0641, "\xCD\x23\x07", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0644;
+  i8080_aot_op_0xCD(c, 0x0723); // call $0723
+  n += 1;
+  JUMP(0x0723);
+
+b_0x0644:
+  if (!(i8080_aot_code(c, 0x0644, "\xCD\x16\x09", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0647;
+  i8080_aot_op_0xCD(c, 0x0916); // call $0916
+  n += 1;
+  JUMP(0x0916);
+
+b_0x0647:
+  if (!(i8080_aot_code(c, 0x0647, "\xCD\xFE\x08", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x064A;
+  i8080_aot_op_0xCD(c, 0x08FE); // call $08FE
+  n += 1;
+  JUMP(0x08FE);
+
+b_0x064A:
+  if (!(i8080_aot_code(c, 0x064A, "\xCD\x6C\x0C", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x064D;
+  i8080_aot_op_0xCD(c, 0x0C6C); // call $0C6C
+  n += 1;
+  JUMP(0x0C6C);
+
+b_0x064D:
+  if (!(i8080_aot_code(c, 0x064D, "\xCD\x75\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0650;
+  i8080_aot_op_0xCD(c, 0x0675); // call $0675
+  n += 1;
+  JUMP(0x0675);
+
+b_0x0650:
+  if (!(i8080_aot_code(c, 0x0650, "\xF1\xD1\xE1\xC9", 4))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0651;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0651:
+  c->cyc += 10;
+  c->pc = 0x0652;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0652:
+  c->cyc += 10;
+  c->pc = 0x0653;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0653:
+  c->cyc += 10;
+  c->pc = 0x0654;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x0675:
+  if (!(i8080_aot_code(c, 0x0675, "\xC5\x0E\xFF", 3))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0676;
+  i8080_aot_op_0xC5(c, 0x0000); // push b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0675) < 3) {
+    goto dispatch;
+  }
+i_0x0676:
+  c->cyc += 7;
+  c->pc = 0x0678;
+  i8080_aot_op_0x0E(c, 0x00FF); // mvi c,$FF
+  n += 1;
+  JUMP(0x0678);
+
+b_0x0678:
+  if (!(i8080_aot_code(c, 0x0678, "\xE5\x2A\x7E\x0C\x22\x58\x06\xE1\xAF\x32\x7C\x0C\x0C\x79\xFE\x19\xF2\xD4\x06", 19))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0679;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0678) < 19) {
+    goto dispatch;
+  }
+i_0x0679:
+  c->cyc += 16;
+  c->pc = 0x067C;
+  i8080_aot_op_0x2A(c, 0x0C7E); // lhld $0C7E
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x067C:
+  c->cyc += 16;
+  c->pc = 0x067F;
+  i8080_aot_op_0x22(c, 0x0658); // shld $0658
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x067F:
+  c->cyc += 10;
+  c->pc = 0x0680;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0680:
+  i8080_aot_op_0xAF(c, 0x0000); // xra a
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0684;
+  i8080_aot_op_0x32(c, 0x0C7C); // sta $0C7C
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0684:
+  i8080_aot_op_0x0C(c, 0x0000); // inr c
+  n += 1;
+  i8080_aot_op_0x79(c, 0x0000); // mov a,c
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x0019); // cpi $19
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x068B;
+  i8080_aot_op_0xF2(c, 0x06D4); // jp $06D4
+  n += 1;
+  if (c->pc == 0x06D4) {
+    JUMP(0x06D4);
+  }
+  JUMP(0x068B);
+
+b_0x068B:
+  if (!(i8080_aot_code(c, 0x068B, "\x2B\x7E\x32\x54\x06\xEB\x2B\x46\xF5\x78\x32\x55\x06\xF1\xEB\xB8\xCA\x78\x06", 19))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x068D;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x068D:
+  c->cyc += 13;
+  c->pc = 0x0690;
+  i8080_aot_op_0x32(c, 0x0654); // sta $0654
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0690:
+  i8080_aot_op_0xEB(c, 0x0000); // xchg
+  n += 1;
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  c->cyc += 16;
+  c->pc = 0x0693;
+  i8080_aot_op_0x46(c, 0x0000); // mov b,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0693:
+  c->cyc += 11;
+  c->pc = 0x0694;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0693) < 11) {
+    goto dispatch;
+  }
+i_0x0694:
+  i8080_aot_op_0x78(c, 0x0000); // mov a,b
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x0698;
+  i8080_aot_op_0x32(c, 0x0655); // sta $0655
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0698:
+  c->cyc += 10;
+  c->pc = 0x0699;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0699:
+  i8080_aot_op_0xEB(c, 0x0000); // xchg
+  n += 1;
+  i8080_aot_op_0xB8(c, 0x0000); // cmp b
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x069E;
+  i8080_aot_op_0xCA(c, 0x0678); // jz $0678
+  n += 1;
+  if (c->pc == 0x0678) {
+    JUMP(0x0678);
+  }
+  JUMP(0x069E);
+
+b_0x069E:
+  if (!(i8080_aot_code(c, 0x069E, "\x3A\x72\x0C\xB7\xC2\xAB\x06", 7))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x06A1;
+  i8080_aot_op_0x3A(c, 0x0C72); // lda $0C72
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x06A1:
+  i8080_aot_op_0xB7(c, 0x0000); // ora a
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x06A5;
+  i8080_aot_op_0xC2(c, 0x06AB); // jnz $06AB
+  n += 1;
+  if (c->pc == 0x06AB) {
+    JUMP(0x06AB);
+  }
+  JUMP(0x06A5);
+
+b_0x06A5:
+  if (!(i8080_aot_code(c, 0x06A5, "\x79\xFE\x08\xF2\xE9\x06", 6))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x79(c, 0x0000); // mov a,c
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x0008); // cpi $08
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x06AB;
+  i8080_aot_op_0xF2(c, 0x06E9); // jp $06E9
+  n += 1;
+  if (c->pc == 0x06E9) {
+    JUMP(0x06E9);
+  }
+  JUMP(0x06AB);
+
+b_0x06AB:
+  if (!(i8080_aot_code(c, 0x06AB, "\x79\xFE\x17\xF2\xE9\x06", 6))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x79(c, 0x0000); // mov a,c
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x0017); // cpi $17
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x06B1;
+  i8080_aot_op_0xF2(c, 0x06E9); // jp $06E9
+  n += 1;
+  if (c->pc == 0x06E9) {
+    JUMP(0x06E9);
+  }
+  JUMP(0x06B1);
+
+b_0x06B1:
+  if (!(i8080_aot_code(c, 0x06B1, "\x79\x32\x56\x06\xCD\x9D\x07", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x79(c, 0x0000); // mov a,c
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x06B5;
+  i8080_aot_op_0x32(c, 0x0656); // sta $0656
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x06B5:
+  c->cyc += 17;
+  c->pc = 0x06B8;
+  i8080_aot_op_0xCD(c, 0x079D); // call $079D
+  n += 1;
+  JUMP(0x079D);
+
+b_0x06B8:
+  if (!(i8080_aot_code(c, 0x06B8, "\xCD\x16\x09", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x06BB;
+  i8080_aot_op_0xCD(c, 0x0916); // call $0916
+  n += 1;
+  JUMP(0x0916);
+
+b_0x06BB:
+  if (!(i8080_aot_code(c, 0x06BB, "\xCD\xFE\x08", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x06BE;
+  i8080_aot_op_0xCD(c, 0x08FE); // call $08FE
+  n += 1;
+  JUMP(0x08FE);
+
+b_0x06BE:
+  if (!(i8080_aot_code(c, 0x06BE, "\xCD\x53\x07", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x06C1;
+  i8080_aot_op_0xCD(c, 0x0753); // call $0753
+  n += 1;
+  JUMP(0x0753);
+
+b_0x06C1:
+  if (!(i8080_aot_code(c, 0x06C1, "\x3A\x55\x06\xCD\x9D\x07", 6))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x06C4;
+  i8080_aot_op_0x3A(c, 0x0655); // lda $0655
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x06C4:
+  c->cyc += 17;
+  c->pc = 0x06C7;
+  i8080_aot_op_0xCD(c, 0x079D); // call $079D
+  n += 1;
+  JUMP(0x079D);
+
+b_0x06C7:
+  if (!(i8080_aot_code(c, 0x06C7, "\x3A\x7C\x0C\xB7\xCD\x0F\x09", 7))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x06CA;
+  i8080_aot_op_0x3A(c, 0x0C7C); // lda $0C7C
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x06CA:
+  i8080_aot_op_0xB7(c, 0x0000); // ora a
+  n += 1;
+  c->cyc += 21;
+  c->pc = 0x06CE;
+  i8080_aot_op_0xCD(c, 0x090F); // call $090F
+  n += 1;
+  JUMP(0x090F);
+
+b_0x06CE:
+  if (!(i8080_aot_code(c, 0x06CE, "\xC4\xC6\x07", 3))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x06D1;
+  i8080_aot_op_0xC4(c, 0x07C6); // cnz $07C6
+  n += 1;
+  if (c->pc == 0x07C6) {
+    JUMP(0x07C6);
+  }
+  JUMP(0x06D1);
+
+b_0x06D1:
+  if (!(i8080_aot_code(c, 0x06D1, "\xC3\x78\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x06D4;
+  i8080_aot_op_0xC3(c, 0x0678); // jmp $0678
+  n += 1;
+  JUMP(0x0678);
+
+b_0x06D4:
+  if (!(i8080_aot_code(c, 0x06D4, "\x3E\x58\xCD\x9D\x07", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x0058); // mvi a,$58
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x06D9;
+  i8080_aot_op_0xCD(c, 0x079D); // call $079D
+  n += 1;
+  JUMP(0x079D);
+
+b_0x06D9:
+  if (!(i8080_aot_code(c, 0x06D9, "\x3E\x59\xCD\x9D\x07", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x0059); // mvi a,$59
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x06DE;
+  i8080_aot_op_0xCD(c, 0x079D); // call $079D
+  n += 1;
+  JUMP(0x079D);
+
+b_0x06DE:
+  if (!(i8080_aot_code(c, 0x06DE, "\xC1\xCD\x16\x09", 4))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x06DF;
+  i8080_aot_op_0xC1(c, 0x0000); // pop b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x06DF:
+  c->cyc += 17;
+  c->pc = 0x06E2;
+  i8080_aot_op_0xCD(c, 0x0916); // call $0916
+  n += 1;
+  JUMP(0x0916);
+
+b_0x06E2:
+  if (!(i8080_aot_code(c, 0x06E2, "\xCD\xFE\x08", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x06E5;
+  i8080_aot_op_0xCD(c, 0x08FE); // call $08FE
+  n += 1;
+  JUMP(0x08FE);
+
+b_0x06E5:
+  if (!(i8080_aot_code(c, 0x06E5, "\xCD\x65\x0C", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x06E8;
+  i8080_aot_op_0xCD(c, 0x0C65); // call $0C65
+  n += 1;
+  JUMP(0x0C65);
+
+b_0x06E8:
+  if (!(i8080_aot_code(c, 0x06E8, "\xC9", 1))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x06E9;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x06E9:
+  if (!(i8080_aot_code(c, 0x06E9, "\xCD\xFE\x08", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x06EC;
+  i8080_aot_op_0xCD(c, 0x08FE); // call $08FE
+  n += 1;
+  JUMP(0x08FE);
+
+b_0x06EC:
+  if (!(i8080_aot_code(c, 0x06EC, "\xC3\xD4\x06", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x06EF;
+  i8080_aot_op_0xC3(c, 0x06D4); // jmp $06D4
+  n += 1;
+  JUMP(0x06D4);
+
+b_0x0723:
+  if (!(i8080_aot_code(c, 0x0723, "\x3A\x46\x04\xCD\xA1\x0B", 6))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x0726;
+  i8080_aot_op_0x3A(c, 0x0446); // lda $0446
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0726:
+  c->cyc += 17;
+  c->pc = 0x0729;
+  i8080_aot_op_0xCD(c, 0x0BA1); // call $0BA1
+  n += 1;
+  JUMP(0x0BA1);
+
+b_0x0729:
+  if (!(i8080_aot_code(c, 0x0729, "\x3A\x47\x04\xCD\xA1\x0B", 6))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x072C;
+  i8080_aot_op_0x3A(c, 0x0447); // lda $0447
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x072C:
+  c->cyc += 17;
+  c->pc = 0x072F;
+  i8080_aot_op_0xCD(c, 0x0BA1); // call $0BA1
+  n += 1;
+  JUMP(0x0BA1);
+
+b_0x072F:
+  if (!(i8080_aot_code(c, 0x072F, "\x3A\x48\x04\xCD\xA1\x0B", 6))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x0732;
+  i8080_aot_op_0x3A(c, 0x0448); // lda $0448
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0732:
+  c->cyc += 17;
+  c->pc = 0x0735;
+  i8080_aot_op_0xCD(c, 0x0BA1); // call $0BA1
+  n += 1;
+  JUMP(0x0BA1);
+
+b_0x0735:
+  if (!(i8080_aot_code(c, 0x0735, "\xC9", 1))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0736;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x0736:
+  if (!(i8080_aot_code(c, 0x0736, "\xE5\x21\x5A\x06\xCD\x83\x0B", 7))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0737;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0736) < 7) {
+    goto dispatch;
+  }
+i_0x0737:
+  i8080_aot_op_0x21(c, 0x065A); // lxi h,$065A
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x073D;
+  i8080_aot_op_0xCD(c, 0x0B83); // call $0B83
+  n += 1;
+  JUMP(0x0B83);
+
+b_0x073D:
+  if (!(i8080_aot_code(c, 0x073D, "\xFE\x41\xFA\x4E\x07", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xFE(c, 0x0041); // cpi $41
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0742;
+  i8080_aot_op_0xFA(c, 0x074E); // jm $074E
+  n += 1;
+  if (c->pc == 0x074E) {
+    JUMP(0x074E);
+  }
+  JUMP(0x0742);
+
+b_0x0742:
+  if (!(i8080_aot_code(c, 0x0742, "\xFE\x5B\xF2\x4E\x07", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xFE(c, 0x005B); // cpi $5B
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0747;
+  i8080_aot_op_0xF2(c, 0x074E); // jp $074E
+  n += 1;
+  if (c->pc == 0x074E) {
+    JUMP(0x074E);
+  }
+  JUMP(0x0747);
+
+b_0x0747:
+  if (!(i8080_aot_code(c, 0x0747, "\xF5\x3E\x5A\xCD\x0E\x0B", 6))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0748;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0747) < 6) {
+    goto dispatch;
+  }
+i_0x0748:
+  i8080_aot_op_0x3E(c, 0x005A); // mvi a,$5A
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x074D;
+  i8080_aot_op_0xCD(c, 0x0B0E); // call $0B0E
+  n += 1;
+  JUMP(0x0B0E);
+
+b_0x074D:
+  if (!(i8080_aot_code(c, 0x074D, "\xF1", 1))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x074E;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  JUMP(0x074E);
+
+b_0x074E:
+  if (!(i8080_aot_code(c, 0x074E, "\xCD\x0E\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0751;
+  i8080_aot_op_0xCD(c, 0x0B0E); // call $0B0E
+  n += 1;
+  JUMP(0x0B0E);
+
+b_0x0751:
+  if (!(i8080_aot_code(c, 0x0751, "\xE1\xC9", 2))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0752;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0752:
+  c->cyc += 10;
+  c->pc = 0x0753;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x0753:
+  if (!(i8080_aot_code(c, 0x0753, "\xE5\xD5\x3A\x56\x06\xCD\xA1\x0B", 8))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0754;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0753) < 8) {
+    goto dispatch;
+  }
+i_0x0754:
+  c->cyc += 11;
+  c->pc = 0x0755;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0754) < 7) {
+    goto dispatch;
+  }
+i_0x0755:
+  c->cyc += 13;
+  c->pc = 0x0758;
+  i8080_aot_op_0x3A(c, 0x0656); // lda $0656
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0758:
+  c->cyc += 17;
+  c->pc = 0x075B;
+  i8080_aot_op_0xCD(c, 0x0BA1); // call $0BA1
+  n += 1;
+  JUMP(0x0BA1);
+
+b_0x075B:
+  if (!(i8080_aot_code(c, 0x075B, "\xCD\x4E\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x075E;
+  i8080_aot_op_0xCD(c, 0x0B4E); // call $0B4E
+  n += 1;
+  JUMP(0x0B4E);
+
+b_0x075E:
+  if (!(i8080_aot_code(c, 0x075E, "\x28\x00\xCD\x36\x07", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x28(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 25;
+  c->pc = 0x0763;
+  i8080_aot_op_0xCD(c, 0x0736); // call $0736
+  n += 1;
+  JUMP(0x0736);
+
+b_0x0763:
+  if (!(i8080_aot_code(c, 0x0763, "\xCD\x4E\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0766;
+  i8080_aot_op_0xCD(c, 0x0B4E); // call $0B4E
+  n += 1;
+  JUMP(0x0B4E);
+
+b_0x0766:
+  if (!(i8080_aot_code(c, 0x0766, "\x29\x3A\x00\x3A\x54\x06\xCD\xA1\x0B\xCD\x4E\x0B", 12))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x29(c, 0x0000); // dad h
+  n += 1;
+  c->cyc += 23;
+  c->pc = 0x076A;
+  i8080_aot_op_0x3A(c, 0x3A00); // lda $3A00
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x076A:
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x06(c, 0x00CD); // mvi b,$CD
+  n += 1;
+  i8080_aot_op_0xA1(c, 0x0000); // ana c
+  n += 1;
+  i8080_aot_op_0x0B(c, 0x0000); // dcx b
+  n += 1;
+  c->cyc += 38;
+  c->pc = 0x0772;
+  i8080_aot_op_0xCD(c, 0x0B4E); // call $0B4E
+  n += 1;
+  JUMP(0x0B4E);
+
+b_0x0772:
+  if (!(i8080_aot_code(c, 0x0772, "\x2D\x3E\x00\x3A\x55\x06\xCD\xA1\x0B", 9))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x2D(c, 0x0000); // dcr l
+  n += 1;
+  i8080_aot_op_0x3E(c, 0x0000); // mvi a,$00
+  n += 1;
+  c->cyc += 25;
+  c->pc = 0x0778;
+  i8080_aot_op_0x3A(c, 0x0655); // lda $0655
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0778:
+  c->cyc += 17;
+  c->pc = 0x077B;
+  i8080_aot_op_0xCD(c, 0x0BA1); // call $0BA1
+  n += 1;
+  JUMP(0x0BA1);
+
+b_0x077B:
+  if (!(i8080_aot_code(c, 0x077B, "\xCD\x4E\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x077E;
+  i8080_aot_op_0xCD(c, 0x0B4E); // call $0B4E
+  n += 1;
+  JUMP(0x0B4E);
+
+b_0x077E:
+  if (!(i8080_aot_code(c, 0x077E, "\x28\x00\x2A\x7E\x0C\x23\x7E\xCD\xA1\x0B", 10))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x28(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x0783;
+  i8080_aot_op_0x2A(c, 0x0C7E); // lhld $0C7E
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0783:
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x0785;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0785:
+  c->cyc += 17;
+  c->pc = 0x0788;
+  i8080_aot_op_0xCD(c, 0x0BA1); // call $0BA1
+  n += 1;
+  JUMP(0x0BA1);
+
+b_0x0788:
+  if (!(i8080_aot_code(c, 0x0788, "\xCD\x4E\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x078B;
+  i8080_aot_op_0xCD(c, 0x0B4E); // call $0B4E
+  n += 1;
+  JUMP(0x0B4E);
+
+b_0x078B:
+  if (!(i8080_aot_code(c, 0x078B, "\x2E\x00\x3A\x57\x06\xCD\xA1\x0B", 8))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x2E(c, 0x0000); // mvi l,$00
+  n += 1;
+  c->cyc += 20;
+  c->pc = 0x0790;
+  i8080_aot_op_0x3A(c, 0x0657); // lda $0657
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0790:
+  c->cyc += 17;
+  c->pc = 0x0793;
+  i8080_aot_op_0xCD(c, 0x0BA1); // call $0BA1
+  n += 1;
+  JUMP(0x0BA1);
+
+b_0x0793:
+  if (!(i8080_aot_code(c, 0x0793, "\xCD\x4E\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0796;
+  i8080_aot_op_0xCD(c, 0x0B4E); // call $0B4E
+  n += 1;
+  JUMP(0x0B4E);
+
+b_0x0796:
+  if (!(i8080_aot_code(c, 0x0796, "\x29\x2C\x20\x00\xD1\xE1\xC9", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x29(c, 0x0000); // dad h
+  n += 1;
+  i8080_aot_op_0x2C(c, 0x0000); // inr l
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 33;
+  c->pc = 0x079B;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x079B:
+  c->cyc += 10;
+  c->pc = 0x079C;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x079C:
+  c->cyc += 10;
+  c->pc = 0x079D;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x079D:
+  if (!(i8080_aot_code(c, 0x079D, "\xF5\xE5\x2A\x7E\x0C\xF5\x7E\x32\x57\x06\xF1\xBE\xCA\xB7\x07", 15))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x079E;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x079D) < 15) {
+    goto dispatch;
+  }
+i_0x079E:
+  c->cyc += 11;
+  c->pc = 0x079F;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x079E) < 14) {
+    goto dispatch;
+  }
+i_0x079F:
+  c->cyc += 16;
+  c->pc = 0x07A2;
+  i8080_aot_op_0x2A(c, 0x0C7E); // lhld $0C7E
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x07A2:
+  c->cyc += 11;
+  c->pc = 0x07A3;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x07A2) < 10) {
+    goto dispatch;
+  }
+i_0x07A3:
+  c->cyc += 7;
+  c->pc = 0x07A4;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x07A4:
+  c->cyc += 13;
+  c->pc = 0x07A7;
+  i8080_aot_op_0x32(c, 0x0657); // sta $0657
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x07A7:
+  c->cyc += 10;
+  c->pc = 0x07A8;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x07A8:
+  c->cyc += 7;
+  c->pc = 0x07A9;
+  i8080_aot_op_0xBE(c, 0x0000); // cmp M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x07A9:
+  c->cyc += 10;
+  c->pc = 0x07AC;
+  i8080_aot_op_0xCA(c, 0x07B7); // jz $07B7
+  n += 1;
+  if (c->pc == 0x07B7) {
+    JUMP(0x07B7);
+  }
+  JUMP(0x07AC);
+
+b_0x07AC:
+  if (!(i8080_aot_code(c, 0x07AC, "\xF5\x3A\x74\x0C\x32\x7C\x0C\xF1\xC3\xB7\x07", 11))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x07AD;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x07AC) < 11) {
+    goto dispatch;
+  }
+i_0x07AD:
+  c->cyc += 13;
+  c->pc = 0x07B0;
+  i8080_aot_op_0x3A(c, 0x0C74); // lda $0C74
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x07B0:
+  c->cyc += 13;
+  c->pc = 0x07B3;
+  i8080_aot_op_0x32(c, 0x0C7C); // sta $0C7C
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x07B3:
+  c->cyc += 10;
+  c->pc = 0x07B4;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x07B4:
+  c->cyc += 10;
+  c->pc = 0x07B7;
+  i8080_aot_op_0xC3(c, 0x07B7); // jmp $07B7
+  n += 1;
+  JUMP(0x07B7);
+
+b_0x07B7:
+  if (!(i8080_aot_code(c, 0x07B7, "\xCD\xFE\x08", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x07BA;
+  i8080_aot_op_0xCD(c, 0x08FE); // call $08FE
+  n += 1;
+  JUMP(0x08FE);
+
+b_0x07BA:
+  if (!(i8080_aot_code(c, 0x07BA, "\xCD\xC4\x07", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x07BD;
+  i8080_aot_op_0xCD(c, 0x07C4); // call $07C4
+  n += 1;
+  JUMP(0x07C4);
+
+b_0x07BD:
+  if (!(i8080_aot_code(c, 0x07BD, "\x23\x22\x7E\x0C\xE1\xF1\xC9", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  c->cyc += 21;
+  c->pc = 0x07C1;
+  i8080_aot_op_0x22(c, 0x0C7E); // shld $0C7E
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x07C1:
+  c->cyc += 10;
+  c->pc = 0x07C2;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x07C2:
+  c->cyc += 10;
+  c->pc = 0x07C3;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x07C3:
+  c->cyc += 10;
+  c->pc = 0x07C4;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x07C4:
+  if (!(i8080_aot_code(c, 0x07C4, "\x77\xC9", 2))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x07C5;
+  i8080_aot_op_0x77(c, 0x0000); // mov M,a
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x07C5) < 1) {
+    goto dispatch;
+  }
+i_0x07C5:
+  c->cyc += 10;
+  c->pc = 0x07C6;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x07C6:
+  if (!(i8080_aot_code(c, 0x07C6, "\xCD\x4E\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x07C9;
+  i8080_aot_op_0xCD(c, 0x0B4E); // call $0B4E
+  n += 1;
+  JUMP(0x0B4E);
+
+b_0x07C9:
+  if (!(i8080_aot_code(c, 0x07C9, "\x0D\x0A\x43\x50\x55\x20\x46\x41\x49\x4C\x45\x44\x3A\x20\x00\xF5\x3E\x01\x32\x7C\x0C", 21))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x07CB;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x07CB:
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  i8080_aot_op_0x50(c, 0x0000); // mov d,b
+  n += 1;
+  i8080_aot_op_0x55(c, 0x0000); // mov d,l
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  c->cyc += 26;
+  c->pc = 0x07D0;
+  i8080_aot_op_0x46(c, 0x0000); // mov b,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x07D0:
+  i8080_aot_op_0x41(c, 0x0000); // mov b,c
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  i8080_aot_op_0x4C(c, 0x0000); // mov c,h
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x44(c, 0x0000); // mov b,h
+  n += 1;
+  c->cyc += 38;
+  c->pc = 0x07D8;
+  i8080_aot_op_0x3A(c, 0x0020); // lda $0020
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x07D8:
+  c->cyc += 11;
+  c->pc = 0x07D9;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x07D8) < 6) {
+    goto dispatch;
+  }
+i_0x07D9:
+  i8080_aot_op_0x3E(c, 0x0001); // mvi a,$01
+  n += 1;
+  c->cyc += 20;
+  c->pc = 0x07DE;
+  i8080_aot_op_0x32(c, 0x0C7C); // sta $0C7C
+  n += 1;
+  JUMP(0x07DE);
+
+b_0x07DE:
+  if (!(i8080_aot_code(c, 0x07DE, "\xF1\x2A\x7A\x0C\x23\x22\x7A\x0C\xCD\x4E\x0B", 11))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x07DF;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x07DF:
+  c->cyc += 16;
+  c->pc = 0x07E2;
+  i8080_aot_op_0x2A(c, 0x0C7A); // lhld $0C7A
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x07E2:
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  c->cyc += 21;
+  c->pc = 0x07E6;
+  i8080_aot_op_0x22(c, 0x0C7A); // shld $0C7A
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x07E6:
+  c->cyc += 17;
+  c->pc = 0x07E9;
+  i8080_aot_op_0xCD(c, 0x0B4E); // call $0B4E
+  n += 1;
+  JUMP(0x0B4E);
+
+b_0x07E9:
+  if (!(i8080_aot_code(c, 0x07E9, "\x0D\x0A\x45\x52\x52\x4F\x52\x20\x43\x4F\x55\x4E\x54\x20\x00\xCD\x8B\x0B", 18))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x07EB;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x07EB:
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  i8080_aot_op_0x55(c, 0x0000); // mov d,l
+  n += 1;
+  c->cyc += 51;
+  c->pc = 0x07F5;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x07F5:
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 30;
+  c->pc = 0x07FB;
+  i8080_aot_op_0xCD(c, 0x0B8B); // call $0B8B
+  n += 1;
+  JUMP(0x0B8B);
+
+b_0x07FB:
+  if (!(i8080_aot_code(c, 0x07FB, "\xCD\x4E\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x07FE;
+  i8080_aot_op_0xCD(c, 0x0B4E); // call $0B4E
+  n += 1;
+  JUMP(0x0B4E);
+
+b_0x07FE:
+  if (!(i8080_aot_code(c, 0x07FE, "\x48\x0D", 2) &&
+      i8080_aot_code(c, 0x0800, "\x0A\x00\x2A\x7E\x0C\xF5\xCD\x1D\x09", 9))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x48(c, 0x0000); // mov c,b
+  n += 1;
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0801;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0801:
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 20;
+  c->pc = 0x0805;
+  i8080_aot_op_0x2A(c, 0x0C7E); // lhld $0C7E
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0805:
+  c->cyc += 11;
+  c->pc = 0x0806;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0805) < 4) {
+    goto dispatch;
+  }
+i_0x0806:
+  c->cyc += 17;
+  c->pc = 0x0809;
+  i8080_aot_op_0xCD(c, 0x091D); // call $091D
+  n += 1;
+  JUMP(0x091D);
+
+b_0x0809:
+  if (!(i8080_aot_code(c, 0x0809, "\xCD\x53\x07", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x080C;
+  i8080_aot_op_0xCD(c, 0x0753); // call $0753
+  n += 1;
+  JUMP(0x0753);
+
+b_0x080C:
+  if (!(i8080_aot_code(c, 0x080C, "\xCD\x4E\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x080F;
+  i8080_aot_op_0xCD(c, 0x0B4E); // call $0B4E
+  n += 1;
+  JUMP(0x0B4E);
+
+b_0x080F:
+  if (!(i8080_aot_code(c, 0x080F, "\x0D\x0A\x49\x4E\x53\x54\x52\x55\x43\x54\x49\x4F\x4E\x20\x53\x45", 16))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x0811;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0811:
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x0813;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0813:
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x55(c, 0x0000); // mov d,l
+  n += 1;
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  c->cyc += 47;
+  c->pc = 0x081C;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x081C:
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x081F;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  JUMP(0x081F);
+
+b_0x081F:
+  if (!(i8080_aot_code(c, 0x081F, "\x51\x55\x45\x4E\x43\x45\x20\x57\x41\x53\x20\x00\xCD\x23\x07", 15))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x51(c, 0x0000); // mov d,c
+  n += 1;
+  i8080_aot_op_0x55(c, 0x0000); // mov d,l
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x0823;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0823:
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x57(c, 0x0000); // mov d,a
+  n += 1;
+  i8080_aot_op_0x41(c, 0x0000); // mov b,c
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 54;
+  c->pc = 0x082E;
+  i8080_aot_op_0xCD(c, 0x0723); // call $0723
+  n += 1;
+  JUMP(0x0723);
+
+b_0x082E:
+  if (!(i8080_aot_code(c, 0x082E, "\xCD\x4E\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0831;
+  i8080_aot_op_0xCD(c, 0x0B4E); // call $0B4E
+  n += 1;
+  JUMP(0x0B4E);
+
+b_0x0831:
+  if (!(i8080_aot_code(c, 0x0831, "\x48\x0D\x0A\x52\x45\x47\x49\x53\x54\x45\x52\x20\x00\x3A\x56\x06\xCD\x36\x07", 19))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x48(c, 0x0000); // mov c,b
+  n += 1;
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0834;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0834:
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x47(c, 0x0000); // mov b,a
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 61;
+  c->pc = 0x0841;
+  i8080_aot_op_0x3A(c, 0x0656); // lda $0656
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0841:
+  c->cyc += 17;
+  c->pc = 0x0844;
+  i8080_aot_op_0xCD(c, 0x0736); // call $0736
+  n += 1;
+  JUMP(0x0736);
+
+b_0x0844:
+  if (!(i8080_aot_code(c, 0x0844, "\xF1\xF5\xCD\x4E\x0B", 5))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0845;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0845:
+  c->cyc += 11;
+  c->pc = 0x0846;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0845) < 4) {
+    goto dispatch;
+  }
+i_0x0846:
+  c->cyc += 17;
+  c->pc = 0x0849;
+  i8080_aot_op_0xCD(c, 0x0B4E); // call $0B4E
+  n += 1;
+  JUMP(0x0B4E);
+
+b_0x0849:
+  if (!(i8080_aot_code(c, 0x0849, "\x20\x43\x4F\x4E\x54\x41\x49\x4E\x53\x20\x00\xD5\x3A\x55\x06\xCD\x96\x0B", 18))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  c->cyc += 21;
+  c->pc = 0x084D;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x084D:
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x41(c, 0x0000); // mov b,c
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x0851;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0851:
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x0855;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0854) < 7) {
+    goto dispatch;
+  }
+i_0x0855:
+  c->cyc += 13;
+  c->pc = 0x0858;
+  i8080_aot_op_0x3A(c, 0x0655); // lda $0655
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0858:
+  c->cyc += 17;
+  c->pc = 0x085B;
+  i8080_aot_op_0xCD(c, 0x0B96); // call $0B96
+  n += 1;
+  JUMP(0x0B96);
+
+b_0x085B:
+  if (!(i8080_aot_code(c, 0x085B, "\xCD\x4E\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x085E;
+  i8080_aot_op_0xCD(c, 0x0B4E); // call $0B4E
+  n += 1;
+  JUMP(0x0B4E);
+
+b_0x085E:
+  if (!(i8080_aot_code(c, 0x085E, "\x0D\x0A\x42\x55\x54\x20\x53\x48\x4F\x55\x4C\x44\x20\x43\x4F\x4E", 16))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x0860;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0860:
+  i8080_aot_op_0x42(c, 0x0000); // mov b,d
+  n += 1;
+  i8080_aot_op_0x55(c, 0x0000); // mov d,l
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x48(c, 0x0000); // mov c,b
+  n += 1;
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  i8080_aot_op_0x55(c, 0x0000); // mov d,l
+  n += 1;
+  i8080_aot_op_0x4C(c, 0x0000); // mov c,h
+  n += 1;
+  i8080_aot_op_0x44(c, 0x0000); // mov b,h
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  c->cyc += 70;
+  c->pc = 0x086E;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  JUMP(0x086E);
+
+b_0x086E:
+  if (!(i8080_aot_code(c, 0x086E, "\x54\x41\x49\x4E\x20\x00\x2B\x7E\x23\xCD\x96\x0B", 12))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x41(c, 0x0000); // mov b,c
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x0872;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0872:
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  c->cyc += 20;
+  c->pc = 0x0876;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0876:
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x087A;
+  i8080_aot_op_0xCD(c, 0x0B96); // call $0B96
+  n += 1;
+  JUMP(0x0B96);
+
+b_0x087A:
+  if (!(i8080_aot_code(c, 0x087A, "\xCD\x4E\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x087D;
+  i8080_aot_op_0xCD(c, 0x0B4E); // call $0B4E
+  n += 1;
+  JUMP(0x0B4E);
+
+b_0x087D:
+  if (!(i8080_aot_code(c, 0x087D, "\x0D\x0A\x52\x45\x47\x49\x53\x54\x45\x52\x20\x56\x41\x4C\x55\x45", 16))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x087F;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x087F:
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x47(c, 0x0000); // mov b,a
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  c->cyc += 51;
+  c->pc = 0x0889;
+  i8080_aot_op_0x56(c, 0x0000); // mov d,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0889:
+  i8080_aot_op_0x41(c, 0x0000); // mov b,c
+  n += 1;
+  i8080_aot_op_0x4C(c, 0x0000); // mov c,h
+  n += 1;
+  i8080_aot_op_0x55(c, 0x0000); // mov d,l
+  n += 1;
+  c->cyc += 20;
+  c->pc = 0x088D;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  JUMP(0x088D);
+
+b_0x088D:
+  if (!(i8080_aot_code(c, 0x088D, "\x20\x42\x45\x46\x4F\x52\x45\x20\x49\x4E\x53\x54\x52\x55\x43\x54", 16))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x42(c, 0x0000); // mov b,d
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  c->cyc += 21;
+  c->pc = 0x0891;
+  i8080_aot_op_0x46(c, 0x0000); // mov b,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0891:
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  c->cyc += 31;
+  c->pc = 0x0897;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0897:
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x55(c, 0x0000); // mov d,l
+  n += 1;
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  c->cyc += 30;
+  c->pc = 0x089D;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  JUMP(0x089D);
+
+b_0x089D:
+  if (!(i8080_aot_code(c, 0x089D, "\x49\x4F\x4E\x20\x53\x45\x51\x55\x45\x4E\x43\x45\x20\x57\x41\x53", 16))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x08A0;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x08A0:
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x51(c, 0x0000); // mov d,c
+  n += 1;
+  i8080_aot_op_0x55(c, 0x0000); // mov d,l
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  c->cyc += 36;
+  c->pc = 0x08A7;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x08A7:
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x57(c, 0x0000); // mov d,a
+  n += 1;
+  i8080_aot_op_0x41(c, 0x0000); // mov b,c
+  n += 1;
+  c->cyc += 29;
+  c->pc = 0x08AD;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  JUMP(0x08AD);
+
+b_0x08AD:
+  if (!(i8080_aot_code(c, 0x08AD, "\x20\x00\x3A\x54\x06\xCD\x96\x0B", 8))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 21;
+  c->pc = 0x08B2;
+  i8080_aot_op_0x3A(c, 0x0654); // lda $0654
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x08B2:
+  c->cyc += 17;
+  c->pc = 0x08B5;
+  i8080_aot_op_0xCD(c, 0x0B96); // call $0B96
+  n += 1;
+  JUMP(0x0B96);
+
+b_0x08B5:
+  if (!(i8080_aot_code(c, 0x08B5, "\xD1\xCD\x4E\x0B", 4))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x08B6;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x08B6:
+  c->cyc += 17;
+  c->pc = 0x08B9;
+  i8080_aot_op_0xCD(c, 0x0B4E); // call $0B4E
+  n += 1;
+  JUMP(0x0B4E);
+
+b_0x08B9:
+  if (!(i8080_aot_code(c, 0x08B9, "\x0D\x0A\x54\x45\x53\x54\x20\x4E\x55\x4D\x42\x45\x52\x20\x00\xD5", 16))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x08BB;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x08BB:
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  c->cyc += 31;
+  c->pc = 0x08C1;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x08C1:
+  i8080_aot_op_0x55(c, 0x0000); // mov d,l
+  n += 1;
+  i8080_aot_op_0x4D(c, 0x0000); // mov c,l
+  n += 1;
+  i8080_aot_op_0x42(c, 0x0000); // mov b,d
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 44;
+  c->pc = 0x08C9;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  JUMP(0x08C9);
+
+b_0x08C9:
+  if (!(i8080_aot_code(c, 0x08C9, "\x11\x83\xF3\x19\xD1\xCD\x6C\x0C", 8))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x11(c, 0xF383); // lxi d,$F383
+  n += 1;
+  i8080_aot_op_0x19(c, 0x0000); // dad d
+  n += 1;
+  c->cyc += 30;
+  c->pc = 0x08CE;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x08CE:
+  c->cyc += 17;
+  c->pc = 0x08D1;
+  i8080_aot_op_0xCD(c, 0x0C6C); // call $0C6C
+  n += 1;
+  JUMP(0x0C6C);
+
+b_0x08D1:
+  if (!(i8080_aot_code(c, 0x08D1, "\xCD\x8B\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x08D4;
+  i8080_aot_op_0xCD(c, 0x0B8B); // call $0B8B
+  n += 1;
+  JUMP(0x0B8B);
+
+b_0x08D4:
+  if (!(i8080_aot_code(c, 0x08D4, "\xCD\x4E\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x08D7;
+  i8080_aot_op_0xCD(c, 0x0B4E); // call $0B4E
+  n += 1;
+  JUMP(0x0B4E);
+
+b_0x08D7:
+  if (!(i8080_aot_code(c, 0x08D7, "\x48\x0D\x0A\x0A\x00\xCD\x2B\x0C", 8))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x48(c, 0x0000); // mov c,b
+  n += 1;
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x08DA;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x08DA:
+  c->cyc += 7;
+  c->pc = 0x08DB;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x08DB:
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 21;
+  c->pc = 0x08DF;
+  i8080_aot_op_0xCD(c, 0x0C2B); // call $0C2B
+  n += 1;
+  JUMP(0x0C2B);
+
+b_0x08DF:
+  if (!(i8080_aot_code(c, 0x08DF, "\xF1\xC9", 2))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x08E0;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x08E0:
+  c->cyc += 10;
+  c->pc = 0x08E1;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x08FE:
+  if (!(i8080_aot_code(c, 0x08FE, "\xF5\x3A", 2) &&
+      i8080_aot_code(c, 0x0900, "\x74\x0C\xB7\xCA\x0D\x09", 6))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x08FF;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x08FE) < 8) {
+    goto dispatch;
+  }
+i_0x08FF:
+  c->cyc += 13;
+  c->pc = 0x0902;
+  i8080_aot_op_0x3A(c, 0x0C74); // lda $0C74
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0902:
+  i8080_aot_op_0xB7(c, 0x0000); // ora a
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x0906;
+  i8080_aot_op_0xCA(c, 0x090D); // jz $090D
+  n += 1;
+  if (c->pc == 0x090D) {
+    JUMP(0x090D);
+  }
+  JUMP(0x0906);
+
+b_0x0906:
+  if (!(i8080_aot_code(c, 0x0906, "\xF1", 1))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0907;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  JUMP(0x0907);
+
+b_0x0907:
+  if (!(i8080_aot_code(c, 0x0907, "\xE3\x23\x23\x23\xE3\xC9", 6))) {
+    goto fallback;
+  }
+  c->cyc += 18;
+  c->pc = 0x0908;
+  i8080_aot_op_0xE3(c, 0x0000); // xthl
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0907) < 6) {
+    goto dispatch;
+  }
+i_0x0908:
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  c->cyc += 33;
+  c->pc = 0x090C;
+  i8080_aot_op_0xE3(c, 0x0000); // xthl
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x090B) < 2) {
+    goto dispatch;
+  }
+i_0x090C:
+  c->cyc += 10;
+  c->pc = 0x090D;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x090D:
+  if (!(i8080_aot_code(c, 0x090D, "\xF1\xC9", 2))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x090E;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x090E:
+  c->cyc += 10;
+  c->pc = 0x090F;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x090F:
+  if (!(i8080_aot_code(c, 0x090F, "\xCD\xFE\x08", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0912;
+  i8080_aot_op_0xCD(c, 0x08FE); // call $08FE
+  n += 1;
+  JUMP(0x08FE);
+
+b_0x0912:
+  if (!(i8080_aot_code(c, 0x0912, "\xC3\x07\x09", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0915;
+  i8080_aot_op_0xC3(c, 0x0907); // jmp $0907
+  n += 1;
+  JUMP(0x0907);
+
+b_0x0916:
+  if (!(i8080_aot_code(c, 0x0916, "\xCD\x1D\x09", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0919;
+  i8080_aot_op_0xCD(c, 0x091D); // call $091D
+  n += 1;
+  JUMP(0x091D);
+
+b_0x0919:
+  if (!(i8080_aot_code(c, 0x0919, "\xC3\x07\x09", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x091C;
+  i8080_aot_op_0xC3(c, 0x0907); // jmp $0907
+  n += 1;
+  JUMP(0x0907);
+
+b_0x091D:
+  if (!(i8080_aot_code(c, 0x091D, "\xF5\x3A\x78\x0C\xFE\x01\xCA\x0D\x09", 9))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x091E;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x091D) < 9) {
+    goto dispatch;
+  }
+i_0x091E:
+  c->cyc += 13;
+  c->pc = 0x0921;
+  i8080_aot_op_0x3A(c, 0x0C78); // lda $0C78
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0921:
+  i8080_aot_op_0xFE(c, 0x0001); // cpi $01
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0926;
+  i8080_aot_op_0xCA(c, 0x090D); // jz $090D
+  n += 1;
+  if (c->pc == 0x090D) {
+    JUMP(0x090D);
+  }
+  JUMP(0x0926);
+
+b_0x0926:
+  if (!(i8080_aot_code(c, 0x0926, "\xF1\xC3\x07\x09", 4))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0927;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0927:
+  c->cyc += 10;
+  c->pc = 0x092A;
+  i8080_aot_op_0xC3(c, 0x0907); // jmp $0907
+  n += 1;
+  JUMP(0x0907);
+
+b_0x093A:
+  if (!(i8080_aot_code(c, 0x093A, "\x22\xBC\x09\xE1\xE3\xE5\xF5\x2A\xBC\x09\x2B\x70\x2B\x71\x2B\x72\x2B\x73\xD1\x2B", 20))) {
+    goto fallback;
+  }
+  c->cyc += 16;
+  c->pc = 0x093D;
+  i8080_aot_op_0x22(c, 0x09BC); // shld $09BC
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x093D:
+  c->cyc += 10;
+  c->pc = 0x093E;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x093E:
+  c->cyc += 18;
+  c->pc = 0x093F;
+  i8080_aot_op_0xE3(c, 0x0000); // xthl
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x093E) < 16) {
+    goto dispatch;
+  }
+i_0x093F:
+  c->cyc += 11;
+  c->pc = 0x0940;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x093F) < 15) {
+    goto dispatch;
+  }
+i_0x0940:
+  c->cyc += 11;
+  c->pc = 0x0941;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0940) < 14) {
+    goto dispatch;
+  }
+i_0x0941:
+  c->cyc += 16;
+  c->pc = 0x0944;
+  i8080_aot_op_0x2A(c, 0x09BC); // lhld $09BC
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0944:
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x0946;
+  i8080_aot_op_0x70(c, 0x0000); // mov M,b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x0946) < 8) {
+    goto dispatch;
+  }
+i_0x0946:
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x0948;
+  i8080_aot_op_0x71(c, 0x0000); // mov M,c
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x0948) < 6) {
+    goto dispatch;
+  }
+i_0x0948:
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x094A;
+  i8080_aot_op_0x72(c, 0x0000); // mov M,d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x094A) < 4) {
+    goto dispatch;
+  }
+i_0x094A:
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x094C;
+  i8080_aot_op_0x73(c, 0x0000); // mov M,e
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x094C) < 2) {
+    goto dispatch;
+  }
+i_0x094C:
+  c->cyc += 10;
+  c->pc = 0x094D;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x094D:
+  c->cyc += 5;
+  c->pc = 0x094E;
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  JUMP(0x094E);
+
+b_0x094E:
+  if (!(i8080_aot_code(c, 0x094E, "\x72\x2B\x73\xEB\xE3\xEB\x2B\x72\x2B\x73\xEB\xE3\xEB\xE3\xCD\x3C\x0A", 17))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x094F;
+  i8080_aot_op_0x72(c, 0x0000); // mov M,d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x094F) < 16) {
+    goto dispatch;
+  }
+i_0x094F:
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x0951;
+  i8080_aot_op_0x73(c, 0x0000); // mov M,e
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x0951) < 14) {
+    goto dispatch;
+  }
+i_0x0951:
+  i8080_aot_op_0xEB(c, 0x0000); // xchg
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x0953;
+  i8080_aot_op_0xE3(c, 0x0000); // xthl
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0952) < 13) {
+    goto dispatch;
+  }
+i_0x0953:
+  i8080_aot_op_0xEB(c, 0x0000); // xchg
+  n += 1;
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  c->cyc += 16;
+  c->pc = 0x0956;
+  i8080_aot_op_0x72(c, 0x0000); // mov M,d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x0956) < 9) {
+    goto dispatch;
+  }
+i_0x0956:
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x0958;
+  i8080_aot_op_0x73(c, 0x0000); // mov M,e
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x0958) < 7) {
+    goto dispatch;
+  }
+i_0x0958:
+  i8080_aot_op_0xEB(c, 0x0000); // xchg
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x095A;
+  i8080_aot_op_0xE3(c, 0x0000); // xthl
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0959) < 6) {
+    goto dispatch;
+  }
+i_0x095A:
+  i8080_aot_op_0xEB(c, 0x0000); // xchg
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x095C;
+  i8080_aot_op_0xE3(c, 0x0000); // xthl
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x095B) < 4) {
+    goto dispatch;
+  }
+i_0x095C:
+  c->cyc += 17;
+  c->pc = 0x095F;
+  i8080_aot_op_0xCD(c, 0x0A3C); // call $0A3C
+  n += 1;
+  JUMP(0x0A3C);
+
+b_0x095F:
+  if (!(i8080_aot_code(c, 0x095F, "\x08\xD9", 2))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x08(c, 0x0000); // ill
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x0961;
+  i8080_aot_op_0xD9(c, 0x0000); // ill
+  n += 1;
+  goto dispatch;
+
+b_0x09C0:
+  if (!(i8080_aot_code(c, 0x09C0, "\x2B\x46\x2B\x4E\x2B\x56\x2B\x5E\xD5\x2B\x56\x2B\x5E\xD5\xF1\x2B", 16))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x09C2;
+  i8080_aot_op_0x46(c, 0x0000); // mov b,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x09C2:
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x09C4;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x09C4:
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x09C6;
+  i8080_aot_op_0x56(c, 0x0000); // mov d,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x09C6:
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x09C8;
+  i8080_aot_op_0x5E(c, 0x0000); // mov e,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x09C8:
+  c->cyc += 11;
+  c->pc = 0x09C9;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x09C8) < 8) {
+    goto dispatch;
+  }
+i_0x09C9:
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x09CB;
+  i8080_aot_op_0x56(c, 0x0000); // mov d,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x09CB:
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x09CD;
+  i8080_aot_op_0x5E(c, 0x0000); // mov e,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x09CD:
+  c->cyc += 11;
+  c->pc = 0x09CE;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x09CD) < 3) {
+    goto dispatch;
+  }
+i_0x09CE:
+  c->cyc += 10;
+  c->pc = 0x09CF;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x09CF:
+  c->cyc += 5;
+  c->pc = 0x09D0;
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  JUMP(0x09D0);
+
+b_0x09D0:
+  if (!(i8080_aot_code(c, 0x09D0, "\x56\x2B\x5E\xE3\xEB\xCD\x31\x0A", 8))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x09D1;
+  i8080_aot_op_0x56(c, 0x0000); // mov d,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x09D1:
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x09D3;
+  i8080_aot_op_0x5E(c, 0x0000); // mov e,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x09D3:
+  c->cyc += 18;
+  c->pc = 0x09D4;
+  i8080_aot_op_0xE3(c, 0x0000); // xthl
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x09D3) < 5) {
+    goto dispatch;
+  }
+i_0x09D4:
+  i8080_aot_op_0xEB(c, 0x0000); // xchg
+  n += 1;
+  c->cyc += 21;
+  c->pc = 0x09D8;
+  i8080_aot_op_0xCD(c, 0x0A31); // call $0A31
+  n += 1;
+  JUMP(0x0A31);
+
+b_0x09D8:
+  if (!(i8080_aot_code(c, 0x09D8, "\x33\x33\xCD\x31\x0A", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x33(c, 0x0000); // inx sp
+  n += 1;
+  i8080_aot_op_0x33(c, 0x0000); // inx sp
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x09DD;
+  i8080_aot_op_0xCD(c, 0x0A31); // call $0A31
+  n += 1;
+  JUMP(0x0A31);
+
+b_0x09DD:
+  if (!(i8080_aot_code(c, 0x09DD, "\xC9", 1))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x09DE;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x0A31:
+  if (!(i8080_aot_code(c, 0x0A31, "\xF5\x3A\x72\x0C\xB7\xCA\x0D\x09", 8))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0A32;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0A31) < 8) {
+    goto dispatch;
+  }
+i_0x0A32:
+  c->cyc += 13;
+  c->pc = 0x0A35;
+  i8080_aot_op_0x3A(c, 0x0C72); // lda $0C72
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0A35:
+  i8080_aot_op_0xB7(c, 0x0000); // ora a
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x0A39;
+  i8080_aot_op_0xCA(c, 0x090D); // jz $090D
+  n += 1;
+  if (c->pc == 0x090D) {
+    JUMP(0x090D);
+  }
+  JUMP(0x0A39);
+
+b_0x0A39:
+  if (!(i8080_aot_code(c, 0x0A39, "\xC3\x44\x0A", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0A3C;
+  i8080_aot_op_0xC3(c, 0x0A44); // jmp $0A44
+  n += 1;
+  JUMP(0x0A44);
+
+b_0x0A3C:
+  if (!(i8080_aot_code(c, 0x0A3C, "\xF5\x3A\x72\x0C\xB7\xC2\x0D\x09", 8))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0A3D;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0A3C) < 8) {
+    goto dispatch;
+  }
+i_0x0A3D:
+  c->cyc += 13;
+  c->pc = 0x0A40;
+  i8080_aot_op_0x3A(c, 0x0C72); // lda $0C72
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0A40:
+  i8080_aot_op_0xB7(c, 0x0000); // ora a
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x0A44;
+  i8080_aot_op_0xC2(c, 0x090D); // jnz $090D
+  n += 1;
+  if (c->pc == 0x090D) {
+    JUMP(0x090D);
+  }
+  JUMP(0x0A44);
+
+b_0x0A44:
+  if (!(i8080_aot_code(c, 0x0A44, "\xF1\xE3\x23\x23\xE3\xC9", 6))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0A45;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0A45:
+  c->cyc += 18;
+  c->pc = 0x0A46;
+  i8080_aot_op_0xE3(c, 0x0000); // xthl
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0A45) < 5) {
+    goto dispatch;
+  }
+i_0x0A46:
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  c->cyc += 28;
+  c->pc = 0x0A49;
+  i8080_aot_op_0xE3(c, 0x0000); // xthl
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0A48) < 2) {
+    goto dispatch;
+  }
+i_0x0A49:
+  c->cyc += 10;
+  c->pc = 0x0A4A;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x0A4A:
+  if (!(i8080_aot_code(c, 0x0A4A, "\x11\x09\x01\x2A\x7E\x0C\xCD\x54\x0A", 9))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x11(c, 0x0109); // lxi d,$0109
+  n += 1;
+  c->cyc += 26;
+  c->pc = 0x0A50;
+  i8080_aot_op_0x2A(c, 0x0C7E); // lhld $0C7E
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0A50:
+  c->cyc += 17;
+  c->pc = 0x0A53;
+  i8080_aot_op_0xCD(c, 0x0A54); // call $0A54
+  n += 1;
+  JUMP(0x0A54);
+
+b_0x0A53:
+  if (!(i8080_aot_code(c, 0x0A53, "\xC9", 1))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0A54;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x0A54:
+  if (!(i8080_aot_code(c, 0x0A54, "\xC5\x7C\x2F\x47\x7D\x2F\x4F\x03\xAF", 9))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0A55;
+  i8080_aot_op_0xC5(c, 0x0000); // push b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0A54) < 9) {
+    goto dispatch;
+  }
+i_0x0A55:
+  i8080_aot_op_0x7C(c, 0x0000); // mov a,h
+  n += 1;
+  i8080_aot_op_0x2F(c, 0x0000); // cma
+  n += 1;
+  i8080_aot_op_0x47(c, 0x0000); // mov b,a
+  n += 1;
+  i8080_aot_op_0x7D(c, 0x0000); // mov a,l
+  n += 1;
+  i8080_aot_op_0x2F(c, 0x0000); // cma
+  n += 1;
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  i8080_aot_op_0x03(c, 0x0000); // inx b
+  n += 1;
+  c->cyc += 37;
+  c->pc = 0x0A5D;
+  i8080_aot_op_0xAF(c, 0x0000); // xra a
+  n += 1;
+  JUMP(0x0A5D);
+
+b_0x0A5D:
+  if (!(i8080_aot_code(c, 0x0A5D, "\x62\x6B\x86\x09\x13\xD2\x5D\x0A", 8))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x62(c, 0x0000); // mov h,d
+  n += 1;
+  i8080_aot_op_0x6B(c, 0x0000); // mov l,e
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0A60;
+  i8080_aot_op_0x86(c, 0x0000); // add M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0A60:
+  i8080_aot_op_0x09(c, 0x0000); // dad b
+  n += 1;
+  i8080_aot_op_0x13(c, 0x0000); // inx d
+  n += 1;
+  c->cyc += 25;
+  c->pc = 0x0A65;
+  i8080_aot_op_0xD2(c, 0x0A5D); // jnc $0A5D
+  n += 1;
+  if (c->pc == 0x0A5D) {
+    JUMP(0x0A5D);
+  }
+  JUMP(0x0A65);
+
+b_0x0A65:
+  if (!(i8080_aot_code(c, 0x0A65, "\xC1\xC9", 2))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0A66;
+  i8080_aot_op_0xC1(c, 0x0000); // pop b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0A66:
+  c->cyc += 10;
+  c->pc = 0x0A67;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x0A67:
+  if (!(i8080_aot_code(c, 0x0A67, "\xCD\x4A\x0A", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0A6A;
+  i8080_aot_op_0xCD(c, 0x0A4A); // call $0A4A
+  n += 1;
+  JUMP(0x0A4A);
+
+b_0x0A6A:
+  if (!(i8080_aot_code(c, 0x0A6A, "\xB7\xC4\x8A\x03", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xB7(c, 0x0000); // ora a
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x0A6E;
+  i8080_aot_op_0xC4(c, 0x038A); // cnz $038A
+  n += 1;
+  if (c->pc == 0x038A) {
+    JUMP(0x038A);
+  }
+  JUMP(0x0A6E);
+
+b_0x0A6E:
+  if (!(i8080_aot_code(c, 0x0A6E, "\x1E\x44\xCD\xEA\x03", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x1E(c, 0x0044); // mvi e,$44
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x0A73;
+  i8080_aot_op_0xCD(c, 0x03EA); // call $03EA
+  n += 1;
+  JUMP(0x03EA);
+
+b_0x0A73:
+  if (!(i8080_aot_code(c, 0x0A73, "\xC9", 1))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0A74;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x0B0E:
+  if (!(i8080_aot_code(c, 0x0B0E, "\xC5\xD5\xE5\xF5\x5F\xCD\xEA\x03", 8))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0B0F;
+  i8080_aot_op_0xC5(c, 0x0000); // push b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0B0E) < 8) {
+    goto dispatch;
+  }
+i_0x0B0F:
+  c->cyc += 11;
+  c->pc = 0x0B10;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0B0F) < 7) {
+    goto dispatch;
+  }
+i_0x0B10:
+  c->cyc += 11;
+  c->pc = 0x0B11;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0B10) < 6) {
+    goto dispatch;
+  }
+i_0x0B11:
+  c->cyc += 11;
+  c->pc = 0x0B12;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0B11) < 5) {
+    goto dispatch;
+  }
+i_0x0B12:
+  i8080_aot_op_0x5F(c, 0x0000); // mov e,a
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x0B16;
+  i8080_aot_op_0xCD(c, 0x03EA); // call $03EA
+  n += 1;
+  JUMP(0x03EA);
+
+b_0x0B16:
+  if (!(i8080_aot_code(c, 0x0B16, "\xF1\xE1\xD1\xC1\xC9", 5))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0B17;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0B17:
+  c->cyc += 10;
+  c->pc = 0x0B18;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0B18:
+  c->cyc += 10;
+  c->pc = 0x0B19;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0B19:
+  c->cyc += 10;
+  c->pc = 0x0B1A;
+  i8080_aot_op_0xC1(c, 0x0000); // pop b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0B1A:
+  c->cyc += 10;
+  c->pc = 0x0B1B;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x0B1B:
+  if (!(i8080_aot_code(c, 0x0B1B, "\xC5\xD5\xE5\x0E\x01\xCD\x05\x00", 8))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0B1C;
+  i8080_aot_op_0xC5(c, 0x0000); // push b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0B1B) < 8) {
+    goto dispatch;
+  }
+i_0x0B1C:
+  c->cyc += 11;
+  c->pc = 0x0B1D;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0B1C) < 7) {
+    goto dispatch;
+  }
+i_0x0B1D:
+  c->cyc += 11;
+  c->pc = 0x0B1E;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0B1D) < 6) {
+    goto dispatch;
+  }
+i_0x0B1E:
+  i8080_aot_op_0x0E(c, 0x0001); // mvi c,$01
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x0B23;
+  i8080_aot_op_0xCD(c, 0x0005); // call $0005
+  n += 1;
+  goto dispatch;
+
+b_0x0B23:
+  if (!(i8080_aot_code(c, 0x0B23, "\xE1\xD1\xC1\xC9", 4))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0B24;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0B24:
+  c->cyc += 10;
+  c->pc = 0x0B25;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0B25:
+  c->cyc += 10;
+  c->pc = 0x0B26;
+  i8080_aot_op_0xC1(c, 0x0000); // pop b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0B26:
+  c->cyc += 10;
+  c->pc = 0x0B27;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x0B4E:
+  if (!(i8080_aot_code(c, 0x0B4E, "\xE3\xF5", 2))) {
+    goto fallback;
+  }
+  c->cyc += 18;
+  c->pc = 0x0B4F;
+  i8080_aot_op_0xE3(c, 0x0000); // xthl
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0B4E) < 2) {
+    goto dispatch;
+  }
+i_0x0B4F:
+  c->cyc += 11;
+  c->pc = 0x0B50;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  JUMP(0x0B50);
+
+b_0x0B50:
+  if (!(i8080_aot_code(c, 0x0B50, "\x7E\x23\xB7\xC2\x59\x0B", 6))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x0B51;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0B51:
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  i8080_aot_op_0xB7(c, 0x0000); // ora a
+  n += 1;
+  c->cyc += 19;
+  c->pc = 0x0B56;
+  i8080_aot_op_0xC2(c, 0x0B59); // jnz $0B59
+  n += 1;
+  if (c->pc == 0x0B59) {
+    JUMP(0x0B59);
+  }
+  JUMP(0x0B56);
+
+b_0x0B56:
+  if (!(i8080_aot_code(c, 0x0B56, "\xF1\xE3\xC9", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0B57;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0B57:
+  c->cyc += 18;
+  c->pc = 0x0B58;
+  i8080_aot_op_0xE3(c, 0x0000); // xthl
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0B57) < 2) {
+    goto dispatch;
+  }
+i_0x0B58:
+  c->cyc += 10;
+  c->pc = 0x0B59;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x0B59:
+  if (!(i8080_aot_code(c, 0x0B59, "\xCD\x0E\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0B5C;
+  i8080_aot_op_0xCD(c, 0x0B0E); // call $0B0E
+  n += 1;
+  JUMP(0x0B0E);
+
+b_0x0B5C:
+  if (!(i8080_aot_code(c, 0x0B5C, "\xC3\x50\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0B5F;
+  i8080_aot_op_0xC3(c, 0x0B50); // jmp $0B50
+  n += 1;
+  JUMP(0x0B50);
+
+b_0x0B5F:
+  if (!(i8080_aot_code(c, 0x0B5F, "\xF5\xE5\xD5\xE6\x0F\x21\x73\x0B\x16\x00\x5F\x19\x7E\xCD\x0E\x0B", 16))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0B60;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0B5F) < 16) {
+    goto dispatch;
+  }
+i_0x0B60:
+  c->cyc += 11;
+  c->pc = 0x0B61;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0B60) < 15) {
+    goto dispatch;
+  }
+i_0x0B61:
+  c->cyc += 11;
+  c->pc = 0x0B62;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0B61) < 14) {
+    goto dispatch;
+  }
+i_0x0B62:
+  i8080_aot_op_0xE6(c, 0x000F); // ani $0F
+  n += 1;
+  i8080_aot_op_0x21(c, 0x0B73); // lxi h,$0B73
+  n += 1;
+  i8080_aot_op_0x16(c, 0x0000); // mvi d,$00
+  n += 1;
+  i8080_aot_op_0x5F(c, 0x0000); // mov e,a
+  n += 1;
+  i8080_aot_op_0x19(c, 0x0000); // dad d
+  n += 1;
+  c->cyc += 46;
+  c->pc = 0x0B6C;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0B6C:
+  c->cyc += 17;
+  c->pc = 0x0B6F;
+  i8080_aot_op_0xCD(c, 0x0B0E); // call $0B0E
+  n += 1;
+  JUMP(0x0B0E);
+
+b_0x0B6F:
+  if (!(i8080_aot_code(c, 0x0B6F, "\xD1\xE1\xF1\xC9", 4))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0B70;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0B70:
+  c->cyc += 10;
+  c->pc = 0x0B71;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0B71:
+  c->cyc += 10;
+  c->pc = 0x0B72;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0B72:
+  c->cyc += 10;
+  c->pc = 0x0B73;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x0B83:
+  if (!(i8080_aot_code(c, 0x0B83, "\xD5\x16\x00\x5F\x19\x7E\xD1\xC9", 8))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0B84;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0B83) < 8) {
+    goto dispatch;
+  }
+i_0x0B84:
+  i8080_aot_op_0x16(c, 0x0000); // mvi d,$00
+  n += 1;
+  i8080_aot_op_0x5F(c, 0x0000); // mov e,a
+  n += 1;
+  i8080_aot_op_0x19(c, 0x0000); // dad d
+  n += 1;
+  c->cyc += 29;
+  c->pc = 0x0B89;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0B89:
+  c->cyc += 10;
+  c->pc = 0x0B8A;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0B8A:
+  c->cyc += 10;
+  c->pc = 0x0B8B;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x0B8B:
+  if (!(i8080_aot_code(c, 0x0B8B, "\xF5\x7C\xCD\xA1\x0B", 5))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0B8C;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0B8B) < 5) {
+    goto dispatch;
+  }
+i_0x0B8C:
+  i8080_aot_op_0x7C(c, 0x0000); // mov a,h
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x0B90;
+  i8080_aot_op_0xCD(c, 0x0BA1); // call $0BA1
+  n += 1;
+  JUMP(0x0BA1);
+
+b_0x0B90:
+  if (!(i8080_aot_code(c, 0x0B90, "\x7D\xCD\xA1\x0B", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x7D(c, 0x0000); // mov a,l
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x0B94;
+  i8080_aot_op_0xCD(c, 0x0BA1); // call $0BA1
+  n += 1;
+  JUMP(0x0BA1);
+
+b_0x0B94:
+  if (!(i8080_aot_code(c, 0x0B94, "\xF1\xC9", 2))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0B95;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0B95:
+  c->cyc += 10;
+  c->pc = 0x0B96;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x0B96:
+  if (!(i8080_aot_code(c, 0x0B96, "\xF5\xCD\xA1\x0B", 4))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0B97;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0B96) < 4) {
+    goto dispatch;
+  }
+i_0x0B97:
+  c->cyc += 17;
+  c->pc = 0x0B9A;
+  i8080_aot_op_0xCD(c, 0x0BA1); // call $0BA1
+  n += 1;
+  JUMP(0x0BA1);
+
+b_0x0B9A:
+  if (!(i8080_aot_code(c, 0x0B9A, "\x3E\x48\xCD\x0E\x0B", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x0048); // mvi a,$48
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x0B9F;
+  i8080_aot_op_0xCD(c, 0x0B0E); // call $0B0E
+  n += 1;
+  JUMP(0x0B0E);
+
+b_0x0B9F:
+  if (!(i8080_aot_code(c, 0x0B9F, "\xF1\xC9", 2))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0BA0;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0BA0:
+  c->cyc += 10;
+  c->pc = 0x0BA1;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x0BA1:
+  if (!(i8080_aot_code(c, 0x0BA1, "\xF5\x0F\x0F\x0F\x0F\xCD\x5F\x0B", 8))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0BA2;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0BA1) < 8) {
+    goto dispatch;
+  }
+i_0x0BA2:
+  i8080_aot_op_0x0F(c, 0x0000); // rrc
+  n += 1;
+  i8080_aot_op_0x0F(c, 0x0000); // rrc
+  n += 1;
+  i8080_aot_op_0x0F(c, 0x0000); // rrc
+  n += 1;
+  i8080_aot_op_0x0F(c, 0x0000); // rrc
+  n += 1;
+  c->cyc += 33;
+  c->pc = 0x0BA9;
+  i8080_aot_op_0xCD(c, 0x0B5F); // call $0B5F
+  n += 1;
+  JUMP(0x0B5F);
+
+b_0x0BA9:
+  if (!(i8080_aot_code(c, 0x0BA9, "\x0F\x0F\x0F\x0F\xCD\x5F\x0B", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x0F(c, 0x0000); // rrc
+  n += 1;
+  i8080_aot_op_0x0F(c, 0x0000); // rrc
+  n += 1;
+  i8080_aot_op_0x0F(c, 0x0000); // rrc
+  n += 1;
+  i8080_aot_op_0x0F(c, 0x0000); // rrc
+  n += 1;
+  c->cyc += 33;
+  c->pc = 0x0BB0;
+  i8080_aot_op_0xCD(c, 0x0B5F); // call $0B5F
+  n += 1;
+  JUMP(0x0B5F);
+
+b_0x0BB0:
+  if (!(i8080_aot_code(c, 0x0BB0, "\xF1\xC9", 2))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0BB1;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0BB1:
+  c->cyc += 10;
+  c->pc = 0x0BB2;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x0C2B:
+  if (!(i8080_aot_code(c, 0x0C2B, "\xCD\xF6\x20", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0C2E;
+  i8080_aot_op_0xCD(c, 0x20F6); // call $20F6
+  n += 1;
+  JUMP(0x20F6);
+
+b_0x0C2E:
+  if (!(i8080_aot_code(c, 0x0C2E, "\xC7", 1))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0C2F;
+  i8080_aot_op_0xC7(c, 0x0000); // rst 0
+  n += 1;
+  goto dispatch;
+
+b_0x0C2F:
+  if (!(i8080_aot_code(c, 0x0C2F, "\xFE\x53\xCA\x0D\x09", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xFE(c, 0x0053); // cpi $53
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0C34;
+  i8080_aot_op_0xCA(c, 0x090D); // jz $090D
+  n += 1;
+  if (c->pc == 0x090D) {
+    JUMP(0x090D);
+  }
+  JUMP(0x0C34);
+
+b_0x0C34:
+  if (!(i8080_aot_code(c, 0x0C34, "\xFE\x43\xCA\x0D\x09", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xFE(c, 0x0043); // cpi $43
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0C39;
+  i8080_aot_op_0xCA(c, 0x090D); // jz $090D
+  n += 1;
+  if (c->pc == 0x090D) {
+    JUMP(0x090D);
+  }
+  JUMP(0x0C39);
+
+b_0x0C39:
+  if (!(i8080_aot_code(c, 0x0C39, "\xCD\x1B\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0C3C;
+  i8080_aot_op_0xCD(c, 0x0B1B); // call $0B1B
+  n += 1;
+  JUMP(0x0B1B);
+
+b_0x0C3C:
+  if (!(i8080_aot_code(c, 0x0C3C, "\x32\x4C\x0C\xF5\x2F\x3C\x32\x4D\x0C\xF1\xFE\x03\xC2\x0D\x09", 15))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x0C3F;
+  i8080_aot_op_0x32(c, 0x0C4C); // sta $0C4C
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0C3F:
+  c->cyc += 11;
+  c->pc = 0x0C40;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0C3F) < 12) {
+    goto dispatch;
+  }
+i_0x0C40:
+  i8080_aot_op_0x2F(c, 0x0000); // cma
+  n += 1;
+  i8080_aot_op_0x3C(c, 0x0000); // inr a
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x0C45;
+  i8080_aot_op_0x32(c, 0x0C4D); // sta $0C4D
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0C45:
+  c->cyc += 10;
+  c->pc = 0x0C46;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0C46:
+  i8080_aot_op_0xFE(c, 0x0003); // cpi $03
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0C4B;
+  i8080_aot_op_0xC2(c, 0x090D); // jnz $090D
+  n += 1;
+  if (c->pc == 0x090D) {
+    JUMP(0x090D);
+  }
+  JUMP(0x0C4B);
+
+b_0x0C4B:
+  if (!(i8080_aot_code(c, 0x0C4B, "\xC7", 1))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0C4C;
+  i8080_aot_op_0xC7(c, 0x0000); // rst 0
+  n += 1;
+  goto dispatch;
+
+b_0x0C4C:
+  if (!(i8080_aot_code(c, 0x0C4C, "\x03\xFD\xF5\x3A", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x03(c, 0x0000); // inx b
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x0C50;
+  i8080_aot_op_0xFD(c, 0x3AF5); // ill $3AF5
+  n += 1;
+  JUMP(0x3AF5);
+
+b_0x0C4E:
+  if (!(i8080_aot_code(c, 0x0C4E, "\xF5\x3A\x4C\x0C\xFE\x53\xCA\x0D\x09", 9))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0C4F;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0C4E) < 9) {
+    goto dispatch;
+  }
+i_0x0C4F:
+  c->cyc += 13;
+  c->pc = 0x0C52;
+  i8080_aot_op_0x3A(c, 0x0C4C); // lda $0C4C
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0C52:
+  i8080_aot_op_0xFE(c, 0x0053); // cpi $53
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0C57;
+  i8080_aot_op_0xCA(c, 0x090D); // jz $090D
+  n += 1;
+  if (c->pc == 0x090D) {
+    JUMP(0x090D);
+  }
+  JUMP(0x0C57);
+
+b_0x0C50:
+  if (!(i8080_aot_code(c, 0x0C50, "\x4C\x0C\xFE\x53\xCA\x0D\x09", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x4C(c, 0x0000); // mov c,h
+  n += 1;
+  i8080_aot_op_0x0C(c, 0x0000); // inr c
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x0053); // cpi $53
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x0C57;
+  i8080_aot_op_0xCA(c, 0x090D); // jz $090D
+  n += 1;
+  if (c->pc == 0x090D) {
+    JUMP(0x090D);
+  }
+  JUMP(0x0C57);
+
+b_0x0C57:
+  if (!(i8080_aot_code(c, 0x0C57, "\xCD\x4E\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0C5A;
+  i8080_aot_op_0xCD(c, 0x0B4E); // call $0B4E
+  n += 1;
+  JUMP(0x0B4E);
+
+b_0x0C5A:
+  if (!(i8080_aot_code(c, 0x0C5A, "\x07\x00\xF1\xC9", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x07(c, 0x0000); // rlc
+  n += 1;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x0C5D;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0C5D:
+  c->cyc += 10;
+  c->pc = 0x0C5E;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x0C65:
+  if (!(i8080_aot_code(c, 0x0C65, "\xCD\x4E\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0C68;
+  i8080_aot_op_0xCD(c, 0x0B4E); // call $0B4E
+  n += 1;
+  JUMP(0x0B4E);
+
+b_0x0C68:
+  if (!(i8080_aot_code(c, 0x0C68, "\x0D\x0A\x00\xC9", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x0C6A;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0C6A:
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x0C6C;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x0C6C:
+  if (!(i8080_aot_code(c, 0x0C6C, "\xCD\x4E\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0C6F;
+  i8080_aot_op_0xCD(c, 0x0B4E); // call $0B4E
+  n += 1;
+  JUMP(0x0B4E);
+
+b_0x0C6F:
+  if (!(i8080_aot_code(c, 0x0C6F, "\x20\x00\xC9", 3))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x0C72;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x2025:
+  if (!(i8080_aot_code(c, 0x2025, "\xF5\xE5\xD5\xC5\x0E\x0D\xCD\x05\x00", 9))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x2026;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x2025) < 9) {
+    goto dispatch;
+  }
+i_0x2026:
+  c->cyc += 11;
+  c->pc = 0x2027;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x2026) < 8) {
+    goto dispatch;
+  }
+i_0x2027:
+  c->cyc += 11;
+  c->pc = 0x2028;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x2027) < 7) {
+    goto dispatch;
+  }
+i_0x2028:
+  c->cyc += 11;
+  c->pc = 0x2029;
+  i8080_aot_op_0xC5(c, 0x0000); // push b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x2028) < 6) {
+    goto dispatch;
+  }
+i_0x2029:
+  i8080_aot_op_0x0E(c, 0x000D); // mvi c,$0D
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x202E;
+  i8080_aot_op_0xCD(c, 0x0005); // call $0005
+  n += 1;
+  goto dispatch;
+
+b_0x202E:
+  if (!(i8080_aot_code(c, 0x202E, "\x21\x80\x00\x22\x01\x20\x3E\x80\x32\x03\x20\xC1\xD1\xE1\xF1\xC9", 16))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x21(c, 0x0080); // lxi h,$0080
+  n += 1;
+  c->cyc += 26;
+  c->pc = 0x2034;
+  i8080_aot_op_0x22(c, 0x2001); // shld $2001
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x2034:
+  i8080_aot_op_0x3E(c, 0x0080); // mvi a,$80
+  n += 1;
+  c->cyc += 20;
+  c->pc = 0x2039;
+  i8080_aot_op_0x32(c, 0x2003); // sta $2003
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x2039:
+  c->cyc += 10;
+  c->pc = 0x203A;
+  i8080_aot_op_0xC1(c, 0x0000); // pop b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x203A:
+  c->cyc += 10;
+  c->pc = 0x203B;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x203B:
+  c->cyc += 10;
+  c->pc = 0x203C;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x203C:
+  c->cyc += 10;
+  c->pc = 0x203D;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x203D:
+  c->cyc += 10;
+  c->pc = 0x203E;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x203E:
+  if (!(i8080_aot_code(c, 0x203E, "\xE5\xD5\xC5\x11\x04\x20\x0E\x0F\xCD\x05\x00", 11))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x203F;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x203E) < 11) {
+    goto dispatch;
+  }
+i_0x203F:
+  c->cyc += 11;
+  c->pc = 0x2040;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x203F) < 10) {
+    goto dispatch;
+  }
+i_0x2040:
+  c->cyc += 11;
+  c->pc = 0x2041;
+  i8080_aot_op_0xC5(c, 0x0000); // push b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x2040) < 9) {
+    goto dispatch;
+  }
+i_0x2041:
+  i8080_aot_op_0x11(c, 0x2004); // lxi d,$2004
+  n += 1;
+  i8080_aot_op_0x0E(c, 0x000F); // mvi c,$0F
+  n += 1;
+  c->cyc += 34;
+  c->pc = 0x2049;
+  i8080_aot_op_0xCD(c, 0x0005); // call $0005
+  n += 1;
+  goto dispatch;
+
+b_0x2049:
+  if (!(i8080_aot_code(c, 0x2049, "\xFE\xFF\xC2\x52\x20", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xFE(c, 0x00FF); // cpi $FF
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x204E;
+  i8080_aot_op_0xC2(c, 0x2052); // jnz $2052
+  n += 1;
+  if (c->pc == 0x2052) {
+    JUMP(0x2052);
+  }
+  JUMP(0x204E);
+
+b_0x204E:
+  if (!(i8080_aot_code(c, 0x204E, "\x37\xC3\x53\x20", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x37(c, 0x0000); // stc
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x2052;
+  i8080_aot_op_0xC3(c, 0x2053); // jmp $2053
+  n += 1;
+  JUMP(0x2053);
+
+b_0x2052:
+  if (!(i8080_aot_code(c, 0x2052, "\xA7", 1))) {
+    goto fallback;
+  }
+  c->cyc += 4;
+  c->pc = 0x2053;
+  i8080_aot_op_0xA7(c, 0x0000); // ana a
+  n += 1;
+  JUMP(0x2053);
+
+b_0x2053:
+  if (!(i8080_aot_code(c, 0x2053, "\xC1\xD1\xE1\xC9", 4))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x2054;
+  i8080_aot_op_0xC1(c, 0x0000); // pop b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x2054:
+  c->cyc += 10;
+  c->pc = 0x2055;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x2055:
+  c->cyc += 10;
+  c->pc = 0x2056;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x2056:
+  c->cyc += 10;
+  c->pc = 0x2057;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x2057:
+  if (!(i8080_aot_code(c, 0x2057, "\xE5\xD5\xC5\x0E\x16\xCD\x05\x00", 8))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x2058;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x2057) < 8) {
+    goto dispatch;
+  }
+i_0x2058:
+  c->cyc += 11;
+  c->pc = 0x2059;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x2058) < 7) {
+    goto dispatch;
+  }
+i_0x2059:
+  c->cyc += 11;
+  c->pc = 0x205A;
+  i8080_aot_op_0xC5(c, 0x0000); // push b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x2059) < 6) {
+    goto dispatch;
+  }
+i_0x205A:
+  i8080_aot_op_0x0E(c, 0x0016); // mvi c,$16
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x205F;
+  i8080_aot_op_0xCD(c, 0x0005); // call $0005
+  n += 1;
+  goto dispatch;
+
+b_0x205F:
+  if (!(i8080_aot_code(c, 0x205F, "\xFE\xFF\xC2\x68\x20", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xFE(c, 0x00FF); // cpi $FF
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x2064;
+  i8080_aot_op_0xC2(c, 0x2068); // jnz $2068
+  n += 1;
+  if (c->pc == 0x2068) {
+    JUMP(0x2068);
+  }
+  JUMP(0x2064);
+
+b_0x2064:
+  if (!(i8080_aot_code(c, 0x2064, "\x37\xC3\x69\x20", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x37(c, 0x0000); // stc
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x2068;
+  i8080_aot_op_0xC3(c, 0x2069); // jmp $2069
+  n += 1;
+  JUMP(0x2069);
+
+b_0x2068:
+  if (!(i8080_aot_code(c, 0x2068, "\xA7", 1))) {
+    goto fallback;
+  }
+  c->cyc += 4;
+  c->pc = 0x2069;
+  i8080_aot_op_0xA7(c, 0x0000); // ana a
+  n += 1;
+  JUMP(0x2069);
+
+b_0x2069:
+  if (!(i8080_aot_code(c, 0x2069, "\xC1\xD1\xE1\xC9", 4))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x206A;
+  i8080_aot_op_0xC1(c, 0x0000); // pop b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x206A:
+  c->cyc += 10;
+  c->pc = 0x206B;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x206B:
+  c->cyc += 10;
+  c->pc = 0x206C;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x206C:
+  c->cyc += 10;
+  c->pc = 0x206D;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x206D:
+  if (!(i8080_aot_code(c, 0x206D, "\xE5\xD5\xC5\x0E\x14\xCD\x05\x00", 8))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x206E;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x206D) < 8) {
+    goto dispatch;
+  }
+i_0x206E:
+  c->cyc += 11;
+  c->pc = 0x206F;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x206E) < 7) {
+    goto dispatch;
+  }
+i_0x206F:
+  c->cyc += 11;
+  c->pc = 0x2070;
+  i8080_aot_op_0xC5(c, 0x0000); // push b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x206F) < 6) {
+    goto dispatch;
+  }
+i_0x2070:
+  i8080_aot_op_0x0E(c, 0x0014); // mvi c,$14
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x2075;
+  i8080_aot_op_0xCD(c, 0x0005); // call $0005
+  n += 1;
+  goto dispatch;
+
+b_0x2075:
+  if (!(i8080_aot_code(c, 0x2075, "\xA7\xCA\x7A\x20", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xA7(c, 0x0000); // ana a
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x2079;
+  i8080_aot_op_0xCA(c, 0x207A); // jz $207A
+  n += 1;
+  if (c->pc == 0x207A) {
+    JUMP(0x207A);
+  }
+  JUMP(0x2079);
+
+b_0x2079:
+  if (!(i8080_aot_code(c, 0x2079, "\x37", 1))) {
+    goto fallback;
+  }
+  c->cyc += 4;
+  c->pc = 0x207A;
+  i8080_aot_op_0x37(c, 0x0000); // stc
+  n += 1;
+  JUMP(0x207A);
+
+b_0x207A:
+  if (!(i8080_aot_code(c, 0x207A, "\xC1\xD1\xE1\xC9", 4))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x207B;
+  i8080_aot_op_0xC1(c, 0x0000); // pop b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x207B:
+  c->cyc += 10;
+  c->pc = 0x207C;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x207C:
+  c->cyc += 10;
+  c->pc = 0x207D;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x207D:
+  c->cyc += 10;
+  c->pc = 0x207E;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x207E:
+  if (!(i8080_aot_code(c, 0x207E, "\xD5\xC5", 2))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x207F;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x207E) < 2) {
+    goto dispatch;
+  }
+i_0x207F:
+  c->cyc += 11;
+  c->pc = 0x2080;
+  i8080_aot_op_0xC5(c, 0x0000); // push b
+  n += 1;
+  JUMP(0x2080);
+
+b_0x2080:
+  if (!(i8080_aot_code(c, 0x2080, "\xCD\x6D\x20", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x2083;
+  i8080_aot_op_0xCD(c, 0x206D); // call $206D
+  n += 1;
+  JUMP(0x206D);
+
+b_0x2083:
+  if (!(i8080_aot_code(c, 0x2083, "\xD2\x80\x20", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x2086;
+  i8080_aot_op_0xD2(c, 0x2080); // jnc $2080
+  n += 1;
+  if (c->pc == 0x2080) {
+    JUMP(0x2080);
+  }
+  JUMP(0x2086);
+
+b_0x2086:
+  if (!(i8080_aot_code(c, 0x2086, "\xFE\x01\xCA\x8F\x20", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xFE(c, 0x0001); // cpi $01
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x208B;
+  i8080_aot_op_0xCA(c, 0x208F); // jz $208F
+  n += 1;
+  if (c->pc == 0x208F) {
+    JUMP(0x208F);
+  }
+  JUMP(0x208B);
+
+b_0x208B:
+  if (!(i8080_aot_code(c, 0x208B, "\x37\xC3\xA9\x20", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x37(c, 0x0000); // stc
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x208F;
+  i8080_aot_op_0xC3(c, 0x20A9); // jmp $20A9
+  n += 1;
+  JUMP(0x20A9);
+
+b_0x208F:
+  if (!(i8080_aot_code(c, 0x208F, "\x3A\x24\x20\x3D\x32\x24\x20\x21\x80\x00\x06\x80\x3E\x1A", 14))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x2092;
+  i8080_aot_op_0x3A(c, 0x2024); // lda $2024
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x2092:
+  i8080_aot_op_0x3D(c, 0x0000); // dcr a
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x2096;
+  i8080_aot_op_0x32(c, 0x2024); // sta $2024
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x2096:
+  i8080_aot_op_0x21(c, 0x0080); // lxi h,$0080
+  n += 1;
+  i8080_aot_op_0x06(c, 0x0080); // mvi b,$80
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x209D;
+  i8080_aot_op_0x3E(c, 0x001A); // mvi a,$1A
+  n += 1;
+  JUMP(0x209D);
+
+b_0x209D:
+  if (!(i8080_aot_code(c, 0x209D, "\xBE\xCA\xA9\x20", 4))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x209E;
+  i8080_aot_op_0xBE(c, 0x0000); // cmp M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x209E:
+  c->cyc += 10;
+  c->pc = 0x20A1;
+  i8080_aot_op_0xCA(c, 0x20A9); // jz $20A9
+  n += 1;
+  if (c->pc == 0x20A9) {
+    JUMP(0x20A9);
+  }
+  JUMP(0x20A1);
+
+b_0x20A1:
+  if (!(i8080_aot_code(c, 0x20A1, "\x23\x05\xC2\x9D\x20", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  i8080_aot_op_0x05(c, 0x0000); // dcr b
+  n += 1;
+  c->cyc += 20;
+  c->pc = 0x20A6;
+  i8080_aot_op_0xC2(c, 0x209D); // jnz $209D
+  n += 1;
+  if (c->pc == 0x209D) {
+    JUMP(0x209D);
+  }
+  JUMP(0x20A6);
+
+b_0x20A6:
+  if (!(i8080_aot_code(c, 0x20A6, "\x21\x00\x00", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x20A9;
+  i8080_aot_op_0x21(c, 0x0000); // lxi h,$0000
+  n += 1;
+  JUMP(0x20A9);
+
+b_0x20A9:
+  if (!(i8080_aot_code(c, 0x20A9, "\xC1\xD1\xC9", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x20AA;
+  i8080_aot_op_0xC1(c, 0x0000); // pop b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x20AA:
+  c->cyc += 10;
+  c->pc = 0x20AB;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x20AB:
+  c->cyc += 10;
+  c->pc = 0x20AC;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x20AC:
+  if (!(i8080_aot_code(c, 0x20AC, "\xE5\xD5\xC5\x0E\x15\xCD\x05\x00", 8))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x20AD;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x20AC) < 8) {
+    goto dispatch;
+  }
+i_0x20AD:
+  c->cyc += 11;
+  c->pc = 0x20AE;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x20AD) < 7) {
+    goto dispatch;
+  }
+i_0x20AE:
+  c->cyc += 11;
+  c->pc = 0x20AF;
+  i8080_aot_op_0xC5(c, 0x0000); // push b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x20AE) < 6) {
+    goto dispatch;
+  }
+i_0x20AF:
+  i8080_aot_op_0x0E(c, 0x0015); // mvi c,$15
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x20B4;
+  i8080_aot_op_0xCD(c, 0x0005); // call $0005
+  n += 1;
+  goto dispatch;
+
+b_0x20B4:
+  if (!(i8080_aot_code(c, 0x20B4, "\xA7\xCA\xB9\x20", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xA7(c, 0x0000); // ana a
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x20B8;
+  i8080_aot_op_0xCA(c, 0x20B9); // jz $20B9
+  n += 1;
+  if (c->pc == 0x20B9) {
+    JUMP(0x20B9);
+  }
+  JUMP(0x20B8);
+
+b_0x20B8:
+  if (!(i8080_aot_code(c, 0x20B8, "\x37", 1))) {
+    goto fallback;
+  }
+  c->cyc += 4;
+  c->pc = 0x20B9;
+  i8080_aot_op_0x37(c, 0x0000); // stc
+  n += 1;
+  JUMP(0x20B9);
+
+b_0x20B9:
+  if (!(i8080_aot_code(c, 0x20B9, "\xC1\xD1\xE1\xC9", 4))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x20BA;
+  i8080_aot_op_0xC1(c, 0x0000); // pop b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x20BA:
+  c->cyc += 10;
+  c->pc = 0x20BB;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x20BB:
+  c->cyc += 10;
+  c->pc = 0x20BC;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x20BC:
+  c->cyc += 10;
+  c->pc = 0x20BD;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x20BD:
+  if (!(i8080_aot_code(c, 0x20BD, "\xF5\x0E\x02\xCD\x05\x00", 6))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x20BE;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x20BD) < 6) {
+    goto dispatch;
+  }
+i_0x20BE:
+  i8080_aot_op_0x0E(c, 0x0002); // mvi c,$02
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x20C3;
+  i8080_aot_op_0xCD(c, 0x0005); // call $0005
+  n += 1;
+  goto dispatch;
+
+b_0x20C3:
+  if (!(i8080_aot_code(c, 0x20C3, "\x3A\x00\x20\xB7\xC2\xCC\x20", 7))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x20C6;
+  i8080_aot_op_0x3A(c, 0x2000); // lda $2000
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x20C6:
+  i8080_aot_op_0xB7(c, 0x0000); // ora a
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x20CA;
+  i8080_aot_op_0xC2(c, 0x20CC); // jnz $20CC
+  n += 1;
+  if (c->pc == 0x20CC) {
+    JUMP(0x20CC);
+  }
+  JUMP(0x20CA);
+
+b_0x20CA:
+  if (!(i8080_aot_code(c, 0x20CA, "\xF1\xC9", 2))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x20CB;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x20CB:
+  c->cyc += 10;
+  c->pc = 0x20CC;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x20CC:
+  if (!(i8080_aot_code(c, 0x20CC, "\xF1\xE5\xD5\xC5\x4F\x2A\x01\x20\x77\x23\x3A\x03\x20\x3D\xC2\xEB\x20", 17))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x20CD;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x20CD:
+  c->cyc += 11;
+  c->pc = 0x20CE;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x20CD) < 16) {
+    goto dispatch;
+  }
+i_0x20CE:
+  c->cyc += 11;
+  c->pc = 0x20CF;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x20CE) < 15) {
+    goto dispatch;
+  }
+i_0x20CF:
+  c->cyc += 11;
+  c->pc = 0x20D0;
+  i8080_aot_op_0xC5(c, 0x0000); // push b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x20CF) < 14) {
+    goto dispatch;
+  }
+i_0x20D0:
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  c->cyc += 21;
+  c->pc = 0x20D4;
+  i8080_aot_op_0x2A(c, 0x2001); // lhld $2001
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x20D4:
+  c->cyc += 7;
+  c->pc = 0x20D5;
+  i8080_aot_op_0x77(c, 0x0000); // mov M,a
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x20D5) < 8) {
+    goto dispatch;
+  }
+i_0x20D5:
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x20D9;
+  i8080_aot_op_0x3A(c, 0x2003); // lda $2003
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x20D9:
+  i8080_aot_op_0x3D(c, 0x0000); // dcr a
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x20DD;
+  i8080_aot_op_0xC2(c, 0x20EB); // jnz $20EB
+  n += 1;
+  if (c->pc == 0x20EB) {
+    JUMP(0x20EB);
+  }
+  JUMP(0x20DD);
+
+b_0x20DD:
+  if (!(i8080_aot_code(c, 0x20DD, "\x11\x04\x20\xCD\xAC\x20", 6))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x11(c, 0x2004); // lxi d,$2004
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x20E3;
+  i8080_aot_op_0xCD(c, 0x20AC); // call $20AC
+  n += 1;
+  JUMP(0x20AC);
+
+b_0x20E3:
+  if (!(i8080_aot_code(c, 0x20E3, "\xDA\xEB\x20", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x20E6;
+  i8080_aot_op_0xDA(c, 0x20EB); // jc $20EB
+  n += 1;
+  if (c->pc == 0x20EB) {
+    JUMP(0x20EB);
+  }
+  JUMP(0x20E6);
+
+b_0x20E6:
+  if (!(i8080_aot_code(c, 0x20E6, "\x3E\x80\x21\x80\x00", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x0080); // mvi a,$80
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x20EB;
+  i8080_aot_op_0x21(c, 0x0080); // lxi h,$0080
+  n += 1;
+  JUMP(0x20EB);
+
+b_0x20EB:
+  if (!(i8080_aot_code(c, 0x20EB, "\x22\x01\x20\x32\x03\x20\x79\xC1\xD1\xE1\xC9", 11))) {
+    goto fallback;
+  }
+  c->cyc += 16;
+  c->pc = 0x20EE;
+  i8080_aot_op_0x22(c, 0x2001); // shld $2001
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x20EE:
+  c->cyc += 13;
+  c->pc = 0x20F1;
+  i8080_aot_op_0x32(c, 0x2003); // sta $2003
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x20F1:
+  i8080_aot_op_0x79(c, 0x0000); // mov a,c
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x20F3;
+  i8080_aot_op_0xC1(c, 0x0000); // pop b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x20F3:
+  c->cyc += 10;
+  c->pc = 0x20F4;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x20F4:
+  c->cyc += 10;
+  c->pc = 0x20F5;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x20F5:
+  c->cyc += 10;
+  c->pc = 0x20F6;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x20F6:
+  if (!(i8080_aot_code(c, 0x20F6, "\xF5\x3A\x00\x20\xB7\xC2\x00\x21", 8))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x20F7;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x20F6) < 8) {
+    goto dispatch;
+  }
+i_0x20F7:
+  c->cyc += 13;
+  c->pc = 0x20FA;
+  i8080_aot_op_0x3A(c, 0x2000); // lda $2000
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x20FA:
+  i8080_aot_op_0xB7(c, 0x0000); // ora a
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x20FE;
+  i8080_aot_op_0xC2(c, 0x2100); // jnz $2100
+  n += 1;
+  if (c->pc == 0x2100) {
+    JUMP(0x2100);
+  }
+  JUMP(0x20FE);
+
+b_0x20FE:
+  if (!(i8080_aot_code(c, 0x20FE, "\xF1\xC9", 2))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x20FF;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x20FF:
+  c->cyc += 10;
+  c->pc = 0x2100;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x2100:
+  if (!(i8080_aot_code(c, 0x2100, "\xE5\xD5\xC5\x2A\x01\x20\x36\x1A\x11\x04\x20\xCD\xAC\x20", 14))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x2101;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x2100) < 14) {
+    goto dispatch;
+  }
+i_0x2101:
+  c->cyc += 11;
+  c->pc = 0x2102;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x2101) < 13) {
+    goto dispatch;
+  }
+i_0x2102:
+  c->cyc += 11;
+  c->pc = 0x2103;
+  i8080_aot_op_0xC5(c, 0x0000); // push b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x2102) < 12) {
+    goto dispatch;
+  }
+i_0x2103:
+  c->cyc += 16;
+  c->pc = 0x2106;
+  i8080_aot_op_0x2A(c, 0x2001); // lhld $2001
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x2106:
+  c->cyc += 10;
+  c->pc = 0x2108;
+  i8080_aot_op_0x36(c, 0x001A); // mvi M,$1A
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x2108) < 6) {
+    goto dispatch;
+  }
+i_0x2108:
+  i8080_aot_op_0x11(c, 0x2004); // lxi d,$2004
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x210E;
+  i8080_aot_op_0xCD(c, 0x20AC); // call $20AC
+  n += 1;
+  JUMP(0x20AC);
+
+b_0x210E:
+  if (!(i8080_aot_code(c, 0x210E, "\xD2\x26\x21", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x2111;
+  i8080_aot_op_0xD2(c, 0x2126); // jnc $2126
+  n += 1;
+  if (c->pc == 0x2126) {
+    JUMP(0x2126);
+  }
+  JUMP(0x2111);
+
+b_0x2111:
+  if (!(i8080_aot_code(c, 0x2111, "\xCD\x4E\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x2114;
+  i8080_aot_op_0xCD(c, 0x0B4E); // call $0B4E
+  n += 1;
+  JUMP(0x0B4E);
+
+b_0x2114:
+  if (!(i8080_aot_code(c, 0x2114, "\x43\x41\x4E\x4E\x4F\x54\x20\x46\x4C\x55\x53\x48\x20\x46\x49\x4C", 16))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  i8080_aot_op_0x41(c, 0x0000); // mov b,c
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x2117;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x2117:
+  c->cyc += 7;
+  c->pc = 0x2118;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x2118:
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  c->cyc += 21;
+  c->pc = 0x211C;
+  i8080_aot_op_0x46(c, 0x0000); // mov b,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x211C:
+  i8080_aot_op_0x4C(c, 0x0000); // mov c,h
+  n += 1;
+  i8080_aot_op_0x55(c, 0x0000); // mov d,l
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x48(c, 0x0000); // mov c,b
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  c->cyc += 31;
+  c->pc = 0x2122;
+  i8080_aot_op_0x46(c, 0x0000); // mov b,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x2122:
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  c->cyc += 10;
+  c->pc = 0x2124;
+  i8080_aot_op_0x4C(c, 0x0000); // mov c,h
+  n += 1;
+  JUMP(0x2124);
+
+b_0x2124:
+  if (!(i8080_aot_code(c, 0x2124, "\x45\x00", 2))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  c->cyc += 9;
+  c->pc = 0x2126;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  JUMP(0x2126);
+
+b_0x2126:
+  if (!(i8080_aot_code(c, 0x2126, "\x0E\x10\xCD\x05\x00", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x0E(c, 0x0010); // mvi c,$10
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x212B;
+  i8080_aot_op_0xCD(c, 0x0005); // call $0005
+  n += 1;
+  goto dispatch;
+
+b_0x212B:
+  if (!(i8080_aot_code(c, 0x212B, "\xFE\xFF\xC2\x4A\x21", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xFE(c, 0x00FF); // cpi $FF
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x2130;
+  i8080_aot_op_0xC2(c, 0x214A); // jnz $214A
+  n += 1;
+  if (c->pc == 0x214A) {
+    JUMP(0x214A);
+  }
+  JUMP(0x2130);
+
+b_0x2130:
+  if (!(i8080_aot_code(c, 0x2130, "\xCD\x4E\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x2133;
+  i8080_aot_op_0xCD(c, 0x0B4E); // call $0B4E
+  n += 1;
+  JUMP(0x0B4E);
+
+b_0x2133:
+  if (!(i8080_aot_code(c, 0x2133, "\x43\x41\x4E\x4E\x4F\x54\x20\x43\x4C\x4F\x53\x45\x20\x54\x48\x45", 16))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  i8080_aot_op_0x41(c, 0x0000); // mov b,c
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x2136;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x2136:
+  c->cyc += 7;
+  c->pc = 0x2137;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x2137:
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  i8080_aot_op_0x4C(c, 0x0000); // mov c,h
+  n += 1;
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x48(c, 0x0000); // mov c,b
+  n += 1;
+  c->cyc += 58;
+  c->pc = 0x2143;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  JUMP(0x2143);
+
+b_0x2143:
+  if (!(i8080_aot_code(c, 0x2143, "\x20\x46\x49\x4C\x45\x00\xC7", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  c->cyc += 11;
+  c->pc = 0x2145;
+  i8080_aot_op_0x46(c, 0x0000); // mov b,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x2145:
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  i8080_aot_op_0x4C(c, 0x0000); // mov c,h
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 30;
+  c->pc = 0x214A;
+  i8080_aot_op_0xC7(c, 0x0000); // rst 0
+  n += 1;
+  goto dispatch;
+
+b_0x214A:
+  if (!(i8080_aot_code(c, 0x214A, "\xC1\xD1\xE1\xF1\xC9", 5))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x214B;
+  i8080_aot_op_0xC1(c, 0x0000); // pop b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x214B:
+  c->cyc += 10;
+  c->pc = 0x214C;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x214C:
+  c->cyc += 10;
+  c->pc = 0x214D;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x214D:
+  c->cyc += 10;
+  c->pc = 0x214E;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x214E:
+  c->cyc += 10;
+  c->pc = 0x214F;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x214F:
+  if (!(i8080_aot_code(c, 0x214F, "\xF5\xE5\xD5\xC5\xAF\x32\x00\x20\x21\x80\x00\x7E\xFE\x04\xC2\x0A\x22", 17))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x2150;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x214F) < 17) {
+    goto dispatch;
+  }
+i_0x2150:
+  c->cyc += 11;
+  c->pc = 0x2151;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x2150) < 16) {
+    goto dispatch;
+  }
+i_0x2151:
+  c->cyc += 11;
+  c->pc = 0x2152;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x2151) < 15) {
+    goto dispatch;
+  }
+i_0x2152:
+  c->cyc += 11;
+  c->pc = 0x2153;
+  i8080_aot_op_0xC5(c, 0x0000); // push b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x2152) < 14) {
+    goto dispatch;
+  }
+i_0x2153:
+  i8080_aot_op_0xAF(c, 0x0000); // xra a
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x2157;
+  i8080_aot_op_0x32(c, 0x2000); // sta $2000
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x2157:
+  i8080_aot_op_0x21(c, 0x0080); // lxi h,$0080
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x215B;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x215B:
+  i8080_aot_op_0xFE(c, 0x0004); // cpi $04
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x2160;
+  i8080_aot_op_0xC2(c, 0x220A); // jnz $220A
+  n += 1;
+  if (c->pc == 0x220A) {
+    JUMP(0x220A);
+  }
+  JUMP(0x2160);
+
+b_0x2160:
+  if (!(i8080_aot_code(c, 0x2160, "\x23\x7E\xFE\x20\xC2\x0A\x22", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x2162;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x2162:
+  i8080_aot_op_0xFE(c, 0x0020); // cpi $20
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x2167;
+  i8080_aot_op_0xC2(c, 0x220A); // jnz $220A
+  n += 1;
+  if (c->pc == 0x220A) {
+    JUMP(0x220A);
+  }
+  JUMP(0x2167);
+
+b_0x2167:
+  if (!(i8080_aot_code(c, 0x2167, "\x23\x7E\xFE\x4C\xC2\x0A\x22", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x2169;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x2169:
+  i8080_aot_op_0xFE(c, 0x004C); // cpi $4C
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x216E;
+  i8080_aot_op_0xC2(c, 0x220A); // jnz $220A
+  n += 1;
+  if (c->pc == 0x220A) {
+    JUMP(0x220A);
+  }
+  JUMP(0x216E);
+
+b_0x216E:
+  if (!(i8080_aot_code(c, 0x216E, "\x23\x7E\xFE\x4F\xC2\x0A\x22", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x2170;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x2170:
+  i8080_aot_op_0xFE(c, 0x004F); // cpi $4F
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x2175;
+  i8080_aot_op_0xC2(c, 0x220A); // jnz $220A
+  n += 1;
+  if (c->pc == 0x220A) {
+    JUMP(0x220A);
+  }
+  JUMP(0x2175);
+
+b_0x2175:
+  if (!(i8080_aot_code(c, 0x2175, "\x23\x7E\xFE\x47\xC2\x0A\x22", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x2177;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x2177:
+  i8080_aot_op_0xFE(c, 0x0047); // cpi $47
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x217C;
+  i8080_aot_op_0xC2(c, 0x220A); // jnz $220A
+  n += 1;
+  if (c->pc == 0x220A) {
+    JUMP(0x220A);
+  }
+  JUMP(0x217C);
+
+b_0x217C:
+  if (!(i8080_aot_code(c, 0x217C, "\x3E\x01\x32\x00\x20\xCD\x25\x20", 8))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x0001); // mvi a,$01
+  n += 1;
+  c->cyc += 20;
+  c->pc = 0x2181;
+  i8080_aot_op_0x32(c, 0x2000); // sta $2000
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x2181:
+  c->cyc += 17;
+  c->pc = 0x2184;
+  i8080_aot_op_0xCD(c, 0x2025); // call $2025
+  n += 1;
+  JUMP(0x2025);
+
+b_0x2184:
+  if (!(i8080_aot_code(c, 0x2184, "\x11\x04\x20\xCD\x3E\x20", 6))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x11(c, 0x2004); // lxi d,$2004
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x218A;
+  i8080_aot_op_0xCD(c, 0x203E); // call $203E
+  n += 1;
+  JUMP(0x203E);
+
+b_0x218A:
+  if (!(i8080_aot_code(c, 0x218A, "\xD2\xC9\x21", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x218D;
+  i8080_aot_op_0xD2(c, 0x21C9); // jnc $21C9
+  n += 1;
+  if (c->pc == 0x21C9) {
+    JUMP(0x21C9);
+  }
+  JUMP(0x218D);
+
+b_0x218D:
+  if (!(i8080_aot_code(c, 0x218D, "\xCD\x57\x20", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x2190;
+  i8080_aot_op_0xCD(c, 0x2057); // call $2057
+  n += 1;
+  JUMP(0x2057);
+
+b_0x2190:
+  if (!(i8080_aot_code(c, 0x2190, "\xD2\xAE\x21", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x2193;
+  i8080_aot_op_0xD2(c, 0x21AE); // jnc $21AE
+  n += 1;
+  if (c->pc == 0x21AE) {
+    JUMP(0x21AE);
+  }
+  JUMP(0x2193);
+
+b_0x2193:
+  if (!(i8080_aot_code(c, 0x2193, "\xCD\x4E\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x2196;
+  i8080_aot_op_0xCD(c, 0x0B4E); // call $0B4E
+  n += 1;
+  JUMP(0x0B4E);
+
+b_0x2196:
+  if (!(i8080_aot_code(c, 0x2196, "\x44\x49\x53\x4B\x20\x4F\x52\x20\x44\x49\x52\x45\x43\x54\x4F\x52", 16))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x44(c, 0x0000); // mov b,h
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x4B(c, 0x0000); // mov c,e
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x44(c, 0x0000); // mov b,h
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  c->cyc += 78;
+  c->pc = 0x21A6;
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  JUMP(0x21A6);
+
+b_0x21A6:
+  if (!(i8080_aot_code(c, 0x21A6, "\x59\x20\x46\x55\x4C\x4C\x00\xC7", 8))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x59(c, 0x0000); // mov e,c
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  c->cyc += 16;
+  c->pc = 0x21A9;
+  i8080_aot_op_0x46(c, 0x0000); // mov b,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x21A9:
+  i8080_aot_op_0x55(c, 0x0000); // mov d,l
+  n += 1;
+  i8080_aot_op_0x4C(c, 0x0000); // mov c,h
+  n += 1;
+  i8080_aot_op_0x4C(c, 0x0000); // mov c,h
+  n += 1;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 30;
+  c->pc = 0x21AE;
+  i8080_aot_op_0xC7(c, 0x0000); // rst 0
+  n += 1;
+  goto dispatch;
+
+b_0x21AE:
+  if (!(i8080_aot_code(c, 0x21AE, "\xCD\x3E\x20", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x21B1;
+  i8080_aot_op_0xCD(c, 0x203E); // call $203E
+  n += 1;
+  JUMP(0x203E);
+
+b_0x21B1:
+  if (!(i8080_aot_code(c, 0x21B1, "\xD2\x0A\x22", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x21B4;
+  i8080_aot_op_0xD2(c, 0x220A); // jnc $220A
+  n += 1;
+  if (c->pc == 0x220A) {
+    JUMP(0x220A);
+  }
+  JUMP(0x21B4);
+
+b_0x21B4:
+  if (!(i8080_aot_code(c, 0x21B4, "\xCD\x4E\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x21B7;
+  i8080_aot_op_0xCD(c, 0x0B4E); // call $0B4E
+  n += 1;
+  JUMP(0x0B4E);
+
+b_0x21B7:
+  if (!(i8080_aot_code(c, 0x21B7, "\x43\x41\x4E\x4E\x4F\x54\x20\x4F\x50\x45\x4E\x20\x46\x49\x4C\x45", 16))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  i8080_aot_op_0x41(c, 0x0000); // mov b,c
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x21BA;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x21BA:
+  c->cyc += 7;
+  c->pc = 0x21BB;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x21BB:
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  i8080_aot_op_0x50(c, 0x0000); // mov d,b
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  c->cyc += 36;
+  c->pc = 0x21C2;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x21C2:
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  c->cyc += 11;
+  c->pc = 0x21C4;
+  i8080_aot_op_0x46(c, 0x0000); // mov b,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x21C4:
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  i8080_aot_op_0x4C(c, 0x0000); // mov c,h
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x21C7;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  JUMP(0x21C7);
+
+b_0x21C7:
+  if (!(i8080_aot_code(c, 0x21C7, "\x00\xC7", 2))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x21C9;
+  i8080_aot_op_0xC7(c, 0x0000); // rst 0
+  n += 1;
+  goto dispatch;
+
+b_0x21C9:
+  if (!(i8080_aot_code(c, 0x21C9, "\xCD\x7E\x20", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x21CC;
+  i8080_aot_op_0xCD(c, 0x207E); // call $207E
+  n += 1;
+  JUMP(0x207E);
+
+b_0x21CC:
+  if (!(i8080_aot_code(c, 0x21CC, "\xD2\xE4\x21", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x21CF;
+  i8080_aot_op_0xD2(c, 0x21E4); // jnc $21E4
+  n += 1;
+  if (c->pc == 0x21E4) {
+    JUMP(0x21E4);
+  }
+  JUMP(0x21CF);
+
+b_0x21CF:
+  if (!(i8080_aot_code(c, 0x21CF, "\xCD\x4E\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x21D2;
+  i8080_aot_op_0xCD(c, 0x0B4E); // call $0B4E
+  n += 1;
+  JUMP(0x0B4E);
+
+b_0x21D2:
+  if (!(i8080_aot_code(c, 0x21D2, "\x43\x41\x4E\x4E\x4F\x54\x20\x52\x45\x41\x44\x20\x46\x49\x4C\x45", 16))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  i8080_aot_op_0x41(c, 0x0000); // mov b,c
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x21D5;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x21D5:
+  c->cyc += 7;
+  c->pc = 0x21D6;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x21D6:
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x41(c, 0x0000); // mov b,c
+  n += 1;
+  i8080_aot_op_0x44(c, 0x0000); // mov b,h
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  c->cyc += 45;
+  c->pc = 0x21DF;
+  i8080_aot_op_0x46(c, 0x0000); // mov b,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x21DF:
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  i8080_aot_op_0x4C(c, 0x0000); // mov c,h
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x21E2;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  JUMP(0x21E2);
+
+b_0x21E2:
+  if (!(i8080_aot_code(c, 0x21E2, "\x00\xC7", 2))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x21E4;
+  i8080_aot_op_0xC7(c, 0x0000); // rst 0
+  n += 1;
+  goto dispatch;
+
+b_0x21E4:
+  if (!(i8080_aot_code(c, 0x21E4, "\x22\x01\x20\x11\x00\x01\x7B\x95\x32\x03\x20\x7A\x9C\xD2\x0A\x22", 16))) {
+    goto fallback;
+  }
+  c->cyc += 16;
+  c->pc = 0x21E7;
+  i8080_aot_op_0x22(c, 0x2001); // shld $2001
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x21E7:
+  i8080_aot_op_0x11(c, 0x0100); // lxi d,$0100
+  n += 1;
+  i8080_aot_op_0x7B(c, 0x0000); // mov a,e
+  n += 1;
+  i8080_aot_op_0x95(c, 0x0000); // sub l
+  n += 1;
+  c->cyc += 32;
+  c->pc = 0x21EF;
+  i8080_aot_op_0x32(c, 0x2003); // sta $2003
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x21EF:
+  i8080_aot_op_0x7A(c, 0x0000); // mov a,d
+  n += 1;
+  i8080_aot_op_0x9C(c, 0x0000); // sbb h
+  n += 1;
+  c->cyc += 19;
+  c->pc = 0x21F4;
+  i8080_aot_op_0xD2(c, 0x220A); // jnc $220A
+  n += 1;
+  if (c->pc == 0x220A) {
+    JUMP(0x220A);
+  }
+  JUMP(0x21F4);
+
+b_0x21F4:
+  if (!(i8080_aot_code(c, 0x21F4, "\xCD\x4E\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x21F7;
+  i8080_aot_op_0xCD(c, 0x0B4E); // call $0B4E
+  n += 1;
+  JUMP(0x0B4E);
+
+b_0x21F7:
+  if (!(i8080_aot_code(c, 0x21F7, "\x42\x55\x46\x46\x45\x52\x20\x4D\x41", 9) &&
+      i8080_aot_code(c, 0x2200, "\x54\x48\x20\x45\x52\x52\x4F", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x42(c, 0x0000); // mov b,d
+  n += 1;
+  i8080_aot_op_0x55(c, 0x0000); // mov d,l
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x21FA;
+  i8080_aot_op_0x46(c, 0x0000); // mov b,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x21FA:
+  c->cyc += 7;
+  c->pc = 0x21FB;
+  i8080_aot_op_0x46(c, 0x0000); // mov b,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x21FB:
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x4D(c, 0x0000); // mov c,l
+  n += 1;
+  i8080_aot_op_0x41(c, 0x0000); // mov b,c
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x48(c, 0x0000); // mov c,b
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  c->cyc += 58;
+  c->pc = 0x2207;
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  JUMP(0x2207);
+
+b_0x2207:
+  if (!(i8080_aot_code(c, 0x2207, "\x52\x00\xC7", 3))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 20;
+  c->pc = 0x220A;
+  i8080_aot_op_0xC7(c, 0x0000); // rst 0
+  n += 1;
+  goto dispatch;
+
+b_0x220A:
+  if (!(i8080_aot_code(c, 0x220A, "\x1E\x00\x3E\x0D\xCD\xBD\x20", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x1E(c, 0x0000); // mvi e,$00
+  n += 1;
+  i8080_aot_op_0x3E(c, 0x000D); // mvi a,$0D
+  n += 1;
+  c->cyc += 31;
+  c->pc = 0x2211;
+  i8080_aot_op_0xCD(c, 0x20BD); // call $20BD
+  n += 1;
+  JUMP(0x20BD);
+
+b_0x2211:
+  if (!(i8080_aot_code(c, 0x2211, "\x3E\x0A\xCD\xBD\x20", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x000A); // mvi a,$0A
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x2216;
+  i8080_aot_op_0xCD(c, 0x20BD); // call $20BD
+  n += 1;
+  JUMP(0x20BD);
+
+b_0x2216:
+  if (!(i8080_aot_code(c, 0x2216, "\x3E\x0D\xCD\xBD\x20", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x000D); // mvi a,$0D
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x221B;
+  i8080_aot_op_0xCD(c, 0x20BD); // call $20BD
+  n += 1;
+  JUMP(0x20BD);
+
+b_0x221B:
+  if (!(i8080_aot_code(c, 0x221B, "\x3E\x0A\xCD\xBD\x20", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x000A); // mvi a,$0A
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x2220;
+  i8080_aot_op_0xCD(c, 0x20BD); // call $20BD
+  n += 1;
+  JUMP(0x20BD);
+
+b_0x2220:
+  if (!(i8080_aot_code(c, 0x2220, "\x3E\x2A\xCD\xBD\x20", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x002A); // mvi a,$2A
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x2225;
+  i8080_aot_op_0xCD(c, 0x20BD); // call $20BD
+  n += 1;
+  JUMP(0x20BD);
+
+b_0x2225:
+  if (!(i8080_aot_code(c, 0x2225, "\xCD\xBD\x20", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x2228;
+  i8080_aot_op_0xCD(c, 0x20BD); // call $20BD
+  n += 1;
+  JUMP(0x20BD);
+
+b_0x2228:
+  if (!(i8080_aot_code(c, 0x2228, "\xC1\xD1\xE1\xF1\xC9", 5))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x2229;
+  i8080_aot_op_0xC1(c, 0x0000); // pop b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x2229:
+  c->cyc += 10;
+  c->pc = 0x222A;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x222A:
+  c->cyc += 10;
+  c->pc = 0x222B;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x222B:
+  c->cyc += 10;
+  c->pc = 0x222C;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x222C:
+  c->cyc += 10;
+  c->pc = 0x222D;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x3000:
+  if (!(i8080_aot_code(c, 0x3000, "\xF3", 1))) {
+    goto fallback;
+  }
+  c->cyc += 4;
+  c->pc = 0x3001;
+  i8080_aot_op_0xF3(c, 0x0000); // di
+  n += 1;
+  JUMP(0x3001);
+
+b_0x3001:
+  if (!(i8080_aot_code(c, 0x3001, "\x31\xFF\x2F\xCD\x4F\x21", 6))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x31(c, 0x2FFF); // lxi sp,$2FFF
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x3007;
+  i8080_aot_op_0xCD(c, 0x214F); // call $214F
+  n += 1;
+  JUMP(0x214F);
+
+b_0x3007:
+  if (!(i8080_aot_code(c, 0x3007, "\xCD\x4E\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x300A;
+  i8080_aot_op_0xCD(c, 0x0B4E); // call $0B4E
+  n += 1;
+  JUMP(0x0B4E);
+
+b_0x300A:
+  if (!(i8080_aot_code(c, 0x300A, "\x0D\x0A\x44\x49\x41\x47\x4E\x4F\x53\x54\x49\x43\x53\x20\x49\x49", 16))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x300C;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x300C:
+  i8080_aot_op_0x44(c, 0x0000); // mov b,h
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  i8080_aot_op_0x41(c, 0x0000); // mov b,c
+  n += 1;
+  i8080_aot_op_0x47(c, 0x0000); // mov b,a
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x3011;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3011:
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  c->cyc += 44;
+  c->pc = 0x301A;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  JUMP(0x301A);
+
+b_0x301A:
+  if (!(i8080_aot_code(c, 0x301A, "\x20\x56\x31\x2E\x32\x20\x2D\x20\x43\x50\x55\x20\x54\x45\x53\x54\x0D\x0A", 18))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  c->cyc += 11;
+  c->pc = 0x301C;
+  i8080_aot_op_0x56(c, 0x0000); // mov d,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x301C:
+  i8080_aot_op_0x31(c, 0x322E); // lxi sp,$322E
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x2D(c, 0x0000); // dcr l
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  i8080_aot_op_0x50(c, 0x0000); // mov d,b
+  n += 1;
+  i8080_aot_op_0x55(c, 0x0000); // mov d,l
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  c->cyc += 74;
+  c->pc = 0x302C;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  JUMP(0x302C);
+
+b_0x302C:
+  if (!(i8080_aot_code(c, 0x302C, "\x43\x4F\x50\x59\x52\x49\x47\x48\x54\x20\x28\x43\x29\x20\x31\x39\x38\x31\x20\x2D", 20))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  i8080_aot_op_0x50(c, 0x0000); // mov d,b
+  n += 1;
+  i8080_aot_op_0x59(c, 0x0000); // mov e,c
+  n += 1;
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  i8080_aot_op_0x47(c, 0x0000); // mov b,a
+  n += 1;
+  i8080_aot_op_0x48(c, 0x0000); // mov c,b
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x28(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  i8080_aot_op_0x29(c, 0x0000); // dad h
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x31(c, 0x3839); // lxi sp,$3839
+  n += 1;
+  c->cyc += 92;
+  c->pc = 0x3040;
+  i8080_aot_op_0x31(c, 0x2D20); // lxi sp,$2D20
+  n += 1;
+  JUMP(0x3040);
+
+b_0x3040:
+  if (!(i8080_aot_code(c, 0x3040, "\x20\x53\x55\x50\x45\x52\x53\x4F\x46\x54\x20\x41\x53\x53\x4F\x43", 16))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x55(c, 0x0000); // mov d,l
+  n += 1;
+  i8080_aot_op_0x50(c, 0x0000); // mov d,b
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  c->cyc += 46;
+  c->pc = 0x3049;
+  i8080_aot_op_0x46(c, 0x0000); // mov b,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3049:
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x41(c, 0x0000); // mov b,c
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  c->cyc += 34;
+  c->pc = 0x3050;
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  JUMP(0x3050);
+
+b_0x3050:
+  if (!(i8080_aot_code(c, 0x3050, "\x49\x41\x54\x45\x53\x0D\x0A\x0A\x00\xC3\x64\x30", 12))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  i8080_aot_op_0x41(c, 0x0000); // mov b,c
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  c->cyc += 37;
+  c->pc = 0x3057;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3057:
+  c->cyc += 7;
+  c->pc = 0x3058;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3058:
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x305C;
+  i8080_aot_op_0xC3(c, 0x3064); // jmp $3064
+  n += 1;
+  JUMP(0x3064);
+
+b_0x3064:
+  if (!(i8080_aot_code(c, 0x3064, "\xCD\x06\x38", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x3067;
+  i8080_aot_op_0xCD(c, 0x3806); // call $3806
+  n += 1;
+  JUMP(0x3806);
+
+b_0x3067:
+  if (!(i8080_aot_code(c, 0x3067, "\xC3\x84\x30", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x306A;
+  i8080_aot_op_0xC3(c, 0x3084); // jmp $3084
+  n += 1;
+  JUMP(0x3084);
+
+b_0x3084:
+  if (!(i8080_aot_code(c, 0x3084, "\x1E\x41\x0E\x02\xCD\x05\x00", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x1E(c, 0x0041); // mvi e,$41
+  n += 1;
+  i8080_aot_op_0x0E(c, 0x0002); // mvi c,$02
+  n += 1;
+  c->cyc += 31;
+  c->pc = 0x308B;
+  i8080_aot_op_0xCD(c, 0x0005); // call $0005
+  n += 1;
+  goto dispatch;
+
+b_0x308B:
+  if (!(i8080_aot_code(c, 0x308B, "\x1E\x42\xCD\xDD\x32", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x1E(c, 0x0042); // mvi e,$42
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x3090;
+  i8080_aot_op_0xCD(c, 0x32DD); // call $32DD
+  n += 1;
+  JUMP(0x32DD);
+
+b_0x3090:
+  if (!(i8080_aot_code(c, 0x3090, "\x1E\x43\xCD\xE1\x32", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x1E(c, 0x0043); // mvi e,$43
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x3095;
+  i8080_aot_op_0xCD(c, 0x32E1); // call $32E1
+  n += 1;
+  JUMP(0x32E1);
+
+b_0x3095:
+  if (!(i8080_aot_code(c, 0x3095, "\x3A\x6C\x3B\xB7\xC2\xA2\x30", 7))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x3098;
+  i8080_aot_op_0x3A(c, 0x3B6C); // lda $3B6C
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3098:
+  i8080_aot_op_0xB7(c, 0x0000); // ora a
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x309C;
+  i8080_aot_op_0xC2(c, 0x30A2); // jnz $30A2
+  n += 1;
+  if (c->pc == 0x30A2) {
+    JUMP(0x30A2);
+  }
+  JUMP(0x309C);
+
+b_0x309C:
+  if (!(i8080_aot_code(c, 0x309C, "\xCD\x5E\x39", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x309F;
+  i8080_aot_op_0xCD(c, 0x395E); // call $395E
+  n += 1;
+  JUMP(0x395E);
+
+b_0x309F:
+  if (!(i8080_aot_code(c, 0x309F, "\xC3\xA7\x30", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x30A2;
+  i8080_aot_op_0xC3(c, 0x30A7); // jmp $30A7
+  n += 1;
+  JUMP(0x30A7);
+
+b_0x30A2:
+  if (!(i8080_aot_code(c, 0x30A2, "\xCD\x45\x3A", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x30A5;
+  i8080_aot_op_0xCD(c, 0x3A45); // call $3A45
+  n += 1;
+  JUMP(0x3A45);
+
+b_0x30A5:
+  if (!(i8080_aot_code(c, 0x30A5, "\x44\x00", 2))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x44(c, 0x0000); // mov b,h
+  n += 1;
+  c->cyc += 9;
+  c->pc = 0x30A7;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  JUMP(0x30A7);
+
+b_0x30A7:
+  if (!(i8080_aot_code(c, 0x30A7, "\x3E\x45\x0E\x16", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x0045); // mvi a,$45
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x30AB;
+  i8080_aot_op_0x0E(c, 0x0016); // mvi c,$16
+  n += 1;
+  JUMP(0x30AB);
+
+b_0x30AB:
+  if (!(i8080_aot_code(c, 0x30AB, "\xCD\x05\x3A", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x30AE;
+  i8080_aot_op_0xCD(c, 0x3A05); // call $3A05
+  n += 1;
+  JUMP(0x3A05);
+
+b_0x30AE:
+  if (!(i8080_aot_code(c, 0x30AE, "\x3C\x0D\xC2\xAB\x30", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3C(c, 0x0000); // inr a
+  n += 1;
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  c->cyc += 20;
+  c->pc = 0x30B3;
+  i8080_aot_op_0xC2(c, 0x30AB); // jnz $30AB
+  n += 1;
+  if (c->pc == 0x30AB) {
+    JUMP(0x30AB);
+  }
+  JUMP(0x30B3);
+
+b_0x30B3:
+  if (!(i8080_aot_code(c, 0x30B3, "\xC3\xC1\x30", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x30B6;
+  i8080_aot_op_0xC3(c, 0x30C1); // jmp $30C1
+  n += 1;
+  JUMP(0x30C1);
+
+b_0x30C1:
+  if (!(i8080_aot_code(c, 0x30C1, "\x3E\x02\x3C\xEA\xCC\x30", 6))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x0002); // mvi a,$02
+  n += 1;
+  i8080_aot_op_0x3C(c, 0x0000); // inr a
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x30C7;
+  i8080_aot_op_0xEA(c, 0x30CC); // jpe $30CC
+  n += 1;
+  if (c->pc == 0x30CC) {
+    JUMP(0x30CC);
+  }
+  JUMP(0x30C7);
+
+b_0x30C7:
+  if (!(i8080_aot_code(c, 0x30C7, "\x3E\x01\xC3\xCD\x30", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x0001); // mvi a,$01
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x30CC;
+  i8080_aot_op_0xC3(c, 0x30CD); // jmp $30CD
+  n += 1;
+  JUMP(0x30CD);
+
+b_0x30CC:
+  if (!(i8080_aot_code(c, 0x30CC, "\xAF", 1))) {
+    goto fallback;
+  }
+  c->cyc += 4;
+  c->pc = 0x30CD;
+  i8080_aot_op_0xAF(c, 0x0000); // xra a
+  n += 1;
+  JUMP(0x30CD);
+
+b_0x30CD:
+  if (!(i8080_aot_code(c, 0x30CD, "\x32\x69\x3B\xCD\x06\x38", 6))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x30D0;
+  i8080_aot_op_0x32(c, 0x3B69); // sta $3B69
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x30D0:
+  c->cyc += 17;
+  c->pc = 0x30D3;
+  i8080_aot_op_0xCD(c, 0x3806); // call $3806
+  n += 1;
+  JUMP(0x3806);
+
+b_0x30D3:
+  if (!(i8080_aot_code(c, 0x30D3, "\xC3\x22\x31", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x30D6;
+  i8080_aot_op_0xC3(c, 0x3122); // jmp $3122
+  n += 1;
+  JUMP(0x3122);
+
+b_0x3122:
+  if (!(i8080_aot_code(c, 0x3122, "\xCD\xF5\x37", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x3125;
+  i8080_aot_op_0xCD(c, 0x37F5); // call $37F5
+  n += 1;
+  JUMP(0x37F5);
+
+b_0x3125:
+  if (!(i8080_aot_code(c, 0x3125, "\xC3\x2F\x31", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x3128;
+  i8080_aot_op_0xC3(c, 0x312F); // jmp $312F
+  n += 1;
+  JUMP(0x312F);
+
+b_0x312F:
+  if (!(i8080_aot_code(c, 0x312F, "\xCD\x45\x3A", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x3132;
+  i8080_aot_op_0xCD(c, 0x3A45); // call $3A45
+  n += 1;
+  JUMP(0x3A45);
+
+b_0x3132:
+  if (!(i8080_aot_code(c, 0x3132, "\x0D\x0A\x43\x50\x55\x20\x49\x53\x20\x00\x3A\x69\x3B\xB7\xCA\x77\x31", 17))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x3134;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3134:
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  i8080_aot_op_0x50(c, 0x0000); // mov d,b
+  n += 1;
+  i8080_aot_op_0x55(c, 0x0000); // mov d,l
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 50;
+  c->pc = 0x313F;
+  i8080_aot_op_0x3A(c, 0x3B69); // lda $3B69
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x313F:
+  i8080_aot_op_0xB7(c, 0x0000); // ora a
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x3143;
+  i8080_aot_op_0xCA(c, 0x3177); // jz $3177
+  n += 1;
+  if (c->pc == 0x3177) {
+    JUMP(0x3177);
+  }
+  JUMP(0x3143);
+
+b_0x3143:
+  if (!(i8080_aot_code(c, 0x3143, "\xCD\x45\x3A", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x3146;
+  i8080_aot_op_0xCD(c, 0x3A45); // call $3A45
+  n += 1;
+  JUMP(0x3A45);
+
+b_0x3146:
+  if (!(i8080_aot_code(c, 0x3146, "\x5A\x38\x30\x00\x3A\x6A\x3B\xB7\xC2\x84\x31", 11))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x5A(c, 0x0000); // mov e,d
+  n += 1;
+  i8080_aot_op_0x38(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x30(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 30;
+  c->pc = 0x314D;
+  i8080_aot_op_0x3A(c, 0x3B6A); // lda $3B6A
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x314D:
+  i8080_aot_op_0xB7(c, 0x0000); // ora a
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x3151;
+  i8080_aot_op_0xC2(c, 0x3184); // jnz $3184
+  n += 1;
+  if (c->pc == 0x3184) {
+    JUMP(0x3184);
+  }
+  JUMP(0x3151);
+
+b_0x3151:
+  if (!(i8080_aot_code(c, 0x3151, "\xCD\x45\x3A", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x3154;
+  i8080_aot_op_0xCD(c, 0x3A45); // call $3A45
+  n += 1;
+  JUMP(0x3A45);
+
+b_0x3154:
+  if (!(i8080_aot_code(c, 0x3154, "\x20\x28\x52\x45\x46\x52\x45\x53\x48\x20\x52\x45\x47\x49\x53\x54", 16))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x28(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  c->cyc += 25;
+  c->pc = 0x3159;
+  i8080_aot_op_0x46(c, 0x0000); // mov b,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3159:
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x48(c, 0x0000); // mov c,b
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x47(c, 0x0000); // mov b,a
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  c->cyc += 54;
+  c->pc = 0x3164;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  JUMP(0x3164);
+
+b_0x3164:
+  if (!(i8080_aot_code(c, 0x3164, "\x45\x52\x20\x4E\x4F\x54\x20\x43\x48\x45\x43\x4B\x45\x44\x29\x00", 16))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  c->cyc += 21;
+  c->pc = 0x3168;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3168:
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  i8080_aot_op_0x48(c, 0x0000); // mov c,b
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  i8080_aot_op_0x4B(c, 0x0000); // mov c,e
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x44(c, 0x0000); // mov b,h
+  n += 1;
+  i8080_aot_op_0x29(c, 0x0000); // dad h
+  n += 1;
+  c->cyc += 63;
+  c->pc = 0x3174;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  JUMP(0x3174);
+
+b_0x3174:
+  if (!(i8080_aot_code(c, 0x3174, "\xC3\x84\x31", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x3177;
+  i8080_aot_op_0xC3(c, 0x3184); // jmp $3184
+  n += 1;
+  JUMP(0x3184);
+
+b_0x3177:
+  if (!(i8080_aot_code(c, 0x3177, "\xCD\x45\x3A", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x317A;
+  i8080_aot_op_0xCD(c, 0x3A45); // call $3A45
+  n += 1;
+  JUMP(0x3A45);
+
+b_0x317A:
+  if (!(i8080_aot_code(c, 0x317A, "\x38\x30\x38\x30\x2F\x38\x30\x38\x35\x00", 10))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x38(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x30(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x38(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x30(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x2F(c, 0x0000); // cma
+  n += 1;
+  i8080_aot_op_0x38(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x30(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x38(c, 0x0000); // ill
+  n += 1;
+  c->cyc += 42;
+  c->pc = 0x3183;
+  i8080_aot_op_0x35(c, 0x0000); // dcr M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x3183) < 1) {
+    goto dispatch;
+  }
+i_0x3183:
+  c->cyc += 4;
+  c->pc = 0x3184;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  JUMP(0x3184);
+
+b_0x3184:
+  if (!(i8080_aot_code(c, 0x3184, "\xAF\x01\x01\x00\xCD\x45\x3A", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xAF(c, 0x0000); // xra a
+  n += 1;
+  i8080_aot_op_0x01(c, 0x0001); // lxi b,$0001
+  n += 1;
+  c->cyc += 31;
+  c->pc = 0x318B;
+  i8080_aot_op_0xCD(c, 0x3A45); // call $3A45
+  n += 1;
+  JUMP(0x3A45);
+
+b_0x318B:
+  if (!(i8080_aot_code(c, 0x318B, "\x0D\x0A\x42\x45\x47\x49\x4E\x20\x54\x49\x4D\x49\x4E\x47\x20\x54", 16))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x318D;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x318D:
+  i8080_aot_op_0x42(c, 0x0000); // mov b,d
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x47(c, 0x0000); // mov b,a
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x3192;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3192:
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  i8080_aot_op_0x4D(c, 0x0000); // mov c,l
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  c->cyc += 31;
+  c->pc = 0x3198;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3198:
+  i8080_aot_op_0x47(c, 0x0000); // mov b,a
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x319B;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  JUMP(0x319B);
+
+b_0x319B:
+  if (!(i8080_aot_code(c, 0x319B, "\x45\x53\x54\x0D\x0A\x00\xCD\x45\x3B", 9))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x31A0;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x31A0:
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 21;
+  c->pc = 0x31A4;
+  i8080_aot_op_0xCD(c, 0x3B45); // call $3B45
+  n += 1;
+  JUMP(0x3B45);
+
+b_0x31A4:
+  if (!(i8080_aot_code(c, 0x31A4, "\xCD\xF5\x37", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x31A7;
+  i8080_aot_op_0xCD(c, 0x37F5); // call $37F5
+  n += 1;
+  JUMP(0x37F5);
+
+b_0x31A7:
+  if (!(i8080_aot_code(c, 0x31A7, "\xC3\xBC\x31", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x31AA;
+  i8080_aot_op_0xC3(c, 0x31BC); // jmp $31BC
+  n += 1;
+  JUMP(0x31BC);
+
+b_0x31BC:
+  if (!(i8080_aot_code(c, 0x31BC, "\xCD\x45\x3B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x31BF;
+  i8080_aot_op_0xCD(c, 0x3B45); // call $3B45
+  n += 1;
+  JUMP(0x3B45);
+
+b_0x31BF:
+  if (!(i8080_aot_code(c, 0x31BF, "\xCD\x45\x3A", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x31C2;
+  i8080_aot_op_0xCD(c, 0x3A45); // call $3A45
+  n += 1;
+  JUMP(0x3A45);
+
+b_0x31C2:
+  if (!(i8080_aot_code(c, 0x31C2, "\x45\x4E\x44\x20\x54\x49\x4D\x49\x4E\x47\x20\x54\x45\x53\x54\x0D", 16))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x31C4;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x31C4:
+  i8080_aot_op_0x44(c, 0x0000); // mov b,h
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  i8080_aot_op_0x4D(c, 0x0000); // mov c,l
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  c->cyc += 36;
+  c->pc = 0x31CB;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x31CB:
+  i8080_aot_op_0x47(c, 0x0000); // mov b,a
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  c->cyc += 34;
+  c->pc = 0x31D2;
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  JUMP(0x31D2);
+
+b_0x31D2:
+  if (!(i8080_aot_code(c, 0x31D2, "\x0A\x00\xCD\xE7\x32", 5))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x31D3;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x31D3:
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 21;
+  c->pc = 0x31D7;
+  i8080_aot_op_0xCD(c, 0x32E7); // call $32E7
+  n += 1;
+  JUMP(0x32E7);
+
+b_0x31D7:
+  if (!(i8080_aot_code(c, 0x31D7, "\xCD\x14\x38", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x31DA;
+  i8080_aot_op_0xCD(c, 0x3814); // call $3814
+  n += 1;
+  JUMP(0x3814);
+
+b_0x31DA:
+  if (!(i8080_aot_code(c, 0x31DA, "\xC3\xE3\x31", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x31DD;
+  i8080_aot_op_0xC3(c, 0x31E3); // jmp $31E3
+  n += 1;
+  JUMP(0x31E3);
+
+b_0x31E3:
+  if (!(i8080_aot_code(c, 0x31E3, "\xCD\x45\x3A", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x31E6;
+  i8080_aot_op_0xCD(c, 0x3A45); // call $3A45
+  n += 1;
+  JUMP(0x3A45);
+
+b_0x31E6:
+  if (!(i8080_aot_code(c, 0x31E6, "\x54\x41\x42\x4C\x45\x20\x45\x4E\x44\x20\x00\x2A\x75\x3B\xCD\x82\x3A", 17))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x41(c, 0x0000); // mov b,c
+  n += 1;
+  i8080_aot_op_0x42(c, 0x0000); // mov b,d
+  n += 1;
+  i8080_aot_op_0x4C(c, 0x0000); // mov c,h
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  c->cyc += 41;
+  c->pc = 0x31EE;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x31EE:
+  i8080_aot_op_0x44(c, 0x0000); // mov b,h
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 29;
+  c->pc = 0x31F4;
+  i8080_aot_op_0x2A(c, 0x3B75); // lhld $3B75
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x31F4:
+  c->cyc += 17;
+  c->pc = 0x31F7;
+  i8080_aot_op_0xCD(c, 0x3A82); // call $3A82
+  n += 1;
+  JUMP(0x3A82);
+
+b_0x31F7:
+  if (!(i8080_aot_code(c, 0x31F7, "\xCD\x45\x3A", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x31FA;
+  i8080_aot_op_0xCD(c, 0x3A45); // call $3A45
+  n += 1;
+  JUMP(0x3A45);
+
+b_0x31FA:
+  if (!(i8080_aot_code(c, 0x31FA, "\x0D\x0A\x54\x41\x42\x4C", 6) &&
+      i8080_aot_code(c, 0x3200, "\x45\x20\x53\x49\x5A\x45\x20\x00\x11\x8D\xC4\x19", 12))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x31FC;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x31FC:
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x41(c, 0x0000); // mov b,c
+  n += 1;
+  i8080_aot_op_0x42(c, 0x0000); // mov b,d
+  n += 1;
+  i8080_aot_op_0x4C(c, 0x0000); // mov c,h
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  i8080_aot_op_0x5A(c, 0x0000); // mov e,d
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  i8080_aot_op_0x11(c, 0xC48D); // lxi d,$C48D
+  n += 1;
+  c->cyc += 77;
+  c->pc = 0x320C;
+  i8080_aot_op_0x19(c, 0x0000); // dad d
+  n += 1;
+  JUMP(0x320C);
+
+b_0x320C:
+  if (!(i8080_aot_code(c, 0x320C, "\xCD\x82\x3A", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x320F;
+  i8080_aot_op_0xCD(c, 0x3A82); // call $3A82
+  n += 1;
+  JUMP(0x3A82);
+
+b_0x320F:
+  if (!(i8080_aot_code(c, 0x320F, "\xCD\x5C\x3B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x3212;
+  i8080_aot_op_0xCD(c, 0x3B5C); // call $3B5C
+  n += 1;
+  JUMP(0x3B5C);
+
+b_0x3212:
+  if (!(i8080_aot_code(c, 0x3212, "\xC3\x21\x32", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x3215;
+  i8080_aot_op_0xC3(c, 0x3221); // jmp $3221
+  n += 1;
+  JUMP(0x3221);
+
+b_0x3221:
+  if (!(i8080_aot_code(c, 0x3221, "\xCD\x5E\x39", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x3224;
+  i8080_aot_op_0xCD(c, 0x395E); // call $395E
+  n += 1;
+  JUMP(0x395E);
+
+b_0x3224:
+  if (!(i8080_aot_code(c, 0x3224, "\x3A\x6B\x3B\x21\x6C\x3B\x86\x57\x3E\x01\xCD\xF5\x37", 13))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x3227;
+  i8080_aot_op_0x3A(c, 0x3B6B); // lda $3B6B
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3227:
+  i8080_aot_op_0x21(c, 0x3B6C); // lxi h,$3B6C
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x322B;
+  i8080_aot_op_0x86(c, 0x0000); // add M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x322B:
+  i8080_aot_op_0x57(c, 0x0000); // mov d,a
+  n += 1;
+  i8080_aot_op_0x3E(c, 0x0001); // mvi a,$01
+  n += 1;
+  c->cyc += 29;
+  c->pc = 0x3231;
+  i8080_aot_op_0xCD(c, 0x37F5); // call $37F5
+  n += 1;
+  JUMP(0x37F5);
+
+b_0x3231:
+  if (!(i8080_aot_code(c, 0x3231, "\x32\x6C\x3B\x32\x6B\x3B\x3A\x6B\x3B\x21\x6C\x3B\x86\x92\x57\x3A\x70\x3B\x92\x32\x70\x3B\xCD\x5C\x3B", 25))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x3234;
+  i8080_aot_op_0x32(c, 0x3B6C); // sta $3B6C
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3234:
+  c->cyc += 13;
+  c->pc = 0x3237;
+  i8080_aot_op_0x32(c, 0x3B6B); // sta $3B6B
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3237:
+  c->cyc += 13;
+  c->pc = 0x323A;
+  i8080_aot_op_0x3A(c, 0x3B6B); // lda $3B6B
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x323A:
+  i8080_aot_op_0x21(c, 0x3B6C); // lxi h,$3B6C
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x323E;
+  i8080_aot_op_0x86(c, 0x0000); // add M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x323E:
+  i8080_aot_op_0x92(c, 0x0000); // sub d
+  n += 1;
+  i8080_aot_op_0x57(c, 0x0000); // mov d,a
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x3243;
+  i8080_aot_op_0x3A(c, 0x3B70); // lda $3B70
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3243:
+  i8080_aot_op_0x92(c, 0x0000); // sub d
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x3247;
+  i8080_aot_op_0x32(c, 0x3B70); // sta $3B70
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3247:
+  c->cyc += 17;
+  c->pc = 0x324A;
+  i8080_aot_op_0xCD(c, 0x3B5C); // call $3B5C
+  n += 1;
+  JUMP(0x3B5C);
+
+b_0x324A:
+  if (!(i8080_aot_code(c, 0x324A, "\xC3\x00\x30", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x324D;
+  i8080_aot_op_0xC3(c, 0x3000); // jmp $3000
+  n += 1;
+  JUMP(0x3000);
+
+b_0x3281:
+  if (!(i8080_aot_code(c, 0x3281, "\xF5\xCD\x14\x38", 4))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x3282;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x3281) < 4) {
+    goto dispatch;
+  }
+i_0x3282:
+  c->cyc += 17;
+  c->pc = 0x3285;
+  i8080_aot_op_0xCD(c, 0x3814); // call $3814
+  n += 1;
+  JUMP(0x3814);
+
+b_0x3285:
+  if (!(i8080_aot_code(c, 0x3285, "\xC3\x8E\x32", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x3288;
+  i8080_aot_op_0xC3(c, 0x328E); // jmp $328E
+  n += 1;
+  JUMP(0x328E);
+
+b_0x328E:
+  if (!(i8080_aot_code(c, 0x328E, "\xF1\xF5\xD5\x57\x3A\x70\x3B\x92\x32\x70\x3B\xD1\xF1\xF5\xCD\x45\x3A", 17))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x328F;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x328F:
+  c->cyc += 11;
+  c->pc = 0x3290;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x328F) < 16) {
+    goto dispatch;
+  }
+i_0x3290:
+  c->cyc += 11;
+  c->pc = 0x3291;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x3290) < 15) {
+    goto dispatch;
+  }
+i_0x3291:
+  i8080_aot_op_0x57(c, 0x0000); // mov d,a
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x3295;
+  i8080_aot_op_0x3A(c, 0x3B70); // lda $3B70
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3295:
+  i8080_aot_op_0x92(c, 0x0000); // sub d
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x3299;
+  i8080_aot_op_0x32(c, 0x3B70); // sta $3B70
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3299:
+  c->cyc += 10;
+  c->pc = 0x329A;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x329A:
+  c->cyc += 10;
+  c->pc = 0x329B;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x329B:
+  c->cyc += 11;
+  c->pc = 0x329C;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x329B) < 4) {
+    goto dispatch;
+  }
+i_0x329C:
+  c->cyc += 17;
+  c->pc = 0x329F;
+  i8080_aot_op_0xCD(c, 0x3A45); // call $3A45
+  n += 1;
+  JUMP(0x3A45);
+
+b_0x329F:
+  if (!(i8080_aot_code(c, 0x329F, "\x3C\x00\xCD\x98\x3A", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3C(c, 0x0000); // inr a
+  n += 1;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 26;
+  c->pc = 0x32A4;
+  i8080_aot_op_0xCD(c, 0x3A98); // call $3A98
+  n += 1;
+  JUMP(0x3A98);
+
+b_0x32A4:
+  if (!(i8080_aot_code(c, 0x32A4, "\xCD\x45\x3A", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x32A7;
+  i8080_aot_op_0xCD(c, 0x3A45); // call $3A45
+  n += 1;
+  JUMP(0x3A45);
+
+b_0x32A7:
+  if (!(i8080_aot_code(c, 0x32A7, "\x3E\x00\xCD\x22\x3B", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x0000); // mvi a,$00
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x32AC;
+  i8080_aot_op_0xCD(c, 0x3B22); // call $3B22
+  n += 1;
+  JUMP(0x3B22);
+
+b_0x32AC:
+  if (!(i8080_aot_code(c, 0x32AC, "\xF1\xC9", 2))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x32AD;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x32AD:
+  c->cyc += 10;
+  c->pc = 0x32AE;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x32DD:
+  if (!(i8080_aot_code(c, 0x32DD, "\xCD\xE1\x32", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x32E0;
+  i8080_aot_op_0xCD(c, 0x32E1); // call $32E1
+  n += 1;
+  JUMP(0x32E1);
+
+b_0x32E0:
+  if (!(i8080_aot_code(c, 0x32E0, "\xC9", 1))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x32E1;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x32E1:
+  if (!(i8080_aot_code(c, 0x32E1, "\x0E\x02\xCD\xBD\x20", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x0E(c, 0x0002); // mvi c,$02
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x32E6;
+  i8080_aot_op_0xCD(c, 0x20BD); // call $20BD
+  n += 1;
+  JUMP(0x20BD);
+
+b_0x32E6:
+  if (!(i8080_aot_code(c, 0x32E6, "\xC9", 1))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x32E7;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x32E7:
+  if (!(i8080_aot_code(c, 0x32E7, "\x21\x05\x3A\xCD\xB7\x38", 6))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x21(c, 0x3A05); // lxi h,$3A05
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x32ED;
+  i8080_aot_op_0xCD(c, 0x38B7); // call $38B7
+  n += 1;
+  JUMP(0x38B7);
+
+b_0x32ED:
+  if (!(i8080_aot_code(c, 0x32ED, "\xCD\x1A\x35", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x32F0;
+  i8080_aot_op_0xCD(c, 0x351A); // call $351A
+  n += 1;
+  JUMP(0x351A);
+
+b_0x32F0:
+  if (!(i8080_aot_code(c, 0x32F0, "\x21\x77\x3B\x22\x75\x3B\x3E\x00\x32\x3E\x33\x32\x3F\x33\x21\x58", 16) &&
+      i8080_aot_code(c, 0x3300, "\x33\x16\x01", 3))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x21(c, 0x3B77); // lxi h,$3B77
+  n += 1;
+  c->cyc += 26;
+  c->pc = 0x32F6;
+  i8080_aot_op_0x22(c, 0x3B75); // shld $3B75
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x32F6:
+  i8080_aot_op_0x3E(c, 0x0000); // mvi a,$00
+  n += 1;
+  c->cyc += 20;
+  c->pc = 0x32FB;
+  i8080_aot_op_0x32(c, 0x333E); // sta $333E
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x32FB:
+  c->cyc += 13;
+  c->pc = 0x32FE;
+  i8080_aot_op_0x32(c, 0x333F); // sta $333F
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x32FE:
+  i8080_aot_op_0x21(c, 0x3358); // lxi h,$3358
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x3303;
+  i8080_aot_op_0x16(c, 0x0001); // mvi d,$01
+  n += 1;
+  JUMP(0x3303);
+
+b_0x3303:
+  if (!(i8080_aot_code(c, 0x3303, "\x7E\x23\xFE\x00\xC2\x1B\x33", 7))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x3304;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3304:
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x0000); // cpi $00
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x330A;
+  i8080_aot_op_0xC2(c, 0x331B); // jnz $331B
+  n += 1;
+  if (c->pc == 0x331B) {
+    JUMP(0x331B);
+  }
+  JUMP(0x330A);
+
+b_0x330A:
+  if (!(i8080_aot_code(c, 0x330A, "\xCD\x0D\x38", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x330D;
+  i8080_aot_op_0xCD(c, 0x380D); // call $380D
+  n += 1;
+  JUMP(0x380D);
+
+b_0x330D:
+  if (!(i8080_aot_code(c, 0x330D, "\xCD\xF5\x37", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x3310;
+  i8080_aot_op_0xCD(c, 0x37F5); // call $37F5
+  n += 1;
+  JUMP(0x37F5);
+
+b_0x3310:
+  if (!(i8080_aot_code(c, 0x3310, "\xCD\x5C\x3B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x3313;
+  i8080_aot_op_0xCD(c, 0x3B5C); // call $3B5C
+  n += 1;
+  JUMP(0x3B5C);
+
+b_0x3313:
+  if (!(i8080_aot_code(c, 0x3313, "\x14\x7A\xFE\x04\xFA\x03\x33", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x14(c, 0x0000); // inr d
+  n += 1;
+  i8080_aot_op_0x7A(c, 0x0000); // mov a,d
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x0004); // cpi $04
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x331A;
+  i8080_aot_op_0xFA(c, 0x3303); // jm $3303
+  n += 1;
+  if (c->pc == 0x3303) {
+    JUMP(0x3303);
+  }
+  JUMP(0x331A);
+
+b_0x331A:
+  if (!(i8080_aot_code(c, 0x331A, "\xC9", 1))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x331B;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x331B:
+  if (!(i8080_aot_code(c, 0x331B, "\x32\x3D\x33\x7A\xFE\x02\xFA\x34\x33", 9))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x331E;
+  i8080_aot_op_0x32(c, 0x333D); // sta $333D
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x331E:
+  i8080_aot_op_0x7A(c, 0x0000); // mov a,d
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x0002); // cpi $02
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x3324;
+  i8080_aot_op_0xFA(c, 0x3334); // jm $3334
+  n += 1;
+  if (c->pc == 0x3334) {
+    JUMP(0x3334);
+  }
+  JUMP(0x3324);
+
+b_0x3324:
+  if (!(i8080_aot_code(c, 0x3324, "\x7E\x23\x32\x3E\x33\x7A\xFE\x03\xFA\x34\x33", 11))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x3325;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3325:
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x3329;
+  i8080_aot_op_0x32(c, 0x333E); // sta $333E
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3329:
+  i8080_aot_op_0x7A(c, 0x0000); // mov a,d
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x0003); // cpi $03
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x332F;
+  i8080_aot_op_0xFA(c, 0x3334); // jm $3334
+  n += 1;
+  if (c->pc == 0x3334) {
+    JUMP(0x3334);
+  }
+  JUMP(0x332F);
+
+b_0x332F:
+  if (!(i8080_aot_code(c, 0x332F, "\x7E\x23\x32\x3F\x33", 5))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x3330;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3330:
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x3334;
+  i8080_aot_op_0x32(c, 0x333F); // sta $333F
+  n += 1;
+  JUMP(0x3334);
+
+b_0x3334:
+  if (!(i8080_aot_code(c, 0x3334, "\xD5\xE5\xF5\x21\xA1\x39\xCD\xB7\x38", 9))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x3335;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x3334) < 9) {
+    goto dispatch;
+  }
+i_0x3335:
+  c->cyc += 11;
+  c->pc = 0x3336;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x3335) < 8) {
+    goto dispatch;
+  }
+i_0x3336:
+  c->cyc += 11;
+  c->pc = 0x3337;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x3336) < 7) {
+    goto dispatch;
+  }
+i_0x3337:
+  i8080_aot_op_0x21(c, 0x39A1); // lxi h,$39A1
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x333D;
+  i8080_aot_op_0xCD(c, 0x38B7); // call $38B7
+  n += 1;
+  JUMP(0x38B7);
+
+b_0x333D:
+  if (!(i8080_aot_code(c, 0x333D, "\xE4\x56\x33", 3))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x3340;
+  i8080_aot_op_0xE4(c, 0x3356); // cpo $3356
+  n += 1;
+  if (c->pc == 0x3356) {
+    JUMP(0x3356);
+  }
+  JUMP(0x3340);
+
+b_0x3340:
+  if (!(i8080_aot_code(c, 0x3340, "\xCD\x22\x35", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x3343;
+  i8080_aot_op_0xCD(c, 0x3522); // call $3522
+  n += 1;
+  JUMP(0x3522);
+
+b_0x3343:
+  if (!(i8080_aot_code(c, 0x3343, "\x21\xD3\x39\xCD\xB7\x38", 6))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x21(c, 0x39D3); // lxi h,$39D3
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x3349;
+  i8080_aot_op_0xCD(c, 0x38B7); // call $38B7
+  n += 1;
+  JUMP(0x38B7);
+
+b_0x3349:
+  if (!(i8080_aot_code(c, 0x3349, "\xCD\x1A\x35", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x334C;
+  i8080_aot_op_0xCD(c, 0x351A); // call $351A
+  n += 1;
+  JUMP(0x351A);
+
+b_0x334C:
+  if (!(i8080_aot_code(c, 0x334C, "\xF1\xE1\xD1\xC3\x03\x33", 6))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x334D;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x334D:
+  c->cyc += 10;
+  c->pc = 0x334E;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x334E:
+  c->cyc += 10;
+  c->pc = 0x334F;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x334F:
+  c->cyc += 10;
+  c->pc = 0x3352;
+  i8080_aot_op_0xC3(c, 0x3303); // jmp $3303
+  n += 1;
+  JUMP(0x3303);
+
+b_0x3356:
+  if (!(i8080_aot_code(c, 0x3356, "\x03\xC9", 2))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x03(c, 0x0000); // inx b
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x3358;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x351A:
+  if (!(i8080_aot_code(c, 0x351A, "\xE5\x21\xA1\x39\xCD\x31\x38", 7))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x351B;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x351A) < 7) {
+    goto dispatch;
+  }
+i_0x351B:
+  i8080_aot_op_0x21(c, 0x39A1); // lxi h,$39A1
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x3521;
+  i8080_aot_op_0xCD(c, 0x3831); // call $3831
+  n += 1;
+  JUMP(0x3831);
+
+b_0x3521:
+  if (!(i8080_aot_code(c, 0x3521, "\xC9", 1))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x3522;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x3522:
+  if (!(i8080_aot_code(c, 0x3522, "\xE5\x21\xD3\x39\xCD\x31\x38", 7))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x3523;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x3522) < 7) {
+    goto dispatch;
+  }
+i_0x3523:
+  i8080_aot_op_0x21(c, 0x39D3); // lxi h,$39D3
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x3529;
+  i8080_aot_op_0xCD(c, 0x3831); // call $3831
+  n += 1;
+  JUMP(0x3831);
+
+b_0x3529:
+  if (!(i8080_aot_code(c, 0x3529, "\xE5\xD5\xF5\x21\xA1\x39\x11\xD3\x39\xCD\x0D\x38", 12))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x352A;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x3529) < 12) {
+    goto dispatch;
+  }
+i_0x352A:
+  c->cyc += 11;
+  c->pc = 0x352B;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x352A) < 11) {
+    goto dispatch;
+  }
+i_0x352B:
+  c->cyc += 11;
+  c->pc = 0x352C;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x352B) < 10) {
+    goto dispatch;
+  }
+i_0x352C:
+  i8080_aot_op_0x21(c, 0x39A1); // lxi h,$39A1
+  n += 1;
+  i8080_aot_op_0x11(c, 0x39D3); // lxi d,$39D3
+  n += 1;
+  c->cyc += 37;
+  c->pc = 0x3535;
+  i8080_aot_op_0xCD(c, 0x380D); // call $380D
+  n += 1;
+  JUMP(0x380D);
+
+b_0x3535:
+  if (!(i8080_aot_code(c, 0x3535, "\xCD\xF5\x37", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x3538;
+  i8080_aot_op_0xCD(c, 0x37F5); // call $37F5
+  n += 1;
+  JUMP(0x37F5);
+
+b_0x3538:
+  if (!(i8080_aot_code(c, 0x3538, "\xCD\x1A\x36", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x353B;
+  i8080_aot_op_0xCD(c, 0x361A); // call $361A
+  n += 1;
+  JUMP(0x361A);
+
+b_0x353B:
+  if (!(i8080_aot_code(c, 0x353B, "\xCD\x0D\x38", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x353E;
+  i8080_aot_op_0xCD(c, 0x380D); // call $380D
+  n += 1;
+  JUMP(0x380D);
+
+b_0x353E:
+  if (!(i8080_aot_code(c, 0x353E, "\xCD\xF5\x37", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x3541;
+  i8080_aot_op_0xCD(c, 0x37F5); // call $37F5
+  n += 1;
+  JUMP(0x37F5);
+
+b_0x3541:
+  if (!(i8080_aot_code(c, 0x3541, "\xCD\x63\x3B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x3544;
+  i8080_aot_op_0xCD(c, 0x3B63); // call $3B63
+  n += 1;
+  JUMP(0x3B63);
+
+b_0x3544:
+  if (!(i8080_aot_code(c, 0x3544, "\xCD\x6C\x35", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x3547;
+  i8080_aot_op_0xCD(c, 0x356C); // call $356C
+  n += 1;
+  JUMP(0x356C);
+
+b_0x3547:
+  if (!(i8080_aot_code(c, 0x3547, "\xF1\xD1\xE1\xC9", 4))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x3548;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3548:
+  c->cyc += 10;
+  c->pc = 0x3549;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3549:
+  c->cyc += 10;
+  c->pc = 0x354A;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x354A:
+  c->cyc += 10;
+  c->pc = 0x354B;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x356C:
+  if (!(i8080_aot_code(c, 0x356C, "\xC5\x0E\xFF", 3))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x356D;
+  i8080_aot_op_0xC5(c, 0x0000); // push b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x356C) < 3) {
+    goto dispatch;
+  }
+i_0x356D:
+  c->cyc += 7;
+  c->pc = 0x356F;
+  i8080_aot_op_0x0E(c, 0x00FF); // mvi c,$FF
+  n += 1;
+  JUMP(0x356F);
+
+b_0x356F:
+  if (!(i8080_aot_code(c, 0x356F, "\xE5\x2A\x75\x3B\x22\x4F\x35\xE1\xAF\x32\x73\x3B\x0C\x79\xFE\x19\xF2\xCB\x35", 19))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x3570;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x356F) < 19) {
+    goto dispatch;
+  }
+i_0x3570:
+  c->cyc += 16;
+  c->pc = 0x3573;
+  i8080_aot_op_0x2A(c, 0x3B75); // lhld $3B75
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3573:
+  c->cyc += 16;
+  c->pc = 0x3576;
+  i8080_aot_op_0x22(c, 0x354F); // shld $354F
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3576:
+  c->cyc += 10;
+  c->pc = 0x3577;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3577:
+  i8080_aot_op_0xAF(c, 0x0000); // xra a
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x357B;
+  i8080_aot_op_0x32(c, 0x3B73); // sta $3B73
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x357B:
+  i8080_aot_op_0x0C(c, 0x0000); // inr c
+  n += 1;
+  i8080_aot_op_0x79(c, 0x0000); // mov a,c
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x0019); // cpi $19
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x3582;
+  i8080_aot_op_0xF2(c, 0x35CB); // jp $35CB
+  n += 1;
+  if (c->pc == 0x35CB) {
+    JUMP(0x35CB);
+  }
+  JUMP(0x3582);
+
+b_0x3582:
+  if (!(i8080_aot_code(c, 0x3582, "\x2B\x7E\x32\x4B\x35\xEB\x2B\x46\xF5\x78\x32\x4C\x35\xF1\xEB\xB8\xCA\x6F\x35", 19))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x3584;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3584:
+  c->cyc += 13;
+  c->pc = 0x3587;
+  i8080_aot_op_0x32(c, 0x354B); // sta $354B
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3587:
+  i8080_aot_op_0xEB(c, 0x0000); // xchg
+  n += 1;
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  c->cyc += 16;
+  c->pc = 0x358A;
+  i8080_aot_op_0x46(c, 0x0000); // mov b,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x358A:
+  c->cyc += 11;
+  c->pc = 0x358B;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x358A) < 11) {
+    goto dispatch;
+  }
+i_0x358B:
+  i8080_aot_op_0x78(c, 0x0000); // mov a,b
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x358F;
+  i8080_aot_op_0x32(c, 0x354C); // sta $354C
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x358F:
+  c->cyc += 10;
+  c->pc = 0x3590;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3590:
+  i8080_aot_op_0xEB(c, 0x0000); // xchg
+  n += 1;
+  i8080_aot_op_0xB8(c, 0x0000); // cmp b
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x3595;
+  i8080_aot_op_0xCA(c, 0x356F); // jz $356F
+  n += 1;
+  if (c->pc == 0x356F) {
+    JUMP(0x356F);
+  }
+  JUMP(0x3595);
+
+b_0x3595:
+  if (!(i8080_aot_code(c, 0x3595, "\x3A\x69\x3B\xB7\xC2\xA2\x35", 7))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x3598;
+  i8080_aot_op_0x3A(c, 0x3B69); // lda $3B69
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3598:
+  i8080_aot_op_0xB7(c, 0x0000); // ora a
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x359C;
+  i8080_aot_op_0xC2(c, 0x35A2); // jnz $35A2
+  n += 1;
+  if (c->pc == 0x35A2) {
+    JUMP(0x35A2);
+  }
+  JUMP(0x359C);
+
+b_0x359C:
+  if (!(i8080_aot_code(c, 0x359C, "\x79\xFE\x08\xF2\xE0\x35", 6))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x79(c, 0x0000); // mov a,c
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x0008); // cpi $08
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x35A2;
+  i8080_aot_op_0xF2(c, 0x35E0); // jp $35E0
+  n += 1;
+  if (c->pc == 0x35E0) {
+    JUMP(0x35E0);
+  }
+  JUMP(0x35A2);
+
+b_0x35A2:
+  if (!(i8080_aot_code(c, 0x35A2, "\x79\xFE\x17\xF2\xE0\x35", 6))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x79(c, 0x0000); // mov a,c
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x0017); // cpi $17
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x35A8;
+  i8080_aot_op_0xF2(c, 0x35E0); // jp $35E0
+  n += 1;
+  if (c->pc == 0x35E0) {
+    JUMP(0x35E0);
+  }
+  JUMP(0x35A8);
+
+b_0x35A8:
+  if (!(i8080_aot_code(c, 0x35A8, "\x79\x32\x4D\x35\xCD\x94\x36", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x79(c, 0x0000); // mov a,c
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x35AC;
+  i8080_aot_op_0x32(c, 0x354D); // sta $354D
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x35AC:
+  c->cyc += 17;
+  c->pc = 0x35AF;
+  i8080_aot_op_0xCD(c, 0x3694); // call $3694
+  n += 1;
+  JUMP(0x3694);
+
+b_0x35AF:
+  if (!(i8080_aot_code(c, 0x35AF, "\xCD\x0D\x38", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x35B2;
+  i8080_aot_op_0xCD(c, 0x380D); // call $380D
+  n += 1;
+  JUMP(0x380D);
+
+b_0x35B2:
+  if (!(i8080_aot_code(c, 0x35B2, "\xCD\xF5\x37", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x35B5;
+  i8080_aot_op_0xCD(c, 0x37F5); // call $37F5
+  n += 1;
+  JUMP(0x37F5);
+
+b_0x35B5:
+  if (!(i8080_aot_code(c, 0x35B5, "\xCD\x4A\x36", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x35B8;
+  i8080_aot_op_0xCD(c, 0x364A); // call $364A
+  n += 1;
+  JUMP(0x364A);
+
+b_0x35B8:
+  if (!(i8080_aot_code(c, 0x35B8, "\x3A\x4C\x35\xCD\x94\x36", 6))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x35BB;
+  i8080_aot_op_0x3A(c, 0x354C); // lda $354C
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x35BB:
+  c->cyc += 17;
+  c->pc = 0x35BE;
+  i8080_aot_op_0xCD(c, 0x3694); // call $3694
+  n += 1;
+  JUMP(0x3694);
+
+b_0x35BE:
+  if (!(i8080_aot_code(c, 0x35BE, "\x3A\x73\x3B\xB7\xCD\x06\x38", 7))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x35C1;
+  i8080_aot_op_0x3A(c, 0x3B73); // lda $3B73
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x35C1:
+  i8080_aot_op_0xB7(c, 0x0000); // ora a
+  n += 1;
+  c->cyc += 21;
+  c->pc = 0x35C5;
+  i8080_aot_op_0xCD(c, 0x3806); // call $3806
+  n += 1;
+  JUMP(0x3806);
+
+b_0x35C5:
+  if (!(i8080_aot_code(c, 0x35C5, "\xC4\xBD\x36", 3))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x35C8;
+  i8080_aot_op_0xC4(c, 0x36BD); // cnz $36BD
+  n += 1;
+  if (c->pc == 0x36BD) {
+    JUMP(0x36BD);
+  }
+  JUMP(0x35C8);
+
+b_0x35C8:
+  if (!(i8080_aot_code(c, 0x35C8, "\xC3\x6F\x35", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x35CB;
+  i8080_aot_op_0xC3(c, 0x356F); // jmp $356F
+  n += 1;
+  JUMP(0x356F);
+
+b_0x35CB:
+  if (!(i8080_aot_code(c, 0x35CB, "\x3E\x58\xCD\x94\x36", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x0058); // mvi a,$58
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x35D0;
+  i8080_aot_op_0xCD(c, 0x3694); // call $3694
+  n += 1;
+  JUMP(0x3694);
+
+b_0x35D0:
+  if (!(i8080_aot_code(c, 0x35D0, "\x3E\x59\xCD\x94\x36", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x0059); // mvi a,$59
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x35D5;
+  i8080_aot_op_0xCD(c, 0x3694); // call $3694
+  n += 1;
+  JUMP(0x3694);
+
+b_0x35D5:
+  if (!(i8080_aot_code(c, 0x35D5, "\xC1\xCD\x0D\x38", 4))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x35D6;
+  i8080_aot_op_0xC1(c, 0x0000); // pop b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x35D6:
+  c->cyc += 17;
+  c->pc = 0x35D9;
+  i8080_aot_op_0xCD(c, 0x380D); // call $380D
+  n += 1;
+  JUMP(0x380D);
+
+b_0x35D9:
+  if (!(i8080_aot_code(c, 0x35D9, "\xCD\xF5\x37", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x35DC;
+  i8080_aot_op_0xCD(c, 0x37F5); // call $37F5
+  n += 1;
+  JUMP(0x37F5);
+
+b_0x35DC:
+  if (!(i8080_aot_code(c, 0x35DC, "\xCD\x5C\x3B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x35DF;
+  i8080_aot_op_0xCD(c, 0x3B5C); // call $3B5C
+  n += 1;
+  JUMP(0x3B5C);
+
+b_0x35DF:
+  if (!(i8080_aot_code(c, 0x35DF, "\xC9", 1))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x35E0;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x35E0:
+  if (!(i8080_aot_code(c, 0x35E0, "\xCD\xF5\x37", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x35E3;
+  i8080_aot_op_0xCD(c, 0x37F5); // call $37F5
+  n += 1;
+  JUMP(0x37F5);
+
+b_0x35E3:
+  if (!(i8080_aot_code(c, 0x35E3, "\xC3\xCB\x35", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x35E6;
+  i8080_aot_op_0xC3(c, 0x35CB); // jmp $35CB
+  n += 1;
+  JUMP(0x35CB);
+
+b_0x361A:
+  if (!(i8080_aot_code(c, 0x361A, "\x3A\x3D\x33\xCD\x98\x3A", 6))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x361D;
+  i8080_aot_op_0x3A(c, 0x333D); // lda $333D
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x361D:
+  c->cyc += 17;
+  c->pc = 0x3620;
+  i8080_aot_op_0xCD(c, 0x3A98); // call $3A98
+  n += 1;
+  JUMP(0x3A98);
+
+b_0x3620:
+  if (!(i8080_aot_code(c, 0x3620, "\x3A\x3E\x33\xCD\x98\x3A", 6))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x3623;
+  i8080_aot_op_0x3A(c, 0x333E); // lda $333E
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3623:
+  c->cyc += 17;
+  c->pc = 0x3626;
+  i8080_aot_op_0xCD(c, 0x3A98); // call $3A98
+  n += 1;
+  JUMP(0x3A98);
+
+b_0x3626:
+  if (!(i8080_aot_code(c, 0x3626, "\x3A\x3F\x33\xCD\x98\x3A", 6))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x3629;
+  i8080_aot_op_0x3A(c, 0x333F); // lda $333F
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3629:
+  c->cyc += 17;
+  c->pc = 0x362C;
+  i8080_aot_op_0xCD(c, 0x3A98); // call $3A98
+  n += 1;
+  JUMP(0x3A98);
+
+b_0x362C:
+  if (!(i8080_aot_code(c, 0x362C, "\xC9", 1))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x362D;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x362D:
+  if (!(i8080_aot_code(c, 0x362D, "\xE5\x21\x51\x35\xCD\x7A\x3A", 7))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x362E;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x362D) < 7) {
+    goto dispatch;
+  }
+i_0x362E:
+  i8080_aot_op_0x21(c, 0x3551); // lxi h,$3551
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x3634;
+  i8080_aot_op_0xCD(c, 0x3A7A); // call $3A7A
+  n += 1;
+  JUMP(0x3A7A);
+
+b_0x3634:
+  if (!(i8080_aot_code(c, 0x3634, "\xFE\x41\xFA\x45\x36", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xFE(c, 0x0041); // cpi $41
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x3639;
+  i8080_aot_op_0xFA(c, 0x3645); // jm $3645
+  n += 1;
+  if (c->pc == 0x3645) {
+    JUMP(0x3645);
+  }
+  JUMP(0x3639);
+
+b_0x3639:
+  if (!(i8080_aot_code(c, 0x3639, "\xFE\x5B\xF2\x45\x36", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xFE(c, 0x005B); // cpi $5B
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x363E;
+  i8080_aot_op_0xF2(c, 0x3645); // jp $3645
+  n += 1;
+  if (c->pc == 0x3645) {
+    JUMP(0x3645);
+  }
+  JUMP(0x363E);
+
+b_0x363E:
+  if (!(i8080_aot_code(c, 0x363E, "\xF5\x3E\x5A\xCD\x05\x3A", 6))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x363F;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x363E) < 6) {
+    goto dispatch;
+  }
+i_0x363F:
+  i8080_aot_op_0x3E(c, 0x005A); // mvi a,$5A
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x3644;
+  i8080_aot_op_0xCD(c, 0x3A05); // call $3A05
+  n += 1;
+  JUMP(0x3A05);
+
+b_0x3644:
+  if (!(i8080_aot_code(c, 0x3644, "\xF1", 1))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x3645;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  JUMP(0x3645);
+
+b_0x3645:
+  if (!(i8080_aot_code(c, 0x3645, "\xCD\x05\x3A", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x3648;
+  i8080_aot_op_0xCD(c, 0x3A05); // call $3A05
+  n += 1;
+  JUMP(0x3A05);
+
+b_0x3648:
+  if (!(i8080_aot_code(c, 0x3648, "\xE1\xC9", 2))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x3649;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3649:
+  c->cyc += 10;
+  c->pc = 0x364A;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x364A:
+  if (!(i8080_aot_code(c, 0x364A, "\xE5\xD5\x3A\x4D\x35\xCD\x98\x3A", 8))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x364B;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x364A) < 8) {
+    goto dispatch;
+  }
+i_0x364B:
+  c->cyc += 11;
+  c->pc = 0x364C;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x364B) < 7) {
+    goto dispatch;
+  }
+i_0x364C:
+  c->cyc += 13;
+  c->pc = 0x364F;
+  i8080_aot_op_0x3A(c, 0x354D); // lda $354D
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x364F:
+  c->cyc += 17;
+  c->pc = 0x3652;
+  i8080_aot_op_0xCD(c, 0x3A98); // call $3A98
+  n += 1;
+  JUMP(0x3A98);
+
+b_0x3652:
+  if (!(i8080_aot_code(c, 0x3652, "\xCD\x45\x3A", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x3655;
+  i8080_aot_op_0xCD(c, 0x3A45); // call $3A45
+  n += 1;
+  JUMP(0x3A45);
+
+b_0x3655:
+  if (!(i8080_aot_code(c, 0x3655, "\x28\x00\xCD\x2D\x36", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x28(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 25;
+  c->pc = 0x365A;
+  i8080_aot_op_0xCD(c, 0x362D); // call $362D
+  n += 1;
+  JUMP(0x362D);
+
+b_0x365A:
+  if (!(i8080_aot_code(c, 0x365A, "\xCD\x45\x3A", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x365D;
+  i8080_aot_op_0xCD(c, 0x3A45); // call $3A45
+  n += 1;
+  JUMP(0x3A45);
+
+b_0x365D:
+  if (!(i8080_aot_code(c, 0x365D, "\x29\x3A\x00\x3A\x4B\x35\xCD\x98\x3A", 9))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x29(c, 0x0000); // dad h
+  n += 1;
+  c->cyc += 23;
+  c->pc = 0x3661;
+  i8080_aot_op_0x3A(c, 0x3A00); // lda $3A00
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3661:
+  i8080_aot_op_0x4B(c, 0x0000); // mov c,e
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x3663;
+  i8080_aot_op_0x35(c, 0x0000); // dcr M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x3663) < 3) {
+    goto dispatch;
+  }
+i_0x3663:
+  c->cyc += 17;
+  c->pc = 0x3666;
+  i8080_aot_op_0xCD(c, 0x3A98); // call $3A98
+  n += 1;
+  JUMP(0x3A98);
+
+b_0x3666:
+  if (!(i8080_aot_code(c, 0x3666, "\xCD\x45\x3A", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x3669;
+  i8080_aot_op_0xCD(c, 0x3A45); // call $3A45
+  n += 1;
+  JUMP(0x3A45);
+
+b_0x3669:
+  if (!(i8080_aot_code(c, 0x3669, "\x2D\x3E\x00\x3A\x4C\x35\xCD\x98\x3A", 9))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x2D(c, 0x0000); // dcr l
+  n += 1;
+  i8080_aot_op_0x3E(c, 0x0000); // mvi a,$00
+  n += 1;
+  c->cyc += 25;
+  c->pc = 0x366F;
+  i8080_aot_op_0x3A(c, 0x354C); // lda $354C
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x366F:
+  c->cyc += 17;
+  c->pc = 0x3672;
+  i8080_aot_op_0xCD(c, 0x3A98); // call $3A98
+  n += 1;
+  JUMP(0x3A98);
+
+b_0x3672:
+  if (!(i8080_aot_code(c, 0x3672, "\xCD\x45\x3A", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x3675;
+  i8080_aot_op_0xCD(c, 0x3A45); // call $3A45
+  n += 1;
+  JUMP(0x3A45);
+
+b_0x3675:
+  if (!(i8080_aot_code(c, 0x3675, "\x28\x00\x2A\x75\x3B\x23\x7E\xCD\x98\x3A", 10))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x28(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x367A;
+  i8080_aot_op_0x2A(c, 0x3B75); // lhld $3B75
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x367A:
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x367C;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x367C:
+  c->cyc += 17;
+  c->pc = 0x367F;
+  i8080_aot_op_0xCD(c, 0x3A98); // call $3A98
+  n += 1;
+  JUMP(0x3A98);
+
+b_0x367F:
+  if (!(i8080_aot_code(c, 0x367F, "\xCD\x45\x3A", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x3682;
+  i8080_aot_op_0xCD(c, 0x3A45); // call $3A45
+  n += 1;
+  JUMP(0x3A45);
+
+b_0x3682:
+  if (!(i8080_aot_code(c, 0x3682, "\x2E\x00\x3A\x4E\x35\xCD\x98\x3A", 8))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x2E(c, 0x0000); // mvi l,$00
+  n += 1;
+  c->cyc += 20;
+  c->pc = 0x3687;
+  i8080_aot_op_0x3A(c, 0x354E); // lda $354E
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3687:
+  c->cyc += 17;
+  c->pc = 0x368A;
+  i8080_aot_op_0xCD(c, 0x3A98); // call $3A98
+  n += 1;
+  JUMP(0x3A98);
+
+b_0x368A:
+  if (!(i8080_aot_code(c, 0x368A, "\xCD\x45\x3A", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x368D;
+  i8080_aot_op_0xCD(c, 0x3A45); // call $3A45
+  n += 1;
+  JUMP(0x3A45);
+
+b_0x368D:
+  if (!(i8080_aot_code(c, 0x368D, "\x29\x2C\x20\x00\xD1\xE1\xC9", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x29(c, 0x0000); // dad h
+  n += 1;
+  i8080_aot_op_0x2C(c, 0x0000); // inr l
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 33;
+  c->pc = 0x3692;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3692:
+  c->cyc += 10;
+  c->pc = 0x3693;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3693:
+  c->cyc += 10;
+  c->pc = 0x3694;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x3694:
+  if (!(i8080_aot_code(c, 0x3694, "\xF5\xE5\x2A\x75\x3B\xF5\x7E\x32\x4E\x35\xF1\xBE\xCA\xAE\x36", 15))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x3695;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x3694) < 15) {
+    goto dispatch;
+  }
+i_0x3695:
+  c->cyc += 11;
+  c->pc = 0x3696;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x3695) < 14) {
+    goto dispatch;
+  }
+i_0x3696:
+  c->cyc += 16;
+  c->pc = 0x3699;
+  i8080_aot_op_0x2A(c, 0x3B75); // lhld $3B75
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3699:
+  c->cyc += 11;
+  c->pc = 0x369A;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x3699) < 10) {
+    goto dispatch;
+  }
+i_0x369A:
+  c->cyc += 7;
+  c->pc = 0x369B;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x369B:
+  c->cyc += 13;
+  c->pc = 0x369E;
+  i8080_aot_op_0x32(c, 0x354E); // sta $354E
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x369E:
+  c->cyc += 10;
+  c->pc = 0x369F;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x369F:
+  c->cyc += 7;
+  c->pc = 0x36A0;
+  i8080_aot_op_0xBE(c, 0x0000); // cmp M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x36A0:
+  c->cyc += 10;
+  c->pc = 0x36A3;
+  i8080_aot_op_0xCA(c, 0x36AE); // jz $36AE
+  n += 1;
+  if (c->pc == 0x36AE) {
+    JUMP(0x36AE);
+  }
+  JUMP(0x36A3);
+
+b_0x36A3:
+  if (!(i8080_aot_code(c, 0x36A3, "\xF5\x3A\x6B\x3B\x32\x73\x3B\xF1\xC3\xAE\x36", 11))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x36A4;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x36A3) < 11) {
+    goto dispatch;
+  }
+i_0x36A4:
+  c->cyc += 13;
+  c->pc = 0x36A7;
+  i8080_aot_op_0x3A(c, 0x3B6B); // lda $3B6B
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x36A7:
+  c->cyc += 13;
+  c->pc = 0x36AA;
+  i8080_aot_op_0x32(c, 0x3B73); // sta $3B73
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x36AA:
+  c->cyc += 10;
+  c->pc = 0x36AB;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x36AB:
+  c->cyc += 10;
+  c->pc = 0x36AE;
+  i8080_aot_op_0xC3(c, 0x36AE); // jmp $36AE
+  n += 1;
+  JUMP(0x36AE);
+
+b_0x36AE:
+  if (!(i8080_aot_code(c, 0x36AE, "\xCD\xF5\x37", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x36B1;
+  i8080_aot_op_0xCD(c, 0x37F5); // call $37F5
+  n += 1;
+  JUMP(0x37F5);
+
+b_0x36B1:
+  if (!(i8080_aot_code(c, 0x36B1, "\xCD\xBB\x36", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x36B4;
+  i8080_aot_op_0xCD(c, 0x36BB); // call $36BB
+  n += 1;
+  JUMP(0x36BB);
+
+b_0x36B4:
+  if (!(i8080_aot_code(c, 0x36B4, "\x23\x22\x75\x3B\xE1\xF1\xC9", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  c->cyc += 21;
+  c->pc = 0x36B8;
+  i8080_aot_op_0x22(c, 0x3B75); // shld $3B75
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x36B8:
+  c->cyc += 10;
+  c->pc = 0x36B9;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x36B9:
+  c->cyc += 10;
+  c->pc = 0x36BA;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x36BA:
+  c->cyc += 10;
+  c->pc = 0x36BB;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x36BB:
+  if (!(i8080_aot_code(c, 0x36BB, "\x77\xC9", 2))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x36BC;
+  i8080_aot_op_0x77(c, 0x0000); // mov M,a
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x36BC) < 1) {
+    goto dispatch;
+  }
+i_0x36BC:
+  c->cyc += 10;
+  c->pc = 0x36BD;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x36BD:
+  if (!(i8080_aot_code(c, 0x36BD, "\xCD\x45\x3A", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x36C0;
+  i8080_aot_op_0xCD(c, 0x3A45); // call $3A45
+  n += 1;
+  JUMP(0x3A45);
+
+b_0x36C0:
+  if (!(i8080_aot_code(c, 0x36C0, "\x0D\x0A\x43\x50\x55\x20\x46\x41\x49\x4C\x45\x44\x3A\x20\x00\xF5\x3E\x01\x32\x73\x3B", 21))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x36C2;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x36C2:
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  i8080_aot_op_0x50(c, 0x0000); // mov d,b
+  n += 1;
+  i8080_aot_op_0x55(c, 0x0000); // mov d,l
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  c->cyc += 26;
+  c->pc = 0x36C7;
+  i8080_aot_op_0x46(c, 0x0000); // mov b,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x36C7:
+  i8080_aot_op_0x41(c, 0x0000); // mov b,c
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  i8080_aot_op_0x4C(c, 0x0000); // mov c,h
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x44(c, 0x0000); // mov b,h
+  n += 1;
+  c->cyc += 38;
+  c->pc = 0x36CF;
+  i8080_aot_op_0x3A(c, 0x0020); // lda $0020
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x36CF:
+  c->cyc += 11;
+  c->pc = 0x36D0;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x36CF) < 6) {
+    goto dispatch;
+  }
+i_0x36D0:
+  i8080_aot_op_0x3E(c, 0x0001); // mvi a,$01
+  n += 1;
+  c->cyc += 20;
+  c->pc = 0x36D5;
+  i8080_aot_op_0x32(c, 0x3B73); // sta $3B73
+  n += 1;
+  JUMP(0x36D5);
+
+b_0x36D5:
+  if (!(i8080_aot_code(c, 0x36D5, "\xF1\x2A\x71\x3B\x23\x22\x71\x3B\xCD\x45\x3A", 11))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x36D6;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x36D6:
+  c->cyc += 16;
+  c->pc = 0x36D9;
+  i8080_aot_op_0x2A(c, 0x3B71); // lhld $3B71
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x36D9:
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  c->cyc += 21;
+  c->pc = 0x36DD;
+  i8080_aot_op_0x22(c, 0x3B71); // shld $3B71
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x36DD:
+  c->cyc += 17;
+  c->pc = 0x36E0;
+  i8080_aot_op_0xCD(c, 0x3A45); // call $3A45
+  n += 1;
+  JUMP(0x3A45);
+
+b_0x36E0:
+  if (!(i8080_aot_code(c, 0x36E0, "\x0D\x0A\x45\x52\x52\x4F\x52\x20\x43\x4F\x55\x4E\x54\x20\x00\xCD\x82\x3A", 18))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x36E2;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x36E2:
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  i8080_aot_op_0x55(c, 0x0000); // mov d,l
+  n += 1;
+  c->cyc += 51;
+  c->pc = 0x36EC;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x36EC:
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 30;
+  c->pc = 0x36F2;
+  i8080_aot_op_0xCD(c, 0x3A82); // call $3A82
+  n += 1;
+  JUMP(0x3A82);
+
+b_0x36F2:
+  if (!(i8080_aot_code(c, 0x36F2, "\xCD\x45\x3A", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x36F5;
+  i8080_aot_op_0xCD(c, 0x3A45); // call $3A45
+  n += 1;
+  JUMP(0x3A45);
+
+b_0x36F5:
+  if (!(i8080_aot_code(c, 0x36F5, "\x48\x0D\x0A\x00\x2A\x75\x3B\xF5\xCD\x14\x38", 11))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x48(c, 0x0000); // mov c,b
+  n += 1;
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x36F8;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x36F8:
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 20;
+  c->pc = 0x36FC;
+  i8080_aot_op_0x2A(c, 0x3B75); // lhld $3B75
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x36FC:
+  c->cyc += 11;
+  c->pc = 0x36FD;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x36FC) < 4) {
+    goto dispatch;
+  }
+i_0x36FD:
+  c->cyc += 17;
+  c->pc = 0x3700;
+  i8080_aot_op_0xCD(c, 0x3814); // call $3814
+  n += 1;
+  JUMP(0x3814);
+
+b_0x3700:
+  if (!(i8080_aot_code(c, 0x3700, "\xCD\x4A\x36", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x3703;
+  i8080_aot_op_0xCD(c, 0x364A); // call $364A
+  n += 1;
+  JUMP(0x364A);
+
+b_0x3703:
+  if (!(i8080_aot_code(c, 0x3703, "\xCD\x45\x3A", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x3706;
+  i8080_aot_op_0xCD(c, 0x3A45); // call $3A45
+  n += 1;
+  JUMP(0x3A45);
+
+b_0x3706:
+  if (!(i8080_aot_code(c, 0x3706, "\x0D\x0A\x49\x4E\x53\x54\x52\x55\x43\x54\x49\x4F\x4E\x20\x53\x45", 16))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x3708;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3708:
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x370A;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x370A:
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x55(c, 0x0000); // mov d,l
+  n += 1;
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  c->cyc += 47;
+  c->pc = 0x3713;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3713:
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x3716;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  JUMP(0x3716);
+
+b_0x3716:
+  if (!(i8080_aot_code(c, 0x3716, "\x51\x55\x45\x4E\x43\x45\x20\x57\x41\x53\x20\x00\xCD\x1A\x36", 15))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x51(c, 0x0000); // mov d,c
+  n += 1;
+  i8080_aot_op_0x55(c, 0x0000); // mov d,l
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x371A;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x371A:
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x57(c, 0x0000); // mov d,a
+  n += 1;
+  i8080_aot_op_0x41(c, 0x0000); // mov b,c
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 54;
+  c->pc = 0x3725;
+  i8080_aot_op_0xCD(c, 0x361A); // call $361A
+  n += 1;
+  JUMP(0x361A);
+
+b_0x3725:
+  if (!(i8080_aot_code(c, 0x3725, "\xCD\x45\x3A", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x3728;
+  i8080_aot_op_0xCD(c, 0x3A45); // call $3A45
+  n += 1;
+  JUMP(0x3A45);
+
+b_0x3728:
+  if (!(i8080_aot_code(c, 0x3728, "\x48\x0D\x0A\x52\x45\x47\x49\x53\x54\x45\x52\x20\x00\x3A\x4D\x35\xCD\x2D\x36", 19))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x48(c, 0x0000); // mov c,b
+  n += 1;
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x372B;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x372B:
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x47(c, 0x0000); // mov b,a
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 61;
+  c->pc = 0x3738;
+  i8080_aot_op_0x3A(c, 0x354D); // lda $354D
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3738:
+  c->cyc += 17;
+  c->pc = 0x373B;
+  i8080_aot_op_0xCD(c, 0x362D); // call $362D
+  n += 1;
+  JUMP(0x362D);
+
+b_0x373B:
+  if (!(i8080_aot_code(c, 0x373B, "\xF1\xF5\xCD\x45\x3A", 5))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x373C;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x373C:
+  c->cyc += 11;
+  c->pc = 0x373D;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x373C) < 4) {
+    goto dispatch;
+  }
+i_0x373D:
+  c->cyc += 17;
+  c->pc = 0x3740;
+  i8080_aot_op_0xCD(c, 0x3A45); // call $3A45
+  n += 1;
+  JUMP(0x3A45);
+
+b_0x3740:
+  if (!(i8080_aot_code(c, 0x3740, "\x20\x43\x4F\x4E\x54\x41\x49\x4E\x53\x20\x00\xD5\x3A\x4C\x35\xCD\x8D\x3A", 18))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  c->cyc += 21;
+  c->pc = 0x3744;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3744:
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x41(c, 0x0000); // mov b,c
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x3748;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3748:
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x374C;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x374B) < 7) {
+    goto dispatch;
+  }
+i_0x374C:
+  c->cyc += 13;
+  c->pc = 0x374F;
+  i8080_aot_op_0x3A(c, 0x354C); // lda $354C
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x374F:
+  c->cyc += 17;
+  c->pc = 0x3752;
+  i8080_aot_op_0xCD(c, 0x3A8D); // call $3A8D
+  n += 1;
+  JUMP(0x3A8D);
+
+b_0x3752:
+  if (!(i8080_aot_code(c, 0x3752, "\xCD\x45\x3A", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x3755;
+  i8080_aot_op_0xCD(c, 0x3A45); // call $3A45
+  n += 1;
+  JUMP(0x3A45);
+
+b_0x3755:
+  if (!(i8080_aot_code(c, 0x3755, "\x0D\x0A\x42\x55\x54\x20\x53\x48\x4F\x55\x4C\x44\x20\x43\x4F\x4E", 16))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x3757;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3757:
+  i8080_aot_op_0x42(c, 0x0000); // mov b,d
+  n += 1;
+  i8080_aot_op_0x55(c, 0x0000); // mov d,l
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x48(c, 0x0000); // mov c,b
+  n += 1;
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  i8080_aot_op_0x55(c, 0x0000); // mov d,l
+  n += 1;
+  i8080_aot_op_0x4C(c, 0x0000); // mov c,h
+  n += 1;
+  i8080_aot_op_0x44(c, 0x0000); // mov b,h
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  c->cyc += 70;
+  c->pc = 0x3765;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  JUMP(0x3765);
+
+b_0x3765:
+  if (!(i8080_aot_code(c, 0x3765, "\x54\x41\x49\x4E\x20\x00\x2B\x7E\x23\xCD\x8D\x3A", 12))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x41(c, 0x0000); // mov b,c
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x3769;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3769:
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  c->cyc += 20;
+  c->pc = 0x376D;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x376D:
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x3771;
+  i8080_aot_op_0xCD(c, 0x3A8D); // call $3A8D
+  n += 1;
+  JUMP(0x3A8D);
+
+b_0x3771:
+  if (!(i8080_aot_code(c, 0x3771, "\xCD\x45\x3A", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x3774;
+  i8080_aot_op_0xCD(c, 0x3A45); // call $3A45
+  n += 1;
+  JUMP(0x3A45);
+
+b_0x3774:
+  if (!(i8080_aot_code(c, 0x3774, "\x0D\x0A\x52\x45\x47\x49\x53\x54\x45\x52\x20\x56\x41\x4C\x55\x45", 16))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x3776;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3776:
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x47(c, 0x0000); // mov b,a
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  c->cyc += 51;
+  c->pc = 0x3780;
+  i8080_aot_op_0x56(c, 0x0000); // mov d,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3780:
+  i8080_aot_op_0x41(c, 0x0000); // mov b,c
+  n += 1;
+  i8080_aot_op_0x4C(c, 0x0000); // mov c,h
+  n += 1;
+  i8080_aot_op_0x55(c, 0x0000); // mov d,l
+  n += 1;
+  c->cyc += 20;
+  c->pc = 0x3784;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  JUMP(0x3784);
+
+b_0x3784:
+  if (!(i8080_aot_code(c, 0x3784, "\x20\x42\x45\x46\x4F\x52\x45\x20\x49\x4E\x53\x54\x52\x55\x43\x54", 16))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x42(c, 0x0000); // mov b,d
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  c->cyc += 21;
+  c->pc = 0x3788;
+  i8080_aot_op_0x46(c, 0x0000); // mov b,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3788:
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  c->cyc += 31;
+  c->pc = 0x378E;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x378E:
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x55(c, 0x0000); // mov d,l
+  n += 1;
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  c->cyc += 30;
+  c->pc = 0x3794;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  JUMP(0x3794);
+
+b_0x3794:
+  if (!(i8080_aot_code(c, 0x3794, "\x49\x4F\x4E\x20\x53\x45\x51\x55\x45\x4E\x43\x45\x20\x57\x41\x53", 16))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x49(c, 0x0000); // mov c,c
+  n += 1;
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x3797;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3797:
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x51(c, 0x0000); // mov d,c
+  n += 1;
+  i8080_aot_op_0x55(c, 0x0000); // mov d,l
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  c->cyc += 36;
+  c->pc = 0x379E;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x379E:
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x57(c, 0x0000); // mov d,a
+  n += 1;
+  i8080_aot_op_0x41(c, 0x0000); // mov b,c
+  n += 1;
+  c->cyc += 29;
+  c->pc = 0x37A4;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  JUMP(0x37A4);
+
+b_0x37A4:
+  if (!(i8080_aot_code(c, 0x37A4, "\x20\x00\x3A\x4B\x35\xCD\x8D\x3A", 8))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 21;
+  c->pc = 0x37A9;
+  i8080_aot_op_0x3A(c, 0x354B); // lda $354B
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x37A9:
+  c->cyc += 17;
+  c->pc = 0x37AC;
+  i8080_aot_op_0xCD(c, 0x3A8D); // call $3A8D
+  n += 1;
+  JUMP(0x3A8D);
+
+b_0x37AC:
+  if (!(i8080_aot_code(c, 0x37AC, "\xD1\xCD\x45\x3A", 4))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x37AD;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x37AD:
+  c->cyc += 17;
+  c->pc = 0x37B0;
+  i8080_aot_op_0xCD(c, 0x3A45); // call $3A45
+  n += 1;
+  JUMP(0x3A45);
+
+b_0x37B0:
+  if (!(i8080_aot_code(c, 0x37B0, "\x0D\x0A\x54\x45\x53\x54\x20\x4E\x55\x4D\x42\x45\x52\x20\x00\xD5", 16))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x37B2;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x37B2:
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x53(c, 0x0000); // mov d,e
+  n += 1;
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  c->cyc += 31;
+  c->pc = 0x37B8;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x37B8:
+  i8080_aot_op_0x55(c, 0x0000); // mov d,l
+  n += 1;
+  i8080_aot_op_0x4D(c, 0x0000); // mov c,l
+  n += 1;
+  i8080_aot_op_0x42(c, 0x0000); // mov b,d
+  n += 1;
+  i8080_aot_op_0x45(c, 0x0000); // mov b,l
+  n += 1;
+  i8080_aot_op_0x52(c, 0x0000); // mov d,d
+  n += 1;
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 44;
+  c->pc = 0x37C0;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  JUMP(0x37C0);
+
+b_0x37C0:
+  if (!(i8080_aot_code(c, 0x37C0, "\x11\x8C\xC4\x19\xD1\xCD\x63\x3B", 8))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x11(c, 0xC48C); // lxi d,$C48C
+  n += 1;
+  i8080_aot_op_0x19(c, 0x0000); // dad d
+  n += 1;
+  c->cyc += 30;
+  c->pc = 0x37C5;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x37C5:
+  c->cyc += 17;
+  c->pc = 0x37C8;
+  i8080_aot_op_0xCD(c, 0x3B63); // call $3B63
+  n += 1;
+  JUMP(0x3B63);
+
+b_0x37C8:
+  if (!(i8080_aot_code(c, 0x37C8, "\xCD\x82\x3A", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x37CB;
+  i8080_aot_op_0xCD(c, 0x3A82); // call $3A82
+  n += 1;
+  JUMP(0x3A82);
+
+b_0x37CB:
+  if (!(i8080_aot_code(c, 0x37CB, "\xCD\x45\x3A", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x37CE;
+  i8080_aot_op_0xCD(c, 0x3A45); // call $3A45
+  n += 1;
+  JUMP(0x3A45);
+
+b_0x37CE:
+  if (!(i8080_aot_code(c, 0x37CE, "\x48\x0D\x0A\x0A\x00\xCD\x22\x3B", 8))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x48(c, 0x0000); // mov c,b
+  n += 1;
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x37D1;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x37D1:
+  c->cyc += 7;
+  c->pc = 0x37D2;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x37D2:
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 21;
+  c->pc = 0x37D6;
+  i8080_aot_op_0xCD(c, 0x3B22); // call $3B22
+  n += 1;
+  JUMP(0x3B22);
+
+b_0x37D6:
+  if (!(i8080_aot_code(c, 0x37D6, "\xF1\xC9", 2))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x37D7;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x37D7:
+  c->cyc += 10;
+  c->pc = 0x37D8;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x37F5:
+  if (!(i8080_aot_code(c, 0x37F5, "\xF5\x3A\x6B\x3B\xB7\xCA\x04\x38", 8))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x37F6;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x37F5) < 8) {
+    goto dispatch;
+  }
+i_0x37F6:
+  c->cyc += 13;
+  c->pc = 0x37F9;
+  i8080_aot_op_0x3A(c, 0x3B6B); // lda $3B6B
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x37F9:
+  i8080_aot_op_0xB7(c, 0x0000); // ora a
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x37FD;
+  i8080_aot_op_0xCA(c, 0x3804); // jz $3804
+  n += 1;
+  if (c->pc == 0x3804) {
+    JUMP(0x3804);
+  }
+  JUMP(0x37FD);
+
+b_0x37FD:
+  if (!(i8080_aot_code(c, 0x37FD, "\xF1", 1))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x37FE;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  JUMP(0x37FE);
+
+b_0x37FE:
+  if (!(i8080_aot_code(c, 0x37FE, "\xE3\x23", 2) &&
+      i8080_aot_code(c, 0x3800, "\x23\x23\xE3\xC9", 4))) {
+    goto fallback;
+  }
+  c->cyc += 18;
+  c->pc = 0x37FF;
+  i8080_aot_op_0xE3(c, 0x0000); // xthl
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x37FE) < 6) {
+    goto dispatch;
+  }
+i_0x37FF:
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  c->cyc += 33;
+  c->pc = 0x3803;
+  i8080_aot_op_0xE3(c, 0x0000); // xthl
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x3802) < 2) {
+    goto dispatch;
+  }
+i_0x3803:
+  c->cyc += 10;
+  c->pc = 0x3804;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x3804:
+  if (!(i8080_aot_code(c, 0x3804, "\xF1\xC9", 2))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x3805;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3805:
+  c->cyc += 10;
+  c->pc = 0x3806;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x3806:
+  if (!(i8080_aot_code(c, 0x3806, "\xCD\xF5\x37", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x3809;
+  i8080_aot_op_0xCD(c, 0x37F5); // call $37F5
+  n += 1;
+  JUMP(0x37F5);
+
+b_0x3809:
+  if (!(i8080_aot_code(c, 0x3809, "\xC3\xFE\x37", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x380C;
+  i8080_aot_op_0xC3(c, 0x37FE); // jmp $37FE
+  n += 1;
+  JUMP(0x37FE);
+
+b_0x380D:
+  if (!(i8080_aot_code(c, 0x380D, "\xCD\x14\x38", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x3810;
+  i8080_aot_op_0xCD(c, 0x3814); // call $3814
+  n += 1;
+  JUMP(0x3814);
+
+b_0x3810:
+  if (!(i8080_aot_code(c, 0x3810, "\xC3\xFE\x37", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x3813;
+  i8080_aot_op_0xC3(c, 0x37FE); // jmp $37FE
+  n += 1;
+  JUMP(0x37FE);
+
+b_0x3814:
+  if (!(i8080_aot_code(c, 0x3814, "\xF5\x3A\x6F\x3B\xFE\x01\xCA\x04\x38", 9))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x3815;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x3814) < 9) {
+    goto dispatch;
+  }
+i_0x3815:
+  c->cyc += 13;
+  c->pc = 0x3818;
+  i8080_aot_op_0x3A(c, 0x3B6F); // lda $3B6F
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3818:
+  i8080_aot_op_0xFE(c, 0x0001); // cpi $01
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x381D;
+  i8080_aot_op_0xCA(c, 0x3804); // jz $3804
+  n += 1;
+  if (c->pc == 0x3804) {
+    JUMP(0x3804);
+  }
+  JUMP(0x381D);
+
+b_0x381D:
+  if (!(i8080_aot_code(c, 0x381D, "\xF1\xC3\xFE\x37", 4))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x381E;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x381E:
+  c->cyc += 10;
+  c->pc = 0x3821;
+  i8080_aot_op_0xC3(c, 0x37FE); // jmp $37FE
+  n += 1;
+  JUMP(0x37FE);
+
+b_0x3831:
+  if (!(i8080_aot_code(c, 0x3831, "\x22\xB3\x38\xE1\xE3\xE5\xF5\x2A\xB3\x38\x2B\x70\x2B\x71\x2B\x72\x2B\x73\xD1\x2B", 20))) {
+    goto fallback;
+  }
+  c->cyc += 16;
+  c->pc = 0x3834;
+  i8080_aot_op_0x22(c, 0x38B3); // shld $38B3
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3834:
+  c->cyc += 10;
+  c->pc = 0x3835;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3835:
+  c->cyc += 18;
+  c->pc = 0x3836;
+  i8080_aot_op_0xE3(c, 0x0000); // xthl
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x3835) < 16) {
+    goto dispatch;
+  }
+i_0x3836:
+  c->cyc += 11;
+  c->pc = 0x3837;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x3836) < 15) {
+    goto dispatch;
+  }
+i_0x3837:
+  c->cyc += 11;
+  c->pc = 0x3838;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x3837) < 14) {
+    goto dispatch;
+  }
+i_0x3838:
+  c->cyc += 16;
+  c->pc = 0x383B;
+  i8080_aot_op_0x2A(c, 0x38B3); // lhld $38B3
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x383B:
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x383D;
+  i8080_aot_op_0x70(c, 0x0000); // mov M,b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x383D) < 8) {
+    goto dispatch;
+  }
+i_0x383D:
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x383F;
+  i8080_aot_op_0x71(c, 0x0000); // mov M,c
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x383F) < 6) {
+    goto dispatch;
+  }
+i_0x383F:
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x3841;
+  i8080_aot_op_0x72(c, 0x0000); // mov M,d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x3841) < 4) {
+    goto dispatch;
+  }
+i_0x3841:
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x3843;
+  i8080_aot_op_0x73(c, 0x0000); // mov M,e
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x3843) < 2) {
+    goto dispatch;
+  }
+i_0x3843:
+  c->cyc += 10;
+  c->pc = 0x3844;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3844:
+  c->cyc += 5;
+  c->pc = 0x3845;
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  JUMP(0x3845);
+
+b_0x3845:
+  if (!(i8080_aot_code(c, 0x3845, "\x72\x2B\x73\xEB\xE3\xEB\x2B\x72\x2B\x73\xEB\xE3\xEB\xE3\xCD\x33\x39", 17))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x3846;
+  i8080_aot_op_0x72(c, 0x0000); // mov M,d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x3846) < 16) {
+    goto dispatch;
+  }
+i_0x3846:
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x3848;
+  i8080_aot_op_0x73(c, 0x0000); // mov M,e
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x3848) < 14) {
+    goto dispatch;
+  }
+i_0x3848:
+  i8080_aot_op_0xEB(c, 0x0000); // xchg
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x384A;
+  i8080_aot_op_0xE3(c, 0x0000); // xthl
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x3849) < 13) {
+    goto dispatch;
+  }
+i_0x384A:
+  i8080_aot_op_0xEB(c, 0x0000); // xchg
+  n += 1;
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  c->cyc += 16;
+  c->pc = 0x384D;
+  i8080_aot_op_0x72(c, 0x0000); // mov M,d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x384D) < 9) {
+    goto dispatch;
+  }
+i_0x384D:
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x384F;
+  i8080_aot_op_0x73(c, 0x0000); // mov M,e
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x384F) < 7) {
+    goto dispatch;
+  }
+i_0x384F:
+  i8080_aot_op_0xEB(c, 0x0000); // xchg
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x3851;
+  i8080_aot_op_0xE3(c, 0x0000); // xthl
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x3850) < 6) {
+    goto dispatch;
+  }
+i_0x3851:
+  i8080_aot_op_0xEB(c, 0x0000); // xchg
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x3853;
+  i8080_aot_op_0xE3(c, 0x0000); // xthl
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x3852) < 4) {
+    goto dispatch;
+  }
+i_0x3853:
+  c->cyc += 17;
+  c->pc = 0x3856;
+  i8080_aot_op_0xCD(c, 0x3933); // call $3933
+  n += 1;
+  JUMP(0x3933);
+
+b_0x3856:
+  if (!(i8080_aot_code(c, 0x3856, "\x08\xD9", 2))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x08(c, 0x0000); // ill
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x3858;
+  i8080_aot_op_0xD9(c, 0x0000); // ill
+  n += 1;
+  goto dispatch;
+
+b_0x38B7:
+  if (!(i8080_aot_code(c, 0x38B7, "\x2B\x46\x2B\x4E\x2B\x56\x2B\x5E\xD5\x2B\x56\x2B\x5E\xD5\xF1\x2B", 16))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x38B9;
+  i8080_aot_op_0x46(c, 0x0000); // mov b,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x38B9:
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x38BB;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x38BB:
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x38BD;
+  i8080_aot_op_0x56(c, 0x0000); // mov d,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x38BD:
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x38BF;
+  i8080_aot_op_0x5E(c, 0x0000); // mov e,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x38BF:
+  c->cyc += 11;
+  c->pc = 0x38C0;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x38BF) < 8) {
+    goto dispatch;
+  }
+i_0x38C0:
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x38C2;
+  i8080_aot_op_0x56(c, 0x0000); // mov d,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x38C2:
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x38C4;
+  i8080_aot_op_0x5E(c, 0x0000); // mov e,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x38C4:
+  c->cyc += 11;
+  c->pc = 0x38C5;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x38C4) < 3) {
+    goto dispatch;
+  }
+i_0x38C5:
+  c->cyc += 10;
+  c->pc = 0x38C6;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x38C6:
+  c->cyc += 5;
+  c->pc = 0x38C7;
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  JUMP(0x38C7);
+
+b_0x38C7:
+  if (!(i8080_aot_code(c, 0x38C7, "\x56\x2B\x5E\xE3\xEB\xCD\x28\x39", 8))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x38C8;
+  i8080_aot_op_0x56(c, 0x0000); // mov d,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x38C8:
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x38CA;
+  i8080_aot_op_0x5E(c, 0x0000); // mov e,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x38CA:
+  c->cyc += 18;
+  c->pc = 0x38CB;
+  i8080_aot_op_0xE3(c, 0x0000); // xthl
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x38CA) < 5) {
+    goto dispatch;
+  }
+i_0x38CB:
+  i8080_aot_op_0xEB(c, 0x0000); // xchg
+  n += 1;
+  c->cyc += 21;
+  c->pc = 0x38CF;
+  i8080_aot_op_0xCD(c, 0x3928); // call $3928
+  n += 1;
+  JUMP(0x3928);
+
+b_0x38CF:
+  if (!(i8080_aot_code(c, 0x38CF, "\x33\x33\xCD\x28\x39", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x33(c, 0x0000); // inx sp
+  n += 1;
+  i8080_aot_op_0x33(c, 0x0000); // inx sp
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x38D4;
+  i8080_aot_op_0xCD(c, 0x3928); // call $3928
+  n += 1;
+  JUMP(0x3928);
+
+b_0x38D4:
+  if (!(i8080_aot_code(c, 0x38D4, "\xC9", 1))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x38D5;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x3928:
+  if (!(i8080_aot_code(c, 0x3928, "\xF5\x3A\x69\x3B\xB7\xCA\x04\x38", 8))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x3929;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x3928) < 8) {
+    goto dispatch;
+  }
+i_0x3929:
+  c->cyc += 13;
+  c->pc = 0x392C;
+  i8080_aot_op_0x3A(c, 0x3B69); // lda $3B69
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x392C:
+  i8080_aot_op_0xB7(c, 0x0000); // ora a
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x3930;
+  i8080_aot_op_0xCA(c, 0x3804); // jz $3804
+  n += 1;
+  if (c->pc == 0x3804) {
+    JUMP(0x3804);
+  }
+  JUMP(0x3930);
+
+b_0x3930:
+  if (!(i8080_aot_code(c, 0x3930, "\xC3\x3B\x39", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x3933;
+  i8080_aot_op_0xC3(c, 0x393B); // jmp $393B
+  n += 1;
+  JUMP(0x393B);
+
+b_0x3933:
+  if (!(i8080_aot_code(c, 0x3933, "\xF5\x3A\x69\x3B\xB7\xC2\x04\x38", 8))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x3934;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x3933) < 8) {
+    goto dispatch;
+  }
+i_0x3934:
+  c->cyc += 13;
+  c->pc = 0x3937;
+  i8080_aot_op_0x3A(c, 0x3B69); // lda $3B69
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3937:
+  i8080_aot_op_0xB7(c, 0x0000); // ora a
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x393B;
+  i8080_aot_op_0xC2(c, 0x3804); // jnz $3804
+  n += 1;
+  if (c->pc == 0x3804) {
+    JUMP(0x3804);
+  }
+  JUMP(0x393B);
+
+b_0x393B:
+  if (!(i8080_aot_code(c, 0x393B, "\xF1\xE3\x23\x23\xE3\xC9", 6))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x393C;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x393C:
+  c->cyc += 18;
+  c->pc = 0x393D;
+  i8080_aot_op_0xE3(c, 0x0000); // xthl
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x393C) < 5) {
+    goto dispatch;
+  }
+i_0x393D:
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  c->cyc += 28;
+  c->pc = 0x3940;
+  i8080_aot_op_0xE3(c, 0x0000); // xthl
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x393F) < 2) {
+    goto dispatch;
+  }
+i_0x3940:
+  c->cyc += 10;
+  c->pc = 0x3941;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x3941:
+  if (!(i8080_aot_code(c, 0x3941, "\x11\x00\x30\x2A\x75\x3B\xCD\x4B\x39", 9))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x11(c, 0x3000); // lxi d,$3000
+  n += 1;
+  c->cyc += 26;
+  c->pc = 0x3947;
+  i8080_aot_op_0x2A(c, 0x3B75); // lhld $3B75
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3947:
+  c->cyc += 17;
+  c->pc = 0x394A;
+  i8080_aot_op_0xCD(c, 0x394B); // call $394B
+  n += 1;
+  JUMP(0x394B);
+
+b_0x394A:
+  if (!(i8080_aot_code(c, 0x394A, "\xC9", 1))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x394B;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x394B:
+  if (!(i8080_aot_code(c, 0x394B, "\xC5\x7C\x2F\x47\x7D\x2F\x4F\x03\xAF", 9))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x394C;
+  i8080_aot_op_0xC5(c, 0x0000); // push b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x394B) < 9) {
+    goto dispatch;
+  }
+i_0x394C:
+  i8080_aot_op_0x7C(c, 0x0000); // mov a,h
+  n += 1;
+  i8080_aot_op_0x2F(c, 0x0000); // cma
+  n += 1;
+  i8080_aot_op_0x47(c, 0x0000); // mov b,a
+  n += 1;
+  i8080_aot_op_0x7D(c, 0x0000); // mov a,l
+  n += 1;
+  i8080_aot_op_0x2F(c, 0x0000); // cma
+  n += 1;
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  i8080_aot_op_0x03(c, 0x0000); // inx b
+  n += 1;
+  c->cyc += 37;
+  c->pc = 0x3954;
+  i8080_aot_op_0xAF(c, 0x0000); // xra a
+  n += 1;
+  JUMP(0x3954);
+
+b_0x3954:
+  if (!(i8080_aot_code(c, 0x3954, "\x62\x6B\x86\x09\x13\xD2\x54\x39", 8))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x62(c, 0x0000); // mov h,d
+  n += 1;
+  i8080_aot_op_0x6B(c, 0x0000); // mov l,e
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x3957;
+  i8080_aot_op_0x86(c, 0x0000); // add M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3957:
+  i8080_aot_op_0x09(c, 0x0000); // dad b
+  n += 1;
+  i8080_aot_op_0x13(c, 0x0000); // inx d
+  n += 1;
+  c->cyc += 25;
+  c->pc = 0x395C;
+  i8080_aot_op_0xD2(c, 0x3954); // jnc $3954
+  n += 1;
+  if (c->pc == 0x3954) {
+    JUMP(0x3954);
+  }
+  JUMP(0x395C);
+
+b_0x395C:
+  if (!(i8080_aot_code(c, 0x395C, "\xC1\xC9", 2))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x395D;
+  i8080_aot_op_0xC1(c, 0x0000); // pop b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x395D:
+  c->cyc += 10;
+  c->pc = 0x395E;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x395E:
+  if (!(i8080_aot_code(c, 0x395E, "\xCD\x41\x39", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x3961;
+  i8080_aot_op_0xCD(c, 0x3941); // call $3941
+  n += 1;
+  JUMP(0x3941);
+
+b_0x3961:
+  if (!(i8080_aot_code(c, 0x3961, "\xB7\xC4\x81\x32", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xB7(c, 0x0000); // ora a
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x3965;
+  i8080_aot_op_0xC4(c, 0x3281); // cnz $3281
+  n += 1;
+  if (c->pc == 0x3281) {
+    JUMP(0x3281);
+  }
+  JUMP(0x3965);
+
+b_0x3965:
+  if (!(i8080_aot_code(c, 0x3965, "\x1E\x44\xCD\xE1\x32", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x1E(c, 0x0044); // mvi e,$44
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x396A;
+  i8080_aot_op_0xCD(c, 0x32E1); // call $32E1
+  n += 1;
+  JUMP(0x32E1);
+
+b_0x396A:
+  if (!(i8080_aot_code(c, 0x396A, "\xC9", 1))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x396B;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x3A05:
+  if (!(i8080_aot_code(c, 0x3A05, "\xC5\xD5\xE5\xF5\x5F\xCD\xE1\x32", 8))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x3A06;
+  i8080_aot_op_0xC5(c, 0x0000); // push b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x3A05) < 8) {
+    goto dispatch;
+  }
+i_0x3A06:
+  c->cyc += 11;
+  c->pc = 0x3A07;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x3A06) < 7) {
+    goto dispatch;
+  }
+i_0x3A07:
+  c->cyc += 11;
+  c->pc = 0x3A08;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x3A07) < 6) {
+    goto dispatch;
+  }
+i_0x3A08:
+  c->cyc += 11;
+  c->pc = 0x3A09;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x3A08) < 5) {
+    goto dispatch;
+  }
+i_0x3A09:
+  i8080_aot_op_0x5F(c, 0x0000); // mov e,a
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x3A0D;
+  i8080_aot_op_0xCD(c, 0x32E1); // call $32E1
+  n += 1;
+  JUMP(0x32E1);
+
+b_0x3A0D:
+  if (!(i8080_aot_code(c, 0x3A0D, "\xF1\xE1\xD1\xC1\xC9", 5))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x3A0E;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3A0E:
+  c->cyc += 10;
+  c->pc = 0x3A0F;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3A0F:
+  c->cyc += 10;
+  c->pc = 0x3A10;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3A10:
+  c->cyc += 10;
+  c->pc = 0x3A11;
+  i8080_aot_op_0xC1(c, 0x0000); // pop b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3A11:
+  c->cyc += 10;
+  c->pc = 0x3A12;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x3A12:
+  if (!(i8080_aot_code(c, 0x3A12, "\xC5\xD5\xE5\x0E\x01\xCD\x05\x00", 8))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x3A13;
+  i8080_aot_op_0xC5(c, 0x0000); // push b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x3A12) < 8) {
+    goto dispatch;
+  }
+i_0x3A13:
+  c->cyc += 11;
+  c->pc = 0x3A14;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x3A13) < 7) {
+    goto dispatch;
+  }
+i_0x3A14:
+  c->cyc += 11;
+  c->pc = 0x3A15;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x3A14) < 6) {
+    goto dispatch;
+  }
+i_0x3A15:
+  i8080_aot_op_0x0E(c, 0x0001); // mvi c,$01
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x3A1A;
+  i8080_aot_op_0xCD(c, 0x0005); // call $0005
+  n += 1;
+  goto dispatch;
+
+b_0x3A1A:
+  if (!(i8080_aot_code(c, 0x3A1A, "\xE1\xD1\xC1\xC9", 4))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x3A1B;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3A1B:
+  c->cyc += 10;
+  c->pc = 0x3A1C;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3A1C:
+  c->cyc += 10;
+  c->pc = 0x3A1D;
+  i8080_aot_op_0xC1(c, 0x0000); // pop b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3A1D:
+  c->cyc += 10;
+  c->pc = 0x3A1E;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x3A45:
+  if (!(i8080_aot_code(c, 0x3A45, "\xE3\xF5", 2))) {
+    goto fallback;
+  }
+  c->cyc += 18;
+  c->pc = 0x3A46;
+  i8080_aot_op_0xE3(c, 0x0000); // xthl
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x3A45) < 2) {
+    goto dispatch;
+  }
+i_0x3A46:
+  c->cyc += 11;
+  c->pc = 0x3A47;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  JUMP(0x3A47);
+
+b_0x3A47:
+  if (!(i8080_aot_code(c, 0x3A47, "\x7E\x23\xB7\xC2\x50\x3A", 6))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x3A48;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3A48:
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  i8080_aot_op_0xB7(c, 0x0000); // ora a
+  n += 1;
+  c->cyc += 19;
+  c->pc = 0x3A4D;
+  i8080_aot_op_0xC2(c, 0x3A50); // jnz $3A50
+  n += 1;
+  if (c->pc == 0x3A50) {
+    JUMP(0x3A50);
+  }
+  JUMP(0x3A4D);
+
+b_0x3A4D:
+  if (!(i8080_aot_code(c, 0x3A4D, "\xF1\xE3\xC9", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x3A4E;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3A4E:
+  c->cyc += 18;
+  c->pc = 0x3A4F;
+  i8080_aot_op_0xE3(c, 0x0000); // xthl
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x3A4E) < 2) {
+    goto dispatch;
+  }
+i_0x3A4F:
+  c->cyc += 10;
+  c->pc = 0x3A50;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x3A50:
+  if (!(i8080_aot_code(c, 0x3A50, "\xCD\x05\x3A", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x3A53;
+  i8080_aot_op_0xCD(c, 0x3A05); // call $3A05
+  n += 1;
+  JUMP(0x3A05);
+
+b_0x3A53:
+  if (!(i8080_aot_code(c, 0x3A53, "\xC3\x47\x3A", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x3A56;
+  i8080_aot_op_0xC3(c, 0x3A47); // jmp $3A47
+  n += 1;
+  JUMP(0x3A47);
+
+b_0x3A56:
+  if (!(i8080_aot_code(c, 0x3A56, "\xF5\xE5\xD5\xE6\x0F\x21\x6A\x3A\x16\x00\x5F\x19\x7E\xCD\x05\x3A", 16))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x3A57;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x3A56) < 16) {
+    goto dispatch;
+  }
+i_0x3A57:
+  c->cyc += 11;
+  c->pc = 0x3A58;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x3A57) < 15) {
+    goto dispatch;
+  }
+i_0x3A58:
+  c->cyc += 11;
+  c->pc = 0x3A59;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x3A58) < 14) {
+    goto dispatch;
+  }
+i_0x3A59:
+  i8080_aot_op_0xE6(c, 0x000F); // ani $0F
+  n += 1;
+  i8080_aot_op_0x21(c, 0x3A6A); // lxi h,$3A6A
+  n += 1;
+  i8080_aot_op_0x16(c, 0x0000); // mvi d,$00
+  n += 1;
+  i8080_aot_op_0x5F(c, 0x0000); // mov e,a
+  n += 1;
+  i8080_aot_op_0x19(c, 0x0000); // dad d
+  n += 1;
+  c->cyc += 46;
+  c->pc = 0x3A63;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3A63:
+  c->cyc += 17;
+  c->pc = 0x3A66;
+  i8080_aot_op_0xCD(c, 0x3A05); // call $3A05
+  n += 1;
+  JUMP(0x3A05);
+
+b_0x3A66:
+  if (!(i8080_aot_code(c, 0x3A66, "\xD1\xE1\xF1\xC9", 4))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x3A67;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3A67:
+  c->cyc += 10;
+  c->pc = 0x3A68;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3A68:
+  c->cyc += 10;
+  c->pc = 0x3A69;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3A69:
+  c->cyc += 10;
+  c->pc = 0x3A6A;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x3A7A:
+  if (!(i8080_aot_code(c, 0x3A7A, "\xD5\x16\x00\x5F\x19\x7E\xD1\xC9", 8))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x3A7B;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x3A7A) < 8) {
+    goto dispatch;
+  }
+i_0x3A7B:
+  i8080_aot_op_0x16(c, 0x0000); // mvi d,$00
+  n += 1;
+  i8080_aot_op_0x5F(c, 0x0000); // mov e,a
+  n += 1;
+  i8080_aot_op_0x19(c, 0x0000); // dad d
+  n += 1;
+  c->cyc += 29;
+  c->pc = 0x3A80;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3A80:
+  c->cyc += 10;
+  c->pc = 0x3A81;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3A81:
+  c->cyc += 10;
+  c->pc = 0x3A82;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x3A82:
+  if (!(i8080_aot_code(c, 0x3A82, "\xF5\x7C\xCD\x98\x3A", 5))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x3A83;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x3A82) < 5) {
+    goto dispatch;
+  }
+i_0x3A83:
+  i8080_aot_op_0x7C(c, 0x0000); // mov a,h
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x3A87;
+  i8080_aot_op_0xCD(c, 0x3A98); // call $3A98
+  n += 1;
+  JUMP(0x3A98);
+
+b_0x3A87:
+  if (!(i8080_aot_code(c, 0x3A87, "\x7D\xCD\x98\x3A", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x7D(c, 0x0000); // mov a,l
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x3A8B;
+  i8080_aot_op_0xCD(c, 0x3A98); // call $3A98
+  n += 1;
+  JUMP(0x3A98);
+
+b_0x3A8B:
+  if (!(i8080_aot_code(c, 0x3A8B, "\xF1\xC9", 2))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x3A8C;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3A8C:
+  c->cyc += 10;
+  c->pc = 0x3A8D;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x3A8D:
+  if (!(i8080_aot_code(c, 0x3A8D, "\xF5\xCD\x98\x3A", 4))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x3A8E;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x3A8D) < 4) {
+    goto dispatch;
+  }
+i_0x3A8E:
+  c->cyc += 17;
+  c->pc = 0x3A91;
+  i8080_aot_op_0xCD(c, 0x3A98); // call $3A98
+  n += 1;
+  JUMP(0x3A98);
+
+b_0x3A91:
+  if (!(i8080_aot_code(c, 0x3A91, "\x3E\x48\xCD\x05\x3A", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x0048); // mvi a,$48
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x3A96;
+  i8080_aot_op_0xCD(c, 0x3A05); // call $3A05
+  n += 1;
+  JUMP(0x3A05);
+
+b_0x3A96:
+  if (!(i8080_aot_code(c, 0x3A96, "\xF1\xC9", 2))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x3A97;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3A97:
+  c->cyc += 10;
+  c->pc = 0x3A98;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x3A98:
+  if (!(i8080_aot_code(c, 0x3A98, "\xF5\x0F\x0F\x0F\x0F\xCD\x56\x3A", 8))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x3A99;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x3A98) < 8) {
+    goto dispatch;
+  }
+i_0x3A99:
+  i8080_aot_op_0x0F(c, 0x0000); // rrc
+  n += 1;
+  i8080_aot_op_0x0F(c, 0x0000); // rrc
+  n += 1;
+  i8080_aot_op_0x0F(c, 0x0000); // rrc
+  n += 1;
+  i8080_aot_op_0x0F(c, 0x0000); // rrc
+  n += 1;
+  c->cyc += 33;
+  c->pc = 0x3AA0;
+  i8080_aot_op_0xCD(c, 0x3A56); // call $3A56
+  n += 1;
+  JUMP(0x3A56);
+
+b_0x3AA0:
+  if (!(i8080_aot_code(c, 0x3AA0, "\x0F\x0F\x0F\x0F\xCD\x56\x3A", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x0F(c, 0x0000); // rrc
+  n += 1;
+  i8080_aot_op_0x0F(c, 0x0000); // rrc
+  n += 1;
+  i8080_aot_op_0x0F(c, 0x0000); // rrc
+  n += 1;
+  i8080_aot_op_0x0F(c, 0x0000); // rrc
+  n += 1;
+  c->cyc += 33;
+  c->pc = 0x3AA7;
+  i8080_aot_op_0xCD(c, 0x3A56); // call $3A56
+  n += 1;
+  JUMP(0x3A56);
+
+b_0x3AA7:
+  if (!(i8080_aot_code(c, 0x3AA7, "\xF1\xC9", 2))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x3AA8;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3AA8:
+  c->cyc += 10;
+  c->pc = 0x3AA9;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x3AF5:
+  if (!(i8080_aot_code(c, 0x3AF5, "\x3A\xCD\x63\x3B\x60\x69\xCD\x82\x3A", 9))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x3AF8;
+  i8080_aot_op_0x3A(c, 0x63CD); // lda $63CD
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3AF8:
+  i8080_aot_op_0x3B(c, 0x0000); // dcx sp
+  n += 1;
+  i8080_aot_op_0x60(c, 0x0000); // mov h,b
+  n += 1;
+  i8080_aot_op_0x69(c, 0x0000); // mov l,c
+  n += 1;
+  c->cyc += 32;
+  c->pc = 0x3AFE;
+  i8080_aot_op_0xCD(c, 0x3A82); // call $3A82
+  n += 1;
+  JUMP(0x3A82);
+
+b_0x3AFE:
+  if (!(i8080_aot_code(c, 0x3AFE, "\xCD\x63", 2) &&
+      i8080_aot_code(c, 0x3B00, "\x3B", 1))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x3B01;
+  i8080_aot_op_0xCD(c, 0x3B63); // call $3B63
+  n += 1;
+  JUMP(0x3B63);
+
+b_0x3B01:
+  if (!(i8080_aot_code(c, 0x3B01, "\x62\x6B\xCD\x82\x3A", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x62(c, 0x0000); // mov h,d
+  n += 1;
+  i8080_aot_op_0x6B(c, 0x0000); // mov l,e
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x3B06;
+  i8080_aot_op_0xCD(c, 0x3A82); // call $3A82
+  n += 1;
+  JUMP(0x3A82);
+
+b_0x3B06:
+  if (!(i8080_aot_code(c, 0x3B06, "\xCD\x63\x3B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x3B09;
+  i8080_aot_op_0xCD(c, 0x3B63); // call $3B63
+  n += 1;
+  JUMP(0x3B63);
+
+b_0x3B09:
+  if (!(i8080_aot_code(c, 0x3B09, "\x2A\x21\x3B\xCD\x82\x3A", 6))) {
+    goto fallback;
+  }
+  c->cyc += 16;
+  c->pc = 0x3B0C;
+  i8080_aot_op_0x2A(c, 0x3B21); // lhld $3B21
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3B0C:
+  c->cyc += 17;
+  c->pc = 0x3B0F;
+  i8080_aot_op_0xCD(c, 0x3A82); // call $3A82
+  n += 1;
+  JUMP(0x3A82);
+
+b_0x3B0F:
+  if (!(i8080_aot_code(c, 0x3B0F, "\xCD\x63\x3B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x3B12;
+  i8080_aot_op_0xCD(c, 0x3B63); // call $3B63
+  n += 1;
+  JUMP(0x3B63);
+
+b_0x3B12:
+  if (!(i8080_aot_code(c, 0x3B12, "\x21\x00\x00\x39\xCD\x82\x3A", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x21(c, 0x0000); // lxi h,$0000
+  n += 1;
+  i8080_aot_op_0x39(c, 0x0000); // dad sp
+  n += 1;
+  c->cyc += 37;
+  c->pc = 0x3B19;
+  i8080_aot_op_0xCD(c, 0x3A82); // call $3A82
+  n += 1;
+  JUMP(0x3A82);
+
+b_0x3B19:
+  if (!(i8080_aot_code(c, 0x3B19, "\xF1\x2A\x21\x3B\xCD\x5C\x3B", 7))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x3B1A;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3B1A:
+  c->cyc += 16;
+  c->pc = 0x3B1D;
+  i8080_aot_op_0x2A(c, 0x3B21); // lhld $3B21
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3B1D:
+  c->cyc += 17;
+  c->pc = 0x3B20;
+  i8080_aot_op_0xCD(c, 0x3B5C); // call $3B5C
+  n += 1;
+  JUMP(0x3B5C);
+
+b_0x3B20:
+  if (!(i8080_aot_code(c, 0x3B20, "\xC9", 1))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x3B21;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x3B22:
+  if (!(i8080_aot_code(c, 0x3B22, "\xCD\xF6\x20", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x3B25;
+  i8080_aot_op_0xCD(c, 0x20F6); // call $20F6
+  n += 1;
+  JUMP(0x20F6);
+
+b_0x3B25:
+  if (!(i8080_aot_code(c, 0x3B25, "\xC7", 1))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x3B26;
+  i8080_aot_op_0xC7(c, 0x0000); // rst 0
+  n += 1;
+  goto dispatch;
+
+b_0x3B26:
+  if (!(i8080_aot_code(c, 0x3B26, "\x20\xC7", 2))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x3B28;
+  i8080_aot_op_0xC7(c, 0x0000); // rst 0
+  n += 1;
+  goto dispatch;
+
+b_0x3B28:
+  if (!(i8080_aot_code(c, 0x3B28, "\xCA\x04\x38", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x3B2B;
+  i8080_aot_op_0xCA(c, 0x3804); // jz $3804
+  n += 1;
+  if (c->pc == 0x3804) {
+    JUMP(0x3804);
+  }
+  JUMP(0x3B2B);
+
+b_0x3B2B:
+  if (!(i8080_aot_code(c, 0x3B2B, "\xFE\x43\xCA\x04\x38", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xFE(c, 0x0043); // cpi $43
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x3B30;
+  i8080_aot_op_0xCA(c, 0x3804); // jz $3804
+  n += 1;
+  if (c->pc == 0x3804) {
+    JUMP(0x3804);
+  }
+  JUMP(0x3B30);
+
+b_0x3B30:
+  if (!(i8080_aot_code(c, 0x3B30, "\xCD\x12\x3A", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x3B33;
+  i8080_aot_op_0xCD(c, 0x3A12); // call $3A12
+  n += 1;
+  JUMP(0x3A12);
+
+b_0x3B33:
+  if (!(i8080_aot_code(c, 0x3B33, "\x32\x43\x3B\xF5\x2F\x3C\x32\x44\x3B\xF1\xFE\x03\xC2\x04\x38", 15))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x3B36;
+  i8080_aot_op_0x32(c, 0x3B43); // sta $3B43
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3B36:
+  c->cyc += 11;
+  c->pc = 0x3B37;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x3B36) < 12) {
+    goto dispatch;
+  }
+i_0x3B37:
+  i8080_aot_op_0x2F(c, 0x0000); // cma
+  n += 1;
+  i8080_aot_op_0x3C(c, 0x0000); // inr a
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x3B3C;
+  i8080_aot_op_0x32(c, 0x3B44); // sta $3B44
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3B3C:
+  c->cyc += 10;
+  c->pc = 0x3B3D;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3B3D:
+  i8080_aot_op_0xFE(c, 0x0003); // cpi $03
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x3B42;
+  i8080_aot_op_0xC2(c, 0x3804); // jnz $3804
+  n += 1;
+  if (c->pc == 0x3804) {
+    JUMP(0x3804);
+  }
+  JUMP(0x3B42);
+
+b_0x3B42:
+  if (!(i8080_aot_code(c, 0x3B42, "\xC7", 1))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x3B43;
+  i8080_aot_op_0xC7(c, 0x0000); // rst 0
+  n += 1;
+  goto dispatch;
+
+b_0x3B43:
+  if (!(i8080_aot_code(c, 0x3B43, "\x03\xFD\xF5\x3A", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x03(c, 0x0000); // inx b
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x3B47;
+  i8080_aot_op_0xFD(c, 0x3AF5); // ill $3AF5
+  n += 1;
+  JUMP(0x3AF5);
+
+b_0x3B45:
+  if (!(i8080_aot_code(c, 0x3B45, "\xF5\x3A\x43\x3B\xFE\x53\xCA\x04\x38", 9))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x3B46;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x3B45) < 9) {
+    goto dispatch;
+  }
+i_0x3B46:
+  c->cyc += 13;
+  c->pc = 0x3B49;
+  i8080_aot_op_0x3A(c, 0x3B43); // lda $3B43
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3B49:
+  i8080_aot_op_0xFE(c, 0x0053); // cpi $53
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x3B4E;
+  i8080_aot_op_0xCA(c, 0x3804); // jz $3804
+  n += 1;
+  if (c->pc == 0x3804) {
+    JUMP(0x3804);
+  }
+  JUMP(0x3B4E);
+
+b_0x3B47:
+  if (!(i8080_aot_code(c, 0x3B47, "\x43\x3B\xFE\x53\xCA\x04\x38", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x43(c, 0x0000); // mov b,e
+  n += 1;
+  i8080_aot_op_0x3B(c, 0x0000); // dcx sp
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x0053); // cpi $53
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x3B4E;
+  i8080_aot_op_0xCA(c, 0x3804); // jz $3804
+  n += 1;
+  if (c->pc == 0x3804) {
+    JUMP(0x3804);
+  }
+  JUMP(0x3B4E);
+
+b_0x3B4E:
+  if (!(i8080_aot_code(c, 0x3B4E, "\xCD\x45\x3A", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x3B51;
+  i8080_aot_op_0xCD(c, 0x3A45); // call $3A45
+  n += 1;
+  JUMP(0x3A45);
+
+b_0x3B51:
+  if (!(i8080_aot_code(c, 0x3B51, "\x07\x00\xF1\xC9", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x07(c, 0x0000); // rlc
+  n += 1;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x3B54;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3B54:
+  c->cyc += 10;
+  c->pc = 0x3B55;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x3B5C:
+  if (!(i8080_aot_code(c, 0x3B5C, "\xCD\x45\x3A", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x3B5F;
+  i8080_aot_op_0xCD(c, 0x3A45); // call $3A45
+  n += 1;
+  JUMP(0x3A45);
+
+b_0x3B5F:
+  if (!(i8080_aot_code(c, 0x3B5F, "\x0D\x0A\x00\xC9", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x3B61;
+  i8080_aot_op_0x0A(c, 0x0000); // ldax b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x3B61:
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x3B63;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x3B63:
+  if (!(i8080_aot_code(c, 0x3B63, "\xCD\x45\x3A", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x3B66;
+  i8080_aot_op_0xCD(c, 0x3A45); // call $3A45
+  n += 1;
+  JUMP(0x3A45);
+
+b_0x3B66:
+  if (!(i8080_aot_code(c, 0x3B66, "\x20\x00\xC9", 3))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x20(c, 0x0000); // ill
+  n += 1;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x3B69;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+}
+
+// cpu_tests/8080PRE.COM: 63 instructions in 20 blocks
+static unsigned long rom_8080pre_com(i8080* const c, unsigned long cycles) {
+  const unsigned long start = c->cyc;
+  unsigned long n = 0;
+
+dispatch:
+  if (EVENTS(c) != 0 || c->cyc - start >= cycles) {
+    return n;
+  }
+
+  switch (c->pc) {
+  case 0x0100: goto b_0x0100;
+  case 0x0107: goto b_0x0107;
+  case 0x010C: goto b_0x010C;
+  case 0x0111: goto b_0x0111;
+  case 0x0114: goto b_0x0114;
+  case 0x0117: goto b_0x0117;
+  case 0x0118:
+    if (i8080_aot_code(c, 0x0118, "\x7C\xFE\x01\xCA\x21\x01", 6)) {
+      goto i_0x0118;
+    }
+    break;
+  case 0x011E: goto b_0x011E;
+  case 0x0121: goto b_0x0121;
+  case 0x0127: goto b_0x0127;
+  case 0x012A: goto b_0x012A;
+  case 0x012E:
+    if (i8080_aot_code(c, 0x012E, "\xC1\xD1\xE1\x31\xA9\x03\xE5\xD5\xC5\xF5\x3A\xA1\x03\xFE\x02\xC2\x00\x00", 18)) {
+      goto i_0x012E;
+    }
+    break;
+  case 0x012F:
+    if (i8080_aot_code(c, 0x012F, "\xD1\xE1\x31\xA9\x03\xE5\xD5\xC5\xF5\x3A\xA1\x03\xFE\x02\xC2\x00\x00", 17)) {
+      goto i_0x012F;
+    }
+    break;
+  case 0x0130:
+    if (i8080_aot_code(c, 0x0130, "\xE1\x31\xA9\x03\xE5\xD5\xC5\xF5\x3A\xA1\x03\xFE\x02\xC2\x00\x00", 16)) {
+      goto i_0x0130;
+    }
+    break;
+  case 0x0131:
+    if (i8080_aot_code(c, 0x0131, "\x31\xA9\x03\xE5\xD5\xC5\xF5\x3A\xA1\x03\xFE\x02\xC2\x00\x00", 15)) {
+      goto i_0x0131;
+    }
+    break;
+  case 0x0135:
+    if (i8080_aot_code(c, 0x0135, "\xD5\xC5\xF5\x3A\xA1\x03\xFE\x02\xC2\x00\x00", 11)) {
+      goto i_0x0135;
+    }
+    break;
+  case 0x0136:
+    if (i8080_aot_code(c, 0x0136, "\xC5\xF5\x3A\xA1\x03\xFE\x02\xC2\x00\x00", 10)) {
+      goto i_0x0136;
+    }
+    break;
+  case 0x0137:
+    if (i8080_aot_code(c, 0x0137, "\xF5\x3A\xA1\x03\xFE\x02\xC2\x00\x00", 9)) {
+      goto i_0x0137;
+    }
+    break;
+  case 0x0138:
+    if (i8080_aot_code(c, 0x0138, "\x3A\xA1\x03\xFE\x02\xC2\x00\x00", 8)) {
+      goto i_0x0138;
+    }
+    break;
+  case 0x013B:
+    if (i8080_aot_code(c, 0x013B, "\xFE\x02\xC2\x00\x00", 5)) {
+      goto i_0x013B;
+    }
+    break;
+  case 0x0140: goto b_0x0140;
+  case 0x0143:
+    if (i8080_aot_code(c, 0x0143, "\xFE\x04\xC2\x00\x00", 5)) {
+      goto i_0x0143;
+    }
+    break;
+  case 0x0148: goto b_0x0148;
+  case 0x014B:
+    if (i8080_aot_code(c, 0x014B, "\xFE\x06\xC2\x00\x00", 5)) {
+      goto i_0x014B;
+    }
+    break;
+  case 0x0150: goto b_0x0150;
+  case 0x0153:
+    if (i8080_aot_code(c, 0x0153, "\xFE\x08\xC2\x00\x00", 5)) {
+      goto i_0x0153;
+    }
+    break;
+  case 0x0158: goto b_0x0158;
+  case 0x015B:
+    if (i8080_aot_code(c, 0x015B, "\xFE\x0A\xC2\x00\x00", 5)) {
+      goto i_0x015B;
+    }
+    break;
+  case 0x0160: goto b_0x0160;
+  case 0x0163:
+    if (i8080_aot_code(c, 0x0163, "\xFE\x0C\xC2\x00\x00", 5)) {
+      goto i_0x0163;
+    }
+    break;
+  case 0x0168: goto b_0x0168;
+  case 0x016B:
+    if (i8080_aot_code(c, 0x016B, "\xFE\x0E\xC2\x00\x00", 5)) {
+      goto i_0x016B;
+    }
+    break;
+  case 0x0170: goto b_0x0170;
+  case 0x0173:
+    if (i8080_aot_code(c, 0x0173, "\xFE\x10\xC2\x00\x00", 5)) {
+      goto i_0x0173;
+    }
+    break;
+  case 0x0178: goto b_0x0178;
+  case 0x017C:
+    if (i8080_aot_code(c, 0x017C, "\xFE\xA5\xC2\x00\x00", 5)) {
+      goto i_0x017C;
+    }
+    break;
+  case 0x0181: goto b_0x0181;
+  case 0x0185:
+    if (i8080_aot_code(c, 0x0185, "\xFE\x3C\xC2\x00\x00", 5)) {
+      goto i_0x0185;
+    }
+    break;
+  case 0x018A: goto b_0x018A;
+  case 0x0191:
+    if (i8080_aot_code(c, 0x0191, "\xC9", 1)) {
+      goto i_0x0191;
+    }
+    break;
+  }
+
+fallback:
+  // not recompiled, or modified since
+  n += i8080_aot_fallback(c);
+  goto dispatch;
+
+b_0x0100:
+  if (!(i8080_aot_code(c, 0x0100, "\x3E\x01\xFE\x02\xCA\x00\x00", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x0001); // mvi a,$01
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x0002); // cpi $02
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x0107;
+  i8080_aot_op_0xCA(c, 0x0000); // jz $0000
+  n += 1;
+  if (c->pc == 0x0000) {
+    goto dispatch;
+  }
+  JUMP(0x0107);
+
+b_0x0107:
+  if (!(i8080_aot_code(c, 0x0107, "\xFE\x01\xC2\x00\x00", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xFE(c, 0x0001); // cpi $01
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x010C;
+  i8080_aot_op_0xC2(c, 0x0000); // jnz $0000
+  n += 1;
+  if (c->pc == 0x0000) {
+    goto dispatch;
+  }
+  JUMP(0x010C);
+
+b_0x010C:
+  if (!(i8080_aot_code(c, 0x010C, "\xC3\x11\x01", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x010F;
+  i8080_aot_op_0xC3(c, 0x0111); // jmp $0111
+  n += 1;
+  JUMP(0x0111);
+
+b_0x0111:
+  if (!(i8080_aot_code(c, 0x0111, "\xCD\x17\x01", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0114;
+  i8080_aot_op_0xCD(c, 0x0117); // call $0117
+  n += 1;
+  JUMP(0x0117);
+
+b_0x0114:
+  if (!(i8080_aot_code(c, 0x0114, "\xC3\x00\x00", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0117;
+  i8080_aot_op_0xC3(c, 0x0000); // jmp $0000
+  n += 1;
+  goto dispatch;
+
+b_0x0117:
+  if (!(i8080_aot_code(c, 0x0117, "\xE1\x7C\xFE\x01\xCA\x21\x01", 7))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0118;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0118:
+  i8080_aot_op_0x7C(c, 0x0000); // mov a,h
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x0001); // cpi $01
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x011E;
+  i8080_aot_op_0xCA(c, 0x0121); // jz $0121
+  n += 1;
+  if (c->pc == 0x0121) {
+    JUMP(0x0121);
+  }
+  JUMP(0x011E);
+
+b_0x011E:
+  if (!(i8080_aot_code(c, 0x011E, "\xC3\x00\x00", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0121;
+  i8080_aot_op_0xC3(c, 0x0000); // jmp $0000
+  n += 1;
+  goto dispatch;
+
+b_0x0121:
+  if (!(i8080_aot_code(c, 0x0121, "\x7D\xFE\x14\xCA\x2A\x01", 6))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x7D(c, 0x0000); // mov a,l
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x0014); // cpi $14
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x0127;
+  i8080_aot_op_0xCA(c, 0x012A); // jz $012A
+  n += 1;
+  if (c->pc == 0x012A) {
+    JUMP(0x012A);
+  }
+  JUMP(0x0127);
+
+b_0x0127:
+  if (!(i8080_aot_code(c, 0x0127, "\xC3\x00\x00", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x012A;
+  i8080_aot_op_0xC3(c, 0x0000); // jmp $0000
+  n += 1;
+  goto dispatch;
+
+b_0x012A:
+  if (!(i8080_aot_code(c, 0x012A, "\x31\x99\x03\xF1\xC1\xD1\xE1\x31\xA9\x03\xE5\xD5\xC5\xF5\x3A\xA1\x03\xFE\x02\xC2\x00\x00", 22))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x31(c, 0x0399); // lxi sp,$0399
+  n += 1;
+  c->cyc += 20;
+  c->pc = 0x012E;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x012E:
+  c->cyc += 10;
+  c->pc = 0x012F;
+  i8080_aot_op_0xC1(c, 0x0000); // pop b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x012F:
+  c->cyc += 10;
+  c->pc = 0x0130;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0130:
+  c->cyc += 10;
+  c->pc = 0x0131;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0131:
+  i8080_aot_op_0x31(c, 0x03A9); // lxi sp,$03A9
+  n += 1;
+  c->cyc += 21;
+  c->pc = 0x0135;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0134) < 12) {
+    goto dispatch;
+  }
+i_0x0135:
+  c->cyc += 11;
+  c->pc = 0x0136;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0135) < 11) {
+    goto dispatch;
+  }
+i_0x0136:
+  c->cyc += 11;
+  c->pc = 0x0137;
+  i8080_aot_op_0xC5(c, 0x0000); // push b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0136) < 10) {
+    goto dispatch;
+  }
+i_0x0137:
+  c->cyc += 11;
+  c->pc = 0x0138;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0137) < 9) {
+    goto dispatch;
+  }
+i_0x0138:
+  c->cyc += 13;
+  c->pc = 0x013B;
+  i8080_aot_op_0x3A(c, 0x03A1); // lda $03A1
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x013B:
+  i8080_aot_op_0xFE(c, 0x0002); // cpi $02
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0140;
+  i8080_aot_op_0xC2(c, 0x0000); // jnz $0000
+  n += 1;
+  if (c->pc == 0x0000) {
+    goto dispatch;
+  }
+  JUMP(0x0140);
+
+b_0x0140:
+  if (!(i8080_aot_code(c, 0x0140, "\x3A\xA2\x03\xFE\x04\xC2\x00\x00", 8))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x0143;
+  i8080_aot_op_0x3A(c, 0x03A2); // lda $03A2
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0143:
+  i8080_aot_op_0xFE(c, 0x0004); // cpi $04
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0148;
+  i8080_aot_op_0xC2(c, 0x0000); // jnz $0000
+  n += 1;
+  if (c->pc == 0x0000) {
+    goto dispatch;
+  }
+  JUMP(0x0148);
+
+b_0x0148:
+  if (!(i8080_aot_code(c, 0x0148, "\x3A\xA3\x03\xFE\x06\xC2\x00\x00", 8))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x014B;
+  i8080_aot_op_0x3A(c, 0x03A3); // lda $03A3
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x014B:
+  i8080_aot_op_0xFE(c, 0x0006); // cpi $06
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0150;
+  i8080_aot_op_0xC2(c, 0x0000); // jnz $0000
+  n += 1;
+  if (c->pc == 0x0000) {
+    goto dispatch;
+  }
+  JUMP(0x0150);
+
+b_0x0150:
+  if (!(i8080_aot_code(c, 0x0150, "\x3A\xA4\x03\xFE\x08\xC2\x00\x00", 8))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x0153;
+  i8080_aot_op_0x3A(c, 0x03A4); // lda $03A4
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0153:
+  i8080_aot_op_0xFE(c, 0x0008); // cpi $08
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0158;
+  i8080_aot_op_0xC2(c, 0x0000); // jnz $0000
+  n += 1;
+  if (c->pc == 0x0000) {
+    goto dispatch;
+  }
+  JUMP(0x0158);
+
+b_0x0158:
+  if (!(i8080_aot_code(c, 0x0158, "\x3A\xA5\x03\xFE\x0A\xC2\x00\x00", 8))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x015B;
+  i8080_aot_op_0x3A(c, 0x03A5); // lda $03A5
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x015B:
+  i8080_aot_op_0xFE(c, 0x000A); // cpi $0A
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0160;
+  i8080_aot_op_0xC2(c, 0x0000); // jnz $0000
+  n += 1;
+  if (c->pc == 0x0000) {
+    goto dispatch;
+  }
+  JUMP(0x0160);
+
+b_0x0160:
+  if (!(i8080_aot_code(c, 0x0160, "\x3A\xA6\x03\xFE\x0C\xC2\x00\x00", 8))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x0163;
+  i8080_aot_op_0x3A(c, 0x03A6); // lda $03A6
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0163:
+  i8080_aot_op_0xFE(c, 0x000C); // cpi $0C
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0168;
+  i8080_aot_op_0xC2(c, 0x0000); // jnz $0000
+  n += 1;
+  if (c->pc == 0x0000) {
+    goto dispatch;
+  }
+  JUMP(0x0168);
+
+b_0x0168:
+  if (!(i8080_aot_code(c, 0x0168, "\x3A\xA7\x03\xFE\x0E\xC2\x00\x00", 8))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x016B;
+  i8080_aot_op_0x3A(c, 0x03A7); // lda $03A7
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x016B:
+  i8080_aot_op_0xFE(c, 0x000E); // cpi $0E
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0170;
+  i8080_aot_op_0xC2(c, 0x0000); // jnz $0000
+  n += 1;
+  if (c->pc == 0x0000) {
+    goto dispatch;
+  }
+  JUMP(0x0170);
+
+b_0x0170:
+  if (!(i8080_aot_code(c, 0x0170, "\x3A\xA8\x03\xFE\x10\xC2\x00\x00", 8))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x0173;
+  i8080_aot_op_0x3A(c, 0x03A8); // lda $03A8
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0173:
+  i8080_aot_op_0xFE(c, 0x0010); // cpi $10
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0178;
+  i8080_aot_op_0xC2(c, 0x0000); // jnz $0000
+  n += 1;
+  if (c->pc == 0x0000) {
+    goto dispatch;
+  }
+  JUMP(0x0178);
+
+b_0x0178:
+  if (!(i8080_aot_code(c, 0x0178, "\x21\xA9\x03\x7E\xFE\xA5\xC2\x00\x00", 9))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x21(c, 0x03A9); // lxi h,$03A9
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x017C;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x017C:
+  i8080_aot_op_0xFE(c, 0x00A5); // cpi $A5
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0181;
+  i8080_aot_op_0xC2(c, 0x0000); // jnz $0000
+  n += 1;
+  if (c->pc == 0x0000) {
+    goto dispatch;
+  }
+  JUMP(0x0181);
+
+b_0x0181:
+  if (!(i8080_aot_code(c, 0x0181, "\x21\xAA\x03\x7E\xFE\x3C\xC2\x00\x00", 9))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x21(c, 0x03AA); // lxi h,$03AA
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0185;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0185:
+  i8080_aot_op_0xFE(c, 0x003C); // cpi $3C
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x018A;
+  i8080_aot_op_0xC2(c, 0x0000); // jnz $0000
+  n += 1;
+  if (c->pc == 0x0000) {
+    goto dispatch;
+  }
+  JUMP(0x018A);
+
+b_0x018A:
+  if (!(i8080_aot_code(c, 0x018A, "\x31\x00\x05\x21\x95\x01\xE5\xC9", 8))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x31(c, 0x0500); // lxi sp,$0500
+  n += 1;
+  i8080_aot_op_0x21(c, 0x0195); // lxi h,$0195
+  n += 1;
+  c->cyc += 31;
+  c->pc = 0x0191;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0190) < 2) {
+    goto dispatch;
+  }
+i_0x0191:
+  c->cyc += 10;
+  c->pc = 0x0192;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+}
+
+// cpu_tests/8080EXM.COM: 501 instructions in 118 blocks
+static unsigned long rom_8080exm_com(i8080* const c, unsigned long cycles) {
+  const unsigned long start = c->cyc;
+  unsigned long n = 0;
+
+dispatch:
+  if (EVENTS(c) != 0 || c->cyc - start >= cycles) {
+    return n;
+  }
+
+  switch (c->pc) {
+  case 0x0100: goto b_0x0100;
+  case 0x0113: goto b_0x0113;
+  case 0x0116:
+    if (i8080_aot_code(c, 0x0116, "\xF9\x11\x01\x0E\x0E\x09\xCD\xF5\x0D", 9)) {
+      goto i_0x0116;
+    }
+    break;
+  case 0x011F: goto b_0x011F;
+  case 0x0122: goto b_0x0122;
+  case 0x0123:
+    if (i8080_aot_code(c, 0x0123, "\x23\xB6\xCA\x2F\x01", 5)) {
+      goto i_0x0123;
+    }
+    break;
+  case 0x0125:
+    if (i8080_aot_code(c, 0x0125, "\xCA\x2F\x01", 3)) {
+      goto i_0x0125;
+    }
+    break;
+  case 0x0128: goto b_0x0128;
+  case 0x012C: goto b_0x012C;
+  case 0x012F: goto b_0x012F;
+  case 0x0137: goto b_0x0137;
+  case 0x0ACE: goto b_0x0ACE;
+  case 0x0ACF:
+    if (i8080_aot_code(c, 0x0ACF, "\x7E\x23\x66\x6F\x7E\x32\x8A\x0D\x23\xE5\x11\x14\x00\x19\x11\xE9\x0C\xCD\x58\x0C", 20)) {
+      goto i_0x0ACF;
+    }
+    break;
+  case 0x0AD0:
+    if (i8080_aot_code(c, 0x0AD0, "\x23\x66\x6F\x7E\x32\x8A\x0D\x23\xE5\x11\x14\x00\x19\x11\xE9\x0C\xCD\x58\x0C", 19)) {
+      goto i_0x0AD0;
+    }
+    break;
+  case 0x0AD2:
+    if (i8080_aot_code(c, 0x0AD2, "\x6F\x7E\x32\x8A\x0D\x23\xE5\x11\x14\x00\x19\x11\xE9\x0C\xCD\x58\x0C", 17)) {
+      goto i_0x0AD2;
+    }
+    break;
+  case 0x0AD4:
+    if (i8080_aot_code(c, 0x0AD4, "\x32\x8A\x0D\x23\xE5\x11\x14\x00\x19\x11\xE9\x0C\xCD\x58\x0C", 15)) {
+      goto i_0x0AD4;
+    }
+    break;
+  case 0x0AD7:
+    if (i8080_aot_code(c, 0x0AD7, "\x23\xE5\x11\x14\x00\x19\x11\xE9\x0C\xCD\x58\x0C", 12)) {
+      goto i_0x0AD7;
+    }
+    break;
+  case 0x0AD9:
+    if (i8080_aot_code(c, 0x0AD9, "\x11\x14\x00\x19\x11\xE9\x0C\xCD\x58\x0C", 10)) {
+      goto i_0x0AD9;
+    }
+    break;
+  case 0x0AE3: goto b_0x0AE3;
+  case 0x0AE4:
+    if (i8080_aot_code(c, 0x0AE4, "\xE5\x11\x28\x00\x19\x11\x11\x0D\xCD\x58\x0C", 11)) {
+      goto i_0x0AE4;
+    }
+    break;
+  case 0x0AE5:
+    if (i8080_aot_code(c, 0x0AE5, "\x11\x28\x00\x19\x11\x11\x0D\xCD\x58\x0C", 10)) {
+      goto i_0x0AE5;
+    }
+    break;
+  case 0x0AEF: goto b_0x0AEF;
+  case 0x0AF4:
+    if (i8080_aot_code(c, 0x0AF4, "\xE1\xE5\x11\x58\x0D\x01\x04\x00", 8)) {
+      goto i_0x0AF4;
+    }
+    break;
+  case 0x0AF5:
+    if (i8080_aot_code(c, 0x0AF5, "\xE5\x11\x58\x0D\x01\x04\x00", 7)) {
+      goto i_0x0AF5;
+    }
+    break;
+  case 0x0AF6:
+    if (i8080_aot_code(c, 0x0AF6, "\x11\x58\x0D\x01\x04\x00", 6)) {
+      goto i_0x0AF6;
+    }
+    break;
+  case 0x0AFC: goto b_0x0AFC;
+  case 0x0AFD:
+    if (i8080_aot_code(c, 0x0AFD, "\x12\x23\x13", 3) &&
+      i8080_aot_code(c, 0x0B00, "\x0B\x78\xB1\xC2\xFC\x0A", 6)) {
+      goto i_0x0AFD;
+    }
+    break;
+  case 0x0AFE:
+    if (i8080_aot_code(c, 0x0AFE, "\x23\x13", 2) &&
+      i8080_aot_code(c, 0x0B00, "\x0B\x78\xB1\xC2\xFC\x0A", 6)) {
+      goto i_0x0AFE;
+    }
+    break;
+  case 0x0B06: goto b_0x0B06;
+  case 0x0B0C: goto b_0x0B0C;
+  case 0x0B0D:
+    if (i8080_aot_code(c, 0x0B0D, "\x12\x23\x13\x0B\x78\xB1\xC2\x0C\x0B", 9)) {
+      goto i_0x0B0D;
+    }
+    break;
+  case 0x0B0E:
+    if (i8080_aot_code(c, 0x0B0E, "\x23\x13\x0B\x78\xB1\xC2\x0C\x0B", 8)) {
+      goto i_0x0B0E;
+    }
+    break;
+  case 0x0B16: goto b_0x0B16;
+  case 0x0B20: goto b_0x0B20;
+  case 0x0B23: goto b_0x0B23;
+  case 0x0B26:
+    if (i8080_aot_code(c, 0x0B26, "\xFE\x76\xCA\x3A\x0B", 5)) {
+      goto i_0x0B26;
+    }
+    break;
+  case 0x0B2B: goto b_0x0B2B;
+  case 0x0B32: goto b_0x0B32;
+  case 0x0B35:
+    if (i8080_aot_code(c, 0x0B35, "\xFE\x76", 2)) {
+      goto i_0x0B35;
+    }
+    break;
+  case 0x0B37: goto b_0x0B37;
+  case 0x0B3A: goto b_0x0B3A;
+  case 0x0B3D: goto b_0x0B3D;
+  case 0x0B40: goto b_0x0B40;
+  case 0x0B41:
+    if (i8080_aot_code(c, 0x0B41, "\xCA\x81\x0B", 3)) {
+      goto i_0x0B41;
+    }
+    break;
+  case 0x0B44: goto b_0x0B44;
+  case 0x0B4B: goto b_0x0B4B;
+  case 0x0B4E: goto b_0x0B4E;
+  case 0x0B56: goto b_0x0B56;
+  case 0x0B59: goto b_0x0B59;
+  case 0x0B61: goto b_0x0B61;
+  case 0x0B67: goto b_0x0B67;
+  case 0x0B6F: goto b_0x0B6F;
+  case 0x0B70:
+    if (i8080_aot_code(c, 0x0B70, "\x23\x23\xC9", 3)) {
+      goto i_0x0B70;
+    }
+    break;
+  case 0x0B73: goto b_0x0B73;
+  case 0x0B7B: goto b_0x0B7B;
+  case 0x0B7E: goto b_0x0B7E;
+  case 0x0B81: goto b_0x0B81;
+  case 0x0B82:
+    if (i8080_aot_code(c, 0x0B82, "\x3E\x01\x32\xF7\x0B\x32\x1B\x0C\x21\xE9\x0C\x22\xF8\x0B\x21\x11\x0D\x22\x1C\x0C\x06\x04\xE1\xE5\x11\x58\x0D\xCD\xAB\x0B", 30)) {
+      goto i_0x0B82;
+    }
+    break;
+  case 0x0B87:
+    if (i8080_aot_code(c, 0x0B87, "\x32\x1B\x0C\x21\xE9\x0C\x22\xF8\x0B\x21\x11\x0D\x22\x1C\x0C\x06\x04\xE1\xE5\x11\x58\x0D\xCD\xAB\x0B", 25)) {
+      goto i_0x0B87;
+    }
+    break;
+  case 0x0B8A:
+    if (i8080_aot_code(c, 0x0B8A, "\x21\xE9\x0C\x22\xF8\x0B\x21\x11\x0D\x22\x1C\x0C\x06\x04\xE1\xE5\x11\x58\x0D\xCD\xAB\x0B", 22)) {
+      goto i_0x0B8A;
+    }
+    break;
+  case 0x0B90:
+    if (i8080_aot_code(c, 0x0B90, "\x21\x11\x0D\x22\x1C\x0C\x06\x04\xE1\xE5\x11\x58\x0D\xCD\xAB\x0B", 16)) {
+      goto i_0x0B90;
+    }
+    break;
+  case 0x0B96:
+    if (i8080_aot_code(c, 0x0B96, "\x06\x04\xE1\xE5\x11\x58\x0D\xCD\xAB\x0B", 10)) {
+      goto i_0x0B96;
+    }
+    break;
+  case 0x0B99:
+    if (i8080_aot_code(c, 0x0B99, "\xE5\x11\x58\x0D\xCD\xAB\x0B", 7)) {
+      goto i_0x0B99;
+    }
+    break;
+  case 0x0B9A:
+    if (i8080_aot_code(c, 0x0B9A, "\x11\x58\x0D\xCD\xAB\x0B", 6)) {
+      goto i_0x0B9A;
+    }
+    break;
+  case 0x0BA0: goto b_0x0BA0;
+  case 0x0BA8: goto b_0x0BA8;
+  case 0x0BAB: goto b_0x0BAB;
+  case 0x0BAE: goto b_0x0BAE;
+  case 0x0BB3: goto b_0x0BB3;
+  case 0x0BB4: goto b_0x0BB4;
+  case 0x0BB5:
+    if (i8080_aot_code(c, 0x0BB5, "\xD5\xE5\x4E\x11\x14\x00\x19\x7E\xFE\x00\xCA\xD5\x0B", 13)) {
+      goto i_0x0BB5;
+    }
+    break;
+  case 0x0BB6:
+    if (i8080_aot_code(c, 0x0BB6, "\xE5\x4E\x11\x14\x00\x19\x7E\xFE\x00\xCA\xD5\x0B", 12)) {
+      goto i_0x0BB6;
+    }
+    break;
+  case 0x0BB7:
+    if (i8080_aot_code(c, 0x0BB7, "\x4E\x11\x14\x00\x19\x7E\xFE\x00\xCA\xD5\x0B", 11)) {
+      goto i_0x0BB7;
+    }
+    break;
+  case 0x0BB8:
+    if (i8080_aot_code(c, 0x0BB8, "\x11\x14\x00\x19\x7E\xFE\x00\xCA\xD5\x0B", 10)) {
+      goto i_0x0BB8;
+    }
+    break;
+  case 0x0BBD:
+    if (i8080_aot_code(c, 0x0BBD, "\xFE\x00\xCA\xD5\x0B", 5)) {
+      goto i_0x0BBD;
+    }
+    break;
+  case 0x0BC2: goto b_0x0BC2;
+  case 0x0BC4: goto b_0x0BC4;
+  case 0x0BC6:
+    if (i8080_aot_code(c, 0x0BC6, "\x3E\x00\xDC\xFA\x0B", 5)) {
+      goto i_0x0BC6;
+    }
+    break;
+  case 0x0BCB: goto b_0x0BCB;
+  case 0x0BCF:
+    if (i8080_aot_code(c, 0x0BCF, "\x05\xC2\xC4\x0B", 4)) {
+      goto i_0x0BCF;
+    }
+    break;
+  case 0x0BD3: goto b_0x0BD3;
+  case 0x0BD5: goto b_0x0BD5;
+  case 0x0BDA:
+    if (i8080_aot_code(c, 0x0BDA, "\xFE\x00\xCA\xF0\x0B", 5)) {
+      goto i_0x0BDA;
+    }
+    break;
+  case 0x0BDF: goto b_0x0BDF;
+  case 0x0BE1: goto b_0x0BE1;
+  case 0x0BE3:
+    if (i8080_aot_code(c, 0x0BE3, "\x3E\x00\xDC\x1E\x0C", 5)) {
+      goto i_0x0BE3;
+    }
+    break;
+  case 0x0BE8: goto b_0x0BE8;
+  case 0x0BEC:
+    if (i8080_aot_code(c, 0x0BEC, "\x05\xC2\xE1\x0B", 4)) {
+      goto i_0x0BEC;
+    }
+    break;
+  case 0x0BF0: goto b_0x0BF0;
+  case 0x0BF1:
+    if (i8080_aot_code(c, 0x0BF1, "\xD1\x79\x12\x13\xC1\xC9", 6)) {
+      goto i_0x0BF1;
+    }
+    break;
+  case 0x0BF2:
+    if (i8080_aot_code(c, 0x0BF2, "\x79\x12\x13\xC1\xC9", 5)) {
+      goto i_0x0BF2;
+    }
+    break;
+  case 0x0BF4:
+    if (i8080_aot_code(c, 0x0BF4, "\x13\xC1\xC9", 3)) {
+      goto i_0x0BF4;
+    }
+    break;
+  case 0x0BF6:
+    if (i8080_aot_code(c, 0x0BF6, "\xC9", 1)) {
+      goto i_0x0BF6;
+    }
+    break;
+  case 0x0BFA: goto b_0x0BFA;
+  case 0x0BFB:
+    if (i8080_aot_code(c, 0x0BFB, "\xE5\x2A\xF8\x0B\x46", 5) &&
+      i8080_aot_code(c, 0x0C00, "\x21\xF7\x0B\x7E\x4F\x07\x77\xFE\x01\xC2\x13\x0C", 12)) {
+      goto i_0x0BFB;
+    }
+    break;
+  case 0x0BFC:
+    if (i8080_aot_code(c, 0x0BFC, "\x2A\xF8\x0B\x46", 4) &&
+      i8080_aot_code(c, 0x0C00, "\x21\xF7\x0B\x7E\x4F\x07\x77\xFE\x01\xC2\x13\x0C", 12)) {
+      goto i_0x0BFC;
+    }
+    break;
+  case 0x0BFF:
+    if (i8080_aot_code(c, 0x0BFF, "\x46", 1) &&
+      i8080_aot_code(c, 0x0C00, "\x21\xF7\x0B\x7E\x4F\x07\x77\xFE\x01\xC2\x13\x0C", 12)) {
+      goto i_0x0BFF;
+    }
+    break;
+  case 0x0C00:
+    if (i8080_aot_code(c, 0x0C00, "\x21\xF7\x0B\x7E\x4F\x07\x77\xFE\x01\xC2\x13\x0C", 12)) {
+      goto i_0x0C00;
+    }
+    break;
+  case 0x0C04:
+    if (i8080_aot_code(c, 0x0C04, "\x4F\x07\x77\xFE\x01\xC2\x13\x0C", 8)) {
+      goto i_0x0C04;
+    }
+    break;
+  case 0x0C07:
+    if (i8080_aot_code(c, 0x0C07, "\xFE\x01\xC2\x13\x0C", 5)) {
+      goto i_0x0C07;
+    }
+    break;
+  case 0x0C0C: goto b_0x0C0C;
+  case 0x0C0F:
+    if (i8080_aot_code(c, 0x0C0F, "\x23\x22\xF8\x0B", 4)) {
+      goto i_0x0C0F;
+    }
+    break;
+  case 0x0C13: goto b_0x0C13;
+  case 0x0C16:
+    if (i8080_aot_code(c, 0x0C16, "\xC1\xC8", 2)) {
+      goto i_0x0C16;
+    }
+    break;
+  case 0x0C17:
+    if (i8080_aot_code(c, 0x0C17, "\xC8", 1)) {
+      goto i_0x0C17;
+    }
+    break;
+  case 0x0C18: goto b_0x0C18;
+  case 0x0C1E: goto b_0x0C1E;
+  case 0x0C1F:
+    if (i8080_aot_code(c, 0x0C1F, "\xE5\x2A\x1C\x0C\x46\x21\x1B\x0C\x7E\x4F\x07\x77\xFE\x01\xC2\x37\x0C", 17)) {
+      goto i_0x0C1F;
+    }
+    break;
+  case 0x0C20:
+    if (i8080_aot_code(c, 0x0C20, "\x2A\x1C\x0C\x46\x21\x1B\x0C\x7E\x4F\x07\x77\xFE\x01\xC2\x37\x0C", 16)) {
+      goto i_0x0C20;
+    }
+    break;
+  case 0x0C23:
+    if (i8080_aot_code(c, 0x0C23, "\x46\x21\x1B\x0C\x7E\x4F\x07\x77\xFE\x01\xC2\x37\x0C", 13)) {
+      goto i_0x0C23;
+    }
+    break;
+  case 0x0C24:
+    if (i8080_aot_code(c, 0x0C24, "\x21\x1B\x0C\x7E\x4F\x07\x77\xFE\x01\xC2\x37\x0C", 12)) {
+      goto i_0x0C24;
+    }
+    break;
+  case 0x0C28:
+    if (i8080_aot_code(c, 0x0C28, "\x4F\x07\x77\xFE\x01\xC2\x37\x0C", 8)) {
+      goto i_0x0C28;
+    }
+    break;
+  case 0x0C2B:
+    if (i8080_aot_code(c, 0x0C2B, "\xFE\x01\xC2\x37\x0C", 5)) {
+      goto i_0x0C2B;
+    }
+    break;
+  case 0x0C30: goto b_0x0C30;
+  case 0x0C33:
+    if (i8080_aot_code(c, 0x0C33, "\x23\x22\x1C\x0C", 4)) {
+      goto i_0x0C33;
+    }
+    break;
+  case 0x0C37: goto b_0x0C37;
+  case 0x0C3A:
+    if (i8080_aot_code(c, 0x0C3A, "\xC1\xC8", 2)) {
+      goto i_0x0C3A;
+    }
+    break;
+  case 0x0C3B:
+    if (i8080_aot_code(c, 0x0C3B, "\xC8", 1)) {
+      goto i_0x0C3B;
+    }
+    break;
+  case 0x0C3C: goto b_0x0C3C;
+  case 0x0C3F: goto b_0x0C3F;
+  case 0x0C40:
+    if (i8080_aot_code(c, 0x0C40, "\xC5\xD5\xE5\x36\x00\x54\x5D\x13\x0B", 9)) {
+      goto i_0x0C40;
+    }
+    break;
+  case 0x0C41:
+    if (i8080_aot_code(c, 0x0C41, "\xD5\xE5\x36\x00\x54\x5D\x13\x0B", 8)) {
+      goto i_0x0C41;
+    }
+    break;
+  case 0x0C42:
+    if (i8080_aot_code(c, 0x0C42, "\xE5\x36\x00\x54\x5D\x13\x0B", 7)) {
+      goto i_0x0C42;
+    }
+    break;
+  case 0x0C43:
+    if (i8080_aot_code(c, 0x0C43, "\x36\x00\x54\x5D\x13\x0B", 6)) {
+      goto i_0x0C43;
+    }
+    break;
+  case 0x0C45:
+    if (i8080_aot_code(c, 0x0C45, "\x54\x5D\x13\x0B", 4)) {
+      goto i_0x0C45;
+    }
+    break;
+  case 0x0C49: goto b_0x0C49;
+  case 0x0C4A:
+    if (i8080_aot_code(c, 0x0C4A, "\x12\x23\x13\x0B\x78\xB1\xC2\x49\x0C", 9)) {
+      goto i_0x0C4A;
+    }
+    break;
+  case 0x0C4B:
+    if (i8080_aot_code(c, 0x0C4B, "\x23\x13\x0B\x78\xB1\xC2\x49\x0C", 8)) {
+      goto i_0x0C4B;
+    }
+    break;
+  case 0x0C53: goto b_0x0C53;
+  case 0x0C54:
+    if (i8080_aot_code(c, 0x0C54, "\xD1\xC1\xF1\xC9", 4)) {
+      goto i_0x0C54;
+    }
+    break;
+  case 0x0C55:
+    if (i8080_aot_code(c, 0x0C55, "\xC1\xF1\xC9", 3)) {
+      goto i_0x0C55;
+    }
+    break;
+  case 0x0C56:
+    if (i8080_aot_code(c, 0x0C56, "\xF1\xC9", 2)) {
+      goto i_0x0C56;
+    }
+    break;
+  case 0x0C57:
+    if (i8080_aot_code(c, 0x0C57, "\xC9", 1)) {
+      goto i_0x0C57;
+    }
+    break;
+  case 0x0C58: goto b_0x0C58;
+  case 0x0C59:
+    if (i8080_aot_code(c, 0x0C59, "\xEB\x01\x28\x00\xCD\x3F\x0C", 7)) {
+      goto i_0x0C59;
+    }
+    break;
+  case 0x0C60: goto b_0x0C60;
+  case 0x0C67: goto b_0x0C67;
+  case 0x0C68: goto b_0x0C68;
+  case 0x0C6D: goto b_0x0C6D;
+  case 0x0C6E: goto b_0x0C6E;
+  case 0x0C76: goto b_0x0C76;
+  case 0x0C7B: goto b_0x0C7B;
+  case 0x0C8B: goto b_0x0C8B;
+  case 0x0C90: goto b_0x0C90;
+  case 0x0C91:
+    if (i8080_aot_code(c, 0x0C91, "\x19\x11\x14\x00\x19\x77\xC9", 7)) {
+      goto i_0x0C91;
+    }
+    break;
+  case 0x0C97:
+    if (i8080_aot_code(c, 0x0C97, "\xC9", 1)) {
+      goto i_0x0C97;
+    }
+    break;
+  case 0x0C98: goto b_0x0C98;
+  case 0x0C99:
+    if (i8080_aot_code(c, 0x0C99, "\xD5\xE5\x21\xE9\x0C\x11\x14\x00\xEB\x19\xEB", 11)) {
+      goto i_0x0C99;
+    }
+    break;
+  case 0x0C9A:
+    if (i8080_aot_code(c, 0x0C9A, "\xE5\x21\xE9\x0C\x11\x14\x00\xEB\x19\xEB", 10)) {
+      goto i_0x0C9A;
+    }
+    break;
+  case 0x0C9B:
+    if (i8080_aot_code(c, 0x0C9B, "\x21\xE9\x0C\x11\x14\x00\xEB\x19\xEB", 9)) {
+      goto i_0x0C9B;
+    }
+    break;
+  case 0x0CA4: goto b_0x0CA4;
+  case 0x0CA5:
+    if (i8080_aot_code(c, 0x0CA5, "\x7E\xFE\x00\xCA\xB7\x0C", 6)) {
+      goto i_0x0CA5;
+    }
+    break;
+  case 0x0CA6:
+    if (i8080_aot_code(c, 0x0CA6, "\xFE\x00\xCA\xB7\x0C", 5)) {
+      goto i_0x0CA6;
+    }
+    break;
+  case 0x0CAB: goto b_0x0CAB;
+  case 0x0CAD:
+    if (i8080_aot_code(c, 0x0CAD, "\xA0\xCA\xB3\x0C", 4)) {
+      goto i_0x0CAD;
+    }
+    break;
+  case 0x0CB1: goto b_0x0CB1;
+  case 0x0CB3: goto b_0x0CB3;
+  case 0x0CB4:
+    if (i8080_aot_code(c, 0x0CB4, "\xD1\xE1\xC9", 3)) {
+      goto i_0x0CB4;
+    }
+    break;
+  case 0x0CB5:
+    if (i8080_aot_code(c, 0x0CB5, "\xE1\xC9", 2)) {
+      goto i_0x0CB5;
+    }
+    break;
+  case 0x0CB6:
+    if (i8080_aot_code(c, 0x0CB6, "\xC9", 1)) {
+      goto i_0x0CB6;
+    }
+    break;
+  case 0x0CB7: goto b_0x0CB7;
+  case 0x0CBC: goto b_0x0CBC;
+  case 0x0CBD:
+    if (i8080_aot_code(c, 0x0CBD, "\xD5\xE5\x21\x11\x0D\x11\x14\x00\xEB\x19\xEB", 11)) {
+      goto i_0x0CBD;
+    }
+    break;
+  case 0x0CBE:
+    if (i8080_aot_code(c, 0x0CBE, "\xE5\x21\x11\x0D\x11\x14\x00\xEB\x19\xEB", 10)) {
+      goto i_0x0CBE;
+    }
+    break;
+  case 0x0CBF:
+    if (i8080_aot_code(c, 0x0CBF, "\x21\x11\x0D\x11\x14\x00\xEB\x19\xEB", 9)) {
+      goto i_0x0CBF;
+    }
+    break;
+  case 0x0CC8: goto b_0x0CC8;
+  case 0x0CC9:
+    if (i8080_aot_code(c, 0x0CC9, "\xB7\xCA\xE4\x0C", 4)) {
+      goto i_0x0CC9;
+    }
+    break;
+  case 0x0CCD: goto b_0x0CCD;
+  case 0x0CCF:
+    if (i8080_aot_code(c, 0x0CCF, "\xA0\xC2\xE0\x0C", 4)) {
+      goto i_0x0CCF;
+    }
+    break;
+  case 0x0CD3: goto b_0x0CD3;
+  case 0x0CDA: goto b_0x0CDA;
+  case 0x0CDC:
+    if (i8080_aot_code(c, 0x0CDC, "\x23\x13", 2)) {
+      goto i_0x0CDC;
+    }
+    break;
+  case 0x0CDE: goto b_0x0CDE;
+  case 0x0CDF:
+    if (i8080_aot_code(c, 0x0CDF, "\xAF", 1)) {
+      goto i_0x0CDF;
+    }
+    break;
+  case 0x0CE0: goto b_0x0CE0;
+  case 0x0CE1:
+    if (i8080_aot_code(c, 0x0CE1, "\xD1\xC1\xC9", 3)) {
+      goto i_0x0CE1;
+    }
+    break;
+  case 0x0CE2:
+    if (i8080_aot_code(c, 0x0CE2, "\xC1\xC9", 2)) {
+      goto i_0x0CE2;
+    }
+    break;
+  case 0x0CE3:
+    if (i8080_aot_code(c, 0x0CE3, "\xC9", 1)) {
+      goto i_0x0CE3;
+    }
+    break;
+  case 0x0CE4: goto b_0x0CE4;
+  case 0x0D39: goto b_0x0D39;
+  case 0x0D3A:
+    if (i8080_aot_code(c, 0x0D3A, "\xC5\xD5\xE5\xF3", 4)) {
+      goto i_0x0D3A;
+    }
+    break;
+  case 0x0D3B:
+    if (i8080_aot_code(c, 0x0D3B, "\xD5\xE5\xF3", 3)) {
+      goto i_0x0D3B;
+    }
+    break;
+  case 0x0D3C:
+    if (i8080_aot_code(c, 0x0D3C, "\xE5\xF3", 2)) {
+      goto i_0x0D3C;
+    }
+    break;
+  case 0x0D3D:
+    if (i8080_aot_code(c, 0x0D3D, "\xF3", 1)) {
+      goto i_0x0D3D;
+    }
+    break;
+  case 0x0D3E: goto b_0x0D3E;
+  case 0x0D45:
+    if (i8080_aot_code(c, 0x0D45, "\x31\x05\x01\xE1\xE1\xE1\xD1\xC1\xF1\x22\xA2\x0D\x2A\x11\x01\xF9\x2A\xA2\x0D\x00\x00", 21)) {
+      goto i_0x0D45;
+    }
+    break;
+  case 0x0D49:
+    if (i8080_aot_code(c, 0x0D49, "\xE1\xE1\xD1\xC1\xF1\x22\xA2\x0D\x2A\x11\x01\xF9\x2A\xA2\x0D\x00\x00", 17)) {
+      goto i_0x0D49;
+    }
+    break;
+  case 0x0D4A:
+    if (i8080_aot_code(c, 0x0D4A, "\xE1\xD1\xC1\xF1\x22\xA2\x0D\x2A\x11\x01\xF9\x2A\xA2\x0D\x00\x00", 16)) {
+      goto i_0x0D4A;
+    }
+    break;
+  case 0x0D4B:
+    if (i8080_aot_code(c, 0x0D4B, "\xD1\xC1\xF1\x22\xA2\x0D\x2A\x11\x01\xF9\x2A\xA2\x0D\x00\x00", 15)) {
+      goto i_0x0D4B;
+    }
+    break;
+  case 0x0D4C:
+    if (i8080_aot_code(c, 0x0D4C, "\xC1\xF1\x22\xA2\x0D\x2A\x11\x01\xF9\x2A\xA2\x0D\x00\x00", 14)) {
+      goto i_0x0D4C;
+    }
+    break;
+  case 0x0D4D:
+    if (i8080_aot_code(c, 0x0D4D, "\xF1\x22\xA2\x0D\x2A\x11\x01\xF9\x2A\xA2\x0D\x00\x00", 13)) {
+      goto i_0x0D4D;
+    }
+    break;
+  case 0x0D4E:
+    if (i8080_aot_code(c, 0x0D4E, "\x22\xA2\x0D\x2A\x11\x01\xF9\x2A\xA2\x0D\x00\x00", 12)) {
+      goto i_0x0D4E;
+    }
+    break;
+  case 0x0D51:
+    if (i8080_aot_code(c, 0x0D51, "\x2A\x11\x01\xF9\x2A\xA2\x0D\x00\x00", 9)) {
+      goto i_0x0D51;
+    }
+    break;
+  case 0x0D54:
+    if (i8080_aot_code(c, 0x0D54, "\xF9\x2A\xA2\x0D\x00\x00", 6)) {
+      goto i_0x0D54;
+    }
+    break;
+  case 0x0D58:
+    if (i8080_aot_code(c, 0x0D58, "\x00\x00", 2)) {
+      goto i_0x0D58;
+    }
+    break;
+  case 0x0D5A: goto b_0x0D5A;
+  case 0x0D5F:
+    if (i8080_aot_code(c, 0x0D5F, "\x21\x00\x00\xDA\x69\x0D", 6)) {
+      goto i_0x0D5F;
+    }
+    break;
+  case 0x0D65: goto b_0x0D65;
+  case 0x0D69: goto b_0x0D69;
+  case 0x0D6B: goto b_0x0D6B;
+  case 0x0D6E:
+    if (i8080_aot_code(c, 0x0D6E, "\x2A\xA2\x0D\x31\xB2\x0D\xF5\xC5\xD5\xE5\xE5\xE5\x2A\xB4\x0D\xF9\xFB", 17)) {
+      goto i_0x0D6E;
+    }
+    break;
+  case 0x0D71:
+    if (i8080_aot_code(c, 0x0D71, "\x31\xB2\x0D\xF5\xC5\xD5\xE5\xE5\xE5\x2A\xB4\x0D\xF9\xFB", 14)) {
+      goto i_0x0D71;
+    }
+    break;
+  case 0x0D75:
+    if (i8080_aot_code(c, 0x0D75, "\xC5\xD5\xE5\xE5\xE5\x2A\xB4\x0D\xF9\xFB", 10)) {
+      goto i_0x0D75;
+    }
+    break;
+  case 0x0D76:
+    if (i8080_aot_code(c, 0x0D76, "\xD5\xE5\xE5\xE5\x2A\xB4\x0D\xF9\xFB", 9)) {
+      goto i_0x0D76;
+    }
+    break;
+  case 0x0D77:
+    if (i8080_aot_code(c, 0x0D77, "\xE5\xE5\xE5\x2A\xB4\x0D\xF9\xFB", 8)) {
+      goto i_0x0D77;
+    }
+    break;
+  case 0x0D78:
+    if (i8080_aot_code(c, 0x0D78, "\xE5\xE5\x2A\xB4\x0D\xF9\xFB", 7)) {
+      goto i_0x0D78;
+    }
+    break;
+  case 0x0D79:
+    if (i8080_aot_code(c, 0x0D79, "\xE5\x2A\xB4\x0D\xF9\xFB", 6)) {
+      goto i_0x0D79;
+    }
+    break;
+  case 0x0D7A:
+    if (i8080_aot_code(c, 0x0D7A, "\x2A\xB4\x0D\xF9\xFB", 5)) {
+      goto i_0x0D7A;
+    }
+    break;
+  case 0x0D7D:
+    if (i8080_aot_code(c, 0x0D7D, "\xF9\xFB", 2)) {
+      goto i_0x0D7D;
+    }
+    break;
+  case 0x0D7F: goto b_0x0D7F;
+  case 0x0D82:
+    if (i8080_aot_code(c, 0x0D82, "\x22\xA4\x0D\x21\xB0\x0D\x7E\xE6\xFF\x77\x06\x10\x11\xA4\x0D\x21\xB6\x0E", 18)) {
+      goto i_0x0D82;
+    }
+    break;
+  case 0x0D85:
+    if (i8080_aot_code(c, 0x0D85, "\x21\xB0\x0D\x7E\xE6\xFF\x77\x06\x10\x11\xA4\x0D\x21\xB6\x0E", 15)) {
+      goto i_0x0D85;
+    }
+    break;
+  case 0x0D89:
+    if (i8080_aot_code(c, 0x0D89, "\xE6\xFF\x77\x06\x10\x11\xA4\x0D\x21\xB6\x0E", 11)) {
+      goto i_0x0D89;
+    }
+    break;
+  case 0x0D8C:
+    if (i8080_aot_code(c, 0x0D8C, "\x06\x10\x11\xA4\x0D\x21\xB6\x0E", 8)) {
+      goto i_0x0D8C;
+    }
+    break;
+  case 0x0D94: goto b_0x0D94;
+  case 0x0D95:
+    if (i8080_aot_code(c, 0x0D95, "\x13\xCD\x7A\x0E", 4)) {
+      goto i_0x0D95;
+    }
+    break;
+  case 0x0D99: goto b_0x0D99;
+  case 0x0D9D: goto b_0x0D9D;
+  case 0x0D9E:
+    if (i8080_aot_code(c, 0x0D9E, "\xD1\xC1\xF1\xC9", 4)) {
+      goto i_0x0D9E;
+    }
+    break;
+  case 0x0D9F:
+    if (i8080_aot_code(c, 0x0D9F, "\xC1\xF1\xC9", 3)) {
+      goto i_0x0D9F;
+    }
+    break;
+  case 0x0DA0:
+    if (i8080_aot_code(c, 0x0DA0, "\xF1\xC9", 2)) {
+      goto i_0x0DA0;
+    }
+    break;
+  case 0x0DA1:
+    if (i8080_aot_code(c, 0x0DA1, "\xC9", 1)) {
+      goto i_0x0DA1;
+    }
+    break;
+  case 0x0DC0: goto b_0x0DC0;
+  case 0x0DC1:
+    if (i8080_aot_code(c, 0x0DC1, "\xC5\xE5\x06\x04", 4)) {
+      goto i_0x0DC1;
+    }
+    break;
+  case 0x0DC2:
+    if (i8080_aot_code(c, 0x0DC2, "\xE5\x06\x04", 3)) {
+      goto i_0x0DC2;
+    }
+    break;
+  case 0x0DC3:
+    if (i8080_aot_code(c, 0x0DC3, "\x06\x04", 2)) {
+      goto i_0x0DC3;
+    }
+    break;
+  case 0x0DC5: goto b_0x0DC5;
+  case 0x0DC6:
+    if (i8080_aot_code(c, 0x0DC6, "\xCD\xD2\x0D", 3)) {
+      goto i_0x0DC6;
+    }
+    break;
+  case 0x0DC9: goto b_0x0DC9;
+  case 0x0DCE: goto b_0x0DCE;
+  case 0x0DCF:
+    if (i8080_aot_code(c, 0x0DCF, "\xC1\xF1\xC9", 3)) {
+      goto i_0x0DCF;
+    }
+    break;
+  case 0x0DD0:
+    if (i8080_aot_code(c, 0x0DD0, "\xF1\xC9", 2)) {
+      goto i_0x0DD0;
+    }
+    break;
+  case 0x0DD1:
+    if (i8080_aot_code(c, 0x0DD1, "\xC9", 1)) {
+      goto i_0x0DD1;
+    }
+    break;
+  case 0x0DD2: goto b_0x0DD2;
+  case 0x0DD3:
+    if (i8080_aot_code(c, 0x0DD3, "\x0F\x0F\x0F\x0F\xCD\xDB\x0D", 7)) {
+      goto i_0x0DD3;
+    }
+    break;
+  case 0x0DDA: goto b_0x0DDA;
+  case 0x0DDB: goto b_0x0DDB;
+  case 0x0DDC:
+    if (i8080_aot_code(c, 0x0DDC, "\xC5\xD5\xE5\xE6\x0F\xFE\x0A\xDA\xE8\x0D", 10)) {
+      goto i_0x0DDC;
+    }
+    break;
+  case 0x0DDD:
+    if (i8080_aot_code(c, 0x0DDD, "\xD5\xE5\xE6\x0F\xFE\x0A\xDA\xE8\x0D", 9)) {
+      goto i_0x0DDD;
+    }
+    break;
+  case 0x0DDE:
+    if (i8080_aot_code(c, 0x0DDE, "\xE5\xE6\x0F\xFE\x0A\xDA\xE8\x0D", 8)) {
+      goto i_0x0DDE;
+    }
+    break;
+  case 0x0DDF:
+    if (i8080_aot_code(c, 0x0DDF, "\xE6\x0F\xFE\x0A\xDA\xE8\x0D", 7)) {
+      goto i_0x0DDF;
+    }
+    break;
+  case 0x0DE6: goto b_0x0DE6;
+  case 0x0DE8: goto b_0x0DE8;
+  case 0x0DF0: goto b_0x0DF0;
+  case 0x0DF1:
+    if (i8080_aot_code(c, 0x0DF1, "\xD1\xC1\xF1\xC9", 4)) {
+      goto i_0x0DF1;
+    }
+    break;
+  case 0x0DF2:
+    if (i8080_aot_code(c, 0x0DF2, "\xC1\xF1\xC9", 3)) {
+      goto i_0x0DF2;
+    }
+    break;
+  case 0x0DF3:
+    if (i8080_aot_code(c, 0x0DF3, "\xF1\xC9", 2)) {
+      goto i_0x0DF3;
+    }
+    break;
+  case 0x0DF4:
+    if (i8080_aot_code(c, 0x0DF4, "\xC9", 1)) {
+      goto i_0x0DF4;
+    }
+    break;
+  case 0x0DF5: goto b_0x0DF5;
+  case 0x0DF6:
+    if (i8080_aot_code(c, 0x0DF6, "\xC5\xD5\xE5\xCD\x05\x00", 6)) {
+      goto i_0x0DF6;
+    }
+    break;
+  case 0x0DF7:
+    if (i8080_aot_code(c, 0x0DF7, "\xD5\xE5\xCD\x05\x00", 5)) {
+      goto i_0x0DF7;
+    }
+    break;
+  case 0x0DF8:
+    if (i8080_aot_code(c, 0x0DF8, "\xE5\xCD\x05\x00", 4)) {
+      goto i_0x0DF8;
+    }
+    break;
+  case 0x0DF9:
+    if (i8080_aot_code(c, 0x0DF9, "\xCD\x05\x00", 3)) {
+      goto i_0x0DF9;
+    }
+    break;
+  case 0x0DFC: goto b_0x0DFC;
+  case 0x0DFD:
+    if (i8080_aot_code(c, 0x0DFD, "\xD1\xC1\xF1", 3) &&
+      i8080_aot_code(c, 0x0E00, "\xC9", 1)) {
+      goto i_0x0DFD;
+    }
+    break;
+  case 0x0DFE:
+    if (i8080_aot_code(c, 0x0DFE, "\xC1\xF1", 2) &&
+      i8080_aot_code(c, 0x0E00, "\xC9", 1)) {
+      goto i_0x0DFE;
+    }
+    break;
+  case 0x0DFF:
+    if (i8080_aot_code(c, 0x0DFF, "\xF1", 1) &&
+      i8080_aot_code(c, 0x0E00, "\xC9", 1)) {
+      goto i_0x0DFF;
+    }
+    break;
+  case 0x0E00:
+    if (i8080_aot_code(c, 0x0E00, "\xC9", 1)) {
+      goto i_0x0E00;
+    }
+    break;
+  case 0x0E63: goto b_0x0E63;
+  case 0x0E64:
+    if (i8080_aot_code(c, 0x0E64, "\xD5\xE5\x11\xB6\x0E\x06\x04", 7)) {
+      goto i_0x0E64;
+    }
+    break;
+  case 0x0E65:
+    if (i8080_aot_code(c, 0x0E65, "\xE5\x11\xB6\x0E\x06\x04", 6)) {
+      goto i_0x0E65;
+    }
+    break;
+  case 0x0E66:
+    if (i8080_aot_code(c, 0x0E66, "\x11\xB6\x0E\x06\x04", 5)) {
+      goto i_0x0E66;
+    }
+    break;
+  case 0x0E6B: goto b_0x0E6B;
+  case 0x0E6C:
+    if (i8080_aot_code(c, 0x0E6C, "\xBE\xC2\x76\x0E", 4)) {
+      goto i_0x0E6C;
+    }
+    break;
+  case 0x0E6D:
+    if (i8080_aot_code(c, 0x0E6D, "\xC2\x76\x0E", 3)) {
+      goto i_0x0E6D;
+    }
+    break;
+  case 0x0E70: goto b_0x0E70;
+  case 0x0E76: goto b_0x0E76;
+  case 0x0E77:
+    if (i8080_aot_code(c, 0x0E77, "\xD1\xC1\xC9", 3)) {
+      goto i_0x0E77;
+    }
+    break;
+  case 0x0E78:
+    if (i8080_aot_code(c, 0x0E78, "\xC1\xC9", 2)) {
+      goto i_0x0E78;
+    }
+    break;
+  case 0x0E79:
+    if (i8080_aot_code(c, 0x0E79, "\xC9", 1)) {
+      goto i_0x0E79;
+    }
+    break;
+  case 0x0E7A: goto b_0x0E7A;
+  case 0x0E7B:
+    if (i8080_aot_code(c, 0x0E7B, "\xC5\xD5\xE5\xE5\x11\x03\x00\x19\xAE\x6F\x26\x00\x29\x29\xEB\x21\xBA\x0E\x19\xEB", 20)) {
+      goto i_0x0E7B;
+    }
+    break;
+  case 0x0E7C:
+    if (i8080_aot_code(c, 0x0E7C, "\xD5\xE5\xE5\x11\x03\x00\x19\xAE\x6F\x26\x00\x29\x29\xEB\x21\xBA\x0E\x19\xEB", 19)) {
+      goto i_0x0E7C;
+    }
+    break;
+  case 0x0E7D:
+    if (i8080_aot_code(c, 0x0E7D, "\xE5\xE5\x11\x03\x00\x19\xAE\x6F\x26\x00\x29\x29\xEB\x21\xBA\x0E\x19\xEB", 18)) {
+      goto i_0x0E7D;
+    }
+    break;
+  case 0x0E7E:
+    if (i8080_aot_code(c, 0x0E7E, "\xE5\x11\x03\x00\x19\xAE\x6F\x26\x00\x29\x29\xEB\x21\xBA\x0E\x19\xEB", 17)) {
+      goto i_0x0E7E;
+    }
+    break;
+  case 0x0E7F:
+    if (i8080_aot_code(c, 0x0E7F, "\x11\x03\x00\x19\xAE\x6F\x26\x00\x29\x29\xEB\x21\xBA\x0E\x19\xEB", 16)) {
+      goto i_0x0E7F;
+    }
+    break;
+  case 0x0E84:
+    if (i8080_aot_code(c, 0x0E84, "\x6F\x26\x00\x29\x29\xEB\x21\xBA\x0E\x19\xEB", 11)) {
+      goto i_0x0E84;
+    }
+    break;
+  case 0x0E8F: goto b_0x0E8F;
+  case 0x0E90:
+    if (i8080_aot_code(c, 0x0E90, "\x01\x04\x00", 3)) {
+      goto i_0x0E90;
+    }
+    break;
+  case 0x0E93: goto b_0x0E93;
+  case 0x0E94:
+    if (i8080_aot_code(c, 0x0E94, "\xA8\x46\x77\x13\x23\x0D\xC2\x93\x0E", 9)) {
+      goto i_0x0E94;
+    }
+    break;
+  case 0x0E96:
+    if (i8080_aot_code(c, 0x0E96, "\x77\x13\x23\x0D\xC2\x93\x0E", 7)) {
+      goto i_0x0E96;
+    }
+    break;
+  case 0x0E97:
+    if (i8080_aot_code(c, 0x0E97, "\x13\x23\x0D\xC2\x93\x0E", 6)) {
+      goto i_0x0E97;
+    }
+    break;
+  case 0x0E9D: goto b_0x0E9D;
+  case 0x0E9E:
+    if (i8080_aot_code(c, 0x0E9E, "\xD1\xC1\xF1\xC9", 4)) {
+      goto i_0x0E9E;
+    }
+    break;
+  case 0x0E9F:
+    if (i8080_aot_code(c, 0x0E9F, "\xC1\xF1\xC9", 3)) {
+      goto i_0x0E9F;
+    }
+    break;
+  case 0x0EA0:
+    if (i8080_aot_code(c, 0x0EA0, "\xF1\xC9", 2)) {
+      goto i_0x0EA0;
+    }
+    break;
+  case 0x0EA1:
+    if (i8080_aot_code(c, 0x0EA1, "\xC9", 1)) {
+      goto i_0x0EA1;
+    }
+    break;
+  case 0x0EA2: goto b_0x0EA2;
+  case 0x0EA3:
+    if (i8080_aot_code(c, 0x0EA3, "\xC5\xE5\x21\xB6\x0E\x3E\xFF\x06\x04", 9)) {
+      goto i_0x0EA3;
+    }
+    break;
+  case 0x0EA4:
+    if (i8080_aot_code(c, 0x0EA4, "\xE5\x21\xB6\x0E\x3E\xFF\x06\x04", 8)) {
+      goto i_0x0EA4;
+    }
+    break;
+  case 0x0EA5:
+    if (i8080_aot_code(c, 0x0EA5, "\x21\xB6\x0E\x3E\xFF\x06\x04", 7)) {
+      goto i_0x0EA5;
+    }
+    break;
+  case 0x0EAC: goto b_0x0EAC;
+  case 0x0EAD:
+    if (i8080_aot_code(c, 0x0EAD, "\x23\x05\xC2\xAC\x0E", 5)) {
+      goto i_0x0EAD;
+    }
+    break;
+  case 0x0EB2: goto b_0x0EB2;
+  case 0x0EB3:
+    if (i8080_aot_code(c, 0x0EB3, "\xC1\xF1\xC9", 3)) {
+      goto i_0x0EB3;
+    }
+    break;
+  case 0x0EB4:
+    if (i8080_aot_code(c, 0x0EB4, "\xF1\xC9", 2)) {
+      goto i_0x0EB4;
+    }
+    break;
+  case 0x0EB5:
+    if (i8080_aot_code(c, 0x0EB5, "\xC9", 1)) {
+      goto i_0x0EB5;
+    }
+    break;
+  }
+
+fallback:
+  // not recompiled, or modified since
+  n += i8080_aot_fallback(c);
+  goto dispatch;
+
+b_0x0100:
+  if (!(i8080_aot_code(c, 0x0100, "\xC3\x13\x01", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0103;
+  i8080_aot_op_0xC3(c, 0x0113); // jmp $0113
+  n += 1;
+  JUMP(0x0113);
+
+b_0x0113:
+  if (!(i8080_aot_code(c, 0x0113, "\x2A\x06\x00\xF9\x11\x01\x0E\x0E\x09\xCD\xF5\x0D", 12))) {
+    goto fallback;
+  }
+  c->cyc += 16;
+  c->pc = 0x0116;
+  i8080_aot_op_0x2A(c, 0x0006); // lhld $0006
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0116:
+  i8080_aot_op_0xF9(c, 0x0000); // sphl
+  n += 1;
+  i8080_aot_op_0x11(c, 0x0E01); // lxi d,$0E01
+  n += 1;
+  i8080_aot_op_0x0E(c, 0x0009); // mvi c,$09
+  n += 1;
+  c->cyc += 39;
+  c->pc = 0x011F;
+  i8080_aot_op_0xCD(c, 0x0DF5); // call $0DF5
+  n += 1;
+  JUMP(0x0DF5);
+
+b_0x011F:
+  if (!(i8080_aot_code(c, 0x011F, "\x21\x3A\x01", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0122;
+  i8080_aot_op_0x21(c, 0x013A); // lxi h,$013A
+  n += 1;
+  JUMP(0x0122);
+
+b_0x0122:
+  if (!(i8080_aot_code(c, 0x0122, "\x7E\x23\xB6\xCA\x2F\x01", 6))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x0123;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0123:
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x0125;
+  i8080_aot_op_0xB6(c, 0x0000); // ora M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0125:
+  c->cyc += 10;
+  c->pc = 0x0128;
+  i8080_aot_op_0xCA(c, 0x012F); // jz $012F
+  n += 1;
+  if (c->pc == 0x012F) {
+    JUMP(0x012F);
+  }
+  JUMP(0x0128);
+
+b_0x0128:
+  if (!(i8080_aot_code(c, 0x0128, "\x2B\xCD\xCE\x0A", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x2B(c, 0x0000); // dcx h
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x012C;
+  i8080_aot_op_0xCD(c, 0x0ACE); // call $0ACE
+  n += 1;
+  JUMP(0x0ACE);
+
+b_0x012C:
+  if (!(i8080_aot_code(c, 0x012C, "\xC3\x22\x01", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x012F;
+  i8080_aot_op_0xC3(c, 0x0122); // jmp $0122
+  n += 1;
+  JUMP(0x0122);
+
+b_0x012F:
+  if (!(i8080_aot_code(c, 0x012F, "\x11\x1E\x0E\x0E\x09\xCD\xF5\x0D", 8))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x11(c, 0x0E1E); // lxi d,$0E1E
+  n += 1;
+  i8080_aot_op_0x0E(c, 0x0009); // mvi c,$09
+  n += 1;
+  c->cyc += 34;
+  c->pc = 0x0137;
+  i8080_aot_op_0xCD(c, 0x0DF5); // call $0DF5
+  n += 1;
+  JUMP(0x0DF5);
+
+b_0x0137:
+  if (!(i8080_aot_code(c, 0x0137, "\xC3\x00\x00", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x013A;
+  i8080_aot_op_0xC3(c, 0x0000); // jmp $0000
+  n += 1;
+  goto dispatch;
+
+b_0x0ACE:
+  if (!(i8080_aot_code(c, 0x0ACE, "\xE5\x7E\x23\x66\x6F\x7E\x32\x8A\x0D\x23\xE5\x11\x14\x00\x19\x11\xE9\x0C\xCD\x58\x0C", 21))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0ACF;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0ACE) < 21) {
+    goto dispatch;
+  }
+i_0x0ACF:
+  c->cyc += 7;
+  c->pc = 0x0AD0;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0AD0:
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x0AD2;
+  i8080_aot_op_0x66(c, 0x0000); // mov h,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0AD2:
+  i8080_aot_op_0x6F(c, 0x0000); // mov l,a
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x0AD4;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0AD4:
+  c->cyc += 13;
+  c->pc = 0x0AD7;
+  i8080_aot_op_0x32(c, 0x0D8A); // sta $0D8A
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0AD7:
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  c->cyc += 16;
+  c->pc = 0x0AD9;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0AD8) < 11) {
+    goto dispatch;
+  }
+i_0x0AD9:
+  i8080_aot_op_0x11(c, 0x0014); // lxi d,$0014
+  n += 1;
+  i8080_aot_op_0x19(c, 0x0000); // dad d
+  n += 1;
+  i8080_aot_op_0x11(c, 0x0CE9); // lxi d,$0CE9
+  n += 1;
+  c->cyc += 47;
+  c->pc = 0x0AE3;
+  i8080_aot_op_0xCD(c, 0x0C58); // call $0C58
+  n += 1;
+  JUMP(0x0C58);
+
+b_0x0AE3:
+  if (!(i8080_aot_code(c, 0x0AE3, "\xE1\xE5\x11\x28\x00\x19\x11\x11\x0D\xCD\x58\x0C", 12))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0AE4;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0AE4:
+  c->cyc += 11;
+  c->pc = 0x0AE5;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0AE4) < 11) {
+    goto dispatch;
+  }
+i_0x0AE5:
+  i8080_aot_op_0x11(c, 0x0028); // lxi d,$0028
+  n += 1;
+  i8080_aot_op_0x19(c, 0x0000); // dad d
+  n += 1;
+  i8080_aot_op_0x11(c, 0x0D11); // lxi d,$0D11
+  n += 1;
+  c->cyc += 47;
+  c->pc = 0x0AEF;
+  i8080_aot_op_0xCD(c, 0x0C58); // call $0C58
+  n += 1;
+  JUMP(0x0C58);
+
+b_0x0AEF:
+  if (!(i8080_aot_code(c, 0x0AEF, "\x21\x11\x0D\x36\x01\xE1\xE5\x11\x58\x0D\x01\x04\x00", 13))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x21(c, 0x0D11); // lxi h,$0D11
+  n += 1;
+  c->cyc += 20;
+  c->pc = 0x0AF4;
+  i8080_aot_op_0x36(c, 0x0001); // mvi M,$01
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x0AF4) < 8) {
+    goto dispatch;
+  }
+i_0x0AF4:
+  c->cyc += 10;
+  c->pc = 0x0AF5;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0AF5:
+  c->cyc += 11;
+  c->pc = 0x0AF6;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0AF5) < 7) {
+    goto dispatch;
+  }
+i_0x0AF6:
+  i8080_aot_op_0x11(c, 0x0D58); // lxi d,$0D58
+  n += 1;
+  c->cyc += 20;
+  c->pc = 0x0AFC;
+  i8080_aot_op_0x01(c, 0x0004); // lxi b,$0004
+  n += 1;
+  JUMP(0x0AFC);
+
+b_0x0AFC:
+  if (!(i8080_aot_code(c, 0x0AFC, "\x7E\x12\x23\x13", 4) &&
+      i8080_aot_code(c, 0x0B00, "\x0B\x78\xB1\xC2\xFC\x0A", 6))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x0AFD;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0AFD:
+  c->cyc += 7;
+  c->pc = 0x0AFE;
+  i8080_aot_op_0x12(c, 0x0000); // stax d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_de(c) - 0x0AFE) < 8) {
+    goto dispatch;
+  }
+i_0x0AFE:
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  i8080_aot_op_0x13(c, 0x0000); // inx d
+  n += 1;
+  i8080_aot_op_0x0B(c, 0x0000); // dcx b
+  n += 1;
+  i8080_aot_op_0x78(c, 0x0000); // mov a,b
+  n += 1;
+  i8080_aot_op_0xB1(c, 0x0000); // ora c
+  n += 1;
+  c->cyc += 34;
+  c->pc = 0x0B06;
+  i8080_aot_op_0xC2(c, 0x0AFC); // jnz $0AFC
+  n += 1;
+  if (c->pc == 0x0AFC) {
+    JUMP(0x0AFC);
+  }
+  JUMP(0x0B06);
+
+b_0x0B06:
+  if (!(i8080_aot_code(c, 0x0B06, "\x11\x03\x01\x01\x10\x00", 6))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x11(c, 0x0103); // lxi d,$0103
+  n += 1;
+  c->cyc += 20;
+  c->pc = 0x0B0C;
+  i8080_aot_op_0x01(c, 0x0010); // lxi b,$0010
+  n += 1;
+  JUMP(0x0B0C);
+
+b_0x0B0C:
+  if (!(i8080_aot_code(c, 0x0B0C, "\x7E\x12\x23\x13\x0B\x78\xB1\xC2\x0C\x0B", 10))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x0B0D;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0B0D:
+  c->cyc += 7;
+  c->pc = 0x0B0E;
+  i8080_aot_op_0x12(c, 0x0000); // stax d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_de(c) - 0x0B0E) < 8) {
+    goto dispatch;
+  }
+i_0x0B0E:
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  i8080_aot_op_0x13(c, 0x0000); // inx d
+  n += 1;
+  i8080_aot_op_0x0B(c, 0x0000); // dcx b
+  n += 1;
+  i8080_aot_op_0x78(c, 0x0000); // mov a,b
+  n += 1;
+  i8080_aot_op_0xB1(c, 0x0000); // ora c
+  n += 1;
+  c->cyc += 34;
+  c->pc = 0x0B16;
+  i8080_aot_op_0xC2(c, 0x0B0C); // jnz $0B0C
+  n += 1;
+  if (c->pc == 0x0B0C) {
+    JUMP(0x0B0C);
+  }
+  JUMP(0x0B16);
+
+b_0x0B16:
+  if (!(i8080_aot_code(c, 0x0B16, "\x11\x2C\x00\x19\xEB\x0E\x09\xCD\xF5\x0D", 10))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x11(c, 0x002C); // lxi d,$002C
+  n += 1;
+  i8080_aot_op_0x19(c, 0x0000); // dad d
+  n += 1;
+  i8080_aot_op_0xEB(c, 0x0000); // xchg
+  n += 1;
+  i8080_aot_op_0x0E(c, 0x0009); // mvi c,$09
+  n += 1;
+  c->cyc += 48;
+  c->pc = 0x0B20;
+  i8080_aot_op_0xCD(c, 0x0DF5); // call $0DF5
+  n += 1;
+  JUMP(0x0DF5);
+
+b_0x0B20:
+  if (!(i8080_aot_code(c, 0x0B20, "\xCD\xA2\x0E", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0B23;
+  i8080_aot_op_0xCD(c, 0x0EA2); // call $0EA2
+  n += 1;
+  JUMP(0x0EA2);
+
+b_0x0B23:
+  if (!(i8080_aot_code(c, 0x0B23, "\x3A\x58\x0D\xFE\x76\xCA\x3A\x0B", 8))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x0B26;
+  i8080_aot_op_0x3A(c, 0x0D58); // lda $0D58
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0B26:
+  i8080_aot_op_0xFE(c, 0x0076); // cpi $76
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0B2B;
+  i8080_aot_op_0xCA(c, 0x0B3A); // jz $0B3A
+  n += 1;
+  if (c->pc == 0x0B3A) {
+    JUMP(0x0B3A);
+  }
+  JUMP(0x0B2B);
+
+b_0x0B2B:
+  if (!(i8080_aot_code(c, 0x0B2B, "\xE6\xDF\xFE\xDD\xC2\x37\x0B", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xE6(c, 0x00DF); // ani $DF
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x00DD); // cpi $DD
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x0B32;
+  i8080_aot_op_0xC2(c, 0x0B37); // jnz $0B37
+  n += 1;
+  if (c->pc == 0x0B37) {
+    JUMP(0x0B37);
+  }
+  JUMP(0x0B32);
+
+b_0x0B32:
+  if (!(i8080_aot_code(c, 0x0B32, "\x3A\x59\x0D\xFE\x76", 5))) {
+    goto fallback;
+  }
+  c->cyc += 13;
+  c->pc = 0x0B35;
+  i8080_aot_op_0x3A(c, 0x0D59); // lda $0D59
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0B35:
+  c->cyc += 7;
+  c->pc = 0x0B37;
+  i8080_aot_op_0xFE(c, 0x0076); // cpi $76
+  n += 1;
+  JUMP(0x0B37);
+
+b_0x0B37:
+  if (!(i8080_aot_code(c, 0x0B37, "\xC4\x39\x0D", 3))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0B3A;
+  i8080_aot_op_0xC4(c, 0x0D39); // cnz $0D39
+  n += 1;
+  if (c->pc == 0x0D39) {
+    JUMP(0x0D39);
+  }
+  JUMP(0x0B3A);
+
+b_0x0B3A:
+  if (!(i8080_aot_code(c, 0x0B3A, "\xCD\x98\x0C", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0B3D;
+  i8080_aot_op_0xCD(c, 0x0C98); // call $0C98
+  n += 1;
+  JUMP(0x0C98);
+
+b_0x0B3D:
+  if (!(i8080_aot_code(c, 0x0B3D, "\xC4\xBC\x0C", 3))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0B40;
+  i8080_aot_op_0xC4(c, 0x0CBC); // cnz $0CBC
+  n += 1;
+  if (c->pc == 0x0CBC) {
+    JUMP(0x0CBC);
+  }
+  JUMP(0x0B40);
+
+b_0x0B40:
+  if (!(i8080_aot_code(c, 0x0B40, "\xE1\xCA\x81\x0B", 4))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0B41;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0B41:
+  c->cyc += 10;
+  c->pc = 0x0B44;
+  i8080_aot_op_0xCA(c, 0x0B81); // jz $0B81
+  n += 1;
+  if (c->pc == 0x0B81) {
+    JUMP(0x0B81);
+  }
+  JUMP(0x0B44);
+
+b_0x0B44:
+  if (!(i8080_aot_code(c, 0x0B44, "\x11\x3C\x00\x19\xCD\x63\x0E", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x11(c, 0x003C); // lxi d,$003C
+  n += 1;
+  i8080_aot_op_0x19(c, 0x0000); // dad d
+  n += 1;
+  c->cyc += 37;
+  c->pc = 0x0B4B;
+  i8080_aot_op_0xCD(c, 0x0E63); // call $0E63
+  n += 1;
+  JUMP(0x0E63);
+
+b_0x0B4B:
+  if (!(i8080_aot_code(c, 0x0B4B, "\xCA\x73\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0B4E;
+  i8080_aot_op_0xCA(c, 0x0B73); // jz $0B73
+  n += 1;
+  if (c->pc == 0x0B73) {
+    JUMP(0x0B73);
+  }
+  JUMP(0x0B4E);
+
+b_0x0B4E:
+  if (!(i8080_aot_code(c, 0x0B4E, "\x11\x3D\x0E\x0E\x09\xCD\xF5\x0D", 8))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x11(c, 0x0E3D); // lxi d,$0E3D
+  n += 1;
+  i8080_aot_op_0x0E(c, 0x0009); // mvi c,$09
+  n += 1;
+  c->cyc += 34;
+  c->pc = 0x0B56;
+  i8080_aot_op_0xCD(c, 0x0DF5); // call $0DF5
+  n += 1;
+  JUMP(0x0DF5);
+
+b_0x0B56:
+  if (!(i8080_aot_code(c, 0x0B56, "\xCD\xC0\x0D", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0B59;
+  i8080_aot_op_0xCD(c, 0x0DC0); // call $0DC0
+  n += 1;
+  JUMP(0x0DC0);
+
+b_0x0B59:
+  if (!(i8080_aot_code(c, 0x0B59, "\x11\x58\x0E\x0E\x09\xCD\xF5\x0D", 8))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x11(c, 0x0E58); // lxi d,$0E58
+  n += 1;
+  i8080_aot_op_0x0E(c, 0x0009); // mvi c,$09
+  n += 1;
+  c->cyc += 34;
+  c->pc = 0x0B61;
+  i8080_aot_op_0xCD(c, 0x0DF5); // call $0DF5
+  n += 1;
+  JUMP(0x0DF5);
+
+b_0x0B61:
+  if (!(i8080_aot_code(c, 0x0B61, "\x21\xB6\x0E\xCD\xC0\x0D", 6))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x21(c, 0x0EB6); // lxi h,$0EB6
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x0B67;
+  i8080_aot_op_0xCD(c, 0x0DC0); // call $0DC0
+  n += 1;
+  JUMP(0x0DC0);
+
+b_0x0B67:
+  if (!(i8080_aot_code(c, 0x0B67, "\x11\x60\x0E\x0E\x09\xCD\xF5\x0D", 8))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x11(c, 0x0E60); // lxi d,$0E60
+  n += 1;
+  i8080_aot_op_0x0E(c, 0x0009); // mvi c,$09
+  n += 1;
+  c->cyc += 34;
+  c->pc = 0x0B6F;
+  i8080_aot_op_0xCD(c, 0x0DF5); // call $0DF5
+  n += 1;
+  JUMP(0x0DF5);
+
+b_0x0B6F:
+  if (!(i8080_aot_code(c, 0x0B6F, "\xE1\x23\x23\xC9", 4))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0B70;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0B70:
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  c->cyc += 20;
+  c->pc = 0x0B73;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x0B73:
+  if (!(i8080_aot_code(c, 0x0B73, "\x11\x2D\x0E\x0E\x09\xCD\xF5\x0D", 8))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x11(c, 0x0E2D); // lxi d,$0E2D
+  n += 1;
+  i8080_aot_op_0x0E(c, 0x0009); // mvi c,$09
+  n += 1;
+  c->cyc += 34;
+  c->pc = 0x0B7B;
+  i8080_aot_op_0xCD(c, 0x0DF5); // call $0DF5
+  n += 1;
+  JUMP(0x0DF5);
+
+b_0x0B7B:
+  if (!(i8080_aot_code(c, 0x0B7B, "\xCD\xC0\x0D", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0B7E;
+  i8080_aot_op_0xCD(c, 0x0DC0); // call $0DC0
+  n += 1;
+  JUMP(0x0DC0);
+
+b_0x0B7E:
+  if (!(i8080_aot_code(c, 0x0B7E, "\xC3\x67\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0B81;
+  i8080_aot_op_0xC3(c, 0x0B67); // jmp $0B67
+  n += 1;
+  JUMP(0x0B67);
+
+b_0x0B81:
+  if (!(i8080_aot_code(c, 0x0B81, "\xE5\x3E\x01\x32\xF7\x0B\x32\x1B\x0C\x21\xE9\x0C\x22\xF8\x0B\x21\x11\x0D\x22\x1C\x0C\x06\x04\xE1\xE5\x11\x58\x0D\xCD\xAB\x0B", 31))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0B82;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0B81) < 31) {
+    goto dispatch;
+  }
+i_0x0B82:
+  i8080_aot_op_0x3E(c, 0x0001); // mvi a,$01
+  n += 1;
+  c->cyc += 20;
+  c->pc = 0x0B87;
+  i8080_aot_op_0x32(c, 0x0BF7); // sta $0BF7
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0B87:
+  c->cyc += 13;
+  c->pc = 0x0B8A;
+  i8080_aot_op_0x32(c, 0x0C1B); // sta $0C1B
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0B8A:
+  i8080_aot_op_0x21(c, 0x0CE9); // lxi h,$0CE9
+  n += 1;
+  c->cyc += 26;
+  c->pc = 0x0B90;
+  i8080_aot_op_0x22(c, 0x0BF8); // shld $0BF8
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0B90:
+  i8080_aot_op_0x21(c, 0x0D11); // lxi h,$0D11
+  n += 1;
+  c->cyc += 26;
+  c->pc = 0x0B96;
+  i8080_aot_op_0x22(c, 0x0C1C); // shld $0C1C
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0B96:
+  i8080_aot_op_0x06(c, 0x0004); // mvi b,$04
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0B99;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0B99:
+  c->cyc += 11;
+  c->pc = 0x0B9A;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0B99) < 7) {
+    goto dispatch;
+  }
+i_0x0B9A:
+  i8080_aot_op_0x11(c, 0x0D58); // lxi d,$0D58
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x0BA0;
+  i8080_aot_op_0xCD(c, 0x0BAB); // call $0BAB
+  n += 1;
+  JUMP(0x0BAB);
+
+b_0x0BA0:
+  if (!(i8080_aot_code(c, 0x0BA0, "\x06\x10\x11\x03\x01\xCD\xAB\x0B", 8))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x06(c, 0x0010); // mvi b,$10
+  n += 1;
+  i8080_aot_op_0x11(c, 0x0103); // lxi d,$0103
+  n += 1;
+  c->cyc += 34;
+  c->pc = 0x0BA8;
+  i8080_aot_op_0xCD(c, 0x0BAB); // call $0BAB
+  n += 1;
+  JUMP(0x0BAB);
+
+b_0x0BA8:
+  if (!(i8080_aot_code(c, 0x0BA8, "\xC3\x23\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0BAB;
+  i8080_aot_op_0xC3(c, 0x0B23); // jmp $0B23
+  n += 1;
+  JUMP(0x0B23);
+
+b_0x0BAB:
+  if (!(i8080_aot_code(c, 0x0BAB, "\xCD\xB4\x0B", 3))) {
+    goto fallback;
+  }
+  c->cyc += 17;
+  c->pc = 0x0BAE;
+  i8080_aot_op_0xCD(c, 0x0BB4); // call $0BB4
+  n += 1;
+  JUMP(0x0BB4);
+
+b_0x0BAE:
+  if (!(i8080_aot_code(c, 0x0BAE, "\x23\x05\xC2\xAB\x0B", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  i8080_aot_op_0x05(c, 0x0000); // dcr b
+  n += 1;
+  c->cyc += 20;
+  c->pc = 0x0BB3;
+  i8080_aot_op_0xC2(c, 0x0BAB); // jnz $0BAB
+  n += 1;
+  if (c->pc == 0x0BAB) {
+    JUMP(0x0BAB);
+  }
+  JUMP(0x0BB3);
+
+b_0x0BB3:
+  if (!(i8080_aot_code(c, 0x0BB3, "\xC9", 1))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0BB4;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x0BB4:
+  if (!(i8080_aot_code(c, 0x0BB4, "\xC5\xD5\xE5\x4E\x11\x14\x00\x19\x7E\xFE\x00\xCA\xD5\x0B", 14))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0BB5;
+  i8080_aot_op_0xC5(c, 0x0000); // push b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0BB4) < 14) {
+    goto dispatch;
+  }
+i_0x0BB5:
+  c->cyc += 11;
+  c->pc = 0x0BB6;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0BB5) < 13) {
+    goto dispatch;
+  }
+i_0x0BB6:
+  c->cyc += 11;
+  c->pc = 0x0BB7;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0BB6) < 12) {
+    goto dispatch;
+  }
+i_0x0BB7:
+  c->cyc += 7;
+  c->pc = 0x0BB8;
+  i8080_aot_op_0x4E(c, 0x0000); // mov c,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0BB8:
+  i8080_aot_op_0x11(c, 0x0014); // lxi d,$0014
+  n += 1;
+  i8080_aot_op_0x19(c, 0x0000); // dad d
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x0BBD;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0BBD:
+  i8080_aot_op_0xFE(c, 0x0000); // cpi $00
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0BC2;
+  i8080_aot_op_0xCA(c, 0x0BD5); // jz $0BD5
+  n += 1;
+  if (c->pc == 0x0BD5) {
+    JUMP(0x0BD5);
+  }
+  JUMP(0x0BC2);
+
+b_0x0BC2:
+  if (!(i8080_aot_code(c, 0x0BC2, "\x06\x08", 2))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x0BC4;
+  i8080_aot_op_0x06(c, 0x0008); // mvi b,$08
+  n += 1;
+  JUMP(0x0BC4);
+
+b_0x0BC4:
+  if (!(i8080_aot_code(c, 0x0BC4, "\x0F\xF5\x3E\x00\xDC\xFA\x0B", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x0F(c, 0x0000); // rrc
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x0BC6;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0BC5) < 6) {
+    goto dispatch;
+  }
+i_0x0BC6:
+  i8080_aot_op_0x3E(c, 0x0000); // mvi a,$00
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x0BCB;
+  i8080_aot_op_0xDC(c, 0x0BFA); // cc $0BFA
+  n += 1;
+  if (c->pc == 0x0BFA) {
+    JUMP(0x0BFA);
+  }
+  JUMP(0x0BCB);
+
+b_0x0BCB:
+  if (!(i8080_aot_code(c, 0x0BCB, "\xA9\x0F\x4F\xF1\x05\xC2\xC4\x0B", 8))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xA9(c, 0x0000); // xra c
+  n += 1;
+  i8080_aot_op_0x0F(c, 0x0000); // rrc
+  n += 1;
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  c->cyc += 23;
+  c->pc = 0x0BCF;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0BCF:
+  i8080_aot_op_0x05(c, 0x0000); // dcr b
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x0BD3;
+  i8080_aot_op_0xC2(c, 0x0BC4); // jnz $0BC4
+  n += 1;
+  if (c->pc == 0x0BC4) {
+    JUMP(0x0BC4);
+  }
+  JUMP(0x0BD3);
+
+b_0x0BD3:
+  if (!(i8080_aot_code(c, 0x0BD3, "\x06\x08", 2))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x0BD5;
+  i8080_aot_op_0x06(c, 0x0008); // mvi b,$08
+  n += 1;
+  JUMP(0x0BD5);
+
+b_0x0BD5:
+  if (!(i8080_aot_code(c, 0x0BD5, "\x11\x14\x00\x19\x7E\xFE\x00\xCA\xF0\x0B", 10))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x11(c, 0x0014); // lxi d,$0014
+  n += 1;
+  i8080_aot_op_0x19(c, 0x0000); // dad d
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x0BDA;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0BDA:
+  i8080_aot_op_0xFE(c, 0x0000); // cpi $00
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0BDF;
+  i8080_aot_op_0xCA(c, 0x0BF0); // jz $0BF0
+  n += 1;
+  if (c->pc == 0x0BF0) {
+    JUMP(0x0BF0);
+  }
+  JUMP(0x0BDF);
+
+b_0x0BDF:
+  if (!(i8080_aot_code(c, 0x0BDF, "\x06\x08", 2))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x0BE1;
+  i8080_aot_op_0x06(c, 0x0008); // mvi b,$08
+  n += 1;
+  JUMP(0x0BE1);
+
+b_0x0BE1:
+  if (!(i8080_aot_code(c, 0x0BE1, "\x0F\xF5\x3E\x00\xDC\x1E\x0C", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x0F(c, 0x0000); // rrc
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x0BE3;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0BE2) < 6) {
+    goto dispatch;
+  }
+i_0x0BE3:
+  i8080_aot_op_0x3E(c, 0x0000); // mvi a,$00
+  n += 1;
+  c->cyc += 18;
+  c->pc = 0x0BE8;
+  i8080_aot_op_0xDC(c, 0x0C1E); // cc $0C1E
+  n += 1;
+  if (c->pc == 0x0C1E) {
+    JUMP(0x0C1E);
+  }
+  JUMP(0x0BE8);
+
+b_0x0BE8:
+  if (!(i8080_aot_code(c, 0x0BE8, "\xA9\x0F\x4F\xF1\x05\xC2\xE1\x0B", 8))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xA9(c, 0x0000); // xra c
+  n += 1;
+  i8080_aot_op_0x0F(c, 0x0000); // rrc
+  n += 1;
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  c->cyc += 23;
+  c->pc = 0x0BEC;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0BEC:
+  i8080_aot_op_0x05(c, 0x0000); // dcr b
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x0BF0;
+  i8080_aot_op_0xC2(c, 0x0BE1); // jnz $0BE1
+  n += 1;
+  if (c->pc == 0x0BE1) {
+    JUMP(0x0BE1);
+  }
+  JUMP(0x0BF0);
+
+b_0x0BF0:
+  if (!(i8080_aot_code(c, 0x0BF0, "\xE1\xD1\x79\x12\x13\xC1\xC9", 7))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0BF1;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0BF1:
+  c->cyc += 10;
+  c->pc = 0x0BF2;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0BF2:
+  i8080_aot_op_0x79(c, 0x0000); // mov a,c
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x0BF4;
+  i8080_aot_op_0x12(c, 0x0000); // stax d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_de(c) - 0x0BF4) < 3) {
+    goto dispatch;
+  }
+i_0x0BF4:
+  i8080_aot_op_0x13(c, 0x0000); // inx d
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x0BF6;
+  i8080_aot_op_0xC1(c, 0x0000); // pop b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0BF6:
+  c->cyc += 10;
+  c->pc = 0x0BF7;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x0BFA:
+  if (!(i8080_aot_code(c, 0x0BFA, "\xC5\xE5\x2A\xF8\x0B\x46", 6) &&
+      i8080_aot_code(c, 0x0C00, "\x21\xF7\x0B\x7E\x4F\x07\x77\xFE\x01\xC2\x13\x0C", 12))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0BFB;
+  i8080_aot_op_0xC5(c, 0x0000); // push b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0BFA) < 18) {
+    goto dispatch;
+  }
+i_0x0BFB:
+  c->cyc += 11;
+  c->pc = 0x0BFC;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0BFB) < 17) {
+    goto dispatch;
+  }
+i_0x0BFC:
+  c->cyc += 16;
+  c->pc = 0x0BFF;
+  i8080_aot_op_0x2A(c, 0x0BF8); // lhld $0BF8
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0BFF:
+  c->cyc += 7;
+  c->pc = 0x0C00;
+  i8080_aot_op_0x46(c, 0x0000); // mov b,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0C00:
+  i8080_aot_op_0x21(c, 0x0BF7); // lxi h,$0BF7
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0C04;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0C04:
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  i8080_aot_op_0x07(c, 0x0000); // rlc
+  n += 1;
+  c->cyc += 16;
+  c->pc = 0x0C07;
+  i8080_aot_op_0x77(c, 0x0000); // mov M,a
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x0C07) < 5) {
+    goto dispatch;
+  }
+i_0x0C07:
+  i8080_aot_op_0xFE(c, 0x0001); // cpi $01
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0C0C;
+  i8080_aot_op_0xC2(c, 0x0C13); // jnz $0C13
+  n += 1;
+  if (c->pc == 0x0C13) {
+    JUMP(0x0C13);
+  }
+  JUMP(0x0C0C);
+
+b_0x0C0C:
+  if (!(i8080_aot_code(c, 0x0C0C, "\x2A\xF8\x0B\x23\x22\xF8\x0B", 7))) {
+    goto fallback;
+  }
+  c->cyc += 16;
+  c->pc = 0x0C0F;
+  i8080_aot_op_0x2A(c, 0x0BF8); // lhld $0BF8
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0C0F:
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  c->cyc += 21;
+  c->pc = 0x0C13;
+  i8080_aot_op_0x22(c, 0x0BF8); // shld $0BF8
+  n += 1;
+  JUMP(0x0C13);
+
+b_0x0C13:
+  if (!(i8080_aot_code(c, 0x0C13, "\x78\xA1\xE1\xC1\xC8", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x78(c, 0x0000); // mov a,b
+  n += 1;
+  i8080_aot_op_0xA1(c, 0x0000); // ana c
+  n += 1;
+  c->cyc += 19;
+  c->pc = 0x0C16;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0C16:
+  c->cyc += 10;
+  c->pc = 0x0C17;
+  i8080_aot_op_0xC1(c, 0x0000); // pop b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0C17:
+  c->cyc += 5;
+  c->pc = 0x0C18;
+  i8080_aot_op_0xC8(c, 0x0000); // rz
+  n += 1;
+  if (c->pc != 0x0C18) {
+    goto dispatch;
+  }
+  JUMP(0x0C18);
+
+b_0x0C18:
+  if (!(i8080_aot_code(c, 0x0C18, "\x3E\x01\xC9", 3))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x0001); // mvi a,$01
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0C1B;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x0C1E:
+  if (!(i8080_aot_code(c, 0x0C1E, "\xC5\xE5\x2A\x1C\x0C\x46\x21\x1B\x0C\x7E\x4F\x07\x77\xFE\x01\xC2\x37\x0C", 18))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0C1F;
+  i8080_aot_op_0xC5(c, 0x0000); // push b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0C1E) < 18) {
+    goto dispatch;
+  }
+i_0x0C1F:
+  c->cyc += 11;
+  c->pc = 0x0C20;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0C1F) < 17) {
+    goto dispatch;
+  }
+i_0x0C20:
+  c->cyc += 16;
+  c->pc = 0x0C23;
+  i8080_aot_op_0x2A(c, 0x0C1C); // lhld $0C1C
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0C23:
+  c->cyc += 7;
+  c->pc = 0x0C24;
+  i8080_aot_op_0x46(c, 0x0000); // mov b,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0C24:
+  i8080_aot_op_0x21(c, 0x0C1B); // lxi h,$0C1B
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0C28;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0C28:
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  i8080_aot_op_0x07(c, 0x0000); // rlc
+  n += 1;
+  c->cyc += 16;
+  c->pc = 0x0C2B;
+  i8080_aot_op_0x77(c, 0x0000); // mov M,a
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x0C2B) < 5) {
+    goto dispatch;
+  }
+i_0x0C2B:
+  i8080_aot_op_0xFE(c, 0x0001); // cpi $01
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0C30;
+  i8080_aot_op_0xC2(c, 0x0C37); // jnz $0C37
+  n += 1;
+  if (c->pc == 0x0C37) {
+    JUMP(0x0C37);
+  }
+  JUMP(0x0C30);
+
+b_0x0C30:
+  if (!(i8080_aot_code(c, 0x0C30, "\x2A\x1C\x0C\x23\x22\x1C\x0C", 7))) {
+    goto fallback;
+  }
+  c->cyc += 16;
+  c->pc = 0x0C33;
+  i8080_aot_op_0x2A(c, 0x0C1C); // lhld $0C1C
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0C33:
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  c->cyc += 21;
+  c->pc = 0x0C37;
+  i8080_aot_op_0x22(c, 0x0C1C); // shld $0C1C
+  n += 1;
+  JUMP(0x0C37);
+
+b_0x0C37:
+  if (!(i8080_aot_code(c, 0x0C37, "\x78\xA1\xE1\xC1\xC8", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x78(c, 0x0000); // mov a,b
+  n += 1;
+  i8080_aot_op_0xA1(c, 0x0000); // ana c
+  n += 1;
+  c->cyc += 19;
+  c->pc = 0x0C3A;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0C3A:
+  c->cyc += 10;
+  c->pc = 0x0C3B;
+  i8080_aot_op_0xC1(c, 0x0000); // pop b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0C3B:
+  c->cyc += 5;
+  c->pc = 0x0C3C;
+  i8080_aot_op_0xC8(c, 0x0000); // rz
+  n += 1;
+  if (c->pc != 0x0C3C) {
+    goto dispatch;
+  }
+  JUMP(0x0C3C);
+
+b_0x0C3C:
+  if (!(i8080_aot_code(c, 0x0C3C, "\x3E\x01\xC9", 3))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x3E(c, 0x0001); // mvi a,$01
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0C3F;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x0C3F:
+  if (!(i8080_aot_code(c, 0x0C3F, "\xF5\xC5\xD5\xE5\x36\x00\x54\x5D\x13\x0B", 10))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0C40;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0C3F) < 10) {
+    goto dispatch;
+  }
+i_0x0C40:
+  c->cyc += 11;
+  c->pc = 0x0C41;
+  i8080_aot_op_0xC5(c, 0x0000); // push b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0C40) < 9) {
+    goto dispatch;
+  }
+i_0x0C41:
+  c->cyc += 11;
+  c->pc = 0x0C42;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0C41) < 8) {
+    goto dispatch;
+  }
+i_0x0C42:
+  c->cyc += 11;
+  c->pc = 0x0C43;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0C42) < 7) {
+    goto dispatch;
+  }
+i_0x0C43:
+  c->cyc += 10;
+  c->pc = 0x0C45;
+  i8080_aot_op_0x36(c, 0x0000); // mvi M,$00
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x0C45) < 4) {
+    goto dispatch;
+  }
+i_0x0C45:
+  i8080_aot_op_0x54(c, 0x0000); // mov d,h
+  n += 1;
+  i8080_aot_op_0x5D(c, 0x0000); // mov e,l
+  n += 1;
+  i8080_aot_op_0x13(c, 0x0000); // inx d
+  n += 1;
+  c->cyc += 20;
+  c->pc = 0x0C49;
+  i8080_aot_op_0x0B(c, 0x0000); // dcx b
+  n += 1;
+  JUMP(0x0C49);
+
+b_0x0C49:
+  if (!(i8080_aot_code(c, 0x0C49, "\x7E\x12\x23\x13\x0B\x78\xB1\xC2\x49\x0C", 10))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x0C4A;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0C4A:
+  c->cyc += 7;
+  c->pc = 0x0C4B;
+  i8080_aot_op_0x12(c, 0x0000); // stax d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_de(c) - 0x0C4B) < 8) {
+    goto dispatch;
+  }
+i_0x0C4B:
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  i8080_aot_op_0x13(c, 0x0000); // inx d
+  n += 1;
+  i8080_aot_op_0x0B(c, 0x0000); // dcx b
+  n += 1;
+  i8080_aot_op_0x78(c, 0x0000); // mov a,b
+  n += 1;
+  i8080_aot_op_0xB1(c, 0x0000); // ora c
+  n += 1;
+  c->cyc += 34;
+  c->pc = 0x0C53;
+  i8080_aot_op_0xC2(c, 0x0C49); // jnz $0C49
+  n += 1;
+  if (c->pc == 0x0C49) {
+    JUMP(0x0C49);
+  }
+  JUMP(0x0C53);
+
+b_0x0C53:
+  if (!(i8080_aot_code(c, 0x0C53, "\xE1\xD1\xC1\xF1\xC9", 5))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0C54;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0C54:
+  c->cyc += 10;
+  c->pc = 0x0C55;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0C55:
+  c->cyc += 10;
+  c->pc = 0x0C56;
+  i8080_aot_op_0xC1(c, 0x0000); // pop b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0C56:
+  c->cyc += 10;
+  c->pc = 0x0C57;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0C57:
+  c->cyc += 10;
+  c->pc = 0x0C58;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x0C58:
+  if (!(i8080_aot_code(c, 0x0C58, "\xD5\xEB\x01\x28\x00\xCD\x3F\x0C", 8))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0C59;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0C58) < 8) {
+    goto dispatch;
+  }
+i_0x0C59:
+  i8080_aot_op_0xEB(c, 0x0000); // xchg
+  n += 1;
+  i8080_aot_op_0x01(c, 0x0028); // lxi b,$0028
+  n += 1;
+  c->cyc += 31;
+  c->pc = 0x0C60;
+  i8080_aot_op_0xCD(c, 0x0C3F); // call $0C3F
+  n += 1;
+  JUMP(0x0C3F);
+
+b_0x0C60:
+  if (!(i8080_aot_code(c, 0x0C60, "\xEB\x06\x14\x0E\x01\x16\x00", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xEB(c, 0x0000); // xchg
+  n += 1;
+  i8080_aot_op_0x06(c, 0x0014); // mvi b,$14
+  n += 1;
+  i8080_aot_op_0x0E(c, 0x0001); // mvi c,$01
+  n += 1;
+  c->cyc += 25;
+  c->pc = 0x0C67;
+  i8080_aot_op_0x16(c, 0x0000); // mvi d,$00
+  n += 1;
+  JUMP(0x0C67);
+
+b_0x0C67:
+  if (!(i8080_aot_code(c, 0x0C67, "\x5E", 1))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x0C68;
+  i8080_aot_op_0x5E(c, 0x0000); // mov e,M
+  n += 1;
+  JUMP(0x0C68);
+
+b_0x0C68:
+  if (!(i8080_aot_code(c, 0x0C68, "\x7B\xA1\xCA\x6E\x0C", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x7B(c, 0x0000); // mov a,e
+  n += 1;
+  i8080_aot_op_0xA1(c, 0x0000); // ana c
+  n += 1;
+  c->cyc += 19;
+  c->pc = 0x0C6D;
+  i8080_aot_op_0xCA(c, 0x0C6E); // jz $0C6E
+  n += 1;
+  if (c->pc == 0x0C6E) {
+    JUMP(0x0C6E);
+  }
+  JUMP(0x0C6D);
+
+b_0x0C6D:
+  if (!(i8080_aot_code(c, 0x0C6D, "\x14", 1))) {
+    goto fallback;
+  }
+  c->cyc += 5;
+  c->pc = 0x0C6E;
+  i8080_aot_op_0x14(c, 0x0000); // inr d
+  n += 1;
+  JUMP(0x0C6E);
+
+b_0x0C6E:
+  if (!(i8080_aot_code(c, 0x0C6E, "\x79\x07\x4F\xFE\x01\xC2\x68\x0C", 8))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x79(c, 0x0000); // mov a,c
+  n += 1;
+  i8080_aot_op_0x07(c, 0x0000); // rlc
+  n += 1;
+  i8080_aot_op_0x4F(c, 0x0000); // mov c,a
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x0001); // cpi $01
+  n += 1;
+  c->cyc += 31;
+  c->pc = 0x0C76;
+  i8080_aot_op_0xC2(c, 0x0C68); // jnz $0C68
+  n += 1;
+  if (c->pc == 0x0C68) {
+    JUMP(0x0C68);
+  }
+  JUMP(0x0C76);
+
+b_0x0C76:
+  if (!(i8080_aot_code(c, 0x0C76, "\x23\x05\xC2\x67\x0C", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  i8080_aot_op_0x05(c, 0x0000); // dcr b
+  n += 1;
+  c->cyc += 20;
+  c->pc = 0x0C7B;
+  i8080_aot_op_0xC2(c, 0x0C67); // jnz $0C67
+  n += 1;
+  if (c->pc == 0x0C67) {
+    JUMP(0x0C67);
+  }
+  JUMP(0x0C7B);
+
+b_0x0C7B:
+  if (!(i8080_aot_code(c, 0x0C7B, "\x7A\xE6\xF8\x0F\x0F\x0F\x6F\x26\x00\x7A\xE6\x07\x3C\x47\x3E\x80", 16))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x7A(c, 0x0000); // mov a,d
+  n += 1;
+  i8080_aot_op_0xE6(c, 0x00F8); // ani $F8
+  n += 1;
+  i8080_aot_op_0x0F(c, 0x0000); // rrc
+  n += 1;
+  i8080_aot_op_0x0F(c, 0x0000); // rrc
+  n += 1;
+  i8080_aot_op_0x0F(c, 0x0000); // rrc
+  n += 1;
+  i8080_aot_op_0x6F(c, 0x0000); // mov l,a
+  n += 1;
+  i8080_aot_op_0x26(c, 0x0000); // mvi h,$00
+  n += 1;
+  i8080_aot_op_0x7A(c, 0x0000); // mov a,d
+  n += 1;
+  i8080_aot_op_0xE6(c, 0x0007); // ani $07
+  n += 1;
+  i8080_aot_op_0x3C(c, 0x0000); // inr a
+  n += 1;
+  i8080_aot_op_0x47(c, 0x0000); // mov b,a
+  n += 1;
+  c->cyc += 65;
+  c->pc = 0x0C8B;
+  i8080_aot_op_0x3E(c, 0x0080); // mvi a,$80
+  n += 1;
+  JUMP(0x0C8B);
+
+b_0x0C8B:
+  if (!(i8080_aot_code(c, 0x0C8B, "\x07\x05\xC2\x8B\x0C", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x07(c, 0x0000); // rlc
+  n += 1;
+  i8080_aot_op_0x05(c, 0x0000); // dcr b
+  n += 1;
+  c->cyc += 19;
+  c->pc = 0x0C90;
+  i8080_aot_op_0xC2(c, 0x0C8B); // jnz $0C8B
+  n += 1;
+  if (c->pc == 0x0C8B) {
+    JUMP(0x0C8B);
+  }
+  JUMP(0x0C90);
+
+b_0x0C90:
+  if (!(i8080_aot_code(c, 0x0C90, "\xD1\x19\x11\x14\x00\x19\x77\xC9", 8))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0C91;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0C91:
+  i8080_aot_op_0x19(c, 0x0000); // dad d
+  n += 1;
+  i8080_aot_op_0x11(c, 0x0014); // lxi d,$0014
+  n += 1;
+  i8080_aot_op_0x19(c, 0x0000); // dad d
+  n += 1;
+  c->cyc += 37;
+  c->pc = 0x0C97;
+  i8080_aot_op_0x77(c, 0x0000); // mov M,a
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x0C97) < 1) {
+    goto dispatch;
+  }
+i_0x0C97:
+  c->cyc += 10;
+  c->pc = 0x0C98;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x0C98:
+  if (!(i8080_aot_code(c, 0x0C98, "\xC5\xD5\xE5\x21\xE9\x0C\x11\x14\x00\xEB\x19\xEB", 12))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0C99;
+  i8080_aot_op_0xC5(c, 0x0000); // push b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0C98) < 12) {
+    goto dispatch;
+  }
+i_0x0C99:
+  c->cyc += 11;
+  c->pc = 0x0C9A;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0C99) < 11) {
+    goto dispatch;
+  }
+i_0x0C9A:
+  c->cyc += 11;
+  c->pc = 0x0C9B;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0C9A) < 10) {
+    goto dispatch;
+  }
+i_0x0C9B:
+  i8080_aot_op_0x21(c, 0x0CE9); // lxi h,$0CE9
+  n += 1;
+  i8080_aot_op_0x11(c, 0x0014); // lxi d,$0014
+  n += 1;
+  i8080_aot_op_0xEB(c, 0x0000); // xchg
+  n += 1;
+  i8080_aot_op_0x19(c, 0x0000); // dad d
+  n += 1;
+  c->cyc += 38;
+  c->pc = 0x0CA4;
+  i8080_aot_op_0xEB(c, 0x0000); // xchg
+  n += 1;
+  JUMP(0x0CA4);
+
+b_0x0CA4:
+  if (!(i8080_aot_code(c, 0x0CA4, "\x34\x7E\xFE\x00\xCA\xB7\x0C", 7))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0CA5;
+  i8080_aot_op_0x34(c, 0x0000); // inr M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x0CA5) < 6) {
+    goto dispatch;
+  }
+i_0x0CA5:
+  c->cyc += 7;
+  c->pc = 0x0CA6;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0CA6:
+  i8080_aot_op_0xFE(c, 0x0000); // cpi $00
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0CAB;
+  i8080_aot_op_0xCA(c, 0x0CB7); // jz $0CB7
+  n += 1;
+  if (c->pc == 0x0CB7) {
+    JUMP(0x0CB7);
+  }
+  JUMP(0x0CAB);
+
+b_0x0CAB:
+  if (!(i8080_aot_code(c, 0x0CAB, "\x47\x1A\xA0\xCA\xB3\x0C", 6))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x47(c, 0x0000); // mov b,a
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x0CAD;
+  i8080_aot_op_0x1A(c, 0x0000); // ldax d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0CAD:
+  i8080_aot_op_0xA0(c, 0x0000); // ana b
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x0CB1;
+  i8080_aot_op_0xCA(c, 0x0CB3); // jz $0CB3
+  n += 1;
+  if (c->pc == 0x0CB3) {
+    JUMP(0x0CB3);
+  }
+  JUMP(0x0CB1);
+
+b_0x0CB1:
+  if (!(i8080_aot_code(c, 0x0CB1, "\x36\x00", 2))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0CB3;
+  i8080_aot_op_0x36(c, 0x0000); // mvi M,$00
+  n += 1;
+  JUMP(0x0CB3);
+
+b_0x0CB3:
+  if (!(i8080_aot_code(c, 0x0CB3, "\xC1\xD1\xE1\xC9", 4))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0CB4;
+  i8080_aot_op_0xC1(c, 0x0000); // pop b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0CB4:
+  c->cyc += 10;
+  c->pc = 0x0CB5;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0CB5:
+  c->cyc += 10;
+  c->pc = 0x0CB6;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0CB6:
+  c->cyc += 10;
+  c->pc = 0x0CB7;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x0CB7:
+  if (!(i8080_aot_code(c, 0x0CB7, "\x23\x13\xC3\xA4\x0C", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  i8080_aot_op_0x13(c, 0x0000); // inx d
+  n += 1;
+  c->cyc += 20;
+  c->pc = 0x0CBC;
+  i8080_aot_op_0xC3(c, 0x0CA4); // jmp $0CA4
+  n += 1;
+  JUMP(0x0CA4);
+
+b_0x0CBC:
+  if (!(i8080_aot_code(c, 0x0CBC, "\xC5\xD5\xE5\x21\x11\x0D\x11\x14\x00\xEB\x19\xEB", 12))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0CBD;
+  i8080_aot_op_0xC5(c, 0x0000); // push b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0CBC) < 12) {
+    goto dispatch;
+  }
+i_0x0CBD:
+  c->cyc += 11;
+  c->pc = 0x0CBE;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0CBD) < 11) {
+    goto dispatch;
+  }
+i_0x0CBE:
+  c->cyc += 11;
+  c->pc = 0x0CBF;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0CBE) < 10) {
+    goto dispatch;
+  }
+i_0x0CBF:
+  i8080_aot_op_0x21(c, 0x0D11); // lxi h,$0D11
+  n += 1;
+  i8080_aot_op_0x11(c, 0x0014); // lxi d,$0014
+  n += 1;
+  i8080_aot_op_0xEB(c, 0x0000); // xchg
+  n += 1;
+  i8080_aot_op_0x19(c, 0x0000); // dad d
+  n += 1;
+  c->cyc += 38;
+  c->pc = 0x0CC8;
+  i8080_aot_op_0xEB(c, 0x0000); // xchg
+  n += 1;
+  JUMP(0x0CC8);
+
+b_0x0CC8:
+  if (!(i8080_aot_code(c, 0x0CC8, "\x7E\xB7\xCA\xE4\x0C", 5))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x0CC9;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0CC9:
+  i8080_aot_op_0xB7(c, 0x0000); // ora a
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x0CCD;
+  i8080_aot_op_0xCA(c, 0x0CE4); // jz $0CE4
+  n += 1;
+  if (c->pc == 0x0CE4) {
+    JUMP(0x0CE4);
+  }
+  JUMP(0x0CCD);
+
+b_0x0CCD:
+  if (!(i8080_aot_code(c, 0x0CCD, "\x47\x1A\xA0\xC2\xE0\x0C", 6))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x47(c, 0x0000); // mov b,a
+  n += 1;
+  c->cyc += 12;
+  c->pc = 0x0CCF;
+  i8080_aot_op_0x1A(c, 0x0000); // ldax d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0CCF:
+  i8080_aot_op_0xA0(c, 0x0000); // ana b
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x0CD3;
+  i8080_aot_op_0xC2(c, 0x0CE0); // jnz $0CE0
+  n += 1;
+  if (c->pc == 0x0CE0) {
+    JUMP(0x0CE0);
+  }
+  JUMP(0x0CD3);
+
+b_0x0CD3:
+  if (!(i8080_aot_code(c, 0x0CD3, "\x78\x07\xFE\x01\xC2\xDE\x0C", 7))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x78(c, 0x0000); // mov a,b
+  n += 1;
+  i8080_aot_op_0x07(c, 0x0000); // rlc
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x0001); // cpi $01
+  n += 1;
+  c->cyc += 26;
+  c->pc = 0x0CDA;
+  i8080_aot_op_0xC2(c, 0x0CDE); // jnz $0CDE
+  n += 1;
+  if (c->pc == 0x0CDE) {
+    JUMP(0x0CDE);
+  }
+  JUMP(0x0CDA);
+
+b_0x0CDA:
+  if (!(i8080_aot_code(c, 0x0CDA, "\x36\x00\x23\x13", 4))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0CDC;
+  i8080_aot_op_0x36(c, 0x0000); // mvi M,$00
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x0CDC) < 2) {
+    goto dispatch;
+  }
+i_0x0CDC:
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  c->cyc += 10;
+  c->pc = 0x0CDE;
+  i8080_aot_op_0x13(c, 0x0000); // inx d
+  n += 1;
+  JUMP(0x0CDE);
+
+b_0x0CDE:
+  if (!(i8080_aot_code(c, 0x0CDE, "\x77\xAF", 2))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x0CDF;
+  i8080_aot_op_0x77(c, 0x0000); // mov M,a
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x0CDF) < 1) {
+    goto dispatch;
+  }
+i_0x0CDF:
+  c->cyc += 4;
+  c->pc = 0x0CE0;
+  i8080_aot_op_0xAF(c, 0x0000); // xra a
+  n += 1;
+  JUMP(0x0CE0);
+
+b_0x0CE0:
+  if (!(i8080_aot_code(c, 0x0CE0, "\xE1\xD1\xC1\xC9", 4))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0CE1;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0CE1:
+  c->cyc += 10;
+  c->pc = 0x0CE2;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0CE2:
+  c->cyc += 10;
+  c->pc = 0x0CE3;
+  i8080_aot_op_0xC1(c, 0x0000); // pop b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0CE3:
+  c->cyc += 10;
+  c->pc = 0x0CE4;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x0CE4:
+  if (!(i8080_aot_code(c, 0x0CE4, "\x23\x13\xC3\xC8\x0C", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  i8080_aot_op_0x13(c, 0x0000); // inx d
+  n += 1;
+  c->cyc += 20;
+  c->pc = 0x0CE9;
+  i8080_aot_op_0xC3(c, 0x0CC8); // jmp $0CC8
+  n += 1;
+  JUMP(0x0CC8);
+
+b_0x0D39:
+  if (!(i8080_aot_code(c, 0x0D39, "\xF5\xC5\xD5\xE5\xF3", 5))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0D3A;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0D39) < 5) {
+    goto dispatch;
+  }
+i_0x0D3A:
+  c->cyc += 11;
+  c->pc = 0x0D3B;
+  i8080_aot_op_0xC5(c, 0x0000); // push b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0D3A) < 4) {
+    goto dispatch;
+  }
+i_0x0D3B:
+  c->cyc += 11;
+  c->pc = 0x0D3C;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0D3B) < 3) {
+    goto dispatch;
+  }
+i_0x0D3C:
+  c->cyc += 11;
+  c->pc = 0x0D3D;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0D3C) < 2) {
+    goto dispatch;
+  }
+i_0x0D3D:
+  c->cyc += 4;
+  c->pc = 0x0D3E;
+  i8080_aot_op_0xF3(c, 0x0000); // di
+  n += 1;
+  JUMP(0x0D3E);
+
+b_0x0D3E:
+  if (!(i8080_aot_code(c, 0x0D3E, "\x21\x00\x00\x39\x22\xB4\x0D\x31\x05\x01\xE1\xE1\xE1\xD1\xC1\xF1\x22\xA2\x0D\x2A\x11\x01\xF9\x2A\xA2\x0D\x00\x00", 28))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x21(c, 0x0000); // lxi h,$0000
+  n += 1;
+  i8080_aot_op_0x39(c, 0x0000); // dad sp
+  n += 1;
+  c->cyc += 36;
+  c->pc = 0x0D45;
+  i8080_aot_op_0x22(c, 0x0DB4); // shld $0DB4
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0D45:
+  i8080_aot_op_0x31(c, 0x0105); // lxi sp,$0105
+  n += 1;
+  c->cyc += 20;
+  c->pc = 0x0D49;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0D49:
+  c->cyc += 10;
+  c->pc = 0x0D4A;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0D4A:
+  c->cyc += 10;
+  c->pc = 0x0D4B;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0D4B:
+  c->cyc += 10;
+  c->pc = 0x0D4C;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0D4C:
+  c->cyc += 10;
+  c->pc = 0x0D4D;
+  i8080_aot_op_0xC1(c, 0x0000); // pop b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0D4D:
+  c->cyc += 10;
+  c->pc = 0x0D4E;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0D4E:
+  c->cyc += 16;
+  c->pc = 0x0D51;
+  i8080_aot_op_0x22(c, 0x0DA2); // shld $0DA2
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0D51:
+  c->cyc += 16;
+  c->pc = 0x0D54;
+  i8080_aot_op_0x2A(c, 0x0111); // lhld $0111
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0D54:
+  i8080_aot_op_0xF9(c, 0x0000); // sphl
+  n += 1;
+  c->cyc += 21;
+  c->pc = 0x0D58;
+  i8080_aot_op_0x2A(c, 0x0DA2); // lhld $0DA2
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0D58:
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 8;
+  c->pc = 0x0D5A;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  JUMP(0x0D5A);
+
+b_0x0D5A:
+  if (!(i8080_aot_code(c, 0x0D5A, "\x00\x00\x22\xA2\x0D\x21\x00\x00\xDA\x69\x0D", 11))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  i8080_aot_op_0x00(c, 0x0000); // nop
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x0D5F;
+  i8080_aot_op_0x22(c, 0x0DA2); // shld $0DA2
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0D5F:
+  i8080_aot_op_0x21(c, 0x0000); // lxi h,$0000
+  n += 1;
+  c->cyc += 20;
+  c->pc = 0x0D65;
+  i8080_aot_op_0xDA(c, 0x0D69); // jc $0D69
+  n += 1;
+  if (c->pc == 0x0D69) {
+    JUMP(0x0D69);
+  }
+  JUMP(0x0D65);
+
+b_0x0D65:
+  if (!(i8080_aot_code(c, 0x0D65, "\x39\xC3\x6B\x0D", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x39(c, 0x0000); // dad sp
+  n += 1;
+  c->cyc += 20;
+  c->pc = 0x0D69;
+  i8080_aot_op_0xC3(c, 0x0D6B); // jmp $0D6B
+  n += 1;
+  JUMP(0x0D6B);
+
+b_0x0D69:
+  if (!(i8080_aot_code(c, 0x0D69, "\x39\x37", 2))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x39(c, 0x0000); // dad sp
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x0D6B;
+  i8080_aot_op_0x37(c, 0x0000); // stc
+  n += 1;
+  JUMP(0x0D6B);
+
+b_0x0D6B:
+  if (!(i8080_aot_code(c, 0x0D6B, "\x22\xB2\x0D\x2A\xA2\x0D\x31\xB2\x0D\xF5\xC5\xD5\xE5\xE5\xE5\x2A\xB4\x0D\xF9\xFB", 20))) {
+    goto fallback;
+  }
+  c->cyc += 16;
+  c->pc = 0x0D6E;
+  i8080_aot_op_0x22(c, 0x0DB2); // shld $0DB2
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0D6E:
+  c->cyc += 16;
+  c->pc = 0x0D71;
+  i8080_aot_op_0x2A(c, 0x0DA2); // lhld $0DA2
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0D71:
+  i8080_aot_op_0x31(c, 0x0DB2); // lxi sp,$0DB2
+  n += 1;
+  c->cyc += 21;
+  c->pc = 0x0D75;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0D74) < 11) {
+    goto dispatch;
+  }
+i_0x0D75:
+  c->cyc += 11;
+  c->pc = 0x0D76;
+  i8080_aot_op_0xC5(c, 0x0000); // push b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0D75) < 10) {
+    goto dispatch;
+  }
+i_0x0D76:
+  c->cyc += 11;
+  c->pc = 0x0D77;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0D76) < 9) {
+    goto dispatch;
+  }
+i_0x0D77:
+  c->cyc += 11;
+  c->pc = 0x0D78;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0D77) < 8) {
+    goto dispatch;
+  }
+i_0x0D78:
+  c->cyc += 11;
+  c->pc = 0x0D79;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0D78) < 7) {
+    goto dispatch;
+  }
+i_0x0D79:
+  c->cyc += 11;
+  c->pc = 0x0D7A;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0D79) < 6) {
+    goto dispatch;
+  }
+i_0x0D7A:
+  c->cyc += 16;
+  c->pc = 0x0D7D;
+  i8080_aot_op_0x2A(c, 0x0DB4); // lhld $0DB4
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0D7D:
+  i8080_aot_op_0xF9(c, 0x0000); // sphl
+  n += 1;
+  c->cyc += 9;
+  c->pc = 0x0D7F;
+  i8080_aot_op_0xFB(c, 0x0000); // ei
+  n += 1;
+  JUMP(0x0D7F);
+
+b_0x0D7F:
+  if (!(i8080_aot_code(c, 0x0D7F, "\x2A\x03\x01\x22\xA4\x0D\x21\xB0\x0D\x7E\xE6\xFF\x77\x06\x10\x11\xA4\x0D\x21\xB6\x0E", 21))) {
+    goto fallback;
+  }
+  c->cyc += 16;
+  c->pc = 0x0D82;
+  i8080_aot_op_0x2A(c, 0x0103); // lhld $0103
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0D82:
+  c->cyc += 16;
+  c->pc = 0x0D85;
+  i8080_aot_op_0x22(c, 0x0DA4); // shld $0DA4
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0D85:
+  i8080_aot_op_0x21(c, 0x0DB0); // lxi h,$0DB0
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0D89;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0D89:
+  i8080_aot_op_0xE6(c, 0x00FF); // ani $FF
+  n += 1;
+  c->cyc += 14;
+  c->pc = 0x0D8C;
+  i8080_aot_op_0x77(c, 0x0000); // mov M,a
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x0D8C) < 8) {
+    goto dispatch;
+  }
+i_0x0D8C:
+  i8080_aot_op_0x06(c, 0x0010); // mvi b,$10
+  n += 1;
+  i8080_aot_op_0x11(c, 0x0DA4); // lxi d,$0DA4
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x0D94;
+  i8080_aot_op_0x21(c, 0x0EB6); // lxi h,$0EB6
+  n += 1;
+  JUMP(0x0D94);
+
+b_0x0D94:
+  if (!(i8080_aot_code(c, 0x0D94, "\x1A\x13\xCD\x7A\x0E", 5))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x0D95;
+  i8080_aot_op_0x1A(c, 0x0000); // ldax d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0D95:
+  i8080_aot_op_0x13(c, 0x0000); // inx d
+  n += 1;
+  c->cyc += 22;
+  c->pc = 0x0D99;
+  i8080_aot_op_0xCD(c, 0x0E7A); // call $0E7A
+  n += 1;
+  JUMP(0x0E7A);
+
+b_0x0D99:
+  if (!(i8080_aot_code(c, 0x0D99, "\x05\xC2\x94\x0D", 4))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x05(c, 0x0000); // dcr b
+  n += 1;
+  c->cyc += 15;
+  c->pc = 0x0D9D;
+  i8080_aot_op_0xC2(c, 0x0D94); // jnz $0D94
+  n += 1;
+  if (c->pc == 0x0D94) {
+    JUMP(0x0D94);
+  }
+  JUMP(0x0D9D);
+
+b_0x0D9D:
+  if (!(i8080_aot_code(c, 0x0D9D, "\xE1\xD1\xC1\xF1\xC9", 5))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0D9E;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0D9E:
+  c->cyc += 10;
+  c->pc = 0x0D9F;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0D9F:
+  c->cyc += 10;
+  c->pc = 0x0DA0;
+  i8080_aot_op_0xC1(c, 0x0000); // pop b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0DA0:
+  c->cyc += 10;
+  c->pc = 0x0DA1;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0DA1:
+  c->cyc += 10;
+  c->pc = 0x0DA2;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x0DC0:
+  if (!(i8080_aot_code(c, 0x0DC0, "\xF5\xC5\xE5\x06\x04", 5))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0DC1;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0DC0) < 5) {
+    goto dispatch;
+  }
+i_0x0DC1:
+  c->cyc += 11;
+  c->pc = 0x0DC2;
+  i8080_aot_op_0xC5(c, 0x0000); // push b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0DC1) < 4) {
+    goto dispatch;
+  }
+i_0x0DC2:
+  c->cyc += 11;
+  c->pc = 0x0DC3;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0DC2) < 3) {
+    goto dispatch;
+  }
+i_0x0DC3:
+  c->cyc += 7;
+  c->pc = 0x0DC5;
+  i8080_aot_op_0x06(c, 0x0004); // mvi b,$04
+  n += 1;
+  JUMP(0x0DC5);
+
+b_0x0DC5:
+  if (!(i8080_aot_code(c, 0x0DC5, "\x7E\xCD\xD2\x0D", 4))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x0DC6;
+  i8080_aot_op_0x7E(c, 0x0000); // mov a,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0DC6:
+  c->cyc += 17;
+  c->pc = 0x0DC9;
+  i8080_aot_op_0xCD(c, 0x0DD2); // call $0DD2
+  n += 1;
+  JUMP(0x0DD2);
+
+b_0x0DC9:
+  if (!(i8080_aot_code(c, 0x0DC9, "\x23\x05\xC2\xC5\x0D", 5))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  i8080_aot_op_0x05(c, 0x0000); // dcr b
+  n += 1;
+  c->cyc += 20;
+  c->pc = 0x0DCE;
+  i8080_aot_op_0xC2(c, 0x0DC5); // jnz $0DC5
+  n += 1;
+  if (c->pc == 0x0DC5) {
+    JUMP(0x0DC5);
+  }
+  JUMP(0x0DCE);
+
+b_0x0DCE:
+  if (!(i8080_aot_code(c, 0x0DCE, "\xE1\xC1\xF1\xC9", 4))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0DCF;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0DCF:
+  c->cyc += 10;
+  c->pc = 0x0DD0;
+  i8080_aot_op_0xC1(c, 0x0000); // pop b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0DD0:
+  c->cyc += 10;
+  c->pc = 0x0DD1;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0DD1:
+  c->cyc += 10;
+  c->pc = 0x0DD2;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x0DD2:
+  if (!(i8080_aot_code(c, 0x0DD2, "\xF5\x0F\x0F\x0F\x0F\xCD\xDB\x0D", 8))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0DD3;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0DD2) < 8) {
+    goto dispatch;
+  }
+i_0x0DD3:
+  i8080_aot_op_0x0F(c, 0x0000); // rrc
+  n += 1;
+  i8080_aot_op_0x0F(c, 0x0000); // rrc
+  n += 1;
+  i8080_aot_op_0x0F(c, 0x0000); // rrc
+  n += 1;
+  i8080_aot_op_0x0F(c, 0x0000); // rrc
+  n += 1;
+  c->cyc += 33;
+  c->pc = 0x0DDA;
+  i8080_aot_op_0xCD(c, 0x0DDB); // call $0DDB
+  n += 1;
+  JUMP(0x0DDB);
+
+b_0x0DDA:
+  if (!(i8080_aot_code(c, 0x0DDA, "\xF1", 1))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0DDB;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  JUMP(0x0DDB);
+
+b_0x0DDB:
+  if (!(i8080_aot_code(c, 0x0DDB, "\xF5\xC5\xD5\xE5\xE6\x0F\xFE\x0A\xDA\xE8\x0D", 11))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0DDC;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0DDB) < 11) {
+    goto dispatch;
+  }
+i_0x0DDC:
+  c->cyc += 11;
+  c->pc = 0x0DDD;
+  i8080_aot_op_0xC5(c, 0x0000); // push b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0DDC) < 10) {
+    goto dispatch;
+  }
+i_0x0DDD:
+  c->cyc += 11;
+  c->pc = 0x0DDE;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0DDD) < 9) {
+    goto dispatch;
+  }
+i_0x0DDE:
+  c->cyc += 11;
+  c->pc = 0x0DDF;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0DDE) < 8) {
+    goto dispatch;
+  }
+i_0x0DDF:
+  i8080_aot_op_0xE6(c, 0x000F); // ani $0F
+  n += 1;
+  i8080_aot_op_0xFE(c, 0x000A); // cpi $0A
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x0DE6;
+  i8080_aot_op_0xDA(c, 0x0DE8); // jc $0DE8
+  n += 1;
+  if (c->pc == 0x0DE8) {
+    JUMP(0x0DE8);
+  }
+  JUMP(0x0DE6);
+
+b_0x0DE6:
+  if (!(i8080_aot_code(c, 0x0DE6, "\xC6\x27", 2))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x0DE8;
+  i8080_aot_op_0xC6(c, 0x0027); // adi $27
+  n += 1;
+  JUMP(0x0DE8);
+
+b_0x0DE8:
+  if (!(i8080_aot_code(c, 0x0DE8, "\xC6\x30\x5F\x0E\x02\xCD\xF5\x0D", 8))) {
+    goto fallback;
+  }
+  i8080_aot_op_0xC6(c, 0x0030); // adi $30
+  n += 1;
+  i8080_aot_op_0x5F(c, 0x0000); // mov e,a
+  n += 1;
+  i8080_aot_op_0x0E(c, 0x0002); // mvi c,$02
+  n += 1;
+  c->cyc += 36;
+  c->pc = 0x0DF0;
+  i8080_aot_op_0xCD(c, 0x0DF5); // call $0DF5
+  n += 1;
+  JUMP(0x0DF5);
+
+b_0x0DF0:
+  if (!(i8080_aot_code(c, 0x0DF0, "\xE1\xD1\xC1\xF1\xC9", 5))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0DF1;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0DF1:
+  c->cyc += 10;
+  c->pc = 0x0DF2;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0DF2:
+  c->cyc += 10;
+  c->pc = 0x0DF3;
+  i8080_aot_op_0xC1(c, 0x0000); // pop b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0DF3:
+  c->cyc += 10;
+  c->pc = 0x0DF4;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0DF4:
+  c->cyc += 10;
+  c->pc = 0x0DF5;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x0DF5:
+  if (!(i8080_aot_code(c, 0x0DF5, "\xF5\xC5\xD5\xE5\xCD\x05\x00", 7))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0DF6;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0DF5) < 7) {
+    goto dispatch;
+  }
+i_0x0DF6:
+  c->cyc += 11;
+  c->pc = 0x0DF7;
+  i8080_aot_op_0xC5(c, 0x0000); // push b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0DF6) < 6) {
+    goto dispatch;
+  }
+i_0x0DF7:
+  c->cyc += 11;
+  c->pc = 0x0DF8;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0DF7) < 5) {
+    goto dispatch;
+  }
+i_0x0DF8:
+  c->cyc += 11;
+  c->pc = 0x0DF9;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0DF8) < 4) {
+    goto dispatch;
+  }
+i_0x0DF9:
+  c->cyc += 17;
+  c->pc = 0x0DFC;
+  i8080_aot_op_0xCD(c, 0x0005); // call $0005
+  n += 1;
+  goto dispatch;
+
+b_0x0DFC:
+  if (!(i8080_aot_code(c, 0x0DFC, "\xE1\xD1\xC1\xF1", 4) &&
+      i8080_aot_code(c, 0x0E00, "\xC9", 1))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0DFD;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0DFD:
+  c->cyc += 10;
+  c->pc = 0x0DFE;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0DFE:
+  c->cyc += 10;
+  c->pc = 0x0DFF;
+  i8080_aot_op_0xC1(c, 0x0000); // pop b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0DFF:
+  c->cyc += 10;
+  c->pc = 0x0E00;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0E00:
+  c->cyc += 10;
+  c->pc = 0x0E01;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x0E63:
+  if (!(i8080_aot_code(c, 0x0E63, "\xC5\xD5\xE5\x11\xB6\x0E\x06\x04", 8))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0E64;
+  i8080_aot_op_0xC5(c, 0x0000); // push b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0E63) < 8) {
+    goto dispatch;
+  }
+i_0x0E64:
+  c->cyc += 11;
+  c->pc = 0x0E65;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0E64) < 7) {
+    goto dispatch;
+  }
+i_0x0E65:
+  c->cyc += 11;
+  c->pc = 0x0E66;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0E65) < 6) {
+    goto dispatch;
+  }
+i_0x0E66:
+  i8080_aot_op_0x11(c, 0x0EB6); // lxi d,$0EB6
+  n += 1;
+  c->cyc += 17;
+  c->pc = 0x0E6B;
+  i8080_aot_op_0x06(c, 0x0004); // mvi b,$04
+  n += 1;
+  JUMP(0x0E6B);
+
+b_0x0E6B:
+  if (!(i8080_aot_code(c, 0x0E6B, "\x1A\xBE\xC2\x76\x0E", 5))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x0E6C;
+  i8080_aot_op_0x1A(c, 0x0000); // ldax d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0E6C:
+  c->cyc += 7;
+  c->pc = 0x0E6D;
+  i8080_aot_op_0xBE(c, 0x0000); // cmp M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0E6D:
+  c->cyc += 10;
+  c->pc = 0x0E70;
+  i8080_aot_op_0xC2(c, 0x0E76); // jnz $0E76
+  n += 1;
+  if (c->pc == 0x0E76) {
+    JUMP(0x0E76);
+  }
+  JUMP(0x0E70);
+
+b_0x0E70:
+  if (!(i8080_aot_code(c, 0x0E70, "\x23\x13\x05\xC2\x6B\x0E", 6))) {
+    goto fallback;
+  }
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  i8080_aot_op_0x13(c, 0x0000); // inx d
+  n += 1;
+  i8080_aot_op_0x05(c, 0x0000); // dcr b
+  n += 1;
+  c->cyc += 25;
+  c->pc = 0x0E76;
+  i8080_aot_op_0xC2(c, 0x0E6B); // jnz $0E6B
+  n += 1;
+  if (c->pc == 0x0E6B) {
+    JUMP(0x0E6B);
+  }
+  JUMP(0x0E76);
+
+b_0x0E76:
+  if (!(i8080_aot_code(c, 0x0E76, "\xE1\xD1\xC1\xC9", 4))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0E77;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0E77:
+  c->cyc += 10;
+  c->pc = 0x0E78;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0E78:
+  c->cyc += 10;
+  c->pc = 0x0E79;
+  i8080_aot_op_0xC1(c, 0x0000); // pop b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0E79:
+  c->cyc += 10;
+  c->pc = 0x0E7A;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x0E7A:
+  if (!(i8080_aot_code(c, 0x0E7A, "\xF5\xC5\xD5\xE5\xE5\x11\x03\x00\x19\xAE\x6F\x26\x00\x29\x29\xEB\x21\xBA\x0E\x19\xEB", 21))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0E7B;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0E7A) < 21) {
+    goto dispatch;
+  }
+i_0x0E7B:
+  c->cyc += 11;
+  c->pc = 0x0E7C;
+  i8080_aot_op_0xC5(c, 0x0000); // push b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0E7B) < 20) {
+    goto dispatch;
+  }
+i_0x0E7C:
+  c->cyc += 11;
+  c->pc = 0x0E7D;
+  i8080_aot_op_0xD5(c, 0x0000); // push d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0E7C) < 19) {
+    goto dispatch;
+  }
+i_0x0E7D:
+  c->cyc += 11;
+  c->pc = 0x0E7E;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0E7D) < 18) {
+    goto dispatch;
+  }
+i_0x0E7E:
+  c->cyc += 11;
+  c->pc = 0x0E7F;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0E7E) < 17) {
+    goto dispatch;
+  }
+i_0x0E7F:
+  i8080_aot_op_0x11(c, 0x0003); // lxi d,$0003
+  n += 1;
+  i8080_aot_op_0x19(c, 0x0000); // dad d
+  n += 1;
+  c->cyc += 27;
+  c->pc = 0x0E84;
+  i8080_aot_op_0xAE(c, 0x0000); // xra M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0E84:
+  i8080_aot_op_0x6F(c, 0x0000); // mov l,a
+  n += 1;
+  i8080_aot_op_0x26(c, 0x0000); // mvi h,$00
+  n += 1;
+  i8080_aot_op_0x29(c, 0x0000); // dad h
+  n += 1;
+  i8080_aot_op_0x29(c, 0x0000); // dad h
+  n += 1;
+  i8080_aot_op_0xEB(c, 0x0000); // xchg
+  n += 1;
+  i8080_aot_op_0x21(c, 0x0EBA); // lxi h,$0EBA
+  n += 1;
+  i8080_aot_op_0x19(c, 0x0000); // dad d
+  n += 1;
+  c->cyc += 60;
+  c->pc = 0x0E8F;
+  i8080_aot_op_0xEB(c, 0x0000); // xchg
+  n += 1;
+  JUMP(0x0E8F);
+
+b_0x0E8F:
+  if (!(i8080_aot_code(c, 0x0E8F, "\xE1\x01\x04\x00", 4))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0E90;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0E90:
+  c->cyc += 10;
+  c->pc = 0x0E93;
+  i8080_aot_op_0x01(c, 0x0004); // lxi b,$0004
+  n += 1;
+  JUMP(0x0E93);
+
+b_0x0E93:
+  if (!(i8080_aot_code(c, 0x0E93, "\x1A\xA8\x46\x77\x13\x23\x0D\xC2\x93\x0E", 10))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x0E94;
+  i8080_aot_op_0x1A(c, 0x0000); // ldax d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0E94:
+  i8080_aot_op_0xA8(c, 0x0000); // xra b
+  n += 1;
+  c->cyc += 11;
+  c->pc = 0x0E96;
+  i8080_aot_op_0x46(c, 0x0000); // mov b,M
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0E96:
+  c->cyc += 7;
+  c->pc = 0x0E97;
+  i8080_aot_op_0x77(c, 0x0000); // mov M,a
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x0E97) < 6) {
+    goto dispatch;
+  }
+i_0x0E97:
+  i8080_aot_op_0x13(c, 0x0000); // inx d
+  n += 1;
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  i8080_aot_op_0x0D(c, 0x0000); // dcr c
+  n += 1;
+  c->cyc += 25;
+  c->pc = 0x0E9D;
+  i8080_aot_op_0xC2(c, 0x0E93); // jnz $0E93
+  n += 1;
+  if (c->pc == 0x0E93) {
+    JUMP(0x0E93);
+  }
+  JUMP(0x0E9D);
+
+b_0x0E9D:
+  if (!(i8080_aot_code(c, 0x0E9D, "\xE1\xD1\xC1\xF1\xC9", 5))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0E9E;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0E9E:
+  c->cyc += 10;
+  c->pc = 0x0E9F;
+  i8080_aot_op_0xD1(c, 0x0000); // pop d
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0E9F:
+  c->cyc += 10;
+  c->pc = 0x0EA0;
+  i8080_aot_op_0xC1(c, 0x0000); // pop b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0EA0:
+  c->cyc += 10;
+  c->pc = 0x0EA1;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0EA1:
+  c->cyc += 10;
+  c->pc = 0x0EA2;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+
+b_0x0EA2:
+  if (!(i8080_aot_code(c, 0x0EA2, "\xF5\xC5\xE5\x21\xB6\x0E\x3E\xFF\x06\x04", 10))) {
+    goto fallback;
+  }
+  c->cyc += 11;
+  c->pc = 0x0EA3;
+  i8080_aot_op_0xF5(c, 0x0000); // push psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0EA2) < 10) {
+    goto dispatch;
+  }
+i_0x0EA3:
+  c->cyc += 11;
+  c->pc = 0x0EA4;
+  i8080_aot_op_0xC5(c, 0x0000); // push b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0EA3) < 9) {
+    goto dispatch;
+  }
+i_0x0EA4:
+  c->cyc += 11;
+  c->pc = 0x0EA5;
+  i8080_aot_op_0xE5(c, 0x0000); // push h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (c->sp - 0x0EA4) < 8) {
+    goto dispatch;
+  }
+i_0x0EA5:
+  i8080_aot_op_0x21(c, 0x0EB6); // lxi h,$0EB6
+  n += 1;
+  i8080_aot_op_0x3E(c, 0x00FF); // mvi a,$FF
+  n += 1;
+  c->cyc += 24;
+  c->pc = 0x0EAC;
+  i8080_aot_op_0x06(c, 0x0004); // mvi b,$04
+  n += 1;
+  JUMP(0x0EAC);
+
+b_0x0EAC:
+  if (!(i8080_aot_code(c, 0x0EAC, "\x77\x23\x05\xC2\xAC\x0E", 6))) {
+    goto fallback;
+  }
+  c->cyc += 7;
+  c->pc = 0x0EAD;
+  i8080_aot_op_0x77(c, 0x0000); // mov M,a
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+  if ((uint16_t) (i8080_get_hl(c) - 0x0EAD) < 5) {
+    goto dispatch;
+  }
+i_0x0EAD:
+  i8080_aot_op_0x23(c, 0x0000); // inx h
+  n += 1;
+  i8080_aot_op_0x05(c, 0x0000); // dcr b
+  n += 1;
+  c->cyc += 20;
+  c->pc = 0x0EB2;
+  i8080_aot_op_0xC2(c, 0x0EAC); // jnz $0EAC
+  n += 1;
+  if (c->pc == 0x0EAC) {
+    JUMP(0x0EAC);
+  }
+  JUMP(0x0EB2);
+
+b_0x0EB2:
+  if (!(i8080_aot_code(c, 0x0EB2, "\xE1\xC1\xF1\xC9", 4))) {
+    goto fallback;
+  }
+  c->cyc += 10;
+  c->pc = 0x0EB3;
+  i8080_aot_op_0xE1(c, 0x0000); // pop h
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0EB3:
+  c->cyc += 10;
+  c->pc = 0x0EB4;
+  i8080_aot_op_0xC1(c, 0x0000); // pop b
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0EB4:
+  c->cyc += 10;
+  c->pc = 0x0EB5;
+  i8080_aot_op_0xF1(c, 0x0000); // pop psw
+  n += 1;
+  if (EVENTS(c) != 0) {
+    return n;
+  }
+i_0x0EB5:
+  c->cyc += 10;
+  c->pc = 0x0EB6;
+  i8080_aot_op_0xC9(c, 0x0000); // ret
+  n += 1;
+  goto dispatch;
+}
+
+#undef JUMP
+
+const i8080_aot_program i8080_aot_programs[] = {
+    {"cpu_tests/TST8080.COM", 0x0100, rom_tst8080_com},
+    {"cpu_tests/CPUTEST.COM", 0x0100, rom_cputest_com},
+    {"cpu_tests/8080PRE.COM", 0x0100, rom_8080pre_com},
+    {"cpu_tests/8080EXM.COM", 0x0100, rom_8080exm_com},
+    {NULL, 0, NULL},
+};
@@ -0,0 +1,502 @@
+// i8080_aot recompiles 8080 roms to C ahead of time.
+//
+//   usage: i8080_aot [-o output.c] [[-a origin] [-e entry]... rom]...
+//
+// The code of each rom (loaded at `origin`, 0x100 by default) is discovered
+// by recursive descent from its entry points (the origin, and the addresses
+// given with -e), following jumps, calls and restarts. The generated file
+// has one function per rom in which every basic block is straight-line C
+// code calling the (inlined) opcode handlers of the interpreter, and blocks
+// jump directly to each other. Indirect jumps (RET, PCHL) look their target
+// up in a switch. Code outside the rom and code that has been modified since
+// (checked at the start of each block, and after each store to the rest of
+// its block) are executed by the interpreter, one instruction at a time.
+//
+// The generated file includes the emulator (see i8080_aot_runtime.h): it is
+// built instead of i8080.c, and the programs are run with i8080_aot_run (see
+// i8080_aot.h). The tests can be run from recompiled roms with `make aot`.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../i8080.h"
+
+#define MAX_BLOCK_SIZE 16 // maximum number of instructions in a block
+
+// bits of rom.flags
+#define INSN 0x01 // start of an instruction
+#define LEADER 0x02 // start of a block
+
+typedef struct rom {
+  const char* filename;
+  char name[64]; // name of the generated function
+  uint16_t origin;
+  size_t size;
+  uint8_t mem[0x10000];
+  uint8_t flags[0x10000];
+} rom;
+
+typedef struct block {
+  uint16_t addrs[MAX_BLOCK_SIZE]; // address of each instruction
+  int nb_insns;
+  uint16_t end; // address following the block
+} block;
+
+static rom r;
+static block blocks[0x10000];
+static int nb_blocks;
+
+// returns if the `size` bytes at `addr` are in the rom
+static bool in_rom(unsigned addr, unsigned size) {
+  return addr >= r.origin && addr + size <= r.origin + r.size;
+}
+
+// returns the operand of the instruction at `addr`
+static uint16_t operand(uint16_t addr) {
+  const unsigned length = i8080_opcode_length(r.mem[addr]);
+  if (length == 3) {
+    return r.mem[addr + 1] | r.mem[addr + 2] << 8;
+  }
+  return length == 2 ? r.mem[addr + 1] : 0;
+}
+
+// returns the address an instruction jumps or calls to, or -1
+static int jump_target(uint16_t addr) {
+  const uint8_t opcode = r.mem[addr];
+  switch (opcode) {
+  case 0xC3: case 0xCB: // JMP
+  case 0xCD: case 0xDD: case 0xED: case 0xFD: return operand(addr); // CALL
+  }
+
+  switch (opcode & 0xC7) {
+  case 0xC2: // conditional jumps
+  case 0xC4: return operand(addr); // conditional calls
+  case 0xC7: return opcode & 0x38; // RST
+  }
+  return -1;
+}
+
+// returns if the execution never goes on with the next instruction
+static bool is_unconditional(uint8_t opcode) {
+  switch (opcode) {
+  case 0xC3: case 0xCB: // JMP
+  case 0xC9: case 0xD9: // RET
+  case 0xE9: return true; // PCHL
+  }
+  return false;
+}
+
+// returns if an instruction only works on registers: it doesn't access
+// memory or io, nor changes the control flow or the interrupt state. Their
+// pc and cycles don't need to be updated one by one.
+static bool is_pure(uint8_t opcode) {
+  if (opcode < 0x40) {
+    switch (opcode & 7) {
+    case 0: // NOP
+    case 1: // LXI, DAD
+    case 3: // INX, DCX
+    case 7: return true; // rotations, DAA, CMA, STC, CMC
+    case 2: return false; // memory loads and stores
+    default: return opcode >> 3 != 6; // INR, DCR, MVI (but not on M)
+    }
+  }
+
+  if (opcode < 0x80) { // MOV
+    return opcode != 0x76 && (opcode & 7) != 6 && (opcode & 0x38) != 0x30;
+  }
+  if (opcode < 0xC0) { // register ALU operations
+    return (opcode & 7) != 6;
+  }
+
+  // immediate ALU operations, XCHG, SPHL
+  return (opcode & 7) == 6 || opcode == 0xEB || opcode == 0xF9;
+}
+
+// returns the C expression of the address an instruction writes to, and the
+// number of bytes written in `size`, or NULL if it doesn't write to memory
+// (calls and restarts aside, which end their block)
+static const char* write_address(uint16_t addr, int* size) {
+  static char buf[8];
+  const uint8_t opcode = r.mem[addr];
+  *size = 1;
+  switch (opcode) {
+  case 0x02: return "i8080_get_bc(c)"; // STAX B
+  case 0x12: return "i8080_get_de(c)"; // STAX D
+  case 0x22: // SHLD
+  case 0x32: // STA
+    *size = opcode == 0x22 ? 2 : 1;
+    snprintf(buf, sizeof(buf), "0x%04X", operand(addr));
+    return buf;
+  case 0x34: case 0x35: case 0x36: // INR M, DCR M, MVI M
+    return "i8080_get_hl(c)";
+  case 0xC5: case 0xD5: case 0xE5: case 0xF5: // PUSH
+  case 0xE3: // XTHL
+    *size = 2;
+    return "c->sp";
+  }
+  if ((opcode & 0xF8) == 0x70 && opcode != 0x76) { // MOV M,r
+    return "i8080_get_hl(c)";
+  }
+  return NULL;
+}
+
+// finds the instructions reachable from `entry`
+static void discover(uint16_t entry) {
+  static uint16_t stack[0x10001];
+  int sp = 0;
+
+  r.flags[entry] |= LEADER;
+  stack[sp++] = entry;
+
+  while (sp > 0) {
+    unsigned addr = stack[--sp];
+
+    while (in_rom(addr, 1) && !(r.flags[addr] & INSN)) {
+      const uint8_t opcode = r.mem[addr];
+      if (!in_rom(addr, i8080_opcode_length(opcode))) {
+        break;
+      }
+      r.flags[addr] |= INSN;
+
+      const int target = jump_target(addr);
+      if (target >= 0 && in_rom(target, 1)) {
+        r.flags[target] |= LEADER;
+        stack[sp++] = target;
+      }
+
+      if (is_unconditional(opcode)) {
+        break;
+      }
+
+      addr += i8080_opcode_length(opcode);
+      if (i8080_opcode_ends_block(opcode)) {
+        r.flags[addr & 0xFFFF] |= LEADER;
+      }
+    }
+  }
+}
+
+// splits the discovered code into blocks
+static void make_blocks(void) {
+  nb_blocks = 0;
+
+  for (unsigned addr = r.origin; addr < r.origin + r.size; addr++) {
+    if ((r.flags[addr] & (INSN | LEADER)) != (INSN | LEADER)) {
+      continue;
+    }
+
+    block* const b = &blocks[nb_blocks++];
+    b->nb_insns = 0;
+    uint16_t pc = addr;
+
+    while (true) {
+      const uint8_t opcode = r.mem[pc];
+      b->addrs[b->nb_insns++] = pc;
+      pc += i8080_opcode_length(opcode);
+
+      if (i8080_opcode_ends_block(opcode) || !(r.flags[pc] & INSN) ||
+          (r.flags[pc] & LEADER)) {
+        break;
+      }
+      if (b->nb_insns == MAX_BLOCK_SIZE) {
+        r.flags[pc] |= LEADER;
+        break;
+      }
+    }
+
+    b->end = pc;
+  }
+}
+
+// returns if the instruction `i` of a block can be entered from the
+// dispatcher: the state is up to date (the previous instruction isn't pure)
+static bool is_entry(const block* b, int i) {
+  return i == 0 || !is_pure(r.mem[b->addrs[i - 1]]);
+}
+
+// outputs the condition checking that the code from `addr` to `end` hasn't
+// been modified (one test per page)
+static void output_check(FILE* f, uint16_t addr, uint16_t end) {
+  while (addr != end) {
+    uint16_t size = end - addr;
+    if ((addr & 0xFF) + size > I8080_PAGE_SIZE) {
+      size = I8080_PAGE_SIZE - (addr & 0xFF);
+    }
+
+    fprintf(f, "i8080_aot_code(c, 0x%04X, \"", addr);
+    for (int i = 0; i < size; i++) {
+      fprintf(f, "\\x%02X", r.mem[(uint16_t) (addr + i)]);
+    }
+    fprintf(f, "\", %d)", size);
+
+    addr += size;
+    if (addr != end) {
+      fprintf(f, " &&\n      ");
+    }
+  }
+}
+
+// outputs a jump to the block at `addr`, or to the dispatcher if there is no
+// block there
+static void output_jump(FILE* f, uint16_t addr) {
+  if (in_rom(addr, 1) && (r.flags[addr] & (INSN | LEADER)) == (INSN | LEADER)) {
+    fprintf(f, "JUMP(0x%04X);\n", addr);
+  } else {
+    fprintf(f, "goto dispatch;\n");
+  }
+}
+
+// outputs the disassembly of the instruction at `addr`: the operand replaces
+// the placeholder of i8080_disassemble (#, $ or p), if any
+static void output_disassembly(FILE* f, uint16_t addr) {
+  const uint8_t opcode = r.mem[addr];
+  const char* const text = i8080_disassemble(opcode);
+  int length = strlen(text);
+
+  if (i8080_opcode_length(opcode) == 1) {
+    fprintf(f, "%s", text);
+    return;
+  }
+
+  if (text[length - 1] == '#' || text[length - 1] == '$' ||
+      (text[length - 1] == 'p' && text[length - 2] == ' ')) {
+    length -= 1;
+  } else {
+    fprintf(f, "%s ", text);
+    length = 0;
+  }
+  const int digits = i8080_opcode_length(opcode) == 2 ? 2 : 4;
+  fprintf(f, "%.*s$%0*X", length, text, digits, operand(addr));
+}
+
+static void output_block(FILE* f, const block* b) {
+  unsigned pending_cycles = 0;
+
+  fprintf(f, "\nb_0x%04X:\n", b->addrs[0]);
+  fprintf(f, "  if (!(");
+  output_check(f, b->addrs[0], b->end);
+  fprintf(f, ")) {\n    goto fallback;\n  }\n");
+
+  for (int i = 0; i < b->nb_insns; i++) {
+    const uint16_t addr = b->addrs[i];
+    const uint8_t opcode = r.mem[addr];
+    const uint16_t next = addr + i8080_opcode_length(opcode);
+
+    if (i > 0 && is_entry(b, i)) {
+      fprintf(f, "i_0x%04X:\n", addr);
+    }
+
+    pending_cycles += i8080_opcode_cycles(opcode);
+    if (!is_pure(opcode) || i == b->nb_insns - 1) {
+      fprintf(f, "  c->cyc += %u;\n", pending_cycles);
+      fprintf(f, "  c->pc = 0x%04X;\n", next);
+      pending_cycles = 0;
+    }
+
+    fprintf(
+        f, "  i8080_aot_op_0x%02X(c, 0x%04X); // ", opcode, operand(addr));
+    output_disassembly(f, addr);
+    fprintf(f, "\n  n += 1;\n");
+
+    if (!is_pure(opcode) && i < b->nb_insns - 1) {
+      fprintf(f, "  if (EVENTS(c) != 0) {\n    return n;\n  }\n");
+
+      // a store to the rest of the block modifies its code: it goes on from
+      // the dispatcher, which sees the change
+      int size;
+      const char* const written = write_address(addr, &size);
+      const uint16_t from = next - size + 1;
+      const unsigned range = (uint16_t) (b->end - next) + size - 1;
+      if (opcode == 0x22 || opcode == 0x32) { // known address
+        if ((uint16_t) (operand(addr) - from) < range) {
+          fprintf(f, "  goto dispatch;\n");
+        }
+      } else if (written != NULL) {
+        fprintf(f,
+            "  if ((uint16_t) (%s - 0x%04X) < %u) {\n"
+            "    goto dispatch;\n  }\n",
+            written, from, range);
+      }
+    }
+  }
+
+  const uint16_t last = b->addrs[b->nb_insns - 1];
+  const uint8_t opcode = r.mem[last];
+  const int target = jump_target(last);
+
+  if (opcode == 0xC9 || opcode == 0xD9 || opcode == 0xE9) { // RET, PCHL
+    fprintf(f, "  goto dispatch;\n");
+    return;
+  }
+  if ((opcode & 0xC7) == 0xC0) { // conditional returns
+    fprintf(f, "  if (c->pc != 0x%04X) {\n    goto dispatch;\n  }\n", b->end);
+  } else if ((opcode & 0xC7) == 0xC2 ||
+             (opcode & 0xC7) == 0xC4) { // conditional jumps and calls
+    fprintf(f, "  if (c->pc == 0x%04X) {\n    ", target);
+    output_jump(f, target);
+    fprintf(f, "  }\n");
+  } else if (target >= 0) { // JMP, CALL, RST
+    fprintf(f, "  ");
+    output_jump(f, target);
+    return;
+  }
+
+  fprintf(f, "  ");
+  output_jump(f, b->end);
+}
+
+// outputs the function executing the rom
+static void output_rom(FILE* f) {
+  int nb_insns = 0;
+  for (int i = 0; i < nb_blocks; i++) {
+    nb_insns += blocks[i].nb_insns;
+  }
+
+  fprintf(f, "\n// %s: %d instructions in %d blocks\n", r.filename, nb_insns,
+      nb_blocks);
+  fprintf(f,
+      "static unsigned long %s(i8080* const c, unsigned long cycles) {\n",
+      r.name);
+  fprintf(f, "  const unsigned long start = c->cyc;\n");
+  fprintf(f, "  unsigned long n = 0;\n\n");
+
+  fprintf(f, "dispatch:\n");
+  fprintf(f, "  if (EVENTS(c) != 0 || c->cyc - start >= cycles) {\n");
+  fprintf(f, "    return n;\n  }\n\n");
+  fprintf(f, "  switch (c->pc) {\n");
+  for (int i = 0; i < nb_blocks; i++) {
+    const block* const b = &blocks[i];
+    fprintf(f, "  case 0x%04X: goto b_0x%04X;\n", b->addrs[0], b->addrs[0]);
+
+    for (int j = 1; j < b->nb_insns; j++) {
+      if (!is_entry(b, j)) {
+        continue;
+      }
+      fprintf(f, "  case 0x%04X:\n    if (", b->addrs[j]);
+      output_check(f, b->addrs[j], b->end);
+      fprintf(f, ") {\n      goto i_0x%04X;\n    }\n    break;\n",
+          b->addrs[j]);
+    }
+  }
+  fprintf(f, "  }\n\n");
+
+  if (nb_blocks > 0) {
+    fprintf(f, "fallback:\n");
+  }
+  fprintf(f, "  // not recompiled, or modified since\n");
+  fprintf(f, "  n += i8080_aot_fallback(c);\n");
+  fprintf(f, "  goto dispatch;\n");
+
+  for (int i = 0; i < nb_blocks; i++) {
+    output_block(f, &blocks[i]);
+  }
+
+  fprintf(f, "}\n");
+
+  fprintf(stderr, "%s: %d instructions in %d blocks\n", r.filename, nb_insns,
+      nb_blocks);
+}
+
+// loads a rom at `origin`, returns false on error
+static bool load_rom(const char* filename, uint16_t origin) {
+  FILE* f = fopen(filename, "rb");
+  if (f == NULL) {
+    fprintf(stderr, "error: can't open file '%s'.\n", filename);
+    return false;
+  }
+
+  memset(&r, 0, sizeof(r));
+  r.filename = filename;
+  r.origin = origin;
+  r.size = fread(&r.mem[origin], 1, sizeof(r.mem) - origin, f);
+  fclose(f);
+
+  // function name: the file name, lowercase and without special characters
+  const char* base = strrchr(filename, '/');
+  base = base != NULL ? base + 1 : filename;
+  snprintf(r.name, sizeof(r.name), "rom_%s", base);
+  for (char* p = r.name; *p != '\0'; p++) {
+    *p = (*p >= 'A' && *p <= 'Z') ? *p - 'A' + 'a' : *p;
+    if (!((*p >= 'a' && *p <= 'z') || (*p >= '0' && *p <= '9'))) {
+      *p = '_';
+    }
+  }
+
+  return true;
+}
+
+int main(int argc, char** argv) {
+  FILE* out = stdout;
+  for (int i = 1; i < argc - 1; i++) {
+    if (strcmp(argv[i], "-o") == 0) {
+      out = fopen(argv[i + 1], "w");
+      if (out == NULL) {
+        fprintf(stderr, "error: can't open file '%s'.\n", argv[i + 1]);
+        return 1;
+      }
+    }
+  }
+
+  fprintf(out, "// generated by i8080_aot: do not edit\n\n");
+  fprintf(out, "#include \"i8080_aot_runtime.h\"\n\n");
+  fprintf(out, "// goes on with the block at `addr`, unless the cycles have "
+               "been spent or\n// an event has been raised\n");
+  fprintf(out, "#define JUMP(addr) \\\n  do { \\\n");
+  fprintf(out, "    if (EVENTS(c) != 0 || c->cyc - start >= cycles) { \\\n");
+  fprintf(out, "      return n; \\\n    } \\\n");
+  fprintf(out, "    goto b_##addr; \\\n  } while (0)\n");
+
+  static const char* filenames[256];
+  static char names[256][64];
+  static uint16_t origins[256];
+  int nb_roms = 0;
+
+  unsigned origin = 0x100;
+  uint16_t entries[256];
+  int nb_entries = 0;
+
+  for (int i = 1; i < argc; i++) {
+    if (strcmp(argv[i], "-o") == 0 && i + 1 < argc) {
+      i += 1;
+    } else if (strcmp(argv[i], "-a") == 0 && i + 1 < argc) {
+      origin = strtoul(argv[++i], NULL, 0);
+    } else if (strcmp(argv[i], "-e") == 0 && i + 1 < argc) {
+      if (nb_entries < 256) {
+        entries[nb_entries++] = strtoul(argv[++i], NULL, 0);
+      }
+    } else if (nb_roms < 256) {
+      if (origin >= 0x10000 || !load_rom(argv[i], origin)) {
+        return 1;
+      }
+
+      discover(r.origin);
+      for (int j = 0; j < nb_entries; j++) {
+        discover(entries[j]);
+      }
+      make_blocks();
+      output_rom(out);
+
+      filenames[nb_roms] = r.filename;
+      strcpy(names[nb_roms], r.name);
+      origins[nb_roms] = r.origin;
+      nb_roms += 1;
+
+      // -a and -e only apply to the next rom
+      origin = 0x100;
+      nb_entries = 0;
+    }
+  }
+
+  fprintf(out, "\n#undef JUMP\n\n");
+  fprintf(out, "const i8080_aot_program i8080_aot_programs[] = {\n");
+  for (int i = 0; i < nb_roms; i++) {
+    fprintf(out, "    {\"%s\", 0x%04X, %s},\n", filenames[i], origins[i],
+        names[i]);
+  }
+  fprintf(out, "    {NULL, 0, NULL},\n};\n");
+
+  if (out != stdout) {
+    fclose(out);
+  }
+  return 0;
+}
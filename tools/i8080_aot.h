@@ -0,0 +1,22 @@
+#ifndef I8080_I8080_AOT_H_
+#define I8080_I8080_AOT_H_
+
+#include "i8080.h"
+
+// a program recompiled to C by i8080_aot (see i8080_aot.c)
+typedef struct i8080_aot_program {
+  const char* name; // file name of the rom, as given to i8080_aot
+  uint16_t origin; // address the rom was loaded at
+  // runs the recompiled code until at least `cycles` cycles have been spent
+  // or an event is raised, returns the number of instructions executed
+  unsigned long (*execute)(i8080* const c, unsigned long cycles);
+} i8080_aot_program;
+
+// the programs of a generated file, terminated by an entry with a NULL name
+extern const i8080_aot_program i8080_aot_programs[];
+
+const i8080_aot_program* i8080_aot_find(const char* name);
+i8080_run_result i8080_aot_run(
+    i8080* const c, const i8080_aot_program* program, unsigned long cycles);
+
+#endif // I8080_I8080_AOT_H_
@@ -0,0 +1,75 @@
+// support code of the files generated by i8080_aot. A generated file includes
+// the whole emulator, so that the recompiled code can expand the opcode
+// handlers of i8080_opcodes.h inline: it replaces i8080.c in a build.
+
+#include "i8080.c"
+#include "i8080_aot.h"
+
+// the recompiled code executes each instruction with i8080_aot_op_<opcode>,
+// one small function per opcode made from the handlers of i8080_opcodes.h.
+// As in a switch, a handler without NEXT goes on with the next one.
+#define DECLARE(hi, lo) \
+  static ALWAYS_INLINE void i8080_aot_op_0x##hi##lo( \
+      i8080* const c, uint16_t operand);
+#define DECLARE_ROW(hi) \
+  DECLARE(hi, 0) DECLARE(hi, 1) DECLARE(hi, 2) DECLARE(hi, 3) DECLARE(hi, 4) \
+  DECLARE(hi, 5) DECLARE(hi, 6) DECLARE(hi, 7) DECLARE(hi, 8) DECLARE(hi, 9) \
+  DECLARE(hi, A) DECLARE(hi, B) DECLARE(hi, C) DECLARE(hi, D) DECLARE(hi, E) \
+  DECLARE(hi, F)
+DECLARE_ROW(0) DECLARE_ROW(1) DECLARE_ROW(2) DECLARE_ROW(3) DECLARE_ROW(4)
+DECLARE_ROW(5) DECLARE_ROW(6) DECLARE_ROW(7) DECLARE_ROW(8) DECLARE_ROW(9)
+DECLARE_ROW(A) DECLARE_ROW(B) DECLARE_ROW(C) DECLARE_ROW(D) DECLARE_ROW(E)
+DECLARE_ROW(F)
+
+#define OPCODE(op) \
+  i8080_aot_op_##op(c, operand); \
+  } \
+  static ALWAYS_INLINE void i8080_aot_op_##op( \
+      i8080* const c, uint16_t operand) { \
+    (void) operand;
+#define NEXT return
+#define IMM8 ((uint8_t) operand)
+#define IMM16 (operand)
+
+// only there to open the function of the first handler
+static inline void i8080_aot_op_begin(i8080* const c, uint16_t operand) {
+#include "i8080_opcodes.h"
+}
+
+#undef DECLARE
+#undef DECLARE_ROW
+#undef OPCODE
+#undef NEXT
+#undef IMM8
+#undef IMM16
+
+// returns if the `size` bytes at `addr` (in a single page) still are the ones
+// the code has been recompiled from
+static ALWAYS_INLINE bool i8080_aot_code(
+    i8080* const c, uint16_t addr, const char* code, size_t size) {
+  const uint8_t* const mem = c->read_pages[addr >> 8];
+  return mem != NULL && memcmp(mem + (addr & 0xFF), code, size) == 0;
+}
+
+// executes one instruction with the interpreter, for code that hasn't been
+// recompiled or has been modified since
+static inline unsigned long i8080_aot_fallback(i8080* const c) {
+  return i8080_execute(c, i8080_next_byte(c), 1);
+}
+
+// returns the recompiled program from the rom `name`, or NULL
+const i8080_aot_program* i8080_aot_find(const char* name) {
+  for (const i8080_aot_program* p = i8080_aot_programs; p->name != NULL; p++) {
+    if (strcmp(p->name, name) == 0) {
+      return p;
+    }
+  }
+  return NULL;
+}
+
+// same as i8080_run, executing the recompiled code of `program` wherever the
+// rom hasn't been modified
+i8080_run_result i8080_aot_run(
+    i8080* const c, const i8080_aot_program* program, unsigned long cycles) {
+  return i8080_run_with(c, cycles, program->execute);
+}
@@ -0,0 +1,805 @@
+// i8080_cpm runs CP/M programs headless, as jobs of the batch runner (see
+// i8080_batch.h): the BDOS console and file functions are emulated on the
+// host, with the files of the current directory, and what programs print is
+// written in large blocks.
+//
+//   usage: i8080_cpm [-t threads] [-n cycles] "PROG.COM [arguments]"...
+//
+// Each program is a job, run with its arguments (as typed after the command
+// in CP/M) until it returns to CP/M, on `threads` threads (one per core by
+// default) and for at most `cycles` cycles (no limit by default). The .COM
+// images are mapped with mmap, copy-on-write, instead of being read. With a
+// single program, its output is written as it runs and console input comes
+// from stdin; with several, the output of each program is written once they
+// are all done, and console input is empty.
+
+#define _DEFAULT_SOURCE // for mmap and dirent
+
+#include <ctype.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "../i8080.h"
+#include "../i8080_batch.h"
+
+#define BDOS 0xFE00 // "out 1,a; ret", and top of the memory of programs
+#define BIOS 0xFF00 // jump table: "out 0x10 + n,a; ret" for entry n
+#define NB_BIOS_ENTRIES 17
+#define TPA 0x0100 // where programs are loaded
+#define DEFAULT_DMA 0x0080
+#define RECORD_SIZE 128
+
+#define OUTPUT_SIZE 0x10000 // console output written at once
+#define MAX_FILES 16 // files open at the same time, per program
+
+// a file opened by a program, found from the name in its FCBs
+typedef struct cpm_file {
+  char name[11]; // as in FCBs, padded with spaces
+  FILE* f; // NULL if unused
+} cpm_file;
+
+typedef struct machine {
+  i8080 cpu;
+  const char* command; // "PROG.COM arguments"
+  char filename[256];
+  uint8_t* image; // .COM file, mapped at TPA
+  size_t image_size;
+  uint8_t memory[0x10000]; // the rest of the memory
+
+  uint16_t dma;
+  cpm_file files[MAX_FILES];
+  DIR* search; // directory read by "search next"
+  char pattern[11]; // FCB name searched, with '?' as wildcards
+  bool warned[256]; // unsupported BDOS functions already reported
+
+  bool input; // console input from stdin, or empty
+  bool stream; // output written when OUTPUT_SIZE bytes are buffered
+  char* output;
+  size_t output_size, output_capacity;
+} machine;
+
+// console
+
+static void console_flush(machine* const m) {
+  fwrite(m->output, 1, m->output_size, stdout);
+  m->output_size = 0;
+}
+
+static void console_out(machine* const m, uint8_t ch) {
+  if (m->output_size == m->output_capacity) {
+    if (m->stream) {
+      console_flush(m);
+    } else {
+      const size_t capacity = m->output_capacity * 2;
+      char* const output = realloc(m->output, capacity);
+      if (output == NULL) {
+        return;
+      }
+      m->output = output;
+      m->output_capacity = capacity;
+    }
+  }
+  m->output[m->output_size++] = ch;
+}
+
+// returns if a character can be read without waiting for one
+static bool console_ready(machine* const m) {
+  if (!m->input) {
+    return false;
+  }
+  const int ch = getchar();
+  if (ch == EOF) {
+    return false;
+  }
+  ungetc(ch, stdin);
+  return true;
+}
+
+// returns the next character of the input, ^Z at its end. Line feeds are
+// read as carriage returns, as typed on a CP/M console.
+static uint8_t console_in(machine* const m) {
+  if (m->stream) {
+    console_flush(m);
+    fflush(stdout);
+  }
+  const int ch = m->input ? getchar() : EOF;
+  if (ch == EOF) {
+    return 0x1A;
+  }
+  return ch == '\n' ? '\r' : ch;
+}
+
+// reads a line in the buffer at `addr`: its size, then the number of
+// characters read and the characters (BDOS function 10)
+static void console_read_line(machine* const m, uint16_t addr) {
+  i8080* const c = &m->cpu;
+  const uint8_t size = i8080_peek(c, addr);
+  uint8_t count = 0;
+  while (count < size) {
+    const uint8_t ch = console_in(m);
+    if (ch == '\r' || ch == 0x1A) {
+      break;
+    }
+    console_out(m, ch);
+    i8080_poke(c, addr + 2 + count, ch);
+    count += 1;
+  }
+  i8080_poke(c, addr + 1, count);
+}
+
+// files
+
+// reads the name of a file from an FCB, without the attribute bits
+static void fcb_name(i8080* const c, uint16_t fcb, char* name) {
+  for (int i = 0; i < 11; i++) {
+    name[i] = toupper(i8080_peek(c, fcb + 1 + i) & 0x7F);
+  }
+}
+
+// converts an FCB name to a host file name ("NAME.EXT")
+static void host_name(const char* name, char* buf, bool lower) {
+  int n = 0;
+  for (int i = 0; i < 11; i++) {
+    if (i == 8 && name[8] != ' ') {
+      buf[n++] = '.';
+    }
+    if (name[i] != ' ') {
+      buf[n++] = lower ? tolower(name[i]) : name[i];
+    }
+  }
+  buf[n] = '\0';
+}
+
+// converts a host file name to an FCB name, returns false if it isn't a
+// valid CP/M name (8.3)
+static bool cpm_name(const char* filename, char* name) {
+  memset(name, ' ', 11);
+  int i = 0;
+  for (; *filename != '\0'; filename++) {
+    if (*filename == '.' && i <= 8) {
+      if (i == 0) {
+        return false;
+      }
+      i = 8;
+    } else if (i == 11 || (i == 8 && name[8] == ' ' && filename[-1] != '.') ||
+               !isgraph((unsigned char) *filename)) {
+      return false;
+    } else {
+      name[i++] = toupper((unsigned char) *filename);
+    }
+  }
+  return i > 0;
+}
+
+// opens a host file from its FCB name, in upper or lower case
+static FILE* host_open(const char* name, const char* mode) {
+  char buf[16];
+  host_name(name, buf, false);
+  FILE* f = fopen(buf, mode);
+  if (f == NULL) {
+    host_name(name, buf, true);
+    f = fopen(buf, mode);
+  }
+  return f;
+}
+
+static bool name_matches(const char* pattern, const char* name) {
+  for (int i = 0; i < 11; i++) {
+    if (pattern[i] != '?' && pattern[i] != name[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// returns the file open with the name of an FCB, or NULL
+static cpm_file* find_file(machine* const m, uint16_t fcb) {
+  char name[11];
+  fcb_name(&m->cpu, fcb, name);
+  for (int i = 0; i < MAX_FILES; i++) {
+    if (m->files[i].f != NULL && memcmp(m->files[i].name, name, 11) == 0) {
+      return &m->files[i];
+    }
+  }
+  return NULL;
+}
+
+static void close_file(cpm_file* const file) {
+  if (file != NULL && file->f != NULL) {
+    fclose(file->f);
+    file->f = NULL;
+  }
+}
+
+// opens (or creates) the file of an FCB, and sets its record count. Returns
+// 0, or 0xFF if it can't be opened.
+static uint8_t open_file(machine* const m, uint16_t fcb, bool create) {
+  i8080* const c = &m->cpu;
+  close_file(find_file(m, fcb));
+
+  cpm_file* file = NULL;
+  for (int i = 0; i < MAX_FILES && file == NULL; i++) {
+    if (m->files[i].f == NULL) {
+      file = &m->files[i];
+    }
+  }
+  char name[11];
+  fcb_name(c, fcb, name);
+  if (file == NULL || memchr(name, '?', 11) != NULL) {
+    return 0xFF;
+  }
+
+  if (create) {
+    file->f = host_open(name, "w+b");
+  } else {
+    file->f = host_open(name, "r+b");
+    if (file->f == NULL) {
+      file->f = host_open(name, "rb");
+    }
+  }
+  if (file->f == NULL) {
+    return 0xFF;
+  }
+  memcpy(file->name, name, 11);
+
+  // records in the extent the FCB points to
+  fseek(file->f, 0, SEEK_END);
+  const long records = (ftell(file->f) + RECORD_SIZE - 1) / RECORD_SIZE;
+  const long extent = i8080_peek(c, fcb + 12) & 0x1F;
+  long rc = records - extent * 128;
+  rc = rc < 0 ? 0 : rc > 128 ? 128 : rc;
+  i8080_poke(c, fcb + 14, 0); // S2
+  i8080_poke(c, fcb + 15, rc);
+  return 0;
+}
+
+// returns the record an FCB points to, for sequential accesses (S2, EX, CR)
+static long fcb_record(i8080* const c, uint16_t fcb) {
+  const long extent =
+      (i8080_peek(c, fcb + 14) & 0x3F) << 5 | (i8080_peek(c, fcb + 12) & 0x1F);
+  return extent * 128 + i8080_peek(c, fcb + 32);
+}
+
+static void fcb_set_record(i8080* const c, uint16_t fcb, long record) {
+  i8080_poke(c, fcb + 32, record % 128);
+  i8080_poke(c, fcb + 12, (record / 128) & 0x1F);
+  i8080_poke(c, fcb + 14, (record / 128) >> 5);
+}
+
+static long fcb_random_record(i8080* const c, uint16_t fcb) {
+  return i8080_peek(c, fcb + 33) | i8080_peek(c, fcb + 34) << 8 |
+         (i8080_peek(c, fcb + 35) & 0x03) << 16;
+}
+
+static void fcb_set_random_record(i8080* const c, uint16_t fcb, long record) {
+  i8080_poke(c, fcb + 33, record);
+  i8080_poke(c, fcb + 34, record >> 8);
+  i8080_poke(c, fcb + 35, record >> 16);
+}
+
+// reads a record of the file of an FCB to the DMA buffer (padded with ^Z).
+// Returns 0, 1 at the end of the file, or 9 if the file isn't open.
+static uint8_t read_record(machine* const m, uint16_t fcb, long record) {
+  i8080* const c = &m->cpu;
+  cpm_file* const file = find_file(m, fcb);
+  if (file == NULL) {
+    return 9;
+  }
+  uint8_t buf[RECORD_SIZE];
+  fseek(file->f, record * RECORD_SIZE, SEEK_SET);
+  const size_t n = fread(buf, 1, RECORD_SIZE, file->f);
+  if (n == 0) {
+    return 1;
+  }
+  memset(&buf[n], 0x1A, RECORD_SIZE - n);
+  for (int i = 0; i < RECORD_SIZE; i++) {
+    i8080_poke(c, m->dma + i, buf[i]);
+  }
+  return 0;
+}
+
+// writes the DMA buffer to a record of the file of an FCB. Returns 0, 2 if
+// the write failed, or 9 if the file isn't open.
+static uint8_t write_record(machine* const m, uint16_t fcb, long record) {
+  i8080* const c = &m->cpu;
+  cpm_file* const file = find_file(m, fcb);
+  if (file == NULL) {
+    return 9;
+  }
+  uint8_t buf[RECORD_SIZE];
+  for (int i = 0; i < RECORD_SIZE; i++) {
+    buf[i] = i8080_peek(c, m->dma + i);
+  }
+  fseek(file->f, record * RECORD_SIZE, SEEK_SET);
+  return fwrite(buf, 1, RECORD_SIZE, file->f) == RECORD_SIZE ? 0 : 2;
+}
+
+// writes the directory entry of the next file matching the searched pattern
+// to the DMA buffer. Returns 0, or 0xFF once there are no more.
+static uint8_t search_next(machine* const m) {
+  i8080* const c = &m->cpu;
+  if (m->search == NULL) {
+    return 0xFF;
+  }
+
+  struct dirent* entry;
+  while ((entry = readdir(m->search)) != NULL) {
+    char name[11];
+    struct stat st;
+    if (!cpm_name(entry->d_name, name) || !name_matches(m->pattern, name) ||
+        stat(entry->d_name, &st) != 0 || !S_ISREG(st.st_mode)) {
+      continue;
+    }
+
+    const long records = (st.st_size + RECORD_SIZE - 1) / RECORD_SIZE;
+    uint8_t dir[RECORD_SIZE];
+    memset(dir, 0xE5, sizeof(dir));
+    memset(dir, 0, 32);
+    memcpy(&dir[1], name, 11);
+    dir[12] = records > 128 ? (records - 1) / 128 & 0x1F : 0; // EX
+    dir[15] = records > 128 ? (records - 1) % 128 + 1 : records; // RC
+    for (int i = 0; i < RECORD_SIZE; i++) {
+      i8080_poke(c, m->dma + i, dir[i]);
+    }
+    return 0;
+  }
+
+  closedir(m->search);
+  m->search = NULL;
+  return 0xFF;
+}
+
+static uint8_t search_first(machine* const m, uint16_t fcb) {
+  if (m->search != NULL) {
+    closedir(m->search);
+  }
+  fcb_name(&m->cpu, fcb, m->pattern);
+  m->search = opendir(".");
+  return search_next(m);
+}
+
+// deletes the files matching the name of an FCB (with wildcards)
+static uint8_t delete_files(machine* const m, uint16_t fcb) {
+  char pattern[11];
+  fcb_name(&m->cpu, fcb, pattern);
+  DIR* const dir = opendir(".");
+  if (dir == NULL) {
+    return 0xFF;
+  }
+
+  uint8_t result = 0xFF;
+  struct dirent* entry;
+  while ((entry = readdir(dir)) != NULL) {
+    char name[11];
+    if (cpm_name(entry->d_name, name) && name_matches(pattern, name)) {
+      for (int i = 0; i < MAX_FILES; i++) {
+        if (m->files[i].f != NULL && memcmp(m->files[i].name, name, 11) == 0) {
+          close_file(&m->files[i]);
+        }
+      }
+      if (remove(entry->d_name) == 0) {
+        result = 0;
+      }
+    }
+  }
+  closedir(dir);
+  return result;
+}
+
+// renames the file of an FCB to the name at FCB + 16
+static uint8_t rename_file(machine* const m, uint16_t fcb) {
+  char from[11], to[11], from_buf[16], to_buf[16];
+  fcb_name(&m->cpu, fcb, from);
+  fcb_name(&m->cpu, fcb + 16, to);
+  close_file(find_file(m, fcb));
+
+  host_name(from, from_buf, false);
+  if (access(from_buf, F_OK) != 0) {
+    host_name(from, from_buf, true);
+  }
+  host_name(to, to_buf, false);
+  return rename(from_buf, to_buf) == 0 ? 0 : 0xFF;
+}
+
+// BDOS and BIOS
+
+// emulates the BDOS function in C, with its parameter in DE. The result is
+// returned in A and L (bytes) or HL (words), and H and B.
+static void bdos(machine* const m) {
+  i8080* const c = &m->cpu;
+  const uint16_t de = c->d << 8 | c->e;
+  uint16_t result = 0;
+
+  switch (c->c) {
+  case 0: // system reset
+    i8080_stop(c);
+    return;
+  case 1: // console input
+    result = console_in(m);
+    console_out(m, result);
+    break;
+  case 2: // console output
+    console_out(m, c->e);
+    break;
+  case 3: // reader input
+    result = 0x1A;
+    break;
+  case 4: // punch output
+  case 5: // list output
+    break;
+  case 6: // direct console io
+    if (c->e == 0xFF) {
+      result = console_ready(m) ? console_in(m) : 0;
+    } else if (c->e == 0xFE) {
+      result = console_ready(m) ? 0xFF : 0;
+    } else {
+      console_out(m, c->e);
+    }
+    break;
+  case 7: // get io byte
+  case 8: // set io byte
+    break;
+  case 9: // print string
+    for (uint16_t addr = de; i8080_peek(c, addr) != '$'; addr++) {
+      console_out(m, i8080_peek(c, addr));
+    }
+    break;
+  case 10: // read console buffer
+    console_read_line(m, de);
+    break;
+  case 11: // console status
+    result = console_ready(m) ? 0xFF : 0;
+    break;
+  case 12: // version: CP/M 2.2
+    result = 0x0022;
+    break;
+  case 13: // reset disks
+    m->dma = DEFAULT_DMA;
+    break;
+  case 14: // select disk
+    break;
+  case 15: // open file
+    result = open_file(m, de, false);
+    break;
+  case 16: // close file
+    close_file(find_file(m, de));
+    break;
+  case 17: // search for first
+    result = search_first(m, de);
+    break;
+  case 18: // search for next
+    result = search_next(m);
+    break;
+  case 19: // delete file
+    result = delete_files(m, de);
+    break;
+  case 20: // read sequential
+  case 21: { // write sequential
+    const long record = fcb_record(c, de);
+    result = c->c == 20 ? read_record(m, de, record)
+                        : write_record(m, de, record);
+    if (result == 0) {
+      fcb_set_record(c, de, record + 1);
+    }
+    break;
+  }
+  case 22: // make file
+    result = open_file(m, de, true);
+    break;
+  case 23: // rename file
+    result = rename_file(m, de);
+    break;
+  case 24: // login vector: drive A only
+    result = 0x0001;
+    break;
+  case 25: // current disk
+  case 32: // user code
+    break;
+  case 26: // set DMA address
+    m->dma = de;
+    break;
+  case 33: // read random
+  case 34: { // write random
+    const long record = fcb_random_record(c, de);
+    result = c->c == 33 ? read_record(m, de, record)
+                        : write_record(m, de, record);
+    if (result == 0) {
+      fcb_set_record(c, de, record);
+    }
+    break;
+  }
+  case 35: { // compute file size
+    char name[11];
+    fcb_name(c, de, name);
+    FILE* const f = host_open(name, "rb");
+    if (f == NULL) {
+      result = 0xFF;
+      break;
+    }
+    fseek(f, 0, SEEK_END);
+    fcb_set_random_record(c, de, (ftell(f) + RECORD_SIZE - 1) / RECORD_SIZE);
+    fclose(f);
+    break;
+  }
+  case 36: // set random record
+    fcb_set_random_record(c, de, fcb_record(c, de));
+    break;
+  default:
+    if (!m->warned[c->c]) {
+      fprintf(stderr, "%s: BDOS function %d isn't supported.\n",
+          m->filename, c->c);
+      m->warned[c->c] = true;
+    }
+    result = 0xFF;
+    break;
+  }
+
+  c->a = c->l = result & 0xFF;
+  c->b = c->h = result >> 8;
+}
+
+// emulates the BIOS entry `n`: only the console is supported, disk entries
+// fail
+static void bios(machine* const m, int n) {
+  i8080* const c = &m->cpu;
+  switch (n) {
+  case 0: // cold boot
+  case 1: // warm boot
+    i8080_stop(c);
+    break;
+  case 2: // console status
+    c->a = console_ready(m) ? 0xFF : 0;
+    break;
+  case 3: // console input
+    c->a = console_in(m);
+    break;
+  case 4: // console output
+    console_out(m, c->c);
+    break;
+  case 7: // reader input
+    c->a = 0x1A;
+    break;
+  case 9: // select disk: no disk
+    c->h = 0;
+    c->l = 0;
+    break;
+  default:
+    c->a = 0xFF;
+    break;
+  }
+}
+
+static uint8_t port_in(void* userdata, uint8_t port) {
+  (void) userdata;
+  (void) port;
+  return 0x00;
+}
+
+// port 1 calls the BDOS, 0x10 + n the BIOS entry n
+static void port_out(void* userdata, uint8_t port, uint8_t value) {
+  (void) value;
+  machine* const m = userdata;
+  if (port == 1) {
+    bdos(m);
+  } else if (port >= 0x10 && port < 0x10 + NB_BIOS_ENTRIES) {
+    bios(m, port - 0x10);
+  }
+}
+
+// loading
+
+// fills the FCB at `addr` from a file name typed in a command ("B:NAME.EXT",
+// with * and ? as wildcards)
+static void parse_fcb(uint8_t* const fcb, const char* arg, size_t size) {
+  memset(fcb, 0, 16);
+  memset(&fcb[1], ' ', 11);
+  if (size >= 2 && arg[1] == ':') {
+    fcb[0] = toupper((unsigned char) arg[0]) - 'A' + 1;
+    arg += 2;
+    size -= 2;
+  }
+
+  int i = 1;
+  for (size_t k = 0; k < size; k++) {
+    const char ch = toupper((unsigned char) arg[k]);
+    if (ch == '.') {
+      i = 9;
+    } else if (ch == '*') {
+      while (i < (i <= 8 ? 9 : 12)) {
+        fcb[i++] = '?';
+      }
+    } else if (i < 12 && (i != 9 || (k > 0 && arg[k - 1] == '.'))) {
+      fcb[i++] = ch;
+    }
+  }
+}
+
+// maps the .COM file of a command at TPA, copy-on-write, and sets up the
+// zero page (BDOS and BIOS entries, default FCBs, command tail) as the CCP
+static bool load_machine(machine* const m, const char* command) {
+  i8080* const c = &m->cpu;
+  m->command = command;
+  size_t length = strcspn(command, " ");
+  if (length >= sizeof(m->filename)) {
+    length = sizeof(m->filename) - 1;
+  }
+  memcpy(m->filename, command, length);
+  m->filename[length] = '\0';
+
+  const int fd = open(m->filename, O_RDONLY);
+  struct stat st;
+  if (fd < 0 || fstat(fd, &st) != 0) {
+    fprintf(stderr, "error: can't open file '%s'.\n", m->filename);
+    if (fd >= 0) {
+      close(fd);
+    }
+    return false;
+  }
+  if (st.st_size == 0 || st.st_size > BDOS - TPA) {
+    fprintf(stderr, "error: %s can't fit in memory.\n", m->filename);
+    close(fd);
+    return false;
+  }
+  m->image_size = st.st_size;
+  m->image = mmap(NULL, m->image_size, PROT_READ | PROT_WRITE, MAP_PRIVATE,
+      fd, 0);
+  close(fd);
+  if (m->image == MAP_FAILED) {
+    fprintf(stderr, "error: can't map file '%s'.\n", m->filename);
+    m->image = NULL;
+    return false;
+  }
+
+  i8080_init(c);
+  c->userdata = m;
+  c->port_in = port_in;
+  c->port_out = port_out;
+  i8080_map_ram(c, 0x0000, sizeof(m->memory), m->memory);
+  // the last page of the image is mapped past the end of the file, which
+  // reads as zeros up to the end of the host page
+  const size_t image_pages =
+      (m->image_size + I8080_PAGE_SIZE - 1) / I8080_PAGE_SIZE;
+  i8080_map_ram(c, TPA, image_pages * I8080_PAGE_SIZE, m->image);
+
+  // "jmp BIOS + 3" (warm boot) at 0x0000 and "jmp BDOS" at 0x0005
+  uint8_t* const mem = m->memory;
+  memcpy(&mem[0x0000], "\xC3\x03\xFF", 3);
+  memcpy(&mem[0x0005], "\xC3\x00\xFE", 3);
+  memcpy(&mem[BDOS], "\xD3\x01\xC9", 3);
+  for (int n = 0; n < NB_BIOS_ENTRIES; n++) {
+    mem[BIOS + n * 3] = 0xD3;
+    mem[BIOS + n * 3 + 1] = 0x10 + n;
+    mem[BIOS + n * 3 + 2] = 0xC9;
+  }
+
+  // the arguments, uppercased, and the first two as FCBs
+  const char* args = command + strcspn(command, " ");
+  size_t tail = strlen(args) < 127 ? strlen(args) : 127;
+  mem[DEFAULT_DMA] = tail;
+  for (size_t i = 0; i < tail; i++) {
+    mem[DEFAULT_DMA + 1 + i] = toupper((unsigned char) args[i]);
+  }
+  for (int i = 0; i < 2; i++) {
+    args += strspn(args, " ");
+    const size_t size = strcspn(args, " ");
+    parse_fcb(&mem[0x5C + i * 16], args, size);
+    args += size;
+  }
+
+  m->dma = DEFAULT_DMA;
+  c->pc = TPA;
+  // returning from the program goes to 0x0000 (warm boot)
+  c->sp = BDOS - 2;
+  mem[BDOS - 2] = 0x00;
+  mem[BDOS - 1] = 0x00;
+
+  m->output_capacity = OUTPUT_SIZE;
+  m->output = malloc(m->output_capacity);
+  if (m->output == NULL) {
+    return false;
+  }
+
+  if (!i8080_enable_jit(c) && !i8080_enable_cache(c)) {
+    fprintf(stderr, "error: can't allocate the block cache.\n");
+    return false;
+  }
+  return true;
+}
+
+static void free_machine(machine* const m) {
+  i8080_destroy(&m->cpu);
+  for (int i = 0; i < MAX_FILES; i++) {
+    close_file(&m->files[i]);
+  }
+  if (m->search != NULL) {
+    closedir(m->search);
+  }
+  if (m->image != NULL) {
+    munmap(m->image, m->image_size);
+  }
+  free(m->output);
+}
+
+int main(int argc, char** argv) {
+  int nb_threads = 0;
+  unsigned long max_cycles = 0;
+  int i = 1;
+  for (; i < argc - 1 && argv[i][0] == '-'; i += 2) {
+    if (strcmp(argv[i], "-t") == 0) {
+      nb_threads = atoi(argv[i + 1]);
+    } else if (strcmp(argv[i], "-n") == 0) {
+      max_cycles = strtoul(argv[i + 1], NULL, 10);
+    } else {
+      break;
+    }
+  }
+  if (i >= argc || argv[i][0] == '-') {
+    fprintf(stderr,
+        "usage: %s [-t threads] [-n cycles] \"PROG.COM [arguments]\"...\n",
+        argv[0]);
+    return 1;
+  }
+
+  const int nb_machines = argc - i;
+  machine* const machines = calloc(nb_machines, sizeof(machine));
+  i8080_job* const jobs = calloc(nb_machines, sizeof(i8080_job));
+  if (machines == NULL || jobs == NULL) {
+    fprintf(stderr, "error: out of memory.\n");
+    return 1;
+  }
+
+  int status = 0;
+  int nb_jobs = 0;
+  for (int k = 0; k < nb_machines; k++) {
+    machine* const m = &machines[k];
+    m->input = nb_machines == 1;
+    m->stream = nb_machines == 1;
+    if (!load_machine(m, argv[i + k])) {
+      status = 1;
+      continue;
+    }
+    jobs[nb_jobs].cpu = &m->cpu;
+    jobs[nb_jobs].memory = NULL; // mapped by load_machine
+    jobs[nb_jobs].max_cycles = max_cycles;
+    nb_jobs += 1;
+  }
+
+  if (!i8080_run_batch(jobs, nb_jobs, nb_threads, 0)) {
+    fprintf(stderr, "error: can't allocate the batch.\n");
+    return 1;
+  }
+
+  static const char* const REASONS[] = {
+      "cycle limit", "returned to CP/M", "halted", "breakpoint"};
+  for (int k = 0; k < nb_jobs; k++) {
+    const i8080_job* const job = &jobs[k];
+    machine* const m = job->cpu->userdata;
+    if (!m->stream) {
+      printf("*** %s\n", m->command);
+    }
+    console_flush(m);
+    if (!m->stream) {
+      printf("\n");
+    }
+    fflush(stdout);
+
+    fprintf(stderr, "%s: %lu cycles, %lu instructions in %.3f s (%s)\n",
+        m->command, job->cycles, job->instructions, job->wall_time,
+        REASONS[job->reason]);
+    if (job->reason != I8080_RUN_STOPPED) {
+      status = 1;
+    }
+  }
+
+  for (int k = 0; k < nb_machines; k++) {
+    free_machine(&machines[k]);
+  }
+  free(machines);
+  free(jobs);
+  return status;
+}
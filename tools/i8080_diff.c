@@ -0,0 +1,158 @@
+// i8080_diff runs a CP/M program (as the test roms) on two engines in
+// lockstep, or on one engine against a trace recorded with
+// i8080_trace_step, and reports the first instruction they disagree on.
+//
+//   usage: i8080_diff [-a engine] [-b engine] [-t trace] [-n cycles] rom
+//
+// Engines are `interpreter` (for the first emulator by default), `cache` and
+// `jit` (for the second one by default). With -t, the first emulator is
+// compared to the trace instead, which must start at the beginning of the
+// program. The emulators are compared every `cycles` cycles (1000000 by
+// default).
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../i8080.h"
+#include "../i8080_diff.h"
+
+#define RUN_CYCLES 100000000
+
+typedef struct machine {
+  i8080 cpu;
+  uint8_t memory[0x10000];
+} machine;
+
+static uint8_t port_in(void* userdata, uint8_t port) {
+  (void) userdata;
+  (void) port;
+  return 0x00;
+}
+
+// port 0 ends the program, what it prints (port 1) is ignored
+static void port_out(void* userdata, uint8_t port, uint8_t value) {
+  (void) value;
+  machine* const m = userdata;
+  if (port == 0) {
+    i8080_stop(&m->cpu);
+  }
+}
+
+static bool load_machine(machine* const m, const char* filename,
+    const char* engine) {
+  i8080* const c = &m->cpu;
+  i8080_init(c);
+  c->userdata = m;
+  c->port_in = port_in;
+  c->port_out = port_out;
+  memset(m->memory, 0, sizeof(m->memory));
+  i8080_map_ram(c, 0x0000, sizeof(m->memory), m->memory);
+
+  FILE* const f = fopen(filename, "rb");
+  if (f == NULL) {
+    fprintf(stderr, "error: can't open file '%s'.\n", filename);
+    return false;
+  }
+  fread(&m->memory[0x100], 1, sizeof(m->memory) - 0x100, f);
+  fclose(f);
+
+  c->pc = 0x100;
+  // "out 0,a" at 0x0000 and "out 1,a; ret" at 0x0005, as in i8080_tests.c
+  memcpy(&m->memory[0x0000], "\xD3\x00", 2);
+  memcpy(&m->memory[0x0005], "\xD3\x01\xC9", 3);
+
+  if (strcmp(engine, "cache") == 0) {
+    return i8080_enable_cache(c);
+  } else if (strcmp(engine, "jit") == 0) {
+    return i8080_enable_jit(c);
+  }
+  return strcmp(engine, "interpreter") == 0;
+}
+
+int main(int argc, char** argv) {
+  const char* engines[2] = {"interpreter", "jit"};
+  const char* trace = NULL;
+  unsigned long interval = 0;
+  int i = 1;
+  for (; i < argc - 1; i += 2) {
+    if (strcmp(argv[i], "-a") == 0) {
+      engines[0] = argv[i + 1];
+    } else if (strcmp(argv[i], "-b") == 0) {
+      engines[1] = argv[i + 1];
+    } else if (strcmp(argv[i], "-t") == 0) {
+      trace = argv[i + 1];
+    } else if (strcmp(argv[i], "-n") == 0) {
+      interval = strtoul(argv[i + 1], NULL, 0);
+    } else {
+      break;
+    }
+  }
+  if (i != argc - 1) {
+    fprintf(stderr,
+        "usage: %s [-a engine] [-b engine] [-t trace] [-n cycles] rom\n",
+        argv[0]);
+    return 1;
+  }
+
+  static machine machines[2];
+  for (int k = 0; k < (trace != NULL ? 1 : 2); k++) {
+    if (!load_machine(&machines[k], argv[i], engines[k])) {
+      fprintf(stderr, "error: can't use the engine '%s'.\n", engines[k]);
+      return 1;
+    }
+  }
+
+  i8080_diff d;
+  FILE* f = NULL;
+  i8080_trace_reader* r = NULL;
+  if (trace != NULL) {
+    f = fopen(trace, "rb");
+    r = f != NULL ? i8080_trace_read_open(f) : NULL;
+    if (r == NULL) {
+      fprintf(stderr, "error: can't read the trace '%s'.\n", trace);
+      return 1;
+    }
+    i8080_diff_init_trace(&d, &machines[0].cpu, r);
+  } else if (!i8080_diff_init(&d, &machines[0].cpu, &machines[1].cpu)) {
+    fprintf(stderr, "error: out of memory.\n");
+    return 1;
+  }
+  if (interval != 0) {
+    d.interval = interval;
+  }
+
+  unsigned long instructions = 0;
+  i8080_run_result result;
+  do {
+    result = i8080_diff_run(&d, RUN_CYCLES);
+    instructions += result.instructions;
+  } while (!d.diverged && result.reason == I8080_RUN_BUDGET);
+
+  if (d.diverged) {
+    printf("diverged after cycle %lu, at %04X: %02X %s (%lu/%lu "
+           "instructions)\n%s\n",
+        d.cyc, d.pc, d.opcode, i8080_disassemble(d.opcode),
+        d.instructions[0], d.instructions[1], d.difference);
+
+    // the cache and the jit only stop at the end of blocks (straight-line
+    // code): one of the instructions of the block differs
+    uint16_t addr = d.pc;
+    for (unsigned long k = 0; d.instructions[0] > 1 &&
+                              k < d.instructions[0];
+         k++) {
+      const uint8_t opcode = machines[0].memory[addr];
+      printf("  %04X: %02X %s\n", addr, opcode, i8080_disassemble(opcode));
+      addr += i8080_opcode_length(opcode);
+    }
+  } else {
+    printf("no difference in %lu instructions (%lu cycles)\n", instructions,
+        machines[0].cpu.cyc);
+  }
+
+  i8080_diff_free(&d);
+  if (r != NULL) {
+    i8080_trace_read_close(r);
+    fclose(f);
+  }
+  return d.diverged ? 1 : 0;
+}
@@ -0,0 +1,144 @@
+// i8080_profile runs a CP/M program (as the test roms) with the profiler
+// (built with I8080_PROFILER, see `make profile`), and prints its hottest
+// addresses and the cycles spent in each of its subroutines.
+//
+//   usage: i8080_profile [-e engine] [-o folded] [-n count] rom
+//
+// Engines are `interpreter` and `cache` (by default). With -o, the calling
+// contexts are written as folded stacks to a file, for flame graph tools
+// (e.g. `flamegraph.pl folded > profile.svg`). -n sets the number of
+// addresses printed (20 by default).
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "../i8080.h"
+
+#define RUN_CYCLES 100000000
+
+typedef struct machine {
+  i8080 cpu;
+  uint8_t memory[0x10000];
+} machine;
+
+static uint8_t port_in(void* userdata, uint8_t port) {
+  (void) userdata;
+  (void) port;
+  return 0x00;
+}
+
+// port 0 ends the program, what it prints (port 1) is ignored
+static void port_out(void* userdata, uint8_t port, uint8_t value) {
+  (void) value;
+  machine* const m = userdata;
+  if (port == 0) {
+    i8080_stop(&m->cpu);
+  }
+}
+
+static bool load_machine(machine* const m, const char* filename,
+    const char* engine) {
+  i8080* const c = &m->cpu;
+  i8080_init(c);
+  c->userdata = m;
+  c->port_in = port_in;
+  c->port_out = port_out;
+  memset(m->memory, 0, sizeof(m->memory));
+  i8080_map_ram(c, 0x0000, sizeof(m->memory), m->memory);
+
+  FILE* const f = fopen(filename, "rb");
+  if (f == NULL) {
+    fprintf(stderr, "error: can't open file '%s'.\n", filename);
+    return false;
+  }
+  fread(&m->memory[0x100], 1, sizeof(m->memory) - 0x100, f);
+  fclose(f);
+
+  c->pc = 0x100;
+  // "out 0,a" at 0x0000 and "out 1,a; ret" at 0x0005, as in i8080_tests.c
+  memcpy(&m->memory[0x0000], "\xD3\x00", 2);
+  memcpy(&m->memory[0x0005], "\xD3\x01\xC9", 3);
+
+  if (strcmp(engine, "cache") == 0) {
+    return i8080_enable_cache(c);
+  }
+  return strcmp(engine, "interpreter") == 0;
+}
+
+int main(int argc, char** argv) {
+  const char* engine = "cache";
+  const char* folded = NULL;
+  int count = 20;
+  int i = 1;
+  for (; i < argc - 1; i += 2) {
+    if (strcmp(argv[i], "-e") == 0) {
+      engine = argv[i + 1];
+    } else if (strcmp(argv[i], "-o") == 0) {
+      folded = argv[i + 1];
+    } else if (strcmp(argv[i], "-n") == 0) {
+      count = atoi(argv[i + 1]);
+    } else {
+      break;
+    }
+  }
+  if (i != argc - 1) {
+    fprintf(stderr, "usage: %s [-e engine] [-o folded] [-n count] rom\n",
+        argv[0]);
+    return 1;
+  }
+
+  static machine m;
+  if (!load_machine(&m, argv[i], engine)) {
+    fprintf(stderr, "error: can't use the engine '%s'.\n", engine);
+    return 1;
+  }
+  i8080_profile* const p = i8080_profile_start(&m.cpu);
+  if (p == NULL) {
+    fprintf(stderr, "error: can't start the profiler.\n");
+    return 1;
+  }
+
+  i8080_run_result result;
+  do {
+    result = i8080_run(&m.cpu, RUN_CYCLES);
+  } while (result.reason == I8080_RUN_BUDGET);
+  i8080_profile_stop(&m.cpu);
+
+  // hottest addresses, by selection of the `count` highest counts
+  static bool printed[0x10000];
+  printf("%lu cycles\n\naddress           cycles\n", m.cpu.cyc);
+  for (int k = 0; k < count; k++) {
+    long best = -1;
+    for (long addr = 0; addr < 0x10000; addr++) {
+      if (!printed[addr] && p->cycles[addr] != 0 &&
+          (best < 0 || p->cycles[addr] > p->cycles[best])) {
+        best = addr;
+      }
+    }
+    if (best < 0) {
+      break;
+    }
+    printed[best] = true;
+    const uint8_t opcode = m.memory[best];
+    printf("%04lX    %16lu  %5.2f%%  %02X %s\n", best, p->cycles[best],
+        100.0 * p->cycles[best] / m.cpu.cyc, opcode,
+        i8080_disassemble(opcode));
+  }
+  printf("\n");
+  i8080_profile_write_routines(p, stdout);
+
+  int status = 0;
+  if (folded != NULL) {
+    FILE* const f = fopen(folded, "w");
+    if (f == NULL || !i8080_profile_write_folded(p, f)) {
+      fprintf(stderr, "error: can't write '%s'.\n", folded);
+      status = 1;
+    }
+    if (f != NULL) {
+      fclose(f);
+    }
+  }
+
+  i8080_profile_free(p);
+  return status;
+}
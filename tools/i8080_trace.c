@@ -0,0 +1,50 @@
+// i8080_trace converts binary traces (see i8080_trace.h) to the text output
+// of i8080_debug_output.
+//
+//   usage: i8080_trace [-d] trace
+//
+// With -d, the disassembly of each instruction is printed too.
+
+#include <stdio.h>
+#include <string.h>
+#include "../i8080.h"
+#include "../i8080_trace.h"
+
+int main(int argc, char** argv) {
+  const bool print_disassembly = argc == 3 && strcmp(argv[1], "-d") == 0;
+  if (argc != 2 && !print_disassembly) {
+    fprintf(stderr, "usage: %s [-d] trace\n", argv[0]);
+    return 1;
+  }
+
+  const char* const filename = argv[argc - 1];
+  FILE* const f = fopen(filename, "rb");
+  if (f == NULL) {
+    fprintf(stderr, "error: can't open file '%s'.\n", filename);
+    return 1;
+  }
+
+  i8080_trace_reader* const r = i8080_trace_read_open(f);
+  if (r == NULL) {
+    fprintf(stderr, "error: '%s' isn't a trace.\n", filename);
+    fclose(f);
+    return 1;
+  }
+
+  i8080_trace_record rec;
+  while (i8080_trace_read(r, &rec)) {
+    printf("PC: %04X, AF: %04X, BC: %04X, DE: %04X, HL: %04X, SP: %04X, "
+           "CYC: %lu",
+        rec.pc, rec.af, rec.bc, rec.de, rec.hl, rec.sp, rec.cyc);
+    printf("\t(%02X %02X %02X %02X)", rec.mem[0], rec.mem[1], rec.mem[2],
+        rec.mem[3]);
+    if (print_disassembly) {
+      printf(" - %s", i8080_disassemble(rec.mem[0]));
+    }
+    printf("\n");
+  }
+
+  i8080_trace_read_close(r);
+  fclose(f);
+  return 0;
+}